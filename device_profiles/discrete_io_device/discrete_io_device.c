@@ -91,6 +91,22 @@ static void DIO_DEVICE_run      (EI_API_CIP_NODE_T *pCipNode);
 
 static bool DIO_DEVICE_cipSetup (EI_API_CIP_NODE_T *pCipNode);
 
+/**
+ * \brief Set to 1 to have DIO_DEVICE_run print the DIP and DOP statistics periodically
+ */
+#ifndef DIO_DEVICE_STATS_PRINT
+#define DIO_DEVICE_STATS_PRINT    0
+#endif
+
+#if DIO_DEVICE_STATS_PRINT
+static void DIO_DEVICE_printStats(void);
+
+/**
+ * \brief Period, in milliseconds, of the DIP and DOP statistics printed by DIO_DEVICE_run
+ */
+#define DIO_DEVICE_STATS_PERIOD   10000UL
+#endif
+
 static DIO_DEVICE_ConnectionState_t DIO_DEVICE_connectionState_s = DIO_DEVICE_ConnectionNotEstablished;
 static EI_API_ADP_SModNetStatus_t DIO_DEVICE_modnetStatus_s    = {0};
 static volatile uint32_t DIO_DEVICE_dopLedStatus_s = 0;
@@ -299,6 +315,17 @@ static void  DIO_DEVICE_dipGetValue (uint16_t  instanceID, uint8_t *pValue)
   }
 }
 
+/**
+ * \brief user function to read out all Discrete Input Point values at once
+ * \param[out] pImage pointer to packed values, bit (instanceID - 1) for each DIP object
+ * \ingroup DIO_DEVICE_MAIN
+ */
+static void  DIO_DEVICE_dipGetImage (uint32_t *pImage)
+{
+  //Mirror Output data into input
+  *pImage = DIO_DEVICE_dopLedStatus_s;
+}
+
 /**
  * \brief user function to set Discrete Output Point value
  * \param[in] instanceID Instance-ID of the DOP object
@@ -320,6 +347,17 @@ static void DIO_DEVICE_dopSetValue (uint16_t instanceID, ei_api_cip_edt_bool val
     DRV_LED_industrialSet(DIO_DEVICE_dopLedStatus_s);
 }
 
+/**
+ * \brief user function to set all Discrete Output Point values at once
+ * \param[in] image packed values, bit (instanceID - 1) for each DOP object
+ * \ingroup DIO_DEVICE_MAIN
+ */
+static void DIO_DEVICE_dopSetImage (uint32_t image)
+{
+    DIO_DEVICE_dopLedStatus_s = image;
+    DRV_LED_industrialSet(DIO_DEVICE_dopLedStatus_s);
+}
+
 /*!
  *
  * \brief
@@ -366,6 +404,12 @@ bool DIO_DEVICE_init(EI_API_ADP_T *pAdapter, EI_API_CIP_NODE_T *pCipNode)
         }
     }
 
+    // Sample all inputs on each cycle
+    if(false == DIO_DEVICE_DIP_setFullScan(DIO_DEVICE_dipGetImage))
+    {
+        OSAL_printf("%s:%d Failed to select DIP full-scan mode\r\n", __func__, __LINE__);
+    }
+
     for(i = 0; i<CFG_PROFILE_DIO_DEVICE_DOP_NUM_OF_INST; i++)
     {
         dopCfg.fuSetOutput = DIO_DEVICE_dopSetValue;
@@ -383,6 +427,12 @@ bool DIO_DEVICE_init(EI_API_ADP_T *pAdapter, EI_API_CIP_NODE_T *pCipNode)
         }
     }
 
+    // Write all outputs at once
+    if(false == DIO_DEVICE_DOP_setBulkOutput(DIO_DEVICE_dopSetImage))
+    {
+        OSAL_printf("%s:%d Failed to select DOP bulk output mode\r\n", __func__, __LINE__);
+    }
+
     dogCfg.dop_instance_binding_list = dog_bind_array;
     dogCfg.list_len = 4;
     result = DIO_DEVICE_DOG_addObject(1, &dogCfg);
@@ -413,7 +463,41 @@ void DIO_DEVICE_run(EI_API_CIP_NODE_T* pCipNode)
 {
     DIO_DEVICE_DIP_run();
     DIO_DEVICE_DOP_run();
+#if DIO_DEVICE_STATS_PRINT
+    DIO_DEVICE_printStats();
+#endif
+}
+
+#if DIO_DEVICE_STATS_PRINT
+
+/*!
+ *
+ * \brief
+ * Prints the DIP and DOP statistics.
+ *
+ * \details
+ * Prints the input scan statistics and the cycles the DIP and DOP objects would have
+ * skipped on the object table lock, once every DIO_DEVICE_STATS_PERIOD milliseconds.
+ * \ingroup DIO_DEVICE_MAIN
+ */
+static void DIO_DEVICE_printStats(void)
+{
+    static uint32_t lastPrint = 0;
+    DIO_DEVICE_DIP_ScanStats_t dipStats;
+    uint32_t now = OSAL_getMsTick();
+
+    if((now - lastPrint) < DIO_DEVICE_STATS_PERIOD)
+    {
+        return;
+    }
+    lastPrint = now;
+
+    DIO_DEVICE_DIP_getScanStats(&dipStats);
+    OSAL_printf("DIP scans %u latency %u ms max %u ms locked %u, DOP locked %u\r\n",
+                dipStats.scans, dipStats.lastLatency, dipStats.maxLatency,
+                dipStats.lockedCycles, DIO_DEVICE_DOP_getLockedCycles());
 }
+#endif
 
 /*!
  *
@@ -53,6 +53,26 @@
 
 
 
+/**
+ * \brief
+ * Set to 0 to map every point of the input-point assemblies as a member of its own,
+ * read through DIO_DEVICE_DIP_getObjValue(), instead of producing the whole assembly
+ * from the packed DIP value image.
+ */
+#ifndef DIO_DEVICE_ASM_INPUT_POINT_BULK
+#define DIO_DEVICE_ASM_INPUT_POINT_BULK 1
+#endif
+
+/**
+ * \brief
+ * Set to 0 to map every point of the output-point assemblies as a member of its own,
+ * passed to DIO_DEVICE_DOP_receiveDataEvent(), instead of consuming the whole assembly
+ * through DIO_DEVICE_DOP_receiveDataImage().
+ */
+#ifndef DIO_DEVICE_ASM_OUTPUT_POINT_BULK
+#define DIO_DEVICE_ASM_OUTPUT_POINT_BULK 1
+#endif
+
 //----------- Private typedefs ----------
 typedef struct DIO_DEVICE_ASM_container
 {
@@ -61,12 +81,14 @@ typedef struct DIO_DEVICE_ASM_container
         bool     isInitialized;
         uint16_t input_point_count;
         uint16_t input_point_assembly_lenght;
+        uint32_t input_point_mask;
     }inputPoint;
     struct
     {
         bool     isInitialized;
         uint16_t output_point_count;
         uint16_t output_point_assembly_lenght;
+        uint32_t output_point_mask;
     }outputPoint;
     struct
     {
@@ -137,6 +159,11 @@ static EI_API_CIP_EAssemb_Return_Code_t DIO_DEVICE_ASM_inputPointCustomMapCb( co
 
             pProduceBuffer->u16uActData = DIO_DEVICE_ASM_handle.inputPoint.input_point_assembly_lenght;
             retValue = ASSEMB_SERVICE_RESPONSE_OK;
+
+            if(1 == pAttrMapData->instanceId) //once per production
+            {
+                DIO_DEVICE_DIP_notifyProduced();
+            }
         }
     }
 
@@ -184,6 +211,38 @@ static EI_API_CIP_EAssemb_Return_Code_t DIO_DEVICE_ASM_outputPointCustomMap_SetC
 
     return retValue;
 }
+
+/*
+ * Consumes a whole output-point assembly, mapped as a single member. The run/idle
+ * header is checked once and the output data is passed on as one packed image, so
+ * that only the DOP objects whose value changed receive an event.
+ */
+static EI_API_CIP_EAssemb_Return_Code_t DIO_DEVICE_ASM_outputPointBulkSetCb( EI_API_CIP_SAssemMapData_t *pAttrMapData, const EI_API_CIP_STransferBuffer_t *pConsumeBuffer)
+{
+    EI_API_CIP_EAssemb_Return_Code_t retValue = ASSEMB_SERVICE_NO_RESPONSE;
+    uint32_t image = 0;
+
+    if((0x09 == pAttrMapData->classId))
+    {
+        /**
+         * It is assumed that the O->T connection is using 32bit idle/run header
+         */
+        if(0x00 == pConsumeBuffer->p8uDataBuf[0])
+        {
+            DIO_DEVICE_DOP_receiveIdleImage(DIO_DEVICE_ASM_handle.outputPoint.output_point_mask); //Idle Command
+        }
+        else
+        {
+            OSAL_MEMORY_memcpy(&image, &pConsumeBuffer->p8uDataBuf[4], DIO_DEVICE_ASM_handle.outputPoint.output_point_assembly_lenght);
+            image &= DIO_DEVICE_ASM_handle.outputPoint.output_point_mask;
+            DIO_DEVICE_DOP_receiveDataImage(image, DIO_DEVICE_ASM_handle.outputPoint.output_point_mask);
+            pAttrMapData->pAttribBuf[0] = image & 1; //the member maps the value of instance 1
+        }
+        retValue = ASSEMB_SERVICE_RESPONSE_OK;
+    }
+
+    return retValue;
+}
 //---------------------------------------------------------------------------------------------------------------
 EI_API_CIP_EAssemb_Return_Code_t DIO_DEVICE_ASM_outputPointCustomMap_GetCb( const EI_API_CIP_SAssemMapData_t *pAttrMapData, EI_API_CIP_STransferBuffer_t *pProduceBuffer)
 {
@@ -215,6 +274,58 @@ EI_API_CIP_EAssemb_Return_Code_t DIO_DEVICE_ASM_outputPointCustomMap_GetCb( cons
 
      return retValue;
 }
+
+/*
+ * Produces a whole output-point assembly, mapped as a single member, from the values
+ * of the DOP objects.
+ */
+static EI_API_CIP_EAssemb_Return_Code_t DIO_DEVICE_ASM_outputPointBulkGetCb( const EI_API_CIP_SAssemMapData_t *pAttrMapData, EI_API_CIP_STransferBuffer_t *pProduceBuffer)
+{
+    EI_API_CIP_EAssemb_Return_Code_t retValue = ASSEMB_SERVICE_NO_RESPONSE;
+    uint32_t image = 0;
+    uint8_t attrValue = 0;
+
+    if((0x09 == pAttrMapData->classId))
+    {
+        for(uint16_t i=0; i<DIO_DEVICE_ASM_handle.outputPoint.output_point_count; i++)
+        {
+            if((EI_API_CIP_eERR_OK == DIO_DEVICE_DOP_getObjValue(i + 1, 3, (void *)&attrValue)) && (0 != attrValue))
+            {
+                image |= (1UL << i);
+            }
+        }
+        OSAL_MEMORY_memcpy(pProduceBuffer->p8uDataBuf, &image, DIO_DEVICE_ASM_handle.outputPoint.output_point_assembly_lenght);
+
+        pProduceBuffer->u16uActData = DIO_DEVICE_ASM_handle.outputPoint.output_point_assembly_lenght;
+        retValue = ASSEMB_SERVICE_RESPONSE_OK;
+    }
+
+     return retValue;
+}
+
+/*
+ * Produces a whole input-point assembly, mapped as a single member, from the packed
+ * DIP value image. Bit (instanceID - 1) of the image goes to the same bit of the
+ * assembly, which on this little-endian target is a plain copy of the low bytes.
+ */
+static EI_API_CIP_EAssemb_Return_Code_t DIO_DEVICE_ASM_inputPointBulkMapCb( const EI_API_CIP_SAssemMapData_t *pAttrMapData, EI_API_CIP_STransferBuffer_t *pProduceBuffer)
+{
+    EI_API_CIP_EAssemb_Return_Code_t retValue = ASSEMB_SERVICE_NO_RESPONSE;
+    uint32_t image;
+
+    if((0x08 == pAttrMapData->classId))
+    {
+        image = DIO_DEVICE_DIP_getValueImage() & DIO_DEVICE_ASM_handle.inputPoint.input_point_mask;
+        OSAL_MEMORY_memcpy(pProduceBuffer->p8uDataBuf, &image, DIO_DEVICE_ASM_handle.inputPoint.input_point_assembly_lenght);
+
+        pProduceBuffer->u16uActData = DIO_DEVICE_ASM_handle.inputPoint.input_point_assembly_lenght;
+        retValue = ASSEMB_SERVICE_RESPONSE_OK;
+
+        DIO_DEVICE_DIP_notifyProduced();
+    }
+
+     return retValue;
+}
 //---------------------------------------------------------------------------------------------------------------
 static DIO_DEVICE_ASM_ReturnCodes_t DIO_DEVICE_ASM_createInputPoint_Members(EI_API_CIP_NODE_T* pCipNode, DIO_DEVICE_ASM_instances_t type)
 {
@@ -245,18 +356,38 @@ static DIO_DEVICE_ASM_ReturnCodes_t DIO_DEVICE_ASM_createInputPoint_Members(EI_A
             break;
         }
 
-        for(uint16_t i=0; i<DIO_DEVICE_ASM_handle.inputPoint.input_point_count; i++)
-        {
+        DIO_DEVICE_ASM_handle.inputPoint.input_point_mask =
+            (DIO_DEVICE_DIP_IMAGE_BITS == DIO_DEVICE_ASM_handle.inputPoint.input_point_count) ?
+            0xFFFFFFFFUL : ((1UL << DIO_DEVICE_ASM_handle.inputPoint.input_point_count) - 1);
 
-            assembCustomMapCfg.assemblyMemberLength = (0 == i) ? DIO_DEVICE_ASM_handle.inputPoint.input_point_assembly_lenght : 0;
+        if((0 != DIO_DEVICE_ASM_INPUT_POINT_BULK) &&
+           (DIO_DEVICE_DIP_IMAGE_BITS >= DIO_DEVICE_ASM_handle.inputPoint.input_point_count))
+        {
+            //the whole assembly is one member, produced in one go from the DIP value image
+            assembCustomMapCfg.assemblyMemberLength = DIO_DEVICE_ASM_handle.inputPoint.input_point_assembly_lenght;
             assembCustomMapCfg.mappedClassId = 0x08;
-            assembCustomMapCfg.mappedInstanceId = i + 1;
+            assembCustomMapCfg.mappedInstanceId = 1;
             assembCustomMapCfg.mappedAttributeId = 0x03; //value attribute of DIP object
-            assembCustomMapCfg.fuCustomGet = DIO_DEVICE_ASM_inputPointCustomMapCb;
+            assembCustomMapCfg.fuCustomGet = DIO_DEVICE_ASM_inputPointBulkMapCb;
             assembCustomMapCfg.fuCustomSet = NULL;
             errCode = EI_API_CIP_addAssemblyMemberCustomMapped(pCipNode, type, &assembCustomMapCfg);
             DIO_DEVICE_ASM_Assert(errCode);
         }
+        else
+        {
+            for(uint16_t i=0; i<DIO_DEVICE_ASM_handle.inputPoint.input_point_count; i++)
+            {
+
+                assembCustomMapCfg.assemblyMemberLength = (0 == i) ? DIO_DEVICE_ASM_handle.inputPoint.input_point_assembly_lenght : 0;
+                assembCustomMapCfg.mappedClassId = 0x08;
+                assembCustomMapCfg.mappedInstanceId = i + 1;
+                assembCustomMapCfg.mappedAttributeId = 0x03; //value attribute of DIP object
+                assembCustomMapCfg.fuCustomGet = DIO_DEVICE_ASM_inputPointCustomMapCb;
+                assembCustomMapCfg.fuCustomSet = NULL;
+                errCode = EI_API_CIP_addAssemblyMemberCustomMapped(pCipNode, type, &assembCustomMapCfg);
+                DIO_DEVICE_ASM_Assert(errCode);
+            }
+        }
 
         DIO_DEVICE_ASM_handle.inputPoint.isInitialized = true;
     }
@@ -301,17 +432,37 @@ static DIO_DEVICE_ASM_ReturnCodes_t DIO_DEVICE_ASM_createOutputPoint_Members(EI_
         errCode = EI_API_CIP_setAssemblyFormat(pCipNode, type, ASSEMB_FORMAT_32BITHEADER);
         DIO_DEVICE_ASM_Assert(errCode);
 
-        for(uint16_t i=0; i<DIO_DEVICE_ASM_handle.outputPoint.output_point_count; i++)
+        DIO_DEVICE_ASM_handle.outputPoint.output_point_mask =
+            (DIO_DEVICE_DOP_IMAGE_BITS == DIO_DEVICE_ASM_handle.outputPoint.output_point_count) ?
+            0xFFFFFFFFUL : ((1UL << DIO_DEVICE_ASM_handle.outputPoint.output_point_count) - 1);
+
+        if((0 != DIO_DEVICE_ASM_OUTPUT_POINT_BULK) &&
+           (DIO_DEVICE_DOP_IMAGE_BITS >= DIO_DEVICE_ASM_handle.outputPoint.output_point_count))
         {
-            assembCustomMapCfg.assemblyMemberLength = (0 == i) ? (DIO_DEVICE_ASM_handle.outputPoint.output_point_assembly_lenght)  : 0;
+            //the whole assembly is one member, consumed in one go
+            assembCustomMapCfg.assemblyMemberLength = DIO_DEVICE_ASM_handle.outputPoint.output_point_assembly_lenght;
             assembCustomMapCfg.mappedClassId = 0x09;
-            assembCustomMapCfg.mappedInstanceId = i + 1;
+            assembCustomMapCfg.mappedInstanceId = 1;
             assembCustomMapCfg.mappedAttributeId = 0x03; //value attribute of DOP object
-            assembCustomMapCfg.fuCustomGet = DIO_DEVICE_ASM_outputPointCustomMap_GetCb;
-            assembCustomMapCfg.fuCustomSet = DIO_DEVICE_ASM_outputPointCustomMap_SetCb;
+            assembCustomMapCfg.fuCustomGet = DIO_DEVICE_ASM_outputPointBulkGetCb;
+            assembCustomMapCfg.fuCustomSet = DIO_DEVICE_ASM_outputPointBulkSetCb;
             errCode = EI_API_CIP_addAssemblyMemberCustomMapped(pCipNode, type, &assembCustomMapCfg);
             DIO_DEVICE_ASM_Assert(errCode);
         }
+        else
+        {
+            for(uint16_t i=0; i<DIO_DEVICE_ASM_handle.outputPoint.output_point_count; i++)
+            {
+                assembCustomMapCfg.assemblyMemberLength = (0 == i) ? (DIO_DEVICE_ASM_handle.outputPoint.output_point_assembly_lenght)  : 0;
+                assembCustomMapCfg.mappedClassId = 0x09;
+                assembCustomMapCfg.mappedInstanceId = i + 1;
+                assembCustomMapCfg.mappedAttributeId = 0x03; //value attribute of DOP object
+                assembCustomMapCfg.fuCustomGet = DIO_DEVICE_ASM_outputPointCustomMap_GetCb;
+                assembCustomMapCfg.fuCustomSet = DIO_DEVICE_ASM_outputPointCustomMap_SetCb;
+                errCode = EI_API_CIP_addAssemblyMemberCustomMapped(pCipNode, type, &assembCustomMapCfg);
+                DIO_DEVICE_ASM_Assert(errCode);
+            }
+        }
 
         DIO_DEVICE_ASM_handle.outputPoint.isInitialized = true;
     }
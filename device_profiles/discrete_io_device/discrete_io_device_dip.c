@@ -81,24 +81,58 @@
 #include "device_profiles/discrete_io_device/discrete_io_device.h"
 #include "device_profiles/discrete_io_device/discrete_io_device_dip.h"
 
+/**
+ * \brief
+ * Number of DIP instances the class can hold. The objects are kept in a table
+ * indexed by instance-ID, so the valid instance-IDs are 1 to this value.
+*/
+#ifndef DIO_DEVICE_DIP_MAX_INSTANCES
+#define DIO_DEVICE_DIP_MAX_INSTANCES  CFG_PROFILE_DIO_DEVICE_DIP_NUM_OF_INST
+#endif
+
+/**
+ * \brief
+ * The list of the objects in use is kept in two generations. Adding or deleting an
+ * object builds the next generation in the spare list and then publishes it, so
+ * DIO_DEVICE_DIP_run always finds a complete list and never takes the mutex.
+*/
+#define DIO_DEVICE_DIP_NUM_GENERATIONS  2
+#define DIO_DEVICE_DIP_GEN_NONE         DIO_DEVICE_DIP_NUM_GENERATIONS  //!< DIO_DEVICE_DIP_run is not using a list
+
 /**
  *
 */
 typedef struct DIO_DEVICE_DIP_object
 {
     uint16_t                       instanceID;
+    volatile bool                  inUse;
     DIO_DEVICE_DIP_ObjectCfg_t     userCallbacks;
     DIO_DEVICE_DIP_ObjectState_t   current_state;
     DIO_DEVICE_DIP_ObjectState_t   old_state;
     ei_api_cip_edt_bool            value;
     ei_api_cip_edt_bool            status;
-    struct DIO_DEVICE_DIP_object  *nextObject;
+    uint32_t                       sampleTick;    //!< OSAL_getMsTick() when value was sampled
 }DIO_DEVICE_DIP_object_t;
 
 typedef struct DIO_DEVICE_DIP_container
 {
     bool                     isClassInitialized;
-    DIO_DEVICE_DIP_object_t *head;
+    DIO_DEVICE_DIP_object_t  objects[DIO_DEVICE_DIP_MAX_INSTANCES];      //!< slot (instanceID - 1)
+    uint16_t                 activeList[DIO_DEVICE_DIP_NUM_GENERATIONS][DIO_DEVICE_DIP_MAX_INSTANCES]; //!< instance-IDs of the objects in use
+    uint16_t                 numActive[DIO_DEVICE_DIP_NUM_GENERATIONS];
+    volatile uint32_t        activeGen;                                  //!< generation of activeList to be run
+    volatile uint32_t        runGen;                                     //!< generation DIO_DEVICE_DIP_run is using, DIO_DEVICE_DIP_GEN_NONE outside it
+    uint16_t                 runIndex;                                   //!< next activeList entry to run
+    DIO_DEVICE_DIP_getInputImage volatile fuGetImage;                    //!< set in full-scan mode
+    uint32_t                 inputImage;                                 //!< input values read by the last full scan
+    uint32_t                 scanTick;                                   //!< OSAL_getMsTick() of the last full scan
+    volatile uint32_t        oldestTick;                                 //!< OSAL_getMsTick() of the oldest input value
+    volatile bool            oldestValid;                                //!< false until the oldest input value is sampled
+    volatile uint32_t        valueImage;                                 //!< value attribute of each object, bit (instanceID - 1), written by DIO_DEVICE_DIP_run only
+    volatile uint32_t        activeMask;                                 //!< objects in use, bit (instanceID - 1)
+    volatile uint32_t        runMask;                                    //!< objects in the RUN state, bit (instanceID - 1)
+    volatile bool            tableLocked;                                //!< the mutex is held
+    DIO_DEVICE_DIP_ScanStats_t scanStats;
     EI_API_CIP_NODE_T       *pCipNode;
     void                    *mutex;
 }DIO_DEVICE_DIP_container_t;
@@ -125,6 +159,50 @@ static uint32_t DIO_DEVICE_DIP_getAttrCb (EI_API_CIP_NODE_T *pCipNode,
                                           uint16_t          *pLen,
                                           void              *pvValue);
 
+static inline uint32_t DIO_DEVICE_DIP_imageBit(uint16_t instanceID)
+{
+    return (DIO_DEVICE_DIP_IMAGE_BITS >= instanceID) ? (1UL << (instanceID - 1)) : 0;
+}
+
+/**
+ * Takes the mutex, which serializes the changes of the object table and explicit
+ * attribute access, and notes for DIO_DEVICE_DIP_run that it is held.
+ */
+static int32_t DIO_DEVICE_DIP_lockTable(uint32_t timeout)
+{
+    int32_t osalRetval;
+
+    osalRetval = OSAL_lockNamedMutex(dipContainer_s.mutex, timeout);
+    if(OSAL_ERR_NoError == osalRetval)
+    {
+        __atomic_store_n(&dipContainer_s.tableLocked, true, __ATOMIC_RELEASE);
+    }
+
+    return osalRetval;
+}
+
+static void DIO_DEVICE_DIP_unlockTable(void)
+{
+    __atomic_store_n(&dipContainer_s.tableLocked, false, __ATOMIC_RELEASE);
+    OSAL_unLockNamedMutex(dipContainer_s.mutex);
+}
+
+/**
+ * Publishes the generation of the active list built in the spare list, then waits
+ * until DIO_DEVICE_DIP_run has left the old one, so that the old list and the
+ * objects removed from it can be reused. It must be called with the mutex held.
+ */
+static void DIO_DEVICE_DIP_publishList(uint32_t gen)
+{
+    uint32_t oldGen = dipContainer_s.activeGen;
+
+    __atomic_store_n(&dipContainer_s.activeGen, gen, __ATOMIC_SEQ_CST);
+    while(oldGen == __atomic_load_n(&dipContainer_s.runGen, __ATOMIC_SEQ_CST))
+    {
+        OSAL_SCHED_sleep(1);
+    }
+}
+
 static DIO_DEVICE_DIP_object_t*  DIO_DEVICE_DIP_findObj(uint16_t instanceID)
 {
     DIO_DEVICE_DIP_object_t  *pDipObj = NULL;
@@ -134,16 +212,12 @@ static DIO_DEVICE_DIP_object_t*  DIO_DEVICE_DIP_findObj(uint16_t instanceID)
         OSAL_error (__func__, __LINE__, OSAL_STACK_INIT_ERROR, true, 0);
         return NULL;
     }
-    else
+    else if((0 != instanceID) && (DIO_DEVICE_DIP_MAX_INSTANCES >= instanceID))
     {
-        pDipObj  = dipContainer_s.head;
-        while (NULL != pDipObj)
+        pDipObj  = &dipContainer_s.objects[instanceID - 1];
+        if(false == pDipObj->inUse)
         {
-            if(instanceID == pDipObj->instanceID)
-            {
-                break;
-            }
-            pDipObj = pDipObj->nextObject;
+            pDipObj = NULL;
         }
     }
 
@@ -211,18 +285,17 @@ static uint32_t DIO_DEVICE_DIP_createInstance(DIO_DEVICE_DIP_object_t *pDipObjec
 
 static void DIO_DEVICE_DIP_insertObj(DIO_DEVICE_DIP_object_t *pDipObject)
 {
+    uint32_t gen = dipContainer_s.activeGen;
+    uint32_t nextGen = gen ^ 1;
+    uint16_t num = dipContainer_s.numActive[gen];
 
-    if(NULL == dipContainer_s.head) //first item?
-    {
-        dipContainer_s.head = pDipObject;
-        dipContainer_s.head->nextObject = NULL;
-    }
-    else
-    {
-        pDipObject->nextObject = dipContainer_s.head;
-        dipContainer_s.head = pDipObject;
-    }
+    OSAL_MEMORY_memcpy(dipContainer_s.activeList[nextGen], dipContainer_s.activeList[gen], num * sizeof(uint16_t));
+    dipContainer_s.activeList[nextGen][num] = pDipObject->instanceID;
+    dipContainer_s.numActive[nextGen] = num + 1;
 
+    __atomic_store_n(&pDipObject->inUse, true, __ATOMIC_RELEASE);
+    DIO_DEVICE_DIP_publishList(nextGen);
+    dipContainer_s.activeMask |= DIO_DEVICE_DIP_imageBit(pDipObject->instanceID);
 }
 
 /**
@@ -233,44 +306,41 @@ static void DIO_DEVICE_DIP_insertObj(DIO_DEVICE_DIP_object_t *pDipObject)
 */
 bool DIO_DEVICE_DIP_deleteObject(uint16_t instanceID)
 {
-    DIO_DEVICE_DIP_object_t *previous  = NULL;
     DIO_DEVICE_DIP_object_t *temp = NULL;
+    uint32_t gen;
+    uint32_t nextGen;
+    uint16_t num = 0;
+    uint16_t i;
     int32_t osalRetval;
 
-    osalRetval = OSAL_lockNamedMutex(dipContainer_s.mutex, 1000UL);
+    osalRetval = DIO_DEVICE_DIP_lockTable(1000UL);
     if(OSAL_ERR_NoError == osalRetval)
     {
-        if((NULL != dipContainer_s.head) && (instanceID == dipContainer_s.head->instanceID))
+        temp = DIO_DEVICE_DIP_findObj(instanceID);
+        if(NULL ==  temp)
         {
-            temp = dipContainer_s.head->nextObject;
-            OSAL_MEMORY_free(dipContainer_s.head);
-            dipContainer_s.head = temp;
-            OSAL_unLockNamedMutex(dipContainer_s.mutex);
-            return  true;
+            DIO_DEVICE_DIP_unlockTable();
+            return false; //the object could not be found
         }
 
-        temp = dipContainer_s.head;
-        //find the node to be deleted
-        while(NULL !=  temp)
+        //the next generation of the active list is the current one without the object
+        gen = dipContainer_s.activeGen;
+        nextGen = gen ^ 1;
+        for(i = 0; i < dipContainer_s.numActive[gen]; i++)
         {
-            previous = temp;
-            temp  = temp->nextObject;
-            if((NULL !=  temp) && (instanceID == temp->instanceID))
+            if(instanceID != dipContainer_s.activeList[gen][i])
             {
-                break;
+                dipContainer_s.activeList[nextGen][num] = dipContainer_s.activeList[gen][i];
+                num++;
             }
-
         }
+        dipContainer_s.numActive[nextGen] = num;
 
-        if(NULL ==  temp)
-        {
-            OSAL_unLockNamedMutex(dipContainer_s.mutex);
-            return false; //the Node could not be found
-        }
-
-        previous->nextObject  = temp->nextObject;
-        OSAL_MEMORY_free(temp);
-        OSAL_unLockNamedMutex(dipContainer_s.mutex);
+        __atomic_store_n(&temp->inUse, false, __ATOMIC_RELEASE);
+        DIO_DEVICE_DIP_publishList(nextGen);
+        dipContainer_s.activeMask &= ~DIO_DEVICE_DIP_imageBit(instanceID);
+        __atomic_fetch_and(&dipContainer_s.runMask, ~DIO_DEVICE_DIP_imageBit(instanceID), __ATOMIC_RELAXED);
+        DIO_DEVICE_DIP_unlockTable();
         return  true;
 
     }
@@ -573,7 +643,7 @@ uint32_t DIO_DEVICE_DIP_getObjValue(uint16_t instanceId, uint16_t attrId, void *
 
     if(NULL != pValue)
     {
-        osalRetval = OSAL_lockNamedMutex(dipContainer_s.mutex, 2UL);
+        osalRetval = DIO_DEVICE_DIP_lockTable(2UL);
         if(OSAL_ERR_NoError == osalRetval)
         {
             pDipObj = DIO_DEVICE_DIP_findObj(instanceId);
@@ -596,7 +666,7 @@ uint32_t DIO_DEVICE_DIP_getObjValue(uint16_t instanceId, uint16_t attrId, void *
             {
                 retVal = EI_API_CIP_eERR_INSTANCE_DOES_NOT_EXIST;
             }
-            OSAL_unLockNamedMutex(dipContainer_s.mutex);
+            DIO_DEVICE_DIP_unlockTable();
         }
     }
     else
@@ -655,7 +725,11 @@ void DIO_DEVICE_DIP_init(EI_API_CIP_NODE_T* pCipNode)
             goto laError;
         }
 
-        dipContainer_s.head = NULL;
+        OSAL_MEMORY_memset(dipContainer_s.objects, 0, sizeof(dipContainer_s.objects));
+        dipContainer_s.numActive[0] = 0;
+        dipContainer_s.activeGen = 0;
+        dipContainer_s.runGen = DIO_DEVICE_DIP_GEN_NONE;
+        dipContainer_s.runIndex = 0;
         dipContainer_s.pCipNode = pCipNode;
         dipContainer_s.isClassInitialized =  true;
 
@@ -694,7 +768,7 @@ bool DIO_DEVICE_DIP_addObject(uint16_t instanceID, DIO_DEVICE_DIP_ObjectCfg_t *p
         return false;
     }
 
-    osalRetval = OSAL_lockNamedMutex(dipContainer_s.mutex, 1000UL);
+    osalRetval = DIO_DEVICE_DIP_lockTable(1000UL);
     if(OSAL_ERR_NoError == osalRetval)
     {
         //first search if this instance is already created, when yes, then simply return the handle of it.
@@ -702,15 +776,15 @@ bool DIO_DEVICE_DIP_addObject(uint16_t instanceID, DIO_DEVICE_DIP_ObjectCfg_t *p
 
         if(NULL ==  pDipObj)
         {
-            pDipObj = OSAL_MEMORY_calloc(sizeof(DIO_DEVICE_DIP_object_t), 1);
-            if(NULL != pDipObj)
+            if((0 != instanceID) && (DIO_DEVICE_DIP_MAX_INSTANCES >= instanceID))
             {
+                pDipObj = &dipContainer_s.objects[instanceID - 1];
+                OSAL_MEMORY_memset(pDipObj, 0, sizeof(DIO_DEVICE_DIP_object_t));
                 pDipObj->instanceID = instanceID;
                 pDipObj->current_state = DIO_DEVICE_DIP_OBJECT_AVAILABLE;
                 pDipObj->userCallbacks.fuGetInput = pDipConfig->fuGetInput;
                 pDipObj->userCallbacks.fuGetStatus =  pDipConfig->fuGetStatus;
                 pDipObj->userCallbacks.fuGetEvent = pDipConfig->fuGetEvent;
-                pDipObj->nextObject = NULL;
                 errCode = DIO_DEVICE_DIP_createInstance(pDipObj);
                 if (EI_API_CIP_eERR_OK == errCode)
                 {
@@ -719,17 +793,16 @@ bool DIO_DEVICE_DIP_addObject(uint16_t instanceID, DIO_DEVICE_DIP_ObjectCfg_t *p
                 else
                 {
                     retval = false;
-                    OSAL_MEMORY_free(pDipObj);
                     pDipObj = NULL;
                 }
             }
             else
             {
-                OSAL_error (__func__, __LINE__, OSAL_STACK_INIT_ERROR, true, 0);
+                OSAL_printf("%s:%d DIP instance %u exceeds DIO_DEVICE_DIP_MAX_INSTANCES\r\n", __func__, __LINE__, instanceID);
             }
         }
 
-        OSAL_unLockNamedMutex(dipContainer_s.mutex);
+        DIO_DEVICE_DIP_unlockTable();
     }
     else
     {
@@ -746,84 +819,291 @@ bool DIO_DEVICE_DIP_addObject(uint16_t instanceID, DIO_DEVICE_DIP_ObjectCfg_t *p
 
     return retval;
 }
+
+/*!
+ *
+ * \brief Copies the value of a DIP object into the packed value image.
+ * \param[in] pDipObj the object
+ */
+static inline void DIO_DEVICE_DIP_updateImage(const DIO_DEVICE_DIP_object_t *pDipObj)
+{
+    uint32_t mask = DIO_DEVICE_DIP_imageBit(pDipObj->instanceID);
+
+    if(0 != pDipObj->value)
+    {
+        dipContainer_s.valueImage |= mask;
+    }
+    else
+    {
+        dipContainer_s.valueImage &= ~mask;
+    }
+}
+
+/*!
+ *
+ * \brief Runs the state-machine of one DIP object.
+ * \details
+ * In the RUN state the input value is taken from the image read by the last full
+ * scan when full-scan mode is selected, otherwise it is read through the object's
+ * fuGetInput callback.
+ * \param[in] pDipObj the object to run
+ * \param[in] pNetworkStatus module and network status
+ * \param[in] connectionStatus connection state
+ */
+static void DIO_DEVICE_DIP_runObject(DIO_DEVICE_DIP_object_t *pDipObj,
+                                     const EI_API_ADP_SModNetStatus_t *pNetworkStatus,
+                                     DIO_DEVICE_ConnectionState_t connectionStatus)
+{
+    if((EI_API_ADP_eSTATUS_LED_RED_ON == pNetworkStatus->mod) || (EI_API_ADP_eSTATUS_LED_RED_ON == pNetworkStatus->net))
+    {
+        pDipObj->current_state = DIO_DEVICE_DIP_OBJECT_UNRECOVERABLE_FAULT;
+    }
+    else if((EI_API_ADP_eSTATUS_LED_RED_BLINK== pNetworkStatus->mod) ||
+     (EI_API_ADP_eSTATUS_LED_RED_BLINK == pNetworkStatus->net) ||
+     (DIO_DEVICE_ConnectionClosed == connectionStatus))
+    {
+        pDipObj->current_state = DIO_DEVICE_DIP_OBJECT_RECOVERABLE_FAULT;
+    }
+
+    if(pDipObj->old_state != pDipObj->current_state)
+    {
+        pDipObj->old_state = pDipObj->current_state;
+    }
+
+    switch (pDipObj->current_state)
+    {
+    case DIO_DEVICE_DIP_OBJECT_NOT_EXISTS: //should not happen!
+        pDipObj->current_state = DIO_DEVICE_DIP_OBJECT_AVAILABLE;
+        break;
+    case DIO_DEVICE_DIP_OBJECT_AVAILABLE:
+        if((EI_API_ADP_eSTATUS_LED_GREEN_ON == pNetworkStatus->net) ||
+         (DIO_DEVICE_ConnectionEstablished == connectionStatus))
+        {
+            pDipObj->current_state = DIO_DEVICE_DIP_OBJECT_RUN;
+        }
+        break;
+    case DIO_DEVICE_DIP_OBJECT_RUN:
+        if(NULL != dipContainer_s.fuGetImage)
+        {
+            pDipObj->value = (dipContainer_s.inputImage >> (pDipObj->instanceID - 1)) & 1;
+            pDipObj->sampleTick = dipContainer_s.scanTick;
+        }
+        else
+        {
+            pDipObj->userCallbacks.fuGetInput(pDipObj->instanceID, (uint8_t *)&pDipObj->value);
+            pDipObj->sampleTick = OSAL_getMsTick();
+        }
+        DIO_DEVICE_DIP_updateImage(pDipObj);
+        if(NULL != pDipObj->userCallbacks.fuGetStatus)
+        {
+            pDipObj->userCallbacks.fuGetStatus(pDipObj->instanceID, (uint8_t *)&pDipObj->status);
+        }
+        break;
+    case DIO_DEVICE_DIP_OBJECT_RECOVERABLE_FAULT:
+        if((EI_API_ADP_eSTATUS_LED_GREEN_ON == pNetworkStatus->net) ||
+         (DIO_DEVICE_ConnectionEstablished == connectionStatus))
+        {
+            pDipObj->current_state = DIO_DEVICE_DIP_OBJECT_RUN;
+        }
+        break;
+    case DIO_DEVICE_DIP_OBJECT_UNRECOVERABLE_FAULT:
+        //no recovery...
+        break;
+    default:
+        //invalid state
+        break;
+    }
+
+    if(DIO_DEVICE_DIP_OBJECT_RUN == pDipObj->current_state)
+    {
+        __atomic_fetch_or(&dipContainer_s.runMask, DIO_DEVICE_DIP_imageBit(pDipObj->instanceID), __ATOMIC_RELAXED);
+    }
+    else
+    {
+        __atomic_fetch_and(&dipContainer_s.runMask, ~DIO_DEVICE_DIP_imageBit(pDipObj->instanceID), __ATOMIC_RELAXED);
+    }
+}
+
+/**
+ * Makes DIO_DEVICE_DIP_run use the published generation of the active list. The
+ * generation is noted before it is checked again, so a change of the table either
+ * sees it in use and waits, or is seen here.
+ */
+static uint32_t DIO_DEVICE_DIP_enterRun(void)
+{
+    uint32_t gen = __atomic_load_n(&dipContainer_s.activeGen, __ATOMIC_SEQ_CST);
+    uint32_t usedGen;
+
+    do
+    {
+        usedGen = gen;
+        __atomic_store_n(&dipContainer_s.runGen, usedGen, __ATOMIC_SEQ_CST);
+        gen = __atomic_load_n(&dipContainer_s.activeGen, __ATOMIC_SEQ_CST);
+    } while(gen != usedGen);
+
+    return usedGen;
+}
+
 /*!
  *
  * \brief DIP processing funcion.
  * \details
- * Runs the state-machine for each DIP object.
+ * Runs the state-machine for the DIP objects. In full-scan mode every object is run
+ * on each call, with the connection state and the input image read once per call, so
+ * the cost of a call is bounded by DIO_DEVICE_DIP_MAX_INSTANCES. Otherwise one object
+ * is run per call, in turn.
+ * The object table is read through the published generation of the active list, so
+ * no call waits for, or is skipped because of, an object being added or deleted.
  * \ingroup DIO_DEVICE_DIP
  */
 void DIO_DEVICE_DIP_run(void)
 {
     static volatile EI_API_ADP_SModNetStatus_t networkStatus = {0};
     static volatile DIO_DEVICE_ConnectionState_t connectionStatus = DIO_DEVICE_ConnectionNotEstablished ;
-    static volatile DIO_DEVICE_DIP_object_t  *pDipObj = NULL;
-    int32_t osalRetval;
+    DIO_DEVICE_DIP_object_t  *pDipObj = NULL;
+    DIO_DEVICE_DIP_getInputImage fuGetImage;
+    const uint16_t *pActiveList;
+    uint16_t numActive;
+    uint32_t gen;
+    uint16_t i;
+
+    //count the cycles that find the table locked, see DIO_DEVICE_DIP_ScanStats_t
+    if(__atomic_load_n(&dipContainer_s.tableLocked, __ATOMIC_ACQUIRE))
+    {
+        dipContainer_s.scanStats.lockedCycles++;
+    }
 
-    osalRetval = OSAL_lockNamedMutex(dipContainer_s.mutex, 2UL);
-    if(OSAL_ERR_NoError == osalRetval)
+    gen = DIO_DEVICE_DIP_enterRun();
+    pActiveList = dipContainer_s.activeList[gen];
+    numActive = dipContainer_s.numActive[gen];
+    fuGetImage = dipContainer_s.fuGetImage;
+
+    if(0 != numActive) //is there any object to run at all?
     {
-        if(NULL != dipContainer_s.head) //is there any object to run at all?
+        if(NULL != fuGetImage)
         {
-            if(NULL == pDipObj)
-            {
-                pDipObj = (volatile DIO_DEVICE_DIP_object_t  *)dipContainer_s.head;
-            }
-
+            //all objects share the connection state, read it through the first one
+            pDipObj = &dipContainer_s.objects[pActiveList[0] - 1];
             pDipObj->userCallbacks.fuGetEvent((DIO_DEVICE_ConnectionState_t *)&connectionStatus, (EI_API_ADP_SModNetStatus_t *)&networkStatus);
-            if((EI_API_ADP_eSTATUS_LED_RED_ON == networkStatus.mod) || (EI_API_ADP_eSTATUS_LED_RED_ON == networkStatus.net))
-            {
-                pDipObj->current_state = DIO_DEVICE_DIP_OBJECT_UNRECOVERABLE_FAULT;
-            }
-            else if((EI_API_ADP_eSTATUS_LED_RED_BLINK== networkStatus.mod) ||
-             (EI_API_ADP_eSTATUS_LED_RED_BLINK == networkStatus.net) ||
-             (DIO_DEVICE_ConnectionClosed == connectionStatus))
+
+            fuGetImage(&dipContainer_s.inputImage);
+            dipContainer_s.scanTick = OSAL_getMsTick();
+            dipContainer_s.scanStats.scans++;
+
+            for(i = 0; i < numActive; i++)
             {
-                pDipObj->current_state = DIO_DEVICE_DIP_OBJECT_RECOVERABLE_FAULT;
+                pDipObj = &dipContainer_s.objects[pActiveList[i] - 1];
+                DIO_DEVICE_DIP_runObject(pDipObj, (const EI_API_ADP_SModNetStatus_t *)&networkStatus, connectionStatus);
             }
 
-            if(pDipObj->old_state != pDipObj->current_state)
+            dipContainer_s.oldestTick = dipContainer_s.scanTick;
+            dipContainer_s.oldestValid = true;
+        }
+        else
+        {
+            if(dipContainer_s.runIndex >= numActive)
             {
-                pDipObj->old_state = pDipObj->current_state;
+                dipContainer_s.runIndex = 0;
             }
+            pDipObj = &dipContainer_s.objects[pActiveList[dipContainer_s.runIndex] - 1];
+
+            pDipObj->userCallbacks.fuGetEvent((DIO_DEVICE_ConnectionState_t *)&connectionStatus, (EI_API_ADP_SModNetStatus_t *)&networkStatus);
+            DIO_DEVICE_DIP_runObject(pDipObj, (const EI_API_ADP_SModNetStatus_t *)&networkStatus, connectionStatus);
+            dipContainer_s.runIndex++;
 
-            switch (pDipObj->current_state)
+            //the oldest input value is the one of the object to be run next
+            if(dipContainer_s.runIndex >= numActive)
             {
-            case DIO_DEVICE_DIP_OBJECT_NOT_EXISTS: //should not happen!
-                pDipObj->current_state = DIO_DEVICE_DIP_OBJECT_AVAILABLE;
-                break;
-            case DIO_DEVICE_DIP_OBJECT_AVAILABLE:
-                if((EI_API_ADP_eSTATUS_LED_GREEN_ON == networkStatus.net) ||
-                 (DIO_DEVICE_ConnectionEstablished == connectionStatus))
-                {
-                    pDipObj->current_state = DIO_DEVICE_DIP_OBJECT_RUN;
-                }
-                break;
-            case DIO_DEVICE_DIP_OBJECT_RUN:
-                pDipObj->userCallbacks.fuGetInput(pDipObj->instanceID, (uint8_t *)&pDipObj->value);
-                if(NULL != pDipObj->userCallbacks.fuGetStatus)
-                {
-                    pDipObj->userCallbacks.fuGetStatus(pDipObj->instanceID, (uint8_t *)&pDipObj->status);
-                }
-                break;
-            case DIO_DEVICE_DIP_OBJECT_RECOVERABLE_FAULT:
-                if((EI_API_ADP_eSTATUS_LED_GREEN_ON == networkStatus.net) ||
-                 (DIO_DEVICE_ConnectionEstablished == connectionStatus))
-                {
-                    pDipObj->current_state = DIO_DEVICE_DIP_OBJECT_RUN;
-                }
-                break;
-            case DIO_DEVICE_DIP_OBJECT_UNRECOVERABLE_FAULT:
-                //no recovery...
-                break;
-            default:
-                //invalid state
-                break;
+                dipContainer_s.runIndex = 0;
             }
-            pDipObj = (volatile DIO_DEVICE_DIP_object_t  *)pDipObj->nextObject;
+            pDipObj = &dipContainer_s.objects[pActiveList[dipContainer_s.runIndex] - 1];
+            dipContainer_s.oldestTick = pDipObj->sampleTick;
+            dipContainer_s.oldestValid = (DIO_DEVICE_DIP_OBJECT_RUN == pDipObj->current_state);
         }
+    }
+
+    __atomic_store_n(&dipContainer_s.runGen, DIO_DEVICE_DIP_GEN_NONE, __ATOMIC_SEQ_CST);
+}
 
-        OSAL_unLockNamedMutex(dipContainer_s.mutex);
+/**
+ * \brief Selects full-scan mode
+ * \param[in] fuGetImage function reading all input values at once, NULL to go back
+ *            to reading one object per call through its fuGetInput callback
+ * \return true if successful, false if the instance-IDs do not fit the image
+ * \ingroup DIO_DEVICE_DIP
+*/
+bool DIO_DEVICE_DIP_setFullScan(DIO_DEVICE_DIP_getInputImage fuGetImage)
+{
+    int32_t osalRetval;
+
+    if((NULL != fuGetImage) && (DIO_DEVICE_DIP_IMAGE_BITS < DIO_DEVICE_DIP_MAX_INSTANCES))
+    {
+        OSAL_printf("%s:%d DIO_DEVICE_DIP_MAX_INSTANCES exceeds the input image\r\n", __func__, __LINE__);
+        return false;
+    }
+
+    osalRetval = DIO_DEVICE_DIP_lockTable(1000UL);
+    if(OSAL_ERR_NoError != osalRetval)
+    {
+        OSAL_printf("%s:%d mutex lock error %d\r\n", __func__, __LINE__,  osalRetval);
+        OSAL_error (__func__, __LINE__, OSAL_STACK_INIT_ERROR, true, 0);
+        return false;
     }
 
+    dipContainer_s.fuGetImage = fuGetImage;
+    DIO_DEVICE_DIP_unlockTable();
+
+    return true;
+}
+
+/**
+ * \brief Records the production of an input assembly for the latency statistics
+ * \details
+ * The latency is taken from the oldest sample: in full-scan mode all objects were
+ * sampled by the last scan, otherwise the oldest is the object to be run next.
+ * DIO_DEVICE_DIP_run notes its sample time, so the object table is not read here.
+ * \ingroup DIO_DEVICE_DIP
+*/
+void DIO_DEVICE_DIP_notifyProduced(void)
+{
+    uint32_t latency;
+
+    if((0 == dipContainer_s.runMask) || (false == dipContainer_s.oldestValid))
+    {
+        return; //not sampled yet
+    }
+
+    latency = OSAL_getMsTick() - dipContainer_s.oldestTick;
+    dipContainer_s.scanStats.lastLatency = latency;
+    if(latency > dipContainer_s.scanStats.maxLatency)
+    {
+        dipContainer_s.scanStats.maxLatency = latency;
+    }
+}
+
+/**
+ * \brief Reads the input sampling statistics
+ * \param[out] pStats pointer to save the statistics
+ * \ingroup DIO_DEVICE_DIP
+*/
+void DIO_DEVICE_DIP_getScanStats(DIO_DEVICE_DIP_ScanStats_t *pStats)
+{
+    if(NULL != pStats)
+    {
+        OSAL_MEMORY_memcpy(pStats, &dipContainer_s.scanStats, sizeof(DIO_DEVICE_DIP_ScanStats_t));
+    }
+}
+
+/**
+ * \brief Reads the packed image of the input values
+ * \details
+ * The image is kept up to date as the objects are run, so an input assembly can be
+ * produced from it without looking up each object. It is a single word written only
+ * by #DIO_DEVICE_DIP_run, so it is read without taking the object table mutex.
+ * \return the last sampled value attribute of each DIP object in bit (instanceID - 1)
+ * \ingroup DIO_DEVICE_DIP
+*/
+uint32_t DIO_DEVICE_DIP_getValueImage(void)
+{
+    return dipContainer_s.valueImage & dipContainer_s.activeMask;
 }
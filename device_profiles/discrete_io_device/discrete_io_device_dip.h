@@ -87,6 +87,38 @@ typedef void  (*DIO_DEVICE_DIP_getInputValue)    (uint16_t  instanceID, uint8_t
  * \ingroup DIO_DEVICE_DIP
 */
 typedef void  (*DIO_DEVICE_DIP_getInputStatus)   (uint16_t  instanceID, uint8_t  *pStatus);
+/**
+ * \brief function pointer prototype for reading all input values at once
+ * \param[out] pImage packed input values, bit (instanceID - 1) holds the value of each DIP object
+ * \ingroup DIO_DEVICE_DIP
+*/
+typedef void  (*DIO_DEVICE_DIP_getInputImage)    (uint32_t *pImage);
+
+/**
+ * \brief
+ * Highest DIP instance-ID that can be read through #DIO_DEVICE_DIP_getInputImage.
+*/
+#define DIO_DEVICE_DIP_IMAGE_BITS 32
+
+/**
+ * \brief Input sampling statistics
+ * \details
+ * The latency is the age, in milliseconds, of the oldest input value at the moment
+ * an input assembly is produced. In full-scan mode every value is sampled on each
+ * call of #DIO_DEVICE_DIP_run, otherwise one object is sampled per call.
+ * #DIO_DEVICE_DIP_run does not lock the object table. It used to, with a 2 ms timeout.
+ * lockedCycles counts every call made while the lock is held, from the moment it is
+ * taken: the calls the locking run would have waited in, and skipped if the lock was
+ * held for 2 ms more.
+ * \ingroup DIO_DEVICE_DIP
+ */
+typedef struct DIO_DEVICE_DIP_ScanStats
+{
+    uint32_t scans;          //!< number of full scans
+    uint32_t lastLatency;    //!< latency of the last assembly production
+    uint32_t maxLatency;     //!< worst latency seen
+    uint32_t lockedCycles;   //!< calls of #DIO_DEVICE_DIP_run made while the object table was locked
+}DIO_DEVICE_DIP_ScanStats_t;
 
 /**
  * \brief DIP Object configuration structure
@@ -134,6 +166,31 @@ bool DIO_DEVICE_DIP_deleteObject(uint16_t instanceID);
  * \ingroup DIO_DEVICE_DIP
 */
 uint32_t DIO_DEVICE_DIP_getObjValue(uint16_t instanceID, uint16_t attrID, void *pValue);
+/**
+ * \brief Selects full-scan mode
+ * \param[in] fuGetImage function reading all input values at once, NULL to go back
+ *            to reading one object per call through its fuGetInput callback
+ * \return true if successful, false if the instance-IDs do not fit the image
+ * \ingroup DIO_DEVICE_DIP
+*/
+bool DIO_DEVICE_DIP_setFullScan(DIO_DEVICE_DIP_getInputImage fuGetImage);
+/**
+ * \brief Records the production of an input assembly for the latency statistics
+ * \ingroup DIO_DEVICE_DIP
+*/
+void DIO_DEVICE_DIP_notifyProduced(void);
+/**
+ * \brief Reads the input sampling statistics
+ * \param[out] pStats pointer to save the statistics
+ * \ingroup DIO_DEVICE_DIP
+*/
+void DIO_DEVICE_DIP_getScanStats(DIO_DEVICE_DIP_ScanStats_t *pStats);
+/**
+ * \brief Reads the packed image of the input values
+ * \return the last sampled value attribute of each DIP object in bit (instanceID - 1)
+ * \ingroup DIO_DEVICE_DIP
+*/
+uint32_t DIO_DEVICE_DIP_getValueImage(void);
 #ifdef  __cplusplus
 }
 #endif
@@ -82,11 +82,20 @@
 #include "device_profiles/discrete_io_device/discrete_io_device_dog.h"
 #include "device_profiles/discrete_io_device/discrete_io_device_dop.h"
 
+/**
+ * \brief
+ * Number of DOG instances the class can hold. The objects are kept in a table
+ * indexed by instance-ID, so the valid instance-IDs are 1 to this value.
+*/
+#ifndef DIO_DEVICE_DOG_MAX_INSTANCES
+#define DIO_DEVICE_DOG_MAX_INSTANCES  4
+#endif
+
 typedef struct DIO_DEVICE_DOG_object
 {
     uint16_t                       DOG_instanceID;
+    bool                           inUse;
     DIO_DEVICE_DOG_ObjectCfg_t     binding;
-    struct DIO_DEVICE_DOG_object  *nextObj;
 }DIO_DEVICE_DOG_object_t;
 
 typedef struct DIO_DEVICE_DOG_container
@@ -94,7 +103,7 @@ typedef struct DIO_DEVICE_DOG_container
     bool                      isClassInitialized;
     EI_API_CIP_NODE_T        *pCipNode;
     void                     *mutex;
-    DIO_DEVICE_DOG_object_t  *head;
+    DIO_DEVICE_DOG_object_t   objects[DIO_DEVICE_DOG_MAX_INSTANCES];   //!< slot (instanceID - 1)
 }DIO_DEVICE_DOG_container_t;
 
 static DIO_DEVICE_DOG_ClassData_t dogClassData_s = {.revision = CFG_PROFILE_DIO_DEVICE_DOG_REVISION_NUMBER
@@ -1727,7 +1736,7 @@ void DIO_DEVICE_DOG_init(EI_API_CIP_NODE_T* pCipNode)
             goto laError;
         }
 
-        dogContainer_s.head = NULL;
+        OSAL_MEMORY_memset(dogContainer_s.objects, 0, sizeof(dogContainer_s.objects));
         dogContainer_s.pCipNode = pCipNode;
         dogContainer_s.isClassInitialized = true;
     }
@@ -1749,16 +1758,12 @@ static DIO_DEVICE_DOG_object_t *DIO_DEVICE_DOG_findObject(uint16_t dog_instanceI
         OSAL_error (__func__, __LINE__, OSAL_STACK_INIT_ERROR, true, 0);
         return NULL;
     }
-    else
+    else if((0 != dog_instanceID) && (DIO_DEVICE_DOG_MAX_INSTANCES >= dog_instanceID))
     {
-        pObj  = dogContainer_s.head;
-        while (NULL != pObj)
+        pObj  = &dogContainer_s.objects[dog_instanceID - 1];
+        if(false == pObj->inUse)
         {
-            if(dog_instanceID == pObj->DOG_instanceID)
-            {
-                break;
-            }
-            pObj = pObj->nextObj;
+            pObj = NULL;
         }
     }
 
@@ -1883,23 +1888,6 @@ static uint32_t DIO_DEVICE_DOG_addInstance(EI_API_CIP_NODE_T* pCipNode, uint16_t
     return errCode;
 }
 
-/**
- *
- */
-static void DIO_DEVICE_DOG_insertObj(DIO_DEVICE_DOG_object_t *pDogObject)
-{
-
-    if(NULL == dogContainer_s.head) //first item?
-    {
-        dogContainer_s.head = pDogObject;
-        dogContainer_s.head->nextObj = NULL;
-    }
-    else
-    {
-        pDogObject->nextObj = dogContainer_s.head;
-        dogContainer_s.head = pDogObject;
-    }
-}
 /**
  * \brief Create and add a DOG instance object
  * \param[in] InstanceID the instance-ID of the DOG object to be created
@@ -1939,9 +1927,9 @@ bool DIO_DEVICE_DOG_addObject(uint16_t instanceID, DIO_DEVICE_DOG_ObjectCfg_t *c
         pDogObj = DIO_DEVICE_DOG_findObject(instanceID);
         if(NULL == pDogObj)
         {
-            pDogObj = OSAL_MEMORY_calloc(sizeof(DIO_DEVICE_DOG_object_t), 1);
-            if(NULL != pDogObj)
+            if((0 != instanceID) && (DIO_DEVICE_DOG_MAX_INSTANCES >= instanceID))
             {
+                pDogObj = &dogContainer_s.objects[instanceID - 1];
                 pDogObj->binding.dop_instance_binding_list = OSAL_MEMORY_calloc((config->list_len * sizeof(uint16_t)), 1);
                 if(NULL != pDogObj->binding.dop_instance_binding_list)
                 {
@@ -1950,28 +1938,30 @@ bool DIO_DEVICE_DOG_addObject(uint16_t instanceID, DIO_DEVICE_DOG_ObjectCfg_t *c
 
                     pDogObj->binding.list_len = config->list_len;
                     pDogObj->DOG_instanceID = instanceID;
-                    pDogObj->nextObj = NULL;
 
                     errCode = DIO_DEVICE_DOG_addInstance(dogContainer_s.pCipNode, instanceID);
                     if (EI_API_CIP_eERR_OK == errCode)
                     {
-                        DIO_DEVICE_DOG_insertObj(pDogObj);
+                        pDogObj->inUse = true;
                     }
                     else
                     {
                         retval = false;
                         OSAL_MEMORY_free(pDogObj->binding.dop_instance_binding_list);
-                        OSAL_MEMORY_free(pDogObj);
+                        pDogObj->binding.dop_instance_binding_list = NULL;
                         pDogObj = NULL;
                     }
                 }
                 else
                 {
                     retval = false;
-                    OSAL_MEMORY_free(pDogObj);
                     pDogObj = NULL;
                 }
             }
+            else
+            {
+                OSAL_printf("%s:%d DOG instance %u exceeds DIO_DEVICE_DOG_MAX_INSTANCES\r\n", __func__, __LINE__, instanceID);
+            }
         }
         else
         {
@@ -2003,7 +1993,6 @@ bool DIO_DEVICE_DOG_addObject(uint16_t instanceID, DIO_DEVICE_DOG_ObjectCfg_t *c
 */
 bool DIO_DEVICE_DOG_deleteObject(uint16_t instanceID)
 {
-    DIO_DEVICE_DOG_object_t *previous  = NULL;
     DIO_DEVICE_DOG_object_t *temp = NULL;
     int32_t osalRetval;
     bool retval = false;
@@ -2011,40 +2000,17 @@ bool DIO_DEVICE_DOG_deleteObject(uint16_t instanceID)
     osalRetval = OSAL_lockNamedMutex(dogContainer_s.mutex, 1000UL);
     if(OSAL_ERR_NoError == osalRetval)
     {
-        if((NULL != dogContainer_s.head) && (instanceID == dogContainer_s.head->DOG_instanceID))
+        temp = DIO_DEVICE_DOG_findObject(instanceID);
+        if(NULL ==  temp)
         {
-            temp = dogContainer_s.head->nextObj;
-            OSAL_MEMORY_free(dogContainer_s.head->binding.dop_instance_binding_list);
-            OSAL_MEMORY_free(dogContainer_s.head);
-            dogContainer_s.head = temp;
-            retval =  true;
+            retval = false; //the object could not be found
         }
         else
         {
-            temp = dogContainer_s.head;
-            //find the node to be deleted
-            while(NULL !=  temp)
-            {
-                previous = temp;
-                temp  = temp->nextObj;
-                if((NULL !=  temp) && (instanceID == temp->DOG_instanceID))
-                {
-                    break;
-                }
-
-            }
-
-            if(NULL ==  temp)
-            {
-                retval = false; //the Node could not be found
-            }
-            else
-            {
-                previous->nextObj  = temp->nextObj;
-                OSAL_MEMORY_free(temp->binding.dop_instance_binding_list);
-                OSAL_MEMORY_free(temp);
-                retval = true;
-            }
+            OSAL_MEMORY_free(temp->binding.dop_instance_binding_list);
+            temp->binding.dop_instance_binding_list = NULL;
+            temp->inUse = false;
+            retval = true;
         }
 
         OSAL_unLockNamedMutex(dogContainer_s.mutex);
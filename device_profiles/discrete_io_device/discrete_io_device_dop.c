@@ -107,12 +107,49 @@ typedef struct DIO_DEVICE_DOP_Value
     volatile DIO_DEVICE_DOP_dataContext_t context;
 }DIO_DEVICE_DOP_Value_t;
 
+/**
+ * \brief
+ * Number of DOP instances the class can hold. The objects are kept in a table
+ * indexed by instance-ID, so the valid instance-IDs are 1 to this value.
+*/
+#ifndef DIO_DEVICE_DOP_MAX_INSTANCES
+#define DIO_DEVICE_DOP_MAX_INSTANCES  CFG_PROFILE_DIO_DEVICE_DOP_NUM_OF_INST
+#endif
+
+/**
+ * \brief
+ * The list of the objects in use is kept in two generations. Adding or deleting an
+ * object builds the next generation in the spare list and then publishes it, so
+ * DIO_DEVICE_DOP_run always finds a complete list and never takes the mutex.
+*/
+#define DIO_DEVICE_DOP_NUM_GENERATIONS  2
+#define DIO_DEVICE_DOP_GEN_NONE         DIO_DEVICE_DOP_NUM_GENERATIONS  //!< DIO_DEVICE_DOP_run is not using a list
+
+/**
+ * \brief
+ * Number of connection and idle events that can wait for DIO_DEVICE_DOP_run. Each
+ * event is posted to every DOP object, so a Forward_Close followed by a Forward_Open
+ * and an idle packet before the next run take 3 entries per object. It must be a
+ * power of two.
+*/
+#ifndef DIO_DEVICE_DOP_EVENT_QUEUE_LEN
+#define DIO_DEVICE_DOP_EVENT_QUEUE_LEN  64
+#endif
+
+#if (0 != (DIO_DEVICE_DOP_EVENT_QUEUE_LEN & (DIO_DEVICE_DOP_EVENT_QUEUE_LEN - 1)))
+#error "DIO_DEVICE_DOP_EVENT_QUEUE_LEN must be a power of two"
+#endif
+#if (DIO_DEVICE_DOP_EVENT_QUEUE_LEN < (3 * DIO_DEVICE_DOP_MAX_INSTANCES))
+#error "DIO_DEVICE_DOP_EVENT_QUEUE_LEN is too small for DIO_DEVICE_DOP_MAX_INSTANCES"
+#endif
+
 /**
  *
 */
 typedef struct DIO_DEVICE_DOP_object
 {
     uint16_t                      instanceID;
+    volatile bool                 inUse;
     DIO_DEVICE_DOP_ObjectCfg_t    userCfg;
     volatile bool                 faultSettingChanged;
     volatile bool                 idleSettingChanged;
@@ -124,13 +161,63 @@ typedef struct DIO_DEVICE_DOP_object
     volatile DIO_DEVICE_DOP_SmStates_t  current_state;
     volatile DIO_DEVICE_DOP_SmStates_t  old_state;
     void (*processesFnc)(struct DIO_DEVICE_DOP_object *, DIO_DEVICE_DOP_events_t);
-    struct DIO_DEVICE_DOP_object        *nextObject;
 }DIO_DEVICE_DOP_object_t;
 
+/**
+ * I/O data of a whole output assembly, passed from the CIP callbacks to DIO_DEVICE_DOP_run.
+*/
+typedef struct DIO_DEVICE_DOP_rxImage
+{
+    uint32_t  image;
+    uint32_t  mask;
+    bool      idle;
+}DIO_DEVICE_DOP_rxImage_t;
+
+/**
+ * The rx images are a triple buffer: the writer fills the back buffer and exchanges it
+ * with the middle one, the reader exchanges the middle buffer with the front one when
+ * it holds new data. Neither side ever waits for the other.
+*/
+#define DIO_DEVICE_DOP_RX_NUM_BUFFERS  3
+#define DIO_DEVICE_DOP_RX_INDEX_MASK   0x03
+#define DIO_DEVICE_DOP_RX_FRESH        0x04
+
+/**
+ * A connection or idle event waiting for DIO_DEVICE_DOP_run. The events are kept in a
+ * bounded queue that any task can post to without locking: a poster claims an entry by
+ * advancing the head, and marks it complete through its sequence number.
+*/
+typedef struct DIO_DEVICE_DOP_eventEntry
+{
+    uint32_t                  sequence;
+    uint16_t                  instanceID;
+    DIO_DEVICE_DOP_events_t   event;
+}DIO_DEVICE_DOP_eventEntry_t;
+
 typedef struct DIO_DEVICE_DOP_container
 {
     bool                        isClassInitialized;
-    DIO_DEVICE_DOP_object_t    *head;
+    DIO_DEVICE_DOP_object_t     objects[DIO_DEVICE_DOP_MAX_INSTANCES];      //!< slot (instanceID - 1)
+    uint16_t                    activeList[DIO_DEVICE_DOP_NUM_GENERATIONS][DIO_DEVICE_DOP_MAX_INSTANCES]; //!< instance-IDs of the objects in use
+    uint16_t                    numActive[DIO_DEVICE_DOP_NUM_GENERATIONS];
+    volatile uint32_t           activeGen;                                  //!< generation of activeList to be run
+    volatile uint32_t           runGen;                                     //!< generation DIO_DEVICE_DOP_run is using, DIO_DEVICE_DOP_GEN_NONE outside it
+    uint16_t                    runIndex;                                   //!< next activeList entry to run
+    DIO_DEVICE_DOP_setOutputImage volatile fuSetImage;                      //!< set in bulk output mode
+    uint32_t                    outputImage;                                //!< outputs set by the state-machines
+    uint32_t                    appliedImage;                               //!< outputs last written through fuSetImage
+    DIO_DEVICE_DOP_setOutputImage fuApplied;                                //!< function appliedImage was written through
+    DIO_DEVICE_DOP_eventEntry_t events[DIO_DEVICE_DOP_EVENT_QUEUE_LEN];
+    uint32_t                    eventHead;                                  //!< next entry to be claimed by a poster
+    uint32_t                    eventTail;                                  //!< next entry to be taken by DIO_DEVICE_DOP_run
+    uint32_t                    receivedImage;                              //!< data of the last rx image consumed
+    bool                        receivedValid;
+    DIO_DEVICE_DOP_rxImage_t    rxBuffers[DIO_DEVICE_DOP_RX_NUM_BUFFERS];
+    uint32_t                    rxBack;                                     //!< owned by the writer
+    uint32_t                    rxMiddle;                                   //!< exchanged atomically, DIO_DEVICE_DOP_RX_FRESH when unread
+    uint32_t                    rxFront;                                    //!< owned by DIO_DEVICE_DOP_run
+    volatile bool               tableLocked;                                //!< the mutex is held
+    uint32_t                    lockedCycles;                               //!< calls of DIO_DEVICE_DOP_run made while the object table was locked
     EI_API_CIP_NODE_T          *pCipNode;
     void                       *mutex;
 }DIO_DEVICE_DOP_container_t;
@@ -146,6 +233,8 @@ static void DIO_DEVICE_DOP_procRecoverableFault(DIO_DEVICE_DOP_object_t *obj, DI
 static void DIO_DEVICE_DOP_procUnrecoverableFault(DIO_DEVICE_DOP_object_t *obj, DIO_DEVICE_DOP_events_t event);
 static inline DIO_DEVICE_DOP_events_t DIO_DEVICE_DOP_getOtherEvents(DIO_DEVICE_DOP_object_t *);
 static uint32_t DIO_DEVICE_DOP_setObjValue(uint16_t instanceID, uint16_t attrID, void *pValue, DIO_DEVICE_DOP_dataContext_t context);
+static void DIO_DEVICE_DOP_discardRxImage(void);
+static void DIO_DEVICE_DOP_runObject(DIO_DEVICE_DOP_object_t *pDopObj, DIO_DEVICE_DOP_events_t event);
 
 
 static DIO_DEVICE_DOP_container_t dopContainer_s = {0};
@@ -153,6 +242,108 @@ static DIO_DEVICE_DOP_container_t dopContainer_s = {0};
 static DIO_DEVICE_DOP_ClassData_t dopClassData_s = {.revision = CFG_PROFILE_DIO_DEVICE_DOP_REVISION_NUMBER
                                                };
 
+/**
+ * Takes the mutex, which serializes the changes of the object table and explicit
+ * attribute access, and notes for DIO_DEVICE_DOP_run that it is held.
+ */
+static int32_t DIO_DEVICE_DOP_lockTable(uint32_t timeout)
+{
+    int32_t osalRetval;
+
+    osalRetval = OSAL_lockNamedMutex(dopContainer_s.mutex, timeout);
+    if(OSAL_ERR_NoError == osalRetval)
+    {
+        __atomic_store_n(&dopContainer_s.tableLocked, true, __ATOMIC_RELEASE);
+    }
+
+    return osalRetval;
+}
+
+static void DIO_DEVICE_DOP_unlockTable(void)
+{
+    __atomic_store_n(&dopContainer_s.tableLocked, false, __ATOMIC_RELEASE);
+    OSAL_unLockNamedMutex(dopContainer_s.mutex);
+}
+
+/**
+ * Publishes the generation of the active list built in the spare list, then waits
+ * until DIO_DEVICE_DOP_run has left the old one, so that the old list and the
+ * objects removed from it can be reused. It must be called with the mutex held.
+ */
+static void DIO_DEVICE_DOP_publishList(uint32_t gen)
+{
+    uint32_t oldGen = dopContainer_s.activeGen;
+
+    __atomic_store_n(&dopContainer_s.activeGen, gen, __ATOMIC_SEQ_CST);
+    while(oldGen == __atomic_load_n(&dopContainer_s.runGen, __ATOMIC_SEQ_CST))
+    {
+        OSAL_SCHED_sleep(1);
+    }
+}
+
+/**
+ * Posts a connection or idle event for DIO_DEVICE_DOP_run. If the queue is full, which
+ * DIO_DEVICE_DOP_EVENT_QUEUE_LEN is sized to prevent, it waits for the next run.
+ */
+static void DIO_DEVICE_DOP_postEvent(uint16_t instanceID, DIO_DEVICE_DOP_events_t event)
+{
+    DIO_DEVICE_DOP_eventEntry_t *pEntry = NULL;
+    uint32_t head = __atomic_load_n(&dopContainer_s.eventHead, __ATOMIC_RELAXED);
+    uint32_t sequence;
+
+    for(;;)
+    {
+        pEntry = &dopContainer_s.events[head & (DIO_DEVICE_DOP_EVENT_QUEUE_LEN - 1)];
+        sequence = __atomic_load_n(&pEntry->sequence, __ATOMIC_ACQUIRE);
+        if(sequence == head)
+        {
+            //the entry is free, claim it
+            if(__atomic_compare_exchange_n(&dopContainer_s.eventHead, &head, head + 1,
+                                           false, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+            {
+                break;
+            }
+        }
+        else if((int32_t)(sequence - head) < 0)
+        {
+            //the queue is full
+            OSAL_SCHED_sleep(1);
+            head = __atomic_load_n(&dopContainer_s.eventHead, __ATOMIC_RELAXED);
+        }
+        else
+        {
+            //another poster claimed the entry
+            head = __atomic_load_n(&dopContainer_s.eventHead, __ATOMIC_RELAXED);
+        }
+    }
+
+    pEntry->instanceID = instanceID;
+    pEntry->event = event;
+    __atomic_store_n(&pEntry->sequence, head + 1, __ATOMIC_RELEASE);
+}
+
+/**
+ * Takes the oldest event posted for DIO_DEVICE_DOP_run.
+ * \return true if an event was taken, false if there is none
+ */
+static bool DIO_DEVICE_DOP_getEvent(uint16_t *pInstanceID, DIO_DEVICE_DOP_events_t *pEvent)
+{
+    uint32_t tail = dopContainer_s.eventTail;
+    DIO_DEVICE_DOP_eventEntry_t *pEntry = &dopContainer_s.events[tail & (DIO_DEVICE_DOP_EVENT_QUEUE_LEN - 1)];
+
+    if((tail + 1) != __atomic_load_n(&pEntry->sequence, __ATOMIC_ACQUIRE))
+    {
+        return false;
+    }
+
+    *pInstanceID = pEntry->instanceID;
+    *pEvent = pEntry->event;
+    __atomic_store_n(&pEntry->sequence, tail + DIO_DEVICE_DOP_EVENT_QUEUE_LEN, __ATOMIC_RELEASE);
+    dopContainer_s.eventTail = tail + 1;
+
+    return true;
+}
+
 static DIO_DEVICE_DOP_object_t*  DIO_DEVICE_DOP_findObject(uint16_t instanceID)
 {
     DIO_DEVICE_DOP_object_t  *pObj = NULL;
@@ -162,37 +353,58 @@ static DIO_DEVICE_DOP_object_t*  DIO_DEVICE_DOP_findObject(uint16_t instanceID)
         OSAL_error (__func__, __LINE__, OSAL_STACK_INIT_ERROR, true, 0);
         return NULL;
     }
-    else
+    else if((0 != instanceID) && (DIO_DEVICE_DOP_MAX_INSTANCES >= instanceID))
     {
-        pObj  = dopContainer_s.head;
-        while (NULL != pObj)
+        pObj  = &dopContainer_s.objects[instanceID - 1];
+        if(false == pObj->inUse)
         {
-            if(instanceID == pObj->instanceID)
-            {
-                break;
-            }
-            pObj = pObj->nextObject;
+            pObj = NULL;
         }
     }
 
     return pObj;
 }
 
-static void DIO_DEVICE_DOP_insertObject(DIO_DEVICE_DOP_object_t *pDopObject)
+/**
+ * Sets the output of a DOP object, either directly or, in bulk output mode, in the
+ * output image written by DIO_DEVICE_DOP_run.
+*/
+static inline void DIO_DEVICE_DOP_setOutput(DIO_DEVICE_DOP_object_t *pObj, ei_api_cip_edt_bool value)
 {
+    uint32_t mask;
 
-    if(NULL == dopContainer_s.head) //first item?
+    if(NULL != dopContainer_s.fuSetImage)
     {
-        dopContainer_s.head = pDopObject;
-        dopContainer_s.head->nextObject = NULL;
+        mask = 1UL << (pObj->instanceID - 1);
+        if(0 != value)
+        {
+            dopContainer_s.outputImage |= mask;
+        }
+        else
+        {
+            dopContainer_s.outputImage &= ~mask;
+        }
     }
     else
     {
-        pDopObject->nextObject = dopContainer_s.head;
-        dopContainer_s.head = pDopObject;
+        pObj->userCfg.fuSetOutput(pObj->instanceID, value);
     }
 }
 
+static void DIO_DEVICE_DOP_insertObject(DIO_DEVICE_DOP_object_t *pDopObject)
+{
+    uint32_t gen = dopContainer_s.activeGen;
+    uint32_t nextGen = gen ^ 1;
+    uint16_t num = dopContainer_s.numActive[gen];
+
+    OSAL_MEMORY_memcpy(dopContainer_s.activeList[nextGen], dopContainer_s.activeList[gen], num * sizeof(uint16_t));
+    dopContainer_s.activeList[nextGen][num] = pDopObject->instanceID;
+    dopContainer_s.numActive[nextGen] = num + 1;
+
+    __atomic_store_n(&pDopObject->inUse, true, __ATOMIC_RELEASE);
+    DIO_DEVICE_DOP_publishList(nextGen);
+}
+
 /*!
  * \brief
  * Add an attribute for the class instance.
@@ -283,7 +495,7 @@ static inline void DIO_DEVICE_DOP_OutputFault(DIO_DEVICE_DOP_object_t  *pObj, ui
         pObj->valueContainer.value = pObj->userCfg.FaultValue;
         if(updateOutput)
         {
-            pObj->userCfg.fuSetOutput(pObj->instanceID, pObj->userCfg.FaultValue);
+            DIO_DEVICE_DOP_setOutput(pObj, pObj->userCfg.FaultValue);
         }
     }
     else
@@ -301,7 +513,7 @@ static inline void DIO_DEVICE_DOP_OutputIdle(DIO_DEVICE_DOP_object_t  *pObj, uin
         pObj->valueContainer.value = pObj->userCfg.IdleValue;
         if(updateOutput)
         {
-            pObj->userCfg.fuSetOutput(pObj->instanceID, pObj->userCfg.IdleValue);
+            DIO_DEVICE_DOP_setOutput(pObj, pObj->userCfg.IdleValue);
         }
     }
     else
@@ -317,6 +529,11 @@ static void DIO_DEVICE_DOP_ChangeToState(DIO_DEVICE_DOP_object_t  *pObj, DIO_DEV
 {
     pObj->old_state = pObj->current_state;
     pObj->current_state = state;
+    if(DIO_DEVICE_DOP_SM_RUN != state)
+    {
+        //the next rx image is passed in full, an unchanged one must move the object back to run
+        dopContainer_s.receivedValid = false;
+    }
     switch (pObj->current_state)
     {
     case DIO_DEVICE_DOP_SM_NONEXISTENT:
@@ -354,11 +571,10 @@ static uint32_t DIO_DEVICE_DOP_setObjValue(uint16_t instanceID, uint16_t attrID,
     int32_t osalRetval;
     DIO_DEVICE_DOP_object_t *pDopObj = NULL;
     uint32_t retVal = EI_API_eERR_CB_NO_ERROR;
-    DIO_DEVICE_DOP_events_t event = DIO_DEVICE_DOP_EVENT_NOEVENT;
 
     if(NULL != pValue)
     {
-        osalRetval = OSAL_lockNamedMutex(dopContainer_s.mutex, 5UL);
+        osalRetval = DIO_DEVICE_DOP_lockTable(5UL);
         if(OSAL_ERR_NoError == osalRetval)
         {
             pDopObj = DIO_DEVICE_DOP_findObject(instanceID);
@@ -375,7 +591,7 @@ static uint32_t DIO_DEVICE_DOP_setObjValue(uint16_t instanceID, uint16_t attrID,
                             pDopObj->valueContainer.context = context;
                             if(DIO_DEVICE_DOP_DATA_IMPLICIT == context)
                             {
-                                pDopObj->receiveDataEvent = true;
+                                __atomic_store_n(&pDopObj->receiveDataEvent, true, __ATOMIC_RELEASE);
                             }
                         }
                         else
@@ -385,27 +601,27 @@ static uint32_t DIO_DEVICE_DOP_setObjValue(uint16_t instanceID, uint16_t attrID,
                         break;
                     case 5: //!< Fault Action
                         pDopObj->userCfg.FaultAction = *(ei_api_cip_edt_bool *)pValue;
-                        pDopObj->faultSettingChanged = true;
+                        __atomic_store_n(&pDopObj->faultSettingChanged, true, __ATOMIC_RELEASE);
                         break;
                     case 6: //!< Fault Value
                         pDopObj->userCfg.FaultValue = *(ei_api_cip_edt_bool *)pValue;
-                        pDopObj->faultSettingChanged = true;
+                        __atomic_store_n(&pDopObj->faultSettingChanged, true, __ATOMIC_RELEASE);
                         break;
                     case 7: //!< Idle Action
-                        pDopObj->idleSettingChanged = true;
                         pDopObj->userCfg.IdleAction = *(ei_api_cip_edt_bool *)pValue;
+                        __atomic_store_n(&pDopObj->idleSettingChanged, true, __ATOMIC_RELEASE);
                         break;
                     case 8: //!< Idle value
-                        pDopObj->idleSettingChanged = true;
                         pDopObj->userCfg.IdleValue = *(ei_api_cip_edt_bool *)pValue;
+                        __atomic_store_n(&pDopObj->idleSettingChanged, true, __ATOMIC_RELEASE);
                         break;
                     case 9: //!< Run_Idle_Command
                         if( (DIO_DEVICE_DOP_SM_IDLE == pDopObj->current_state) ||
                             (DIO_DEVICE_DOP_SM_READY == pDopObj->current_state) ||
                             (DIO_DEVICE_DOP_SM_RUN == pDopObj->current_state))
                             {
-                                pDopObj->runIdleValueChanged = true;
                                 pDopObj->run_idle_command = *(ei_api_cip_edt_bool *)pValue;
+                                __atomic_store_n(&pDopObj->runIdleValueChanged, true, __ATOMIC_RELEASE);
                             }
                             else
                             {
@@ -417,19 +633,14 @@ static uint32_t DIO_DEVICE_DOP_setObjValue(uint16_t instanceID, uint16_t attrID,
                         retVal = EI_API_eERR_CB_INVALID_VALUE;
                         break;
                     }
-
-                    event = DIO_DEVICE_DOP_getOtherEvents(pDopObj);
-                    if((NULL != pDopObj->processesFnc) && (DIO_DEVICE_DOP_EVENT_NOEVENT != event))
-                    {
-                        pDopObj->processesFnc(pDopObj, event);
-                    }
+                    //the changes are passed to the state-machine by DIO_DEVICE_DOP_run
                 }
             }
             else
             {
                 retVal = EI_API_eERR_CB_INVALID_VALUE;
             }
-            OSAL_unLockNamedMutex(dopContainer_s.mutex);
+            DIO_DEVICE_DOP_unlockTable();
         }
         else
         {
@@ -458,7 +669,7 @@ uint32_t DIO_DEVICE_DOP_getObjValue(uint16_t instanceId, uint16_t attrID, void *
     uint32_t retVal = EI_API_eERR_CB_NO_ERROR;
     if(NULL != pValue)
     {
-        osalRetval = OSAL_lockNamedMutex(dopContainer_s.mutex, 2UL);
+        osalRetval = DIO_DEVICE_DOP_lockTable(2UL);
         if(OSAL_ERR_NoError == osalRetval)
         {
             pDopObj = DIO_DEVICE_DOP_findObject(instanceId);
@@ -497,7 +708,7 @@ uint32_t DIO_DEVICE_DOP_getObjValue(uint16_t instanceId, uint16_t attrID, void *
             {
                 retVal = EI_API_eERR_CB_INVALID_VALUE;
             }
-            OSAL_unLockNamedMutex(dopContainer_s.mutex);
+            DIO_DEVICE_DOP_unlockTable();
         }
         else
         {
@@ -513,65 +724,166 @@ uint32_t DIO_DEVICE_DOP_getObjValue(uint16_t instanceId, uint16_t attrID, void *
 }
 
 
+/**
+ * Drops the I/O data received for a DOP object before a connection or idle event, so
+ * that it is not applied after the event. The data event of the per-member path is
+ * cleared and the unread rx image discarded before the event is posted: data taken by
+ * DIO_DEVICE_DOP_run before that is passed to the object ahead of the event.
+ */
+static void DIO_DEVICE_DOP_dropPendingData(uint16_t instanceID)
+{
+    if((0 != instanceID) && (DIO_DEVICE_DOP_MAX_INSTANCES >= instanceID))
+    {
+        __atomic_store_n(&dopContainer_s.objects[instanceID - 1].receiveDataEvent, false, __ATOMIC_RELEASE);
+    }
+    DIO_DEVICE_DOP_discardRxImage();
+}
+
 /**
  *
  */
 void DIO_DEVICE_DOP_receiveConnectionEvent(uint16_t instanceID, DIO_DEVICE_DOP_ConnectionEvent_t connectionEvent)
 {
-    int32_t osalRetval;
-    DIO_DEVICE_DOP_object_t *pDopObj = NULL;
     DIO_DEVICE_DOP_events_t event = DIO_DEVICE_DOP_EVENT_NOEVENT;
-    osalRetval = OSAL_lockNamedMutex(dopContainer_s.mutex, 5UL);
-    if(OSAL_ERR_NoError == osalRetval)
-    {
-        pDopObj = DIO_DEVICE_DOP_findObject(instanceID);
-        if(NULL != pDopObj)
-        {
-            if(NULL != pDopObj->processesFnc)
-            {
-                switch (connectionEvent)
-                {
-                case DIO_DEVICE_DOP_CONNECTION_DELETED:
-                    event = DIO_DEVICE_DOP_EVENT_CONNECTION_DELETED;
-                    break;
-                case DIO_DEVICE_DOP_CONNECTION_ESTABLISHED:
-                    event = DIO_DEVICE_DOP_EVENT_CONNECTION_ESTABLISHED;
-                    break;
-                case DIO_DEVICE_DOP_CONNECTION_TIMEDOUT:
-                    event = DIO_DEVICE_DOP_EVENT_CONNECTION_TIMEDOUT;
-                    break;
-                }
-                pDopObj->processesFnc(pDopObj, event);
-            }
-        }
 
-        OSAL_unLockNamedMutex(dopContainer_s.mutex);
+    switch (connectionEvent)
+    {
+    case DIO_DEVICE_DOP_CONNECTION_DELETED:
+        event = DIO_DEVICE_DOP_EVENT_CONNECTION_DELETED;
+        break;
+    case DIO_DEVICE_DOP_CONNECTION_ESTABLISHED:
+        event = DIO_DEVICE_DOP_EVENT_CONNECTION_ESTABLISHED;
+        break;
+    case DIO_DEVICE_DOP_CONNECTION_TIMEDOUT:
+        event = DIO_DEVICE_DOP_EVENT_CONNECTION_TIMEDOUT;
+        break;
     }
+
+    DIO_DEVICE_DOP_dropPendingData(instanceID);
+    DIO_DEVICE_DOP_postEvent(instanceID, event);
 }
 /**
  *
  */
 void DIO_DEVICE_DOP_receiveIdleEvent(uint16_t instanceID)
 {
-    int32_t osalRetval;
+    DIO_DEVICE_DOP_dropPendingData(instanceID);
+    DIO_DEVICE_DOP_postEvent(instanceID, DIO_DEVICE_DOP_EVENT_RECEIVE_IDLE_INVALID_DATA);
+}
+
+/**
+ * Publishes the I/O data of a whole output assembly for DIO_DEVICE_DOP_run. Only the
+ * newest data is kept, older data that has not been consumed yet is replaced.
+ */
+static void DIO_DEVICE_DOP_publishRxImage(uint32_t image, uint32_t mask, bool idle)
+{
+    DIO_DEVICE_DOP_rxImage_t *pRx = &dopContainer_s.rxBuffers[dopContainer_s.rxBack];
+    uint32_t old;
+
+    pRx->image = image;
+    pRx->mask = mask;
+    pRx->idle = idle;
+
+    old = __atomic_exchange_n(&dopContainer_s.rxMiddle, dopContainer_s.rxBack | DIO_DEVICE_DOP_RX_FRESH, __ATOMIC_ACQ_REL);
+    dopContainer_s.rxBack = old & DIO_DEVICE_DOP_RX_INDEX_MASK;
+}
+
+/**
+ * Drops I/O data that has been published but not consumed yet, so that data received
+ * before a connection or idle event is not applied after it. The buffer stays in the
+ * middle slot with its fresh flag cleared. If the writer publishes newer data, or
+ * DIO_DEVICE_DOP_run takes the buffer, in the meantime, the exchange fails and the
+ * buffer is left to them.
+ */
+static void DIO_DEVICE_DOP_discardRxImage(void)
+{
+    uint32_t middle = __atomic_load_n(&dopContainer_s.rxMiddle, __ATOMIC_ACQUIRE);
+
+    if(0 != (middle & DIO_DEVICE_DOP_RX_FRESH))
+    {
+        (void)__atomic_compare_exchange_n(&dopContainer_s.rxMiddle, &middle,
+                                          middle & DIO_DEVICE_DOP_RX_INDEX_MASK,
+                                          false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+    }
+}
+
+/**
+ * Passes the newest I/O data published by the CIP callbacks to the DOP objects. It is
+ * called by DIO_DEVICE_DOP_run, with the generation of the active list it runs.
+ */
+static void DIO_DEVICE_DOP_consumeRxImage(const uint16_t *pActiveList, uint16_t numActive)
+{
+    DIO_DEVICE_DOP_rxImage_t *pRx = NULL;
     DIO_DEVICE_DOP_object_t *pDopObj = NULL;
+    uint32_t old;
+    uint32_t changed;
+    uint16_t instanceID;
+    uint16_t i;
 
-    osalRetval = OSAL_lockNamedMutex(dopContainer_s.mutex, 2UL);
-    if(OSAL_ERR_NoError == osalRetval)
+    if(0 == (__atomic_load_n(&dopContainer_s.rxMiddle, __ATOMIC_ACQUIRE) & DIO_DEVICE_DOP_RX_FRESH))
     {
-        pDopObj = DIO_DEVICE_DOP_findObject(instanceID);
-        if(NULL != pDopObj)
+        return; //nothing new
+    }
+    old = __atomic_exchange_n(&dopContainer_s.rxMiddle, dopContainer_s.rxFront, __ATOMIC_ACQ_REL);
+    dopContainer_s.rxFront = old & DIO_DEVICE_DOP_RX_INDEX_MASK;
+    pRx = &dopContainer_s.rxBuffers[dopContainer_s.rxFront];
+
+    if(pRx->idle)
+    {
+        for(i = 0; i < numActive; i++)
         {
-            if(NULL != pDopObj->processesFnc)
+            pDopObj = &dopContainer_s.objects[pActiveList[i] - 1];
+            if((DIO_DEVICE_DOP_IMAGE_BITS >= pDopObj->instanceID) &&
+               (0 != (pRx->mask & (1UL << (pDopObj->instanceID - 1)))) &&
+               (NULL != pDopObj->processesFnc))
             {
                 pDopObj->processesFnc(pDopObj, DIO_DEVICE_DOP_EVENT_RECEIVE_IDLE_INVALID_DATA);
             }
         }
+        dopContainer_s.receivedValid = false;
+        return;
+    }
 
-        OSAL_unLockNamedMutex(dopContainer_s.mutex);
+    changed = pRx->mask;
+    if(dopContainer_s.receivedValid)
+    {
+        changed &= pRx->image ^ dopContainer_s.receivedImage;
+    }
+    dopContainer_s.receivedImage = pRx->image;
+    dopContainer_s.receivedValid = true;
+
+    while(0 != changed)
+    {
+        instanceID = (uint16_t)__builtin_ctz(changed) + 1;
+        changed &= changed - 1;
+
+        pDopObj = DIO_DEVICE_DOP_findObject(instanceID);
+        if((NULL != pDopObj) && (DIO_DEVICE_DOP_SM_UNRECOVERABLEFAULT != pDopObj->current_state))
+        {
+            pDopObj->valueContainer.value = (pRx->image >> (instanceID - 1)) & 1;
+            pDopObj->valueContainer.context = DIO_DEVICE_DOP_DATA_IMPLICIT;
+            pDopObj->receiveDataEvent = true;
+            DIO_DEVICE_DOP_runObject(pDopObj, DIO_DEVICE_DOP_EVENT_NOEVENT);
+        }
     }
 }
 
+/**
+ *
+ */
+void DIO_DEVICE_DOP_receiveIdleImage(uint32_t mask)
+{
+    DIO_DEVICE_DOP_publishRxImage(0, mask, true);
+}
+
+/**
+ *
+ */
+void DIO_DEVICE_DOP_receiveDataImage(uint32_t image, uint32_t mask)
+{
+    DIO_DEVICE_DOP_publishRxImage(image, mask, false);
+}
+
 /**
  *
  */
@@ -957,6 +1269,7 @@ void DIO_DEVICE_DOP_init(EI_API_CIP_NODE_T* pCipNode)
 {
     uint32_t errCode;
     EI_API_CIP_SService_t service;
+    uint32_t i;
 
     if(false == dopContainer_s.isClassInitialized)
     {
@@ -993,7 +1306,20 @@ void DIO_DEVICE_DOP_init(EI_API_CIP_NODE_T* pCipNode)
             goto laError;
         }
 
-        dopContainer_s.head = NULL;
+        OSAL_MEMORY_memset(dopContainer_s.objects, 0, sizeof(dopContainer_s.objects));
+        dopContainer_s.numActive[0] = 0;
+        dopContainer_s.activeGen = 0;
+        dopContainer_s.runGen = DIO_DEVICE_DOP_GEN_NONE;
+        dopContainer_s.runIndex = 0;
+        for(i = 0; i < DIO_DEVICE_DOP_EVENT_QUEUE_LEN; i++)
+        {
+            dopContainer_s.events[i].sequence = i;
+        }
+        dopContainer_s.eventHead = 0;
+        dopContainer_s.eventTail = 0;
+        dopContainer_s.rxBack = 0;
+        dopContainer_s.rxMiddle = 1;
+        dopContainer_s.rxFront = 2;
         dopContainer_s.pCipNode = pCipNode;
         dopContainer_s.isClassInitialized =  true;
     }
@@ -1031,7 +1357,7 @@ bool DIO_DEVICE_DOP_addObject(uint16_t instanceID, DIO_DEVICE_DOP_ObjectCfg_t *p
         return false;
     }
 
-    osalRetval = OSAL_lockNamedMutex(dopContainer_s.mutex, 1000UL);
+    osalRetval = DIO_DEVICE_DOP_lockTable(1000UL);
     if(OSAL_ERR_NoError == osalRetval)
     {
         //first search if this instance is already created, when yes, then simply return the handle of it.
@@ -1039,15 +1365,15 @@ bool DIO_DEVICE_DOP_addObject(uint16_t instanceID, DIO_DEVICE_DOP_ObjectCfg_t *p
 
         if(NULL ==  pDopObj)
         {
-            pDopObj = OSAL_MEMORY_calloc(sizeof(DIO_DEVICE_DOP_object_t), 1);
-            if(NULL != pDopObj)
+            if((0 != instanceID) && (DIO_DEVICE_DOP_MAX_INSTANCES >= instanceID))
             {
+                pDopObj = &dopContainer_s.objects[instanceID - 1];
+                OSAL_MEMORY_memset(pDopObj, 0, sizeof(DIO_DEVICE_DOP_object_t));
                 OSAL_MEMORY_memcpy(&pDopObj->userCfg, pDopConfig, sizeof(DIO_DEVICE_DOP_ObjectCfg_t));
                 pDopObj->instanceID = instanceID;
                 pDopObj->current_state = DIO_DEVICE_DOP_SM_AVAILABLE;
                 pDopObj->old_state = DIO_DEVICE_DOP_SM_NONEXISTENT;
                 pDopObj->processesFnc = DIO_DEVICE_DOP_procAvailable;
-                pDopObj->nextObject = NULL;
                 pDopObj->valueContainer.value = 0;
                 pDopObj->valueContainer.context = 0;
                 pDopObj->run_idle_command = 0;
@@ -1064,17 +1390,16 @@ bool DIO_DEVICE_DOP_addObject(uint16_t instanceID, DIO_DEVICE_DOP_ObjectCfg_t *p
                 else
                 {
                     retval = false;
-                    OSAL_MEMORY_free(pDopObj);
                     pDopObj = NULL;
                 }
             }
             else
             {
-                OSAL_error (__func__, __LINE__, OSAL_STACK_INIT_ERROR, true, 0);
+                OSAL_printf("%s:%d DOP instance %u exceeds DIO_DEVICE_DOP_MAX_INSTANCES\r\n", __func__, __LINE__, instanceID);
             }
         }
 
-        OSAL_unLockNamedMutex(dopContainer_s.mutex);
+        DIO_DEVICE_DOP_unlockTable();
     }
     else
     {
@@ -1099,49 +1424,43 @@ bool DIO_DEVICE_DOP_addObject(uint16_t instanceID, DIO_DEVICE_DOP_ObjectCfg_t *p
 */
 bool DIO_DEVICE_DOP_deleteObject(uint16_t instanceID)
 {
-    DIO_DEVICE_DOP_object_t *previous  = NULL;
     DIO_DEVICE_DOP_object_t *temp = NULL;
+    uint32_t gen;
+    uint32_t nextGen;
+    uint16_t num = 0;
+    uint16_t i;
     int32_t osalRetval;
     bool retval = false;
 
-    osalRetval = OSAL_lockNamedMutex(dopContainer_s.mutex, 1000UL);
+    osalRetval = DIO_DEVICE_DOP_lockTable(1000UL);
     if(OSAL_ERR_NoError == osalRetval)
     {
-        if((NULL != dopContainer_s.head) && (instanceID == dopContainer_s.head->instanceID))
+        temp = DIO_DEVICE_DOP_findObject(instanceID);
+        if(NULL ==  temp)
         {
-            temp = dopContainer_s.head->nextObject;
-            OSAL_MEMORY_free(dopContainer_s.head);
-            dopContainer_s.head = temp;
-            retval =  true;
+            retval = false; //the object could not be found
         }
         else
         {
-            temp = dopContainer_s.head;
-            //find the node to be deleted
-            while(NULL !=  temp)
+            //the next generation of the active list is the current one without the object
+            gen = dopContainer_s.activeGen;
+            nextGen = gen ^ 1;
+            for(i = 0; i < dopContainer_s.numActive[gen]; i++)
             {
-                previous = temp;
-                temp  = temp->nextObject;
-                if((NULL !=  temp) && (instanceID == temp->instanceID))
+                if(instanceID != dopContainer_s.activeList[gen][i])
                 {
-                    break;
+                    dopContainer_s.activeList[nextGen][num] = dopContainer_s.activeList[gen][i];
+                    num++;
                 }
-
             }
+            dopContainer_s.numActive[nextGen] = num;
 
-            if(NULL ==  temp)
-            {
-                retval = false; //the Node could not be found
-            }
-            else
-            {
-                previous->nextObject  = temp->nextObject;
-                OSAL_MEMORY_free(temp);
-                retval = true;
-            }
+            __atomic_store_n(&temp->inUse, false, __ATOMIC_RELEASE);
+            DIO_DEVICE_DOP_publishList(nextGen);
+            retval = true;
         }
 
-        OSAL_unLockNamedMutex(dopContainer_s.mutex);
+        DIO_DEVICE_DOP_unlockTable();
     }
     else
     {
@@ -1153,6 +1472,43 @@ bool DIO_DEVICE_DOP_deleteObject(uint16_t instanceID)
     return retval;
 }
 
+/**
+ * Makes DIO_DEVICE_DOP_run use the published generation of the active list. The
+ * generation is noted before it is checked again, so a change of the table either
+ * sees it in use and waits, or is seen here.
+ */
+static uint32_t DIO_DEVICE_DOP_enterRun(void)
+{
+    uint32_t gen = __atomic_load_n(&dopContainer_s.activeGen, __ATOMIC_SEQ_CST);
+    uint32_t usedGen;
+
+    do
+    {
+        usedGen = gen;
+        __atomic_store_n(&dopContainer_s.runGen, usedGen, __ATOMIC_SEQ_CST);
+        gen = __atomic_load_n(&dopContainer_s.activeGen, __ATOMIC_SEQ_CST);
+    } while(gen != usedGen);
+
+    return usedGen;
+}
+
+/**
+ * Runs the state-machine of one DOP object, with the event passed or else the next
+ * one left by the CIP callbacks, see DIO_DEVICE_DOP_getOtherEvents.
+ */
+static void DIO_DEVICE_DOP_runObject(DIO_DEVICE_DOP_object_t *pDopObj, DIO_DEVICE_DOP_events_t event)
+{
+    if(DIO_DEVICE_DOP_EVENT_NOEVENT == event)
+    {
+        event = DIO_DEVICE_DOP_getOtherEvents(pDopObj);
+    }
+
+    if(NULL != pDopObj->processesFnc)
+    {
+        pDopObj->processesFnc(pDopObj, event);
+    }
+}
+
 /*!
  *
  * \brief
@@ -1160,6 +1516,12 @@ bool DIO_DEVICE_DOP_deleteObject(uint16_t instanceID)
  *
  * \details
  * This function must be called cyclically. It runs the state-machine for each DOP object.
+ * In bulk output mode every object is run on each call and the outputs are then written
+ * at once, when any of them changed. Otherwise one object is run per call, in turn.
+ * The state-machines are only run from here: connection and idle events, I/O data and
+ * explicit attribute changes are left for this function by the CIP callbacks. The
+ * object table is read through the published generation of the active list, so no
+ * call waits for, or is skipped because of, an object being added or deleted.
  * \ingroup DIO_DEVICE_DOP
  *
  */
@@ -1167,37 +1529,128 @@ void DIO_DEVICE_DOP_run (void)
 {
     static volatile EI_API_ADP_SModNetStatus_t networkStatus = {0};
     static volatile DIO_DEVICE_ConnectionState_t connectionStatus = DIO_DEVICE_ConnectionNotEstablished ;
-    static volatile DIO_DEVICE_DOP_object_t  *pDopObj = NULL;
-    dop_state_proccess_t currentProcess = NULL;
+    DIO_DEVICE_DOP_object_t  *pDopObj = NULL;
+    DIO_DEVICE_DOP_setOutputImage fuSetImage;
     volatile DIO_DEVICE_DOP_events_t event =  DIO_DEVICE_DOP_EVENT_NOEVENT;
-    int32_t osalRetval;
+    DIO_DEVICE_DOP_events_t postedEvent;
+    const uint16_t *pActiveList;
+    uint16_t numActive;
+    uint16_t instanceID;
+    uint32_t gen;
+    uint16_t i;
 
-    osalRetval = OSAL_lockNamedMutex(dopContainer_s.mutex, 2UL);
-    if(OSAL_ERR_NoError == osalRetval)
+    //count the cycles that find the table locked, see DIO_DEVICE_DOP_getLockedCycles
+    if(__atomic_load_n(&dopContainer_s.tableLocked, __ATOMIC_ACQUIRE))
+    {
+        dopContainer_s.lockedCycles++;
+    }
+
+    gen = DIO_DEVICE_DOP_enterRun();
+    pActiveList = dopContainer_s.activeList[gen];
+    numActive = dopContainer_s.numActive[gen];
+    fuSetImage = dopContainer_s.fuSetImage;
+
+    //connection and idle events first, I/O data received after them is still waiting
+    while(DIO_DEVICE_DOP_getEvent(&instanceID, &postedEvent))
     {
-        if(NULL != dopContainer_s.head)
+        pDopObj = DIO_DEVICE_DOP_findObject(instanceID);
+        if(NULL != pDopObj)
         {
-            if(NULL == pDopObj)
-            {
-                pDopObj = (volatile DIO_DEVICE_DOP_object_t  *)dopContainer_s.head;
-            }
+            DIO_DEVICE_DOP_runObject(pDopObj, postedEvent);
+        }
+        dopContainer_s.receivedValid = false;
+    }
 
-            currentProcess = pDopObj->processesFnc;
+    DIO_DEVICE_DOP_consumeRxImage(pActiveList, numActive);
+
+    if(0 != numActive)
+    {
+        if(NULL != fuSetImage)
+        {
+            //all objects share the connection state, read it through the first one
+            pDopObj = &dopContainer_s.objects[pActiveList[0] - 1];
             pDopObj->userCfg.fuGetEvent((DIO_DEVICE_ConnectionState_t *)&connectionStatus, (EI_API_ADP_SModNetStatus_t *)&networkStatus);
             if((EI_API_ADP_eSTATUS_LED_RED_ON == networkStatus.mod) || (EI_API_ADP_eSTATUS_LED_RED_ON == networkStatus.net))
             {
                 event = DIO_DEVICE_DOP_EVENT_UNRECOVERABLE_FAULT;
             }
 
-            if(NULL != currentProcess)
+            for(i = 0; i < numActive; i++)
             {
-                currentProcess((DIO_DEVICE_DOP_object_t  *)pDopObj, event);
+                pDopObj = &dopContainer_s.objects[pActiveList[i] - 1];
+                DIO_DEVICE_DOP_runObject(pDopObj, event);
             }
 
-            pDopObj = (volatile DIO_DEVICE_DOP_object_t *)pDopObj->nextObject;
+            if((fuSetImage != dopContainer_s.fuApplied) ||
+               (dopContainer_s.outputImage != dopContainer_s.appliedImage))
+            {
+                fuSetImage(dopContainer_s.outputImage);
+                dopContainer_s.appliedImage = dopContainer_s.outputImage;
+                dopContainer_s.fuApplied = fuSetImage;
+            }
         }
-        OSAL_unLockNamedMutex(dopContainer_s.mutex);
+        else
+        {
+            if(dopContainer_s.runIndex >= numActive)
+            {
+                dopContainer_s.runIndex = 0;
+            }
+            pDopObj = &dopContainer_s.objects[pActiveList[dopContainer_s.runIndex] - 1];
+
+            pDopObj->userCfg.fuGetEvent((DIO_DEVICE_ConnectionState_t *)&connectionStatus, (EI_API_ADP_SModNetStatus_t *)&networkStatus);
+            if((EI_API_ADP_eSTATUS_LED_RED_ON == networkStatus.mod) || (EI_API_ADP_eSTATUS_LED_RED_ON == networkStatus.net))
+            {
+                event = DIO_DEVICE_DOP_EVENT_UNRECOVERABLE_FAULT;
+            }
+
+            DIO_DEVICE_DOP_runObject(pDopObj, event);
+
+            dopContainer_s.runIndex++;
+        }
+    }
+
+    __atomic_store_n(&dopContainer_s.runGen, DIO_DEVICE_DOP_GEN_NONE, __ATOMIC_SEQ_CST);
+}
+
+/**
+ * \brief Reads how often DIO_DEVICE_DOP_run found the object table locked
+ * \return number of calls made while the object table was locked
+ * \ingroup DIO_DEVICE_DOP
+ */
+uint32_t DIO_DEVICE_DOP_getLockedCycles(void)
+{
+    return dopContainer_s.lockedCycles;
+}
+
+/**
+ * \brief Selects bulk output mode
+ * \param[in] fuSetImage function setting all outputs at once, NULL to go back to setting
+ *            each output through its fuSetOutput callback
+ * \return true if successful, false if the instance-IDs do not fit the image
+ * \ingroup DIO_DEVICE_DOP
+ */
+bool DIO_DEVICE_DOP_setBulkOutput(DIO_DEVICE_DOP_setOutputImage fuSetImage)
+{
+    int32_t osalRetval;
+
+    if((NULL != fuSetImage) && (DIO_DEVICE_DOP_IMAGE_BITS < DIO_DEVICE_DOP_MAX_INSTANCES))
+    {
+        OSAL_printf("%s:%d DIO_DEVICE_DOP_MAX_INSTANCES exceeds the output image\r\n", __func__, __LINE__);
+        return false;
     }
+
+    osalRetval = DIO_DEVICE_DOP_lockTable(1000UL);
+    if(OSAL_ERR_NoError != osalRetval)
+    {
+        OSAL_printf("%s:%d mutex lock error %d\r\n", __func__, __LINE__,  osalRetval);
+        OSAL_error (__func__, __LINE__, OSAL_STACK_INIT_ERROR, true, 0);
+        return false;
+    }
+
+    dopContainer_s.fuSetImage = fuSetImage; //the outputs are written through it on the next run
+    DIO_DEVICE_DOP_unlockTable();
+
+    return true;
 }
 
 //-------------------------------------------------------------------------------------------
@@ -1205,9 +1658,8 @@ static inline DIO_DEVICE_DOP_events_t DIO_DEVICE_DOP_getOtherEvents(DIO_DEVICE_D
 {
     DIO_DEVICE_DOP_events_t event = DIO_DEVICE_DOP_EVENT_NOEVENT;
 
-    if(obj->runIdleValueChanged)
+    if(__atomic_exchange_n(&obj->runIdleValueChanged, false, __ATOMIC_ACQ_REL))
     {
-        obj->runIdleValueChanged = false;
         if(obj->run_idle_command)
         {
             event = DIO_DEVICE_DOP_EVENT_RECEIVE_RUN_COMMAND;
@@ -1217,9 +1669,8 @@ static inline DIO_DEVICE_DOP_events_t DIO_DEVICE_DOP_getOtherEvents(DIO_DEVICE_D
             event = DIO_DEVICE_DOP_EVENT_RECEIVE_IDLE_COMMAND;
         }
     }
-    else if(obj->receiveDataEvent)
+    else if(__atomic_exchange_n(&obj->receiveDataEvent, false, __ATOMIC_ACQ_REL))
     {
-        obj->receiveDataEvent = false;
         event = DIO_DEVICE_DOP_EVENT_RECEIVE_DATA;
     }
 
@@ -1288,9 +1739,8 @@ static void DIO_DEVICE_DOP_procIdle(DIO_DEVICE_DOP_object_t *obj, DIO_DEVICE_DOP
     {
         DIO_DEVICE_DOP_ChangeToState(obj, DIO_DEVICE_DOP_SM_RUN);
     }
-    else if(obj->idleSettingChanged)
+    else if(__atomic_exchange_n(&obj->idleSettingChanged, false, __ATOMIC_ACQ_REL))
     {
-        obj->idleSettingChanged = false;
         //update Idle-output
         DIO_DEVICE_DOP_OutputIdle(obj, 1);
     }
@@ -1368,7 +1818,7 @@ static void DIO_DEVICE_DOP_procRun(DIO_DEVICE_DOP_object_t *obj, DIO_DEVICE_DOP_
         DIO_DEVICE_DOP_ChangeToState(obj, DIO_DEVICE_DOP_SM_AVAILABLE);
     }
 
-    obj->userCfg.fuSetOutput(obj->instanceID, obj->valueContainer.value); //update output
+    DIO_DEVICE_DOP_setOutput(obj, obj->valueContainer.value); //update output
 }
 //----------------------------------------------------------------------------------------------
 static void DIO_DEVICE_DOP_procRecoverableFault(DIO_DEVICE_DOP_object_t *obj, DIO_DEVICE_DOP_events_t event)
@@ -1383,9 +1833,8 @@ static void DIO_DEVICE_DOP_procRecoverableFault(DIO_DEVICE_DOP_object_t *obj, DI
         obj->valueContainer.value = 0;
         DIO_DEVICE_DOP_ChangeToState(obj, DIO_DEVICE_DOP_SM_AVAILABLE);
     }
-    else if(obj->faultSettingChanged)
+    else if(__atomic_exchange_n(&obj->faultSettingChanged, false, __ATOMIC_ACQ_REL))
     {
-        obj->faultSettingChanged = false;
         //update fault-output
         DIO_DEVICE_DOP_OutputFault(obj, 1);
     }
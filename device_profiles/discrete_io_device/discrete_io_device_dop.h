@@ -97,6 +97,19 @@ extern "C" {
  */
 typedef void (*DIO_DEVICE_DOP_setOutputValue)(uint16_t instanceID, ei_api_cip_edt_bool value);
 
+/**
+ * \brief function pointer prototype for setting all outputs at once
+ * \param[in] image packed output values, bit (instanceID - 1) holds the value of each DOP object
+ * \ingroup DIO_DEVICE_DOP
+ */
+typedef void (*DIO_DEVICE_DOP_setOutputImage)(uint32_t image);
+
+/**
+ * \brief
+ * Highest DOP instance-ID that can be set through #DIO_DEVICE_DOP_setOutputImage.
+*/
+#define DIO_DEVICE_DOP_IMAGE_BITS 32
+
 /**
  * \brief DOP Object configuration structure
  * \ingroup DIO_DEVICE_DOP
@@ -222,6 +235,55 @@ void DIO_DEVICE_DOP_receiveIdleEvent(uint16_t instanceID);
  */
 void DIO_DEVICE_DOP_receiveConnectionEvent(uint16_t instanceID, DIO_DEVICE_DOP_ConnectionEvent_t connectionEvent);
 
+/**
+ * \brief should be called to pass the I/O data of a whole output assembly to the DOP objects
+ * \details
+ * The data is handed to #DIO_DEVICE_DOP_run without locking, so this never blocks; only
+ * the newest data is kept. There it is compared with the data passed before, and only
+ * the objects whose value changed receive a data event. Idle and connection events make
+ * the next data go to all objects again.
+ * \param[in] image packed output values, bit (instanceID - 1) for each DOP object
+ * \param[in] mask the bits of image that are carried by the assembly
+ * \ingroup DIO_DEVICE_DOP
+ */
+void DIO_DEVICE_DOP_receiveDataImage(uint32_t image, uint32_t mask);
+
+/**
+ * \brief should be called when an Idle-Event is received for a whole output assembly
+ * \details
+ * Like #DIO_DEVICE_DOP_receiveDataImage the event is handed to #DIO_DEVICE_DOP_run without locking.
+ * \param[in] mask the DOP objects carried by the assembly, bit (instanceID - 1) for each
+ * \ingroup DIO_DEVICE_DOP
+ */
+void DIO_DEVICE_DOP_receiveIdleImage(uint32_t mask);
+
+/**
+ * \brief Selects bulk output mode
+ * \details
+ * In bulk output mode #DIO_DEVICE_DOP_run runs every DOP object on each call and then
+ * writes all outputs at once through fuSetImage, if any of them changed. The fuSetOutput
+ * callbacks of the objects are not called.
+ * \param[in] fuSetImage function setting all outputs at once, NULL to go back to setting
+ *            each output through its fuSetOutput callback
+ * \return true if successful, false if the instance-IDs do not fit the image
+ * \ingroup DIO_DEVICE_DOP
+ */
+bool DIO_DEVICE_DOP_setBulkOutput(DIO_DEVICE_DOP_setOutputImage fuSetImage);
+
+/**
+ * \brief Reads how often #DIO_DEVICE_DOP_run found the object table locked
+ * \details
+ * The object table is locked while objects are added or deleted and during explicit
+ * attribute access. #DIO_DEVICE_DOP_run does not take the lock, it runs the published
+ * list of objects, so no cycle is skipped. Every call made while the lock is held is
+ * counted, from the moment it is taken. A run taking the lock with a 2 ms timeout would
+ * have waited in each of these calls, and skipped those for which the lock was held for
+ * 2 ms more.
+ * \return number of calls made while the object table was locked
+ * \ingroup DIO_DEVICE_DOP
+ */
+uint32_t DIO_DEVICE_DOP_getLockedCycles(void);
+
 #ifdef  __cplusplus
 }
 #endif
@@ -25,80 +25,1218 @@
 #include <stdbool.h>
 #include <stdint.h>
 #include <string.h>
+#include "inc/hw_ints.h"
 #include "inc/hw_memmap.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/rom_map.h"
 #include "driverlib/ssi.h"
 #include "utils/lwiplib.h"
 #include "utils/ustdlib.h"
 #include "httpserver_raw/httpd.h"
 #include "httpserver_raw/fs.h"
-#include "httpserver_raw/fsdata.h"
 #include "fatfs/src/ff.h"
 #include "fatfs/src/diskio.h"
+#include "enet_fs.h"
+#include "enet_rx.h"
+#include "events.h"
+#include "sd_cache.h"
 
 //*****************************************************************************
 //
-// Include the file system data for this application.  This file is generated
-// by the makefsfile utility, using the following command:
+// Set to 1 to serve the gzip-compressed variant of a file, where the image
+// holds one, in place of the uncompressed file.  The variants are only added
+// to the image when makefsdata.py is run with -z.  The httpd in this release
+// of lwIP does not pass the request headers through to the file system, so
+// fs_open() cannot see Accept-Encoding and the variant is sent to every
+// client, including those that did not ask for it.  This is therefore off
+// unless the application knows that all of its clients accept gzip.
 //
-//     ../../../../tools/bin/makefsfile -i fs -o enet_fsdata.h -r -h -q
+//*****************************************************************************
+#ifndef ENET_FS_GZIP
+#define ENET_FS_GZIP            0
+#endif
+
+//*****************************************************************************
+//
+// The number of files that can be open at once, and how many of those can be
+// files on the SD card.  httpd keeps one file open per connection, so there is
+// little point in allowing more files than lwIP allows TCP connections.  Each
+// SD card file carries a FatFs sector buffer and two read-ahead buffers, so
+// those are kept fewer.
+//
+//*****************************************************************************
+#ifndef ENET_FS_MAX_FILES
+#define ENET_FS_MAX_FILES       16
+#endif
+
+#ifndef ENET_FS_MAX_SD_FILES
+#define ENET_FS_MAX_SD_FILES    4
+#endif
+
+//*****************************************************************************
+//
+// The size of each of the two buffers that fs_process() fills from the card
+// ahead of httpd for every open SD card file, and the longest file name that
+// can be opened on the card.
+//
+//*****************************************************************************
+#ifndef ENET_FS_SD_BUF_SIZE
+#define ENET_FS_SD_BUF_SIZE     1024
+#endif
+
+#ifndef ENET_FS_SD_NAME_LEN
+#define ENET_FS_SD_NAME_LEN     64
+#endif
+
+//*****************************************************************************
+//
+// The number of generated files that can be added with
+// FSGeneratedFileAdd().
+//
+//*****************************************************************************
+#ifndef ENET_FS_MAX_GENERATED
+#define ENET_FS_MAX_GENERATED   4
+#endif
+
+//*****************************************************************************
+//
+// Mask and unmask the Ethernet interrupt around the state that fs_process()
+// shares with httpd.  When ENET_RX_DEFERRED is set, httpd runs from the main
+// loop as fs_process() does, so there is nothing to guard against; the
+// interrupt is then left masked by EnetRxIntHandler() until EnetRxProcess()
+// runs, and unmasking it here would let it fire again before that.
+//
+//*****************************************************************************
+#if ENET_RX_DEFERRED
+#define FS_ENET_INT_DISABLE()
+#define FS_ENET_INT_ENABLE()
+#else
+#define FS_ENET_INT_DISABLE()   MAP_IntDisable(INT_EMAC0)
+#define FS_ENET_INT_ENABLE()    MAP_IntEnable(INT_EMAC0)
+#endif
+
+//*****************************************************************************
+//
+// One entry in the file system index.  Every field is a byte offset from the
+// start of the image or a length in bytes.  Empty slots have a name offset of
+// zero.  Each file is stored as a complete HTTP response, headers included.
+// If the file has a gzip-compressed variant, ui32Gzip gives its offset and
+// ui32GzipLen its length; otherwise both are zero.
+//
+//*****************************************************************************
+typedef struct
+{
+    uint32_t ui32Name;
+    uint32_t ui32Data;
+    uint32_t ui32Len;
+    uint32_t ui32Gzip;
+    uint32_t ui32GzipLen;
+}
+tFSIndexEntry;
+
+//*****************************************************************************
+//
+// The directory at the start of the file system image.  The hash of a file
+// name picks one of ui32NumBuckets buckets, and the displacement stored for
+// that bucket picks the slot of the index.  The index follows the
+// displacements and has ui32IndexSize slots; both counts are powers of two.
+// The names and file data follow the index.  Every file starts on a word
+// boundary.
+//
+//*****************************************************************************
+typedef struct
+{
+    uint32_t ui32Magic;
+    uint32_t ui32NumFiles;
+    uint32_t ui32IndexSize;
+    uint32_t ui32NumBuckets;
+    uint32_t pui32Displace[1];
+}
+tFSImage;
+
+#define FS_IMAGE_MAGIC          0x32534645
+
+//*****************************************************************************
+//
+// The first entry of the index, which follows the bucket displacements.
+//
+//*****************************************************************************
+#define FS_IMAGE_INDEX                                                        \
+        ((const tFSIndexEntry *)&g_sFSImage.pui32Displace[                    \
+                                     g_sFSImage.ui32NumBuckets])
+
+//*****************************************************************************
+//
+// The file system image for this application.  This is a binary file,
+// enet_fsdata.bin, generated by the makefsdata.py utility using the following
+// command:
+//
+//     python3 tools/makefsdata.py -i fs -o enet_fsdata.bin -c ...
+//
+// The "fsdata" make target runs this command with the settings for this
+// application.  The image is linked in as it is by enet_fsdata_gcc.S or
+// enet_fsdata_rvmdk.S, which define g_sFSImage.  The IAR and CCS projects
+// instead build enet_fsdata.c, the same image written out as a C array by
+// the same target.  If any changes are made to the static content of the
+// web pages served by the application, both must be regenerated in order
+// for those changes to be picked up by the web server.
+//
+//*****************************************************************************
+extern const tFSImage g_sFSImage;
+
+//*****************************************************************************
+//
+// Get a pointer to the data at an offset in the image.
+//
+//*****************************************************************************
+#define FS_IMAGE_PTR(ui32Offset)                                              \
+        ((const uint8_t *)&g_sFSImage + (ui32Offset))
+
+//*****************************************************************************
+//
+// The following are data structures used by FatFs.
+//
+//*****************************************************************************
+static FATFS g_sFatFs;
+
+//*****************************************************************************
+//
+// A fixed pool of equally sized slots.  Freed slots are kept on a list linked
+// through the slots themselves, and slots that have never been handed out are
+// taken from the end of the array, so the pool needs no initialization and
+// both allocating and freeing a slot take constant time.
+//
+//*****************************************************************************
+typedef struct
+{
+    uint8_t *pui8Slots;
+    uint32_t ui32SlotSize;
+    uint32_t ui32NumSlots;
+    uint32_t ui32Unused;
+    void *pvFree;
+    tFSPoolStats sStats;
+}
+tFSPool;
+
+//*****************************************************************************
+//
+// The states of an SD card file.  The card is only ever accessed from
+// fs_process() in the main loop, never from the Ethernet interrupt that httpd
+// runs in, so fs_open() only records the file name and leaves the file in
+// the opening state for fs_process() to open it.  A generated file stays in
+// the generating state, which fs_process() leaves alone, until its generator
+// has no more records.
+//
+//*****************************************************************************
+#define FS_SD_FREE              0
+#define FS_SD_OPENING           1
+#define FS_SD_READING           2
+#define FS_SD_EOF               3
+#define FS_SD_GENERATING        4
+
+//*****************************************************************************
+//
+// The value of an omitted range bound.  In a suffix range ("-500") the first
+// byte is omitted and the last bound holds the suffix length.
+//
+//*****************************************************************************
+#define FS_RANGE_OPEN           0xffffffff
+
+//*****************************************************************************
+//
+// The state of an open SD card file.  fs_process() fills the two buffers in
+// turn from the card and fs_read() empties them in the same order, so httpd
+// can be sending one buffer while the next is being read.  A buffer with a
+// length of zero belongs to fs_process(), and any other buffer to fs_read().
+//
+// bBusy is set while fs_process() is reading the card for this file with the
+// Ethernet interrupt enabled.  If fs_close() is called in that time it sets
+// bClosing instead of freeing the file, and fs_process() frees it when the
+// read completes.
+//
+// A byte range request for a file in the image is also handled with one of
+// these, since it needs a generated header.  The header goes in the first
+// buffer and pui8Data points at the requested bytes in the image, which
+// fs_read() copies out once the header has been read.
+//
+// A generated file is handled with one of these too.  fs_read() fills each
+// buffer, when it finds it empty, with as many records from pfnGenerate as
+// fit, and ui32Record is the next record to generate.
+//
+//*****************************************************************************
+typedef struct
+{
+    FIL sFatFile;
+    char pcName[ENET_FS_SD_NAME_LEN];
+    uint8_t pui8Buf[2][ENET_FS_SD_BUF_SIZE];
+    volatile uint32_t pui32Len[2];
+    uint32_t ui32Fill;
+    uint32_t ui32Drain;
+    uint32_t ui32Pos;
+    uint32_t ui32Left;
+    uint32_t ui32ToRead;
+    bool bRange;
+    uint32_t ui32RangeFirst;
+    uint32_t ui32RangeLast;
+    const uint8_t *pui8Data;
+    tFSGenerator pfnGenerate;
+    uint32_t ui32Record;
+    volatile uint32_t ui32State;
+    volatile bool bBusy;
+    volatile bool bClosing;
+    struct fs_file *psFile;
+    void (*pfnCallback)(void *pvArg);
+    void *pvCallbackArg;
+}
+tFSSDFile;
+
+//*****************************************************************************
+//
+// The slots for open files and for open SD card files.  The unions make each
+// slot large enough to hold the free list link.  The link overlays the start
+// of the slot, which leaves the state of a free SD card file intact.
+//
+//*****************************************************************************
+typedef union
+{
+    struct fs_file sFile;
+    void *pvNext;
+}
+tFSFileSlot;
+
+typedef union
+{
+    tFSSDFile sSDFile;
+    void *pvNext;
+}
+tFSSDFileSlot;
+
+static tFSFileSlot g_psFileSlots[ENET_FS_MAX_FILES];
+static tFSSDFileSlot g_psSDFileSlots[ENET_FS_MAX_SD_FILES];
+
+static tFSPool g_sFilePool =
+{
+    (uint8_t *)g_psFileSlots, sizeof(tFSFileSlot), ENET_FS_MAX_FILES
+};
+
+static tFSPool g_sSDFilePool =
+{
+    (uint8_t *)g_psSDFileSlots, sizeof(tFSSDFileSlot), ENET_FS_MAX_SD_FILES
+};
+
+//*****************************************************************************
+//
+// The content type sent for each SD card file extension.  This follows the
+// table used by tools/makefsdata.py for the files in the image.
+//
+//*****************************************************************************
+typedef struct
+{
+    const char *pcExtension;
+    const char *pcType;
+}
+tFSContentType;
+
+static const tFSContentType g_psFSContentTypes[] =
+{
+    { "htm", "text/html" },
+    { "html", "text/html" },
+    { "css", "text/css" },
+    { "js", "application/x-javascript" },
+    { "txt", "text/plain" },
+    { "xml", "text/xml" },
+    { "json", "application/json" },
+    { "ico", "image/x-icon" },
+    { "gif", "image/gif" },
+    { "png", "image/png" },
+    { "jpg", "image/jpeg" },
+    { "bmp", "image/bmp" }
+};
+
+#define FS_NUM_CONTENT_TYPES    (sizeof(g_psFSContentTypes) /                 \
+                                 sizeof(g_psFSContentTypes[0]))
+
+//*****************************************************************************
+//
+// The files whose contents are generated when they are read, rather than
+// stored in the image or on the card.
+//
+//*****************************************************************************
+typedef struct
+{
+    const char *pcName;
+    tFSGenerator pfnGenerate;
+}
+tFSGeneratedFile;
+
+static tFSGeneratedFile g_psFSGenerated[ENET_FS_MAX_GENERATED];
+
+//*****************************************************************************
+//
+// The number of milliseconds that has passed since the last disk_timerproc()
+// call.
+//
+//*****************************************************************************
+static uint32_t ui32TickCounter = 0;
+
+//*****************************************************************************
+//
+// Compute the hash of a file name used to index the image.  This is a 32-bit
+// FNV-1a hash with the upper half folded into the lower half, and must match
+// fs_hash() in tools/makefsdata.py.
+//
+//*****************************************************************************
+static uint32_t
+FSIndexHash(const char *pcName)
+{
+    uint32_t ui32Hash;
+
+    ui32Hash = 0x811c9dc5;
+    while(*pcName)
+    {
+        ui32Hash ^= (uint8_t)*pcName++;
+        ui32Hash *= 16777619;
+    }
+
+    return(ui32Hash ^ (ui32Hash >> 16));
+}
+
+//*****************************************************************************
+//
+// Find the index slot of a file name hash.  The displacement of the bucket
+// the hash falls in is mixed into the hash with the 32-bit finalizer of
+// MurmurHash3.  This must match fs_slot() in tools/makefsdata.py.
+//
+//*****************************************************************************
+static uint32_t
+FSIndexSlot(uint32_t ui32Hash)
+{
+    ui32Hash ^= g_sFSImage.pui32Displace[ui32Hash &
+                                         (g_sFSImage.ui32NumBuckets - 1)];
+    ui32Hash ^= ui32Hash >> 16;
+    ui32Hash *= 0x85ebca6b;
+    ui32Hash ^= ui32Hash >> 13;
+    ui32Hash *= 0xc2b2ae35;
+    ui32Hash ^= ui32Hash >> 16;
+
+    return(ui32Hash & (g_sFSImage.ui32IndexSize - 1));
+}
+
+//*****************************************************************************
+//
+// Take a slot from a pool.  Returns NULL if every slot is in use.
+//
+//*****************************************************************************
+static void *
+FSPoolAlloc(tFSPool *psPool)
+{
+    void *pvSlot;
+
+    if(psPool->pvFree != NULL)
+    {
+        pvSlot = psPool->pvFree;
+        psPool->pvFree = *(void **)pvSlot;
+    }
+    else if(psPool->ui32Unused < psPool->ui32NumSlots)
+    {
+        pvSlot = psPool->pui8Slots +
+                 (psPool->ui32Unused++ * psPool->ui32SlotSize);
+    }
+    else
+    {
+        psPool->sStats.ui32Failures++;
+        return(NULL);
+    }
+
+    psPool->sStats.ui32Opens++;
+    psPool->sStats.ui32InUse++;
+    if(psPool->sStats.ui32InUse > psPool->sStats.ui32HighWater)
+    {
+        psPool->sStats.ui32HighWater = psPool->sStats.ui32InUse;
+    }
+
+    return(pvSlot);
+}
+
+//*****************************************************************************
+//
+// Return a slot to the pool it was taken from.
+//
+//*****************************************************************************
+static void
+FSPoolFree(tFSPool *psPool, void *pvSlot)
+{
+    *(void **)pvSlot = psPool->pvFree;
+    psPool->pvFree = pvSlot;
+    psPool->sStats.ui32InUse--;
+}
+
+//*****************************************************************************
+//
+// Return a copy of the counters for the open file pool and the SD card file
+// pool.  Either pointer may be NULL if those counters are not wanted.
+//
+//*****************************************************************************
+void
+FSPoolStatsGet(tFSPoolStats *psFileStats, tFSPoolStats *psSDFileStats)
+{
+    if(psFileStats)
+    {
+        *psFileStats = g_sFilePool.sStats;
+    }
+    if(psSDFileStats)
+    {
+        *psSDFileStats = g_sSDFilePool.sStats;
+    }
+}
+
+//*****************************************************************************
+//
+// Add a file whose contents are generated each time it is read, such as a
+// page of live counters.  The generator is called with successive record
+// numbers, starting from zero, to write each record of the file into a
+// buffer, and returns the length of the record, or zero once there are no
+// more.  A record that does not fit in the space left is generated again
+// into the next empty buffer, so no record may be longer than
+// ENET_FS_SD_BUF_SIZE - 1 bytes.  The content type follows from the
+// extension of the name.  Returns false if there is no room for the file.
+//
+//*****************************************************************************
+bool
+FSGeneratedFileAdd(const char *pcName, tFSGenerator pfnGenerate)
+{
+    uint32_t ui32Idx;
+
+    for(ui32Idx = 0; ui32Idx < ENET_FS_MAX_GENERATED; ui32Idx++)
+    {
+        if(g_psFSGenerated[ui32Idx].pcName == NULL)
+        {
+            g_psFSGenerated[ui32Idx].pfnGenerate = pfnGenerate;
+            g_psFSGenerated[ui32Idx].pcName = pcName;
+            return(true);
+        }
+    }
+
+    return(false);
+}
+
+//*****************************************************************************
+//
+// Look up a generated file by name, returning its generator or NULL if there
+// is no such file.
+//
+//*****************************************************************************
+static tFSGenerator
+FSGeneratedFind(const char *pcName)
+{
+    uint32_t ui32Idx;
+
+    for(ui32Idx = 0; ui32Idx < ENET_FS_MAX_GENERATED; ui32Idx++)
+    {
+        if((g_psFSGenerated[ui32Idx].pcName != NULL) &&
+           (ustrcmp(pcName, g_psFSGenerated[ui32Idx].pcName) == 0))
+        {
+            return(g_psFSGenerated[ui32Idx].pfnGenerate);
+        }
+    }
+
+    return(NULL);
+}
+
+//*****************************************************************************
+//
+// Fill the next buffer of a generated file with as many records as fit.  If
+// the generator has no more records, the file is marked as read.
+//
+//*****************************************************************************
+static void
+FSGeneratedFill(tFSSDFile *psSDFile)
+{
+    char *pcBuf;
+    uint32_t ui32Len, ui32Record;
+
+    pcBuf = (char *)psSDFile->pui8Buf[psSDFile->ui32Drain];
+    ui32Len = 0;
+    while(1)
+    {
+        ui32Record = psSDFile->pfnGenerate(pcBuf + ui32Len,
+                                           ENET_FS_SD_BUF_SIZE - ui32Len,
+                                           psSDFile->ui32Record);
+        if(ui32Record == 0)
+        {
+            psSDFile->ui32State = FS_SD_EOF;
+            break;
+        }
+
+        //
+        // Stop if the record did not fit.  Unless the buffer was empty, it
+        // is generated again into the next buffer.  A record that does not
+        // fit in an empty buffer is cut short and skipped.
+        //
+        if(ui32Record >= (ENET_FS_SD_BUF_SIZE - ui32Len))
+        {
+            if(ui32Len == 0)
+            {
+                ui32Len = ENET_FS_SD_BUF_SIZE - 1;
+                psSDFile->ui32Record++;
+            }
+            break;
+        }
+
+        ui32Len += ui32Record;
+        psSDFile->ui32Record++;
+    }
+
+    psSDFile->pui32Len[psSDFile->ui32Drain] = ui32Len;
+    psSDFile->ui32Left += ui32Len;
+}
+
+//*****************************************************************************
+//
+// Initialize the file system.
+//
+//*****************************************************************************
+void
+fs_init(void)
+{
+    //
+    // Initialize and mount the Fat File System.
+    //
+    f_mount(0, &g_sFatFs);
+}
+
+//*****************************************************************************
+//
+// File System tick handler.
+//
+//*****************************************************************************
+void
+fs_tick(uint32_t ui32TickMS)
+{
+    //
+    // Increment the tick counter.
+    //
+    ui32TickCounter += ui32TickMS;
+
+    //
+    // Check to see if the FAT FS tick needs to run.
+    //
+    if(ui32TickCounter >= 10)
+    {
+        ui32TickCounter = 0;
+        disk_timerproc();
+    }
+}
+
+//*****************************************************************************
+//
+// Look up a file name in the index, returning its entry or NULL if there is
+// no such file.  The index is collision free, so the only candidate is the
+// entry in the slot the name maps to, and a single compare confirms whether
+// it really is that file.
+//
+//*****************************************************************************
+static const tFSIndexEntry *
+FSIndexFind(const char *pcName)
+{
+    const tFSIndexEntry *psEntry;
+
+    psEntry = &FS_IMAGE_INDEX[FSIndexSlot(FSIndexHash(pcName))];
+    if((psEntry->ui32Name == 0) ||
+       (ustrcmp(pcName, (const char *)FS_IMAGE_PTR(psEntry->ui32Name)) != 0))
+    {
+        return(NULL);
+    }
+
+    return(psEntry);
+}
+
+//*****************************************************************************
+//
+// Find the offset of the body of a file in the image, following its stored
+// HTTP response header.
+//
+//*****************************************************************************
+static uint32_t
+FSBodyOffset(const tFSIndexEntry *psEntry)
+{
+    uint32_t ui32Idx;
+
+    for(ui32Idx = 0; (ui32Idx + 4) <= psEntry->ui32Len; ui32Idx++)
+    {
+        if(memcmp(FS_IMAGE_PTR(psEntry->ui32Data + ui32Idx), "\r\n\r\n",
+                  4) == 0)
+        {
+            return(ui32Idx + 4);
+        }
+    }
+
+    return(0);
+}
+
+//*****************************************************************************
+//
+// Find the content type to send for an SD card file or a byte range.
+//
+//*****************************************************************************
+static const char *
+FSContentType(const char *pcName)
+{
+    const char *pcExt;
+    uint32_t ui32Idx;
+
+    pcExt = strrchr(pcName, '.');
+    if(pcExt != NULL)
+    {
+        for(ui32Idx = 0; ui32Idx < FS_NUM_CONTENT_TYPES; ui32Idx++)
+        {
+            if(ustrcasecmp(pcExt + 1,
+                           g_psFSContentTypes[ui32Idx].pcExtension) == 0)
+            {
+                return(g_psFSContentTypes[ui32Idx].pcType);
+            }
+        }
+    }
+
+    return("text/plain");
+}
+
+//*****************************************************************************
+//
+// Parse the byte range of a ";bytes=FIRST-LAST" suffix on a requested file
+// name, given the text following "bytes=".  Either bound may be omitted, as
+// in an HTTP Range header, but not both.  Returns false if the range is not
+// well formed, in which case the whole file is sent.
+//
+// The httpd in this release of lwIP does not pass the request headers
+// through to the file system, so a Range header cannot be seen and the range
+// is given in the request path instead, for example "/sd/log.txt;bytes=0-99".
+//
+//*****************************************************************************
+static bool
+FSRangeParse(const char *pcRange, uint32_t *pui32First, uint32_t *pui32Last)
+{
+    const char *pcEnd;
+
+    *pui32First = FS_RANGE_OPEN;
+    if(*pcRange != '-')
+    {
+        *pui32First = ustrtoul(pcRange, &pcEnd, 10);
+        if(pcEnd == pcRange)
+        {
+            return(false);
+        }
+        pcRange = pcEnd;
+    }
+
+    if(*pcRange++ != '-')
+    {
+        return(false);
+    }
+
+    *pui32Last = FS_RANGE_OPEN;
+    if(*pcRange != '\0')
+    {
+        *pui32Last = ustrtoul(pcRange, &pcEnd, 10);
+        if((pcEnd == pcRange) || (*pcEnd != '\0'))
+        {
+            return(false);
+        }
+    }
+
+    if((*pui32First == FS_RANGE_OPEN) && (*pui32Last == FS_RANGE_OPEN))
+    {
+        return(false);
+    }
+    if((*pui32First != FS_RANGE_OPEN) && (*pui32Last != FS_RANGE_OPEN) &&
+       (*pui32Last < *pui32First))
+    {
+        return(false);
+    }
+
+    return(true);
+}
+
+//*****************************************************************************
+//
+// Work out which bytes of a file of the given size to send, from the range
+// requested if there is one.  Sets the offset of the first byte and returns
+// the number of bytes, which is zero if the range lies beyond the end of the
+// file.
+//
+//*****************************************************************************
+static uint32_t
+FSRangeResolve(tFSSDFile *psSDFile, uint32_t ui32Size, uint32_t *pui32First)
+{
+    uint32_t ui32Last;
+
+    *pui32First = 0;
+    if(!psSDFile->bRange)
+    {
+        return(ui32Size);
+    }
+
+    //
+    // A suffix range asks for the last bytes of the file.
+    //
+    if(psSDFile->ui32RangeFirst == FS_RANGE_OPEN)
+    {
+        if(psSDFile->ui32RangeLast < ui32Size)
+        {
+            *pui32First = ui32Size - psSDFile->ui32RangeLast;
+        }
+        return(ui32Size - *pui32First);
+    }
+
+    if(psSDFile->ui32RangeFirst >= ui32Size)
+    {
+        return(0);
+    }
+
+    *pui32First = psSDFile->ui32RangeFirst;
+    ui32Last = psSDFile->ui32RangeLast;
+    if((ui32Last == FS_RANGE_OPEN) || (ui32Last >= ui32Size))
+    {
+        ui32Last = ui32Size - 1;
+    }
+
+    return(ui32Last - *pui32First + 1);
+}
+
+//*****************************************************************************
+//
+// Put the HTTP response header for a file of the given size in the first
+// buffer, and set up the count of bytes to send after it.  This is a 200
+// response for the whole file, a 206 response for a byte range, or a 416
+// response with no content if the range lies beyond the end of the file.
+//
+//*****************************************************************************
+static void
+FSResponseHeader(tFSSDFile *psSDFile, uint32_t ui32Size, uint32_t ui32First,
+                 uint32_t ui32Count)
+{
+    char *pcBuf;
+    uint32_t ui32Len;
+
+    pcBuf = (char *)psSDFile->pui8Buf[0];
+
+    if(!psSDFile->bRange)
+    {
+        ui32Len = usnprintf(pcBuf, ENET_FS_SD_BUF_SIZE, "HTTP/1.0 200 OK\r\n");
+    }
+    else if(ui32Count == 0)
+    {
+        ui32Len = usnprintf(pcBuf, ENET_FS_SD_BUF_SIZE,
+                            "HTTP/1.0 416 Requested Range Not Satisfiable\r\n"
+                            "Content-Range: bytes */%d\r\n", ui32Size);
+    }
+    else
+    {
+        ui32Len = usnprintf(pcBuf, ENET_FS_SD_BUF_SIZE,
+                            "HTTP/1.0 206 Partial Content\r\n"
+                            "Content-Range: bytes %d-%d/%d\r\n", ui32First,
+                            ui32First + ui32Count - 1, ui32Size);
+    }
+
+    ui32Len += usnprintf(pcBuf + ui32Len, ENET_FS_SD_BUF_SIZE - ui32Len,
+                         "Server: lwIP/1.4.1 "
+                         "(http://savannah.nongnu.org/projects/lwip)\r\n"
+                         "Content-Length: %d\r\n"
+                         "Content-Type: %s\r\n\r\n",
+                         ui32Count, FSContentType(psSDFile->pcName));
+
+    psSDFile->pui32Len[0] = ui32Len;
+    psSDFile->ui32ToRead = ui32Count;
+    psSDFile->ui32Left = ui32Len + ui32Count;
+}
+
+//*****************************************************************************
+//
+// Put the HTTP response header for a generated file in the first buffer.
+// The contents change from one request to the next, so clients are told not
+// to cache them.
+//
+//*****************************************************************************
+static void
+FSGeneratedHeader(tFSSDFile *psSDFile)
+{
+    uint32_t ui32Len;
+
+    ui32Len = usnprintf((char *)psSDFile->pui8Buf[0], ENET_FS_SD_BUF_SIZE,
+                        "HTTP/1.0 200 OK\r\n"
+                        "Server: lwIP/1.4.1 "
+                        "(http://savannah.nongnu.org/projects/lwip)\r\n"
+                        "Cache-Control: no-cache\r\n"
+                        "Content-Type: %s\r\n\r\n",
+                        FSContentType(psSDFile->pcName));
+
+    psSDFile->pui32Len[0] = ui32Len;
+    psSDFile->ui32Left = ui32Len;
+}
+
+//*****************************************************************************
 //
-// If any changes are made to the static content of the web pages served by the
-// application, this command must be used to regenerate enet_fsdata.h in order
-// for those changes to be picked up by the web server.
+// Find a field in an HTTP header, which need not be terminated.  Returns a
+// pointer to the value, following any spaces, and puts its length in
+// *pui32ValueLen, or returns NULL if the field is not found before the blank
+// line that ends the header.
 //
 //*****************************************************************************
-#include "enet_fsdata.h"
+static const char *
+FSHeaderFind(const char *pcHeader, uint32_t ui32Len, const char *pcField,
+             uint32_t *pui32ValueLen)
+{
+    uint32_t ui32Pos, ui32End, ui32FieldLen;
+
+    ui32FieldLen = ustrlen(pcField);
+    for(ui32Pos = 0; ui32Pos < ui32Len; ui32Pos = ui32End + 2)
+    {
+        //
+        // Find the end of this line, or of the header if it is cut short.
+        //
+        for(ui32End = ui32Pos; (ui32End + 1) < ui32Len; ui32End++)
+        {
+            if((pcHeader[ui32End] == '\r') && (pcHeader[ui32End + 1] == '\n'))
+            {
+                break;
+            }
+        }
+        if((ui32End + 1) >= ui32Len)
+        {
+            ui32End = ui32Len;
+        }
+
+        if(ui32End == ui32Pos)
+        {
+            break;
+        }
+
+        if(((ui32End - ui32Pos) > ui32FieldLen) &&
+           (pcHeader[ui32Pos + ui32FieldLen] == ':') &&
+           (ustrncasecmp(pcHeader + ui32Pos, pcField, ui32FieldLen) == 0))
+        {
+            ui32Pos += ui32FieldLen + 1;
+            while((ui32Pos < ui32End) && (pcHeader[ui32Pos] == ' '))
+            {
+                ui32Pos++;
+            }
+            *pui32ValueLen = ui32End - ui32Pos;
+            return(pcHeader + ui32Pos);
+        }
+    }
+
+    return(NULL);
+}
 
 //*****************************************************************************
 //
-// The following are data structures used by FatFs.
+// See whether the client already holds the given copy of an image file,
+// which it does if its request has an If-None-Match header listing the ETag
+// stored with the file, or "*".  httpd does not pass the request headers
+// through to the file system, so they are taken from the TCP segment that
+// lwIP is handling, which is the one that completed the request.  A request
+// split over several segments is answered in full.
 //
 //*****************************************************************************
-static FATFS g_sFatFs;
+static bool
+FSNotModified(uint32_t ui32Data, uint32_t ui32Size)
+{
+    const char *pcHeader, *pcTag, *pcMatch;
+    const uint8_t *pui8Request;
+    uint32_t ui32TagLen, ui32MatchLen, ui32RequestLen, ui32Idx;
+
+    //
+    // Only a stored 200 response can be answered with a 304.  The 404 page,
+    // for one, cannot.
+    //
+    pcHeader = (const char *)FS_IMAGE_PTR(ui32Data);
+    if((ui32Size < 12) || (ustrncmp(pcHeader, "HTTP/1.0 200", 12) != 0) ||
+       !EnetRxTCPDataGet(&pui8Request, &ui32RequestLen))
+    {
+        return(false);
+    }
+
+    pcMatch = FSHeaderFind((const char *)pui8Request, ui32RequestLen,
+                           "If-None-Match", &ui32MatchLen);
+    if(pcMatch == NULL)
+    {
+        return(false);
+    }
+    if((ui32MatchLen == 1) && (pcMatch[0] == '*'))
+    {
+        return(true);
+    }
+
+    //
+    // The stored tag is quoted, so it cannot match part of another tag in
+    // the list.
+    //
+    pcTag = FSHeaderFind(pcHeader, ui32Size, "ETag", &ui32TagLen);
+    if((pcTag == NULL) || (ui32TagLen == 0))
+    {
+        return(false);
+    }
+    for(ui32Idx = 0; (ui32Idx + ui32TagLen) <= ui32MatchLen; ui32Idx++)
+    {
+        if(memcmp(pcMatch + ui32Idx, pcTag, ui32TagLen) == 0)
+        {
+            return(true);
+        }
+    }
+
+    return(false);
+}
 
 //*****************************************************************************
 //
-// The number of milliseconds that has passed since the last disk_timerproc()
-// call.
+// Put a 304 response header for the given copy of an image file in the
+// first buffer.  This carries the ETag and Cache-Control fields of the
+// stored header, so that the client keeps caching the file as before.
 //
 //*****************************************************************************
-static uint32_t ui32TickCounter = 0;
+static void
+FSNotModifiedHeader(tFSSDFile *psSDFile, uint32_t ui32Data, uint32_t ui32Size)
+{
+    static const char * const ppcFields[] = { "ETag", "Cache-Control" };
+    const char *pcValue;
+    char *pcBuf;
+    uint32_t ui32Len, ui32ValueLen, ui32Idx;
+
+    pcBuf = (char *)psSDFile->pui8Buf[0];
+
+    ui32Len = usnprintf(pcBuf, ENET_FS_SD_BUF_SIZE,
+                        "HTTP/1.0 304 Not Modified\r\n"
+                        "Server: lwIP/1.4.1 "
+                        "(http://savannah.nongnu.org/projects/lwip)\r\n");
+
+    for(ui32Idx = 0; ui32Idx < (sizeof(ppcFields) / sizeof(ppcFields[0]));
+        ui32Idx++)
+    {
+        pcValue = FSHeaderFind((const char *)FS_IMAGE_PTR(ui32Data), ui32Size,
+                               ppcFields[ui32Idx], &ui32ValueLen);
+        if((pcValue != NULL) &&
+           ((ui32Len + ustrlen(ppcFields[ui32Idx]) + ui32ValueLen + 6) <=
+            ENET_FS_SD_BUF_SIZE))
+        {
+            ui32Len += usnprintf(pcBuf + ui32Len,
+                                 ENET_FS_SD_BUF_SIZE - ui32Len, "%s: ",
+                                 ppcFields[ui32Idx]);
+            memcpy(pcBuf + ui32Len, pcValue, ui32ValueLen);
+            ui32Len += ui32ValueLen;
+            memcpy(pcBuf + ui32Len, "\r\n", 2);
+            ui32Len += 2;
+        }
+    }
+
+    memcpy(pcBuf + ui32Len, "\r\n", 2);
+    ui32Len += 2;
+
+    psSDFile->pui32Len[0] = ui32Len;
+    psSDFile->ui32Left = ui32Len;
+}
 
 //*****************************************************************************
 //
-// Initialize the file system.
+// Open an SD card file, and put its HTTP response header in the first
+// buffer.  If the file does not exist, the handle is turned into a handle
+// for the 404 page in the image.  This is called from fs_process() with the
+// Ethernet interrupt disabled, except around the card access itself.
 //
 //*****************************************************************************
-void
-fs_init(void)
+static void
+FSSDOpen(tFSSDFile *psSDFile)
 {
+    const tFSIndexEntry *psEntry;
+    struct fs_file *psFile;
+    uint32_t ui32First, ui32Count;
+    FRESULT fresult;
+
     //
-    // Initialize and mount the Fat File System.
+    // Open the file and, for a byte range, seek to the first byte wanted.
     //
-    f_mount(0, &g_sFatFs);
+    psSDFile->bBusy = true;
+    FS_ENET_INT_ENABLE();
+    fresult = f_open(&psSDFile->sFatFile, psSDFile->pcName, FA_READ);
+    if(fresult == FR_OK)
+    {
+        ui32Count = FSRangeResolve(psSDFile, f_size(&psSDFile->sFatFile),
+                                   &ui32First);
+        if((ui32Count != 0) && (ui32First != 0))
+        {
+            fresult = f_lseek(&psSDFile->sFatFile, ui32First);
+        }
+    }
+    FS_ENET_INT_DISABLE();
+    psSDFile->bBusy = false;
+
+    if(psSDFile->bClosing)
+    {
+        return;
+    }
+
+    if(fresult == FR_OK)
+    {
+        FSResponseHeader(psSDFile, f_size(&psSDFile->sFatFile), ui32First,
+                         ui32Count);
+        psSDFile->ui32Fill = 1;
+        psSDFile->ui32State = ((ui32Count == 0) ? FS_SD_EOF : FS_SD_READING);
+        return;
+    }
+
+    //
+    // There is no such file on the card, so send the 404 page from the
+    // image in its place.  The handle no longer refers to the card, so the
+    // SD card file is freed.
+    //
+    psFile = psSDFile->psFile;
+    psEntry = FSIndexFind("/404.htm");
+    psFile->data = psEntry ? (char *)FS_IMAGE_PTR(psEntry->ui32Data) : NULL;
+    psFile->len = psEntry ? psEntry->ui32Len : 0;
+    psFile->index = 0;
+    psFile->pextension = NULL;
+    psSDFile->ui32State = FS_SD_FREE;
+    FSPoolFree(&g_sSDFilePool, psSDFile);
 }
 
 //*****************************************************************************
 //
-// File System tick handler.
+// Fill the next free buffer of an SD card file from the card.  This is
+// called from fs_process() with the Ethernet interrupt disabled, except
+// around the card access itself, unless ENET_RX_DEFERRED is set.
 //
 //*****************************************************************************
-void
-fs_tick(uint32_t ui32TickMS)
+static void
+FSSDFill(tFSSDFile *psSDFile)
 {
-    //
-    // Increment the tick counter.
-    //
-    ui32TickCounter += ui32TickMS;
+    uint32_t ui32Fill, ui32Count;
+    UINT uiBytesRead;
+    FRESULT fresult;
+
+    ui32Fill = psSDFile->ui32Fill;
+    ui32Count = psSDFile->ui32ToRead;
+    if(ui32Count > ENET_FS_SD_BUF_SIZE)
+    {
+        ui32Count = ENET_FS_SD_BUF_SIZE;
+    }
+
+    psSDFile->bBusy = true;
+    FS_ENET_INT_ENABLE();
+    fresult = f_read(&psSDFile->sFatFile, psSDFile->pui8Buf[ui32Fill],
+                     ui32Count, &uiBytesRead);
+    FS_ENET_INT_DISABLE();
+    psSDFile->bBusy = false;
+
+    if(psSDFile->bClosing)
+    {
+        return;
+    }
 
     //
-    // Check to see if the FAT FS tick needs to run.
+    // Stop once everything to be sent has been read.  A short read means
+    // the end of the file has been reached early, and an error is treated
+    // the same way, which ends the response early.
     //
-    if(ui32TickCounter >= 10)
+    if(fresult != FR_OK)
     {
-        ui32TickCounter = 0;
-        disk_timerproc();
+        uiBytesRead = 0;
+    }
+    psSDFile->ui32ToRead -= uiBytesRead;
+    if((psSDFile->ui32ToRead == 0) || (uiBytesRead < ui32Count))
+    {
+        psSDFile->ui32State = FS_SD_EOF;
+    }
+    if(uiBytesRead != 0)
+    {
+        psSDFile->pui32Len[ui32Fill] = uiBytesRead;
+        psSDFile->ui32Fill = ui32Fill ^ 1;
+    }
+}
+
+//*****************************************************************************
+//
+// Read ahead from the SD card for every open SD card file.  This must be
+// called from the main loop; it is the only place the card is accessed, so
+// that a slow card delays the main loop rather than the Ethernet interrupt.
+// The Ethernet interrupt is left enabled while the card is being read, and
+// disabled while the state shared with httpd is updated and while httpd is
+// told that more data is ready.  When ENET_RX_DEFERRED is set, httpd runs
+// from the main loop too and the interrupt is not touched here.
+//
+// fs_open() and fs_read() post EVENT_FS whenever they leave work for this
+// function.  Each pass ends by having the SD card cache read ahead of a
+// sequential reader.  Returns true if a file still has an empty buffer after
+// this pass, in which case it should be called again.
+//
+//*****************************************************************************
+bool
+fs_process(void)
+{
+    tFSSDFile *psSDFile;
+    void (*pfnCallback)(void *pvArg);
+    uint32_t ui32Idx;
+    bool bMore;
+
+    bMore = false;
+
+    for(ui32Idx = 0; ui32Idx < ENET_FS_MAX_SD_FILES; ui32Idx++)
+    {
+        psSDFile = &g_psSDFileSlots[ui32Idx].sSDFile;
+
+        FS_ENET_INT_DISABLE();
+
+        if(psSDFile->ui32State == FS_SD_OPENING)
+        {
+            FSSDOpen(psSDFile);
+        }
+        else if((psSDFile->ui32State == FS_SD_READING) &&
+                (psSDFile->pui32Len[psSDFile->ui32Fill] == 0))
+        {
+            FSSDFill(psSDFile);
+        }
+        else
+        {
+            FS_ENET_INT_ENABLE();
+            continue;
+        }
+
+        //
+        // If httpd closed the file while the card was being read, it could
+        // not be freed at the time, so free it now.
+        //
+        if(psSDFile->bClosing)
+        {
+            psSDFile->ui32State = FS_SD_FREE;
+            FSPoolFree(&g_sSDFilePool, psSDFile);
+            FS_ENET_INT_ENABLE();
+            continue;
+        }
+
+        //
+        // If httpd is waiting for this file, let it continue.
+        //
+        pfnCallback = psSDFile->pfnCallback;
+        if(pfnCallback)
+        {
+            psSDFile->pfnCallback = NULL;
+            pfnCallback(psSDFile->pvCallbackArg);
+        }
+
+        if((psSDFile->ui32State == FS_SD_READING) &&
+           (psSDFile->pui32Len[psSDFile->ui32Fill] == 0))
+        {
+            bMore = true;
+        }
+
+        FS_ENET_INT_ENABLE();
     }
+
+    //
+    // With the data read so far on its way, read ahead of a file being read
+    // sequentially, so that the next pass finds its data in the cache.
+    //
+    SDCacheReadAhead();
+
+    return(bMore);
 }
 
 //*****************************************************************************
@@ -110,114 +1248,209 @@ fs_tick(uint32_t ui32TickMS)
 struct fs_file *
 fs_open(const char *pcName)
 {
-    const struct fsdata_file *psTree;
+    const tFSIndexEntry *psEntry;
     struct fs_file *psFile = NULL;
-    FIL *psFatFile = NULL;
-    FRESULT fresult = FR_OK;
+    tFSSDFile *psSDFile = NULL;
+    const char *pcRange;
+    char pcBaseName[ENET_FS_SD_NAME_LEN];
+    uint32_t ui32Len, ui32First, ui32Count, ui32Data, ui32Size;
+    tFSGenerator pfnGenerate;
+    bool bSD, bNotModified;
 
     //
-    // Allocate memory for the file system structure.
+    // Split off a byte range following the file name, if there is one.
     //
-    psFile = mem_malloc(sizeof(struct fs_file));
-    if(psFile == NULL)
+    pcRange = ustrstr(pcName, ";bytes=");
+    if(pcRange != NULL)
     {
-        return(NULL);
+        ui32Len = pcRange - pcName;
+        if(ui32Len >= ENET_FS_SD_NAME_LEN)
+        {
+            return(NULL);
+        }
+        memcpy(pcBaseName, pcName, ui32Len);
+        pcBaseName[ui32Len] = '\0';
+        pcName = pcBaseName;
+        pcRange += 7;
     }
 
     //
-    // See if a file on the SD card is being requested.
+    // See if a file on the SD card is being requested, and if not, look up
+    // the requested file name in the index.
     //
-    if(ustrncmp(pcName, "/sd/", 4) == 0)
+    bSD = (ustrncmp(pcName, "/sd/", 4) == 0);
+    psEntry = NULL;
+    pfnGenerate = NULL;
+    if(!bSD && (pcRange == NULL))
     {
-        //
-        // Allocate memory for the Fat File system handle.
-        //
-        psFatFile = mem_malloc(sizeof(FIL));
-        if(psFatFile == NULL)
+        pfnGenerate = FSGeneratedFind(pcName);
+    }
+    if(!bSD && (pfnGenerate == NULL))
+    {
+        psEntry = FSIndexFind(pcName);
+        if(psEntry == NULL)
         {
-            mem_free(psFile);
             return(NULL);
         }
+    }
+    else if(ustrlen(pcName + 3) >= ENET_FS_SD_NAME_LEN)
+    {
+        return(NULL);
+    }
 
-        //
-        // Attempt to open the file on the Fat File System.
-        //
-        fresult = f_open(psFatFile, pcName + 3, FA_READ);
-        if(fresult == FR_OK)
+    //
+    // Choose the copy of an image file to serve, the gzip variant if there
+    // is one and it is enabled, or the plain file, and see whether the
+    // client already holds it.
+    //
+    ui32Data = 0;
+    ui32Size = 0;
+    bNotModified = false;
+    if(psEntry != NULL)
+    {
+#if ENET_FS_GZIP
+        if(psEntry->ui32Gzip != 0)
         {
-            psFile->data = NULL;
-            psFile->len = 0;
-            psFile->index = 0;
-            psFile->pextension = psFatFile;
-            return(psFile);
+            ui32Data = psEntry->ui32Gzip;
+            ui32Size = psEntry->ui32GzipLen;
         }
-
-        //
-        // If we get here, we failed to find the file on the Fat File System,
-        // so free up the Fat File system handle/object.
-        //
-        mem_free(psFatFile);
-        mem_free(psFile);
-        return(NULL);
+        else
+#endif
+        {
+            ui32Data = psEntry->ui32Data;
+            ui32Size = psEntry->ui32Len;
+        }
+        bNotModified = ((pcRange == NULL) && FSNotModified(ui32Data,
+                                                           ui32Size));
     }
 
     //
-    // Initialize the file system tree pointer to the root of the linked list.
+    // Allocate the file system structure.
     //
-    psTree = FS_ROOT;
+    psFile = FSPoolAlloc(&g_sFilePool);
+    if(psFile == NULL)
+    {
+        return(NULL);
+    }
 
     //
-    // Begin processing the linked list, looking for the requested file name.
+    // SD card files, byte ranges, generated files and 304 responses need a
+    // buffered file, which carries a generated response header.  A 304
+    // response is only an economy, so if no buffered file is free the whole
+    // file is sent instead.
     //
-    while(NULL != psTree)
+    if(bSD || (pcRange != NULL) || (pfnGenerate != NULL) || bNotModified)
     {
-        //
-        // Compare the requested file "name" to the file name in the
-        // current node.
-        //
-        if(ustrncmp(pcName, (char *)psTree->name, psTree->len) == 0)
+        psSDFile = FSPoolAlloc(&g_sSDFilePool);
+        if((psSDFile == NULL) && !bNotModified)
+        {
+            FSPoolFree(&g_sFilePool, psFile);
+            return(NULL);
+        }
+    }
+
+    if(psSDFile != NULL)
+    {
+
+        ustrncpy(psSDFile->pcName, bSD ? (pcName + 3) : pcName,
+                 ENET_FS_SD_NAME_LEN);
+        psSDFile->pui32Len[0] = 0;
+        psSDFile->pui32Len[1] = 0;
+        psSDFile->ui32Fill = 0;
+        psSDFile->ui32Drain = 0;
+        psSDFile->ui32Pos = 0;
+        psSDFile->ui32Left = 0;
+        psSDFile->ui32ToRead = 0;
+        psSDFile->bRange = ((pcRange != NULL) &&
+                            FSRangeParse(pcRange, &psSDFile->ui32RangeFirst,
+                                         &psSDFile->ui32RangeLast));
+        psSDFile->pui8Data = NULL;
+        psSDFile->pfnGenerate = pfnGenerate;
+        psSDFile->ui32Record = 0;
+        psSDFile->bBusy = false;
+        psSDFile->bClosing = false;
+        psSDFile->psFile = psFile;
+        psSDFile->pfnCallback = NULL;
+
+        psFile->data = NULL;
+        psFile->len = 0;
+        psFile->index = 0;
+        psFile->pextension = psSDFile;
+        psFile->http_header_included = 1;
+
+        if(bSD)
         {
             //
-            // Fill in the data pointer and length values from the
-            // linked list node.
+            // Leave the file for fs_process() to open in the main loop.
+            // Until then there is no data to read.  The response header is
+            // generated along with the data, so that a file missing from the
+            // card can be answered with the 404 page.
             //
-            psFile->data = (char *)psTree->data;
-            psFile->len = psTree->len;
-
+            psSDFile->ui32State = FS_SD_OPENING;
+            EventPost(EVENT_FS);
+        }
+        else if(pfnGenerate != NULL)
+        {
             //
-            // For now, we setup the read index to the end of the file,
-            // indicating that all data has been read.
+            // The length of a generated file is not known until it has all
+            // been generated, so the header has none and the end of the file
+            // is marked by closing the connection.  The first buffer is
+            // taken by the header, so generation starts in the second.
             //
-            psFile->index = psTree->len;
-
+            FSGeneratedHeader(psSDFile);
+            psSDFile->ui32Drain = 0;
+            psSDFile->ui32State = FS_SD_GENERATING;
+        }
+        else if(bNotModified)
+        {
             //
-            // We are not using any file system extensions in this
-            // application, so set the pointer to NULL.
+            // The response is the header alone.
             //
-            psFile->pextension = NULL;
-
+            FSNotModifiedHeader(psSDFile, ui32Data, ui32Size);
+            psSDFile->ui32State = FS_SD_EOF;
+        }
+        else
+        {
             //
-            // Exit the loop and return the file system pointer.
+            // Send the requested bytes of the plain file straight from the
+            // image, after a new header in place of the stored one.
             //
-            break;
+            ui32Len = FSBodyOffset(psEntry);
+            ui32Count = FSRangeResolve(psSDFile, psEntry->ui32Len - ui32Len,
+                                       &ui32First);
+            FSResponseHeader(psSDFile, psEntry->ui32Len - ui32Len, ui32First,
+                             ui32Count);
+            psSDFile->pui8Data = FS_IMAGE_PTR(psEntry->ui32Data + ui32Len +
+                                              ui32First);
+            psSDFile->ui32State = FS_SD_EOF;
         }
 
-        //
-        // If we get here, we did not find the file at this node of the linked
-        // list.  Get the next element in the list.
-        //
-        psTree = psTree->next;
+        return(psFile);
     }
 
     //
-    // If we didn't find the file, ptTee will be NULL.  Make sure we
-    // return a NULL pointer if this happens.
+    // Fill in the data pointer and length values from the copy chosen
+    // above.  It carries its own HTTP header, so tell httpd not to generate
+    // one.
     //
-    if(psTree == NULL)
-    {
-        mem_free(psFile);
-        psFile = NULL;
-    }
+    psFile->data = (char *)FS_IMAGE_PTR(ui32Data);
+    psFile->len = ui32Size;
+    psFile->http_header_included = 1;
+
+    //
+    // Set the read index to the end of the file, indicating that all data
+    // has been read.  This makes httpd send the file directly from the data
+    // pointer in flash, without calling fs_read().  The default
+    // HTTP_IS_DATA_VOLATILE() of httpd does not copy data sent straight from
+    // the file, so it goes out in PBUF_ROM pbufs.
+    //
+    psFile->index = psFile->len;
+
+    //
+    // We are not using any file system extensions in this application, so
+    // set the pointer to NULL.
+    //
+    psFile->pextension = NULL;
 
     //
     // Return the file system pointer.
@@ -233,18 +1466,31 @@ fs_open(const char *pcName)
 void
 fs_close(struct fs_file *psFile)
 {
+    tFSSDFile *psSDFile;
+
     //
-    // If a Fat file was opened, free its object.
+    // If an SD card file was opened, free it, unless fs_process() is reading
+    // the card for it.  In that case it is marked so that fs_process() frees
+    // it once the read completes.
     //
-    if(psFile->pextension)
+    psSDFile = psFile->pextension;
+    if(psSDFile)
     {
-        mem_free(psFile->pextension);
+        if(psSDFile->bBusy)
+        {
+            psSDFile->bClosing = true;
+        }
+        else
+        {
+            psSDFile->ui32State = FS_SD_FREE;
+            FSPoolFree(&g_sSDFilePool, psSDFile);
+        }
     }
 
     //
     // Free the main file system object.
     //
-    mem_free(psFile);
+    FSPoolFree(&g_sFilePool, psFile);
 }
 
 //*****************************************************************************
@@ -257,24 +1503,76 @@ fs_close(struct fs_file *psFile)
 int
 fs_read(struct fs_file *psFile, char *pcBuffer, int iCount)
 {
+    tFSSDFile *psSDFile;
+    uint32_t ui32Drain;
     int iAvailable;
-    UINT uiBytesRead;
-    FRESULT fresult;
 
     //
-    // Check to see if a Fat File was opened and process it.
+    // Check to see if an SD card file was opened and process it.
     //
-    if(psFile->pextension)
+    psSDFile = psFile->pextension;
+    if(psSDFile)
     {
         //
-        // Read the data.
+        // If the next buffer has not been filled yet, there is nothing to
+        // read now, unless the whole file has been read.
+        //
+        ui32Drain = psSDFile->ui32Drain;
+        if(psSDFile->pui32Len[ui32Drain] == 0)
+        {
+            //
+            // The bytes of a range from the image follow the header.
+            //
+            if((psSDFile->pui8Data != NULL) && (psSDFile->ui32Left != 0))
+            {
+                iAvailable = psSDFile->ui32Left;
+                if(iAvailable > iCount)
+                {
+                    iAvailable = iCount;
+                }
+                memcpy(pcBuffer, psSDFile->pui8Data, iAvailable);
+                psSDFile->pui8Data += iAvailable;
+                psSDFile->ui32Left -= iAvailable;
+                return(iAvailable);
+            }
+
+            //
+            // The records of a generated file are generated as they are
+            // read.
+            //
+            if(psSDFile->ui32State == FS_SD_GENERATING)
+            {
+                FSGeneratedFill(psSDFile);
+                if(psSDFile->pui32Len[ui32Drain] != 0)
+                {
+                    return(fs_read(psFile, pcBuffer, iCount));
+                }
+            }
+
+            return((psSDFile->ui32State == FS_SD_EOF) ? -1 : 0);
+        }
+
+        //
+        // Copy out as much of the buffer as will fit, and hand the buffer
+        // back to fs_process() once it is empty.
         //
-        fresult = f_read(psFile->pextension, pcBuffer, iCount, &uiBytesRead);
-        if((fresult != FR_OK) || (uiBytesRead == 0))
+        iAvailable = psSDFile->pui32Len[ui32Drain] - psSDFile->ui32Pos;
+        if(iAvailable > iCount)
         {
-            return(-1);
+            iAvailable = iCount;
         }
-        return((int)uiBytesRead);
+        memcpy(pcBuffer, psSDFile->pui8Buf[ui32Drain] + psSDFile->ui32Pos,
+               iAvailable);
+        psSDFile->ui32Pos += iAvailable;
+        psSDFile->ui32Left -= iAvailable;
+        if(psSDFile->ui32Pos == psSDFile->pui32Len[ui32Drain])
+        {
+            psSDFile->ui32Pos = 0;
+            psSDFile->ui32Drain = ui32Drain ^ 1;
+            psSDFile->pui32Len[ui32Drain] = 0;
+            EventPost(EVENT_FS);
+        }
+        return(iAvailable);
     }
 
     //
@@ -301,7 +1599,7 @@ fs_read(struct fs_file *psFile, char *pcBuffer, int iCount)
     //
     // Copy the data.
     //
-    memcpy(pcBuffer, psFile->data + iAvailable, iAvailable);
+    memcpy(pcBuffer, psFile->data + psFile->index, iAvailable);
     psFile->index += iAvailable;
 
     //
@@ -318,16 +1616,29 @@ fs_read(struct fs_file *psFile, char *pcBuffer, int iCount)
 int
 fs_bytes_left(struct fs_file *psFile)
 {
+    tFSSDFile *psSDFile;
+
     //
-    // Check to see if a Fat File was opened and process it.
+    // Check to see if an SD card file was opened and process it.
     //
-    if(psFile->pextension)
+    psSDFile = psFile->pextension;
+    if(psSDFile)
     {
         //
-        // Return the number of bytes left to be read from the Fat File.
+        // The size is not known until the file has been opened, or a
+        // generated file has all been generated, but there is at least a
+        // response header or a record still to come.
+        //
+        if((psSDFile->ui32State == FS_SD_OPENING) ||
+           (psSDFile->ui32State == FS_SD_GENERATING))
+        {
+            return(1);
+        }
+
+        //
+        // Return the number of bytes left to be read from the SD card file.
         //
-        return(f_size((FIL *)psFile->pextension) -
-               f_tell((FIL *)psFile->pextension));
+        return(psSDFile->ui32Left);
     }
 
     //
@@ -335,3 +1646,54 @@ fs_bytes_left(struct fs_file *psFile)
     //
     return(psFile->len - psFile->index);
 }
+
+#if LWIP_HTTPD_FS_ASYNC_READ
+//*****************************************************************************
+//
+// Check whether data can be read from the file yet.  If not, the callback is
+// called from fs_process() once it can.
+//
+//*****************************************************************************
+int
+fs_is_file_ready(struct fs_file *psFile, fs_wait_cb pfnCallback,
+                 void *pvCallbackArg)
+{
+    tFSSDFile *psSDFile;
+
+    psSDFile = psFile->pextension;
+    if((psSDFile == NULL) || (psSDFile->ui32State == FS_SD_EOF) ||
+       (psSDFile->ui32State == FS_SD_GENERATING) ||
+       (psSDFile->pui32Len[psSDFile->ui32Drain] != 0))
+    {
+        return(1);
+    }
+
+    psSDFile->pfnCallback = pfnCallback;
+    psSDFile->pvCallbackArg = pvCallbackArg;
+    return(0);
+}
+
+//*****************************************************************************
+//
+// Read the next chunk of data from the file, as fs_read() does.  If no data
+// is available yet, FS_READ_DELAYED is returned and the callback is called
+// from fs_process() once there is.
+//
+//*****************************************************************************
+int
+fs_read_async(struct fs_file *psFile, char *pcBuffer, int iCount,
+              fs_wait_cb pfnCallback, void *pvCallbackArg)
+{
+    int iRead;
+
+    iRead = fs_read(psFile, pcBuffer, iCount);
+    if((iRead == 0) && (psFile->pextension != NULL))
+    {
+        ((tFSSDFile *)psFile->pextension)->pfnCallback = pfnCallback;
+        ((tFSSDFile *)psFile->pextension)->pvCallbackArg = pvCallbackArg;
+        return(FS_READ_DELAYED);
+    }
+
+    return(iRead);
+}
+#endif
@@ -36,6 +36,34 @@ extern "C"
 {
 #endif
 
+//*****************************************************************************
+//
+// Counters kept for each pool of file handles.  ui32InUse is the number of
+// handles currently open, ui32HighWater the most that have been open at once
+// and ui32Failures the number of opens refused because the pool was empty.
+// ui32Opens is the total number of handles opened.  httpd opens one file
+// per request and closes the connection after each response, so for the
+// file pool this is also the number of connections that were served.
+//
+//*****************************************************************************
+typedef struct
+{
+    uint32_t ui32Opens;
+    uint32_t ui32InUse;
+    uint32_t ui32HighWater;
+    uint32_t ui32Failures;
+}
+tFSPoolStats;
+
+//*****************************************************************************
+//
+// The prototype for the function that generates the contents of a generated
+// file, one record at a time.  See FSGeneratedFileAdd().
+//
+//*****************************************************************************
+typedef uint32_t (*tFSGenerator)(char *pcBuf, uint32_t ui32Size,
+                                 uint32_t ui32Record);
+
 //*****************************************************************************
 //
 // Prototypes.
@@ -43,6 +71,11 @@ extern "C"
 //*****************************************************************************
 extern void fs_init(void);
 extern void fs_tick(uint32_t ui32TickMS);
+extern bool fs_process(void);
+extern void FSPoolStatsGet(tFSPoolStats *psFileStats,
+                           tFSPoolStats *psSDFileStats);
+extern bool FSGeneratedFileAdd(const char *pcName,
+                               tFSGenerator pfnGenerate);
 
 //*****************************************************************************
 //
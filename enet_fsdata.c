@@ -0,0 +1,10737 @@
+//*****************************************************************************
+//
+// enet_fsdata.c - File system image for use with IAR and CCS.
+//
+// This file is generated by tools/makefsdata.py from the contents of the
+// fs directory, and must not be edited.  enet_fs.c reads it through
+// g_sFSImage.
+//
+//*****************************************************************************
+
+#include <stdint.h>
+
+const uint32_t g_sFSImage[64329] =
+{
+    0x32534645, 0x0000000c, 0x00000010, 0x00000008, 0x00000004, 0x00000000,
+    0x00000000, 0x00000001, 0x00000001, 0x00000003, 0x00000002, 0x00000001,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000001ba,
+    0x00039870, 0x000011fb, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x000001f6, 0x0003df40, 0x00000de3,
+    0x00000000, 0x00000000, 0x0000019a, 0x0002da04, 0x0000b6f8, 0x00000000,
+    0x00000000, 0x00000184, 0x000010ec, 0x0000083f, 0x00000000, 0x00000000,
+    0x000001ad, 0x000390fc, 0x00000772, 0x00000000, 0x00000000, 0x00000170,
+    0x00000200, 0x00000190, 0x00000000, 0x00000000, 0x000001e2, 0x0003bbe0,
+    0x000006ae, 0x00000000, 0x00000000, 0x000001ee, 0x0003c290, 0x00001cae,
+    0x00000000, 0x00000000, 0x000001d4, 0x0003af9c, 0x00000c41, 0x00000000,
+    0x00000000, 0x0000018f, 0x0000192c, 0x0002c0d7, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000001c5, 0x0003aa6c,
+    0x00000530, 0x00000000, 0x00000000, 0x00000179, 0x00000390, 0x00000d5b,
+    0x00000000, 0x00000000, 0x3430342f, 0x6d74682e, 0x62612f00, 0x2e74756f,
+    0x006d7468, 0x6f6c622f, 0x682e6b63, 0x2f006d74, 0x636f6c62, 0x706a2e6b,
+    0x652f0067, 0x6d742d6b, 0x32316334, 0x6c783439, 0x67706a2e, 0x61662f00,
+    0x6f636976, 0x63692e6e, 0x692f006f, 0x7865646e, 0x6d74682e, 0x616a2f00,
+    0x63736176, 0x74706972, 0x00736a2e, 0x65766f2f, 0x65697672, 0x74682e77,
+    0x732f006d, 0x656c7974, 0x73632e73, 0x742f0073, 0x706a2e69, 0x742f0067,
+    0x2e63346d, 0x0067706a, 0x50545448, 0x302e312f, 0x34303420, 0x6c694620,
+    0x6f6e2065, 0x6f662074, 0x0d646e75, 0x7265530a, 0x3a726576, 0x49776c20,
+    0x2e312f50, 0x20312e34, 0x74746828, 0x2f2f3a70, 0x61766173, 0x68616e6e,
+    0x6e6f6e2e, 0x2e756e67, 0x2f67726f, 0x6a6f7270, 0x73746365, 0x69776c2f,
+    0x0a0d2970, 0x746e6f43, 0x2d746e65, 0x676e654c, 0x203a6874, 0x0d393032,
+    0x6e6f430a, 0x746e6574, 0x7079542d, 0x74203a65, 0x2f747865, 0x6c6d7468,
+    0x54450a0d, 0x203a6761, 0x61643822, 0x62636536, 0x34633361, 0x30396530,
+    0x0a0d2231, 0x68636143, 0x6f432d65, 0x6f72746e, 0x6e203a6c, 0x74732d6f,
+    0x0d65726f, 0x3c0a0d0a, 0x202d2d21, 0x79706f43, 0x68676972, 0x63282074,
+    0x30322029, 0x322d3331, 0x20303230, 0x61786554, 0x6e492073, 0x75727473,
+    0x746e656d, 0x6e492073, 0x70726f63, 0x7461726f, 0x202e6465, 0x6c6c4120,
+    0x67697220, 0x20737468, 0x65736572, 0x64657672, 0x2d2d202e, 0x683c0a3e,
+    0x3e6c6d74, 0x6f623c0a, 0x0a3e7964, 0x6e65633c, 0x3e726574, 0x31683c0a,
+    0x3430343e, 0x66202d20, 0x20656c69, 0x20746f6e, 0x6e756f66, 0x682f3c64,
+    0x3c0a3e31, 0x543e3368, 0x3c207972, 0x72682061, 0x223d6665, 0x683e222f,
+    0x3c657265, 0x203e612f, 0x74736e69, 0x2e646165, 0x33682f3c, 0x2f3c0a3e,
+    0x746e6563, 0x0a3e7265, 0x6f622f3c, 0x0a3e7964, 0x74682f3c, 0x0a3e6c6d,
+    0x50545448, 0x302e312f, 0x30303220, 0x0d4b4f20, 0x7265530a, 0x3a726576,
+    0x49776c20, 0x2e312f50, 0x20312e34, 0x74746828, 0x2f2f3a70, 0x61766173,
+    0x68616e6e, 0x6e6f6e2e, 0x2e756e67, 0x2f67726f, 0x6a6f7270, 0x73746365,
+    0x69776c2f, 0x0a0d2970, 0x746e6f43, 0x2d746e65, 0x676e654c, 0x203a6874,
+    0x36333233, 0x6f430a0d, 0x6e65746e, 0x79542d74, 0x203a6570, 0x74786574,
+    0x6d74682f, 0x450a0d6c, 0x3a676154, 0x36312220, 0x36646630, 0x39633032,
+    0x65613061, 0x0d223665, 0x6361430a, 0x432d6568, 0x72746e6f, 0x203a6c6f,
+    0x2d78616d, 0x3d656761, 0x0d303036, 0x3c0a0d0a, 0x434f4421, 0x45505954,
+    0x4d544820, 0x3c0a3e4c, 0x202d2d21, 0x79706f43, 0x68676972, 0x63282074,
+    0x30322029, 0x322d3331, 0x20303230, 0x61786554, 0x6e492073, 0x75727473,
+    0x746e656d, 0x6e492073, 0x70726f63, 0x7461726f, 0x202e6465, 0x6c6c4120,
+    0x67697220, 0x20737468, 0x65736572, 0x64657672, 0x2d2d202e, 0x683c0a3e,
+    0x3e6c6d74, 0x65683c0a, 0x0a3e6461, 0x7469743c, 0x453e656c, 0x4d542d4b,
+    0x32314334, 0x4c583439, 0x61764520, 0x7461756c, 0x206e6f69, 0x3c74694b,
+    0x7469742f, 0x0a3e656c, 0x7974733c, 0x7420656c, 0x3d657079, 0x78657422,
+    0x73632f74, 0x0a3e2273, 0x43202a2f, 0x7279706f, 0x74686769, 0x29632820,
+    0x31303220, 0x30322d33, 0x54203032, 0x73617865, 0x736e4920, 0x6d757274,
+    0x73746e65, 0x636e4920, 0x6f70726f, 0x65746172, 0x20202e64, 0x206c6c41,
+    0x68676972, 0x72207374, 0x72657365, 0x2e646576, 0x0a2f2a20, 0x202a2f0a,
+    0x6c797453, 0x20676e69, 0x20726f66, 0x20656874, 0x69746e65, 0x64206572,
+    0x6d75636f, 0x2e746e65, 0x0a2f2a20, 0x79646f62, 0x200a7b0a, 0x62202020,
+    0x676b6361, 0x6e756f72, 0x6f632d64, 0x3a726f6c, 0x69687720, 0x0a3b6574,
+    0x20202020, 0x6f6c6f63, 0x62203a72, 0x6b63616c, 0x20200a3b, 0x6f662020,
+    0x662d746e, 0x6c696d61, 0x41203a79, 0x6c656972, 0x6c65482c, 0x69746576,
+    0x732c6163, 0x2d736e61, 0x69726573, 0x7d0a3b66, 0x2a2f0a0a, 0x79745320,
+    0x676e696c, 0x726f6620, 0x65687420, 0x61656820, 0x676e6964, 0x76696420,
+    0x2f2a202e, 0x6568230a, 0x6e696461, 0x0a7b0a67, 0x20202020, 0x61656c63,
+    0x62203a72, 0x3b68746f, 0x2020200a, 0x72616d20, 0x2d6e6967, 0x74746f62,
+    0x203a6d6f, 0x78703031, 0x0a7d0a3b, 0x6568230a, 0x6e696461, 0x31685f67,
+    0x200a7b0a, 0x66202020, 0x2d746e6f, 0x657a6973, 0x6532203a, 0x200a3b6d,
+    0x66202020, 0x2d746e6f, 0x67696577, 0x203a7468, 0x646c6f62, 0x20200a3b,
+    0x65742020, 0x612d7478, 0x6e67696c, 0x6563203a, 0x7265746e, 0x0a7d0a3b,
+    0x6568230a, 0x6e696461, 0x32685f67, 0x200a7b0a, 0x66202020, 0x2d746e6f,
+    0x657a6973, 0x2e31203a, 0x6d653532, 0x20200a3b, 0x6f662020, 0x772d746e,
+    0x68676965, 0x62203a74, 0x3b646c6f, 0x2020200a, 0x78657420, 0x6c612d74,
+    0x3a6e6769, 0x6e656320, 0x3b726574, 0x0a0a7d0a, 0x61656823, 0x676e6964,
+    0x0a726820, 0x20200a7b, 0x6f622020, 0x72656472, 0x746f622d, 0x3a6d6f74,
+    0x78703120, 0x6c6f7320, 0x23206469, 0x30306666, 0x0a3b3030, 0x20202020,
+    0x64726f62, 0x742d7265, 0x203a706f, 0x20787031, 0x696c6f73, 0x66232064,
+    0x30303066, 0x7d0a3b30, 0x68230a0a, 0x69646165, 0x6120676e, 0x676d6920,
+    0x200a7b0a, 0x62202020, 0x6564726f, 0x30203a72, 0x0a7d0a3b, 0x202a2f0a,
+    0x6c797453, 0x20676e69, 0x20726f66, 0x20656874, 0x756e656d, 0x76696420,
+    0x2f2a202e, 0x656d230a, 0x7b0a756e, 0x2020200a, 0x6f6c6620, 0x203a7461,
+    0x7466656c, 0x20200a3b, 0x616d2020, 0x6e696772, 0x746f622d, 0x3a6d6f74,
+    0x70303120, 0x200a3b78, 0x77202020, 0x68746469, 0x3232203a, 0x3b787035,
+    0x0a0a7d0a, 0x6e656d23, 0x6c752075, 0x200a7b0a, 0x6c202020, 0x2d747369,
+    0x6c797473, 0x79742d65, 0x203a6570, 0x656e6f6e, 0x20200a3b, 0x616d2020,
+    0x6e696772, 0x3b30203a, 0x2020200a, 0x64617020, 0x676e6964, 0x3b30203a,
+    0x0a0a7d0a, 0x6e656d23, 0x3a612075, 0x6b6e696c, 0x6d23202c, 0x20756e65,
+    0x69763a61, 0x65746973, 0x0a7b0a64, 0x20202020, 0x6b636162, 0x756f7267,
+    0x632d646e, 0x726f6c6f, 0x6623203a, 0x30303066, 0x200a3b30, 0x63202020,
+    0x726f6c6f, 0x6623203a, 0x66666666, 0x200a3b66, 0x64202020, 0x6c707369,
+    0x203a7961, 0x636f6c62, 0x200a3b6b, 0x66202020, 0x2d746e6f, 0x67696577,
+    0x203a7468, 0x646c6f62, 0x20200a3b, 0x616d2020, 0x6e696772, 0x746f622d,
+    0x3a6d6f74, 0x78703220, 0x20200a3b, 0x616d2020, 0x6e696772, 0x706f742d,
+    0x7032203a, 0x200a3b78, 0x70202020, 0x69646461, 0x203a676e, 0x3b787034,
+    0x2020200a, 0x78657420, 0x6c612d74, 0x3a6e6769, 0x6e656320, 0x3b726574,
+    0x2020200a, 0x78657420, 0x65642d74, 0x61726f63, 0x6e6f6974, 0x6f6e203a,
+    0x0a3b656e, 0x20202020, 0x74646977, 0x32203a68, 0x78703030, 0x0a7d0a3b,
+    0x656d230a, 0x6120756e, 0x766f683a, 0x202c7265, 0x6e656d23, 0x3a612075,
+    0x69746361, 0x7b0a6576, 0x2020200a, 0x63616220, 0x6f72676b, 0x2d646e75,
+    0x6f6c6f63, 0x23203a72, 0x30306662, 0x0a3b3030, 0x2f0a0a7d, 0x7453202a,
+    0x6e696c79, 0x6f662067, 0x68742072, 0x6f632065, 0x6e65746e, 0x69642074,
+    0x2a202e76, 0x63230a2f, 0x65746e6f, 0x7b0a746e, 0x2020200a, 0x72616d20,
+    0x2d6e6967, 0x74746f62, 0x203a6d6f, 0x78703031, 0x20200a3b, 0x616d2020,
+    0x6e696772, 0x66656c2d, 0x32203a74, 0x78703532, 0x0a7d0a3b, 0x6f63230a,
+    0x6e65746e, 0x65685f74, 0x6e696461, 0x0a7b0a67, 0x20202020, 0x746e6f66,
+    0x7a69732d, 0x31203a65, 0x6d65352e, 0x20200a3b, 0x6f662020, 0x772d746e,
+    0x68676965, 0x62203a74, 0x3b646c6f, 0x2020200a, 0x78657420, 0x6c612d74,
+    0x3a6e6769, 0x6e656320, 0x3b726574, 0x0a0a7d0a, 0x53202a2f, 0x696c7974,
+    0x6620676e, 0x7420726f, 0x66206568, 0x69746f6f, 0x6420676e, 0x202e7669,
+    0x230a2f2a, 0x746f6f66, 0x0a676e69, 0x20200a7b, 0x6c632020, 0x3a726165,
+    0x746f6220, 0x200a3b68, 0x66202020, 0x2d746e6f, 0x657a6973, 0x372e203a,
+    0x3b6d6535, 0x2020200a, 0x6e6f6620, 0x74732d74, 0x3a656c79, 0x61746920,
+    0x3b63696c, 0x2020200a, 0x78657420, 0x6c612d74, 0x3a6e6769, 0x67697220,
+    0x0a3b7468, 0x230a0a7d, 0x746f6f66, 0x20676e69, 0x7b0a7268, 0x2020200a,
+    0x726f6220, 0x2d726564, 0x74746f62, 0x203a6d6f, 0x20787031, 0x696c6f73,
+    0x66232064, 0x30303066, 0x200a3b30, 0x62202020, 0x6564726f, 0x6f742d72,
+    0x31203a70, 0x73207870, 0x64696c6f, 0x66662320, 0x30303030, 0x0a7d0a3b,
+    0x74732f3c, 0x3e656c79, 0x696c3c0a, 0x72206b6e, 0x223d6c65, 0x726f6873,
+    0x74756374, 0x6f636920, 0x7420226e, 0x3d657079, 0x616d6922, 0x782f6567,
+    0x6f63692d, 0x6820226e, 0x3d666572, 0x76616622, 0x6e6f6369, 0x6f63692e,
+    0x0a3e2f22, 0x65682f3c, 0x0a3e6461, 0x646f623c, 0x3c0a3e79, 0x64692070,
+    0x6f63223d, 0x6e65746e, 0x65685f74, 0x6e696461, 0x413e2267, 0x74756f62,
+    0x78655420, 0x49207361, 0x7274736e, 0x6e656d75, 0x2f3c7374, 0x3c0a3e70,
+    0x0a3e7268, 0x3e72623c, 0x7865540a, 0x49207361, 0x7274736e, 0x6e656d75,
+    0x28207374, 0x20294954, 0x61207369, 0x6f6c6720, 0x0a6c6162, 0x7420613c,
+    0x65677261, 0x5f223d74, 0x72682022, 0x223d6665, 0x70747468, 0x662f2f3a,
+    0x7375636f, 0x2e69742e, 0x2f6d6f63, 0x656e6567, 0x2f6c6172, 0x73636f64,
+    0x6e65672f, 0x746e6f63, 0x2e746e65, 0x3f707374, 0x746e6f63, 0x49746e65,
+    0x39323d64, 0x22363635, 0x616e613e, 0x3c676f6c, 0x0a3e612f, 0x20646e61,
+    0x69676964, 0x0a6c6174, 0x7420613c, 0x65677261, 0x5f223d74, 0x72682022,
+    0x223d6665, 0x70747468, 0x772f2f3a, 0x742e7777, 0x6f632e69, 0x65722f6d,
+    0x72616573, 0x642f6863, 0x2f73636f, 0x65646e69, 0x68732e78, 0x226c6d74,
+    0x6d65733e, 0x6e6f6369, 0x74637564, 0x4920726f, 0x65642043, 0x6e676973,
+    0x3e612f3c, 0x646e610a, 0x6e616d20, 0x63616675, 0x69727574, 0x6320676e,
+    0x61706d6f, 0x202e796e, 0x61206e49, 0x74696464, 0x206e6f69, 0x61206f74,
+    0x6f6c616e, 0x65742067, 0x6f6e6863, 0x69676f6c, 0x0a2c7365, 0x7420613c,
+    0x65677261, 0x5f223d74, 0x72682022, 0x223d6665, 0x70747468, 0x662f2f3a,
+    0x7375636f, 0x2e69742e, 0x2f6d6f63, 0x2f707364, 0x73636f64, 0x7073642f,
+    0x656d6f68, 0x7073742e, 0x6365733f, 0x6e6f6974, 0x343d6449, 0x643e2236,
+    0x74696769, 0x73206c61, 0x616e6769, 0x7270206c, 0x7365636f, 0x676e6973,
+    0x53442820, 0x2f3c2950, 0x610a3e61, 0x3c0a646e, 0x61742061, 0x74656772,
+    0x225f223d, 0x65726820, 0x68223d66, 0x3a707474, 0x6f662f2f, 0x2e737563,
+    0x632e6974, 0x6d2f6d6f, 0x642f7563, 0x2f73636f, 0x6875636d, 0x2e656d6f,
+    0x3f707374, 0x74636573, 0x496e6f69, 0x30313d64, 0x6d3e2231, 0x6f726369,
+    0x746e6f63, 0x6c6c6f72, 0x28207265, 0x2955434d, 0x3e612f3c, 0x6d65730a,
+    0x6e6f6369, 0x74637564, 0x2c73726f, 0x20495420, 0x69736564, 0x20736e67,
+    0x20646e61, 0x756e616d, 0x74636166, 0x73657275, 0x6d657320, 0x6e6f6369,
+    0x74637564, 0x7320726f, 0x74756c6f, 0x736e6f69, 0x726f6620, 0x616e6120,
+    0x0a676f6c, 0x20646e61, 0x69676964, 0x206c6174, 0x65626d65, 0x64656464,
+    0x646e6120, 0x70706120, 0x6163696c, 0x6e6f6974, 0x6f727020, 0x73736563,
+    0x2e676e69, 0x206e4920, 0x20656874, 0x7263696d, 0x6e6f636f, 0x6c6f7274,
+    0x2072656c, 0x63617073, 0x540a2c65, 0x666f2049, 0x73726566, 0x65687420,
+    0x6f726220, 0x73656461, 0x61722074, 0x2065676e, 0x6520666f, 0x6465626d,
+    0x20646564, 0x746e6f63, 0x206c6f72, 0x646f7270, 0x73746375, 0x7266202c,
+    0x75206d6f, 0x6172746c, 0x776f6c2d, 0x776f702d, 0x3c0a7265, 0x61742061,
+    0x74656772, 0x225f223d, 0x65726820, 0x68223d66, 0x3a707474, 0x6f662f2f,
+    0x2e737563, 0x632e6974, 0x6d2f6d6f, 0x642f7563, 0x2f73636f, 0x7075636d,
+    0x6f646f72, 0x76726576, 0x2e776569, 0x3f707374, 0x74636573, 0x496e6f69,
+    0x35393d64, 0x62617426, 0x313d6449, 0x66263034, 0x6c696d61, 0x3d644979,
+    0x22323433, 0x50534d3e, 0x26303334, 0x64617274, 0x2f3c3b65, 0x4d0a3e61,
+    0x20735543, 0x20646e61, 0x68676968, 0x7265702d, 0x6d726f66, 0x65636e61,
+    0x20613c0a, 0x67726174, 0x223d7465, 0x6820225f, 0x3d666572, 0x74746822,
+    0x2f2f3a70, 0x75636f66, 0x69742e73, 0x6d6f632e, 0x75636d2f, 0x636f642f,
+    0x636d2f73, 0x6f727075, 0x65766f64, 0x65697672, 0x73742e77, 0x65733f70,
+    0x6f697463, 0x3d64496e, 0x74263539, 0x64496261, 0x3335313d, 0x61662631,
+    0x796c696d, 0x393d6449, 0x3e223631, 0x33534d54, 0x32433032, 0x26303030,
+    0x64617274, 0x2f3c3b65, 0x720a3e61, 0x2d6c6165, 0x656d6974, 0x6e6f6320,
+    0x6c6f7274, 0x7372656c, 0x6f74202c, 0x65687420, 0x20323320, 0x20746962,
+    0x656e6567, 0x2d6c6172, 0x70727570, 0x2065736f, 0x264d5241, 0x3b676572,
+    0x7361622d, 0x4d206465, 0x20735543, 0x7420666f, 0x3c0a6568, 0x61742061,
+    0x74656772, 0x225f223d, 0x65726820, 0x68223d66, 0x3a707474, 0x77772f2f,
+    0x69742e77, 0x6d6f632e, 0x64736c2f, 0x69742f73, 0x63696d2f, 0x6f636f72,
+    0x6f72746e, 0x72656c6c, 0x7669742f, 0x72615f61, 0x6f635f6d, 0x78657472,
+    0x735f632f, 0x65697265, 0x6d742f73, 0x615f6334, 0x635f6d72, 0x6574726f,
+    0x346d2d78, 0x65766f2f, 0x65697672, 0x61702e77, 0x3e226567, 0x43344d54,
+    0x72655320, 0x3c736569, 0x0a3e612f, 0x646f7270, 0x20746375, 0x656e696c,
+    0x6552202e, 0x6d206461, 0x2065726f, 0x756f6261, 0x73752074, 0x206e6f20,
+    0x20656874, 0x20626577, 0x3c0a7461, 0x61742061, 0x74656772, 0x225f223d,
+    0x65726820, 0x68223d66, 0x3a707474, 0x77772f2f, 0x69742e77, 0x6d6f632e,
+    0x773e222f, 0x742e7777, 0x6f632e69, 0x612f3c6d, 0x3c0a2e3e, 0x646f622f,
+    0x3c0a3e79, 0x6d74682f, 0x000a3e6c, 0x50545448, 0x302e312f, 0x30303220,
+    0x0d4b4f20, 0x7265530a, 0x3a726576, 0x49776c20, 0x2e312f50, 0x20312e34,
+    0x74746828, 0x2f2f3a70, 0x61766173, 0x68616e6e, 0x6e6f6e2e, 0x2e756e67,
+    0x2f67726f, 0x6a6f7270, 0x73746365, 0x69776c2f, 0x0a0d2970, 0x746e6f43,
+    0x2d746e65, 0x676e654c, 0x203a6874, 0x38323931, 0x6f430a0d, 0x6e65746e,
+    0x79542d74, 0x203a6570, 0x74786574, 0x6d74682f, 0x450a0d6c, 0x3a676154,
+    0x34622220, 0x62613065, 0x30653233, 0x31643864, 0x0d226139, 0x6361430a,
+    0x432d6568, 0x72746e6f, 0x203a6c6f, 0x2d78616d, 0x3d656761, 0x0d303036,
+    0x3c0a0d0a, 0x434f4421, 0x45505954, 0x4d544820, 0x3c0a3e4c, 0x202d2d21,
+    0x79706f43, 0x68676972, 0x63282074, 0x30322029, 0x322d3331, 0x20303230,
+    0x61786554, 0x6e492073, 0x75727473, 0x746e656d, 0x6e492073, 0x70726f63,
+    0x7461726f, 0x202e6465, 0x6c6c4120, 0x67697220, 0x20737468, 0x65736572,
+    0x64657672, 0x2d2d202e, 0x683c0a3e, 0x3e6c6d74, 0x65683c0a, 0x0a3e6461,
+    0x7469743c, 0x453e656c, 0x4d542d4b, 0x32314334, 0x4c583439, 0x61764520,
+    0x7461756c, 0x206e6f69, 0x3c74694b, 0x7469742f, 0x0a3e656c, 0x7974733c,
+    0x7420656c, 0x3d657079, 0x78657422, 0x73632f74, 0x0a3e2273, 0x43202a2f,
+    0x7279706f, 0x74686769, 0x29632820, 0x31303220, 0x30322d33, 0x54203032,
+    0x73617865, 0x736e4920, 0x6d757274, 0x73746e65, 0x636e4920, 0x6f70726f,
+    0x65746172, 0x20202e64, 0x206c6c41, 0x68676972, 0x72207374, 0x72657365,
+    0x2e646576, 0x0a2f2a20, 0x202a2f0a, 0x6c797453, 0x20676e69, 0x20726f66,
+    0x20656874, 0x69746e65, 0x64206572, 0x6d75636f, 0x2e746e65, 0x0a2f2a20,
+    0x79646f62, 0x200a7b0a, 0x62202020, 0x676b6361, 0x6e756f72, 0x6f632d64,
+    0x3a726f6c, 0x69687720, 0x0a3b6574, 0x20202020, 0x6f6c6f63, 0x62203a72,
+    0x6b63616c, 0x20200a3b, 0x6f662020, 0x662d746e, 0x6c696d61, 0x41203a79,
+    0x6c656972, 0x6c65482c, 0x69746576, 0x732c6163, 0x2d736e61, 0x69726573,
+    0x7d0a3b66, 0x2a2f0a0a, 0x79745320, 0x676e696c, 0x726f6620, 0x65687420,
+    0x61656820, 0x676e6964, 0x76696420, 0x2f2a202e, 0x6568230a, 0x6e696461,
+    0x0a7b0a67, 0x20202020, 0x61656c63, 0x62203a72, 0x3b68746f, 0x2020200a,
+    0x72616d20, 0x2d6e6967, 0x74746f62, 0x203a6d6f, 0x78703031, 0x0a7d0a3b,
+    0x6568230a, 0x6e696461, 0x31685f67, 0x200a7b0a, 0x66202020, 0x2d746e6f,
+    0x657a6973, 0x6532203a, 0x200a3b6d, 0x66202020, 0x2d746e6f, 0x67696577,
+    0x203a7468, 0x646c6f62, 0x20200a3b, 0x65742020, 0x612d7478, 0x6e67696c,
+    0x6563203a, 0x7265746e, 0x0a7d0a3b, 0x6568230a, 0x6e696461, 0x32685f67,
+    0x200a7b0a, 0x66202020, 0x2d746e6f, 0x657a6973, 0x2e31203a, 0x6d653532,
+    0x20200a3b, 0x6f662020, 0x772d746e, 0x68676965, 0x62203a74, 0x3b646c6f,
+    0x2020200a, 0x78657420, 0x6c612d74, 0x3a6e6769, 0x6e656320, 0x3b726574,
+    0x0a0a7d0a, 0x61656823, 0x676e6964, 0x0a726820, 0x20200a7b, 0x6f622020,
+    0x72656472, 0x746f622d, 0x3a6d6f74, 0x78703120, 0x6c6f7320, 0x23206469,
+    0x30306666, 0x0a3b3030, 0x20202020, 0x64726f62, 0x742d7265, 0x203a706f,
+    0x20787031, 0x696c6f73, 0x66232064, 0x30303066, 0x7d0a3b30, 0x68230a0a,
+    0x69646165, 0x6120676e, 0x676d6920, 0x200a7b0a, 0x62202020, 0x6564726f,
+    0x30203a72, 0x0a7d0a3b, 0x202a2f0a, 0x6c797453, 0x20676e69, 0x20726f66,
+    0x20656874, 0x756e656d, 0x76696420, 0x2f2a202e, 0x656d230a, 0x7b0a756e,
+    0x2020200a, 0x6f6c6620, 0x203a7461, 0x7466656c, 0x20200a3b, 0x616d2020,
+    0x6e696772, 0x746f622d, 0x3a6d6f74, 0x70303120, 0x200a3b78, 0x77202020,
+    0x68746469, 0x3232203a, 0x3b787035, 0x0a0a7d0a, 0x6e656d23, 0x6c752075,
+    0x200a7b0a, 0x6c202020, 0x2d747369, 0x6c797473, 0x79742d65, 0x203a6570,
+    0x656e6f6e, 0x20200a3b, 0x616d2020, 0x6e696772, 0x3b30203a, 0x2020200a,
+    0x64617020, 0x676e6964, 0x3b30203a, 0x0a0a7d0a, 0x6e656d23, 0x3a612075,
+    0x6b6e696c, 0x6d23202c, 0x20756e65, 0x69763a61, 0x65746973, 0x0a7b0a64,
+    0x20202020, 0x6b636162, 0x756f7267, 0x632d646e, 0x726f6c6f, 0x6623203a,
+    0x30303066, 0x200a3b30, 0x63202020, 0x726f6c6f, 0x6623203a, 0x66666666,
+    0x200a3b66, 0x64202020, 0x6c707369, 0x203a7961, 0x636f6c62, 0x200a3b6b,
+    0x66202020, 0x2d746e6f, 0x67696577, 0x203a7468, 0x646c6f62, 0x20200a3b,
+    0x616d2020, 0x6e696772, 0x746f622d, 0x3a6d6f74, 0x78703220, 0x20200a3b,
+    0x616d2020, 0x6e696772, 0x706f742d, 0x7032203a, 0x200a3b78, 0x70202020,
+    0x69646461, 0x203a676e, 0x3b787034, 0x2020200a, 0x78657420, 0x6c612d74,
+    0x3a6e6769, 0x6e656320, 0x3b726574, 0x2020200a, 0x78657420, 0x65642d74,
+    0x61726f63, 0x6e6f6974, 0x6f6e203a, 0x0a3b656e, 0x20202020, 0x74646977,
+    0x32203a68, 0x78703030, 0x0a7d0a3b, 0x656d230a, 0x6120756e, 0x766f683a,
+    0x202c7265, 0x6e656d23, 0x3a612075, 0x69746361, 0x7b0a6576, 0x2020200a,
+    0x63616220, 0x6f72676b, 0x2d646e75, 0x6f6c6f63, 0x23203a72, 0x30306662,
+    0x0a3b3030, 0x2f0a0a7d, 0x7453202a, 0x6e696c79, 0x6f662067, 0x68742072,
+    0x6f632065, 0x6e65746e, 0x69642074, 0x2a202e76, 0x63230a2f, 0x65746e6f,
+    0x7b0a746e, 0x2020200a, 0x72616d20, 0x2d6e6967, 0x74746f62, 0x203a6d6f,
+    0x78703031, 0x20200a3b, 0x616d2020, 0x6e696772, 0x66656c2d, 0x32203a74,
+    0x78703532, 0x0a7d0a3b, 0x6f63230a, 0x6e65746e, 0x65685f74, 0x6e696461,
+    0x0a7b0a67, 0x20202020, 0x746e6f66, 0x7a69732d, 0x31203a65, 0x6d65352e,
+    0x20200a3b, 0x6f662020, 0x772d746e, 0x68676965, 0x62203a74, 0x3b646c6f,
+    0x2020200a, 0x78657420, 0x6c612d74, 0x3a6e6769, 0x6e656320, 0x3b726574,
+    0x0a0a7d0a, 0x53202a2f, 0x696c7974, 0x6620676e, 0x7420726f, 0x66206568,
+    0x69746f6f, 0x6420676e, 0x202e7669, 0x230a2f2a, 0x746f6f66, 0x0a676e69,
+    0x20200a7b, 0x6c632020, 0x3a726165, 0x746f6220, 0x200a3b68, 0x66202020,
+    0x2d746e6f, 0x657a6973, 0x372e203a, 0x3b6d6535, 0x2020200a, 0x6e6f6620,
+    0x74732d74, 0x3a656c79, 0x61746920, 0x3b63696c, 0x2020200a, 0x78657420,
+    0x6c612d74, 0x3a6e6769, 0x67697220, 0x0a3b7468, 0x230a0a7d, 0x746f6f66,
+    0x20676e69, 0x7b0a7268, 0x2020200a, 0x726f6220, 0x2d726564, 0x74746f62,
+    0x203a6d6f, 0x20787031, 0x696c6f73, 0x66232064, 0x30303066, 0x200a3b30,
+    0x62202020, 0x6564726f, 0x6f742d72, 0x31203a70, 0x73207870, 0x64696c6f,
+    0x66662320, 0x30303030, 0x0a7d0a3b, 0x74732f3c, 0x3e656c79, 0x696c3c0a,
+    0x72206b6e, 0x223d6c65, 0x726f6873, 0x74756374, 0x6f636920, 0x7420226e,
+    0x3d657079, 0x616d6922, 0x782f6567, 0x6f63692d, 0x6820226e, 0x3d666572,
+    0x76616622, 0x6e6f6369, 0x6f63692e, 0x0a3e2f22, 0x65682f3c, 0x0a3e6461,
+    0x646f623c, 0x3c0a3e79, 0x64692070, 0x6f63223d, 0x6e65746e, 0x65685f74,
+    0x6e696461, 0x543e2267, 0x3143344d, 0x4e343932, 0x54445043, 0x6f6c4220,
+    0x44206b63, 0x72676169, 0x2f3c6d61, 0x3c0a3e70, 0x0a3e7268, 0x3e72623c,
+    0x65633c0a, 0x7265746e, 0x693c0a3e, 0x7320676d, 0x223d6372, 0x636f6c62,
+    0x706a2e6b, 0x3e2f2267, 0x632f3c0a, 0x65746e65, 0x3c0a3e72, 0x646f622f,
+    0x3c0a3e79, 0x6d74682f, 0x000a3e6c, 0x50545448, 0x302e312f, 0x30303220,
+    0x0d4b4f20, 0x7265530a, 0x3a726576, 0x49776c20, 0x2e312f50, 0x20312e34,
+    0x74746828, 0x2f2f3a70, 0x61766173, 0x68616e6e, 0x6e6f6e2e, 0x2e756e67,
+    0x2f67726f, 0x6a6f7270, 0x73746365, 0x69776c2f, 0x0a0d2970, 0x746e6f43,
+    0x2d746e65, 0x676e654c, 0x203a6874, 0x32303831, 0x0a0d3135, 0x746e6f43,
+    0x2d746e65, 0x65707954, 0x6d69203a, 0x2f656761, 0x6765706a, 0x54450a0d,
+    0x203a6761, 0x38393322, 0x38363038, 0x33626164, 0x38643532, 0x0a0d2234,
+    0x68636143, 0x6f432d65, 0x6f72746e, 0x6d203a6c, 0x612d7861, 0x383d6567,
+    0x30303436, 0x0a0d0a0d, 0xe0ffd8ff, 0x464a1000, 0x01004649, 0xf0000101,
+    0x0000f000, 0x1300feff, 0x61657243, 0x20646574, 0x68746977, 0x4d494720,
+    0x00dbff50, 0x01010043, 0x01010101, 0x01010101, 0x01010101, 0x01010101,
+    0x01010101, 0x01010101, 0x01010101, 0x01010101, 0x01010101, 0x01010101,
+    0x01010101, 0x01010101, 0x01010101, 0x01010101, 0x01010101, 0xdbff0101,
+    0x01014300, 0x01010101, 0x01010101, 0x01010101, 0x01010101, 0x01010101,
+    0x01010101, 0x01010101, 0x01010101, 0x01010101, 0x01010101, 0x01010101,
+    0x01010101, 0x01010101, 0x01010101, 0x01010101, 0xff010101, 0x081100c2,
+    0x6802ec01, 0x00110103, 0x03011102, 0xc4ff0111, 0x01001e00, 0x03040100,
+    0x00000101, 0x00000000, 0x00000000, 0x07050406, 0x03020108, 0xc4ff0a09,
+    0x01011d00, 0x03040100, 0x00000001, 0x00000000, 0x00000000, 0x06040305,
+    0x08020107, 0x00daff09, 0x0001030c, 0x10031002, 0xfb010000, 0x985263f0,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0xb8000000, 0x98b11099, 0x00e0c8b8, 0xe0e40000, 0x00000000, 0x00000e72,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x96302363, 0x289917d3,
+    0xb1e5c3d4, 0x9f95e6be, 0x869f0f55, 0xb6a615ce, 0xcf72b397, 0xe3d94794,
+    0x8f814b40, 0x3364f2cc, 0x4f3e9f0d, 0x988186bd, 0x842fadb8, 0x2035a5d4,
+    0x1fda26cc, 0xe6a54f36, 0x000000e6, 0x0079c002, 0x00000000, 0x00500507,
+    0x00f4601e, 0x3305b103, 0xd3624431, 0xc1e40325, 0xacf800f4, 0x25afc96f,
+    0xc9c89c31, 0x9f8b5cf5, 0x06a9cf38, 0xb9e61e86, 0x129ac018, 0x187a3e32,
+    0x67cafa60, 0x3fc9e423, 0x4d82e132, 0xc39435f1, 0x0070d6a7, 0x7a0c0000,
+    0x3b75d969, 0x8c62c79e, 0x66729090, 0xb3e98b58, 0xa4c403e0, 0xe7c9a435,
+    0x83172b63, 0x6004afb1, 0x28531792, 0x6620e297, 0x86c58872, 0xf3cd0749,
+    0x20454d73, 0x84cdd425, 0x43c7c514, 0x367ccd75, 0x7d42f94c, 0xc878352a,
+    0xc8355766, 0x8c621793, 0x9591a7c1, 0xa927a5cf, 0x87caccf0, 0x0f4363d4,
+    0x000000a4, 0x83ec1800, 0x31afa098, 0x642f2bc9, 0xbc82bc40, 0x003a9bb7,
+    0x00f28a3c, 0xa9c78e4a, 0xe2113b7a, 0xe10b4914, 0x5c64246f, 0x8b1105cd,
+    0x550c920c, 0xec6b9d17, 0xe3f2d126, 0x000000b8, 0x2e070000, 0x1b8e9432,
+    0x93fa53b1, 0x1485cc83, 0x00000080, 0x0e3c0000, 0x00000080, 0x00000000,
+    0xe2170000, 0x34536352, 0x322a4614, 0x73a38c41, 0x810ecd6f, 0xa76af1fa,
+    0x4e8ecb7b, 0xda7bdc1c, 0x4346eb5f, 0x00c0a76d, 0x7d000000, 0x357fdce3,
+    0xf3317b37, 0x8bb90f76, 0xce175bc4, 0x402d159e, 0x00000000, 0x91e40000,
+    0xcd629be2, 0xa61b6d8c, 0x13aca567, 0x0000fcfa, 0x00000000, 0x49c5e901,
+    0x73bf0306, 0x42516674, 0xc588a266, 0xb3354826, 0x9d3fdc1e, 0x6ff5192d,
+    0x0b7d3273, 0xaec7bb37, 0x49062d75, 0xa675c5be, 0xb6e96b0b, 0x0040be31,
+    0x7d000000, 0x065eda91, 0xbcb061fa, 0xbeb9a579, 0xbd9dd68f, 0x0300e0e3,
+    0x5fbb623e, 0x7d7cafd3, 0xa9dc872f, 0x626e585e, 0xe1d5fafd, 0x26ee7ac4,
+    0x001e71cf, 0xbb632c03, 0xbf683217, 0xa2176b76, 0x2ed872fe, 0xc66c06e2,
+    0x5b356d76, 0x3cdc057b, 0x5516f666, 0x52453b63, 0x2d69fbde, 0xe3da5245,
+    0x1d63f646, 0xece96291, 0xb4a5860e, 0xe1243bc6, 0x36e6a6c5, 0x5ab4a58a,
+    0x5adb12f6, 0xb6066ccc, 0xd66baef4, 0x19969c7e, 0x4931a2ac, 0xc76c0d92,
+    0x4be70fb7, 0xdb5b7d46, 0xcc48938c, 0x047160ae, 0xe69f716e, 0x8805ae35,
+    0x07dffad8, 0x00408eb5, 0x7d000000, 0x065eda91, 0xbcb061fa, 0x8e59a179,
+    0xa3ddd398, 0x030080e5, 0xa3e7757f, 0x57d2762f, 0x7658577a, 0xd1c90c67,
+    0x6c774779, 0xeb863149, 0x23aa530e, 0x00207157, 0x77164433, 0xda679ab4,
+    0xbcbe297a, 0x8db91e07, 0xee88551b, 0x5757ca1a, 0x04f3957e, 0xaf1f6b2e,
+    0x31a58d1f, 0x097b557b, 0x1aacac3d, 0x9a1f00ff, 0x28dc4dd9, 0xa52d48de,
+    0x46dc292b, 0xf6e421ef, 0xa8db3173, 0xf5c96b9d, 0xc3982476, 0x3e60d246,
+    0x776dd981, 0x9a61d9e8, 0x991323ca, 0x7bdcd61c, 0x3475fe70, 0xeebed567,
+    0xb91d3d87, 0x5391c371, 0x7cae1ecd, 0xeae8a938, 0x6e8fe739, 0xae75527a,
+    0x907d0000, 0xfa065eda, 0x79bcb05d, 0xd65812a7, 0x3b4fec9a, 0x00d2fb5b,
+    0x27c7d101, 0xcd002707, 0x1a5e5911, 0x0040c595, 0xb6c6910d, 0xf7c2524e,
+    0x3ed80456, 0x18f3c27b, 0xcfc1e180, 0x9303000e, 0x06380080, 0x186742c5,
+    0xb1145756, 0xe3f5b356, 0x77c1c09d, 0xcf8161ae, 0x286d6665, 0x63644e8c,
+    0xc3ed715b, 0x9fd1d5f9, 0x24e3f656, 0x6afd34d2, 0x375bf153, 0x43dcebca,
+    0x75f89b1b, 0x9bb611a9, 0x42a7fcdc, 0x7dc0c2fc, 0x3547f479, 0x7a57edf2,
+    0xf891ca37, 0xd13e2f56, 0x00d14fcc, 0x0dd90700, 0xa56fe0a5, 0x9ac70bbb,
+    0x0109699a, 0x14230300, 0x083d51c6, 0x09475a39, 0x408b8a41, 0x4b7e0300,
+    0x4b8d8a81, 0xf2929f00, 0x2b38772e, 0xbf80620a, 0x18286316, 0x321190d4,
+    0x8b3e0008, 0x6656d293, 0x86c488d2, 0x1ec33544, 0x7d9d3fdc, 0x656ff519,
+    0x4a367527, 0xb8fcc4be, 0x27a11ea9, 0x28f12f93, 0x2c3d19fd, 0xbbedb7c5,
+    0x9159d6a5, 0x25f7f6c2, 0xcffaf8d1, 0x9817c825, 0x2f6ccfd7, 0x6e7db4d3,
+    0xb20f0000, 0x9fc04f5b, 0x8f0ff649, 0x52d244b5, 0x98040004, 0x484932ab,
+    0x2f510940, 0x8614442c, 0xd4370080, 0xa96131af, 0xa05213c0, 0xd4059e9b,
+    0x7ecc5aee, 0x2491cb4c, 0x22024a28, 0xf4010063, 0xa3929d48, 0x24461438,
+    0x18ae2132, 0xebfce1f6, 0x7eabcfe8, 0x7c1ef49c, 0xd5ebec77, 0xb7a7bbdb,
+    0x383c383d, 0x4fcfe9ab, 0x71787a6e, 0xe08ecf53, 0x2dfb0000, 0xf4053cb5,
+    0x0379608f, 0x44104c54, 0xf5c80400, 0x5412163a, 0x6f090945, 0x9108ce3d,
+    0x441b00c8, 0x592b1150, 0xda8557bd, 0xaf2d6502, 0xacd8f7a5, 0x3df1e07c,
+    0x2e0f49c9, 0x9cb9a8a5, 0x6a892715, 0x4d3cf600, 0xa8e425b5, 0x881105ce,
+    0x8e6b864c, 0x3b7fb83d, 0xdeea335a, 0x8c6acec8, 0x6b802bd3, 0xd9d026cc,
+    0xac4ded79, 0x2a6f3bd0, 0x4ab76148, 0xfb165996, 0x6b4cd417, 0x4be6ed77,
+    0xee1d32a4, 0xdbf0af2d, 0x91690b32, 0xb93db6ea, 0xb20f0040, 0x5fc0539b,
+    0x90077648, 0xf2d25435, 0x89320008, 0xf4324a91, 0x78028f43, 0x5c80cc45,
+    0x803b2a8d, 0x6185bd01, 0xa567d8aa, 0x7b5f5f75, 0xc4a5870a, 0x66f3329b,
+    0x195fecdf, 0x8ac823e4, 0x5f5cd290, 0x48d4020f, 0x5265204c, 0xd317b3b0,
+    0xa03523a9, 0x4a7672dd, 0x1851e44c, 0xb866c880, 0xf387dbe3, 0xad3ea3b7,
+    0x678df9e7, 0xe6b5259c, 0x2c6dc2ba, 0xe3887f9b, 0xc7ba1c3b, 0xc92d4346,
+    0xeddd3561, 0x6813def5, 0x6f8db967, 0x3abcd243, 0x75657ada, 0x3bd0ac03,
+    0xfb000070, 0x053cb529, 0x796083f4, 0x028c5503, 0xa4048043, 0x120a3ca6,
+    0xc18b464c, 0xa51e784e, 0xb5010094, 0xb4621125, 0x5d88d49f, 0xe54ae49f,
+    0x86ac0970, 0x79705621, 0x7af21296, 0xe441e514, 0xe2a24a59, 0xcc059e53,
+    0x0c36f4e4, 0x39939299, 0x321e4694, 0xf2ac8319, 0xae38883f, 0xdc1e00ff,
+    0xa5e2f1d3, 0xce5becdc, 0x53078887, 0x15f09822, 0x524c7925, 0x91fa409e,
+    0xa2f7a83d, 0xc9ea5c63, 0x0008a4a4, 0xcc90a264, 0x5d186247, 0xa4222441,
+    0xfe1a8ca0, 0x95fa0600, 0x000000e0, 0x00000000, 0x29313200, 0x6144a133,
+    0xe09a21e3, 0x0780757e, 0x8ed8d3d0, 0x60d76018, 0x1aca860e, 0x4e9f79dc,
+    0xd3628ccc, 0x0f028c54, 0x43d2a7b2, 0x203b4d56, 0x544402a0, 0x3a826393,
+    0xc4931656, 0x69a51498, 0xde008087, 0x0000a422, 0x00000000, 0x46060000,
+    0x28742625, 0x13643a8c, 0x400b1f05, 0xbde0f004, 0x00348694, 0x01f367e8,
+    0x23954d9d, 0x18912ce4, 0x8d551f78, 0xd56c35f3, 0x000014f2, 0xb3962d03,
+    0xe0206eb1, 0x14370000, 0x000000e8, 0x00000000, 0x92220300, 0x46143b83,
+    0x8011321b, 0xb0f9ce4f, 0x3bf1d405, 0xc3d83c98, 0x99e94954, 0x45e2998b,
+    0x5836794d, 0xd98b28af, 0x56793120, 0x873e027d, 0x2969ba9a, 0x01000002,
+    0x323cc6b5, 0x520c83f1, 0x7d030000, 0x0000f04a, 0x00000000, 0x14190000,
+    0xa2dc9993, 0x8c90d930, 0x8d727e00, 0x4879339d, 0x33668d40, 0x4d26ad59,
+    0xe6c22836, 0x61a09ad5, 0xbc8c6143, 0x3109cb5d, 0x3eac4835, 0x0d481f94,
+    0x84e0355c, 0x3d7c0180, 0xaad4794b, 0xa4a4a52e, 0x00708a3c, 0xc014da06,
+    0x00000000, 0x00000000, 0x33272932, 0x836144b9, 0x300d9d20, 0x39c00128,
+    0x002c8426, 0x3ce42500, 0x9c1c1ce4, 0xcd4b669b, 0xc7b0345e, 0xb36400a0,
+    0x90a2163a, 0x8a9c64c6, 0x9a8e7c19, 0x030076e2, 0x00f04a7d, 0x00000000,
+    0x19000000, 0xe4199310, 0x90b930a2, 0x00000080, 0x00000000, 0x916a7200,
+    0x004e4c88, 0x82179004, 0x484e492e, 0x903a26d9, 0x4d2a0050, 0x0d8929b2,
+    0xfc9527ec, 0x00000010, 0x02000000, 0x375ecea2, 0x32e4901f, 0x8892674e,
+    0x004266c2, 0x00000000, 0x01000000, 0xe3f5acc9, 0x313db3e8, 0x0088dee5,
+    0x00000000, 0x01f50200, 0xb3602ab0, 0x87f464ad, 0xd45d9bcd, 0x4b5abf60,
+    0x4c7223cc, 0xf7813b5f, 0xdaeabde3, 0x1375c54e, 0xbdad2bc7, 0xcd8448fe,
+    0x8df852a0, 0x4f22ee86, 0xbe173d63, 0xe4c79581, 0x7b0c4931, 0xa6823c97,
+    0x79d1c69d, 0x82e4e8d3, 0x674c62ce, 0x66c288b2, 0x00000042, 0x00000000,
+    0xa6c90100, 0x58ce13db, 0x5bf96917, 0x17674226, 0x7b0c794b, 0xe34b8633,
+    0xf46e2af2, 0x9e31b72c, 0x51d66afd, 0x39d0cabb, 0x35c826fe, 0x4e6b05e5,
+    0xc7e1f59c, 0xe3763b7e, 0xab2b7db5, 0x391e7b5d, 0x93196be2, 0x06ec89e2,
+    0xed941767, 0x82fe9f07, 0x4ff4ecfc, 0x3b4e5fce, 0x9c07b70c, 0x627ffce6,
+    0x66656d48, 0x5725b9f1, 0xa8cbd14a, 0xcd2b85ab, 0x755ed828, 0xe8752dde,
+    0x1df49de8, 0xaad64a67, 0xc8eb91b6, 0x9d05b98c, 0xa9a7f653, 0xc190b6d9,
+    0x03b916d9, 0xbe3f7478, 0x2cb9f125, 0x1165cf98, 0x00848c84, 0x00000000,
+    0x03000000, 0x073ba1b1, 0xb1d13acf, 0x319fe37c, 0xb19b8fdd, 0xa37885ed,
+    0x9bb22e7b, 0x1e47efa7, 0x2b93e3c8, 0xcb61cd19, 0x61d70eb5, 0x71cb9abb,
+    0x83be091d, 0x5ecb5a96, 0x3a6aa4ad, 0x318ee7d6, 0x962dae94, 0x450cf321,
+    0x78e48535, 0x7ee79fbc, 0xae04f3ce, 0x347867ce, 0x5efebc4f, 0x4610dfee,
+    0x8d8bd82b, 0x84f5993b, 0x5bd2e2f4, 0x56c3de1f, 0xad64adf4, 0x5accd965,
+    0x695b2aea, 0x6ac7e92d, 0xfa6bf41e, 0x5be9ab57, 0xae3eb5c3, 0x36717722,
+    0xe742d65a, 0x7dd3bf4e, 0x5559ed2f, 0xcf949cb4, 0x0c841185, 0x00000080,
+    0x00000000, 0x4c930300, 0xa1732d32, 0x34ce1ffb, 0x5190f4fc, 0x49db93bd,
+    0x01f89b63, 0xc8c1c9c1, 0x13f6c800, 0xe22bfdd5, 0x0e682c99, 0x870d4e0e,
+    0x7ff6ce82, 0x25727a59, 0xae5ac35e, 0x8fe9f223, 0x232b898b, 0x755039c5,
+    0x2801252d, 0x9374e425, 0xa6c03396, 0x7e59482b, 0x76b47ba3, 0x4a1252d2,
+    0xc288e267, 0x00004106, 0x00000000, 0xc9010000, 0x10b126ad, 0x813200b0,
+    0x71293315, 0xca282422, 0x1888d8e5, 0xb8010020, 0x1a164327, 0x13e16c9c,
+    0x22530623, 0x293049a6, 0xe262ca95, 0x99993175, 0x44d2120f, 0x61e0128a,
+    0xa16f46c2, 0x7ea62421, 0x641e8c28, 0x00000000, 0x00000000, 0xc69a1c00,
+    0x008b796a, 0xa6149100, 0xb8052d51, 0x679556e8, 0x03002826, 0x4e0e7e83,
+    0x0000300c, 0x00000000, 0x66262400, 0xcf902424, 0x0c8311e5, 0x00000082,
+    0x00000000, 0x57930300, 0x2de4a549, 0x00a8adbe, 0x00000000, 0x35851e00,
+    0x9d76dc94, 0x38352cce, 0x06070000, 0x131392c1, 0x0000d098, 0x42dfbc04,
+    0x800d4940, 0x64148c28, 0x00000000, 0x00000000, 0xdb9a1c00, 0x6cbdea94,
+    0xea165ede, 0x6d0500e0, 0x7674a92b, 0xc4960445, 0xed2fb4ee, 0x0000ec55,
+    0xc7490600, 0xd0464676, 0x9a8bf6de, 0x000000fc, 0x7a36a264, 0x00005011,
+    0x0b666312, 0x083623f9, 0x904130a2, 0x00000040, 0x00000000, 0x066a7200,
+    0x57b5a46b, 0x0034f96b, 0x39f1c800, 0xbb62c26e, 0xbe9ed75b, 0x1832624e,
+    0x6acaa2ec, 0x6b8e230b, 0x00aa57a6, 0x7ea40900, 0x0ffab443, 0xd45cd8df,
+    0x272700d0, 0x047ca943, 0x6cc4c904, 0xc04829a4, 0x7d031300, 0x3623f18b,
+    0x3930a20c, 0x0000003f, 0x00000000, 0xa7c90100, 0xf9b13619, 0xb6bcb4fd,
+    0x2d480000, 0x3644f3ef, 0x6bab6a69, 0x6571a771, 0xec9165ad, 0xebd4ee27,
+    0xa95bc6e9, 0xbb0c0040, 0xd66e9417, 0x1f56f69b, 0x09003835, 0x9045b059,
+    0x5cf396bf, 0x1254be0c, 0xa89817c3, 0xbe790900, 0x9b91f485, 0x18185108,
+    0x0000809f, 0x00000000, 0xd7e40000, 0x29a71ab7, 0xd23b438b, 0x61cb4c00,
+    0x42a72f1e, 0x210109ca, 0x1ff30a29, 0x6603609e, 0x96e566ac, 0x5f9391d2,
+    0xa9872400, 0x19884ae0, 0x483dadd8, 0x040932d0, 0x04c8413c, 0xf852da8c,
+    0x2885cd48, 0xc04f048c, 0x00000000, 0x00000000, 0xa5b16b72, 0x19003f66,
+    0x04c7cca4, 0x3586cc0c, 0x64642038, 0xc15844cd, 0x6d0098c5, 0x54cc9569,
+    0x5506806a, 0x4c8a7132, 0xcb2a77f0, 0x103a7041, 0x309b1bc3, 0x54438a44,
+    0xfb662540, 0x6c42c297, 0x22604441, 0x0000007e, 0x00000000, 0x59930300,
+    0xc089d188, 0x90530707, 0xc9017270, 0x0f003bc0, 0x019d3d53, 0x7520cf81,
+    0x00072707, 0x24aae0e4, 0x03e044c4, 0x264e06b0, 0x9b90e024, 0x08185110,
+    0x28f2119f, 0x00000070, 0x00000000, 0x00332607, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x3621d109, 0xf835a220, 0xf3101895, 0x00000000,
+    0x00000000, 0x0cfcd50b, 0x73f96747, 0x00a0b5ca, 0x00000000, 0x87590200,
+    0x19762b6e, 0x0f76aaba, 0x1ef9629e, 0x000000b9, 0x00000000, 0x6752eb77,
+    0x7f25fdad, 0x26a4cd85, 0xbf4614c5, 0x5e180317, 0x1f365943, 0xdb7bfc9d,
+    0x00000080, 0x24000000, 0xb4cdce58, 0x8b727b62, 0xc7dad137, 0xcb857cb7,
+    0xb7c0ac9d, 0xc19d33de, 0x90d7a96b, 0x2ed94bda, 0xcdf17b63, 0x4b726a3f,
+    0x1badeb19, 0x35966cb8, 0x9efa465f, 0x3bbeb4a5, 0x3813c722, 0xaee7f368,
+    0x75cc8745, 0x91d42cf7, 0xbf7cc8ab, 0xd17c6c8e, 0xabcf7da3, 0xcdf98b3e,
+    0x0089ba62, 0x0f373600, 0x73c278dc, 0xdf5bbc06, 0x1832ecca, 0x1515eccd,
+    0xc42d6b5b, 0x1c472e74, 0x0b360000, 0x2d4bfa5b, 0xc84e3feb, 0x8d288a4d,
+    0x21cc2b7d, 0x6c6de89d, 0x19475edb, 0x51da17cb, 0x5d2be8ab, 0x3b5d85c5,
+    0x45768489, 0xbdc79011, 0x5abf57fa, 0x9ce6f54b, 0xfb06fe5e, 0xbb612f69,
+    0x64469b88, 0x0f5ff2f8, 0xb656eba8, 0xca92d495, 0x5ae40e6b, 0x0cbd97ee,
+    0x65981181, 0x06f403fd, 0xdd699825, 0x5b1eda2e, 0xee867d1b, 0x74cce558,
+    0x3762ceaa, 0xd7ef1775, 0xd495cabd, 0x104fda8a, 0x7cbe61cc, 0xf3609bf1,
+    0x8533439c, 0xda5c98e6, 0x7f097d0d, 0x92c691b6, 0x8b4fbe98, 0x6fb46eca,
+    0xd42b7335, 0x1557c6d8, 0xf61970ce, 0x64dfe9d4, 0xf0f95e68, 0x34e67644,
+    0xbcdd0000, 0x75567c13, 0x8fb861a9, 0x36b9b1c8, 0xe4c49530, 0xeeb8b276,
+    0x1cd6184f, 0x008055a7, 0xef80551b, 0x9ed786fd, 0x161b908a, 0x57f61a51,
+    0x699ae31a, 0xded93f2d, 0x87791b5e, 0x77aa5aee, 0x8becd813, 0xd9e3c81e,
+    0xc5331792, 0x659dd8d2, 0xec4d883b, 0x4fdef21d, 0xd8e6c235, 0x79d72113,
+    0xe8311b76, 0x6ca5b3e6, 0x66843735, 0xf7e23cc8, 0x39a3256f, 0x3cf19ff7,
+    0xe2921dbe, 0xd2a39df2, 0xbaace53e, 0xd33cd38a, 0xe8395a4b, 0x93930300,
+    0xba2ac0a9, 0xb874b9d4, 0x00b355b2, 0x0f8e3600, 0x9be39c39, 0xfa660b23,
+    0x62cb0247, 0x00000040, 0x911dab0c, 0xc0daaad9, 0x008021ef, 0x74dbf17a,
+    0x3fd1bd70, 0xe66fcc87, 0xbd4694c6, 0x9518c615, 0x60d774c5, 0xb597eaf9,
+    0xc9f1bc3e, 0xc7d5c9c1, 0x3c07792e, 0x51bef23a, 0x56ebacbb, 0x391e712f,
+    0xef39b83a, 0x403f23c7, 0x057bd9e7, 0x4933b7de, 0x03001048, 0x842c1925,
+    0x2f46e694, 0xb0303306, 0xa96f0000, 0x5523635e, 0x1c693200, 0xafd8652e,
+    0x2e2b7131, 0xa8520747, 0x8c852ea1, 0x1f790080, 0xf90b0e4d, 0xaf11c5b1,
+    0xcd836905, 0x0300380b, 0x96ec1829, 0x4a26c217, 0x8bdc434f, 0x06009090,
+    0xe64297fa, 0x00047969, 0x81cb4800, 0xbc852761, 0x380291b8, 0xd81b0000,
+    0xd5c81856, 0x56a80c40, 0x1620e310, 0x495bc0f2, 0x0a297089, 0x1778e602,
+    0x009e05a3, 0x1d9a3ef2, 0xe5b1f94b, 0x71c5ae11, 0x000f0d84, 0x48698303,
+    0x462f7db1, 0xba3099bd, 0x6a3cb213, 0x7c0300b8, 0x3573994b, 0x018085a4,
+    0x90e52f76, 0xb11317be, 0xc6ce2870, 0x6d000030, 0x2363e4e1, 0xec000055,
+    0xc692977a, 0x92838a4c, 0x20a1e0b0, 0x1f790060, 0xf8850e4d, 0xd78812d9,
+    0xa6c4bc42, 0x380080a9, 0xe4003839, 0x009003e0, 0x0b9dd706, 0x08a4a499,
+    0xb0b10900, 0xe5252006, 0xca5eeec4, 0xc0600a72, 0x95fa0600, 0x503532e6,
+    0x67840c00, 0x117b0292, 0x47c894c2, 0x81898cb1, 0x7900c0af, 0x850e4d1f,
+    0x8822d9f4, 0xc2b822d7, 0x30998786, 0xcc0494b8, 0xc20297b3, 0x29851e7b,
+    0x084b724e, 0xce2871f1, 0xc77c04c7, 0x4217f846, 0x0da96be6, 0x920a0000,
+    0xc10b59e0, 0xc0ce296f, 0x45b60100, 0x10614e31, 0x2527a70e, 0x0e00b7c4,
+    0x0000400e, 0x50116d70, 0x28940d5f, 0x4c2b728d, 0x26f87c62, 0x54e8fce4,
+    0xadbc6296, 0xec8c4522, 0xd0630f49, 0xb88423f2, 0x802594b8, 0x53d087c5,
+    0x943473a1, 0x06000081, 0x4227265a, 0x949889b8, 0x060080b7, 0x2ce695fa,
+    0x08193835, 0x28521796, 0xf222ca4c, 0x84924a47, 0x49609190, 0x310581cb,
+    0xa20f4c19, 0x9bbe9044, 0xe01a5128, 0xb9b49856, 0x0000d096, 0x00000000,
+    0x3a6f810b, 0x90013317, 0xbc0000e0, 0x5e16e217, 0x3c09f18b, 0x690300c0,
+    0x6b2222ca, 0xcce52678, 0x485296b7, 0x7e624f5e, 0x4d0aa263, 0x5958d94b,
+    0x6330d2ca, 0x2fd50d20, 0x62d9f045, 0xb4f2d688, 0x000080c5, 0x00000000,
+    0x662e0000, 0x00209092, 0x9425cd00, 0x634725f1, 0x00c0901e, 0xbc52df00,
+    0x83ad46c6, 0xd8331635, 0xe9cb29f1, 0x024f3c6a, 0x8f28aab0, 0x16929862,
+    0x81580ab2, 0x179100f4, 0x23ca65b3, 0x1fb34a5b, 0xc8f6b7d4, 0xd45eb7f5,
+    0x000000c0, 0xe4000000, 0x2ccf82a9, 0x33377356, 0x00104848, 0x962f8303,
+    0x5d469213, 0x000019c8, 0x2ef80d00, 0x0c353706, 0x1db65019, 0x2c227189,
+    0x07c6b4c4, 0x814950a1, 0x659e78e4, 0xc9311901, 0x2e197de8, 0x92d9ecc5,
+    0xacd2d688, 0xce17dbc3, 0x796a0f38, 0x6d828353, 0xe34c9419, 0x91476c32,
+    0x8455a96b, 0x1d4742fc, 0xc9de38cc, 0xd163c88a, 0x47721c09, 0xbf153565,
+    0x39c7ed81, 0xc7390f32, 0x87575813, 0xeb393d7a, 0xec98dae3, 0x6f47bc65,
+    0xb6a7f44c, 0x210466ee, 0x27cafce5, 0x963b6aa9, 0x0a42e2d2, 0x9355e292,
+    0x97510612, 0x8c5ce242, 0x316d721c, 0x760c5c42, 0x07008052, 0xc801e2b1,
+    0x4c000038, 0x5e5af24a, 0x8d2899cd, 0x76cd2a6c, 0xd670bed8, 0x5ee7874d,
+    0x6c78dd8e, 0x64b33516, 0xaf79d2d6, 0xb455d81e, 0x492670ee, 0x6e34aead,
+    0xf59216e4, 0xeccb6add, 0x6ff4eea6, 0xeee3956c, 0xd2206f54, 0x2b6de558,
+    0x813b359c, 0xaa557e6b, 0x733daf47, 0xb3b13b1e, 0x9df6999e, 0x0452d2cc,
+    0xf3f49956, 0xbc728f28, 0x1e239794, 0x5416f293, 0x2f35a694, 0x1888ac44,
+    0x57ea1b84, 0x00000080, 0x00000000, 0xa3979700, 0x5a238a66, 0xf25ac38a,
+    0x1ba149dd, 0x5cfdcd1b, 0xa7737375, 0x73a77273, 0xc5a1d6ef, 0x5e7a4b0d,
+    0x4a6fc5d4, 0x7a705cdd, 0xa9f454bb, 0x059dda4f, 0x52d7024a, 0x1b9793db,
+    0x7ded8a6b, 0x95ded68a, 0x404a9ab9, 0x25af0080, 0x842230e5, 0xd882b894,
+    0x1b008044, 0x1f8357ea, 0x963f0390, 0x0022a103, 0x00000000, 0xe8c52500,
+    0xd688b2d9, 0x9ab4b0a2, 0xa3dede31, 0xce0ca09e, 0x5870c262, 0x2f76e081,
+    0x2ef1a485, 0x00b27844, 0x73a7870d, 0x34737321, 0x01008194, 0x63d24c91,
+    0x38036270, 0xb7c06313, 0x0072d21a, 0xe095fa06, 0x6a1c72d5, 0x49489709,
+    0x1145241b, 0x0000fcf5, 0x2e010000, 0x94cd462f, 0x6595b446, 0x7a7ef9ac,
+    0xf88c5e80, 0x65f26263, 0x8e4c0822, 0x61323386, 0x3aa62e6a, 0xdc00c030,
+    0x23172123, 0x0068485f, 0x7ae4b217, 0x17793882, 0x4552b923, 0x561b00c0,
+    0x57d20253, 0xb0821311, 0xd85498b0, 0x000052a2, 0x96000000, 0x0a67a397,
+    0xa20a5a23, 0xe81169d6, 0x5c000000, 0x052e688b, 0x0100d409, 0xb8e845b1,
+    0x8140501a, 0xe0513231, 0x5b74b263, 0x2d6b0149, 0x7046b987, 0x52324f5b,
+    0x6f900362, 0x98057671, 0x8e3c9984, 0x4c46f41a, 0x528c5e94, 0xc7a81953,
+    0x21258147, 0xe5cccca5, 0xe90b8c11, 0x2c09323c, 0x14cf262f, 0x4515b346,
+    0x7a9cf9b0, 0x00000080, 0x0d000000, 0x701132b6, 0x0381a034, 0x48221221,
+    0xcfdca362, 0x19892cc4, 0x3084c2ec, 0x310587cd, 0xe4f83569, 0x805ddc1b,
+    0x8c3c3839, 0xd9095c30, 0x4a06206e, 0x20220f28, 0x5cf10849, 0x3a021256,
+    0x6e121253, 0xb3c9cb4a, 0xc5ac11e5, 0x673e6d49, 0x2003a01e, 0x8cb00595,
+    0x0b162212, 0x4e2a62e9, 0x00d89187, 0x8b90b16d, 0x0044a581, 0x085b6602,
+    0x113270e1, 0xf4c52d00, 0xf2b293b0, 0x0a42cf58, 0xbac03700, 0x00000000,
+    0x00000000, 0x83979500, 0x58230a68, 0x683892ca, 0x19001681, 0x021198c8,
+    0xda22671c, 0x1cb98b5d, 0x301d0932, 0x068087a9, 0x93a312e7, 0x007ecd5e,
+    0x90b0e2d8, 0x19099312, 0x42178d84, 0x32178190, 0x5753640c, 0x3ef5e0ce,
+    0x00f09687, 0x00000000, 0x12000000, 0x116df092, 0x70196b44, 0x356aa931,
+    0x00808d88, 0x00000000, 0x3368c61e, 0x51056cd9, 0x3c33a6ac, 0x0065d18b,
+    0xbc000000, 0x8d487016, 0x50072599, 0x00000000, 0x00000000, 0x6deac212,
+    0xa16a4411, 0x48c13127, 0x00d08a5c, 0x00000000, 0x3a64a903, 0xf2520f80,
+    0x00000072, 0x88020000, 0x000080b6, 0x00000000, 0x21030000, 0x9ed80614,
+    0x4096bbc6, 0x00000070, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x20070000, 0x55049b93, 0x00004e9d, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xc74e0e00, 0x3700c4ff,
+    0x05000010, 0x04020303, 0x01030604, 0x01010300, 0x04030000, 0x02010605,
+    0x14120716, 0x13113415, 0x20183317, 0x10083635, 0x40323127, 0x24373021,
+    0x46382625, 0x00daff50, 0x00010108, 0xad020501, 0xf8b2017c, 0x91e606f9,
+    0xc6469ab1, 0xa4191b69, 0xb191666c, 0x69c6469a, 0x6ca4191b, 0x9ab19166,
+    0x1b69c646, 0x666ca419, 0x469ab191, 0x191b69c6, 0x91666ca4, 0xc6469ab1,
+    0xa4191b69, 0xb191666c, 0x69c6469a, 0x6ca4191b, 0x9ab19166, 0x1b69c646,
+    0x666ca419, 0x469ab191, 0x191b69c6, 0x91666ca4, 0xc6469ab1, 0xa4191b69,
+    0xb191666c, 0x69c6469a, 0x6ca4191b, 0x9ab19166, 0x1b69c646, 0x666ca419,
+    0x469ab191, 0x191b69c6, 0x91666ca4, 0xc6469ab1, 0xa4191b69, 0xb191666c,
+    0x69c6469a, 0x6ca4191b, 0x9ab19166, 0x1b69c646, 0x666ca419, 0x469ab191,
+    0x191b69c6, 0x91666ca4, 0xc6469ab1, 0xa4191b69, 0xb191666c, 0x69c6469a,
+    0x6ca4191b, 0x96b09166, 0xfab0c454, 0xbe2ec457, 0xbe1613b6, 0x37dc6db5,
+    0xdc70c30d, 0x70c30d37, 0xd50d37dc, 0xb8e1861b, 0xe1861b6e, 0x861b6eb8,
+    0x1b6eb8e1, 0x6eb8e186, 0xb8e1861b, 0xe1861b6e, 0x861b6eb8, 0x1b6eb8e1,
+    0x6eb8e186, 0xb8e1861b, 0xe1861b6e, 0x861b6eb8, 0x1b6eb8e1, 0x6eb8e186,
+    0xb8e1861b, 0xe1861b6e, 0x861b6eb8, 0x1b6eb8e1, 0x3224e186, 0xed96dcb6,
+    0xf1f639c5, 0xf689a54f, 0x753a1b96, 0x377f044f, 0x5938bd5c, 0x00ff50a7,
+    0x52cafcc2, 0x6555a34c, 0xf76982f4, 0xb07441e1, 0xa8df7ae5, 0x9fb6912e,
+    0x8b9393c3, 0x7ca88ebe, 0xf29c6b9c, 0x4852a143, 0x661e54ab, 0x674fe3bd,
+    0x9837c73a, 0x171ecdbe, 0x8df1a2c7, 0xe3ca9a22, 0x0faa4ffa, 0xfa7446d6,
+    0xd6d53617, 0xc9971f1d, 0xfdd521eb, 0x660c5342, 0x3cbb2cfc, 0x6d9ae9bc,
+    0x35419857, 0x875dd9b1, 0xf20f7f46, 0x5c68d3f3, 0xd73f3d36, 0x664892b4,
+    0xffa9e8a2, 0x27278900, 0x87df0583, 0x8aa6b475, 0xe748664b, 0x7d0639fa,
+    0x94e936d5, 0x6d345543, 0x4d229b03, 0xa04b8a71, 0x5bedf16f, 0xd001e984,
+    0x18f5efd7, 0x756749e2, 0x28538732, 0x53873275, 0x87327528, 0x32752853,
+    0x75285387, 0x28538732, 0x53873275, 0x87327528, 0x32752853, 0x1b856e81,
+    0x47733477, 0x34477334, 0x7669e15e, 0xf66de158, 0x73344773, 0x45733447,
+    0xd9b86c8b, 0xd98bec47, 0xbfe2ed73, 0x211ef14b, 0xb000ff17, 0xa7bf1e75,
+    0x3332ed49, 0x62a49aa4, 0x4cf7d469, 0x8990ade5, 0x094d2e0c, 0xc3f08331,
+    0xa5516023, 0x858d841f, 0x29756bc3, 0x3956f746, 0x9fc41f1a, 0x5fdd1585,
+    0xbd7aaaf3, 0x06c8027b, 0x698c278d, 0xa95706cc, 0xa7cd52ba, 0xed11cfee,
+    0xac99d371, 0xf0cbed31, 0xd28f2497, 0xd611a611, 0x4deb6ca9, 0x4bd04e24,
+    0x37a945e2, 0x06a46ff0, 0x9c4a33a4, 0xd1591b5d, 0xaa5529fe, 0x7ebfea32,
+    0x4753d42c, 0x22f6bd34, 0xfb4cf8e9, 0x4e4d525f, 0x177e9e56, 0x18cd3aad,
+    0x00ffefd4, 0x118f784d, 0x88473ce2, 0xc4231ef1, 0xe2118f78, 0x858cfa2e,
+    0xe71b52e3, 0x0dcf7a2f, 0x6bb83b8d, 0x69b57524, 0x211ec19a, 0x8a62ad32,
+    0x5a23a237, 0xbd128b22, 0x713c936a, 0xd3589bd1, 0x56df25ab, 0x7bf56c23,
+    0x759c98d6, 0x46ac0e6b, 0x00ffafe4, 0x2b735723, 0x35923d74, 0xc553aa74,
+    0x7af1ea4e, 0xaa28b77e, 0x583e9ab6, 0x1d043b1c, 0xe697d289, 0x499221e9,
+    0xae2c4153, 0x6b94d6ef, 0x23b9a5ec, 0x15129265, 0xffc9de9f, 0xcb5e6400,
+    0xfa156f9f, 0x2396e45f, 0x35f1b324, 0xcaa9443a, 0xa5d30911, 0xcf871fee,
+    0x6616acc3, 0x69997ed4, 0xdfc9caca, 0x2a4d53b4, 0xd37bf8c5, 0x33e8f074,
+    0x345127c4, 0x132450bb, 0x379d71ad, 0x0e018469, 0xda35439a, 0x2a93212b,
+    0x5319a7d4, 0xcc4b2f64, 0x4534add4, 0x664d930b, 0x1d93e368, 0xe9b58164,
+    0x903a9866, 0xe98a4e99, 0xdff01b5f, 0x4789d4a5, 0x23278a34, 0x7e7dd461,
+    0x02f5b3d2, 0x77b0a03b, 0x8b1fad26, 0x090dd6a4, 0xabdf4ab6, 0xb56ef4ba,
+    0x145d9e41, 0xfac53f0b, 0x3458ab5c, 0x269d14a9, 0x0c29ebbc, 0xa6d18d2c,
+    0x4846f459, 0xeb7fafe9, 0x706ceb32, 0xe2ccc25c, 0xb0a5e9fc, 0x1af56787,
+    0x49530f6d, 0x77219666, 0xa049a356, 0xe9b710cb, 0xaeb641bc, 0x7602377a,
+    0x90a55379, 0x4ad324f5, 0xf45fbba1, 0x7c2317ca, 0x19614ab7, 0xf3489c2f,
+    0x23711e89, 0x1a3624ce, 0x521d8a55, 0xdfb7bd34, 0xad3e6313, 0x4a8d6d4d,
+    0x5dda5a1d, 0x6a6e6bcd, 0x8272bd69, 0x4189442e, 0xa9b9a316, 0x2142c790,
+    0x6dad9291, 0x5e6e6a63, 0xe9a585ee, 0x5a4b7b3b, 0x5918c605, 0x17e1648b,
+    0xc5dbe7b2, 0x49f9977e, 0x8038f126, 0xa603f1bb, 0x0fe2d7d6, 0x1ec4c74d,
+    0x3d888f9b, 0x7a101f37, 0xf4203e6e, 0xe9417cdc, 0xd383f8b8, 0xa607f171,
+    0x4d0fe2e3, 0x9b1ec4c7, 0x373d888f, 0x6e7a101f, 0xdcf4203e, 0xb8e9417c,
+    0x71d383f8, 0xe3a607f1, 0xc74d0fe2, 0x869b1ec4, 0xf9d3570d, 0xb4d29a22,
+    0x6cebbaa8, 0x5113c9b4, 0x06dbc975, 0x7632d84e, 0x0cb693c1, 0xed64b09d,
+    0x196c2783, 0xdbc9603b, 0x32d84e06, 0xb693c176, 0x64b09d0c, 0x6c2783ed,
+    0xac603b19, 0xe4ea9e89, 0x6520a30c, 0xc8280319, 0xca404619, 0x90510632,
+    0x94818c32, 0x20a30c64, 0x28031965, 0x404619c8, 0x510632ca, 0x818c3290,
+    0xa30c6498, 0x03196520, 0x4619c828, 0x0632ca40, 0x0c339061, 0x0c649481,
+    0x196520a3, 0xe04a2803, 0x16eab2d0, 0x8493b55d, 0x6f9fcb5e, 0x885ffa15,
+    0x17993f9a, 0xb15eaf89, 0x5a2965d1, 0x15b5528a, 0x0a0feab6, 0xad4424d0,
+    0x0756877a, 0xdd7f6b36, 0x19a792a0, 0x3bc43b1c, 0xeff3aa29, 0x5cd93092,
+    0xcc649c99, 0x196726e3, 0x99c93833, 0x32ce4cc6, 0x33937166, 0x649c998c,
+    0x6726e3cc, 0xc9383319, 0xce4cc699, 0x93716632, 0x9c998c33, 0x26e3cc64,
+    0x38331967, 0xc163634e, 0x86b65a61, 0x7166f25b, 0x998c3393, 0xe3cc649c,
+    0x33196726, 0xc699c938, 0x6632ce4c, 0x8c339371, 0xcc649c99, 0x196726e3,
+    0x99c93833, 0x32ce4cc6, 0x33937166, 0x649c998c, 0x33d9e2cc, 0xa5858927,
+    0xc6792c35, 0xc1a489f5, 0xdbe7b217, 0x35967ec5, 0x3462fe87, 0x241179a9,
+    0xc60726f1, 0x93c1b319, 0xa8c6c8a6, 0x2eb46bd9, 0x1741c647, 0xb02d13d4,
+    0x197ef78f, 0xefa7df7e, 0xe2e23a20, 0x1cc991bc, 0x911cc991, 0x58911cc9,
+    0xe4c22ae2, 0xda198271, 0x28e4c754, 0x2b2556d6, 0xec992da0, 0xff843ee7,
+    0x589cd400, 0x5e4a5adf, 0x5cc5c64a, 0x911cc991, 0xc9911cc9, 0xac156510,
+    0x2e9eaea9, 0x73abaa6e, 0x437224a7, 0xe67c7423, 0x8822b627, 0x8de4f8bc,
+    0xfe2ade2a, 0x29995131, 0xbf3011ea, 0xb488a738, 0x95ad9027, 0x7361a736,
+    0x356d6a65, 0x3acb98b0, 0x27f6c6a7, 0x9a5b7bc7, 0xa0945d5e, 0xd6f4be60,
+    0x9240aa33, 0xc29acce8, 0xdd5f981b, 0x4bb12cd3, 0xe448ae7a, 0x31d57188,
+    0x09f52ba2, 0xb9ec4530, 0xa55ff1f6, 0x00ff618d, 0x71cf8a98, 0xc2bc8bc8,
+    0x1343ec3a, 0x8bf862e3, 0x741dce64, 0x48264786, 0x00ff0df7, 0xed97e17f,
+    0x03f37efa, 0x3877987c, 0x73388773, 0x87733887, 0x4e8f4638, 0x894c95ad,
+    0x57ad1405, 0x215d73c1, 0x151cc571, 0x961b1ff3, 0x9bee1b51, 0x0f2117b9,
+    0x7575d52f, 0xe7700ee7, 0x0ee7700e, 0x7ec5d370, 0xeaabd164, 0x1d7ccb8e,
+    0x239cc3b9, 0x60d93b92, 0xafd98931, 0x8b956752, 0xa61cece1, 0x6fe2dc0b,
+    0x249b4876, 0x25bed54f, 0xa99897a7, 0x65ed52bb, 0xcb7e04b5, 0x0646b165,
+    0xc3d911a4, 0x2ca4ab45, 0x29113917, 0xace2adb9, 0xa2ca2b8e, 0x4559fd44,
+    0x5bfe1167, 0x5ef124bb, 0x73388fc9, 0xe71f9e86, 0xa17ec535, 0x97bd0826,
+    0xf42dde3e, 0xf31facc1, 0x5fb76d21, 0xdabaad5b, 0xf3d70a8f, 0xa78c93b0,
+    0xba886794, 0x6dadaccb, 0xffb2d1ba, 0x3ea71a00, 0x00ff7cda, 0xe9b76f86,
+    0x216eabfb, 0x9a4ea1fd, 0xe91d93cf, 0x7b7afcec, 0xcf9e1e3f, 0xf1b3a7c7,
+    0x7afcece9, 0x9e1e3f7b, 0x93a7474f, 0xf4dce9e1, 0x1e3e797a, 0x3d7c4f9e,
+    0x33f89e3c, 0x23994fb6, 0xc7cf9efe, 0xe9f1b3a7, 0x7b7afcec, 0xcf9e1e3f,
+    0xf1b3a7c7, 0x42fcece9, 0x43718ea1, 0x4de232ca, 0xd2d36998, 0x674f0fd7,
+    0xf8d9d3e3, 0x3d7cf2f4, 0x698a9f3d, 0xd383fae4, 0x9eaee8c9, 0x3c3daa4f,
+    0xe4e90a9f, 0xc9d3a3fa, 0x4f9eaef0, 0x9e3c3daa, 0x274f57f8, 0xc9d315b5,
+    0x93a747f5, 0xf4dce9e1, 0x113d777a, 0x44e6d2c4, 0x49fd706e, 0xf6f47177,
+    0xb9d32c7e, 0xc730f7fd, 0x8b6410eb, 0x8b60f277, 0xe2ed73d9, 0x1a4c00ff,
+    0x3200ffc1, 0x42545c09, 0x9e00ff34, 0x5bd455b7, 0xb2756302, 0xb185193b,
+    0xc3e93738, 0xd361f431, 0x2c8aba0e, 0x2bbdade8, 0x2b5a8a43, 0xcdac7daf,
+    0x1a24cab7, 0xb554d48c, 0xcbc442f1, 0x9f643ef5, 0x7edada5a, 0xdb37c37f,
+    0x77d1fdd4, 0xca6dbb92, 0x58365876, 0x58365836, 0x69225836, 0xb0bf945a,
+    0x42ae42a1, 0x47d52c92, 0xedc8e3b3, 0x52d43a26, 0x5a31ead6, 0xea220db9,
+    0xb278a20c, 0xb8bd907e, 0x2c9bd5d6, 0x2c1b2c1b, 0x2c1b2c1b, 0x3f0c2c1b,
+    0x2e350ce2, 0xcb66ab94, 0xcb06cb06, 0x350a6104, 0xecc724cf, 0x2a8b457e,
+    0x58164fa8, 0xac8b0f65, 0x8b22b328, 0x495c562e, 0x905a8971, 0x8dd1e021,
+    0x654cca3b, 0x88642f45, 0x19a95b93, 0x619cfb34, 0x4cb14ab4, 0x1b245a6d,
+    0x1b2c1b2c, 0x152c1b2c, 0xbf5b7cfa, 0xcb5e8492, 0xfa176f9f, 0x00ffd560,
+    0x736690f9, 0x5b453e8f, 0x82989065, 0x5c48b7a6, 0xe857a638, 0x4bf665f5,
+    0xe349ae23, 0x3b73b872, 0x2189c262, 0xfd682a58, 0x837a396b, 0xedf62d17,
+    0xc8ce4c4a, 0x6b6352a3, 0xb62ecaa4, 0xe13f1ff5, 0x72fd9f9e, 0xf22eba9f,
+    0xca4ff755, 0xf7a6acca, 0x20e46576, 0x8b502e7b, 0x45c3abc8, 0x4eae11ab,
+    0xe1792c4b, 0x481eb9b1, 0xa49d8982, 0xa45beb0d, 0x7874c80b, 0xc77e98f9,
+    0xcff4951a, 0x53e23cce, 0xc54bab53, 0x922738e4, 0x78edd311, 0x646d3562,
+    0xb644d5ad, 0xe1e4cc42, 0xd63b2a49, 0x5a4e2e36, 0xed0d6f44, 0x687d70d4,
+    0xad042974, 0x64a81581, 0xabc3c96c, 0x92d51bdb, 0x3e5fd237, 0x179fbe5b,
+    0x1781e4ef, 0xc5dbe7b2, 0x7f3598fe, 0x652b64fe, 0x5fb6b6f4, 0x6985076d,
+    0xaedb52f9, 0x96711216, 0x5ba649d8, 0xbeb5564a, 0xe2bacbcb, 0xbe6cb00f,
+    0xa300ffb6, 0xcdf6d1f0, 0xe45d743f, 0x79625786, 0xcc606306, 0x838d196c,
+    0xba37b031, 0x544fe09a, 0x734b49a9, 0xc856c43c, 0x543db98f, 0x245b5b3b,
+    0xce590c6a, 0x6f85aa74, 0x3127d12a, 0x44a5cccd, 0x7129393a, 0x8d194bcc,
+    0x66b03183, 0xc1c60c36, 0xad12d898, 0x4e5084a3, 0xaca3c9e4, 0x0fb0acbe,
+    0x4c035856, 0x96d387e0, 0x5540ac3d, 0x539bfa92, 0xfc2af525, 0xbf5cd0ce,
+    0xab6b31cd, 0x9d797983, 0xf59834a1, 0x84766676, 0x159c7372, 0xb11c9426,
+    0x9512794a, 0x1e93a844, 0xd1cecc92, 0x3b33da99, 0xb6f56545, 0xa8d0cedc,
+    0xbf784aee, 0xbd08247f, 0x31de3e97, 0xdfabd1f4, 0xfffb20f3, 0x23ab3200,
+    0xa97cfb3b, 0x532b9181, 0xe14d1c9b, 0xccc0549e, 0x5c4fb391, 0xe98d2c5a,
+    0xe3fe91b4, 0xc09a9088, 0x904232a9, 0x81c9046a, 0x1f53a72c, 0xa9932495,
+    0xab695ca3, 0x30cce44e, 0x9f1f1194, 0xcdf6d3f0, 0xe45d743f, 0x928feea7,
+    0x6d9b903e, 0xd253b944, 0xdcda6985, 0x6fa9894d, 0xc8e28621, 0xe736606d,
+    0x4b76f344, 0x4628141b, 0x8bc64ad2, 0x5c792454, 0xe6b5b48e, 0xc7cab79f,
+    0x8fd740f6, 0x6775acb5, 0xa1ecc64e, 0x209dc62a, 0x747afbfa, 0x6edaa9ae,
+    0xb575c24d, 0x58058eb6, 0x146ab1d5, 0x5a98be24, 0x6c8b1367, 0x5a117269,
+    0xe4b27326, 0xd35a51e9, 0xe8b72662, 0x185386c7, 0x26b452a3, 0xe4e89350,
+    0x4f219591, 0x4347a046, 0xb93690db, 0x9c40a439, 0xf3110db9, 0xc7f8f46b,
+    0xbd08237f, 0x31de3e97, 0xab11dff4, 0xcb30f3df, 0x63c76128, 0x120f8412,
+    0xbd8d4439, 0x411d1ad1, 0x53be2167, 0x49756f24, 0x882d7e1b, 0x65a1ca36,
+    0xb167d9c3, 0x3a9109e4, 0xbae14b5e, 0xaec4e291, 0x6b4b997a, 0xb5bd9104,
+    0x88266d96, 0xfff94d4a, 0x6c3f0d00, 0x17e5bfd2, 0x8d682279, 0xb1e82019,
+    0xa362d151, 0x4547c5a2, 0xd068828a, 0x686cab84, 0xc94a34a1, 0x1c994e6a,
+    0x3a7a68f2, 0x96635b0b, 0x67ad659e, 0x66868c1c, 0x61a352fb, 0xca4c2c42,
+    0x41b1e858, 0xa2a362d1, 0x8a4547c5, 0x1d158b8e, 0x90112a16, 0x484c3491,
+    0x6c26a863, 0xb5a3e877, 0xec2e7a97, 0x56ca341b, 0x6df179cd, 0xd1755348,
+    0xfcba4fdd, 0x37b75373, 0xd649a6c3, 0x189c0599, 0x525f54a1, 0x6b7cda56,
+    0x74da1453, 0x54945153, 0x94a5ceb8, 0xa4b64862, 0x27410520, 0x179e1c24,
+    0xc54a493f, 0xb5e426b5, 0xc825ea88, 0x016a86cd, 0xa933b2f4, 0xd41ad765,
+    0x12a0e9cd, 0x9c55cb35, 0x3b46c751, 0xec4518e9, 0x9ff1f6b9, 0xbd4b8da6,
+    0x370fb8b4, 0x4a37c74a, 0x5e3a8ec5, 0x58e9e658, 0x513bdd26, 0xe1e96561,
+    0x8de9a7a2, 0x974eb9b4, 0x4a376fdb, 0xc74a37c7, 0x57c54a37, 0xa9045d69,
+    0xefe24bb7, 0x1c2bdd9c, 0x9f062bed, 0xdb5624a6, 0xeffbee34, 0xbf4b4dbb,
+    0x39fba595, 0xba3956ba, 0xe8143456, 0x7efad1d9, 0x57c9bbe8, 0x59243fdd,
+    0x837c2527, 0xf6f2759d, 0xc89ad174, 0xcd595890, 0x128c1b64, 0x4a84be4a,
+    0x96983b77, 0x4bd4bea0, 0x64476ec8, 0xcb2a3b6d, 0xb9216488, 0xfb61e58b,
+    0x8e11fb1f, 0x7b1146fa, 0x67bc7d2e, 0xff57a3e9, 0x235fe600, 0xd324da42,
+    0x1592f158, 0x928b09d0, 0xaefc3827, 0xf327fdbf, 0xdfeaf8bb, 0xe3ef82df,
+    0xca650da8, 0xb8b856df, 0x856358bf, 0xbf2ea286, 0xe197bfa5, 0x7e9aed9f,
+    0x42c9bbe8, 0xfac9d705, 0xcee98073, 0x0e38a703, 0x2c1be09c, 0x9d43815e,
+    0xa9d8d5aa, 0x9cd362d9, 0x2716f257, 0xb42c00ff, 0xaad42af2, 0x6dd15c87,
+    0x2eb445ee, 0x45c53572, 0x4390d4ab, 0x8583cb8b, 0xe980733a, 0x38a703ce,
+    0x3ae09c0e, 0x2c668073, 0xd83f61c2, 0x30d2778c, 0xed73d98b, 0xf14d3fe3,
+    0xb9de9e1a, 0x35bd4fdb, 0xaee921d4, 0x754d0fa1, 0xa86b7a08, 0x514f7c41,
+    0x125fb0d7, 0x11e37bd4, 0x88f9e4a8, 0x51673cb9, 0x357d8aa4, 0xaee921d4,
+    0x754d0fa1, 0x354d5708, 0xa053c30b, 0xa7295773, 0x2b84baa6, 0x5a859aa6,
+    0x36555d1f, 0x98da4de5, 0x163392a9, 0xaccba8d4, 0x773a3f8a, 0xa1aee941,
+    0x08754d0f, 0xefe31f7e, 0x2bede8b1, 0x927751fe, 0x89944459, 0x192a5b1e,
+    0xb265a86c, 0x86ca96a1, 0x6c192a5b, 0xa1b265a8, 0xa582ca96, 0x29ade42f,
+    0x2db7967c, 0xc4423451, 0x6330e5f6, 0x0c952dbb, 0xd93254b6, 0x4365cb50,
+    0xb60c952d, 0x50d93254, 0xb54165cb, 0xeff0b562, 0xe97b46ec, 0xb9ec4510,
+    0xa79ff1f6, 0xf2be550d, 0xbc9edff4, 0x52ce6245, 0xa948da98, 0xd830e38a,
+    0x9b3292b9, 0xb6d158d9, 0xcee6dabb, 0xef8fa6e9, 0x5ecf1397, 0xf39cd622,
+    0x9bc77f26, 0x4258eda8, 0x23f69468, 0x961a3556, 0xf9289ad0, 0x5e1a5ecf,
+    0x7b69119e, 0xb105444a, 0xdad09dd1, 0x3c36cee3, 0x3d6a65af, 0x7cc494c5,
+    0x360adf09, 0x5a71f8e7, 0x9f6a6cb1, 0x55f22eba, 0x17fa4ff7, 0xf6e242a8,
+    0xae8f09b9, 0x3f36b817, 0xaeba5456, 0x4300ff55, 0x00ffd80f, 0xd2f78cd8,
+    0x73d98b20, 0x4e3fe3ed, 0xd765ad1a, 0x3d88b0e9, 0x9411c19e, 0xd6d89848,
+    0x1e63ab24, 0xbe1e9fa7, 0x63f9de7e, 0x651a4f49, 0xa45288ef, 0x3233a6e8,
+    0x76a187a4, 0x3fdd8c5c, 0xe71a573e, 0x70a617cd, 0x00ff47a0, 0x2811822b,
+    0x749591b1, 0x1d431271, 0x520b1990, 0x3a33a6c4, 0x9cc2327f, 0x8fd22475,
+    0x291afe9f, 0xba9f5e5c, 0x4aaef03f, 0x8f5c22a6, 0xc81c0a99, 0x8742e650,
+    0x90391432, 0xd3988ca0, 0xf558bc85, 0x3115b34d, 0x6ba2f829, 0x70181352,
+    0xded1adba, 0x8d22db4a, 0x24be27c6, 0x87ced2ac, 0x28644e9b, 0x99432173,
+    0x50c81c0a, 0x328742e6, 0x845e1014, 0x23f68fc8, 0x2288f43d, 0x78fb5cf6,
+    0xd685d3d7, 0xb48a65d8, 0x1fd44d03, 0x23a7f3f0, 0x474ee7e1, 0x8f9ccec3,
+    0x1f399d87, 0x19743a0f, 0xc30e5e74, 0x9dcec377, 0x3a9d870f, 0x743a0f1f,
+    0xe8741e3e, 0xd0e93c7c, 0xa1d379f8, 0x40a7f3f0, 0x148314bd, 0xa7f1f0c5,
+    0x4ee7e123, 0x9ccec347, 0x398d878f, 0x723a0f1f, 0xe4741e3e, 0x46b43031,
+    0xa4fbe95a, 0x75dfe5ee, 0xd43ea8fc, 0x2a29ab8d, 0x3ba9947e, 0xdc88b20c,
+    0x5126551a, 0x4ea9297b, 0xbd7d6b72, 0x8819cb19, 0xa1a94440, 0x292b1532,
+    0x3fac7cfb, 0x6200ff63, 0x7f48df35, 0x9fcb5e74, 0x77fa1a6f, 0xd9fb29f6,
+    0x5bbe6c75, 0x7672730d, 0x08e325c2, 0x5e228c97, 0xc2788930, 0x7a0ce125,
+    0xb151dc7a, 0xfb3e41fd, 0xc536f51b, 0x94b3e269, 0x32c194a5, 0xddc6ba29,
+    0xb84a2948, 0xf575d5ac, 0xdccad46f, 0x4534c5d8, 0x305c224c, 0x25c27889,
+    0x8c9708e3, 0x810a5e22, 0xb4bccdcb, 0x8a3436e5, 0xf8421937, 0x201507a9,
+    0x541ca4e2, 0x71908a83, 0x412a0e52, 0xa93848c5, 0xe2201507, 0x83541ca4,
+    0x5271908a, 0xc5412a0e, 0x07a93848, 0xa4e22015, 0x8d82541c, 0x8d681db7,
+    0xdd1fd277, 0xdbe7b217, 0xfd9fbec6, 0x92e97e8a, 0x28e7e2f9, 0xb1ea95c5,
+    0x2363d591, 0x5547c6aa, 0x19ab8e8c, 0x3a32561d, 0x587564ac, 0x91b1eac8,
+    0xaa2363d5, 0x8c5547c6, 0x1d19ab8e, 0xac3a3256, 0xc8587564, 0xd591b1ea,
+    0xc6aa2363, 0x828c5547, 0x5be2408a, 0x72a90539, 0x8a7bec5a, 0x06e440ae,
+    0xd61dcbc4, 0x991c47bc, 0x8a85f292, 0x44ce652a, 0xca5b6929, 0x7404aa1c,
+    0x62b36a31, 0xbabee4ae, 0xfe427b10, 0x8b1abd48, 0xe541391a, 0x9c25a60a,
+    0x811cc9a1, 0x39af04c8, 0xd057ae39, 0xec7d23f3, 0xec45f783, 0xaff1f6b9,
+    0x6200ffa7, 0x4d8dbc9f, 0x04f2b0e4, 0xc3b7a469, 0x9911599c, 0x29385242,
+    0xe46d2425, 0x5dd853e7, 0xb195eae8, 0x9d3570dd, 0x48a392ec, 0x41797c4a,
+    0x9254210d, 0x466557d6, 0x5d776ba5, 0x65d77662, 0x766e8a6a, 0x8ecd6939,
+    0xa9b9cfe9, 0x02bdd5e2, 0x36d25b43, 0x2b352fbb, 0x34daaa73, 0xafdc1cc6,
+    0x74d9eab8, 0x48e56d69, 0x92a5ed5a, 0x6f53560b, 0x41998332, 0x47ef5809,
+    0xa4a337d5, 0xda89e675, 0xbc2a9089, 0x1a94e3e6, 0x88d5946c, 0x204b2e50,
+    0x1a9b5bb9, 0x5228698b, 0x9cd59b7d, 0x48c27a73, 0x9ca3d724, 0x151b1c9c,
+    0xb0915626, 0xf8d853cb, 0x37624b9d, 0xc4b0439d, 0x07655e12, 0x40998332,
+    0x8d237775, 0xdd0fb2f7, 0xdbe7b217, 0xfd9fbec6, 0x63f37e8a, 0x686e96bc,
+    0x7ae41880, 0xcca93bf9, 0xb22abbe4, 0x71e0f63c, 0xb5a2d588, 0x907a95d6,
+    0xcd892528, 0x5d9271d5, 0x4ce65333, 0xc313169a, 0xb5baa78c, 0xd15e7773,
+    0x724b701e, 0xabf7d597, 0xab6aef52, 0x56a6bcd2, 0x290aa9a8, 0x6491c92b,
+    0xe7a05ec7, 0xb004f537, 0x99824bd5, 0x92268502, 0x74b332a2, 0xa6e52991,
+    0xb54c797e, 0x399ecb81, 0xa4da23e1, 0x4f675c0a, 0xe5cd1ab2, 0x72c9eaac,
+    0xd29d499f, 0x77a55157, 0xfa68322d, 0x5fcda569, 0xa5973849, 0x38df9529,
+    0x27a2307f, 0xb5ae2472, 0xeedc3e99, 0xbc913be5, 0xe550bb5a, 0x3edb642e,
+    0x9ee8d892, 0xe448267b, 0xea5c20e1, 0xe1399eaf, 0x55dcca1d, 0x29a926ab,
+    0x1f64ef1b, 0xcf652fba, 0x1ff68db7, 0x1f3192d9, 0xdb9a8f24, 0x1bfe2220,
+    0x7ab16bd8, 0x57a7f245, 0x0dbf3bf9, 0x071f71f0, 0xdf70ec0d, 0x70ec0d07,
+    0xf01107df, 0x11c7de70, 0x1c9647f0, 0xe9ad7cd7, 0x0d7746e2, 0xc7de70f0,
+    0xde70f011, 0x70f011c7, 0x2c06c4de, 0xb7b963ee, 0x4e27d3d4, 0xc86b21f7,
+    0x42d50dcb, 0x6e3d2fb1, 0x53d6c7c6, 0xca190a01, 0x3d7fdc58, 0x14eb21dd,
+    0x2db546ac, 0x105c8bee, 0x5c8b6116, 0x3e57a74a, 0x3dcc9b89, 0x6b0aa25a,
+    0xf7cdb25a, 0xe26fab34, 0xa8bd54b3, 0x4c1031cb, 0xf34905a9, 0x712693da,
+    0x7cb1b974, 0xb7b8587a, 0x47aa5f87, 0x00ffd73b, 0xe7b217dd, 0x0fbbc6db,
+    0x24efa2ec, 0x32194992, 0x324ea23c, 0x24ca3889, 0x8c9328e3, 0xb2214ea2,
+    0xd9c8ba97, 0x9ec90fa6, 0x89fe5a4c, 0xd3f7d6a9, 0x17e670d5, 0x922143a6,
+    0x26e5ca58, 0xd7945a90, 0x722e6b07, 0x4caa7d7d, 0x89324ea2, 0xe324ca38,
+    0xa28c9328, 0x3889324e, 0x6ca9566d, 0xd3576a3c, 0xecb22a03, 0x5a5a4943,
+    0x5109d844, 0x8914e465, 0xe999983a, 0x58647c09, 0x3c020a9d, 0xab63ca13,
+    0xadb11053, 0x2e179bca, 0x5d9da92e, 0x77c7c77c, 0xad58ede3, 0x42b2596b,
+    0x9ab8d25d, 0xa819c1b9, 0xf64c25d6, 0xbdb6f4b4, 0x85e656a7, 0x07856203,
+    0xf73d3e2b, 0x23d5af03, 0x00ffeb9d, 0x73d98bee, 0xff75e3ed, 0x3ce2c100,
+    0x1ef18847, 0x8f78c423, 0x473ce211, 0x231ef188, 0x118f78c4, 0x88473ce2,
+    0xc4231ef1, 0xe2118f78, 0x1f853208, 0x29724436, 0xbfd0ca4f, 0xc5513aa5,
+    0x4c97d4c6, 0x5c44324c, 0x3122fa9e, 0xcd840ae1, 0x94b92cea, 0x065ec4e7,
+    0x61314dca, 0x6753948e, 0xa841dccc, 0x964e82a2, 0xa5a7a522, 0x7ae930e9,
+    0x935e3a4c, 0xc3a4970e, 0xe930e9a5, 0x5e3a4c7a, 0xa4970e93, 0x30e9a5c3,
+    0x3a4c7ae9, 0x970e935e, 0xe9a5c3a4, 0x4c7ae930, 0x0e935e3a, 0xa5c3a497,
+    0x7ae930e9, 0x935e3a4c, 0xc1a4970e, 0xed4bb7a1, 0xa4fa7576, 0xfd7fbd73,
+    0x7d2e7bd1, 0xfeb06fbc, 0x7dddb6cd, 0xc2b210c6, 0x1547a9f8, 0x1ca5e228,
+    0x948aa354, 0x2a8e5271, 0x384ac551, 0x281547a9, 0x541ca5e2, 0x71948aa3,
+    0x512a8e52, 0xa9384ac5, 0xe2281547, 0x519016a5, 0xe14c2d57, 0xd3576af9,
+    0x43efd23f, 0x36791393, 0x82a47c94, 0x88fe5908, 0xbf0edcf7, 0xaf778e54,
+    0xb217c9df, 0xebc6dbe7, 0xc48700ff, 0xe2118f78, 0xf188473c, 0x78c4231e,
+    0x3ce2118f, 0x1ef18847, 0x8f78c423, 0x473ce211, 0x231ef188, 0xe6b21ec4,
+    0xada93a96, 0x811cc86b, 0xc8811cc8, 0xcf9f801c, 0x19d67a56, 0x407e7203,
+    0xd369a538, 0x722007f2, 0x07722007, 0x20077220, 0x45200772, 0xee4e8d5d,
+    0xd3517e79, 0xf3e3e338, 0x51b3a757, 0x7ad4ece9, 0x9e1e357b, 0xb3a747cd,
+    0xd4ece951, 0x1e357b7a, 0xa747cd9e, 0x26b250b3, 0xac6be1f8, 0x6be6683a,
+    0xea6a42bc, 0x51b3a777, 0x7ad4ece9, 0x9e1e357b, 0xb3a747cd, 0xd4ece951,
+    0x1e357b7a, 0x2c43cd9e, 0xe99d600e, 0xde91ead7, 0x22f9fbf1, 0x78fb5cf6,
+    0x99fd63df, 0x47549e41, 0xa0cb4197, 0xe872d0e5, 0xba1c7439, 0x41045d0e,
+    0x32942e4d, 0x9f2b383c, 0x4b4632b4, 0x24e6a266, 0x36b6e751, 0x999b96e6,
+    0x49bb93d8, 0x7e9119fa, 0x832e075d, 0xa0cb4197, 0xe872d0e5, 0xb5117439,
+    0x6f89ac54, 0xa574a979, 0x36da365b, 0x36da36da, 0x23da36da, 0xad3cf6ec,
+    0xe292da5a, 0xb6781b6b, 0xf4a218d7, 0x51171527, 0xc4221554, 0xb3b4d5aa,
+    0x3e8b9452, 0xaf23ab54, 0x37561f06, 0x68db203a, 0x68db68db, 0x68db68db,
+    0x0b99528f, 0xbd23d5af, 0x45f2f7e3, 0xf1f6b9ec, 0x32fbc7be, 0x85ace7c4,
+    0x733cc7f3, 0xc7733cc7, 0x54c3733c, 0x2587d680, 0xace8aefa, 0x7950bd86,
+    0xd56b6c69, 0x0db45667, 0x84f296fa, 0x93d309c6, 0x6452a3ec, 0xe764ee28,
+    0x8ee7788e, 0x788ee778, 0x8a2588e7, 0x6faa255d, 0x2b358aa1, 0x3d2b9fe9,
+    0x85506ea9, 0x742797d8, 0xda15a9af, 0xd63de373, 0x47b5bdb0, 0xa424ac50,
+    0xa039d3ea, 0xb273c5b1, 0xf05c4913, 0x0b49e1d6, 0xfe494ea1, 0x0edcf758,
+    0x778f54bf, 0x17c9bf8f, 0xc7dbe7b2, 0xb7ec1f3b, 0x642b619a, 0xdfc92c4e,
+    0xea30abfa, 0xb3aac3ac, 0x13ccaa0e, 0xd7e69051, 0xd49a5a33, 0xa46066f5,
+    0x56a9b4f6, 0x7f416b28, 0x591d6656, 0xd89a3598, 0xa3a2bcea, 0x425cb6c6,
+    0x4649582b, 0xb9f765d6, 0x557f97b4, 0x98551d66, 0xd5615675, 0xcc358459,
+    0x6a822ca5, 0x5e734bea, 0xe8648c4e, 0x378c4ec6, 0xb1a833be, 0xd586ccd5,
+    0x70491d88, 0xa4923339, 0x114816a8, 0xf0b156a2, 0x77ab07a4, 0xe7661a21,
+    0xcaad5c42, 0x10a10c11, 0x8d5563bd, 0x589049c6, 0x65885066, 0x8c4e8608,
+    0x4ec6e864, 0x52c9338c, 0xf5ebf05e, 0xfb78f748, 0x2e7b91fc, 0xb273bc7d,
+    0xea4ecafe, 0x956d6d59, 0x2254887c, 0x07a9154d, 0x5d4eaa26, 0xa0934c15,
+    0x63d1a54e, 0xe01c6589, 0xf37259a5, 0x8b48a24d, 0xa7158b62, 0x24ea36fb,
+    0xa68d4935, 0x96b8bbbc, 0x931fa798, 0x358afe4f, 0x9fe99522, 0x733f569c,
+    0x61e986d2, 0xebccce8c, 0x82562ead, 0x46bcd6f4, 0x57725d4a, 0x8b87e44b,
+    0x49a52b16, 0x5f93ebaa, 0x45b6a85b, 0xff295290, 0xdc0af300, 0xd8fc1016,
+    0x5c68c5a4, 0x69a3979c, 0x5b69d8fc, 0xa97e9d9f, 0x3f1fef1f, 0xcf652f9a,
+    0x5f768eb7, 0x1bc791da, 0x7afae6e4, 0xf1f4f478, 0xd3e3e9e9, 0x87a7c7d3,
+    0x1ece4e8f, 0x3c3d9c9d, 0xb3d3833a, 0x0f67a787, 0x9d1ece4e, 0x3c3c3d9c,
+    0x8777767a, 0x4f0f67a7, 0x9e9e1e4f, 0x7a3c3d3d, 0x4fb3787a, 0xd2c9ad0c,
+    0x85b6b4b7, 0x5bde1b49, 0x69c3d36f, 0x8fa7a777, 0xd3154f4f, 0x3c3daab3,
+    0xc3d3833a, 0x0f67a7c7, 0x9d1ece4e, 0x383b3d1a, 0x8977767a, 0xce091510,
+    0xb452135f, 0x1e0f4f9f, 0x3b3d9c9d, 0x70767a38, 0xe9f1f4f4, 0xd3d3e3e9,
+    0xdf2c76c4, 0xd65a511d, 0xc7fbc7ea, 0xd98be6cf, 0x9de3ed73, 0x99e65690,
+    0x9121721d, 0x4364880c, 0xc8101922, 0x21324486, 0x64880c91, 0x10192243,
+    0x324486c8, 0x880c9121, 0x19224364, 0xffbfc810, 0xde3f4200, 0x5e347f3e,
+    0x1c6f9fcb, 0xe2a8d6ec, 0xafebbaa6, 0x8be9fabb, 0xcb37694b, 0xc6ecb689,
+    0x33dc98e1, 0x7063861b, 0x8d196ecc, 0x66b831c3, 0xe1c60c37, 0x1b33dc98,
+    0xcc706386, 0xc38d196e, 0x3766b831, 0x98e1c60c, 0x861b33dc, 0xb5427063,
+    0x52cafabd, 0xd9c155b7, 0xb6dc90b5, 0xcba82da3, 0x8cda326a, 0xa82da3b6,
+    0xda326acb, 0x2da3b68c, 0x326acba8, 0xa3b68cda, 0x6acba82d, 0xb68cda32,
+    0xcba82da3, 0x8ada326a, 0xaff16d4b, 0x0e267a09, 0xa2f9efed, 0x78fb5cf6,
+    0xd8f766e7, 0xacab20a7, 0x6dc548be, 0x93716672, 0x9c998c33, 0x26e3cc64,
+    0x38331967, 0x4cc699c9, 0x716632ce, 0x998c3393, 0xe3cc649c, 0x33196726,
+    0xc699c938, 0x6632ce4c, 0x8c339371, 0xcc649c99, 0x4fed29e1, 0xcf84947f,
+    0x1cc9232a, 0xe8a8108f, 0x28525d9c, 0x97141efd, 0xe2bd750d, 0xefeb02d8,
+    0x5c2f866e, 0xd521749d, 0x7258470a, 0x0231a4f6, 0x7a1f5fd2, 0x2d23f58e,
+    0xe4183885, 0xcc944273, 0x1677308e, 0xaa4315f2, 0x493c43e8, 0x911dddc5,
+    0x5c197d55, 0xde68f464, 0x7eaa7662, 0x95a54877, 0x472092c7, 0xfdb596ef,
+    0xff4fd14d, 0x1cc92700, 0x911cc991, 0xc9911cc9, 0xc716a610, 0x6ecc8d84,
+    0x4596aace, 0xb339d11f, 0xf3a3af45, 0xf0f54d4c, 0xebcba896, 0x97b6a7ba,
+    0x91dcf918, 0xc9911cc9, 0x1cc9911c, 0xcc370d91, 0xdeee6069, 0x2f9a00ff,
+    0x8eb7cf65, 0x8c7d6ff6, 0x252adf84, 0x89901cc9, 0x532b899d, 0xbee41993,
+    0x4a7e6328, 0x447264e0, 0xa7f0ae4d, 0xa3896eb4, 0xa5a74552, 0x36f6b26b,
+    0xd803e636, 0xdad6239e, 0xea223b66, 0x2456192a, 0x911e5f6c, 0x88772336,
+    0x0c449338, 0x09696ecf, 0xdc527e61, 0x0df57574, 0x776ee2ab, 0xc9711f3e,
+    0xa288e48e, 0x64a2e49a, 0x73854b65, 0xf91a3cc7, 0x6daa9204, 0x9b1cc592,
+    0x4be168f3, 0x0a59cb90, 0xc85cca21, 0x28732572, 0xa69f8bf9, 0xc6716591,
+    0xf14c8909, 0xa4eab418, 0x63ce1349, 0xb2e31ec9, 0x1263eb16, 0x03ab9837,
+    0x099339d2, 0xcc396672, 0xd9a7e67e, 0x6d945373, 0xbd1863e2, 0xed98939e,
+    0xe38b49d2, 0x3c07f93a, 0x32bfaa69, 0x47f5d56e, 0xdfb5b575, 0x9cc3399c,
+    0x399cc339, 0x2c2b9cc3, 0x179a4786, 0x7127313c, 0x9e8e776d, 0x82f65742,
+    0xcb562297, 0x23536423, 0xa9599761, 0xee244baa, 0x700ee770, 0xe7700ee7,
+    0xa3d3700e, 0x0eb6e6fc, 0xa2f9efed, 0x78fb5cf6, 0xd9f766ef, 0x61f20d4d,
+    0x05cee1dc, 0x8f3d5f37, 0xc98674b1, 0xd2de0601, 0x6ac5c7a8, 0xacf7ce23,
+    0x73cbe448, 0xfe28a684, 0x647b81f0, 0x2c7b476e, 0x3139210a, 0x875350f6,
+    0xc489f519, 0xae3751c5, 0xdda9454b, 0x8e62cd8f, 0x9ec79449, 0x2e32ad9d,
+    0xb4115df4, 0x99725426, 0x2b62e124, 0x0de15c65, 0x2856be59, 0x559a2399,
+    0x2b9496f0, 0x898136b1, 0xa04d0cb4, 0x13036d62, 0x409b1868, 0x2b6a9ac4,
+    0x71a56a11, 0xb4898136, 0x11a04d0c, 0x7b4c6c1a, 0x75472a93, 0xc4409bf8,
+    0xd02606da, 0x89813631, 0xa04d0cb4, 0x23026d62, 0x208d6d17, 0xbe8bfbb2,
+    0x72b5036b, 0x60d819ac, 0x7606c3ce, 0xc1b03318, 0xec0c869d, 0x83616730,
+    0xd8190c3b, 0x06c3ce60, 0xb0331876, 0x4694a68d, 0xca34916d, 0x33380e65,
+    0x869dc1b0, 0x6730ec0c, 0x0c3b8361, 0x0459d819, 0xd6e6ba74, 0x8ccda102,
+    0xf3d7db3d, 0xf6b9ec45, 0x00ffdaf1, 0xfeaf7be3, 0xefd43627, 0xea74e3b1,
+    0x9fde5d78, 0xf274c54f, 0xece9517b, 0x3d797af8, 0x7af2f4f0, 0x8a9e3b3d,
+    0xa3f6e4e9, 0xf4f0d9d3, 0x3d3d7cf6, 0x274f0f9f, 0x3e13b6a1, 0x877a716e,
+    0x3d1e9ecf, 0x4f8f9e3c, 0xd9d3a327, 0x78eef4f0, 0x8f9e3c3d, 0xd3c3674f,
+    0x4186f8e9, 0x82cbe35c, 0xf755f22e, 0xa714cd4f, 0x7b2900ff, 0x4a07b22d,
+    0x36d79035, 0x637e594c, 0xe2a919f3, 0x4ead84ef, 0xeb9a6bbd, 0x0f3b9fe2,
+    0xfe51e3d8, 0xb6b1f999, 0xa15cb9b4, 0x7622d191, 0x5beb94c6, 0x566b696c,
+    0xe21c8adc, 0x28d26a71, 0x94a6a440, 0x3697c7f7, 0x70ccf434, 0xd8dcd8f3,
+    0x1ed3402f, 0x9aee4c61, 0x9ac9acc4, 0x67a3b056, 0x79bd44a7, 0x00ff9dbf,
+    0xb6f549c2, 0xf9ebed1e, 0xfb5cf6a2, 0xf768f778, 0xb9fdbad9, 0xc1b2d1b2,
+    0xc1b2c1b2, 0xc1b2c1b2, 0x4715d148, 0x16ac3372, 0x39be8cc7, 0x65513d7c,
+    0x84246bad, 0xbc0846b6, 0x0a05d1e4, 0x8ae1989d, 0x60a5131f, 0xcb2e5335,
+    0xcb06cb06, 0xcb06cb06, 0x2703cb06, 0x5d8487f8, 0xeb83a4e4, 0x389ee328,
+    0xe3398ee7, 0x9ee3788e, 0xc586e738, 0xb51eb707, 0xf9f661c1, 0xde9b9cae,
+    0x786df30b, 0x3f1a575b, 0xa8c6eaab, 0x1c4f6b52, 0x713cc7f1, 0xc7731ccf,
+    0x3cc7f11c, 0x760ccf71, 0x6a206cdd, 0x363fd33f, 0xd968cdc5, 0x151b5e9d,
+    0x25ae35b0, 0x1a5e7b1a, 0x93ab2450, 0x460f643a, 0x5562e212, 0xeece14a4,
+    0xd242d9e8, 0x9eda36bf, 0xeedef642, 0xf6922485, 0x23ab2ea4, 0x7caf058e,
+    0x5c6bf542, 0x51b1ad85, 0x3ff352b7, 0x8400ff2b, 0x5d6ceb93, 0x8bb8cfdb,
+    0xe3ed73d9, 0x66d7a3dd, 0xcde7f6eb, 0xc7f4d76d, 0xd1355249, 0x590ad598,
+    0x0e693d1e, 0x18341728, 0xebd191da, 0xa57399a6, 0xac154613, 0xe7c9ad21,
+    0xe6b38d8a, 0x2240fb65, 0xd99224ef, 0x69167942, 0xb4a4192d, 0x9ad19266,
+    0x2d69464b, 0x47f36408, 0x738f8f15, 0xf2549706, 0xe795d239, 0xebb8c93e,
+    0xe8c8a55c, 0x945cc6ad, 0xa5d87418, 0x8eca3885, 0xa896af16, 0x464b9a49,
+    0xa4192d69, 0xd19266b4, 0x69464b9a, 0x96cb0d2d, 0xa306c438, 0xa5e533fd,
+    0x8d42512b, 0x1eb737b8, 0xbe6c65e4, 0x513336da, 0xf5116d79, 0x4710cb2e,
+    0x5f343895, 0x7c99a71d, 0x7355867a, 0xf98aa925, 0x4f12fe6f, 0x6f77b1ad,
+    0x652fe23e, 0x768fb7cf, 0x8b9a5d8f, 0xc5cdde51, 0x242c8e84, 0x8b236171,
+    0x48581c09, 0x1247c2e2, 0x91b03810, 0x240e84c4, 0x14217120, 0xe248481c,
+    0x10120742, 0xc5819038, 0x242c8e84, 0x8b236171, 0x48581c09, 0x2b42c2e2,
+    0x081a5951, 0xdd57c9bb, 0xe4322b3f, 0x48aa6848, 0x6f373786, 0xad644772,
+    0xb1bd32b6, 0x27c5c6ad, 0xa85a3837, 0x961b12d4, 0x3dbd5d52, 0xbd7769b5,
+    0x0f335f61, 0xfe51e3d8, 0x0ec6f299, 0x7c339724, 0xc5898cde, 0x58215716,
+    0x49e3e855, 0xeba82488, 0x52394e87, 0x6ee964c6, 0xc9e15d5c, 0x0e2ef5ec,
+    0x9f0db9ea, 0xc200ff2d, 0x2eb6f549, 0x45dce7e9, 0xf1f6b9ec, 0xb3ebd5fe,
+    0x2770fb75, 0x07c6a6b0, 0x20d56206, 0xcd5928c7, 0xbed042b1, 0xa1a68c2d,
+    0x5ad2c4c4, 0xf34844de, 0x588a2cdc, 0x71426360, 0xd5a85544, 0x6a3536f4,
+    0xdd8b0a43, 0x11585a7d, 0x82d824a7, 0xccdae8a2, 0x5c992c81, 0x62658e47,
+    0x47b1d61b, 0xf748ad12, 0x939fe81f, 0x1701da27, 0x17362379, 0x049d0f49,
+    0x7910741e, 0x41e741d0, 0x1e049d07, 0xd0791074, 0x70145e40, 0x8b53342d,
+    0x54c2c0e6, 0xdbb725b1, 0x9b6f5f84, 0x10741e03, 0xe741d079, 0x049d0741,
+    0x7910741e, 0x41e741d0, 0xbaa01a02, 0x97582522, 0x1f2afd4a, 0xa8f443a5,
+    0xfd48e978, 0x42a51f29, 0x5a649ac5, 0xfaa1d25f, 0x874a3f54, 0xd2f150e9,
+    0x3f54fa91, 0x50e9874a, 0xa51f2afd, 0x7ea8f443, 0xa1d20f95, 0x47ab4a5f,
+    0x562d0595, 0x7b3cddc7, 0x3e97bd88, 0xbdda3fde, 0x7b459576, 0xbcec0ba2,
+    0x539ddbab, 0x4ac29192, 0x658aa2ca, 0x6c6aaa2d, 0x9563b5bd, 0xe168a2b2,
+    0x1a755359, 0x12b697cb, 0x39810ca5, 0x24b95068, 0x81a08e2c, 0x0a897233,
+    0x27db0a07, 0xe4827247, 0x4916fce8, 0x1b35aa92, 0x4a5f69d9, 0xe1ad1491,
+    0x3b1b816c, 0x845612c9, 0x0424dd88, 0x2ba56b2b, 0x39a25375, 0xef228ca9,
+    0xfc745f25, 0xda86e5f1, 0xf93f4dda, 0xb2b6b115, 0x480d8962, 0x938b1b4b,
+    0xe8ca5983, 0x76feaa65, 0xa5c6b11f, 0x36f2337d, 0x9c4371db, 0x3d34b6d6,
+    0xa7686c97, 0xa74a6c33, 0xadd412a7, 0x4e19790c, 0x672d2ccf, 0x421451a9,
+    0x4da8b8de, 0x9580316e, 0x632c35c5, 0xb87ae654, 0xdec256c2, 0x9ab5a462,
+    0x95221fe1, 0xdc58d0c3, 0xbed83c8a, 0x3b347987, 0xece9bbf2, 0xb8c7d37d,
+    0xed73d98b, 0x9e573bd8, 0xb5ad95d2, 0x478be43c, 0x863cc690, 0x8f31e431,
+    0x0c798c21, 0x1e63c863, 0x18f21843, 0x3cc690c7, 0x31e43186, 0x798c218f,
+    0x63c8630c, 0xf218431e, 0x881d8718, 0xc8630c79, 0x44cd0963, 0xbaaeeb8a,
+    0xf22e82fb, 0x48e41143, 0x8c85b130, 0x0b63612c, 0xc2c25818, 0xe9a8c148,
+    0x11bb4a63, 0x6c448161, 0x35d228e5, 0xf04d4a29, 0x0bbf8cdb, 0xc6c25818,
+    0x85b13016, 0x43232c8c, 0x7462a2d3, 0xd7eaeecc, 0x1fc6ca87, 0xdfd8092b,
+    0xb746d9e8, 0x54a3a7ca, 0x4cae45b1, 0x0b250713, 0x33174d91, 0x0edb7279,
+    0xd43ab93c, 0x4fa45a69, 0x902315aa, 0x044b52a8, 0x15ea96b8, 0x742b3130,
+    0x87c8fd69, 0x798edf52, 0x5b572e3f, 0xa26c978e, 0x61054929, 0xca87b1f2,
+    0x0a2b1fc6, 0x563a3509, 0xdddfe94e, 0xf6b9ec45, 0xcfab1dec, 0x5d84fd69,
+    0x9feeabe4, 0xb852259d, 0xcfc5bab5, 0xb6b46f68, 0xf3d8b6f6, 0x82830353,
+    0x3175da48, 0xd189d487, 0x7ed8f9ac, 0x79881ac7, 0x56f3b6c4, 0x1bc16a0e,
+    0xaec8a950, 0xa2d0e988, 0x9b4a2194, 0xaaeedd18, 0x94936776, 0xc4556a2b,
+    0xaaf6812d, 0x5250a550, 0xbb571bca, 0x387863cb, 0x2a7d1c1d, 0x696f4ce5,
+    0xdd8525cc, 0xbab3e555, 0xaaa31c1c, 0x3726acd2, 0xd4c53622, 0x6aee865c,
+    0x2f58cdc1, 0xc9406ead, 0xa8fb3bdd, 0xdd3e97bd, 0xed79b587, 0x4d31a753,
+    0x8315abf5, 0x8f6f7c7c, 0xbef1f18d, 0xc6c7373e, 0x1fdff8f8, 0x7ce3e31b,
+    0x8d8f6f7c, 0x3ebef1f1, 0xf8c6c737, 0x1b1fdff8, 0x7c7ce3e3, 0xf18d8f6f,
+    0x0e3ebef1, 0x4538b543, 0xb7ee4ade, 0xdd68dd29, 0xdd68dd68, 0xdd68dd68,
+    0x7368dd68, 0x9d3d6374, 0xe8ea54c2, 0x2bedb590, 0xed4a951b, 0xc5940b29,
+    0x9d49d72d, 0xb79ddd5b, 0x375a375a, 0x375a375a, 0x375a375a, 0xcc7f185a,
+    0x730a6a18, 0x4dfe3014, 0xd7cd6c4e, 0x351d0f65, 0xacade123, 0xe74632af,
+    0x1a4bc414, 0x42ba5a2c, 0x9ddee4d0, 0x8c1b3241, 0xf2534a75, 0xd1766627,
+    0xb4531bd7, 0xa5447fa1, 0x5686d7e0, 0xede42b77, 0x23b936dc, 0x8fae3452,
+    0x2d362fac, 0x70712693, 0xf094bb91, 0xcccbb268, 0x243759bd, 0x76b997b1,
+    0x2e7b51f7, 0x6a0fbb7d, 0x0fc9daf3, 0x20171bb9, 0x47244772, 0x737fefdb,
+    0x33d18c71, 0x298ffe7f, 0x417ba9d5, 0x376918a6, 0xafd34635, 0x5c667a68,
+    0x2adab6cc, 0x8b6df4be, 0x3aefb556, 0xca3f6e85, 0xc6e48ab1, 0xfb36ced3,
+    0x18ca382f, 0xc95f8569, 0x10c8911c, 0xdc5586c5, 0x3324ef22, 0x074962d9,
+    0xd720b3a8, 0x5cad953a, 0xdaf254a2, 0x51e2bda5, 0x5cd9b657, 0xca14eb84,
+    0xa6d88424, 0x4c9dfa62, 0xd850cf89, 0x3035caae, 0x826a9129, 0xeabdd022,
+    0xc9d4db6a, 0xba45e425, 0x7ab79c9c, 0xe4cde5ca, 0x989331db, 0xecc954f0,
+    0xa5df2ba4, 0x2f45f2ed, 0x7ae68452, 0xa21e328b, 0x254782cc, 0x4130f1ae,
+    0x44872af4, 0x885f66e2, 0x16218645, 0x62588418, 0x45886111, 0x18162186,
+    0x145b5884, 0x0831588d, 0xc322c4b0, 0x460c8b10, 0xc588412d, 0xb00831aa,
+    0x10c322c4, 0x2c420c8b, 0xc4b00831, 0xb5a9c122, 0xd6ca8885, 0xba9755b7,
+    0x7b51f776, 0x0fbb7d2e, 0xcfdaf16a, 0x395af24e, 0xcdd11cb4, 0xcda7621a,
+    0xba373197, 0x00ff3531, 0xa8ce4eea, 0x9aeff5e7, 0x02c1a38c, 0x5a645637,
+    0x3d33c57a, 0x59f7f6ce, 0xcb85b131, 0xdd999255, 0xb8338545, 0x88b6291f,
+    0xad951d9c, 0x4f20556f, 0x2974701d, 0x5d47dd8e, 0x47739453, 0x20687334,
+    0x48c97c2a, 0xbe4ade45, 0xa5ae09e9, 0xdc9c57aa, 0xa4f7a8f2, 0x4aeda64a,
+    0xb816dcd0, 0xabf53623, 0xe1354ddd, 0xb52bb3e1, 0xe90e09ed, 0xb316915d,
+    0xd9f337ab, 0xbd51b4d7, 0x813efa73, 0x42865420, 0x11b5c587, 0x851cbfb7,
+    0xa2328994, 0xd2b9d65d, 0x87c90fe6, 0x32ec7fec, 0xeabe2ef7, 0xb7cf652f,
+    0x3b9eed61, 0x8e05c259, 0x6da3fed1, 0x1d6cd42b, 0xf591c042, 0xa5cb794b,
+    0x5276ae4e, 0x0b42f55e, 0x45953c97, 0x14ee4592, 0xe945f5b9, 0x96507d48,
+    0x166732c4, 0xbd4a92c0, 0x1749d705, 0x779286de, 0x5c22221a, 0x72a494f0,
+    0x6bf13687, 0x52c892f2, 0xea68a5fc, 0x60a10e16, 0x308d36ea, 0xf0725d6d,
+    0x7d95bc8b, 0x4aa6f2d3, 0x196bc37a, 0x189bb077, 0xc6262f1c, 0x3cc90b07,
+    0x6b9a939b, 0x4e09811b, 0x866b198f, 0xaca7aa3a, 0xe7935865, 0xf21ffb61,
+    0x44d1c894, 0x86ba6358, 0x0e7620df, 0x35b424ae, 0xf49039b4, 0x6e16fdd5,
+    0x45ddd7e5, 0xecf6b9ec, 0x6bc7b33d, 0x53d9fa1c, 0xce0b5599, 0x943a23a5,
+    0x3352ea8c, 0x707a48a9, 0x744fa095, 0xae9a5ac6, 0xc844a792, 0x94a8f7ea,
+    0x43bde734, 0xfda7524e, 0xef4d4240, 0xe85d82da, 0x1a46669e, 0xa7a2d673,
+    0x41edc730, 0xf30ed424, 0x250b04c7, 0x9df18613, 0x2975464a, 0x67a4d419,
+    0x76169172, 0x048e7872, 0xeeabe45d, 0xda92959f, 0xc839e974, 0xa6a261c9,
+    0x545462eb, 0xdb486cdd, 0x0ec230ca, 0x8a066258, 0x3b72e0de, 0xbba6318a,
+    0x61e6334f, 0xd6f21ffb, 0xcc79f9cf, 0xa3494d0e, 0x38b4154b, 0x378623b6,
+    0xd1fd74c7, 0xe2f80642, 0x19cb4cc5, 0xe599c792, 0xa4cf4fda, 0xddccfd97,
+    0x8bbaafcb, 0xd8ed73d9, 0xd68e67bb, 0x3fbbf537, 0xaedae687, 0x55fdf5d6,
+    0x8a656db5, 0xd1393993, 0x118a715b, 0x4c20b7b8, 0xa415c999, 0xd04e293a,
+    0x24aa6bef, 0xe97511cf, 0x70692a93, 0xd642a24c, 0xe93d13b1, 0xc744a014,
+    0xe4885026, 0xed13249f, 0x2cfc8f50, 0xc8055b91, 0xd9e86976, 0x9e66a3a7,
+    0x367a9a8d, 0xaa44e869, 0xbea48a00, 0xc752d346, 0x5877f1f8, 0x2e1e00ff,
+    0x2c834eaa, 0xeec0b73a, 0x41844329, 0x4439a659, 0x9c6b578d, 0x3dcd7627,
+    0x6cf4341b, 0x4fb3d1d3, 0x1b3dcd46, 0xe921f434, 0xb9e49fb8, 0xb5341702,
+    0xdf94aa28, 0x5e348e1a, 0x401c3592, 0xf164425f, 0x80c6282e, 0xde98be88,
+    0x8d8dfac8, 0xfb5fb991, 0x5f97bb99, 0xe7b21775, 0xcff6b1db, 0xfc73b41d,
+    0x19ba5a3d, 0x1c0c9db7, 0x43e760e8, 0x39183a07, 0x86cec1d0, 0x7330740e,
+    0x0c9d83a1, 0xab62de0a, 0x83a173d4, 0x5e090c9d, 0xd5548822, 0xf3ea3a7c,
+    0x0c9d83a1, 0xe760e81c, 0x183a0743, 0x19c1d039, 0xd0e8a43d, 0xbe4add49,
+    0x84aafce9, 0xda98788c, 0x66760253, 0xd1df09d5, 0x4cbadc12, 0x964a5bce,
+    0x9fc3ba98, 0x8c1b4753, 0xa22e2e72, 0xda9348c1, 0x46e36b85, 0xa28185d8,
+    0xb0d724d7, 0xe3d2b4dc, 0x445ee68e, 0x8c45d979, 0x911493f1, 0xc9fec7f9,
+    0xd8569cfc, 0x940fdfda, 0xc3c799a3, 0xb705eeb5, 0xd071b95c, 0x74e45edb,
+    0xa2b9967a, 0x4ea98971, 0xe8525877, 0xab5547e3, 0xe5ee296e, 0xe55ab78e,
+    0x5b6e7f21, 0x584c996c, 0x159947a7, 0x9e9f998a, 0xe9b5ac43, 0x5af80ace,
+    0x14c45193, 0x6f602b38, 0x4be77274, 0x5d091c1e, 0x4aa15a1d, 0xbadccf60,
+    0x97bda87b, 0xb68fdd3e, 0xbfa3ed77, 0x7ff8b35a, 0xc0f60d52, 0xbe4add49,
+    0x1e91fce9, 0xeb294b8d, 0x5a2ad799, 0x95ecdcf2, 0x87755afd, 0xe29057c9,
+    0x388a44fa, 0x9a5fa54b, 0xd5bdbdad, 0xa5920719, 0x634fd2bd, 0x6a0c7dcb,
+    0xa1546ce0, 0xb241f30b, 0x6c1bd796, 0x6951a694, 0x7ce6cc0e, 0xb200ff91,
+    0xb5d63a7f, 0x97b6affc, 0x8f2464d8, 0x437ac82c, 0x94b63c95, 0xcdecd6f8,
+    0xd8f1a563, 0x0af31139, 0x87a7206a, 0xad1c0744, 0xb502794c, 0x569b4147,
+    0x5ad2d8d2, 0x8e14ba26, 0xb486cbe2, 0x00ffc890, 0x9942b619, 0xc734471a,
+    0x4ca48a27, 0x8e0aede2, 0xdcc25cbd, 0xcf507a73, 0xa8fbb9dc, 0xdd3e97bd,
+    0xed77b68f, 0xb35abfa3, 0x47857cf8, 0x8d0a9c15, 0x63c8cbd4, 0x26d5e23a,
+    0x7687123d, 0x75a38c35, 0x9003ea06, 0x1a0f4a9a, 0x41b94b02, 0x33ca53c6,
+    0x1b2c9fc6, 0xba9380ed, 0xcab65296, 0x35d636bf, 0xdc90764e, 0x1aef8672,
+    0x719a9302, 0x472fc607, 0xb7a7c46a, 0x0300ffaa, 0x474e2da8, 0x616d3c8d,
+    0x30d24251, 0x8c65392d, 0xb0e66dbe, 0x239fb22a, 0x47482b05, 0x973b1af6,
+    0xb217753f, 0x76b2dbe7, 0x52b3ddee, 0x3db9528b, 0xefce9ab6, 0x9e3339f2,
+    0xe69aecee, 0x1b5ddddb, 0xb7129d1d, 0x4aae96b3, 0x8c4c6391, 0x946a32c2,
+    0x9d94aa9b, 0x65aa483d, 0x90084eae, 0x707ab1a5, 0xcbe75677, 0xbf322a57,
+    0xe8354d24, 0x1af623e2, 0x3ee5df8e, 0xe05f6cfe, 0xf596cac8, 0x7d4ca96d,
+    0xb55a5ab0, 0xc313c901, 0xcd2347fb, 0xc8499816, 0xceed281f, 0x09e52c71,
+    0xeb7beb1c, 0x1289777b, 0x5eeef226, 0x42d8dac6, 0xdf7e7a07, 0x655e9695,
+    0x62a326f7, 0x7734ec1f, 0x2ff25e0e, 0x64b7cf65, 0xdc2ddded, 0xa3313e94,
+    0x115b2794, 0xd1df3793, 0x784707de, 0x74e01d1d, 0xddd17177, 0x1d7747c7,
+    0x7774dc1d, 0xc7ddd171, 0x1d1d7747, 0x717774dc, 0x47c7ddd1, 0xdc1d1d77,
+    0xd1817774, 0x6f8c05de, 0xa7cddc66, 0x4ac5fcea, 0x57fe3739, 0x0bc58194,
+    0xa4bf9e96, 0xd9bd3117, 0x38f08c5e, 0xe86f958f, 0x3ca303cf, 0x3af08c0e,
+    0xcfe8c033, 0x0e3ca303, 0x333af08c, 0x03cfe8c0, 0x8c0e3ca3, 0x7ca311f0,
+    0xc0333a44, 0x1401cfe8, 0x74e14e46, 0x2f92327a, 0x57b7d65a, 0xd7160dfb,
+    0x91f772ce, 0xbb7d2e7b, 0x93e5844a, 0xa26e6855, 0xe026499b, 0xe969c54a,
+    0x55075dd5, 0xd0551d74, 0xd5415775, 0x7455075d, 0x75d0551d, 0x5dd54157,
+    0x1d745507, 0x5775d055, 0x075dd541, 0x551d7455, 0x415775d0, 0x5d055dd5,
+    0x5a2bea1c, 0xcb925fdd, 0xaaee2eef, 0xa0ab3ae8, 0xaa83aeea, 0xe8aa0eba,
+    0xeaa0ab3a, 0xbaaa83ae, 0x3ae8aa0e, 0xaeeaa0ab, 0x0ebaaa83, 0xab3ae8aa,
+    0x83aeeaa0, 0xaa0ebaaa, 0xb1580ee8, 0x4db33f45, 0x8829bdb5, 0xf2b41453,
+    0xd98b500d, 0x629b5750, 0x9b2781d8, 0x9b30d884, 0xc2581206, 0x6349184b,
+    0x25612c09, 0x84b1248c, 0xc6923096, 0x4bc25812, 0x09634918, 0x8c25612c,
+    0x9684b124, 0x12c69230, 0x184bc258, 0x2c096349, 0x248c2561, 0x309684b1,
+    0x5812c692, 0x49184bc2, 0x612c0963, 0xb1248c25, 0x92309684, 0xc25812c6,
+    0x6349184b, 0x25612c09, 0x84b1248c, 0xc6923096, 0x4bc25812, 0x09634918,
+    0x8c25612c, 0x9684b124, 0x12c69230, 0x184bc258, 0x2c096349, 0x248c2561,
+    0x309684b1, 0x5812c692, 0x49184bc2, 0x612c0963, 0xb1248c25, 0x92309684,
+    0xc25812c6, 0x6349184b, 0x25612c09, 0x84c1268c, 0x64621bd8, 0x369b38a5,
+    0x36283c5a, 0xdba06dd0, 0x6d83b641, 0xb40dda06, 0xd036681b, 0x41dba06d,
+    0x066d83b6, 0x1bb40dda, 0x6dd03668, 0xb641dba0, 0xda066d83, 0x681bb40d,
+    0xa06dd036, 0x83b641db, 0x0dda066d, 0x36681bb4, 0xdba06dd0, 0x6d83b641,
+    0xb40dda06, 0xd036681b, 0x41dba06d, 0x066d83b6, 0x1bb40dda, 0x6dd03668,
+    0xb641dba0, 0xda066d83, 0x681bb40d, 0xa06dd036, 0x83b641db, 0x0dda066d,
+    0x36681bb4, 0xdba06dd0, 0x6d83b641, 0xb40dda06, 0xd036681b, 0xfff25378,
+    0x116c00c4, 0x02030100, 0x0c040303, 0x080c0608, 0x000b060a, 0x04030102,
+    0x11000605, 0x14130712, 0xd5552118, 0x22171615, 0x61565131, 0xd2959493,
+    0x96714132, 0xe1d4d3a1, 0x53231008, 0x24209154, 0x50423733, 0xb5b4b162,
+    0x3430f0e4, 0x74734036, 0x26258175, 0x80725245, 0xd1c1b2a5, 0x90634335,
+    0x6544d692, 0x83827670, 0xc3c2a4a3, 0x00dafff1, 0x01030108, 0xff013f01,
+    0xa32dac00, 0xfae24bb3, 0xbdc576d6, 0xb319a132, 0x16a8dd56, 0xb73525ee,
+    0x7c934a13, 0x3166b37c, 0x464208bc, 0xe2e326c3, 0x64ad2424, 0x821faa48,
+    0x50c8d5de, 0xb5093596, 0xb24eefe7, 0xe39f933a, 0x9fc71cd1, 0x831799c2,
+    0x92e392c3, 0x337fd5ce, 0xfb63fb6f, 0xed2c392e, 0xff36f357, 0xb23fb600,
+    0xd5ce92e3, 0xfb6f337f, 0x392efb63, 0xf357ed2c, 0xb600ff36, 0x92e3b23f,
+    0x337fd5ce, 0xfb63fb6f, 0xed2c392e, 0xff36f357, 0xb23fb600, 0xd5ce92e3,
+    0xfb6f337f, 0x392efb63, 0xf357ed2c, 0xb600ff36, 0x92e3b23f, 0x337fd5ce,
+    0xfb63fb6f, 0xed2c392e, 0xff36f357, 0xb23fb600, 0xd5ce92e3, 0xfb6f337f,
+    0x392efb63, 0xf357ed2c, 0xb600ff36, 0x92e3b23f, 0x337fd5ce, 0xfb63fb6f,
+    0xed2c392e, 0xff36f357, 0xb23fb600, 0xd5ce92e3, 0xfb6f337f, 0x392efb63,
+    0xf357ed2c, 0xb600ff36, 0x92e3b23f, 0x337fd5ce, 0xfb63fb6f, 0xed2c392e,
+    0x0f34f35b, 0xc5657f6c, 0xa7ddb0cd, 0xa81d915a, 0xe4a7ad54, 0xdf546040,
+    0x9a794997, 0x150147a0, 0xa2f67133, 0x9665ca99, 0x909d1485, 0x693bd271,
+    0xf18f6ece, 0x862dcec6, 0xd9e62b6f, 0xb799a4b6, 0x6d53a912, 0xa0daa4b9,
+    0x0eb0c0bb, 0x9a2c9a4b, 0x91f380e6, 0x380dbc63, 0x100e48a8, 0x42cb839e,
+    0x28b069d3, 0x29d322f0, 0x4f831871, 0x8b47c884, 0xd3683312, 0xde09322c,
+    0xb2fe0080, 0x948ccc55, 0x9588d48c, 0xc2135555, 0xe52a9fa8, 0x721e2185,
+    0x51954f54, 0xf0058630, 0x24e45748, 0xe722215c, 0xe1e5a292, 0xe5cb73c9,
+    0x1a84dac4, 0xaa13596c, 0x87422313, 0x5476b511, 0xc3b64fa9, 0xe14fdb11,
+    0x2084ebbc, 0xc939f8d8, 0x44543553, 0x6e515ce7, 0xa478456a, 0x61d901b5,
+    0xa4e81e26, 0xea52aac0, 0x2d9b2ab4, 0x9287ab3f, 0x2adcba54, 0x9083437d,
+    0xe671eba0, 0xfb8a65a4, 0xa76549ac, 0x83cfd88d, 0x09bfe17f, 0x6a952ecb,
+    0x512711df, 0x2d0ab5a3, 0x8b2a4fcb, 0x6d0498f0, 0xc80caa86, 0xcb3a2526,
+    0x12349063, 0x9b785951, 0xd5474104, 0x34dd4fe3, 0x88352b8e, 0xca5c0a14,
+    0xc4ed51c5, 0xaf2b2d18, 0xf0a296b9, 0x8f6d83a0, 0xc275dd84, 0x396d9a16,
+    0x4f11c3cd, 0x12fe250e, 0xc0180f00, 0x1d911cb4, 0x971d5009, 0x108f185a,
+    0xcb44cce7, 0x0aa2c954, 0x7ea7cfa9, 0x5c337859, 0xe4939372, 0x0f395f4b,
+    0x4eca31a8, 0x7c2d914f, 0xc7a03ee4, 0x443e3929, 0xfa90f3b5, 0xe4a41c83,
+    0xced712f9, 0x720cea43, 0x4be49393, 0xa80f395f, 0x4f4eca31, 0xe47c2d91,
+    0x29c7a03e, 0xb5443e39, 0x83fa90f3, 0xf9e4a41c, 0x43ced712, 0x93720cea,
+    0x5f4be493, 0x31a80f39, 0x914f4eca, 0x3ee47c2d, 0x3929c7a0, 0xf3b5443e,
+    0x1c83fa90, 0x12f9e4a4, 0xea43ced7, 0x9393720c, 0x395f4be4, 0xca31a80f,
+    0x2d914f4e, 0xa03ee47c, 0x3e3929c7, 0x90f3b544, 0xa41c83fa, 0xd712f9e4,
+    0x0cea43ce, 0xe4939372, 0x0f395f4b, 0x4eca31a8, 0x7c2d914f, 0xc7a03ee4,
+    0x443e3929, 0xfa90f3b5, 0xe4a41c83, 0xced712f9, 0x581cea43, 0x5fa3541b,
+    0x8c20ec66, 0xc3ae2afd, 0x9040f96a, 0x302f3ce0, 0xc54e222a, 0xd41b0892,
+    0x8077486d, 0x66e0346d, 0x3587a48b, 0x691b5f4c, 0x1735daa3, 0xefe9f068,
+    0xb2516a57, 0x90dc8249, 0x842b0e87, 0x4ac16808, 0xbe91a456, 0x06bd4928,
+    0xb36821d8, 0x9be83d03, 0x4f4eca63, 0xe47c2d91, 0x29c7a03e, 0xb5443e39,
+    0x83fa90f3, 0xf9e4a41c, 0x43ced712, 0x93720cea, 0x5f4be493, 0x31a80f39,
+    0x914f4eca, 0x3ee47c2d, 0x3929c7a0, 0xf3b5443e, 0x1c83fa90, 0x12f9e4a4,
+    0xea43ced7, 0x9393720c, 0x395f4be4, 0xca31a80f, 0x2d914f4e, 0xa03ee47c,
+    0x3e3929c7, 0x90f3b544, 0xa41c83fa, 0xd712f9e4, 0x0cea43ce, 0xe4939372,
+    0x0f395f4b, 0x4eca31a8, 0x7c2d914f, 0xc7a03ee4, 0x443e3929, 0xfa90f3b5,
+    0xe4a41c83, 0xced712f9, 0x720cea43, 0x4be49393, 0xa80f395f, 0x4f4eca31,
+    0xe47c2d91, 0x29c7a03e, 0xb5443e39, 0x83fa90f3, 0xf9e4a41c, 0x43ced712,
+    0x93720cea, 0x5f4be493, 0x30a80f39, 0xe224e1df, 0xb4acef98, 0x8400ff16,
+    0xc71b5c4d, 0x07923f11, 0x7c496445, 0xb8fce0ca, 0x4deaaeb4, 0xb51a49e7,
+    0x8ed0dc24, 0x3e63122b, 0xc9611228, 0x1e261211, 0xf41c2211, 0x91189898,
+    0x42488003, 0xd94f14be, 0xdff7076c, 0x2ad7bfb2, 0x2fb5d41f, 0x6c5ab6c5,
+    0x0b55da8b, 0x201d7067, 0xe23e657a, 0x661366ba, 0x16764ca2, 0xe56d719c,
+    0x6db22c77, 0x0da18efb, 0x5287ccc4, 0xf10cde53, 0xf5b6dc7a, 0x95fdb3c7,
+    0x4c7bd7dc, 0xc56d0af6, 0x33719147, 0x5af2232a, 0x57930607, 0xc32e7362,
+    0x0db2d38e, 0x3781a81b, 0x24926dbb, 0x281d33c9, 0xf63694aa, 0xacbb5775,
+    0x69c686ea, 0xdaf4d366, 0xaabaa1c4, 0x622daab4, 0xde664691, 0x00ff9872,
+    0x3fac4e15, 0xb2282c3a, 0xa17ccca4, 0xa4182e1d, 0xae212189, 0x9ba60529,
+    0x998f2d33, 0xc9db6f51, 0x1b4c73a3, 0x5478a3ca, 0xf45e4219, 0xd78d962a,
+    0x14e41436, 0x9477c853, 0xd33dbdca, 0xb9d70454, 0x2e01fe55, 0xa52e5e2d,
+    0x3a775f78, 0x56482237, 0x665da018, 0xc92456d4, 0x2592297d, 0x7afb54dd,
+    0xb463115b, 0x94d2c7e4, 0xde1a54d3, 0xca4f3bee, 0x41a4040e, 0xc66cf96d,
+    0xd164f668, 0x0c9e263b, 0xe95c2056, 0x1b9f1a48, 0x7e49a25f, 0xa8900575,
+    0xdbf6edd3, 0xfc9ec3a3, 0x6ea99eda, 0x42f5844b, 0xa40a4fa3, 0x2b9019e7,
+    0xe8149054, 0x4f547af5, 0x8600fff0, 0x6745f90f, 0x1faab17f, 0x5bfc5bd3,
+    0x4c3b577e, 0xa012d880, 0x074272bd, 0x1a30e253, 0x12e45975, 0xd33aa2f1,
+    0x4800ff47, 0x7cc37111, 0xc7eeab9f, 0xaf7ef20d, 0xc9371cbb, 0x70ecbefa,
+    0xfbea27df, 0x9f7cc3b1, 0x0dc7eeab, 0xbbaf7ef2, 0xfac9371c, 0xce1eecbe,
+    0x40b32ba9, 0x509519bc, 0x2487ceec, 0x88dd1039, 0x8a15feb4, 0x6090c298,
+    0x484942d2, 0x17addb40, 0xe11db23c, 0x41959667, 0xb066cb4b, 0xb305ea2d,
+    0x69559c32, 0x88bcba75, 0x7741a790, 0x9cb17d87, 0xb92534fd, 0xd0680c1a,
+    0xe2bc955a, 0x6d5b465c, 0xa93864c7, 0xdf4764de, 0xaecf6e62, 0x9d4275ca,
+    0x7e439b4a, 0xe9b2ea3c, 0xc24e34a7, 0x679ae526, 0xdc96b0a9, 0x822e8493,
+    0x761aa726, 0x24366e43, 0xba8898d9, 0xbaec9ada, 0x16111efa, 0x75fb9dd9,
+    0x453e62e3, 0xda28bf0c, 0x51be4538, 0xa511a992, 0x919b8c16, 0xd11d7133,
+    0x683a4dd2, 0xd94c6ae3, 0xcb8a2c37, 0x6934f3d6, 0xa98f5947, 0x2293835f,
+    0x12a288ac, 0x7082e4ba, 0x840a0362, 0x8d2c241a, 0x46db9ac3, 0x107035dc,
+    0x52ba42bb, 0xd1f2dab3, 0x70670d64, 0x9c094652, 0x80235740, 0xc8cc93a9,
+    0xed23d237, 0x4c8824e4, 0x895173c8, 0x24b839b4, 0x2eb15809, 0x490c037a,
+    0x861cd2ab, 0x110189cc, 0xc820e2a2, 0x5be39425, 0x519be3e6, 0x9775c824,
+    0x01f9ae4d, 0x025fdbf6, 0xc544257c, 0xa2508352, 0x549b7ace, 0x8f4ec28d,
+    0x5c1d7fa3, 0x786fe561, 0xe466e002, 0x55651e67, 0x1772c540, 0x8b3c5315,
+    0x704c4522, 0xfbea27df, 0x9f7cc3b1, 0x0dc7eeab, 0xbbaf7ef2, 0xfac9371c,
+    0xdf70ecbe, 0xb1fbea27, 0xab9f7cc3, 0x40c9c6ee, 0xb425dad9, 0x3d75ba40,
+    0xfeb26c50, 0xa11e1510, 0x338daf98, 0x88c47cc9, 0x264c14be, 0xeacd062e,
+    0x17d76df5, 0xa45e9d51, 0xaace4b44, 0x1cde6bbc, 0xea27df70, 0x7cc3b1fb,
+    0xc5eeab9f, 0xd25969af, 0x25f7696d, 0x8ce02ed7, 0xd24d6b11, 0xd3221a9b,
+    0x2bf656d7, 0x521b816f, 0x5a2dc8e0, 0x1723c495, 0x9ad27244, 0xe896cc33,
+    0x7ac5a2b0, 0x76d07edd, 0x5da75aa3, 0x54da8d51, 0xb2c35179, 0x021af3a0,
+    0x0d230f43, 0x12b9d332, 0x61d19b93, 0x096dda96, 0xe21a4c0d, 0xabb3959d,
+    0x054a15be, 0xe6095d22, 0x9df7d427, 0x53e4688f, 0xa08952f7, 0xb96d1c37,
+    0xef6029a3, 0x56221b80, 0x92bd480e, 0xf5ae4d86, 0x55ae7dad, 0x38d41952,
+    0xa482e023, 0xa9917394, 0x5053239d, 0x9d265257, 0x805af3e6, 0xb9d1ebaa,
+    0x9a79cbe6, 0x9b8d61a2, 0xd46552de, 0x48a0c720, 0x1929557a, 0xbf6d835a,
+    0xaf8e244f, 0x6f1a32b2, 0x0ff7927c, 0xb9906c3e, 0xd97547c3, 0x6d888a02,
+    0xa6582e09, 0x5e4d57d8, 0xd4e9d323, 0x8c44a467, 0x1ef298f4, 0xdc47a157,
+    0x7ea4113f, 0x2ab76f4b, 0xad340f4b, 0xaeaaa836, 0xbba42236, 0xbc7752a0,
+    0xa86ccfc6, 0x7c526d37, 0xad89846a, 0x1e53a7c7, 0x505a94a8, 0xfda45ac6,
+    0x10232d04, 0x71145a96, 0x8d003721, 0xe675b74d, 0xbb028a0c, 0xb4fc6abe,
+    0xb6d5da60, 0x49a553e0, 0x3e451a91, 0xa06af124, 0x0a4a8d0c, 0x1dce43c9,
+    0x6d105840, 0x71848624, 0x859c6972, 0xbd6f15c1, 0x596c39de, 0x591429b4,
+    0x53db4557, 0xb1a14e9b, 0x58716938, 0x95cbb2a5, 0x67f28c2a, 0x48c1407c,
+    0x1659e66d, 0x57c34501, 0x11703418, 0x8acad6c4, 0xb5d94711, 0xb6e936b3,
+    0x92ebd361, 0x3c77dba7, 0x48c6842a, 0x7acd841c, 0x4b120317, 0x28a0cc84,
+    0x33feb5ce, 0x96575b1d, 0x126a4203, 0x636b8023, 0x0e9b547c, 0x5b02b8e6,
+    0x99343af4, 0x6dba61f1, 0x6614fab8, 0xbbe65043, 0xd153cab6, 0x08c84bd2,
+    0xde466d8a, 0x50833ab8, 0x2ab4f10e, 0x57719b45, 0x498149a6, 0x2e97caa3,
+    0x9d31ae16, 0x08e1c62d, 0x945b8148, 0xcc8ec3ec, 0x8081b577, 0xf182ebb0,
+    0x05803890, 0x9b343dbb, 0x7c819d00, 0x4e3d6af6, 0x87d6660d, 0x1bd0d811,
+    0x931d5146, 0xa101c925, 0x0af258f0, 0x6d232e53, 0xf3845394, 0x3a1af860,
+    0xe334cfcb, 0xb96c8665, 0xd67daa54, 0xc96cc1dd, 0xa54fa37a, 0x431e99c1,
+    0x0d7a6a15, 0x8c1c2405, 0x4623d4a5, 0x923e21aa, 0xe346b445, 0x145e122b,
+    0x01584d6d, 0x9b3d2331, 0x95c66d5e, 0x5ce9ad30, 0xcbed2834, 0x09b9f090,
+    0xb3ee18c4, 0xa38d0bc4, 0x64e44c72, 0x081cefc2, 0x8f8cf3c2, 0xcd0bc0ee,
+    0x7585458a, 0x421de157, 0x3a93448f, 0x096e6f13, 0x682bcaf6, 0x8bb9f7ae,
+    0x5df62161, 0xdeb1467b, 0x35e0201b, 0xd221bccf, 0xd3285459, 0xd3645329,
+    0xd3702c6a, 0x92b9b9a1, 0xab4e93c2, 0xd242694e, 0xb26e30ae, 0xe60ae95d,
+    0xfe3c84db, 0x7cc3f11c, 0xc7eeab9f, 0xaf7ef20d, 0xaa831fbb, 0xb5773918,
+    0xe86e74a9, 0x00ff202e, 0x60550f05, 0x253e9154, 0xf1454451, 0x047e8ea0,
+    0x015bf6cb, 0xafecf7fd, 0xf587caf5, 0x0ef14b2d, 0xbd69bbcd, 0xf29a1bef,
+    0x8c61528b, 0x4c2b94e9, 0x3a755c20, 0x81448b5b, 0x94cb6419, 0xe2d46f6b,
+    0x54a1e69e, 0x7984e996, 0xa36cbda7, 0x21edf091, 0xb144b989, 0x882c8aae,
+    0x52690614, 0xf6b6dd0e, 0x0a0597ac, 0x4f28b57b, 0x3ad5da92, 0x48e94d4d,
+    0x51c7f97b, 0x5e6dca71, 0xb2baac53, 0xe34a6645, 0xf0c1c641, 0xe392e76d,
+    0xdbf4aab7, 0xda7b83de, 0x93630ab0, 0xbdd75b74, 0x45e28739, 0x2e64e8e3,
+    0x52ce0a14, 0xe96144a4, 0x203909f4, 0x5e7238a9, 0x46e4bea7, 0x12c12653,
+    0x43df61af, 0x0aed386c, 0x23baba9d, 0x98dcd75f, 0x37a05342, 0x6f1700ff,
+    0x9d53ab25, 0x2be90ba8, 0xf3a83b74, 0x8e5b5562, 0x1d31b7ae, 0x45eed086,
+    0xabc540f1, 0xefb74d69, 0xe1a6dcba, 0x69ef7693, 0x93027596, 0xbb8c5d2d,
+    0x937d28e7, 0x8055e66d, 0xad366475, 0x5775f432, 0xdcb6611d, 0x9ad95d53,
+    0x1ffe65a1, 0x00ffc1f0, 0xf6efac28, 0x6bfa4335, 0x4d6e8b7f, 0x684aad6f,
+    0xa538aef8, 0xd66500ff, 0x1c00ff13, 0xa36f3e70, 0xe603c7ee, 0x70ec3efa,
+    0xeea36f3e, 0xfae603c7, 0x3e70ec3e, 0xc7eea36f, 0x3efae603, 0x6f3e70ec,
+    0xaec5eea3, 0xfd1669c4, 0xa9964591, 0xd76956c3, 0xf4fc2d8d, 0x98e49dae,
+    0x15551b73, 0x0c799fcb, 0xfc39f874, 0x83589518, 0x5af5dbc6, 0x4684cd83,
+    0x36708776, 0x340a198f, 0x93446dc3, 0x97f98a4e, 0xe8c8b630, 0xc8d2956c,
+    0x6a785700, 0x39a98482, 0xd54a1556, 0x058fcaa5, 0xd6bb1e87, 0xe4521cab,
+    0xeee6d7a9, 0x73a09991, 0x4131b257, 0xbc91c562, 0x8d8c8cd0, 0x03116ed3,
+    0x215c5a20, 0x95ab569f, 0x5227b4a1, 0x766434a9, 0xe0304df0, 0x661c794a,
+    0x4694fd2e, 0xb61e1263, 0x44014158, 0x24079506, 0xd42a195f, 0x5eae4ef5,
+    0x161568d4, 0xddfad5a9, 0x6c2ada26, 0x2c637db3, 0x8a148781, 0x1994505c,
+    0xb9186e9b, 0x9979a39a, 0xa264918a, 0xbf52aaca, 0xcaacd768, 0x54ede93c,
+    0x0e1d0a6e, 0xe09cece1, 0x8cdc887b, 0xc3e184a6, 0xeff74972, 0xa736d238,
+    0x8a18d993, 0xf2e42889, 0x1a42b367, 0x1d0a75fb, 0x11b24b7a, 0xec2e958a,
+    0xe366f961, 0xddd24ee6, 0xe3366668, 0x0b99128e, 0x4464848c, 0x5e4050cd,
+    0xb13915cd, 0x75eb785e, 0xd358a5aa, 0x89747efc, 0x1a789a01, 0x3f700b37,
+    0x0f7416fe, 0xf9c0b1fb, 0x1cbb8fbe, 0xfbe89b0f, 0xbef9c0b1, 0x0f1cbb8f,
+    0xb1fbe89b, 0x8fbef9c0, 0x9b0f1cbb, 0xb3b1fbe8, 0xf2bb9b18, 0x0cbe3cdc,
+    0x53d5bf89, 0xcc8a09d3, 0x6515eb2c, 0xa854c3cb, 0x2dc7832f, 0x1f3836ef,
+    0x63f7d137, 0x1f7df381, 0xa35a2d76, 0x2acfeeb6, 0x4b8398b2, 0x115de99e,
+    0xf1aae1db, 0x2e5d644a, 0x37376f40, 0xbc05f300, 0xeb01191d, 0x652e33c9,
+    0xdfb516cf, 0x9475b52e, 0x34a8dc8a, 0x9ddf72b3, 0x7694a045, 0x226d4a78,
+    0xebc6e84b, 0x136e2470, 0x7f65d53b, 0x1ecef32a, 0xc5c011bd, 0xab9169a5,
+    0xb6cf4e8d, 0x956b90e9, 0x0b77ea66, 0xf56a5457, 0xce590238, 0x8338147a,
+    0xefabae93, 0xca2d3e22, 0xa5114874, 0x1aa9d21d, 0x1117a50e, 0x54ce5b34,
+    0xd7d6d852, 0xed0ae663, 0x0c115c01, 0x5a6667d2, 0x727e0ca9, 0x8da9ef54,
+    0x4c04659c, 0x22ca7ff8, 0x2a2d360f, 0xb914dc80, 0x77d4304f, 0xd3dd6dea,
+    0x7e59b36b, 0x37d0a8e2, 0x3854ca0c, 0xb6a088d3, 0xcb8e4ef1, 0x59b83140,
+    0x85c9b803, 0xaa834f42, 0xfd38a8e6, 0x4e935a9d, 0x430dc391, 0x735cb368,
+    0x569df2b1, 0xcf7434a4, 0xa2bd28ca, 0x90468f3b, 0xf6bbeff0, 0x3ad45c80,
+    0xb3319983, 0x322d0f58, 0xf4f3dabb, 0xbb9097e8, 0x503da104, 0x91948ad2,
+    0x716b4a74, 0x94e6b6b5, 0x28759374, 0x062db5c1, 0xbc3729d8, 0x3ab5f16c,
+    0x1cd8054d, 0x03683c7d, 0x2db25a59, 0x57df50ca, 0xd84915a7, 0x19c32a60,
+    0x15472a89, 0x2b905d17, 0x6be81db8, 0xd195e231, 0x6e1c0d5a, 0x58b52bdb,
+    0xadc6e172, 0x558eeb52, 0xef9a46a3, 0xc8a1130e, 0xbabdac8a, 0x71530224,
+    0x74cdcc82, 0x2808b61a, 0x5cc1455a, 0x3aad165b, 0x682dbfd5, 0x75c2d4ad,
+    0x1c552159, 0xb4ca36ae, 0x3a4a2171, 0x9669e46c, 0xab271d9e, 0xd3864274,
+    0x47e6bce3, 0xdb9010f3, 0xd5a9d22d, 0x6bb9fd2a, 0x18576db1, 0x3ebb95a4,
+    0xaca3d771, 0x939821e7, 0xdc9403b5, 0xfdb405d7, 0x8630d9b2, 0xca642fa2,
+    0x64216de6, 0xebbea0d9, 0x946f5757, 0x1ea54abb, 0x579d549d, 0xf469cca5,
+    0x297b5096, 0xd168141a, 0xf61dbda6, 0x52767333, 0x71c27118, 0x36312494,
+    0x3919f2cc, 0xd46b1aad, 0x50f9a51a, 0xbb5855ab, 0x68d2a61f, 0x03ad431c,
+    0x11b90a2c, 0x90902365, 0x7b67435b, 0x69f5dc0d, 0x14752542, 0xaf92409e,
+    0x24a54f00, 0x29ad3646, 0x1d3227b9, 0xd6a544c3, 0x719df229, 0x4da3375c,
+    0x7aa38e39, 0x469275cd, 0x451b5655, 0x0c8e2455, 0x368ecfe7, 0x21b0df62,
+    0x3d768ff1, 0x150b4d2c, 0x88143e1f, 0x4ab8cea9, 0x11ddea6c, 0x4a5d11eb,
+    0x4cd4bb3a, 0x06bdc5f2, 0x61855275, 0xb1ad453f, 0x4f6e894c, 0x52f4ba7d,
+    0x5762e49a, 0xc303a95e, 0xa54ca0ad, 0x438fb614, 0xfe903b6d, 0x4b6d44d8,
+    0x1cda4432, 0xcab5774d, 0x8a2a7c79, 0xa000ffaf, 0x0f1c9bcf, 0xb1fbe89b,
+    0x8fbef9c0, 0x63051bbb, 0xcdd3fd72, 0xbfa8a696, 0xf3bfd541, 0x7fc09efd,
+    0xfd2bfb7d, 0x4bfda172, 0x6046fc52, 0x10336ada, 0x9291f014, 0xd7fb270a,
+    0x9a98c024, 0x8a090121, 0x095508f8, 0xe654e417, 0x9ea84afc, 0x44e74415,
+    0xd7b95ce7, 0x55e51399, 0x90337ef0, 0xd7a54bc3, 0xcfb26c9a, 0x72017023,
+    0x2a9167f0, 0x67f3592e, 0x483af38d, 0x15e9adf7, 0xe9588bc8, 0x25e6e615,
+    0x745e24cf, 0x781a5fe6, 0x181000ff, 0x319b9a38, 0x026af031, 0xc2d34c42,
+    0x73aaa299, 0x560f4c60, 0xbad21283, 0xe922494b, 0xe065112f, 0xe3f3325f,
+    0x5b44de7a, 0x5015c8c0, 0x0ae458d7, 0xcf25149e, 0x33cd54bd, 0x8ccac045,
+    0x1832824a, 0x11645e22, 0x5f55b575, 0xbf662132, 0x1f0c3fe0, 0xffce8af2,
+    0x3f546300, 0xaef8b7a6, 0x9eab79cb, 0x6698228b, 0x24a83b8d, 0x54737944,
+    0xee39536a, 0xcc3391c8, 0x73da4808, 0xe1765799, 0x8bc8f728, 0x7669b687,
+    0x5202e132, 0x5445e409, 0x08935817, 0xe14f34db, 0x82836f0e, 0x8d23f18b,
+    0xc7c95fb6, 0xa0b39b73, 0x5f687ae4, 0x9b73c768, 0x7ae4a0b3, 0xc7685f68,
+    0xa0b39b73, 0x5f687ae4, 0x9b73c768, 0x7ae4a0b3, 0xc7685f68, 0xa0b39b73,
+    0x5f687ae4, 0x9b73c768, 0x7ae4a0b3, 0xc7685f68, 0xa0af8b73, 0xfef0e79f,
+    0xff3f1756, 0x73c7b800, 0x9fa0b38b, 0xd1beb0f4, 0x5ff7e68e, 0xe52fb083,
+    0xfbc2dee2, 0x5d9c3b46, 0x00ff047d, 0x567e3237, 0xc67a3217, 0x795d9c3b,
+    0xf227d865, 0x65616ff1, 0xce1d23fd, 0xecb2bc2e, 0xb778f913, 0x91feb2b0,
+    0xed06558a, 0x34aa51a4, 0x7178d6d8, 0x397e10b5, 0x344456d6, 0x2219dc96,
+    0x4510bdd8, 0x7491cc1c, 0xd1ef899a, 0xcdfd5c05, 0x73af2274, 0xe4a0b39b,
+    0x685f687a, 0xb39b73c7, 0x687ae4a0, 0x73c7685f, 0xe4a0b39b, 0x685f687a,
+    0xb39b73c7, 0x687ae4a0, 0x73c7685f, 0xe4a0b39b, 0x685f687a, 0xb39b73c7,
+    0x687ae4a0, 0x73c7685f, 0xe4a0b39b, 0x685f687a, 0x79f6cfc6, 0x0a528f36,
+    0x3b0260dd, 0x87d181f1, 0xd76d5d10, 0x269bc701, 0x958de74d, 0x2ef29336,
+    0xe1000038, 0xcb5235fc, 0x77c54f24, 0x75a8c6ec, 0x230a7549, 0xd72c3603,
+    0xd1b1929c, 0x337e5ae6, 0x47b72e8e, 0x0eb4c1f6, 0x2b29aeb6, 0x445c0d7a,
+    0x54150554, 0x6ecebdd4, 0xe99183ce, 0x1da37da1, 0x83ce6ece, 0x7da1e991,
+    0x2ece1da3, 0x9f600fcf, 0x2f2cfdcf, 0xcdb963b4, 0x3d72d0d9, 0x61b42f34,
+    0xa7757136, 0x7cfa8482, 0x46fbc28e, 0x7e5d9c3b, 0x973fc10e, 0x5e58f787,
+    0xc6f81f1f, 0x6b5d9c3b, 0xbf3ea1e1, 0xb42f6cfe, 0xd9c5b963, 0xf913ece1,
+    0x85a500ff, 0xce2e8cf6, 0xd0f0b52e, 0xd8955f9f, 0x73c7685f, 0x9fa0b38b,
+    0xd1beb0f4, 0xd6c5d985, 0xeb131abe, 0xed0bbbf2, 0x7571ee18, 0x9f6097e5,
+    0x85bdc5cb, 0x2e8cf497, 0xf0b52ece, 0x955f9fd0, 0xc2685fd8, 0x5febe2ec,
+    0xf9f5090d, 0x8cf6855d, 0xf9ba3877, 0xf927e0bf, 0x85951fbc, 0xd87ef2cd,
+    0xaf7b73c7, 0xfef19fa0, 0xe3c30beb, 0xc71800ff, 0xc1af7b73, 0xfff227d8,
+    0xed0b4b00, 0x2ed2a118, 0xcd684c1a, 0x0adcd9c9, 0x4506c8a4, 0xb0f3a406,
+    0x6fc29419, 0x2443e009, 0xd3ca13df, 0xad0744c6, 0xdfd240a2, 0x51f150f0,
+    0xa45a2fb2, 0x741975f9, 0xd74c8a57, 0x8bf290dc, 0xb835c490, 0xe201e9b9,
+    0x64024857, 0xa8aa8a00, 0x2e919922, 0x6ecebd6a, 0xe99183ce, 0x03a37da1,
+    0x89b47bb3, 0x268fb007, 0x2267966b, 0xd4798a08, 0x27224a8a, 0x5c45e2d3,
+    0xda825658, 0x2009f974, 0x4485cac1, 0xb45a72da, 0x0c36adaa, 0xc011a309,
+    0xef5e0795, 0xe511f17a, 0x978b13df, 0x3dfb897a, 0xf6fbfe80, 0x43e5fa57,
+    0xf8a596fa, 0xed2253a6, 0x0d976907, 0x276de312, 0x262d16db, 0xf7ad5180,
+    0x501dfb88, 0x4e6ddcad, 0x944a7594, 0x7a6a5461, 0x231487c2, 0xf55e6242,
+    0x921bce98, 0x351e695a, 0x814d0b73, 0x9dd798b1, 0x96e711c9, 0x2ddd90ce,
+    0x0c9755fa, 0x7d1dd64c, 0xed138af7, 0xabef3752, 0x49ac9971, 0xa3f60791,
+    0xcd69ba43, 0xb20da0eb, 0xb44736c8, 0x738e869b, 0x94f65de1, 0x2d51355a,
+    0x45d7d51a, 0xaae43508, 0x06f6a8c0, 0xd1a8482a, 0x74ec4ce4, 0x63542247,
+    0xaa93236f, 0x499169d4, 0xdfb1b787, 0x8b43767f, 0x2ebfeea2, 0xeacd663a,
+    0xa9d2a7fd, 0xa5772a71, 0x36a452a1, 0x94e9d4f5, 0xb9d492f3, 0x6d4f2211,
+    0x6d70299a, 0xe77901ea, 0x038d92b2, 0x9fa64d91, 0x3d6e1f79, 0xe8b56a4f,
+    0xa95473cb, 0x2d655f96, 0x0357266b, 0xb292d572, 0x881ce611, 0xce578f60,
+    0x44384e83, 0x26942835, 0x22915c48, 0x117fba4c, 0x081ca393, 0xe30271da,
+    0x93dbf2da, 0xa1dcd3e4, 0xd4aad714, 0x9dfd44ca, 0x46cd9270, 0x905591f4,
+    0xa2a625c4, 0x7c1a419c, 0x46a532c8, 0x4b21507e, 0x26744cd3, 0xd936922e,
+    0x0a8fc63b, 0xd26733a7, 0x545a146b, 0xc473e789, 0xacb86e62, 0xfbb60554,
+    0x721eb95c, 0x1891c920, 0x721b765c, 0xdb7a53d7, 0xbbf4086c, 0x241707ba,
+    0xaca552ae, 0x58d1a03d, 0xabd1e088, 0x5ca14df5, 0x7fa69193, 0x792c9220,
+    0xa26175b5, 0x59d07b6d, 0x77b45fd2, 0xed77d808, 0x4f441d52, 0x00ff20e1,
+    0x00ffe4e8, 0xfa00ff52, 0xa87ab071, 0xcdcd165a, 0x9aeea00e, 0x9b08547b,
+    0xb9a48648, 0x1c3681e9, 0x448075b8, 0x33a02ade, 0x423ca052, 0x31fe2308,
+    0x036f229a, 0x5ed6963d, 0xa6ededb2, 0x52342754, 0xaa2eb3ab, 0xa2a6c552,
+    0xe94efde4, 0x9974e8b9, 0x096ca971, 0x2a6f1922, 0xc8130275, 0x6dc3a308,
+    0xdc2a26f9, 0x21111777, 0x8b6ca74a, 0xb3ea506f, 0x9b3d233b, 0x39d9bbba,
+    0x73e39fc4, 0xe4bc054a, 0x457290c7, 0x73e2c946, 0x2d663974, 0x31850f20,
+    0x15d84b62, 0x894bb562, 0x8b28d269, 0x26694773, 0x42ab75c5, 0xa7754dab,
+    0x3b8e3461, 0xa8d3a921, 0x1b0718f1, 0xf4bb42f8, 0x99815f32, 0x30fc807f,
+    0x3b2bca7f, 0xfe508dfd, 0xbef1df9a, 0xfb7d7fc0, 0xa172fd2b, 0xfc524bfd,
+    0xd145da55, 0xde4fde6e, 0x2e209dd6, 0x54daf558, 0x6ecb453a, 0x261d428d,
+    0x374a3d69, 0xa75991ca, 0x301ba8cb, 0xa596711e, 0x3c3687c8, 0x1b2e99b7,
+    0x709c7174, 0xad4a5bd1, 0x10df7f95, 0x58c5caae, 0x73eab699, 0xcf82b75b,
+    0x0da99db5, 0x6d310d42, 0xd866b77a, 0x01915c97, 0xfaec841c, 0xb275d5a4,
+    0x28491276, 0xb816dc30, 0x909b0889, 0xebefd1ab, 0x3a55e9e9, 0xb896a6b5,
+    0xc26bec51, 0xbda44a95, 0x2755a35b, 0x9e1b2e56, 0x6eb33096, 0x14ce174c,
+    0x98767c5a, 0x5c765a46, 0xf4b8aea8, 0x6d5a3785, 0xfb35d680, 0x234be76e,
+    0x68d38d66, 0xd9ac53ab, 0xa7323bd5, 0x420da250, 0x86f7119d, 0x9f860b91,
+    0xa4b2891d, 0x645e3585, 0x651555cd, 0x25105c6e, 0x10efc369, 0x9aeeb2dc,
+    0x9daaab54, 0x2bd46617, 0xb19a9ba9, 0xae49b52a, 0xe6d42ad6, 0xe0c651e0,
+    0x650ab5d0, 0xda574cd3, 0x926a4da8, 0x4ad5fdfe, 0x940a4c2a, 0xdd864557,
+    0x374acd61, 0x577d995d, 0xa555c36a, 0xdc8d66c5, 0x3d4e9dda, 0x4462439e,
+    0x955c2116, 0x5a39dda0, 0x646ec6de, 0x65d2a685, 0xbb25e3d3, 0x43422502,
+    0x2949d006, 0x2b0d3a2f, 0x447a4099, 0x4b245198, 0x533ae584, 0x4476d9d1,
+    0xfb8e9d07, 0x1230dfb0, 0x15bf3176, 0x4c3ca3d7, 0xeb6aab9a, 0xa7479b0e,
+    0xa78a1250, 0xb6c17ae2, 0xd0e5b8ca, 0x5d2b6a91, 0xeec53752, 0x131e6ed8,
+    0x642cc37f, 0x7b8200ff, 0x3b6dd82b, 0xb076f7ae, 0x28bf3a77, 0xf0efbca1,
+    0x07afccee, 0x539add6d, 0xbbc2815a, 0x6fb4d3d8, 0x7afaf8f6, 0x95d80e3b,
+    0x65d6a75c, 0xa3dcba10, 0xa7e8616a, 0x1b020cbd, 0x4d4d4b92, 0xd52650e4,
+    0x79b223dd, 0xef82db75, 0xdca8569d, 0x7a6bbb96, 0xa8d97e05, 0x6c5a555b,
+    0x3b5b3249, 0xd7110d5e, 0x483d56c9, 0x32d340d8, 0x448d0338, 0x15c7057d,
+    0x33715a11, 0xaa9bb28b, 0x7e6d699d, 0x6aae329e, 0xa78afbc4, 0x2a04aa3d,
+    0x29917ac5, 0x1a35c49a, 0x795db151, 0x3d668647, 0x22336162, 0xbfe69734,
+    0x66348a0c, 0x90b5a100, 0x2640ec38, 0x130747e3, 0x84860127, 0x095599d3,
+    0x34935000, 0xe39f17cd, 0x1f5f5445, 0x04c30ff8, 0x9e2de3bf, 0xe2242a3e,
+    0x9ce200ff, 0xf000ff29, 0x0fd837fe, 0x7f65bfef, 0xa93f54ae, 0x1c895f6a,
+    0x439b4c6d, 0x54107015, 0xc51409c1, 0x432a3d0b, 0x972c44e1, 0x971c7e4e,
+    0x5ce0022f, 0x0cc4d46c, 0x2e2d9b08, 0x812a9220, 0x91a48564, 0xa8e40a3e,
+    0x4a3e2fb9, 0xc45fe08b, 0x88a42a84, 0x912baa48, 0x2a6a2e22, 0xbe888aa8,
+    0x7951c925, 0xf84525fe, 0x181100ff, 0x47c85a06, 0xa50e2051, 0xf045d444,
+    0x92f03345, 0x5ce149fc, 0x49862139, 0x9be675b0, 0x404b9737, 0xe90482e3,
+    0xb1a58966, 0xcc324525, 0xd71c3285, 0x601a4f32, 0x6da361df, 0xb3691eb7,
+    0x0d687279, 0x797112c1, 0x54159bb9, 0xe6745e53, 0xe329fc1c, 0x290aaac2,
+    0xa288a012, 0x48aeaaaa, 0xaaea9c88, 0x1b2612bf, 0x5c40b771, 0xc9c6c168,
+    0x43021333, 0x90184f02, 0x229f8ae6, 0x734625e0, 0x9e0c894e, 0x4bc326b3,
+    0x049c5aa0, 0x971c2055, 0x5411c59c, 0x11d13985, 0x0a9b5355, 0xda6268e3,
+    0x8486a398, 0x84480aa0, 0x516a3948, 0xe6a00a1f, 0x66f0b29a, 0xc07ff899,
+    0xe51f18fe, 0xc1fea345, 0x5f60fd97, 0xb7f556e7, 0xac2abb5d, 0x6bca2d51,
+    0x91ac6af5, 0x1d89da70, 0xb2dd055a, 0xc7759d3a, 0x68cc38a4, 0x6b99b6ec,
+    0x34cd437a, 0x7a2a422a, 0x3a79518c, 0x87c8a36d, 0xff59713e, 0x8ec3fc00,
+    0xf2689b4e, 0x569ccf21, 0x3000ff87, 0x2eb2ece2, 0x146b1abb, 0x228bb2fb,
+    0x2b532a8d, 0xf4ba3022, 0x64484d39, 0x129b414f, 0xc465f2e9, 0x886a7677,
+    0x6de403e8, 0x8ae00d6a, 0xcebf1a38, 0xeffb0376, 0x95eb5fd9, 0x975aea0f,
+    0x7d7fb7e2, 0xff2fa5cd, 0x1f585000, 0x0d4c2ef7, 0xaab65dc1, 0x6f95489b,
+    0xa53e8141, 0xb5edda54, 0x49356241, 0xbd236a5f, 0x71e8b794, 0x098654cf,
+    0x44b63a0e, 0x72377206, 0x9af59651, 0x82747dc5, 0xc12db7d9, 0xda72b532,
+    0xae346397, 0x4aa95bce, 0x6ca8139a, 0xa94c8fcc, 0x494dabd2, 0x1a358f28,
+    0x22728974, 0x29fc8ec8, 0x72366551, 0x1720129d, 0xa82a5d1a, 0xf4868b94,
+    0x823657a1, 0xaad75ecc, 0x69872b55, 0x46b45b8d, 0x1da7625f, 0xad37b598,
+    0xc8be64da, 0x7c8f77cf, 0x6853a4dc, 0xa7de4431, 0xc9e506c6, 0x99bbcb9a,
+    0x6df3326c, 0xb5dc66b7, 0x927bd5e9, 0xa6d8bad5, 0xecdc7a0d, 0x883aae6c,
+    0x5569b6dc, 0x2468555a, 0x114b06b9, 0x4c2abda6, 0x499c0c49, 0xe4302631,
+    0xb4ae02a9, 0xb6e2b28e, 0x75da90e6, 0xd5e5b62a, 0xd5bbcab3, 0x6b041ad5,
+    0x0e89d5ee, 0x5b148fdd, 0x55be6717, 0xa9539303, 0x2427234c, 0x4cdb609b,
+    0xdb008ec1, 0xe2ba0a2c, 0x6b6a3aa1, 0xdb526bb5, 0x826b2e06, 0x37dc0ebc,
+    0x0d12c715, 0x58fab3bf, 0xa4917db6, 0x703102d6, 0xdba65b0c, 0xea79d8fa,
+    0x8d8a75be, 0x9864a041, 0xea8b0e8c, 0xb7d566ec, 0xdc2c5b64, 0x54b5f690,
+    0x376a95ba, 0xa648990d, 0x0355e8d1, 0x06f5dd79, 0xa7cd027d, 0x48a98e57,
+    0x88b3497c, 0x92fccafc, 0xd0d6219d, 0x91b6484a, 0x3746dedf, 0x5e53395a,
+    0x55ca6ca9, 0x224b4e42, 0xc7fc8e75, 0x5e9913d5, 0x9d274193, 0x664a3cc9,
+    0x4b2c2659, 0xb29f6596, 0xb405f56a, 0x12aa1529, 0xf1da21d3, 0x999cc4d4,
+    0x3a3c12dd, 0xe023aa85, 0xab543437, 0x72741832, 0xee691655, 0x2a2d5de9,
+    0x6d0eb905, 0x81d416a3, 0x71bda549, 0xa2eda14f, 0x9c1e83f8, 0x5f70d8dc,
+    0xda1e39a8, 0x867445a9, 0xa2c6456d, 0xc91ba234, 0x1aba4f2a, 0x3f6cb5c5,
+    0x2a984028, 0xda59d7c5, 0x4bd99f8d, 0x6b3acb3d, 0x94f0bd36, 0xa8d5a9b3,
+    0x4825c6f5, 0x462eba75, 0xa63974e3, 0x74466ce3, 0xdec05759, 0x3407df60,
+    0x44a268b0, 0xb4c99536, 0x53ef950a, 0x59e554a0, 0xbf254ad5, 0x52bb120d,
+    0x70ebd1a0, 0x48723d56, 0xc7a1c5a1, 0x3eb73e91, 0x8cd9f23b, 0x80a43641,
+    0xdd468cc9, 0xca903162, 0xd99fc174, 0xe51f18fe, 0xc1fea345, 0x5f60fd97,
+    0x8f825fe7, 0xffefa8ef, 0x5fab7400, 0x72b8a8d3, 0x71955c8d, 0x779a9d55,
+    0x83ca741b, 0xced1e8b5, 0xc677c505, 0x0db3e25c, 0x0c5c6bfa, 0xa3408c49,
+    0xf98e32c7, 0x1653aac5, 0x69dcb22b, 0x731ef269, 0x9ac446b2, 0x6b90592c,
+    0x8ad3a874, 0x895b37fa, 0x893e2a4d, 0x1c85da75, 0x274f3fe2, 0x4db29d2b,
+    0x092a3da8, 0xb29b0ace, 0x27bb4689, 0x6ac58cb2, 0x44db1e97, 0xfc827d41,
+    0xb5f4bf31, 0xb8cefe83, 0xd1a400ff, 0x03b6ce7f, 0x5fd9effb, 0xea0f95eb,
+    0xafe2975a, 0x5d1a17da, 0x9559b83d, 0xa32e75ca, 0x1ac59432, 0x53ae4fb5,
+    0x15e95464, 0x939ed038, 0x44339f22, 0x6ce9d439, 0xa7142154, 0x420207da,
+    0xe80ee3b4, 0xbd254d20, 0x8d0aadbb, 0xc7a4d60e, 0xaabbf62a, 0xadbddae6,
+    0x4d5ca857, 0x59a66941, 0x1e9f4dad, 0x5322672c, 0x1f7bcc88, 0x462c6a4d,
+    0xeef38618, 0x7bb2ec13, 0x793e75e7, 0x4eadd659, 0xb8e03e91, 0x5a9c2a6e,
+    0xb972c9ad, 0x4e396600, 0x4c0aec86, 0x97257d1a, 0xe9d3a658, 0x994964b1,
+    0x89384028, 0xfc3a2432, 0xe4f70da7, 0x24f9692e, 0xcaeca833, 0x71a522bb,
+    0x30dca7ce, 0x34977160, 0x7fddda2b, 0x363d8fb1, 0xa6c47199, 0xc438a5c4,
+    0x2cbc29f5, 0x2cc824ea, 0xcdf81d3d, 0x525662c7, 0xe84ad254, 0x6a9d15dd,
+    0xaed3e854, 0xaae2820b, 0x97dcabc7, 0xd7b8d02b, 0x7d3a4360, 0x530a0c2a,
+    0xa64cb14e, 0x22bd62d3, 0x94698164, 0x3bcf437e, 0xbe8e5322, 0x9aa7eaf3,
+    0xedbab386, 0xd62eaec7, 0x8d9b52f7, 0x8fae2bd8, 0x6cbc3971, 0xa61ae29c,
+    0xa138a424, 0xe37687a4, 0x716942bc, 0x5ce90875, 0x56c573c5, 0xbe5dbfcd,
+    0xba14de26, 0x24e2a0d5, 0x28742916, 0x5a15faf5, 0x2808947b, 0x12a4a73a,
+    0x32a75b83, 0x48b26a32, 0x9a309ddc, 0x11b02e39, 0x15818ba1, 0xfb6b6984,
+    0x52eab936, 0xba4cc7eb, 0xdfe15220, 0x3e5dca74, 0x77d88ffa, 0x0ab99124,
+    0x4c275320, 0xdac98db6, 0xa453c769, 0x1338a7ea, 0xda307982, 0xe29e8604,
+    0x9f59b791, 0x76fb6d47, 0x8c1a026d, 0x48a39e56, 0x155545a4, 0x90db8e20,
+    0xa22a1b8e, 0xd0428a8a, 0xa8a8f7a8, 0x699683aa, 0x95537686, 0xa45663c5,
+    0xd6c8c554, 0x4e9902ad, 0x920153a8, 0x5a152b06, 0xd06c790c, 0xe6dfa72a,
+    0x9d3a4c8b, 0xdd41f645, 0x6cac89e2, 0x886bf297, 0x1297365b, 0xb5a402ad,
+    0xf630e648, 0x04df748d, 0x087146d2, 0xd934dce3, 0xa1a71ad0, 0xe811556f,
+    0x715c30c5, 0x401c94fc, 0x55c51651, 0x526b2e15, 0xd3af56a9, 0x52550a2e,
+    0x265d3a3d, 0x51a9bade, 0x23c5e809, 0x10ebfa44, 0x91ec0c82, 0x036a12c0,
+    0x59d7d1f0, 0x157d5554, 0xf1790805, 0xf846fbb3, 0x52a7d9b3, 0xe92cd525,
+    0x53fc1854, 0x44830295, 0xaa5fb1ac, 0xb80e904e, 0x4a554ae5, 0x0e537a5d,
+    0xc23c95ce, 0x84dde74c, 0xcbd6d07b, 0x77eec020, 0x30fcb33f, 0x478bca3f,
+    0xfa2f83fd, 0xadcebfc0, 0x66bfa69b, 0xdbae9ad5, 0x55292755, 0x80795a56,
+    0xa451db94, 0x7420b322, 0xa6b1cbbc, 0xed232633, 0xb75b421e, 0xc05170d8,
+    0x7144d16d, 0x1de521b0, 0x172d8fb6, 0xd4a3e5e6, 0xb61de518, 0xe6172d8f,
+    0x18d4a3e5, 0xb6cbefbb, 0x6d1295fd, 0xaf7259db, 0x460e0322, 0x9f124586,
+    0xbaecb805, 0x11a8e368, 0x472191e9, 0xab88e9d6, 0xf34aab8e, 0x9a890d88,
+    0xffa04d8b, 0x37da9c00, 0xb8cb4245, 0x293d97a9, 0x29548fb8, 0x66ec3a2e,
+    0xb1eb36e7, 0xf48c9e08, 0xc336df52, 0xdd249df1, 0x1f3a6abe, 0xaaa0756d,
+    0xaf28a2aa, 0xf4a56d2b, 0xcaec9955, 0x95e35fc7, 0x2afad2b6, 0x6365f6cc,
+    0xe1e7f0af, 0x7467b463, 0x4bd668ef, 0x0d5c0c9a, 0x68b19a74, 0x70301770,
+    0x93aeaf73, 0x4e12e705, 0x5c745e71, 0x5fdab672, 0xcc9e5945, 0x39fe75ac,
+    0xa22f6d5b, 0x5666cfac, 0x1c00ff3a, 0xd197b6ad, 0x2bb36756, 0x568e7f1d,
+    0xabe84bdb, 0x8e95d933, 0x6d2bc7bf, 0x9955f4a5, 0x5fc7caec, 0xd2b695e3,
+    0xf6cc2afa, 0xf1af6365, 0x7d69dbca, 0x327b6615, 0xe5f8d7b1, 0x8abeb46d,
+    0x58993db3, 0xb672fceb, 0x59455fda, 0x75accc9e, 0x6d5b39fe, 0xcfaca22f,
+    0xff3a5666, 0xb6ad1c00, 0x6756d197, 0x7f1d2bb3, 0x4bdb568e, 0xd933abe8,
+    0xc7bf8e95, 0xf4a56d2b, 0xcaec9955, 0x95e35fc7, 0x2afad2b6, 0x6365f6cc,
+    0xdbcaf1af, 0x66157d69, 0xd7b1327b, 0xb46de5f8, 0x3db38abe, 0xfceb5899,
+    0x5fdab672, 0xcc9e5945, 0x39fe75ac, 0xa22f6d5b, 0x5666cfac, 0x1b00ff3a,
+    0xc175da46, 0xead4f9b4, 0x931ac185, 0x4764fa19, 0x9834b021, 0x4db6a3f2,
+    0x4abcf238, 0x389dcae8, 0x482ef588, 0x7f3a60a0, 0xffcfab82, 0xb58a5e00,
+    0x74d06fc9, 0x4db36a25, 0xad8313a6, 0x962d9bb0, 0xb53cc30c, 0xa8211988,
+    0x446a9ae7, 0xcf5434cb, 0x2edd7199, 0x81bef2c0, 0xec3d16ed, 0x3cb04b77,
+    0x457ba0af, 0xd21d7b8f, 0xe82b0fec, 0xde63d11e, 0x03bb74c7, 0xb407faca,
+    0xddb1f758, 0xbef2c02e, 0x3d16ed81, 0xb04b77ec, 0x7ba0af3c, 0x1d7b8f45,
+    0x2b0fecd2, 0x63d11ee8, 0xbb74c7de, 0x07faca03, 0xb1f758b4, 0xf2c02edd,
+    0x16ed81be, 0x4b77ec3d, 0xa0af3cb0, 0x7b8f457b, 0x0fecd21d, 0xd11ee82b,
+    0x74c7de63, 0xfaca03bb, 0xf758b407, 0xc02eddb1, 0xed81bef2, 0x77ec3d16,
+    0xaf3cb04b, 0x8f457ba0, 0xecd21d7b, 0x1ee82b0f, 0xc7de63d1, 0xca03bb74,
+    0x58b407fa, 0x2eddb1f7, 0x81bef2c0, 0xec3d16ed, 0x3cb04b77, 0x457ba0af,
+    0xd21d7b8f, 0xe82b0fec, 0xde63d11e, 0x03bb74c7, 0xb407faca, 0x49b1f758,
+    0xeb9a2dbb, 0xbd1ec5aa, 0x823ea94a, 0x3589b9a5, 0x3fd29d87, 0x3db19108,
+    0xaaf1896a, 0x5fe1e522, 0x529d0ae2, 0x2283459f, 0xd49654a7, 0x5c031128,
+    0x402e2f89, 0x3e82a408, 0x33235204, 0x01db0621, 0x40c87023, 0x30518904,
+    0x0de100ff, 0x03e93464, 0x60692e50, 0xc43eb98a, 0x7c34780a, 0x751911fe,
+    0x2fa2cf68, 0x2bb23585, 0x2ea2f392, 0x56518e69, 0x9edd4367, 0xeceb46a5,
+    0x3ab38a72, 0x2af5ec1e, 0x94635f37, 0xf7d09955, 0xba51a967, 0xaca21cfb,
+    0x3dbb87ce, 0xd8d78d4a, 0x746615e5, 0x54ead93d, 0x28c7be6e, 0xeea133ab,
+    0x75a352cf, 0x594539f6, 0x7a760f9d, 0xb1af1b95, 0xe8cc2aca, 0xa8d4b37b,
+    0x518e7ddd, 0xdd436756, 0xeb46a59e, 0xb38a72ec, 0xf5ec1e3a, 0x635f372a,
+    0xd0995594, 0x51a967f7, 0xa21cfbba, 0xbb87ceac, 0xd78d4a3d, 0x6615e5d8,
+    0xead93d74, 0xc7be6e54, 0xa133ab28, 0xa352cfee, 0x4539f675, 0x760f9d59,
+    0xaf1b957a, 0xcc2acab1, 0xd4b37be8, 0x8e7ddda8, 0x43675651, 0x46a59edd,
+    0x8a72eceb, 0xec1e3ab3, 0x5f372af5, 0x99559463, 0xa967f7d0, 0x1cfbba51,
+    0x87ceaca2, 0x8d4a3dbb, 0x36b4d8d7, 0xa45e6b93, 0x4f8914e3, 0x57a03d35,
+    0x65509b0e, 0x26ddcd22, 0x8bd8ba59, 0x0ef8b28e, 0xbe63ad69, 0x00ffb7ea,
+    0x154541ac, 0x66430b57, 0x45001d7e, 0x8ac200ff, 0x26d4acb8, 0xb549155c,
+    0xfc86838a, 0x879cefa9, 0x283dd708, 0x1934986b, 0x0dd916fc, 0xde09342d,
+    0xa6880880, 0x9bc78d49, 0x28368f1b, 0xe346e576, 0x52a4c6a9, 0x924cdf98,
+    0x8508a5a5, 0xb16d9bb6, 0x9ce77553, 0x68da662e, 0x9dcb4811, 0x4602027c,
+    0xec720542, 0xd36cb5d6, 0xbaf4aac6, 0xc49d5a25, 0xa1cbaf70, 0x43cd394f,
+    0x0d8aa890, 0x8ac6de4b, 0xf7992b4d, 0x8b60828a, 0x4e40b890, 0x1eb98734,
+    0xc1833f6f, 0xf078f2cf, 0x80f36dd4, 0xc3a969d3, 0x14456c31, 0x04c9cc79,
+    0x4c729d53, 0xc9e772c9, 0x4ca05c31, 0x6972aab7, 0xb9693115, 0x1437d2d0,
+    0x832e3a0d, 0x122b2647, 0x3275a5d1, 0xf1c13602, 0x2605d56d, 0xa77ba2b7,
+    0x854b6f1d, 0x3f6f1eb9, 0xf2cfc183, 0x6e1e7463, 0x4ee7647e, 0x9b62f175,
+    0x51ab7648, 0xad8e4c83, 0x31e5f383, 0x487d930d, 0x38241759, 0x4d3a012d,
+    0xa12da683, 0x36a82912, 0x409e8964, 0x3b89cd4b, 0xdd22b82a, 0x1ff7ac70,
+    0x7446ada4, 0xb1cc9c33, 0x82b13391, 0x754a4dc3, 0x534176c5, 0x241042c6,
+    0x62500147, 0xd284231a, 0x8694c86a, 0xb7c96fbf, 0xb3e8f32a, 0xa99233ce,
+    0xb92f8bce, 0xc438dc14, 0x226fd344, 0x1d356fb4, 0x0a2e1dc2, 0x5d5bb62e,
+    0xa622b948, 0xcb94bb4a, 0xf1c78b3f, 0x6b3bbc7e, 0x8bdb66cb, 0xd6b09374,
+    0xf5a6329d, 0xc785a625, 0x61486256, 0xc6cd7c82, 0x186184d5, 0x8c2139d0,
+    0xca5c3d93, 0x8d7d27d2, 0xfc79f3c8, 0x937f0e1e, 0xd49e8bc7, 0xbbd4699b,
+    0x1b765217, 0xa5b1f0af, 0xf33821ef, 0x0ae56e8c, 0x44ae6393, 0x44bca778,
+    0x5a37fd4e, 0x65d27251, 0x66a2c88d, 0x361f0fbe, 0x8b27dc58, 0x37368f1b,
+    0x72446c1e, 0x4d4c094c, 0x66b1f384, 0x8f1f7445, 0xe3d29521, 0x4048364f,
+    0x4465be62, 0x93c45ce6, 0x555124bd, 0x07d55b4c, 0x250ad46a, 0x7e10f151,
+    0xcfa648a5, 0x05984378, 0x7dd970d9, 0xa1e40fc4, 0x6c3ea8b8, 0x00ffcfbf,
+    0xf60f8908, 0x0680da36, 0xca4c1aa9, 0x45db978c, 0x861d4754, 0xa9e346cc,
+    0xa4ddce7f, 0x7c11d5c7, 0x3aa7590a, 0x8fc58763, 0x25bac765, 0xcfa8dc54,
+    0xa2479b76, 0x4e8d5a40, 0x2ee7784c, 0x8852eb5e, 0x0b381a37, 0x1d5a4684,
+    0xdd6d3432, 0xd148de02, 0xbb558e91, 0xd2e8960e, 0x877558a5, 0x37d5a86e,
+    0x4a484524, 0x6258b3d0, 0x78dc564c, 0xc728a1d4, 0x96cdb190, 0x6271319d,
+    0xce77a3b7, 0xabb48e46, 0x4cacdb1a, 0xa6c4c58f, 0x8d1b91cc, 0x65bd9d6a,
+    0x9ee33193, 0x321575cb, 0x508f57e7, 0xbc8a08e4, 0x9d62f9fc, 0x4d927bb3,
+    0xa842937a, 0xdcd1a653, 0x247a38ab, 0x2d64884a, 0x936acab0, 0x685b0321,
+    0xf80e47ea, 0x794147db, 0x128a52c7, 0x1758262e, 0xf4ead708, 0xa71e753a,
+    0xee63ca35, 0x491d83e4, 0x98af80d5, 0x94f69642, 0xb425c146, 0x077feb22,
+    0x07949a78, 0x2d50ae48, 0x8fa88a0b, 0x518b3e2d, 0xe0cac397, 0x9c3123a4,
+    0x595e6252, 0x248777ac, 0xe7149d26, 0x1f4d3421, 0xd90fcbc2, 0x26663c57,
+    0xaa4191ca, 0x6a9c1eb3, 0x889cd7dc, 0x911cb7e8, 0x2a599700, 0xc005a565,
+    0x11cc3155, 0x38bc9c0b, 0xf768edb1, 0x8902cb4d, 0xc7e2f72d, 0xdf549296,
+    0x0d5ea18d, 0x1d5e77cc, 0x7398e828, 0x622e22a8, 0xcfcdcbbc, 0x20c9468a,
+    0xb66bbd4e, 0xf68c8aec, 0x70b854e9, 0x32a8c5e4, 0x95449691, 0x085eaca8,
+    0xb2d2d65c, 0x4172d19b, 0xa88aa077, 0xf85c36cf, 0x36bf1e1b, 0xd4285145,
+    0x1d4a958a, 0x1236a136, 0x383962c9, 0xe3bcc22b, 0x200a9969, 0x84008a93,
+    0x2a79de62, 0x896692e5, 0xc57d3688, 0x69a76d53, 0xc6846af4, 0xcdf87ddf,
+    0xc4cc111b, 0x391546a4, 0xd9247f0d, 0x0b715514, 0xe7053e2d, 0x4a4bc4e6,
+    0x553a9fe0, 0xa31a1d32, 0x24157c22, 0xceb81199, 0x4b54d12b, 0x51c5ef42,
+    0x30f77d37, 0xe1d754ea, 0x2d86490d, 0x494d822b, 0x7a143bfa, 0xc848b583,
+    0xc7082245, 0x43648873, 0x3270a24e, 0x0cbf07ef, 0xd4d27b89, 0x2675553a,
+    0x8a0b6d72, 0x6550a81c, 0x4c2c6a51, 0x088411a9, 0x1f7146ae, 0x361a4d94,
+    0x5ad632e2, 0x6a2a41cb, 0xef41b25c, 0xd87774d5, 0x0ae33a2b, 0x8bce5192,
+    0x30a10a51, 0x47094652, 0x88e37c34, 0x2bc013a9, 0x4214dbf0, 0x1155c5cc,
+    0xe17b8544, 0x2eb04454, 0x093b76f5, 0xb237d66d, 0x072c2998, 0xb229ea04,
+    0x3a9f351a, 0xad773a64, 0x48a226e6, 0x35a729a6, 0xb8d23ec5, 0x8bcaaf2a,
+    0x66d4a34e, 0x66ba8248, 0x0867cc32, 0x0da296e2, 0x6ea2a20f, 0x104948cd,
+    0x252d220b, 0xca922e92, 0xa95fa90d, 0x8f3e15a1, 0x2f819650, 0x77cc3d80,
+    0xbb9b5b09, 0x07677857, 0x46dd2624, 0xd0848cc4, 0xac2ea274, 0xce6c6fb1,
+    0xe3765ab5, 0x61d3f861, 0xaea9b74a, 0x144b28c8, 0x89aa4c96, 0x9e0267b2,
+    0xd2286488, 0xebde54c9, 0x91f1e6d2, 0x4c116d24, 0x6d88135d, 0xa8e0b699,
+    0x1810d938, 0x154c842f, 0xe27c8544, 0x7cbea848, 0x0d228758, 0x8ec86ae9,
+    0x67e734e1, 0x0a114ce9, 0xb9c466aa, 0xd294c58c, 0xe82100ff, 0xa7d13acf,
+    0x91b826c6, 0xe8df8bfb, 0xb800ff9c, 0xa0ab08b8, 0x3f82bf39, 0x7c198ecd,
+    0xc597e158, 0x7a0d9e8d, 0x9bd4c82d, 0x947a0c7e, 0xdfcba1c6, 0xc3bce4d3,
+    0x6280cc2d, 0x57a42921, 0xf7516bdd, 0x6a8398cd, 0xb71a666e, 0x98b8d866,
+    0xda001699, 0x8b8e0bf5, 0x592cb844, 0x2ead4a74, 0xb243ca6c, 0xb00ef6e6,
+    0xdc1a55ea, 0x6d904720, 0xfe628784, 0x00ffe64d, 0x336e4769, 0x0e368c88,
+    0x5dc19337, 0xd58e1681, 0x1a1ab17a, 0x1ab48f4e, 0x6210b2bd, 0xc9a98d34,
+    0xa85b2483, 0x6a8623d6, 0x77c79489, 0x9f207c91, 0xa4c443b6, 0x4a8f4b97,
+    0x9a5605a6, 0x755b3411, 0x209634ba, 0x74f96dd5, 0x0982f4a9, 0x84509ad1,
+    0x647614f1, 0x2370bbb1, 0x6c32d238, 0x4cbad83c, 0x605957cb, 0xfdbe4216,
+    0xa5d478e1, 0x5679ccb6, 0x7b142ae5, 0x2994736e, 0x1e8d6275, 0xf9ec6073,
+    0xe08cc0ac, 0x8e3aa948, 0x2257c691, 0x2b6d1b10, 0xc96e298c, 0xa7d371f0,
+    0x95776a53, 0x8e06146e, 0x4a3c9643, 0xa8f2f894, 0x66b169f2, 0xc54c42d5,
+    0x9c4da559, 0x3137e222, 0x1c1e07c1, 0xab0159cf, 0x3af9388e, 0xecbc1265,
+    0xd486bdda, 0x8a18558a, 0x3b5db7f6, 0x1b02478e, 0x3dcd42e9, 0x268e19f7,
+    0xc131aaa4, 0x4e7771d5, 0xa44b536f, 0x8bcbdc1c, 0x7935226e, 0x20478451,
+    0x8284e16e, 0xcf08129f, 0x00ff4404, 0x69262672, 0x4997ea57, 0x2b9a9c28,
+    0x24aa2597, 0xfa813aaa, 0x8013d195, 0x45b34c54, 0xac099308, 0xe9429fd3,
+    0x9ae7bfcf, 0x2d352912, 0x4af4dca4, 0x9a4b155b, 0x0e9d6e35, 0xe614bb32,
+    0xf00302b9, 0xd887a422, 0x15efda8e, 0x7130425d, 0x0788c85a, 0x486c5523,
+    0x67548a55, 0xc97d3aae, 0xab118d22, 0x6512cba9, 0x4732ca7d, 0xfbca6d44,
+    0x13dbb04f, 0x25852f8a, 0x5a382f38, 0xe608390f, 0x31c4d792, 0x2a3349bc,
+    0x81456ab5, 0x664cb93e, 0x687b509b, 0x1b20b90c, 0x94785086, 0x2568dd06,
+    0xfdce1d3b, 0x6104201c, 0x3052c549, 0xe9e01760, 0xd83cbac4, 0x3db58d74,
+    0xdad1132a, 0x0dd7589b, 0xc12659d7, 0x97b45af0, 0x2291e3d0, 0x7dba8123,
+    0x63ded4a2, 0x9e67a2df, 0xc6218769, 0x6bbae46e, 0x56b56ca8, 0xdbb65ba7,
+    0x526ef934, 0x9e8ad724, 0x3294a0dc, 0x864a3364, 0x1b6472e3, 0x26851bc2,
+    0xd1065c48, 0x71b9d5c4, 0x877d38f0, 0xfa355ca7, 0xb8645a8c, 0xea342a33,
+    0x59d78f43, 0x511b67b5, 0xa9e3be67, 0xe3984e30, 0x55183245, 0xd331734f,
+    0xab2ff746, 0x5e32b96e, 0xcd7190fd, 0x891e52a9, 0xd6714a77, 0xa353e8e9,
+    0x4ca79c45, 0x2436ec8e, 0xe4a8c01b, 0xf4ba2287, 0xce436282, 0xbec91301,
+    0xcb2f1d71, 0x711d6fa9, 0x165f8613, 0x63f16538, 0x2c165f86, 0xb5d1cad4,
+    0xd16ec593, 0xa353f553, 0xdffef9a7, 0x6bb5de19, 0xcfca257f, 0xfccf34d2,
+    0x97f9c1b1, 0xa0cdc6e9, 0x50a5d2d5, 0x46aedf7e, 0x85d9d6a5, 0xc8744a9c,
+    0xfb7aece0, 0x04bb796a, 0x81f675dc, 0x4c0603a2, 0xef1d0772, 0x0d3281f5,
+    0xa5ba78ba, 0x6937a5c8, 0x0a24575c, 0x1dd20b54, 0x343c3976, 0x955f6db2,
+    0x09936541, 0xb8dc4e2e, 0x201112ea, 0x74bd03a3, 0x6d2bde1b, 0x09904369,
+    0x6bb64156, 0x8926c5d6, 0x3e239622, 0xc65dabe2, 0x8f9e17b5, 0x2ea29200,
+    0x923306b1, 0x36496659, 0x3365879b, 0xa8cbdd19, 0x54732c0f, 0x51ab8ad2,
+    0xb24de217, 0x53954de4, 0xa45b4ca2, 0xab53e850, 0xd9c0568d, 0xeea8347e,
+    0x33538dc8, 0x1cb1a676, 0x61b26d42, 0x52c50df9, 0x142c4c90, 0x9f62c1d2,
+    0x7509b212, 0xc96f7f53, 0x1aed4eb8, 0x94abe1be, 0x828e7369, 0x1d53a2e9,
+    0xf284824a, 0xc476643a, 0x809c761b, 0xc50a2d22, 0x33c6f956, 0xe6bcdaf5,
+    0x54a3fd6d, 0x4eb74fa9, 0x47c9fd9a, 0x4a34d965, 0xba80ef8b, 0x2433a030,
+    0x2552d4a2, 0x5653e235, 0xc7e038f4, 0x1453be6f, 0x2abf1337, 0x8b9cfabc,
+    0xbda7eda6, 0x93d34932, 0x185d9366, 0x8970e10a, 0x4530e324, 0x73cf8627,
+    0xe03a29c4, 0x746ff4ef, 0x8e56ef96, 0x8a271bf7, 0xcb517da1, 0xde19e625,
+    0xc55fd03f, 0x5608d910, 0xfda54d85, 0xa04f70b7, 0x94a6a5d1, 0x98ed5642,
+    0x524391f5, 0xeeb5ef45, 0x32990bc1, 0x24fe1c44, 0x40924e1b, 0xa4adc954,
+    0xf176a8ca, 0x9de83c71, 0xb64d7147, 0x8ede57dd, 0x4150ac8e, 0xdb32e979,
+    0x6f320d2d, 0xbdecea70, 0x9337835b, 0x549b547b, 0xf62edba2, 0x6bba542e,
+    0xb0566d8f, 0xc719a7db, 0x49987418, 0x11dc1f73, 0x2e938a0a, 0x19ef4d13,
+    0x1378db3c, 0x916da243, 0xc568d50a, 0x2bdae232, 0x8bba84ac, 0xed0094ca,
+    0x02ee346e, 0x3034483d, 0x10a8cbe8, 0xa2713ca2, 0xa3a8033a, 0x68f01d39,
+    0xca1207e4, 0x4dc54248, 0x5bebd299, 0x94408141, 0x9d3a6e91, 0x9a7ed62e,
+    0x67f832fb, 0x1f8fc4a4, 0x9841e2f6, 0x910b24a4, 0xc9036f26, 0x98aa58ab,
+    0x6ac353e9, 0x88e55af4, 0x726b66dd, 0x5769256b, 0x594ced29, 0xbb4af981,
+    0x6fb10d85, 0x787c518f, 0xf871d092, 0x720a0994, 0xe44b4b11, 0x9a331c59,
+    0x4268c9cd, 0x6a46c5a8, 0xc655da54, 0x85ab0cf2, 0x11b28ecb, 0x8bda8edf,
+    0x4d4b5975, 0xe37edf8a, 0x66c85162, 0x556c334b, 0xad594e17, 0x3971bd3e,
+    0x4e725868, 0x533952b1, 0x6c62d0af, 0xbdf29485, 0x74cf2226, 0xd75c37b8,
+    0xf08bc8a9, 0x63525238, 0xefce2274, 0x14090274, 0xa2eb7d5c, 0x0ea9150d,
+    0xdcbed8d5, 0x0e8d4da8, 0xebfb36b8, 0x2c8ad814, 0x1afe7d4b, 0x8aa64b59,
+    0x89c88db6, 0x457954ba, 0xcd9d56c1, 0x56ad761b, 0x7ebdc59c, 0x06322954,
+    0xe965229d, 0x5124b705, 0x02b80f6a, 0x257e0cbc, 0x3d465462, 0x5e17f339,
+    0x1870be67, 0x87915867, 0x326ad97e, 0x92aba4ec, 0x5b028be8, 0xbb2ad5ed,
+    0x5494a739, 0x71c2526a, 0xa032aaea, 0x7131a0d4, 0x2b4d0990, 0x312781aa,
+    0xa445e228, 0x9ac433c0, 0x9049ed7b, 0x4b5c9dd4, 0x8ddcbc6f, 0xe0b7ac45,
+    0x8fda0be1, 0xc45bd635, 0xea9a472d, 0xcf35cb5c, 0x34715a3c, 0x64c956dd,
+    0x44c3edbd, 0xa9e28f5f, 0x3a385cc5, 0x70fec3c4, 0x54b4fe90, 0x93df4ec5,
+    0x9d229d48, 0xe86d932d, 0xf27d13ae, 0x55046b2a, 0xfe0cdd46, 0x6a0a6e13,
+    0x4f654e03, 0xe41f3806, 0xe41f38ae, 0xa80c22ae, 0x05995912, 0x8e4ae2e7,
+    0xc190d95a, 0x59b66eab, 0x1e92ae28, 0x8054887c, 0x1198e0c7, 0x1201a101,
+    0x5ebd4a2d, 0xd768b8b8, 0xa85c5a05, 0x0d07c82d, 0x02336eb0, 0xdea4ab28,
+    0xd38e45dd, 0xa90dbc6e, 0x71d095ee, 0x64205143, 0x8d576886, 0x3d329d46,
+    0x91418b02, 0xdf2e4d32, 0x2eb5ad88, 0x3d2f1b50, 0x5315c521, 0xc1693014,
+    0x07044446, 0xaea04cf2, 0xc0eed062, 0x0d57aa0c, 0xd48657cd, 0x645e950a,
+    0x64938ca8, 0x33e4160d, 0x66379126, 0xdbb48cf3, 0x42324cd2, 0xa4e39213,
+    0x3d577e8e, 0xba857de7, 0x169bc2ae, 0x5c99b5a2, 0x44ee386c, 0x10354262,
+    0xa53b2355, 0x18e0615c, 0xc8a6d4e8, 0x60290f80, 0x3a804efe, 0x9a808e2a,
+    0x3caf5839, 0x6af755ed, 0x6df5ba0f, 0xe3a8168e, 0xa8acc180, 0xef58f0c9,
+    0xd08e549a, 0x15619367, 0x20c74618, 0x2222486f, 0x32af5935, 0x534326f5,
+    0x51a8179c, 0xf7242dca, 0x8e831711, 0xd844934d, 0x755147a1, 0xce51b215,
+    0x2f79bc40, 0x0c9fcfc2, 0xdad2980c, 0x7293c19c, 0xb4647cd9, 0x831208f2,
+    0x73c17be0, 0xaa368941, 0x2069df87, 0x7294f851, 0xeed6c1e6, 0xc1981a07,
+    0x67561dd4, 0x31ad46d4, 0x4744c4bd, 0x3ce820ea, 0xe8285732, 0x4deba8a0,
+    0x06b5e99e, 0x69334115, 0xeb119b53, 0xac5a1cd7, 0x9c6adc9a, 0x7f736a96,
+    0x4780e4c6, 0x20de9341, 0xe72efa26, 0xa2487383, 0x771dd568, 0x49c39a64,
+    0xb55ad8f7, 0x5ee9aa74, 0xacb5942a, 0xca196a09, 0x651ebc43, 0xa7b7d81d,
+    0x91f43170, 0x248d0a07, 0x7b13d96d, 0x8aa304ad, 0xace47e95, 0xaa52610b,
+    0xcc2c94ca, 0x2c66ec49, 0x164b4c34, 0x8779a1d1, 0x8cd3b223, 0x1bef04e8,
+    0x2ca08568, 0xd2d116dc, 0x35d75923, 0x546653d3, 0x3279f569, 0xa865cd63,
+    0xa23659f2, 0xc1346e23, 0x088aad93, 0x90681447, 0x679c48c9, 0xeabdeb76,
+    0x0880663c, 0xaddc7021, 0x15343bd5, 0xe1530149, 0x06ca1a86, 0xa0b80ee3,
+    0xb00e0b99, 0x9b57242c, 0x7544621e, 0x07c1c983, 0x3100747f, 0xd1dc708f,
+    0x11ab522a, 0xa342f3ea, 0x855c9a3b, 0x08499c56, 0x472ec09c, 0xa08ab375,
+    0x708c2aca, 0x8a221046, 0x0f8d8ee9, 0x3a072a36, 0xf5e92dad, 0x984c0f29,
+    0xf7756af9, 0xc42f3595, 0x20282282, 0xeb9d60db, 0xd320346d, 0x02b6de63,
+    0x7fe0d83c, 0x7fe0b892, 0x488db892, 0x31433291, 0xf2e3b022, 0x966d345f,
+    0xcccc4c5b, 0x249e08bc, 0x2197c8f8, 0x5089cc11, 0x58145751, 0xd2a34d47,
+    0x9310ce69, 0x61b02990, 0x929e41b8, 0x645ab138, 0xd2e773c8, 0xe6a90aa4,
+    0xda3f00ff, 0xe522ab4d, 0x2338c7a4, 0x754c9fbc, 0x996399c7, 0x882f4316,
+    0x5581860c, 0xc9df1151, 0xb966e8b4, 0xf85bed1e, 0x6e872a46, 0x07255a55,
+    0x24105529, 0x95c1a2f0, 0xe7e97cf5, 0x02766c4e, 0x0fb5d1a5, 0x78f59552,
+    0x4624d2a7, 0xd6f91d9b, 0x5694eafc, 0x1ba137cb, 0x80a4a333, 0xbfd15451,
+    0xf236a569, 0x44454255, 0x51c9745e, 0x2a175751, 0xa13aee55, 0x328b0ed4,
+    0x31d36823, 0x246ac3a2, 0x562c6ea2, 0x094d4b07, 0xcb451b6e, 0xb645559d,
+    0x40ef35c7, 0xc04e2453, 0xa136ba54, 0xafbe52ea, 0xf4a9801d, 0xa5d4436d,
+    0x5f3b5e7d, 0x436d74a9, 0x5e7da5d4, 0xe852013b, 0x4aa987da, 0x0276bcfa,
+    0x0fb5d1a5, 0x78f59552, 0xa34b05ec, 0x2ba51e6a, 0x0ad8f1ea, 0x3dd44697,
+    0xe3d5574a, 0x8d2e15b0, 0xaf947aa8, 0x2a60c7ab, 0xf5501b7d, 0x8a575f29,
+    0x94a6551c, 0x0f5aaa81, 0x46482357, 0x13eb26bf, 0xc6614962, 0xf328e875,
+    0x68de6059, 0x7d541c0d, 0xd21eef94, 0xc776aede, 0x6b542917, 0x2d16c0ee,
+    0x7dba74e9, 0xa743222e, 0xc73c6ac0, 0xd6ea2df7, 0xc3e61be1, 0x48b8e16a,
+    0x5c819699, 0x3d6a7584, 0xa9805d46, 0x501b7b78, 0x4ac1c7cf, 0x0276bcfa,
+    0x0fb5d1a5, 0x78f59552, 0xa34f05ec, 0x2ba51e6a, 0x0ad8f1ea, 0x3dd44697,
+    0xe3d5574a, 0x8d2e15b0, 0xaf947aa8, 0xf56bc7ab, 0x7aa88d2e, 0xc5abaf94,
+    0xe554628b, 0x19f5e9d6, 0x81422471, 0xe2cc944d, 0xc9444372, 0x0557f43e,
+    0xdbb4ece8, 0x9d904cba, 0x4a0f5700, 0x99843482, 0x53fc31ea, 0x8eda7469,
+    0xe153c89e, 0x8e9ed14e, 0xa82f332e, 0xaed0e167, 0xf1672801, 0xe3cf54e9,
+    0xd7b66ac7, 0x423d5240, 0xd58eb937, 0xa480ae6d, 0x736f847a, 0x5ddbaa1d,
+    0x08f54801, 0x553be6de, 0x9102bab6, 0xccbd11ea, 0x746dab76, 0x23d42305,
+    0x56ed987b, 0x470ae8da, 0x31f746a8, 0xd0b5adda, 0x8d508f14, 0x5bb563ee,
+    0x1e29a06b, 0xc7dc1ba1, 0x40d7b66a, 0x37423d52, 0x6dd58eb9, 0x7aa480ae,
+    0x1d736f84, 0x015ddbaa, 0xde08f548, 0xb6553be6, 0xea9102ba, 0x76ccbd11,
+    0x05746dab, 0x7b23d423, 0xda56ed98, 0xa8470ae8, 0xda31f746, 0x14d0b5ad,
+    0xee8d508f, 0x6b5bb563, 0xa11e29a0, 0x6ac7dc1b, 0x5240d7b6, 0xb937423d,
+    0xae6dd58e, 0x847aa480, 0xaa1d736f, 0x48015ddb, 0xe6de08f5, 0xbab6553b,
+    0x11ea9102, 0xa343ccbd, 0x4ec469d2, 0x8440a640, 0x729226e1, 0x70194634,
+    0x5ca5c387, 0xfe514300, 0xbf79794e, 0x71973bfb, 0x581db0db, 0x58f4ebf3,
+    0x62c28f4f, 0x6704565d, 0x3c4dcc87, 0x99af18f8, 0xdab81d53, 0x7e5b551e,
+    0xabfda5dd, 0x1edab81d, 0xdd7e5b55, 0x1dabfda5, 0x551edab8, 0xa5dd7e5b,
+    0xb81dabfd, 0x5b551eda, 0xfda5dd7e, 0xdab81dab, 0x7e5b551e, 0xabfda5dd,
+    0x1edab81d, 0xdd7e5b55, 0x1dabfda5, 0x551edab8, 0xa5dd7e5b, 0xb81dabfd,
+    0x5b551eda, 0xfda5dd7e, 0xdab81dab, 0x7e5b551e, 0xabfda5dd, 0x1edab81d,
+    0xdd7e5b55, 0x1dabfda5, 0x551edab8, 0xa5dd7e5b, 0xb81dabfd, 0x5b551eda,
+    0xfda5dd7e, 0xdab81dab, 0x7e5b551e, 0xabfda5dd, 0x1edab81d, 0xdd7e5b55,
+    0x1dabfda5, 0x551edab8, 0xa5dd7e5b, 0xb81dabfd, 0x5b551eda, 0xfda5dd7e,
+    0xdab81dab, 0x7e5b551e, 0xabfda5dd, 0x1edab81d, 0xdd7e5b55, 0x1dabfda5,
+    0x551edab8, 0xa5dd7e5b, 0xb81dabfd, 0x5b551eda, 0xfda5dd7e, 0xc46511ab,
+    0x8548ca9c, 0xe4c8342a, 0x47fc82aa, 0xaaca90da, 0x641d5178, 0xc553158c,
+    0xfbc67f9e, 0xdbe7b862, 0xd3ae6b76, 0x6af3381d, 0x1ad2a373, 0xbb28d194,
+    0x54665f14, 0x8564de97, 0xc4dd4151, 0xc46d1a37, 0xc4c92654, 0x1cf17b70,
+    0xa44a042b, 0xaa44444a, 0xa4aa4444, 0x919aab44, 0xaaaaf32a, 0x3aafaaf3,
+    0x3e1c87af, 0xf8707c38, 0xe3c3f1e1, 0x543ac487, 0xf0b884aa, 0x25723061,
+    0x8e5974ca, 0xd7ad65c0, 0xea80e04f, 0xced71c51, 0x547c9e48, 0x517879f6,
+    0xa950b9a1, 0x42e2f3db, 0x41fa4e67, 0x5a034e23, 0x9b9348d7, 0x0d205d87,
+    0x10ae884a, 0x21aa22a0, 0xf0996612, 0xa84393f8, 0xa84f8743, 0x30e38a49,
+    0x6921a9aa, 0x444309d2, 0xdc6088a4, 0x2909da9d, 0x01dce426, 0xe43c622d,
+    0x1f8e6799, 0x7c383e1c, 0xf1e1f870, 0xc787e3c3, 0x1c1f8e0f, 0x5f59363e,
+    0x85975ba9, 0x39afb819, 0x502a56c1, 0x7a1875a9, 0xdc9087cb, 0xb71101e9,
+    0xeff4bcc9, 0xf3c81be2, 0x10ad652e, 0x38f4bc4d, 0xdbc6bf62, 0x68796f79,
+    0x2b3e11d3, 0x00ff2296, 0xff9455d9, 0x291cc700, 0x1c9fbf78, 0x9fbf7829,
+    0xbf78291c, 0x78291c9f, 0x291c9fbf, 0x1c9fbf78, 0x9fbf7829, 0xbf78291c,
+    0x751c169f, 0x5cd9ce1b, 0xbf7815bc, 0x546fb1f7, 0x9f3653eb, 0xd4a6d170,
+    0x53a8136a, 0x26d1dc24, 0x914ca653, 0x47500b26, 0x308dd28b, 0x18338efb,
+    0x7700c85b, 0xbb78df22, 0x715a80af, 0xd62cb341, 0x350bfa6d, 0x76d4b4d8,
+    0x9dc9a7e0, 0xe236bd32, 0x4b994c8b, 0x29183357, 0x7048a74f, 0x40d3b638,
+    0x00244bef, 0x465c5d35, 0x2bb06db2, 0xb3ab056e, 0x0005b7c8, 0x657e25ae,
+    0xdb1c9b6e, 0x88456c96, 0xed48b5cb, 0x9d1b98ca, 0x24835c5c, 0xd619b18a,
+    0x10cf38d8, 0x4e172049, 0xa9b2e1f2, 0xf41d6a14, 0x48df478c, 0xc8d4dca4,
+    0x198ed9d4, 0xf2a9f19b, 0x47f98ed8, 0x3d404255, 0x99dadd3b, 0x9ae59a82,
+    0x05cfa596, 0xab31db67, 0x4997cbae, 0xb628d3de, 0x45822b04, 0x6f5d9729,
+    0x1b1715b2, 0x53d27bd2, 0x89484057, 0x4015c54d, 0x05524002, 0x3aafc04c,
+    0x9dfdb665, 0x1a14dc6d, 0xa9ded000, 0x29b5e7d4, 0x6af9259e, 0x3bbac088,
+    0x28dd79a0, 0xa981a36c, 0x5c1a46b2, 0xf8f8b4b9, 0x3e7ff152, 0x7ff15238,
+    0xf152383e, 0x52383e7f, 0x383e7ff1, 0x3e7ff152, 0x7ff15238, 0xf152383e,
+    0x282d3e7f, 0xae5d97ca, 0x3a2e78b9, 0x157ffc1a, 0x7fe12a52, 0x4ab3b68d,
+    0x676aa97e, 0xa7c5151c, 0x5dd46354, 0x70cb4c01, 0x5d7179dc, 0x768f4f24,
+    0xe285f792, 0xb2f82500, 0xfee603c7, 0x1cab00ff, 0xfbe89b0f, 0xbef9c0b1,
+    0x0f1cbb8f, 0xb1fbe89b, 0x8fbef9c0, 0x9b0f1cbb, 0xc0b1fbe8, 0xbb8fbef9,
+    0x917aa314, 0x8e538552, 0x19fc46db, 0x78a02501, 0x6d235a4d, 0x1b714473,
+    0xc747cd26, 0xf87cc5a4, 0x65557d9d, 0xf4b83db1, 0x22937e9b, 0xce8cdba6,
+    0xa5e9d2a8, 0x2ffba21e, 0x9c0da996, 0x24d27da3, 0x22dc797d, 0xf95e3545,
+    0xc5be0f09, 0xd2adf32e, 0x58538c69, 0xa1744c8f, 0xb5e99604, 0xb5f73019,
+    0xff725b2a, 0x32087600, 0x84348a35, 0xd97cafb9, 0x94a4e7aa, 0x97464080,
+    0x74e9d57c, 0x693475fa, 0x52ac59b4, 0x95a2d7cd, 0x9ed21b42, 0xaf3c6e19,
+    0xc9e2dd0c, 0x1a5b6e45, 0x639d06de, 0x7a3cde75, 0x0d49cbd0, 0xc2adee3e,
+    0x356fb472, 0x7925aa4f, 0x9a3993e4, 0x1d9531a4, 0x72ee0765, 0xb609611b,
+    0x224d9ac4, 0x206d4200, 0xae6ddeb6, 0x5ca35481, 0xcbbd5a75, 0x0a5539d9,
+    0xd16a362d, 0x935d18bb, 0xd5a3e461, 0x714d055a, 0xfdbf45ea, 0x1b894eae,
+    0xa2c9c0fb, 0x1a61a075, 0x411b7704, 0x164d1e97, 0x74494881, 0x4a227359,
+    0xede62d99, 0x42a411d0, 0xe356c461, 0x31a38dc6, 0xe6254144, 0x0466de55,
+    0x156b226e, 0xf4cd072e, 0x7ce0d87d, 0x8edd47df, 0x7df4cd07, 0xdf7ce0d8,
+    0x078edd47, 0xd87df4cd, 0x47df7ce0, 0xcd078edd, 0xb2d87df4, 0x5d2792e8,
+    0xd28e3134, 0x85520d97, 0xbdcbf23d, 0x2d19346a, 0x5cc27949, 0xbdf54eb2,
+    0x3900ff01, 0x17fe01d3, 0x2aa2baf1, 0x2f9aa964, 0xa2f3a232, 0x0f5389a7,
+    0xeeab3659, 0x6251ae13, 0x2d52356b, 0xcd91f5de, 0x4e03397c, 0x22c80f00,
+    0x764ce289, 0x2b746987, 0xd74f961e, 0x4b3bb4e3, 0xb2f458a1, 0xa11dbf7e,
+    0xc70a5dda, 0xf8f593a5, 0xe8d20eed, 0x9f2c3d56, 0x7668c7af, 0xe9b14297,
+    0x3b7efd64, 0x15bab443, 0xeb274b8f, 0xa51ddaf1, 0x597aacd0, 0xd08e5f3f,
+    0x63852eed, 0xfcfac9d2, 0x74698776, 0x4f961e2b, 0x3bb4e3d7, 0xf458a14b,
+    0x1dbf7eb2, 0x0a5ddaa1, 0xf593a5c7, 0xd20eedf8, 0x2c3d56e8, 0x68c7af9f,
+    0xb1429776, 0x7efd64e9, 0xbab4433b, 0x274b8f15, 0x1ddaf1eb, 0x7aacd0a5,
+    0x8e5f3f59, 0x852eedd0, 0xfac9d263, 0x698776fc, 0x961e2b74, 0xb4e3d74f,
+    0x58a14b3b, 0xbf7eb2f4, 0x5ddaa11d, 0x93a5c70a, 0x0eedf8f5, 0x3d56e8d2,
+    0xc5af9f2c, 0xa34a8d36, 0x0c328581, 0x5be66878, 0xf77b68c5, 0x706bf032,
+    0x1c249c94, 0x2a294ad7, 0x73926b26, 0xae47fdaf, 0x6a9f8a6b, 0x2ad766d1,
+    0x30345c4a, 0x256f9b1c, 0x92ee437a, 0x5066c436, 0x795d1195, 0xd54c41c2,
+    0x86530704, 0x934a00a8, 0xa89b087f, 0x50a725df, 0xb3b1f8ed, 0x4a4d0d5d,
+    0xcff2f78c, 0x13fbd6bd, 0xe5aacda9, 0xd1316896, 0x582ef033, 0xf47c0de5,
+    0x35eaa965, 0x28c7bd7e, 0x2da3e76b, 0xf5ab514f, 0x5f4339ee, 0x7a6a193d,
+    0x71af5f8d, 0xe8f91aca, 0x6ad453cb, 0x508e7bfd, 0x5a46cfd7, 0xeb57a39e,
+    0xbe8672dc, 0xf5d4327a, 0xe35ebf1a, 0xd1f33594, 0xd5a8a796, 0xa11cf7fa,
+    0xb58c9eaf, 0xd7af463d, 0x7c0de5b8, 0xeaa965f4, 0xc7bd7e35, 0xa3e76b28,
+    0xab514f2d, 0x4339eef5, 0x6a193d5f, 0xaf5f8d7a, 0xf91aca71, 0xd453cbe8,
+    0x8e7bfd6a, 0x46cfd750, 0x57a39e5a, 0x8672dceb, 0xd4327abe, 0x5ebf1af5,
+    0xf33594e3, 0xa8a796d1, 0x1cf7fad5, 0x8c9eafa1, 0xaf463db5, 0x0de5b8d7,
+    0xa965f47c, 0xbd7e35ea, 0xe76b28c7, 0x514f2da3, 0x39eef5ab, 0x193d5f43,
+    0x5f8d7a6a, 0x1aca71af, 0x53cbe8f9, 0x7bfd6ad4, 0x796d9b8d, 0xd161d69b,
+    0xe9f654aa, 0xdf648475, 0x4fbcc38f, 0x59db9c43, 0xf5dea82b, 0x011fd611,
+    0x89643555, 0x8c8026e1, 0x1314cd5d, 0x3bdcfe17, 0xa248aa5e, 0xb5e8945b,
+    0x594d5019, 0xbb793e9b, 0x532037c1, 0x11c38ebf, 0x269fa7cd, 0xc279bc4f,
+    0x1213907d, 0xbf134700, 0xcfd7504e, 0xa39e5a46, 0x72dceb57, 0x327abe86,
+    0xbf1af5d4, 0x3594e35e, 0xa796d1f3, 0xf7fad5a8, 0x9eafa11c, 0x463db58c,
+    0xe5b8d7af, 0x65f47c0d, 0x7e35eaa9, 0x6b28c7bd, 0x4f2da3e7, 0xeef5ab51,
+    0x3d5f4339, 0x8d7a6a19, 0xca71af5f, 0xcbe8f91a, 0xfd6ad453, 0xd7508e7b,
+    0x9e5a46cf, 0xdceb57a3, 0x7abe8672, 0x1af5d432, 0x94e35ebf, 0x96d1f335,
+    0xfad5a8a7, 0xafa11cf7, 0x3db58c9e, 0xb8d7af46, 0xf47c0de5, 0x35eaa965,
+    0x28c7bd7e, 0x2da3e76b, 0xf5ab514f, 0x5f4339ee, 0x7a6a193d, 0x71af5f8d,
+    0xe8f91aca, 0x6ad453cb, 0x508e7bfd, 0x5a46cfd7, 0xeb57a39e, 0xbe8672dc,
+    0xf5d4327a, 0xe35ebf1a, 0xd1f33594, 0xd5a8a796, 0xa11cf7fa, 0xb58c9eaf,
+    0xd7af463d, 0x87f06bb8, 0x57c105bd, 0xadc316e9, 0xb5edf722, 0x92c1aa1a,
+    0xabd28578, 0x3a5f1048, 0x2c267fb2, 0x7d9fe24b, 0x0da31652, 0x3b2289a3,
+    0x01a11ea9, 0x881c17d3, 0xe91882fa, 0xd1775070, 0x615515dd, 0xd2eb0ded,
+    0x81814d68, 0xbfca7e8a, 0x54dba65e, 0xb39a75a9, 0x8228ccca, 0x5b477a8a,
+    0x039299ae, 0x68deb04c, 0xaae93cae, 0x9e680e08, 0x12102512, 0x48f89324,
+    0x0e49baa0, 0xcd9837ce, 0xb82a3974, 0xcf245e91, 0xa9964999, 0x53550053,
+    0x2c1f519d, 0xc7359b97, 0x443e3929, 0xfa90f3b5, 0xe4a41c83, 0xced712f9,
+    0x720cea43, 0x4be49393, 0xa80f395f, 0x4f4eca31, 0xe47c2d91, 0x29c7a03e,
+    0xb5443e39, 0x83fa90f3, 0xf9e4a41c, 0x43ced712, 0x93720cea, 0x5f4be493,
+    0x31a80f39, 0x914f4eca, 0x3ee47c2d, 0x3929c7a0, 0xf3b5443e, 0x1c83fa90,
+    0x12f9e4a4, 0xea43ced7, 0x9393720c, 0x395f4be4, 0xca31a80f, 0x2d914f4e,
+    0xa03ee47c, 0x3e3929c7, 0x90f3b544, 0xa41c83fa, 0xd712f9e4, 0x0cea43ce,
+    0xe4939372, 0x0f395f4b, 0x4eca31a8, 0x7c2d914f, 0xc7a03ee4, 0x443e3929,
+    0xfa90f3b5, 0xe4a41c83, 0xced712f9, 0x720cea43, 0x4be49393, 0xa80f395f,
+    0x4f4eca31, 0xe47c2d91, 0x85c5a03e, 0xed3ddab5, 0x0d47692d, 0x415d35ea,
+    0xf38858c7, 0x6d8921c1, 0x48dc9ab4, 0xd61984b2, 0xe1e66df3, 0x7bb66cb0,
+    0xd6c071b0, 0x368e9a2d, 0xea6ca9fd, 0x21aa0a70, 0xd1d0b0dc, 0x4c29043c,
+    0x78211aac, 0xbf000cd1, 0xc52f0ae9, 0xf4cd1f8e, 0xe6558663, 0x9957cd41,
+    0x559d1311, 0x2a9f087c, 0x9e7d54e2, 0xb66913d9, 0x6ad56695, 0x2291fbb4,
+    0xbf70c51d, 0x237ed129, 0x70459bf3, 0x46d3b0a0, 0x9638e6ee, 0xc5ee08a0,
+    0x54d0b675, 0xb875f277, 0x6ec03ae5, 0x935e9de0, 0x8143aa47, 0x10a5526a,
+    0x1cb85d37, 0x4ea32c48, 0x755971ae, 0x90375348, 0x09c74554, 0x1ccc1519,
+    0x169e6c51, 0x5694ad51, 0x5b64b8dd, 0x5d3455dc, 0xc8953b0a, 0x54a6f773,
+    0x711184fa, 0x1f36dba6, 0xf54ecb06, 0xc5f84e5d, 0x54491000, 0x0ea93495,
+    0x392eaac5, 0xda727513, 0xb6a8c3ae, 0x159c4ca9, 0xa6d44c0d, 0x068b3821,
+    0x526a0b0a, 0xdc68105d, 0x88586732, 0x0939a78a, 0x4df6d1a0, 0x2944aa53,
+    0xb4a8556f, 0x2ab56e91, 0x9f54f082, 0x116a5426, 0xcbe8589d, 0xfbd0bb65,
+    0xc4e42492, 0x71259a76, 0x7ed05cc2, 0x8aeca925, 0x51814cb7, 0xb3e8b396,
+    0x65df5225, 0x52a894b9, 0xb3ece9d1, 0x1462f52d, 0x28d05b87, 0x75e6ccc8,
+    0xcc56de86, 0x085f559b, 0x6577a518, 0x2e1d3a35, 0xd4aa406d, 0x4929f239,
+    0xb8f4aa14, 0xe9d3b712, 0x0a982fa3, 0x92036a43, 0x3e272a21, 0x71eae09d,
+    0x8d2b62ad, 0x9d69529e, 0x79955ca9, 0x95576316, 0x0b561546, 0x5d6e6011,
+    0xfbb24a72, 0xa5bba34d, 0xa86b128f, 0x8d27ea0d, 0x32273906, 0xf29da2e6,
+    0x3503165d, 0x28d7acc7, 0x8576f396, 0xa56ae152, 0x972c2ad9, 0xc580584c,
+    0xc82e5939, 0x6ed3263a, 0x92c92830, 0x0e2b1cba, 0x2bd2aa38, 0x31b2ee08,
+    0xda512dd9, 0x1a972ecd, 0x169946ab, 0xaa6c12b5, 0xe51b6a6d, 0x80239926,
+    0xa34c5914, 0xbc65b68c, 0x9953486d, 0x68561708, 0x3262a24a, 0x6db0f92c,
+    0xf3e8d469, 0x23a42a6d, 0x9c30e9ba, 0xf96943ab, 0x399d1055, 0xc58c0888,
+    0x3bee82a9, 0x52f4c61c, 0x39d9284b, 0x5cf247be, 0xecabd4fb, 0x894aab7e,
+    0x146b7856, 0x33ca841a, 0x266d360b, 0x932aa51c, 0x96c8f154, 0x1330c669,
+    0xefcabd69, 0xd4411c91, 0x448a77da, 0xd9502ba2, 0xda22d758, 0x506451ef,
+    0xb4cb2f29, 0x24103c20, 0x57271648, 0x97a48d2a, 0x08cb3ce7, 0xd3a26684,
+    0x2af98590, 0x1a78079a, 0xc55510b2, 0xb5eab2bd, 0xf8939e7e, 0x882b4dea,
+    0x2a052695, 0x314a522d, 0x2036af26, 0x0d8fbfbb, 0xadd412b4, 0xbeb6d1b8,
+    0x3d1dcc12, 0x93f5a61b, 0x969a327b, 0xea14f7eb, 0xdb9622b5, 0xac63550e,
+    0x739bce19, 0x394a9b5c, 0x3a0ab90d, 0x929f5668, 0x747745f1, 0xeabdb80d,
+    0x09f55e6b, 0x89b3a152, 0xca74fa14, 0xd5285688, 0x2476a422, 0xb8a0f0ea,
+    0xba1187fb, 0x418a85be, 0x398ca324, 0x14c55a82, 0xa6e83ea2, 0x978be779,
+    0x2e542c66, 0xd26991bb, 0x02b55668, 0xe8a85494, 0x87e441f5, 0xa7cb2509,
+    0x67877f45, 0xa9595399, 0x45a9a793, 0x75108d14, 0x7e0d2a29, 0xd56e99dc,
+    0x6ee751e6, 0x0437448a, 0x4c5dd954, 0xba000eba, 0xa012cdcb, 0x18ad83aa,
+    0x2444ea18, 0x2a2291d5, 0x377f382e, 0xb4918dd1, 0x696bb4a1, 0xaa941f7c,
+    0xf25ffc22, 0x84c35315, 0x3a9579c5, 0x9d8b68e5, 0x5552af4a, 0xedaff055,
+    0xe3c3f1d7, 0x8e0fc787, 0x383e1c1f, 0xd9f8707c, 0xb840879d, 0xdc265520,
+    0xca0fa862, 0x2e428962, 0xec644c22, 0xfa3cccbb, 0x36ee70aa, 0xe78e108f,
+    0xdfd69d26, 0xf15cbc87, 0x956bb148, 0x756ab5c9, 0x323b383a, 0xe3b2848c,
+    0xd5e9e6b8, 0x48b19050, 0x4215451a, 0xd4451d71, 0x39224024, 0x62229292,
+    0xa61bb3a1, 0x50a65a9d, 0xc91d895e, 0x202780d5, 0xb94d7994, 0x0869c115,
+    0xb77c6ba4, 0xb019be7b, 0x29d45e57, 0x6f4535f9, 0x2d96ab78, 0x5da89abd,
+    0x881bec76, 0x95e8d420, 0xccc4eab6, 0x6451458a, 0xf8549244, 0x26c0c852,
+    0x175c36c2, 0xbd69c923, 0x662281e0, 0xfc22b29b, 0x660b25a0, 0xc4cc3517,
+    0x9198d4a9, 0x1d520bc6, 0xca66a761, 0xdb24c948, 0x5ddcd452, 0xefee6a42,
+    0xd0320324, 0xbcd3b5de, 0x50341752, 0xdc736ff6, 0xe854aa13, 0xe8874170,
+    0x4ad4ace6, 0x9819a97b, 0x24a835f2, 0xcd057165, 0x3193166f, 0x76c39046,
+    0x1334c53b, 0x2cb95c69, 0x22a9bdda, 0x6ccb4a2c, 0x405c2235, 0xf8b20d98,
+    0x44b6adbe, 0x04d2a141, 0x09898ed0, 0x81132009, 0x49b898cd, 0x1c1f8ecf,
+    0x707c383e, 0xc3f1e1f8, 0xe0c787e3, 0xf7db0aec, 0xaccc677a, 0x8b2f57d0,
+    0x67ca3a34, 0xb3bfe4f2, 0xad7520fc, 0x556c48ab, 0x5ab85c50, 0x90884f43,
+    0x4413d569, 0x0b85905f, 0xdf704ce5, 0xb1fbea27, 0xab9f7cc3, 0xc92ac5ee,
+    0xa9d0a0b4, 0xb1e2cb75, 0xe2d98755, 0xea346979, 0x4a8a311b, 0x0ec46045,
+    0xb164b774, 0xa44a3728, 0x8006929f, 0x43b50dc5, 0x9ac69574, 0x239258ad,
+    0xdbaefd5c, 0xb2c80dcf, 0x3d4d625b, 0x70925bc8, 0xeb0d4ae3, 0xee09627c,
+    0x2ac838a1, 0xd824e513, 0xe5565a6c, 0x8797e916, 0xd1255629, 0x850eaf06,
+    0x7afc8c2e, 0x837245ad, 0xa289dc18, 0xbbd4e95a, 0xc0fa8889, 0xaefb093d,
+    0x5924bf52, 0x500dba03, 0x5d9ddd55, 0xe49cc6d1, 0xed98149a, 0x4d336755,
+    0x1387e384, 0x75482627, 0x44a36559, 0x1d19a590, 0xd9695434, 0x262ec348,
+    0x90a80e44, 0x233bdcaa, 0xd7d5a9b8, 0x126834a9, 0x09b70c2b, 0xdeca8c99,
+    0x53729953, 0xe676dc48, 0x5296113e, 0xf7dc601b, 0x2dd89649, 0x2c41e84f,
+    0x965704dd, 0x1a2fce16, 0x3884aa8c, 0x3fe41754, 0xd4a27c4a, 0x8ba75f10,
+    0x5a8ee431, 0x4a4ef1a3, 0x28bc8f08, 0x67d4a4a8, 0x421531de, 0x55544154,
+    0xed306781, 0xaad578af, 0x562d3e09, 0x8e4793db, 0xd94635cc, 0xc2740e6d,
+    0x3027288d, 0xbc9162f4, 0x62f20769, 0x1ef4d1db, 0x3b71c47b, 0x95d65adc,
+    0xa8d72a9f, 0xba5c97dc, 0x56e276fc, 0x34b6a55a, 0xc8f7a745, 0x02df56f4,
+    0x9041a636, 0xc4955a4a, 0x74441752, 0x79de4de9, 0x3d9bdcaa, 0xb7edb761,
+    0x352ac76c, 0x775c37b8, 0x96c6a55c, 0x695323cb, 0x4b06dad8, 0x8fb04972,
+    0x53055b1d, 0x71aba474, 0x1ad08ed8, 0x4bd364ba, 0xb7e7ce29, 0x82ce5572,
+    0x570929b4, 0x833f8b08, 0xf28e2127, 0x22d5e818, 0x9190853c, 0xa3110225,
+    0x7848c36b, 0x3436e491, 0x02749aef, 0x053a915d, 0xb54c2205, 0x9571b3e5,
+    0x959816cf, 0x38c1a935, 0x31a74dd9, 0xa2182d22, 0xc6365337, 0xa5f6bb53,
+    0x00192571, 0x761a711b, 0x692b1250, 0xddedd955, 0x55bba745, 0x446550aa,
+    0x1de5c380, 0x1d7124e9, 0x4d479d16, 0x621b5784, 0x7304af43, 0x4b6d3778,
+    0xca23d256, 0x982fab6c, 0xb85c61c8, 0x8c5457b6, 0x74db6591, 0x984aa5da,
+    0xb13add96, 0x90fb9452, 0x24955989, 0x98253b25, 0xc90d21a2, 0xb62cd300,
+    0x323b1a63, 0x6b1a02e5, 0x455a5723, 0x2d17d9a5, 0xa5aa046a, 0x742a8d2a,
+    0x89f85a08, 0x33516e0d, 0x038e376c, 0x3fe0380d, 0x720ec031, 0x1d521b6a,
+    0x353a404d, 0xb0462118, 0x8e9499ae, 0xb8a346cf, 0x95181df5, 0x10498e27,
+    0x9c303704, 0xe8966436, 0x4d8d0ce5, 0x358ad9b8, 0xa53ddfb9, 0x4edc8655,
+    0xe5d9487c, 0x7c1a4bcf, 0x5416d5ba, 0x70c96c1a, 0xe48d14e3, 0xb3b83633,
+    0xa6790404, 0x6ee87d9e, 0x93409610, 0x72276b18, 0xf9798768, 0x5d36563c,
+    0xbda63b58, 0xd3a9b444, 0xcea8d0ea, 0x4a646dc4, 0xa7d19e7e, 0x8d3c0a13,
+    0xb17bc92e, 0x5b771cd1, 0x8a6c93a7, 0xa682b418, 0x26e57719, 0x8714229b,
+    0xe3604be2, 0xb3e98c4a, 0x43838721, 0xe9dabaac, 0x3955cc36, 0x5c325588,
+    0xea27df70, 0xe6b3b1fb, 0xd5deabc9, 0xec155530, 0x1e333de5, 0x886fd265,
+    0xcccd6712, 0xe32b4a42, 0x5bfc5445, 0xb59f606d, 0xa82a6420, 0xc311c1dd,
+    0xd823f8cb, 0xab68abfa, 0x8fe0d6e6, 0x0b8e49ca, 0x00fffdcd, 0xf8253856,
+    0x95f845b3, 0x34be283c, 0x29b1f8e6, 0x9dea16db, 0xf5abb94e, 0xecf93449,
+    0x62dd8a46, 0x12e99486, 0x043da99b, 0x531a2e13, 0xc4b4ad48, 0x5e1490ac,
+    0xf40e2552, 0x8a879fd5, 0xa55afb74, 0x99edb84b, 0x4bb3f5a4, 0xb38256a8,
+    0x77cc9047, 0x46c42daa, 0xd2085b90, 0x4372429a, 0x96d8a08a, 0x1cede642,
+    0x65b38574, 0xed159bb6, 0xd7cc808e, 0xf7964461, 0x0556e962, 0x4fa7d94a,
+    0xed8dc490, 0xc2ea7346, 0xd160a38a, 0xa13ac0b8, 0xb4e82df9, 0x8b8a68db,
+    0x88234dbb, 0x11438a15, 0x93db5ef6, 0x9fdd5610, 0x9bac7e57, 0x04c24b89,
+    0xc93a8ca9, 0x3d2a4c2e, 0x289700ac, 0x011fe5fb, 0x15cb5569, 0x4422d54a,
+    0x9bd9d108, 0xf36983a8, 0x7103276e, 0x4eb11329, 0x53e3904b, 0x8a085317,
+    0x23210e8a, 0x5653f23c, 0x6816ca4a, 0x37d42b93, 0x7f4c1baa, 0xb8d9708d,
+    0x318da21a, 0x4f4b6a59, 0x8b8a484c, 0x23375820, 0x11744512, 0x53721b15,
+    0x92e60860, 0x53517041, 0x6dc50d17, 0x11aab6cf, 0xb91c5664, 0x961d3fe5,
+    0xe8d4ada8, 0xa45cb16d, 0xc55b93b9, 0xa8655791, 0x26111fd1, 0xb24c86b7,
+    0xa8849b2f, 0xcc05c96e, 0x60efba2d, 0x1c8adb6c, 0xfad4933a, 0x079cbadc,
+    0xf80223e1, 0x8d366cba, 0xc1178504, 0x4a1364a5, 0xe0b8281a, 0x22792611,
+    0x97da99e6, 0x80aef13b, 0xa693dcaa, 0x094c6e4c, 0xbfe6a734, 0x8cd875fb,
+    0xe8200d49, 0x04bae832, 0x389147db, 0x30d1e5ce, 0xd2653327, 0x748b1225,
+    0xe85621d1, 0xb5135740, 0x55e83418, 0x50727a92, 0xed69d2e2, 0x741f9d4a,
+    0xf46970cb, 0x413353da, 0x9e20c34f, 0x7a4a4376, 0x51e73208, 0x66c0e5b6,
+    0x6f866ed3, 0x7b3fa9e9, 0x450d6ad1, 0x46993ddd, 0x93eda968, 0x5869d4bb,
+    0x4db2894c, 0xde39ea24, 0xb32ca7e7, 0xe8b55fb8, 0xaed2db55, 0x8a544ad5,
+    0xca044aed, 0x134a513a, 0x99c90ca8, 0x945ca61d, 0x1e365753, 0xc283908d,
+    0x396260d6, 0x65594686, 0x6645bd0a, 0x0eaab0e9, 0x0e0dca4e, 0x9c4f8fd6,
+    0x522d0fef, 0xa266d134, 0x48bb352e, 0x9b8be3ea, 0x209b8acc, 0x649a6be3,
+    0xa5aaa0e2, 0x76a2e80a, 0x75491422, 0x28922897, 0x96a44a75, 0x4a14aac9,
+    0xb228d5ab, 0x9229bde4, 0x0c3abfa7, 0x13cca6d1, 0xb6e98ad0, 0xb09667da,
+    0xf7385124, 0x579b6a05, 0x49f168b6, 0x6e4ba4f7, 0x6755abe8, 0xdcbd71c5,
+    0x995c129e, 0xebb8014e, 0x57402311, 0xd5c4699d, 0x190888c2, 0x8a0834f3,
+    0xdbaf5a89, 0x8a2e518e, 0x1faf3e7d, 0x48b3a984, 0x2d1a355a, 0x20064422,
+    0xde31390c, 0x44a80f94, 0xfe9edd06, 0x13f9864a, 0x68c66d88, 0xd3484616,
+    0x11553762, 0x748e7b6e, 0x295da25b, 0x364ae7a9, 0x54513add, 0xd13875e8,
+    0x4462c7a0, 0x22d79459, 0x466e5237, 0x909575b0, 0xe3ba98cc, 0x2892889a,
+    0x54e81d09, 0x3ac59d7a, 0x7133065d, 0x888cc6a9, 0x46b83123, 0x84b6755d,
+    0x5cd4901e, 0xc6db20bf, 0x820a622a, 0x50ccf04b, 0x79c1b1c8, 0xc6eabfbf,
+    0x5f28e2cb, 0xbde4f996, 0x7995d4e1, 0xaad119bc, 0xc6839f23, 0xc2ef9f48,
+    0x7b09b362, 0x7fef5631, 0xf4873ae5, 0x79c1b1b7, 0xb179c1b1, 0xc1b179c1,
+    0x79c1b179, 0xb179c1b1, 0x03277fc1, 0xca2db35a, 0x9543ab25, 0xf4f3fa11,
+    0xb2bc66b0, 0x4630b528, 0x715e5623, 0xe47a4fc7, 0xd20bad59, 0x16203518,
+    0xd96ede9d, 0x478ea2dd, 0x1cfa39cf, 0x00ffad6a, 0xa955a654, 0x67cbdda2,
+    0xb98131f1, 0x54a937f1, 0x61320690, 0xf8ba0b20, 0x201e1cd7, 0xd7bee5e3,
+    0x36479320, 0xb25bae29, 0x3dcaec23, 0x6612745a, 0x2fb00a97, 0x40c1e4b4,
+    0xa5783385, 0xe9960a4c, 0x7d1c76d4, 0xf38ed262, 0x10041a74, 0x28af21bf,
+    0x135b2a95, 0x579314ec, 0x32e904b6, 0xd89da16e, 0x52e350a9, 0x0332e1e9,
+    0x292d0bbc, 0x46c7791b, 0x28e1b8c9, 0x4022ced5, 0xf9213992, 0x6371462a,
+    0x0d5aee51, 0x9acb11b3, 0xabfdbe05, 0x18926b3e, 0x4947fa9c, 0x739ec80d,
+    0x224e9d1b, 0x28f94570, 0xa879ef1d, 0xf72cc291, 0xb3a34d62, 0xcd2b54ea,
+    0x3592deab, 0xa9247468, 0x6173a954, 0x0b97a9ce, 0x991ea516, 0x47432c1e,
+    0xbe6f35dc, 0xeda36375, 0x50bf49b0, 0x5b74cb26, 0x527bb7b7, 0x6a3fd98a,
+    0x6b0e3223, 0xe694da4d, 0x10e298db, 0x52c7b69c, 0xef139304, 0x9d1cdfc4,
+    0x14f93e21, 0x383e5797, 0x2f38362f, 0x362f3836, 0x38362f38, 0x2f38362f,
+    0x362f3836, 0xb2c21036, 0x78b9d2fd, 0x9ba7a25a, 0x67bfd5e1, 0xd67746b7,
+    0xcf721ce5, 0xfd2ff02a, 0xfc4f519b, 0xbef9c071, 0x0f1cbb8f, 0xb0fbe89b,
+    0x066dd156, 0x9146b5dc, 0x46d59c3a, 0x2afd86dd, 0xeb6b06a7, 0x57d9c61d,
+    0xd8969880, 0x34296e0b, 0x010d3f62, 0x1b2dc205, 0x002eebcd, 0x3dba94db,
+    0x5b73bf12, 0xf1f82ab4, 0x63071a95, 0x89979529, 0xc91a5bb6, 0x3426652b,
+    0xaa772c69, 0xcb7aef86, 0x18ea8282, 0x70be2193, 0xb0a2c705, 0xce4622f5,
+    0x49ddeaed, 0x0ec1a59a, 0x705097e2, 0x3a4c49c2, 0x48a3077c, 0x4b76d846,
+    0xf2a83ab9, 0xf5de06b8, 0xa08a5007, 0x2ad0b6a2, 0xab7c3abb, 0x7200ff72,
+    0x932ef954, 0xe83d8d37, 0x251d7284, 0x7ca0a28b, 0x494d55f1, 0x34641184,
+    0x745054ee, 0x8a4ba622, 0xd5e213c3, 0x4fd8baef, 0xb2558b42, 0x7544bb64,
+    0xc2646689, 0x6e131631, 0x31cc4913, 0xf32dde88, 0x2c55827b, 0xf2c4ecd1,
+    0x521d1ac5, 0x34a8b3e7, 0x34ba7afb, 0xa91ea5ea, 0xb7754d3a, 0x92c40faa,
+    0x6f94c9fa, 0xc0715033, 0xd0a1ecd4, 0x60e6ce69, 0x7aada9a7, 0x2417cb9a,
+    0x5e3a3598, 0xe3809fd4, 0xf6ebb44f, 0xbd252b7b, 0x43641308, 0x25931974,
+    0x215005b4, 0x8c5cd071, 0xde444333, 0x7816aa22, 0xdb6eeab4, 0xcbac3dbb,
+    0x7b2e1562, 0x6fc573ab, 0x2945ab86, 0x825c5491, 0x016e6ede, 0x3a780be6,
+    0x90d7c23b, 0x9fcbdcf7, 0x4a779d35, 0xe584ddae, 0x5746a174, 0xd4281368,
+    0xca899138, 0xaf2b364d, 0x7148752c, 0x447603de, 0xd2b99b33, 0xc8ae3732,
+    0xa3b65147, 0x3a16692e, 0xafc5fa30, 0x37ce6953, 0x45da240a, 0x882e70a1,
+    0xd9b5c9f5, 0x40410611, 0x4f658671, 0xf26547a8, 0xebbd5571, 0xe6bae128,
+    0x2de44aeb, 0xf5ad5a2b, 0x449f457a, 0x22b94f39, 0x9646ed49, 0xe13e8ef3,
+    0x619afb3a, 0xcd086d44, 0x902c53c5, 0xf8127550, 0x158b2f13, 0x5d6993b8,
+    0x8a15abd1, 0x4af479f4, 0x2e850ad4, 0x1b270195, 0xaeb9c7e5, 0x1f86503b,
+    0x02f43038, 0x33e28a43, 0x765a90a8, 0xb6d8c843, 0xb2698ce2, 0xe1b3f9d2,
+    0x9e86c724, 0x8c6b1816, 0x37469a2f, 0x44ed0c8e, 0xa35b48eb, 0x92334c3d,
+    0x031dea90, 0x7ad0e292, 0xeb96db39, 0x951242d0, 0xb25bedb4, 0xa8e32e65,
+    0xb8a61bd1, 0x523e2472, 0xc3864124, 0xcb4ceaf1, 0x59c4c968, 0x2902ad60,
+    0xe8c2f720, 0x22ee7985, 0x6ad8b2d2, 0x7deab46b, 0x9471b942, 0xc12089c4,
+    0x6dfd8ab0, 0x663e45e5, 0x3a2d83f5, 0xb4f9de64, 0x084af844, 0x34e50abe,
+    0xb66e5122, 0x861d851b, 0xd25aacde, 0xab2acba3, 0x65ad7a95, 0xd6b46aa6,
+    0xe735adca, 0x4cf3bea4, 0x118b6d23, 0x596c20d9, 0x5221c8dc, 0x624cd36c,
+    0xbce52291, 0x2a0ded69, 0xd5da1da1, 0x1cb05336, 0xd5a4caa9, 0x20620723,
+    0x244ae5b0, 0x92b8ed88, 0xb0051101, 0x6d82496c, 0x0664cdf0, 0xf05f4cb0,
+    0x59dd15e1, 0xa95d1328, 0xca992746, 0x610ad24b, 0x202b06ef, 0xea591ceb,
+    0xc1152139, 0x66baed58, 0x03b1a167, 0x7402d375, 0xd1371ff8, 0x87c862f7,
+    0x8bb6f0a2, 0xa75a832f, 0x1e90eaaf, 0xa35ac56f, 0x6453afc4, 0xab0ae7d2,
+    0xe13b0512, 0x024e5bcb, 0xf3e669ea, 0x68b435cd, 0x4ba69984, 0xabcc2bce,
+    0x35393687, 0x5855b70c, 0xe97dde44, 0x6ae0cb38, 0xd611ca9f, 0x2f21bf28,
+    0x95e38ecb, 0xfaa7941e, 0x3be61e39, 0x527a548e, 0x7be4e89f, 0x5139ee98,
+    0xa37f4ae9, 0xb863ee91, 0x29a547e5, 0xb9478efe, 0x1e95e38e, 0x39faa794,
+    0x8e3be61e, 0x9f527a54, 0x987be4e8, 0xe95139ee, 0x91a37f4a, 0xe5b863ee,
+    0xfe29a547, 0x8eb9478e, 0x941e95e3, 0x1e39faa7, 0x548e3be6, 0xe89f527a,
+    0xee987be4, 0x4ae95139, 0xee91a37f, 0xd5909d61, 0xdaa77958, 0xd6c553ab,
+    0x8be66d1d, 0x7169f974, 0xc80243a3, 0x885c519b, 0x54247251, 0xa6a2025f,
+    0xb7aeec27, 0x7c229953, 0xe93dcdda, 0xfb788f72, 0xd61b87bb, 0xa1e72079,
+    0xe6b181a6, 0x4411e614, 0x8fca71c7, 0x1cfd534a, 0xc71d738f, 0x4f293d2a,
+    0xcc3d72f4, 0xf4a81c77, 0xc8d13fa5, 0x72dc31f7, 0xff94d2a3, 0xdc234700,
+    0x8fca71c7, 0x1cfd534a, 0xc71d738f, 0x4f293d2a, 0xcc3d72f4, 0xf4a81c77,
+    0xc8d13fa5, 0x6c6731f7, 0x24b33df6, 0x0c6432aa, 0x4db682da, 0xa0b6ad32,
+    0xb73c60c4, 0x33b31a8a, 0x6b34d174, 0xa420085d, 0x57ab2b28, 0x5bf6bae2,
+    0x4d4a7d26, 0x64ec884a, 0xef138e19, 0xce469043, 0x70e7f3ed, 0xc4057199,
+    0x3df37420, 0x89a08104, 0x59461745, 0x3fba2877, 0x47d70733, 0x8b72c7dc,
+    0x7d30f3a3, 0x77cc7d74, 0x333fba28, 0xdc47d707, 0xa38b72c7, 0x747d30f3,
+    0x2877cc7d, 0x07333fba, 0xc7dc47d7, 0xf3a38b72, 0x7d747d30, 0xba2877cc,
+    0xd707333f, 0x72c7dc47, 0x30f3a38b, 0xcc7d747d, 0x3fba2877, 0x47d70733,
+    0x8b72c7dc, 0x7d30f3a3, 0x77cc7d74, 0x333fba28, 0xdc47d707, 0xa38b72c7,
+    0x747d30f3, 0xac50cc7d, 0x3280defb, 0xbf0d621a, 0x1795343a, 0x4651250e,
+    0x137c615c, 0x516cc848, 0x461e7059, 0x1ccd9ad4, 0x866a40d0, 0x05d9a804,
+    0xeebdc572, 0xa03ecb19, 0xece6cd14, 0x24a66919, 0xb0e3518b, 0x8665e919,
+    0x454032f2, 0xdcfc5e55, 0x35e75535, 0x45b9cbe6, 0x3e98f9d1, 0x3be63eba,
+    0x991f5d94, 0xeea3eb83, 0xd145b963, 0xba3e98f9, 0x943be63e, 0x83991f5d,
+    0x63eea3eb, 0xf9d145b9, 0x3eba3e98, 0x5d943be6, 0xeb83991f, 0x7660eea3,
+    0x2229734f, 0x17c15328, 0x343345c2, 0x640bf74f, 0xc5e4feab, 0x6931699b,
+    0x1c61ddd3, 0x30cce617, 0x15816c76, 0x546c2511, 0x5eb4655a, 0x4728d37d,
+    0x222557a5, 0x56873c33, 0xc62bfb49, 0x8ca60bdb, 0x355a3fe5, 0x5442b721,
+    0x033d4b37, 0x4421b421, 0x43d72c73, 0x928d9b8d, 0xb53a66a2, 0x2b592e22,
+    0x1abb34bb, 0x93c30e32, 0xe3cc8ba8, 0x661b6132, 0x7fa8e599, 0x2f22216c,
+    0x1e008ec4, 0x774c115e, 0x0e3abb39, 0xf685a647, 0x2ece2e8c, 0x9fd0f0b5,
+    0x5fd8955f, 0x8b73c768, 0xf49fa0b3, 0x8ed1bed0, 0x595e17e7, 0xbcfc0976,
+    0x7f59d85b, 0x8b73c748, 0xe69fa0af, 0xc2da00ff, 0x9b3b46fb, 0xff027ddd,
+    0x58f78f00, 0xf81f1f5e, 0x176717c6, 0x4f68f85a, 0x2feccaaf, 0xc5b963b4,
+    0xf34fd0d9, 0x7d61ed7f, 0x2ece1da3, 0x9f600fcf, 0x2f2cfdcf, 0xc5b963b4,
+    0x3d52d0d9, 0x63b42f34, 0xe0d7bdb9, 0x78f90bec, 0xd1beb0b7, 0xdb1d1688,
+    0xc9397c06, 0x43e1be6f, 0x024a1e95, 0xce1b84c8, 0x0175d11d, 0x284a7e4f,
+    0xa467394a, 0x973ccfb2, 0x91b58ac1, 0x956ad576, 0xaf5b990a, 0xbfe57332,
+    0x10499a2c, 0xeeabdd9c, 0xe6bd9b13, 0x73d014f8, 0xcf8156cb, 0x83a7f42c,
+    0xbf2ece1d, 0xf19f6007, 0xc30bebfe, 0x71ee18eb, 0x84fcaf75, 0x833700ff,
+    0xd1beb0f2, 0x6717e78e, 0x61e93f41, 0xcd1da37d, 0x7b81aeee, 0x46fbc2d2,
+    0x7edd9b3b, 0x97bfc00e, 0xed0b7b8b, 0x7673ee18, 0x4d8f1c74, 0xee18ed0b,
+    0x1c747673, 0xed0b4d8f, 0x6db6b118, 0x3d520d3e, 0x45d8b662, 0x8bbe2548,
+    0xd7691d0d, 0xf989905c, 0x09261d27, 0x95b6c1c6, 0xea288877, 0x21084eb8,
+    0x17128a20, 0x5219e5fe, 0xec8e41a3, 0x8b1992b9, 0x1e578015, 0x65c02191,
+    0x247c8096, 0x80288ee3, 0x53d5788a, 0x669fed0e, 0x954db88c, 0xb94224cc,
+    0xae49b32a, 0xe87f6dc8, 0xeb981ebd, 0x32709e46, 0xd96c774c, 0xec879497,
+    0x31aa8f2b, 0x5e66b3dd, 0xaeb01f52, 0x76c7a83e, 0x487999cd, 0xfab8c27e,
+    0x36db1da3, 0xfb21e565, 0x8ceae30a, 0x97d96c77, 0x2bec8794, 0xdd31aa8f,
+    0x525e66b3, 0x3eaeb01f, 0xcd76c7a8, 0x7e487999, 0xa3fab8c2, 0x6536db1d,
+    0x0afb21e5, 0x778ceae3, 0x9497d96c, 0x8f2bec87, 0xb3dd31aa, 0x1f525e66,
+    0xa83eaeb0, 0x99cd76c7, 0xc27e4879, 0x1da3fab8, 0xe56536db, 0xe30afb21,
+    0x6c778cea, 0x879497d9, 0xaa8f2bec, 0x66b3dd31, 0xb01f525e, 0xc7a83eae,
+    0x7999cd76, 0xb8c27e48, 0xdb1da3fa, 0x21e56536, 0xeae30afb, 0xd96c778c,
+    0xec879497, 0x31aa8f2b, 0x5e66b3dd, 0xaeb01f52, 0x76c7a83e, 0x487999cd,
+    0xfab8c27e, 0xcdb609a3, 0xdbe52a99, 0xe8f87321, 0xfb271277, 0x271969d5,
+    0xa2d8bcca, 0x8e5b145c, 0xa9431d27, 0xcf45a945, 0xf31c3949, 0xa1c3cf26,
+    0xe60589e6, 0x769fcb1c, 0x737960f3, 0xbff197e5, 0x5b3e11e1, 0x926efb74,
+    0x2a3184d3, 0xe5722a32, 0xe25bae80, 0x633c8da6, 0xce00ff01, 0x39ee2901,
+    0x80b779a5, 0x03662ad9, 0xfdcde396, 0x385600ff, 0x3896ef7f, 0x2c96ef7f,
+    0xeaee44fb, 0x9a4014eb, 0x997df214, 0x474e712f, 0x1d090259, 0x5a5175a5,
+    0xd4555917, 0xc47b9689, 0x71c9e1d3, 0x7083d95b, 0x542bf368, 0x758dae1b,
+    0x7690a5c7, 0x006aaa59, 0x1797053f, 0x19514848, 0x43c0d172, 0x5a1575e6,
+    0x44dc0c20, 0x76341730, 0x25e1662e, 0x52b89270, 0xc3934154, 0xa992c339,
+    0xb4474468, 0xfb54d5ee, 0x722e44d4, 0xb8387cef, 0xb8b5aa2c, 0xb6342afd,
+    0x5a15e9d5, 0x61836a6c, 0x00cd8715, 0xdce89ba5, 0x556c2214, 0xd0b46de9,
+    0x0860fb38, 0xb4bb9bad, 0x9c471043, 0x9cf1037a, 0xe86149dd, 0x2b21a2ee,
+    0xb84cb26f, 0x74055f82, 0x17598238, 0xbf64b9c4, 0x9afd2d16, 0xb15bab40,
+    0xe5a53a6e, 0xcbe3b64b, 0x4d1b2a99, 0x448ea2d4, 0x545153ec, 0x617cce17,
+    0x3d152432, 0x7c8a1908, 0xcfc5e16b, 0xaaedd462, 0x4af363a7, 0x66c32eb3,
+    0x4da10aa3, 0xcaa3c765, 0x063348a7, 0x7b28e464, 0x0c08cc9c, 0xfe44cc14,
+    0x0381ae03, 0xee891484, 0xc22deb38, 0x7eace398, 0x7845d0ee, 0x30fd67dc,
+    0xe0372908, 0xcf83865f, 0x529d6d8a, 0x77ab50aa, 0x0e4e7404, 0x711bb18a,
+    0x24d769b4, 0x865c7a4a, 0x80c0d0da, 0xd18e6828, 0x112e891c, 0x638bd0e6,
+    0x4d7554bb, 0x4649a7b5, 0x7dc75206, 0x04289922, 0x39d26095, 0x8022299a,
+    0x8de8963d, 0x42310f14, 0x9b0bef55, 0x36765cbd, 0x6959c752, 0x45c4421a,
+    0x3b92b2d2, 0xb416329c, 0xa7bf4a6f, 0x54bc8574, 0xad67b50c, 0xe5127e50,
+    0xb07c7686, 0x5cee5aa4, 0xa541a4b2, 0x4d2491dc, 0xe9d4e957, 0x193019b5,
+    0x46ecc418, 0xae9861de, 0x38e47238, 0xcb8ebc89, 0xcd19ee4e, 0x1c5171d2,
+    0x432a8ddc, 0x5118c8ee, 0x08064be5, 0x3a6326b3, 0x24ea2d64, 0x15447403,
+    0x9e83d45a, 0xa2928346, 0x6eb8c4a7, 0x23e1219f, 0x01dd8769, 0xb689c026,
+    0xd24dc44c, 0x0a11d0d0, 0x6a38212a, 0x39afd882, 0xab287a97, 0xc3bc6087,
+    0x3aedcb84, 0xb696a1c3, 0x709a689e, 0x6a120a35, 0x7348d06c, 0xd14c1212,
+    0xf0451533, 0xfe87632a, 0xfe8763f9, 0xf38763f9, 0x8dd57f7f, 0x02994c88,
+    0x871181fd, 0xa3556308, 0x9f398b4f, 0xe0113ae0, 0xd41c9d49, 0x9fc61b7c,
+    0xf81c1a8c, 0x08bcd942, 0x5f245cba, 0x01c26fe3, 0x1fed7495, 0xf4c38de4,
+    0x00ff0bad, 0xfd6b702c, 0x00ff00ff, 0xb1f9c131, 0xb2b1f9c1, 0x782fda28,
+    0x00ff9745, 0xeb27a942, 0x668b498a, 0x945babdc, 0x5ba1f29b, 0x12992683,
+    0x943ab355, 0x706f4dc2, 0x4bd4e6b2, 0x07191477, 0x27cd0911, 0x5051a8cf,
+    0x4c554533, 0xb159b8f9, 0x74ea35a8, 0xfc4955c9, 0xc111ce26, 0x5bc48e35,
+    0x14b5396a, 0x23e042e4, 0x9ad43802, 0x7e22b48e, 0x0c924c6e, 0xea2e4d60,
+    0xd9ee84fc, 0xbd1d77ea, 0x3d7e8f33, 0x55962d32, 0x2edd9045, 0xa77ea31c,
+    0x50a31b22, 0x99e47f1a, 0x9418c85e, 0x7c1b4057, 0x8d029d41, 0x89e922b6,
+    0xfe3e4eed, 0x30c9619b, 0xa3dcefa8, 0xc13a03cd, 0x1a67d58b, 0x05132107,
+    0x93487b51, 0x46b83492, 0x4ed2b37a, 0xd4256a12, 0x837a4f67, 0x2e346603,
+    0xbf0ad0cf, 0x54f56b1d, 0xa4d43866, 0xea2e77d3, 0x72d55575, 0x9839a12a,
+    0xbd0b1ae6, 0x8bc3cfe7, 0x5299ee7e, 0x41adf37a, 0x6824c588, 0xa1c442d6,
+    0xf60569c3, 0xde08b5e0, 0xf19e3276, 0x0beedbbd, 0x3475ada7, 0x02082a8d,
+    0xaa8ba2b6, 0x5bf03e99, 0xb353854a, 0xaa5525c5, 0x8b94cad5, 0xa15053ba,
+    0xd3fc9248, 0x98a07b98, 0x1e63360e, 0xdfd14731, 0x58ee0cb4, 0xc23828dd,
+    0xd9413d1f, 0x3aede1f1, 0x264aae0d, 0xeb2beadc, 0xf268041a, 0x16758911,
+    0x56e66e59, 0x8874d840, 0xdf5ca64d, 0xc648426a, 0x971b932e, 0xcd155711,
+    0x951a74db, 0x4cab8037, 0x8e4ebbb5, 0x0d621b91, 0x2706cdba, 0x544c5ded,
+    0x54a5d463, 0x63764f22, 0x8c25e96e, 0x2d246622, 0x1a311a39, 0xfb548f8b,
+    0x6d1a0171, 0x49a64fbb, 0x12c6cab2, 0x46ada96d, 0x2ce1966a, 0x295c5745,
+    0x1bef2262, 0x9c6216e0, 0x16182296, 0x1069e2f9, 0x5d0637a5, 0x64476576,
+    0xaee33ccf, 0x3fa51cd3, 0x1dc96322, 0xebaa6084, 0x4adb9c41, 0xabc8b64f,
+    0x9075ac6e, 0x3618c082, 0xb595a843, 0x5a4a4221, 0x5eebf4dc, 0x810d2bdf,
+    0x6a576527, 0xccb8b2dd, 0x399e9248, 0x58705109, 0x1dfc7666, 0x9a702326,
+    0xa31b7c53, 0x6fc99d6d, 0xd4dfd79a, 0xf76e3725, 0xdc5ba856, 0x9718323b,
+    0x0bd1b86d, 0x1d62482c, 0x358d435a, 0x901ae635, 0x912bacdb, 0xa0fbbea5,
+    0x7203d986, 0x878c2675, 0x27ac3646, 0x546b9750, 0x9359409f, 0xf36b3aed,
+    0xf716001d, 0xa9991aaf, 0x64328f28, 0x39515aa6, 0x734a1785, 0x3f382622,
+    0x363f3836, 0x7ff13538, 0x938dd57f, 0x81f65646, 0x64173f40, 0x413d9afe,
+    0xb5f68d3f, 0xd3ac4b6e, 0xb4e1d3a9, 0xe4900e72, 0x8a2df3bd, 0xd1349c9b,
+    0x0474bc8f, 0x1cdd5273, 0x2622b546, 0xf88b087a, 0x89069f2b, 0x9c66b9cc,
+    0xf1259eca, 0x364f8463, 0x7ef34438, 0x502944bc, 0x6530491e, 0x502085c8,
+    0x90446484, 0x49c467ec, 0x59472132, 0x93107130, 0x220b9198, 0xd9c4654e,
+    0x03906ad5, 0x46ad1a75, 0xad65dba0, 0x543e9db0, 0x32956cb0, 0xd77d0152,
+    0x99534910, 0x2e175154, 0xb44e256c, 0xac640c8c, 0x323012d5, 0x543a8251,
+    0x1d0123a6, 0xe03840c1, 0x2c76fbd6, 0xb4012218, 0x88428082, 0x0a982a24,
+    0x8ab16995, 0x8d6ad62d, 0x10d21c8c, 0x039652b7, 0x64b2090d, 0xc80b2292,
+    0x225ad191, 0x333a7769, 0xbd17946c, 0x914b4c55, 0x6323a850, 0x6836a33e,
+    0x439b4eb4, 0x51f26332, 0xbeb57ca3, 0x68c6a36d, 0xeef7f104, 0x17aee490,
+    0x82ab6a7c, 0xb8154559, 0x42412e25, 0xa879c265, 0x8ac52165, 0xb79ea7d3,
+    0xbaa58e5b, 0xd4350f07, 0x9a450862, 0x1686abe6, 0xdc905054, 0xb7237269,
+    0x5062a52d, 0x42c62131, 0x99f0054b, 0xa3902d90, 0x9b6b2ecd, 0xfc02216e,
+    0xaa528869, 0x63e7dd54, 0xfba953aa, 0x0cbcb7ec, 0xba3711d9, 0xdcbcd373,
+    0xb3bcde38, 0x9667b55c, 0x2289d87c, 0x289e00a3, 0x8ab01935, 0x51906942,
+    0x9f183f26, 0xf2d2751e, 0x8eae60b2, 0xea91ab6a, 0xe357d54c, 0x898a2c5c,
+    0x54690a42, 0xb5399566, 0xa63cddd4, 0xb580b03e, 0x1411e611, 0xc8ba02f7,
+    0x176d318b, 0x55f81251, 0xd2d4c571, 0xa746d312, 0xe1c5693c, 0x09d9a4a7,
+    0x77f47b05, 0x70f3269e, 0x734494bf, 0x211a3e9c, 0x0ccf247c, 0x9a316b54,
+    0xcd6ac48e, 0x0c113b52, 0x15cb889c, 0x15b56c19, 0xce4447c3, 0x20ba6d3b,
+    0xf8be98c1, 0xa4823491, 0xaa8a3a2f, 0x25711e8e, 0xb86f20d5, 0x1742a50a,
+    0xe1c8b910, 0xbf8d4927, 0xb7777e5e, 0x7bf5062e, 0xf879f8e2, 0x12b8c657,
+    0x2212db96, 0x1a01b984, 0xe352b662, 0x8905878c, 0x1aefd144, 0x6ea12c29,
+    0xefdc56df, 0x944457db, 0x971cbe0f, 0x5c4a129f, 0x3217cfcd, 0x9119ae44,
+    0x90891f8f, 0x703cfce3, 0xbd310cf8, 0x1f32dd22, 0x20bd69c1, 0x84e3103f,
+    0xc7eb374f, 0xd76f9e08, 0xdf7c0c8e, 0x6b553646, 0xc5bc72cc, 0x60269a78,
+    0xa1939b53, 0x924415e2, 0xc5ee98fc, 0x44559916, 0x1b0f80d6, 0xa0aa18ae,
+    0xab7380a8, 0xe5c6df9c, 0xa3ae2916, 0x8c97c18c, 0xf5976c99, 0x0a8ee7a8,
+    0xbd91e81f, 0x38ee5e03, 0x46a27f28, 0xb87b0df4, 0x89fea1e0, 0xee35d01b,
+    0xfa8782e3, 0xd7406f24, 0x1f0a8ebb, 0x03bd91e8, 0x2838ee5e, 0xf446a27f,
+    0xe0b87b0d, 0x1b89fea1, 0xe3ee35d0, 0x24fa8782, 0xbbd7406f, 0xe81f0a8e,
+    0x5e03bd91, 0x7f2838ee, 0x0df446a2, 0xa1e0b87b, 0xd01b89fe, 0x82e3ee35,
+    0x6f24fa87, 0x8ebbd740, 0x91e81f0a, 0xee5e03bd, 0xa27f2838, 0x7b0df446,
+    0xfea1e0b8, 0x35d01b89, 0x8782e3ee, 0x406f24fa, 0x0a8ebbd7, 0xbd91e81f,
+    0x38ee5e03, 0x46a27f28, 0xb87b0df4, 0x89fea1e0, 0xee35d01b, 0xfa8782e3,
+    0xd7406f24, 0x444484bb, 0x3c1111c9, 0xfb9fcc49, 0xc4ff7fba, 0x00116100,
+    0x03020102, 0x060d0602, 0x04080e06, 0x01000704, 0x05040302, 0x13121100,
+    0x16140621, 0x15543122, 0x55514117, 0x94939261, 0xf0d5d3d1, 0x71533223,
+    0x1007d495, 0xd2524233, 0x50402420, 0x81747262, 0xb4b3b1a1, 0x3430e2e1,
+    0x82734336, 0x6425a491, 0x4435c180, 0x65639083, 0xc2b27570, 0x00daffc4,
+    0x01020108, 0xff013f01, 0x7d2dd400, 0xc86cd9e6, 0x13c7d556, 0x67889891,
+    0x0e77c424, 0x14ce30ca, 0x016640e4, 0xdd6a0449, 0x187bc383, 0xe3a3eafc,
+    0x00ffe714, 0x31fa0776, 0x7e1f8bcb, 0x00ffd1af, 0x585c8ecf, 0x8f7ef5fb,
+    0xe2727cfe, 0xf4abdfc7, 0x97e3f37f, 0x5ffd3e16, 0x9f00ffa3, 0xf7b1b81c,
+    0xfc1ffdea, 0x8fc5e5f8, 0xffe857bf, 0x2ec7e700, 0xbffa7d2c, 0x3e00ff47,
+    0xef637139, 0xf93ffad5, 0x1f8bcbf1, 0xffd1af7e, 0x5c8ecf00, 0x7ef5fb58,
+    0x727cfe8f, 0xabdfc7e2, 0xe3f37ff4, 0xfd3e1697, 0x00ffa35f, 0xb1b81c9f,
+    0x1ffdeaf7, 0xc5e5f8fc, 0xe857bf8f, 0xc7e700ff, 0xfa7d2c2e, 0x00ff47bf,
+    0x6371393e, 0x3ffad5ef, 0x8bcbf1f9, 0xd1af7e1f, 0x8ecf00ff, 0xf5fb585c,
+    0x7cfe8f7e, 0xcb9a7051, 0x3514eb5c, 0xc9b1928a, 0x025a9d63, 0x56803cc7,
+    0xfe981170, 0x7bd6876a, 0x78f1fb8b, 0xb2756bad, 0x3200b1b6, 0xea310941,
+    0x2256bbde, 0xea0ecb38, 0x372c6587, 0x8e190166, 0xb5344d9c, 0x3bd3bc12,
+    0x5d8c2c4b, 0x339b73e4, 0x193fe91e, 0xe377c30d, 0x14bff7c8, 0xa4334971,
+    0x49f24671, 0x8a88d221, 0x95f79c59, 0xab9f6446, 0xd2731415, 0x0a556984,
+    0x61499849, 0x59980a9e, 0x9e20e797, 0xda62499a, 0x3d5a6a2e, 0x1959d57a,
+    0x3fa92b94, 0x7117b8e9, 0x24dbba9e, 0x3dd20e55, 0x9125a21c, 0x32d16c8e,
+    0xefc44086, 0x09ca3925, 0xee48a7df, 0x393a2a7e, 0xa461eaeb, 0xce734da6,
+    0x077a51da, 0xfe986546, 0xce82226a, 0xe204c5dd, 0x28c1c12f, 0x8e75f70c,
+    0x8aa5864c, 0xf7806a8b, 0x84aa7740, 0x06fabb9c, 0x1f6fed78, 0xd5ecdb86,
+    0x5b3b86f7, 0xfbb6e1c7, 0x8ee17d35, 0x6df8f1d6, 0x785fcdbe, 0x7ebcb563,
+    0x57b36f1b, 0x6fed18de, 0xecdb861f, 0x3b86f7d5, 0xb6e1c75b, 0xe17d35fb,
+    0xf8f1d68e, 0x5fcdbe6d, 0xbcb56378, 0xb36f1b7e, 0xed18de57, 0xdb861f6f,
+    0x86f7d5ec, 0xe1c75b3b, 0x7d35fbb6, 0xf1d68ee1, 0xcdbe6df8, 0xb563785f,
+    0x6f1b7ebc, 0x18de57b3, 0x861f6fed, 0xf7d5ecdb, 0xc75b3b86, 0x35fbb6e1,
+    0xd68ee17d, 0xbe6df8f1, 0x63785fcd, 0x1b7ebcb5, 0xde57b36f, 0x1f6fed18,
+    0xd5ecdb86, 0x5b3b86f7, 0xfbb6e1c7, 0x8ee17d35, 0x6df8f1d6, 0x785fcdbe,
+    0x7ebcb563, 0x57b36f1b, 0xf0bf18de, 0x16c4b25a, 0x52552263, 0xc613043b,
+    0x04390aa5, 0x9e339685, 0x241d598d, 0xcce82933, 0xc78adf1d, 0xb5cbcac0,
+    0x504dd63a, 0x6fd23494, 0x5966b484, 0xd67250a5, 0x5418d722, 0x384b7339,
+    0xa481372e, 0xe3ad3d86, 0x9a7ddbf0, 0x6bc7f0be, 0xdf36fc78, 0x31bcaf66,
+    0x0d3fdeda, 0xefabd9b7, 0x8fb7760c, 0x6af66dc3, 0xad1dc3fb, 0x7ddbf0e3,
+    0xc7f0be9a, 0x36fc786b, 0xbcaf66df, 0x3fdeda31, 0xabd9b70d, 0xb7760cef,
+    0xf66dc38f, 0x1dc3fb6a, 0xdbf0e3ad, 0xf0be9a7d, 0xfc786bc7, 0xaf66df36,
+    0xdeda31bc, 0xd9b70d3f, 0x760cefab, 0x6dc38fb7, 0xc3fb6af6, 0xf0e3ad1d,
+    0xbe9a7ddb, 0x786bc7f0, 0x66df36fc, 0xda31bcaf, 0xb70d3fde, 0x0cefabd9,
+    0xc38fb776, 0xfb6af66d, 0xe3ad1dc3, 0x9a7ddbf0, 0x6bc7f0be, 0xdf36fc78,
+    0x31bcaf66, 0x0d3fdeda, 0xefabd9b7, 0x8fb7760c, 0x6af66dc3, 0xf80dc3fb,
+    0x8b8e5c37, 0x0ddc6dd6, 0xcebfd26f, 0xf2c8b5c2, 0x9ad62e4e, 0xa45935bb,
+    0x9d9e0bab, 0x9884c871, 0x03928ce6, 0x901e20a1, 0x56010243, 0xf0d91f04,
+    0xb99ffdaf, 0xfb8bc37f, 0x838b3fcc, 0x2ab525d3, 0xd68cf2ae, 0x63286939,
+    0x337e6e04, 0x2faf9230, 0x321c2de1, 0x55db8d0e, 0xd5d1b638, 0x946f5dd2,
+    0x356ef656, 0x52421d1d, 0xc4a84832, 0x89768a1a, 0x51654796, 0xcb3c279c,
+    0xaaf8fc01, 0x0b7a7a37, 0x9c225c84, 0x9c4ecd32, 0x69ea0946, 0xac5a2aea,
+    0xa726ba4c, 0xd191a458, 0x9e205123, 0x9d0aa543, 0x0e20e61c, 0x6a510110,
+    0x291f30b7, 0x13df866e, 0xa1afe078, 0xddb3488e, 0x509e9adc, 0xe3d5ee37,
+    0x1bce76c5, 0x348bae7d, 0x54d54e43, 0x17919d21, 0x2d43896c, 0x44ee6e5c,
+    0xaa66b76b, 0x50d9cda6, 0x554a34ed, 0x9cbcc819, 0xf2d45292, 0x1bcc6dd1,
+    0x58945a3a, 0x2dc398aa, 0x44123559, 0x62f2c3b1, 0x65181639, 0x0e194430,
+    0x4fcf0cc1, 0xffe99f3c, 0xeadf0700, 0x10e51f97, 0x7f6600ff, 0xec720017,
+    0x6546eccc, 0xf115b32d, 0x42a4a831, 0xc38efc47, 0x5c1b27ea, 0xc6b5716d,
+    0x6d5c1bd7, 0xe1c0b571, 0x0d295f15, 0xe2a7e2a1, 0x286bac79, 0xd5c67849,
+    0x86f18ce9, 0x26cb3663, 0x11ba6165, 0xe2f777b8, 0xee49c2cf, 0x6a28f715,
+    0x54542405, 0x1334cb91, 0x0426b4ae, 0xb32c31a9, 0x16ed24cb, 0x66979a9d,
+    0xdcdd4154, 0x080fb1bb, 0xf514352d, 0xc7d65015, 0x3a831424, 0x68280996,
+    0x624c7697, 0x4ec58468, 0x6cac2b79, 0x490043ac, 0xa2700056, 0xf8bf76c6,
+    0x8b221f94, 0x1ca59b24, 0x8c06d2d6, 0xcd56f9e2, 0xd7e16880, 0xa8c31c22,
+    0xee3dd9d2, 0xdc1a1ddb, 0xa325b21e, 0xf3132d93, 0x5a4e7288, 0x52863056,
+    0xec718efb, 0xa94daef5, 0x67979346, 0xb24f7cad, 0x4733721c, 0x0b6746ac,
+    0x90900523, 0x19311ea1, 0x37de3696, 0x90926b3c, 0xe22025c7, 0xaf6cfd8e,
+    0xaba4e291, 0xcc389e59, 0x467336ac, 0x1ada4a36, 0x1ac5d240, 0x4adc863a,
+    0x37fa7733, 0x0abe96e2, 0x96a612d8, 0x6712ac4d, 0x9aae40a2, 0x9ba792b4,
+    0x83f42322, 0x9bfbbbd2, 0xd7c6b5b1, 0x716d5c1b, 0x1cd7c6b5, 0x1efc602c,
+    0x123a02b9, 0x8a88879d, 0xf8887cba, 0x5bf1cfe8, 0x120525d8, 0x4a0ac8a8,
+    0x00ff0760, 0xc6b53145, 0xb54b17d7, 0x16a43be2, 0xf93654db, 0xaa365a1a,
+    0xdd275a63, 0x014656a2, 0x96319aa2, 0x0905725a, 0xccfd3dcf, 0xcad2ef5a,
+    0xa5bb1497, 0xae451535, 0x4452b540, 0x7c948ae7, 0xd99a6ecc, 0xba0077d9,
+    0xc866b94b, 0x966c8b8c, 0x275a112e, 0x2aae9ea7, 0x742978d4, 0xcf1186f1,
+    0x2ac420ae, 0x136142b3, 0xd68025e8, 0xb9f32923, 0xb2cbd6dc, 0x4f61bb34,
+    0x53b35db6, 0x4d1eb171, 0x170ca699, 0x399d9e6b, 0xf5ec4666, 0x0f0700ff,
+    0x713c4bc2, 0x7c25cf53, 0xbe561569, 0xe01ccd2e, 0x6ccca1c9, 0x443b36da,
+    0xd2aee040, 0x5bce5845, 0xfda6e298, 0x2095a46b, 0xe548aca8, 0x34922391,
+    0x449b2cd1, 0xc846b495, 0xc1e844d1, 0xc4d26e98, 0x2e39cee5, 0xf58270fc,
+    0x099aa63d, 0xa485e329, 0x7d4aa9a8, 0x8ad356ad, 0xd716a8c1, 0x08298b30,
+    0x32194821, 0x7acebde5, 0xef8a3534, 0xa789d23d, 0xe4388aa8, 0x0b68a28e,
+    0xd3349653, 0x6af9c8ec, 0xccb6f972, 0x3e7ba7e7, 0xfd5627f5, 0x57bc732b,
+    0xb2155947, 0x450d4dd3, 0x656ac06b, 0xa665a67a, 0x803e80a7, 0xdc51465c,
+    0x9746cdb9, 0xe74e275d, 0x09278104, 0xee5a702e, 0xc5505473, 0x3dd9ca05,
+    0x66192e3c, 0xf2b6197a, 0x22e2a1c6, 0x49c97f45, 0x88dd46ab, 0xc90939ce,
+    0xf5bb0af4, 0x95c480b2, 0xcb5391d5, 0x22548632, 0x861c3947, 0x9ba411a6,
+    0x6970cf34, 0xe4c8a934, 0xaeca964e, 0x86a06ff3, 0xb8ba8a3a, 0xb66c86a2,
+    0xa84dbe2f, 0x96a83620, 0x4ce49115, 0x4ad12588, 0x1a99cb00, 0xf8bb3a97,
+    0x497cec59, 0xbaa3a7e9, 0x3bcb2a4d, 0x8d633a6a, 0x878cb351, 0xa9eb448c,
+    0x6364a284, 0x155d0519, 0xf51e8695, 0xa9455515, 0x25512ea8, 0xf054453d,
+    0x4fd21bc9, 0x478c799d, 0x49f254f2, 0xc918924b, 0x1ad7a43a, 0x92755a1d,
+    0x96840308, 0x45289266, 0xa4495b7c, 0x9342a368, 0xec2b3229, 0x80a8b6ca,
+    0x56cd9f8f, 0xf9b9a290, 0x7e57b185, 0x294cd0b5, 0x82632beb, 0x18614d66,
+    0xfd4ec748, 0xd58d63ec, 0x0ee9c833, 0x83e6b754, 0x643dc598, 0x53c75035,
+    0x2648fb4e, 0x15c8715d, 0x46e65297, 0xc6555d7a, 0x83727ef0, 0xb836ae8d,
+    0xcb1022fc, 0xdab96c68, 0xee3ed7ab, 0xbe1c5259, 0xb33efaac, 0x0a9ffddf,
+    0xfbd900ff, 0xbf38fc97, 0x8df8c3bc, 0x6d5b89e3, 0x85e756f4, 0xabeae59b,
+    0xce70b4cc, 0xa2afcc38, 0x176e1c34, 0x1481a21a, 0x21698c17, 0x10d9d6f2,
+    0x55746e2a, 0x4e532d29, 0xc5b2b2a2, 0x58a22ac5, 0xd0db5f64, 0x96a940d4,
+    0x4d408498, 0xa061184f, 0x4166d3ec, 0x29ae4a2a, 0xdb9ae02a, 0x94ad6d55,
+    0xaece2346, 0xbe2b33db, 0x2530a7ca, 0xb223e6a7, 0x209e54c5, 0x6e872a8b,
+    0xa57b8a93, 0x55818eb3, 0xb527aa2e, 0x2242d2da, 0xb7dbfe94, 0xb458266c,
+    0xf1e6cce8, 0x98b405bc, 0x8af390f2, 0x5f5df19c, 0x95ae551d, 0xf6d5990c,
+    0x3a55e346, 0x54a47169, 0xa2b64aec, 0x57a60eba, 0xcb48acdc, 0x3fb81f78,
+    0x97eadf07, 0xff10e51f, 0x177f6600, 0xd6451b02, 0xf900ffa4, 0xeafea374,
+    0x8c6f1b8f, 0xcff8b6f1, 0xf18c6f1b, 0x1bcff8b6, 0xb6f18c6f, 0x6f1bcff8,
+    0x7974f18c, 0xd6bdaf23, 0x8ed29ec5, 0x9d52cfa2, 0x34c7f43b, 0x2cfe012c,
+    0x47453cc7, 0x96bec63e, 0x702b6305, 0x008a817a, 0xb1343b4b, 0xba834ad4,
+    0x176073ce, 0xcc689ea4, 0x2d3fc4ee, 0x8aaa744d, 0xb454e449, 0xb7095971,
+    0xab435053, 0x1c61255c, 0xc8da565e, 0x63d6739a, 0x7201cad4, 0xa5e05c33,
+    0x0f7e17a4, 0xc78415a7, 0x29d240d8, 0x9abc0a89, 0x1590eb1c, 0x2736dfc9,
+    0xa37f0253, 0x4523df14, 0x9d9eac65, 0xaa2828aa, 0x21a242ae, 0x65669318,
+    0x68650894, 0x2b2873db, 0x90723b97, 0xabe24b07, 0x356fe829, 0xf4f44090,
+    0xfed6d515, 0x9e4d012d, 0x2c9193ad, 0xaae618cb, 0xbbb96cb1, 0x9a67cc89,
+    0xd0a08463, 0x0c6d3d35, 0x6aba1e6b, 0x41a44bab, 0x2bd54251, 0x8c2a5818,
+    0x3e695781, 0x14bfd3b6, 0xe9a82828, 0x88fb0769, 0xd8f88c23, 0x9d7fd628,
+    0xbe6d1cf5, 0xe3dbc633, 0x33be6d3c, 0x3ce3dbc6, 0xc633be6d, 0x703ce3db,
+    0x2b565d96, 0x0fc7ef88, 0x7130a8f7, 0x4aed3747, 0xfdd4e44f, 0x0900ffdf,
+    0xcff8b631, 0xf18c6f1b, 0x874ba674, 0x92622908, 0x1675aa6a, 0x49691bb9,
+    0xd65c8628, 0x29ebe676, 0xbce73427, 0x8bdfde65, 0x3b1aa2a5, 0xa7284a50,
+    0x055f0ba9, 0xf691786d, 0xc79135d5, 0x02b25eaf, 0xe6afd386, 0x37cb28a2,
+    0x34a6b620, 0x72ef5a9c, 0x918a9ea9, 0x6befada9, 0x98a08692, 0xd2340984,
+    0x4e846a9e, 0x83d46861, 0x69591dac, 0x19d72ccf, 0x643f05dc, 0x09316ef2,
+    0x4f5200ec, 0x539b78e4, 0xe50e3719, 0xf4992c4b, 0xf1bb396d, 0x15e2a776,
+    0x89b42351, 0x6898d64c, 0xd3b77461, 0xf378ebd7, 0xec044012, 0x891d0982,
+    0xd7196b97, 0xcaddddcf, 0x78a94ed9, 0x3da28ea3, 0xece0a7a1, 0x2562bc2a,
+    0x9e0a1bd5, 0x8a9c6b6e, 0x4787c692, 0xb75cc935, 0x7592701c, 0x903d34e3,
+    0x315ba28e, 0x4fe9c459, 0x53d9fa9f, 0x653269b1, 0x44e748cf, 0xc4300309,
+    0x3846d206, 0xb35c552f, 0x790d2aec, 0xb187e2a3, 0x00d154a2, 0xd68949a7,
+    0x10dac0fb, 0xf33c2351, 0x6507b2a5, 0xb3ea8aa4, 0x52f6bc69, 0x8a926668,
+    0x495284a6, 0x30b42b24, 0xd3ba1c4d, 0xb264cc50, 0xba66c00d, 0x5466648e,
+    0xa874e7e2, 0x92ae58ba, 0x49432bb5, 0x165aa5b6, 0xa259427d, 0x76ea3015,
+    0x50cb9843, 0x3b1d3239, 0x6c4c64ca, 0x4d5157ed, 0x3dba7141, 0x85ea85ca,
+    0x0c0508c6, 0x10981582, 0x059a08b0, 0x1226f92d, 0x7e4e9965, 0xaeb76ce5,
+    0xec6baf68, 0x9ad65515, 0x29588a4a, 0xd974612a, 0x93acf809, 0xa490244b,
+    0x42ddfc88, 0xe40a5537, 0xbe014310, 0xb542563c, 0x7a2ab6f4, 0x47b5475a,
+    0xb35f5753, 0x4ce72e56, 0x66b322c2, 0x97893ed9, 0xa7ddb32c, 0x42186772,
+    0xbfdaaa60, 0xc4686205, 0x6aebdb52, 0x5523eaa8, 0x444812d2, 0xdc485b4a,
+    0xb23d9f36, 0x5bbe5cdc, 0xb087b1b1, 0x4eb1cd53, 0xed996f30, 0x02a00d74,
+    0xf90054a1, 0x7722036a, 0xf1fc9667, 0x6a0a9a70, 0x5056f2eb, 0x18b74cbd,
+    0x1065a811, 0x532a99ac, 0xfe989cb2, 0x36c34448, 0x79f2df65, 0xc1b15bb6,
+    0xdbb272f9, 0x779c7a47, 0xdbf8867f, 0xb78d677c, 0xdbe178c6, 0xe2d78eeb,
+    0xa5eadf7a, 0xff0a9ffd, 0x97fbd900, 0xbcbf38fc, 0x2780f8c3, 0x58fd1970,
+    0x77c78d20, 0xac10fbd7, 0xd48f157a, 0xd193c609, 0x0cf4cc91, 0x04117fba,
+    0xbcbe8c74, 0xe9484764, 0x7647c6e8, 0x77a3bfe3, 0x0c8dd54f, 0xe8bf553a,
+    0x0f7ed07f, 0x3f2ed5bf, 0xccfe21ca, 0xc14d2bfe, 0xd4b195ad, 0x3172a981,
+    0xa2a583ca, 0xe301b57c, 0x73af2b04, 0x61f78c52, 0x756a4b38, 0x12c2c60d,
+    0x28c5ab37, 0xa21cf165, 0x62e57f2a, 0x15e5783c, 0xe447afab, 0xcab1ec4b,
+    0x8f5e572b, 0x63d997c8, 0xbdae5694, 0xb22f911f, 0x5dad28c7, 0x5f223f7a,
+    0x5a518e65, 0x447ef4ba, 0xa21ccbbe, 0xfce875b5, 0x39967d89, 0xc9eb6a47,
+    0xb1ec4de4, 0x5e573bca, 0x656f224f, 0xbada518e, 0x7b1379fa, 0xd58e722c,
+    0x9bc893d7, 0x769463d9, 0x449ebcae, 0xa31ccbde, 0xf2e475b5, 0xaa58f626,
+    0xd6d5b4af, 0x78cbd453, 0x8e661a3b, 0x9bb34741, 0x58c6d364, 0xc8e9a4a4,
+    0xccc68c74, 0x0ce7a7e7, 0x572bcaf1, 0x9bc88f5e, 0x569463d9, 0x911fbdae,
+    0x28c7b22f, 0x3f7a5dad, 0x8e655f22, 0xf4ba5a51, 0xcbbe447e, 0x75b5a21c,
+    0x7d89fce8, 0x6a453996, 0x12f9d1eb, 0x8a722cfb, 0xf2a3d7d5, 0xe158f625,
+    0xac600807, 0x645434a6, 0x331492c8, 0x95a2504a, 0x03110e46, 0x55cf6305,
+    0x371f9524, 0x1cadf821, 0xb114a527, 0x86b9d653, 0xda635158, 0x458e6768,
+    0x629e6a5e, 0xcb692bbb, 0x792e6056, 0x39e47790, 0xd1eb6a45, 0x2cfb12f9,
+    0xd7d58a72, 0xf625f2a3, 0xab1de558, 0x4de447af, 0x2bcab1ec, 0xc88f5e57,
+    0x9463d997, 0x9ebcae76, 0x1ccbde44, 0xe475b5a3, 0x58f626f2, 0xafab1de5,
+    0xb2379127, 0x5ded28c7, 0x6f223f7a, 0xda518e65, 0x1379f2ba, 0x8e722c7b,
+    0xf2a3d7d5, 0xe558f626, 0x27afab1d, 0xc7b23791, 0x795ded28, 0x96bd893c,
+    0xeb6a4739, 0xec4de4c9, 0x573bcab1, 0x6f224f5e, 0xda518e65, 0x1379f2ba,
+    0x8e722c7b, 0xc893d7d5, 0x9463d99b, 0x9ebcae76, 0x15cbde44, 0xb9fa76d5,
+    0x45b86824, 0x80332c3d, 0x9d44a627, 0x46687ee2, 0x6b0273c8, 0x2c0d0340,
+    0xb9bbcd33, 0x65f79e62, 0x782a82a5, 0x0c4750ab, 0xb3661a6b, 0x928e9213,
+    0xe9c95b76, 0xb833033d, 0xd58a720c, 0x25f2a3d7, 0x233c58f6, 0x1d9f01b5,
+    0xcc11e243, 0x3836fd4f, 0x2bfb5dbf, 0x15cc1e51, 0x5857a7a7, 0x9a990cb5,
+    0x0849bb42, 0x80d06aee, 0xfb5de00e, 0x57f8eccf, 0xbfdccffe, 0xe6fdc5e1,
+    0xcf1cc51f, 0x5452b36a, 0x6d951dd2, 0xf5b07ace, 0x2ad6966b, 0x081a336a,
+    0x2dbe7321, 0x465e8ea4, 0x0270268f, 0xc632d231, 0x3d115eda, 0x7bd58dba,
+    0x9e758620, 0x690321e3, 0x5324aa4a, 0x7673a551, 0x9e9745a7, 0x823432c7,
+    0x5920314b, 0x52042ae9, 0x44bd5750, 0x869a7e3c, 0xb04bcba4, 0xfa341e96,
+    0xf658a861, 0x7c2109d2, 0x1b6f4e9f, 0xab2c5dea, 0xa0a23898, 0x784dd2b5,
+    0xcc13b283, 0x10aedbf0, 0x018456ce, 0xc91a4310, 0x7eaa4524, 0xaa4ae450,
+    0xe11035f3, 0x78495799, 0xc4af746c, 0xb0e39aa1, 0xd226b9ae, 0x5e2e0e8e,
+    0x341d9230, 0x2061aaa2, 0x0253bdd8, 0xb4395211, 0x61402e6e, 0x8d831d9d,
+    0x918a92c4, 0x4435c11a, 0x8f717d57, 0x562039fc, 0x4cba4d90, 0x47548ee5,
+    0x9c473954, 0x01de63ca, 0x92a86f61, 0x4fc9ee18, 0x28443a53, 0xdac9a39d,
+    0xa31ccf2c, 0x72442151, 0xe31e4316, 0xd70c2491, 0x9ea61851, 0xa5a6a53d,
+    0x96621ca4, 0x791c4d1b, 0xcea538b7, 0x1e447d3a, 0xb845929f, 0x6aeecc6a,
+    0xeffbc785, 0x00ffa7fe, 0x80281cdb, 0xbcd1d6d7, 0x544d3943, 0x723c7996,
+    0x537224c7, 0x86968e9e, 0xfe7946a9, 0xf9e28867, 0xbb1ab74e, 0x94105134,
+    0xaecfd0b1, 0x8686cd6f, 0x7974a68a, 0xa1db8dd8, 0x74fe768b, 0x616f5085,
+    0xbf269187, 0x23485af0, 0x14d4c4d8, 0x00ff18bb, 0x582d3142, 0xe9ef738d,
+    0x9cee51cb, 0xc2692ece, 0x9e697aaa, 0x89a7a2be, 0x06e46cb3, 0xc2ca04e1,
+    0x1c439043, 0x07311255, 0xef72f3a0, 0xfca000ff, 0x5caa7f1f, 0xfd43947f,
+    0xe1f7fd99, 0x723ffb5f, 0x178700ff, 0x157f98f7, 0x7655f434, 0x4ed7b6f5,
+    0x799ada68, 0xd9aba327, 0x67613c49, 0x95a6270a, 0x862a0d22, 0x78235964,
+    0x41bd86d5, 0x05f11bc0, 0x926dd5c6, 0xd5009e86, 0xcd6ac690, 0xd961b9c2,
+    0x831d374b, 0x2c53328b, 0x41b148b9, 0x9a2c441e, 0x7402b236, 0xf534ce27,
+    0xa462bb16, 0xd39a5730, 0xcfb77351, 0x514deb3c, 0x94f45404, 0xa4371953,
+    0x9d7924aa, 0xd158519b, 0xac642ad4, 0x5a8ae558, 0xdec92eca, 0x1a1bd54c,
+    0x1837847b, 0x4c31a962, 0x4da2a6ea, 0x88463b71, 0x7ec0d266, 0xd498a186,
+    0xc685fc06, 0x95a1748a, 0x2d3415ef, 0xf3944e45, 0x29c1d3d2, 0xe7d2a096,
+    0x7d8a9ab2, 0x75da2826, 0x76b6bfd2, 0xc5521766, 0x0d9d6558, 0x064dd9c2,
+    0x8e6a77c2, 0xbb30cbcc, 0x492bc9c8, 0x14734e47, 0xbbc65cda, 0x7ee6886a,
+    0x2b912c37, 0x54112806, 0x559158b6, 0x04497524, 0x25c1aea8, 0x14596555,
+    0xc215ce1d, 0xf21b86ba, 0x083a0c65, 0xac744bfc, 0x5c8bc214, 0xa520573c,
+    0xd326a578, 0x977fbd4e, 0xf38c71d8, 0x7775edee, 0x0576cb33, 0x2f2bdee6,
+    0xae751933, 0x8eda57d8, 0xad2452ca, 0xd3a9694a, 0x31066435, 0x3221cb9c,
+    0xef0adf04, 0x3a3b4ecf, 0xf896b494, 0xb48e86a0, 0xd6d238f6, 0xd2045b45,
+    0x255b1122, 0xc2e7a84a, 0x72e33c1b, 0x07e63a43, 0x94ef6174, 0x7ef05733,
+    0x3c151d53, 0xd5c49054, 0xd4d25352, 0x9cc95323, 0x7354a9e1, 0x0ce3a9d9,
+    0xc81a8bae, 0x2111bb35, 0x5d9003de, 0xc42ce888, 0x00ff597d, 0xff1ffca0,
+    0x0fdca900, 0xe82f66fe, 0x7d7ffc8b, 0xcffe57f8, 0xc5e1bfdc, 0xc51fe6fd,
+    0x8e3ccb91, 0x0ef7a047, 0x8cc8385d, 0xbc6704b3, 0xf68bc778, 0x33d01319,
+    0x3700ffee, 0x8159017f, 0xbd0b4921, 0x3c800488, 0xd383ee7d, 0x2141ac80,
+    0x40d20b49, 0xbdaf0f24, 0xe42088f8, 0x82740441, 0xb0f92332, 0xb04a8751,
+    0x047366c8, 0x7ee00e64, 0x39321eaf, 0x74c89167, 0xa3cfe09e, 0xffe00ffd,
+    0xbf4afd00, 0xd97f54f9, 0xacabea7e, 0xaa81a0a6, 0x2058266b, 0xda480342,
+    0x2a39f68e, 0xccce4085, 0x5baa8a7b, 0x3890e5a4, 0x3c077fe5, 0xe30e3d24,
+    0xbf724cf7, 0x1e129e83, 0xa6fb7187, 0x37542e28, 0x0a5ada38, 0x6d44a895,
+    0x8cc8420e, 0x3260468c, 0xb9c8914a, 0xe44a9a8f, 0xc8891cd9, 0x85a7fbe5,
+    0xcbfdec7f, 0xde5f1cfe, 0x7f55fc61, 0xfccf0afc, 0x74fdebaa, 0xb5b4e278,
+    0xaed2d990, 0x0b866259, 0xbc536505, 0xd8455a3a, 0xe6b0d4d5, 0xdeb3c9b0,
+    0x8e9a6602, 0xe2f45a43, 0x1d4b47e1, 0x0b751d3d, 0xf6aac54f, 0x5aaa98f1,
+    0xe9199a37, 0x5e8a0499, 0x5d1d8d24, 0x11424764, 0xdf260748, 0xd52de989,
+    0x7e96d634, 0x96340c37, 0xca525753, 0x2b3cbbd0, 0x287b3c57, 0x54a06497,
+    0x2cf9544d, 0x6c244aae, 0x5266a3ba, 0x968ec24d, 0xa8eb2838, 0x594b635a,
+    0x499d4db6, 0x7a82a78d, 0x67548262, 0x5624518d, 0xc146920e, 0x58da9a17,
+    0x59363366, 0xda0d85e9, 0xa9cea605, 0x49d275ed, 0x1199ef56, 0x30248828,
+    0x090890c7, 0x4b72a525, 0x2837d231, 0xea3a16cb, 0x9474d4c2, 0x525252a4,
+    0x5977953c, 0xe9291bb3, 0x55abfccb, 0xad32b982, 0xa278ed3f, 0x8d9cc162,
+    0xa9e65c3a, 0x5872d45a, 0x1af9a160, 0x54f38c4b, 0x74154455, 0x715545d5,
+    0x3a419496, 0x74acc39c, 0x73402288, 0xc9b54ed0, 0xd648b0c2, 0x9f42ca1b,
+    0xc69a2b32, 0xa04ac5bf, 0x2e06faa3, 0x2fdc7174, 0x9947b5d4, 0x92b7554f,
+    0x4720b2b5, 0x2a9287d8, 0xc319dee3, 0xf6bd8c4e, 0xdbde7395, 0xbe8e24eb,
+    0x276ae94a, 0x78aa385a, 0xe6956c39, 0xc422c931, 0x5c17b61e, 0x8d3484e3,
+    0xaa39c999, 0xdc512772, 0x0dbd380e, 0xb1e1923d, 0x6d840bb8, 0x88db6c5b,
+    0x64a6a860, 0x06776a40, 0xce0288aa, 0x5c21690b, 0xdeb01929, 0xb5a3af01,
+    0xaa866d43, 0x5343b814, 0x58ed2757, 0xa529aa6a, 0x9e9b4cd7, 0x682ad2a5,
+    0x389f519d, 0x7281cde1, 0x0128c019, 0x0ffed96f, 0xabd400ff, 0x479500ff,
+    0xaeee97fd, 0x45f07f1d, 0xfd4f5ffe, 0x45054e95, 0xb1405232, 0x423c438a,
+    0x494bdc99, 0xd29e7f6f, 0x246bc72c, 0x8d432d6d, 0xf5091e68, 0x51ed60ac,
+    0x5432c446, 0x4ed3723c, 0x05600bf1, 0xa51915e6, 0xd601552c, 0x9cb82950,
+    0x224a2a71, 0xd3198430, 0xa69dc126, 0x7ccdcf7a, 0x217f0f7e, 0x8b00ff75,
+    0xf000ff47, 0xc2d5fda8, 0xe57ef6bf, 0x2f0e00ff, 0x2afe30ef, 0x253efa5a,
+    0x348dfbd8, 0xed1cc3d3, 0x34354d51, 0x2f440dc9, 0x1e4ba222, 0x6d344572,
+    0x88118114, 0xcc659829, 0x2ea8fb1d, 0x4ed7d410, 0x1a2a57dc, 0x3c75153b,
+    0x2c298d54, 0xeec4d1d4, 0x078049e2, 0x8c3c336b, 0x2c8d2ad2, 0x46c948c3,
+    0xd4d0152e, 0x49494945, 0x4647c103, 0xd2c4ecb2, 0x59926709, 0x66695ad9,
+    0x93d04875, 0x501511a5, 0xe4f15405, 0x2cd3bc21, 0x49cb7134, 0x293abb24,
+    0xb66bb52d, 0x376a8e55, 0x45c3499a, 0xa9e27af2, 0x5757568e, 0x03ccc92c,
+    0xc2c5fc46, 0xe9881aba, 0x7a206929, 0x93353a7a, 0x25c8b266, 0x6067499e,
+    0xaa334dd3, 0x4a9b8546, 0x0aa0aa2a, 0x21a7bbab, 0x38295643, 0x8d5f68e6,
+    0x0c52d450, 0xda0c5a8e, 0xe6b87332, 0xec464f17, 0xe182f8fb, 0xedd8166b,
+    0x075cd3f3, 0x4fd5b4ca, 0x104f554b, 0xa23c93aa, 0xa66989da, 0x4226106d,
+    0x0c04c328, 0xb68b4c5e, 0x28de52ac, 0x35514aa1, 0x6bc9b30c, 0x8f6d799a,
+    0x240002c6, 0x7514cd90, 0xc29c4780, 0x1898f219, 0x6a8e5a8c, 0xd16a4657,
+    0x8eab1554, 0xaddc4caa, 0x703f5442, 0x1b0912b9, 0xfcb6707f, 0xa5f6f335,
+    0xc92099ce, 0x9aa6aaeb, 0xd4668b29, 0x353a55f0, 0xfb770354, 0xc42a0ce1,
+    0xdfd79865, 0x9274b7c4, 0x38d86109, 0x6d285a32, 0x9e1beb80, 0x32a56892,
+    0xb8e6a7e5, 0x23bd208f, 0x3a8a933e, 0x9ea560e8, 0x681a7896, 0x9ea1abe7,
+    0x38132e4d, 0x2c435aa9, 0x2ae7045d, 0xf35ba5c9, 0xebe2777a, 0x34b86d5f,
+    0x70c111d5, 0x22d0a74a, 0x35d3d4da, 0x00a1312c, 0x2aa59042, 0x05228938,
+    0xc8205122, 0x9d5bcce4, 0x837ff6ab, 0x2af500ff, 0x51e500ff, 0xfb6500ff,
+    0x9686b6aa, 0xd65203e3, 0x99812742, 0x4e67a158, 0x57d67c72, 0x8dd4918d,
+    0xc881d5fb, 0x18893b95, 0x3c0787e4, 0x7900ff1d, 0x72acf75f, 0x0e9e8343,
+    0xafbc00ff, 0xf62dd6fb, 0x49520bba, 0xa738051d, 0x9f3c5859, 0x99852c29,
+    0xcd9b4b46, 0x04908f24, 0x8cb4bae4, 0x733203c9, 0x455fd3fd, 0x6a92c615,
+    0x148bcc29, 0x8a9843e1, 0xae2e8dab, 0x03579634, 0x3b958e7a, 0x372bc8b1,
+    0xf57cdcd3, 0xc871dd3f, 0xdcd3372b, 0xdd3ff57c, 0x68093870, 0x7251e519,
+    0x530e8219, 0xa40733c0, 0x07bdda1f, 0x2bc831ba, 0x7cdcd337, 0x71dd3ff5,
+    0xd3372bc8, 0x3ff57cdc, 0x2bc871dd, 0x7cdcd337, 0x71dd3ff5, 0xd3372bc8,
+    0x3ff57cdc, 0x2bc871dd, 0x7cdcd337, 0x71dd3ff5, 0xd3372bc8, 0x3ff57cdc,
+    0x2bc871dd, 0x7cdcd337, 0x71dd3ff5, 0xd3372bc8, 0x3ff57cdc, 0x2bc871dd,
+    0x7cdcd337, 0x71dd3ff5, 0xd3372bc8, 0x3ff57cdc, 0x2bc871dd, 0x7cdcd337,
+    0x71dd3ff5, 0xd3372bc8, 0x3ff57cdc, 0x2bc871dd, 0x7cdcd337, 0x71dd3ff5,
+    0xd3372bc8, 0x3ff57cdc, 0x2bc871dd, 0x7cdcd337, 0x71dd3ff5, 0xd3372bc8,
+    0x3ff57cdc, 0x2bc871dd, 0x7cdcd337, 0x71dd3ff5, 0xd3372bc8, 0x3ff57cdc,
+    0xb26871dd, 0x9a6359d2, 0xd69d472a, 0xdd361267, 0x7421c8d1, 0x1e4774f3,
+    0xfde0bbec, 0xa4e8fa7f, 0xf32bdcb6, 0x157554e2, 0x614c4e21, 0xde03dc89,
+    0xf859062c, 0x9a1ccfb3, 0xbf22f8bf, 0x8ed5dfd1, 0x11fc5f4d, 0xeaefe85f,
+    0xfeaf26c7, 0x77f4af08, 0x579363f5, 0x570400ff, 0xb1fa3bfa, 0x00ffabc9,
+    0x1dfd2b82, 0xd5e458fd, 0x15c100ff, 0xacfe8efe, 0x00ff6a72, 0x00ff8ae0,
+    0x39567f47, 0x45f07f35, 0xabbfa37f, 0xf8bf9a1c, 0xdfd1bf22, 0x5f4d8ed5,
+    0xe85f11fc, 0x26c7eaef, 0xaf08feaf, 0x63f577f4, 0x00ff5793, 0x3bfa5704,
+    0xabc9b1fa, 0x2b8200ff, 0x58fd1dfd, 0x00ffd5e4, 0x8efe15c1, 0x6a72acfe,
+    0x8ae000ff, 0x7f4700ff, 0x7f353956, 0xa37f45f0, 0x9a1cabbf, 0xbf22f8bf,
+    0x8ed5dfd1, 0x11fc5f4d, 0xeaefe85f, 0xfeaf26c7, 0x77f4af08, 0x579363f5,
+    0x570400ff, 0xb1fa3bfa, 0xd0b96957, 0x1acabaae, 0x2dcf64aa, 0x99e8c272,
+    0x8ca8819e, 0xfe37f7b7, 0xd45253f0, 0x351d4f56, 0xf2344d2c, 0x3e8da39c,
+    0x3db31c73, 0x960000e0, 0x04a84262, 0xfc230692, 0x431ddf1e, 0x89c8f634,
+    0x2a2ac9fc, 0xc3ac0f4b, 0xd17f2a47, 0xde5d3bce, 0xcfa7e57a, 0x1dbffb56,
+    0x723defae, 0x7dabe7d3, 0x77d78edf, 0xf369b99e, 0xc7efbed5, 0x5ccfbb6b,
+    0xdfeaf9b4, 0xddb5e377, 0x7c5aaee7, 0xf1bb6ff5, 0xd7f3eeda, 0xb77a3e2d,
+    0x77edf8dd, 0x9f96eb79, 0xfcee5b3d, 0xf5bcbb76, 0xad9e4fcb, 0x5d3b7ef7,
+    0xa7e57ade, 0xbffb56cf, 0x3defae1d, 0xabe7d372, 0xd78edf7d, 0x69b99e77,
+    0xefbed5f3, 0xcfbb6bc7, 0xeaf9b45c, 0xb5e377df, 0x5aaee7dd, 0xbb6ff57c,
+    0xf3eedaf1, 0x7a3e2dd7, 0xedf8ddb7, 0x96eb7977, 0xee5b3d9f, 0xbcbb76fc,
+    0x9e4fcbf5, 0x3b7ef7ad, 0xe57ade5d, 0xfb56cfa7, 0xefae1dbf, 0xe7d3723d,
+    0x8edf7dab, 0xb99e77d7, 0xbed5f369, 0xbb6bc7ef, 0xf9b45cd7, 0xe277dfea,
+    0xa5bbc1ef, 0xc4d52b94, 0x221d038d, 0xb0cc9da6, 0xc40a3dea, 0xcb313aaa,
+    0x5717d176, 0xc99193e6, 0xbea36c46, 0xa900ff40, 0x343c1dc5, 0xd3d1b014,
+    0xe3a948a8, 0xb70cd458, 0x3de71ce9, 0x98cd76f6, 0x2789e59d, 0xd57ffc1a,
+    0xea3f7e8d, 0x9ac675c5, 0x5d254ddd, 0x8b219a54, 0x991ac82c, 0x44958e99,
+    0x9899bd51, 0x92f307e4, 0xbc2d1214, 0xd4b9a224, 0xb68a541a, 0xb567a392,
+    0xd6a9ab48, 0x823e9a06, 0x509269d1, 0x90a07bda, 0x0618aa7b, 0x260dafd3,
+    0x94db2c85, 0xdce5c402, 0xe97f3203, 0x6ef81a8a, 0xd3d5d114, 0x32266817,
+    0x82268b6c, 0x2d5e39e2, 0xacf04e5a, 0xe4b92c63, 0xaad448da, 0x8dd7a8d9,
+    0x00ffc747, 0xa5d5544c, 0x32f53c2d, 0x4f04296a, 0x5c0a8433, 0x85586aac,
+    0x640bca0c, 0x67c06637, 0xe12346d2, 0x545bbe55, 0xbe4a85d7, 0x03cb042f,
+    0x8c8763c4, 0x57896697, 0x64cc094a, 0x4c90aa1d, 0x761b9aa3, 0x7c058dec,
+    0x2b481a77, 0x2a165960, 0x2a8b2e84, 0xcc0090a8, 0x7547e59c, 0xce9dd41b,
+    0xb1fab2db, 0xc2ddb9af, 0x8c7be1dc, 0x0ab3b0b6, 0xad926988, 0x4c6caa98,
+    0x1530e26e, 0xe6f59ab6, 0x17c62073, 0x76cfce2f, 0x75d9e235, 0xc64ded82,
+    0x8f6596a9, 0x663a246b, 0x44f5d558, 0x72946372, 0xb9f7344a, 0xc6c0f7d9,
+    0xfc35e6ae, 0x1fbfc66e, 0x8f5f63f5, 0xc52ab1fa, 0x3243523c, 0xa54ab12c,
+    0x2ac08d24, 0x0f22c3e8, 0xe9387ff3, 0x295c1c19, 0xb6be92d6, 0x4d290995,
+    0x13025357, 0x9d2952d2, 0x4a1e3f17, 0xeffef133, 0x1fc71efc, 0x404eb919,
+    0x3c0d4732, 0x56f3c768, 0xcba49567, 0x9962abbd, 0xda5886f8, 0x5e1c7c7c,
+    0x8a6c2fef, 0x5ae06999, 0xf8d9ca9a, 0x487234bd, 0x59568b22, 0x40429296,
+    0x0da06600, 0x9c6f9949, 0xbea13800, 0x8eaaa9d4, 0xb9b646fb, 0x76399629,
+    0xc9d18bc1, 0x32a8ac1c, 0x12231998, 0x44056507, 0x80ae9ead, 0xc625b151,
+    0x5236198e, 0x9b1cc3d4, 0xeed0a816, 0xce27d801, 0x0c72a797, 0x8e8af38e,
+    0xa063db11, 0xa8a7aeab, 0x1469b182, 0x40298e6a, 0x8eee232d, 0x3b6df23c,
+    0x271db843, 0x1999e5a0, 0xbcf51b62, 0xd45652d0, 0xb5c2d255, 0x994caf31,
+    0x3320dc2e, 0x479d9944, 0x74abf964, 0xe618dce9, 0xddde3d71, 0x568ca34d,
+    0x8bb4c5d3, 0x00b91e6f, 0x6d79160f, 0x2993e710, 0x9f13043d, 0xb67a0973,
+    0x47312449, 0x54f24a5f, 0xca22500d, 0x9019a4a5, 0x49fa8c34, 0x13399053,
+    0x772f4697, 0xd9762d49, 0x398e62eb, 0xa5678b64, 0xd749cf24, 0x2cfda622,
+    0xdf6e430f, 0x16be8ad3, 0x8696054f, 0x0d3c1de1, 0xd12c5355, 0x4de64e4b,
+    0x4b5c7c9c, 0x07932bb6, 0x6f8c95e6, 0xeff2f363, 0xf0edde60, 0x2ac74bc7,
+    0xa8a6a9e9, 0x9b6d86a7, 0xa8f217c8, 0x9833bbad, 0xb640ce5c, 0xe2f5e559,
+    0x99babd7b, 0x292b2a99, 0x914464e1, 0x4704b883, 0xf137ca21, 0x2c373f87,
+    0xc4e8e9f3, 0x107c6bb7, 0x65355345, 0xe5f3743c, 0x5da495b1, 0xe633e612,
+    0xbadbf91c, 0xe5eee872, 0xe35bbb87, 0x2ac94aa6, 0x4296d6e9, 0x06997304,
+    0x20cfc9cd, 0x71e73da7, 0x8e8c37dc, 0xdd11077d, 0x34c5d2ed, 0xbc5356f1,
+    0xe519c034, 0x83880659, 0xb3ad4b0d, 0x3b3a66c8, 0xdde9eea4, 0xb5b67881,
+    0xb4151c37, 0x8c3894e6, 0xc4181cce, 0x9e10e484, 0xe34612e3, 0x043d4897,
+    0x7df6b363, 0xa8643f32, 0x37e2c4f4, 0xbbe6653b, 0xeff49267, 0x57644bcf,
+    0xf13bcd31, 0xd2b77651, 0xd6d452a4, 0xe31cc353, 0x50e45d38, 0x9a031925,
+    0x880ce76f, 0x31c38d39, 0x3d31de99, 0x819882d6, 0x164f5751, 0x5cd76d71,
+    0x50876a80, 0xf29ca25d, 0x04402c64, 0xb17b9e67, 0x152de170, 0x249ddb12,
+    0x15ae6886, 0x4b981829, 0x875371f2, 0xe4a0a202, 0xcd1fa10e, 0xe4d235cb,
+    0x48a5f96a, 0x52065895, 0xa40cb00a, 0x60461074, 0xfa62ac8f, 0x75cd9a23,
+    0xbc0c458e, 0x3bc0a942, 0x79a178f2, 0x24ad6f62, 0x23de6145, 0xfef4fc11,
+    0x5800ff32, 0x7a6694c1, 0xa3364e3a, 0xf1a88dc5, 0x86068463, 0x5f476b5b,
+    0xd342d33b, 0x24a2a243, 0x04676877, 0x56cc4fb4, 0x4b606ec8, 0xd4f2bb64,
+    0x19e254ac, 0x9ece0d6a, 0x6f5b5bdd, 0x4b5b43be, 0x6b350c55, 0x8d763c14,
+    0x266bab38, 0x359ad548, 0xf28d9c97, 0x9bab34d2, 0x34cc53b1, 0xb5d51235,
+    0x6c931c05, 0x25fde064, 0x162bcfc8, 0x96f11cd3, 0xe490a4a7, 0x99aedc3f,
+    0x67f23b3f, 0x58b536ea, 0x4b2d4daa, 0x8ac69d4b, 0x969e37b2, 0x2aa82abe,
+    0xce4682c1, 0x8d470264, 0xb62253f3, 0x216d75b5, 0x71eed2e2, 0x16ed4818,
+    0xe499687a, 0x3455e38a, 0xba561897, 0x9024411a, 0x7a2058b1, 0x3aa51489,
+    0x324d02e9, 0x7cf21982, 0xa22a04b5, 0xcd96a6a2, 0xb1ee3445, 0x785aeead,
+    0x3ab28a24, 0x68a56199, 0x5311f9a2, 0x2ab42001, 0xd2ee5059, 0x4055e90a,
+    0xb0424da0, 0x3a9a5fd2, 0xb72cc0aa, 0xf6e81605, 0xea4544e7, 0x37425e11,
+    0xa3402167, 0xa839e952, 0xd5665c6c, 0x79cfac67, 0xf8d97c6b, 0xc4b381c9,
+    0xb5a58439, 0xab75c48c, 0xbf91ba6e, 0xb9f69422, 0xcebde376, 0xc6df109a,
+    0x0931f719, 0x0e6eaa4a, 0x5e6a2b5b, 0x1525db96, 0x9469d244, 0x93ceb342,
+    0x9147b3cb, 0x94dcbcb9, 0x27c0acae, 0x87833877, 0xd52d95aa, 0x25ebd816,
+    0x21df527b, 0xa6cd5aa0, 0x49f6b66c, 0xf412e019, 0x8caa9418, 0xcce9c9c7,
+    0x387db365, 0x4a5a1a8e, 0x3514fcbb, 0x964e532f, 0x4ccb5807, 0x656ad927,
+    0x5e648976, 0x7c495069, 0x910b2097, 0xac229ed3, 0x05be6a86, 0x8d2453a4,
+    0x5599260d, 0xe246311c, 0x0052a691, 0x8cd4964e, 0xb3fb6d32, 0x66e1c8e8,
+    0xcab6ad95, 0x2aa91d12, 0xa827376e, 0xa1e36a89, 0x44130d15, 0xa6ea8d63,
+    0x27041a0d, 0xb30a4e5e, 0x086b3969, 0x51396ec2, 0x96a7a06f, 0xa7a119a6,
+    0x4209aba8, 0xcb4358f7, 0x4aec2a02, 0xccd887d4, 0x2a5c5769, 0xa5a6b5ba,
+    0xe4d06258, 0xd2ea052f, 0xa64a4c5b, 0x58922072, 0x6591a932, 0xa611c278,
+    0x30129535, 0x1390aaf1, 0xc947ba98, 0x36ae6a8e, 0xa88dc5a3, 0x3c6a63f1,
+    0xbb6fbc58, 0xe37e0fdd, 0x4fe2fd5b, 0x7d03fcdd, 0xadf1740d, 0xe3d4f51f,
+    0x9cfee36d, 0x4e7a9270, 0xc21d4f2d, 0x27aa4a8a, 0x61aae59b, 0x064a9691,
+    0x2a9c24cb, 0x0b0233a3, 0x7657bd83, 0x18643944, 0x531dc5b5, 0xdad6ad5d,
+    0xb3eca98a, 0x5443b850, 0x73154718, 0x3a2c31b8, 0xcf9065c2, 0x362b7468,
+    0xa33c9b5a, 0x923da538, 0xd6d5b9a1, 0xf63451a5, 0x14484bea, 0x0d4e92e8,
+    0x91275939, 0x378c7763, 0x1779623d, 0xa04dea5a, 0x722acbe9, 0x8e79c392,
+    0x61aba918, 0xbaca59ec, 0x21a2170a, 0x58a448d2, 0x6901a6e5, 0x3093cb84,
+    0x3269e378, 0xe7dc3e8c, 0xb444c520, 0x3f75b167, 0x5abc1d21, 0xb6b7264d,
+    0x7a05a89a, 0xc529db8f, 0x990a80f3, 0x462db318, 0x5d229764, 0x43898c5b,
+    0xf0d70349, 0x1aa99a76, 0xd6b614a2, 0x4e5bc73a, 0xd34cc588, 0x7d5a62bc,
+    0xb50c4aad, 0xb75daa66, 0xa0572569, 0x1d4b4152, 0x433ad3ae, 0x253ca810,
+    0x46e14c85, 0x702464db, 0xfdfcda23, 0x46a74a9e, 0xb21a737a, 0x2b1cbfd5,
+    0xb08e5593, 0xfb83dd67, 0x1c5af178, 0x6fa676cd, 0x5d41d0c8, 0xdafd0e59,
+    0x1c5172ae, 0xa965eeb2, 0xeef9a7bf, 0x4c8541b5, 0x6ea5612c, 0x08d5dbc1,
+    0x7253d7a7, 0x9d268940, 0x385225a9, 0x13ce6698, 0xb51ca269, 0x58da9c80,
+    0x6b6e6b69, 0xa58aa2c6, 0x6cd48253, 0xaeab2aab, 0xac290cb3, 0x18ead003,
+    0x239361e9, 0x0318526f, 0x0dc15a8a, 0xe6aa83bb, 0xbefd742a, 0x3b24237b,
+    0x6e8e2979, 0xce7c2aa6, 0x27559285, 0x85c82a21, 0xf4c93682, 0x82678a65,
+    0xcf0f3e2a, 0xddd6165f, 0x4a74534d, 0x89b67894, 0xf249b21c, 0x2040783b,
+    0x87c27cf4, 0x9ee38e2c, 0xd1326d58, 0x168e5a5f, 0xd4b28f8e, 0xc80e0d55,
+    0x4c1469f3, 0xa119b6c5, 0x9bc48cd9, 0x8f85513d, 0xe9066876, 0xddb61756,
+    0xbd94a7e6, 0xb9554535, 0xb6de8e33, 0x482233ea, 0x7c2cb5d9, 0xacdc5666,
+    0x10c38044, 0x9eb87b0c, 0x7bb7dc86, 0x9c9262ec, 0xbc840545, 0x44938831,
+    0x6d14ec72, 0x65c97291, 0xc9a8edfc, 0xeaf912f5, 0x5429b125, 0xadf5644b,
+    0x893dd21a, 0x6a92e169, 0x50825e23, 0x138997f2, 0xa486106b, 0xba1cd5ea,
+    0xead48c86, 0x94b49c5f, 0xc5c23db0, 0xa819574f, 0xec341b8e, 0xa2d3d6b1,
+    0x6cf2f293, 0x4ac6b4c4, 0xf7510584, 0x80c87729, 0x5132ac79, 0x5bb762c5,
+    0x6a249e25, 0x54115e6a, 0x26444b09, 0x9bd5a554, 0x2d5741c6, 0xc5196913,
+    0x300339bc, 0x46a8234e, 0x2d8f368e, 0x7934229b, 0xa0824673, 0x1adc4ba6,
+    0x3a77c872, 0x3b977531, 0xed77cc5d, 0xdafea3f5, 0xa9c8295c, 0x4d7110ef,
+    0x1164155f, 0x92c142d4, 0x8db80d55, 0x1e728ec4, 0x41dc29f3, 0xf8b531de,
+    0xc6af8ddd, 0x9eb24bec, 0xd2688637, 0xf1649c58, 0x3aac0cb8, 0x20de8377,
+    0x00417a10, 0x14070882, 0xfd1614f4, 0x711494ac, 0x54463b45, 0x9e1c6931,
+    0xc8524de8, 0x06cc88ec, 0xc87305ad, 0xb332d067, 0x254354d3, 0x707c6d7d,
+    0x305f55c7, 0x57268666, 0xdc738d44, 0x59a72e48, 0x93739e39, 0x6551c7d2,
+    0x65ebf614, 0x353daf24, 0xe14a511c, 0x77d43883, 0xae08ce37, 0x9e8391cc,
+    0x34a84644, 0xec6e7ef3, 0x43a4550b, 0x8f123f2d, 0x2c8b3463, 0x8d94eb91,
+    0x42d7fca2, 0x0011d564, 0x4e26f995, 0xa4792a69, 0x0874b482, 0xc894a8b4,
+    0xd62645a9, 0x449d5595, 0xe79e7e52, 0x2c3d46ce, 0xefa8d765, 0x8a1ace6c,
+    0x36aed285, 0xa42b05a7, 0xd2aed512, 0x3090965f, 0x3389c460, 0x2807704e,
+    0x1f160fca, 0x034d2467, 0x0c9da8ae, 0x9a91996c, 0x60aea411, 0x98dde886,
+    0x28f0f839, 0x71e21568, 0xa7e0a14c, 0xd2b6b034, 0xab9cd25c, 0xa67c8c21,
+    0xd4306bfe, 0xcef3bed9, 0xe91694c4, 0x92a26369, 0x87a63796, 0x7c9651f2,
+    0x99abdfe3, 0xe6b2bd2e, 0xe7a4fc4e, 0x77cd690e, 0x8a508a63, 0x62294243,
+    0x60648414, 0x75d0d3fc, 0x9359cf16, 0xb6d40e30, 0xab0d50d3, 0xad299e31,
+    0xc642eaf6, 0x8b38929a, 0xee7db0c5, 0xa82de2c1, 0xea8eaca3, 0x98bd93f9,
+    0x589a2317, 0x5b1003a8, 0x14cf742d, 0x14c75190, 0x1b49bb90, 0x5da9c9ab,
+    0xcc1c2bd4, 0x64c85087, 0xef2af515, 0x993317d0, 0x975a5bb7, 0x1a223589,
+    0x649ba16d, 0xa494435e, 0xbe5c5de6, 0x12f418d5, 0x57d2bc8e, 0x4b06b1e6,
+    0x685ab675, 0x89a324a9, 0x94fce1a9, 0x9ed9e57c, 0x961159e9, 0x43a6df5c,
+    0xf94e39af, 0xac531c35, 0x1424b114, 0xa030acf1, 0x073a51c9, 0x6673927c,
+    0xc4ccd263, 0x49ec1db3, 0x76e3d7c6, 0xb11bbf36, 0xc6705425, 0x23e1caf2,
+    0xb13b4b8d, 0x373e0019, 0x0d77920e, 0x5498acf8, 0x285455d6, 0x9ea96721,
+    0x09a40765, 0xf8006765, 0x00ff3bc0, 0xe96ef077, 0x41aeb61d, 0x4a05d339,
+    0x1bfd332a, 0x203626a1, 0x32e7cd67, 0x6e507bb7, 0x1ab77080, 0x55ad1946,
+    0xa3291e39, 0xd28fe3f5, 0xec3c98f5, 0x5554bc7e, 0x902e24c7, 0x95a6215c,
+    0xd0603287, 0xe739b3c9, 0xad60869e, 0xfbf7c8de, 0x3bf1b6f8, 0x8ad32a75,
+    0x6f6da5d8, 0xb134b324, 0x0e599686, 0x6f6ae46c, 0x72cc66a8, 0xc77162e9,
+    0x1ecc7aa9, 0x385e3f76, 0xa7592ff5, 0xf1fab1f3, 0xccbae9c7, 0x5e3f7a1e,
+    0x592ff538, 0xebc7ce83, 0xeba51ec7, 0xfdd87930, 0xbdd4e378, 0x1f3b0f66,
+    0x977a1caf, 0x63e7c1ac, 0xd28fe3f5, 0xec3c98f5, 0xea71bc7e, 0xe74fb35e,
+    0xbae2f563, 0x34235241, 0x96a274b7, 0x68e5dc32, 0xf4d58da6, 0xdc8524e6,
+    0x68a41123, 0xb2cd947e, 0xd516c7f9, 0xcb59a0a6, 0xa8aa22dc, 0x516d97aa,
+    0xad493c3b, 0x4040c9b2, 0xcf4015cc, 0xe5a46776, 0x3d0ec890, 0xf360d64b,
+    0xc7f1fab1, 0x1eccbae9, 0x385e3f7a, 0xa7592ff5, 0xf1fab1f3, 0xcc7ae9c7,
+    0x5e3f761e, 0x592ffd38, 0xebc7ce83, 0xeba51fc7, 0xfde87930, 0x29dfbe78,
+    0xa7a8a262, 0x9ee75886, 0x2c8027a6, 0x4a221c6c, 0x97d91da5, 0x74423230,
+    0x96d5f38c, 0x50fc81ec, 0x67d354d5, 0x8326eac5, 0x4ad9ce57, 0xa3cbeaf1,
+    0xcb335250, 0xdcca8ec7, 0xa45ffdfa, 0xecd8fa49, 0xd6afcfad, 0xad9f447a,
+    0xfadcca8e, 0x49a45ffd, 0xadecd8fa, 0xfad5afcf, 0x8ead9f44, 0xfdfadcca,
+    0xfa49a45f, 0xcfadecd8, 0x44fad5af, 0xca8ead9f, 0x5ffdfadc, 0xd8fa49a4,
+    0xafcfadec, 0x9f44fad5, 0xdcca8ead, 0xa45ffdfa, 0xecd8fa49, 0xd5afcfad,
+    0xad9f44fa, 0xfadcca8e, 0x49a45ffd, 0xadecd8fa, 0xfad5afcf, 0x8ead9f44,
+    0xfdfadcca, 0xfa49a45f, 0xcfadecd8, 0x44fad5af, 0xca8ead9f, 0x5ffdfadc,
+    0xd8fa49a4, 0xafcfadec, 0x9f44fad5, 0xdcca8ead, 0xa45ffdfa, 0xecd8fa49,
+    0xd5afcfad, 0xad9f44fa, 0xfadcca8e, 0x49a45ffd, 0xadecd8fa, 0xfad5afcf,
+    0x89ad9f44, 0x00ea2aab, 0x9967ea59, 0xb22ccc41, 0x7c0feac8, 0xf819312b,
+    0xf400fff2, 0xc6752bee, 0x41411274, 0x871e325b, 0x10799286, 0x90914cfd,
+    0xc38eeb7f, 0x7215fcdd, 0x65af0af4, 0xfcddc38e, 0x0af47215, 0xc38e65af,
+    0x7215fcdd, 0x65af0af4, 0xfcddc38e, 0x0af47215, 0xc38e65af, 0x7215fcdd,
+    0x65af0af4, 0xfcddc38e, 0x0af47215, 0xc38e65af, 0x7215fcdd, 0x65af0af4,
+    0xfcddc38e, 0x0af47215, 0xc38e65af, 0x7215fcdd, 0x65af0af4, 0xfcddc38e,
+    0x0af47215, 0xc38e65af, 0x7215fcdd, 0x65af0af4, 0xfcddc38e, 0x0af47215,
+    0xc38e65af, 0x7215fcdd, 0x65af0af4, 0xfcddc38e, 0x0af47215, 0xc38e65af,
+    0x7215fcdd, 0x65af0af4, 0xfcddc38e, 0x0af47215, 0xc38e65af, 0x7215fcdd,
+    0x65af0af4, 0xfcddc38e, 0x0af47215, 0xc38e65af, 0x7215fcdd, 0x65af0af4,
+    0xfcddc38e, 0x0af47215, 0x618965af, 0xcd310796, 0x3ac89014, 0xdc685452,
+    0x1fe0ca7f, 0xe0f7fde8, 0x950bba7d, 0x44a952e5, 0x25415390, 0x35c3c45b,
+    0x1ac5a394, 0x9ad28323, 0xfc6556e6, 0xe24ebae0, 0x800cac71, 0x00320020,
+    0x003a0074, 0xd83bc01d, 0xbfc6e3d7, 0xf1f8351e, 0x7e8dc7af, 0xe2f16b3c,
+    0xe2a9986a, 0x11a47992, 0x919712c5, 0xe92842cf, 0x21279063, 0xe1a518e2,
+    0x65b29e05, 0x41b8a6a7, 0x889ecf2c, 0xc866a5c6, 0x45eb4266, 0xa4df720c,
+    0x31b8471d, 0xeb88c7af, 0xa29ae669, 0xe695399e, 0x88f1d9a5, 0xb5c539c0,
+    0x98d5a305, 0x91149ecb, 0xd7183d91, 0x1ebfc6e3, 0xaff1f835, 0x3c7e8dc7,
+    0x5fe3f16b, 0x78fc1a8f, 0xbfc6e3d7, 0x4153381e, 0x56b4714d, 0x6aa6aa34,
+    0xa9ea693a, 0x236dc8a6, 0xb2322368, 0x28d1e906, 0x1bbd0e4d, 0x3fa874c3,
+    0x6d04fcbe, 0xff9f6a37, 0x7f946d00, 0x6be351dd, 0xb571f0f1, 0xda38f8f8,
+    0x6d1c7cfc, 0x360e3e7e, 0x1b071fbf, 0x8d838f5f, 0xc5c1c7af, 0xd7ec4cf6,
+    0x9400ff21, 0xbcbefa97, 0xe1a8295c, 0xb2becde0, 0x6b787a0a, 0x2cdb8ea1,
+    0x1cc51035, 0x65e73473, 0x2b8c6799, 0xc7325b4a, 0x3b776e59, 0xef2b7ea7,
+    0x57b88737, 0x1ab50c3d, 0xc111f56d, 0xe936040d, 0xd3aa626a, 0x50317ebe,
+    0x3916db8a, 0x4a32239d, 0x0cf26cf4, 0xbaa75cc4, 0x7d5b82f0, 0x8668b778,
+    0xd140a68a, 0xe94a922c, 0x138a214b, 0x63942daf, 0x93af7639, 0xb331fb10,
+    0xefdbf43b, 0xd6957555, 0x8e68723d, 0x2553d9ae, 0x24142a4c, 0x82eec493,
+    0x9ef10e40, 0x012b409d, 0x0b2c03dc, 0x145acec5, 0x35bd2a8a, 0xa8e9b735,
+    0x5bd5a912, 0x66abd38b, 0x92340034, 0xde73c900, 0x7b0e90c0, 0xe4a69ac5,
+    0xbe958b97, 0x25d7bcba, 0x130d3435, 0x7620d2ec, 0x89a20e85, 0x72d2979e,
+    0x8f87ad61, 0x838f5f1b, 0xc1c7af8d, 0xe0e3d7c6, 0xf0f16be3, 0xf8f8b571,
+    0x7cfcda38, 0x3e7e6d1c, 0x7fd22e0e, 0x1d3f57e1, 0xdb7fb4ba, 0xf7fde34b,
+    0x74549de0, 0x3aa45cd7, 0x943ccd78, 0xb6464fea, 0x7f142992, 0x3fd2b2cd,
+    0xd7c64084, 0x6be3e0e3, 0xb571f0f1, 0xda38f8f8, 0x6d1c7cfc, 0x360e3e7e,
+    0x1b071fbf, 0x8a838f5f, 0x79ba4aa4, 0x5466a4a9, 0x8a8d369e, 0xfd06a811,
+    0x7f86411d, 0x61419c5a, 0x69e089a5, 0x7115ee2a, 0x34bc32d3, 0x4a2255f5,
+    0x46197474, 0x068a30c2, 0xc840f381, 0xb72cbb65, 0x45cbaa62, 0x0ff55257,
+    0x8c094a25, 0x1c4f536d, 0x9aaa69da, 0x8f67982f, 0x8d8e5822, 0x22e33bcc,
+    0x1a563549, 0x2aeaa94a, 0x2f6c4d0d, 0x14251554, 0x626824f3, 0xd2610854,
+    0x7da23a23, 0x565f5928, 0x19721af4, 0x8a9e3d83, 0xf508a365, 0x0c45bc14,
+    0xdb2c3d70, 0xf34d3629, 0x31e767a3, 0x8224730c, 0x776e361b, 0xdbb6e238,
+    0xe26d474b, 0xd4d653d1, 0xc838c7c3, 0x729ccee2, 0x643a8895, 0x503e1aa7,
+    0x5b9a0a21, 0xeacb159c, 0xf8c17125, 0xfada4a64, 0x506c95bd, 0x233114cb,
+    0x73e3095c, 0x92a4f33a, 0x8ff4f74c, 0x4e01efe2, 0xe3d796e3, 0xf16be3e0,
+    0xf8b571f0, 0xfcda38f8, 0x7e6d1c7c, 0xbf360e3e, 0x5f1b071f, 0xd58b838f,
+    0xeb5a7064, 0xd2968d8c, 0x7710689a, 0x68e3495a, 0xbecf40d1, 0x82f29ed9,
+    0x09bf9f7b, 0xa1c6ba7b, 0x866cb656, 0x9f4babe1, 0xff98d529, 0x67c73900,
+    0x4f76fdae, 0x8e672f26, 0xecfa5dcf, 0xcf5e4c9e, 0xf5bb9e1d, 0xbd983cd9,
+    0x773d3b9e, 0x3179b2eb, 0x7a763c7b, 0xf264d7ef, 0xec78f662, 0xc9aedff5,
+    0xf1ecc5e4, 0x5dbfebd9, 0xd98bc993, 0x7ed7b3e3, 0x179327bb, 0xae67c7b3,
+    0x264f76fd, 0xcf8e672f, 0x9eecfa5d, 0x1dcf5e4c, 0xd9f5bb9e, 0x9ebd983c,
+    0xeb773d3b, 0x7b3179b2, 0xef7a763c, 0x62f264d7, 0xf5ec78f6, 0xe4c9aedf,
+    0xd9f1ecc5, 0x935dbfeb, 0xe3d98bc9, 0xbb7ed7b3, 0xb3179327, 0xfdae67c7,
+    0x2f264f76, 0x5dcf8e67, 0x4c9eecfa, 0x9e1dcf5e, 0x3cd9f5bb, 0x3b9ebd98,
+    0xb2eb773d, 0x3c7b3179, 0x56d5d654, 0x92676a10, 0x51373f6d, 0x94fcbddc,
+    0xe93ea364, 0x00ff3303, 0xba65eba1, 0x0d5beba2, 0x491b300d, 0xcc37e789,
+    0x796a148d, 0x45cd8f1c, 0xc9c9f704, 0x88813847, 0xa596077f, 0xab2b2a40,
+    0xd0ba93e5, 0xc713789a, 0x0d153c92, 0x1d93dfd3, 0x667dacaf, 0x3ee9e7eb,
+    0xd6d78ee1, 0xf375b33e, 0xc7709ff4, 0x591feb6b, 0x4ffaf9ba, 0xf5b563b8,
+    0x7cddac8f, 0x31dc27fd, 0xd6c7fada, 0x937ebe6e, 0x7ded18ee, 0x5f37eb63,
+    0x0cf7493f, 0xf5b1be76, 0xa49faf9b, 0x5f3b86fb, 0xd7cdfa58, 0xc37dd2cf,
+    0x7dacaf1d, 0xe9e7eb66, 0xd78ee13e, 0x75b33ed6, 0x709ff4f3, 0x1feb6bc7,
+    0xfaf9ba59, 0xb563b84f, 0xddac8ff5, 0xdc27fd7c, 0xc7fada31, 0x7ebe6ed6,
+    0xed18ee93, 0x37eb637d, 0xf7493f5f, 0xb1be760c, 0x9faf9bf5, 0x3b86fba4,
+    0xcdfa585f, 0x7dd2cfd7, 0xacaf1dc3, 0xe7eb667d, 0x8ee13ee9, 0xb33ed6d7,
+    0x9ff4f375, 0xeb6bc770, 0xf9ba591f, 0x63b84ffa, 0xac8ff5b5, 0x27fd7cdd,
+    0x4ec231dc, 0x1196b508, 0xd5504d59, 0x24d57a54, 0xa04920da, 0x6d41cf67,
+    0x1ea34327, 0x8610b06e, 0x0fde1520, 0x2370b0e2, 0xd6b114b2, 0xa7656adc,
+    0x18ae718a, 0x9aedc229, 0xc923d133, 0x7120ba22, 0xe44614bd, 0xf9150b82,
+    0x627dedb8, 0x486f37eb, 0x3b7ef7a3, 0xcdba585f, 0xfd28d2db, 0xd6d78edf,
+    0xf476b32e, 0xe3773f8a, 0xac8bf5b5, 0x8f22bddd, 0x7dedf8dd, 0x6f37eb62,
+    0x7ef7a348, 0xba585f3b, 0x28d2dbcd, 0xd78edffd, 0x76b32ed6, 0x773f8af4,
+    0x8bf5b5e3, 0x22bdddac, 0xedf8dd8f, 0x37eb627d, 0xf7a3486f, 0x585f3b7e,
+    0xd2dbcdba, 0x8edffd28, 0xb32ed6d7, 0x3f8af476, 0xf5b5e377, 0xbdddac8b,
+    0xf8dd8f22, 0xeb627ded, 0xa3486f37, 0x5f3b7ef7, 0xdbcdba58, 0xdffd28d2,
+    0x2ed6d78e, 0x8af476b3, 0xb5e3773f, 0xddac8bf5, 0xdd8f22bd, 0x627dedf8,
+    0x486f37eb, 0x3b7ef7a3, 0xcdba585f, 0xfd28d2db, 0xd6d78edf, 0xf476b32e,
+    0xe3773f8a, 0xac8bf5b5, 0x8f22bddd, 0xc17ff8dd, 0xd1a994ed, 0xee567459,
+    0x22494933, 0x1c05ad8f, 0x1763f944, 0x8e4525db, 0xc2cc53ac, 0xa55de458,
+    0xab82423d, 0xcd91672a, 0x43243a49, 0x6953d3b9, 0x10c410cc, 0x28a8ec4f,
+    0x51556e6a, 0xb926d251, 0xce2c27a5, 0xd90ca04a, 0x1435bfdd, 0x60fec90c,
+    0xff182009, 0xa0190700, 0x3f025edb, 0xdaa16275, 0x9ddc3da0, 0xc827e1aa,
+    0x1f6fed18, 0xd5ecdb86, 0x5b3b86f7, 0xfbb6e1c7, 0x8ee17d35, 0x6df8f1d6,
+    0x785fcdbe, 0x7ebcb563, 0x57b36f1b, 0x6fed18de, 0xecdb861f, 0x3b86f7d5,
+    0xb6e1c75b, 0xe17d35fb, 0xf8f1d68e, 0x5fcdbe6d, 0xbcb56378, 0xb36f1b7e,
+    0xed18de57, 0xdb861f6f, 0x86f7d5ec, 0xe1c75b3b, 0x7d35fbb6, 0xf1d68ee1,
+    0xcdbe6df8, 0xb563785f, 0x6f1b7ebc, 0x18de57b3, 0x861f6fed, 0xf7d5ecdb,
+    0xc75b3b86, 0x35fbb6e1, 0xd68ee17d, 0xbe6df8f1, 0x63785fcd, 0x1b7ebcb5,
+    0xde57b36f, 0x1f6fed18, 0xd5ecdb86, 0x5b3b86f7, 0xfbb6e1c7, 0x8ee17d35,
+    0x6df8f1d6, 0x785fcdbe, 0x7ebcb563, 0x57b36f1b, 0x70bf18de, 0x17c9b24a,
+    0x6525131a, 0x9557a526, 0x33f1c610, 0x116b971c, 0x6433922f, 0xd4b0c3a1,
+    0xcb92b642, 0x9003389e, 0xd21354bc, 0xf88ad9b6, 0x5ca3a989, 0x8fa4fcc7,
+    0x7e6d9ca8, 0xbd360e3e, 0x9eee90f3, 0xe2f4eff0, 0x7b413829, 0x47eda286,
+    0x59246a75, 0xbd7d5b65, 0xa4924222, 0xc813cd0d, 0x875c17ce, 0x55591773,
+    0x4774309b, 0xfd45ad92, 0xc750f0ad, 0xf7344d59, 0x6a81a85a, 0xbedb051a,
+    0xae2bdda5, 0x0966e647, 0x4acf0555, 0xe10bc1e6, 0xb64457f8, 0x2a1beef8,
+    0x68b1a692, 0x15408366, 0x7695f314, 0x19172261, 0x0ed009e9, 0x67c8986d,
+    0x9486479e, 0xb6eab2ea, 0x766a16dd, 0xa701b3fd, 0xc9e1e9c9, 0x5b629e72,
+    0x5596d028, 0x4f92f401, 0x386b8278, 0x284b4d59, 0x6a6b2989, 0x5e4551cb,
+    0xe0309a86, 0x4dbbc8d3, 0x1a67356c, 0x463e1fc7, 0x7747a561, 0xa22edc14,
+    0x2d9a9ea9, 0x55316485, 0x5335b423, 0xde9da243, 0x6a34d724, 0x0fb38eda,
+    0x404d76cd, 0x07c65d36, 0xa62a3c14, 0x9c86aaad, 0x1d415752, 0x55529451,
+    0x2a88164f, 0x363b5d4c, 0xd7477ad4, 0x91ade4a4, 0x5d0de138, 0xb4ad654f,
+    0xcf5ade91, 0xef2c354f, 0x11a4462d, 0x3a6d47eb, 0xa4c292b6, 0x72065ab6,
+    0xf4d99d0e, 0x7a7fd762, 0x6dadbc14, 0xb6f4aec1, 0xd5e2a6f7, 0x512fa0b1,
+    0xc5b14e25, 0xb932abd4, 0xda49a3d6, 0xcfd5a8ba, 0xc203a4d1, 0xaaa355da,
+    0xb29692aa, 0x86e56819, 0xa3298a2a, 0xc6c7d411, 0x973ec90f, 0x04b03460,
+    0xe83282f4, 0xf18e09de, 0x2a48f70c, 0x4ded8624, 0xcc55b538, 0x4532b3b4,
+    0x4986604e, 0x8f69b98e, 0x923e8c3f, 0x74417d63, 0x6f19f36c, 0xe90b27c5,
+    0x43a4a56a, 0x35045d47, 0xae86218e, 0x6aa6b268, 0x2462bb83, 0xbe36430c,
+    0x9b3c3767, 0x149921a7, 0x323429fc, 0x3ab6d2dc, 0xef8ab4fa, 0x8ce3193a,
+    0x2b0d05c9, 0x7704926c, 0x2c9b01cc, 0x3ae923c5, 0x2ece5b4e, 0xa0a4281c,
+    0x2a6cd8a8, 0x4771b6ea, 0xb1b4543d, 0x86a4236d, 0x9824ba52, 0xac0c32e6,
+    0x51cebd1b, 0x37c8a69e, 0x8aeca109, 0xaba5e05b, 0x595a67aa, 0x6828f036,
+    0x1ba11a56, 0xb573d22c, 0x5d256824, 0xdd6f9445, 0xf82996d3, 0x44451d49,
+    0x5947ed34, 0xd0f82a4c, 0x8d759aa4, 0x9e49ad44, 0x86c418d4, 0xe4c84868,
+    0xb23b4525, 0xcf84b7c5, 0x8ab66a4f, 0x95aeeb88, 0x4daa42f5, 0x9bb6e914,
+    0xa9441565, 0xe9e07db4, 0x03190419, 0x01794eb9, 0x15e582be, 0xc81a92c6,
+    0x52e60835, 0x56e7be42, 0xc3e82a56, 0x4a5dbd33, 0xb71b899c, 0xe3d7c66e,
+    0xaf85e3e0, 0x21b783ab, 0xef5f1afc, 0x858abfd4, 0x01d1d0f4, 0x6f4a2abb,
+    0x5f1b53ec, 0xaf8d838f, 0xd7c6c1c7, 0x6be3e0e3, 0xb571f0f1, 0xda38f8f8,
+    0x6d1c7cfc, 0x380e3e7e, 0xa0af7e4b, 0x711b969e, 0x5b4fa419, 0xc871365c,
+    0x273aa278, 0x006dc5fb, 0xc9e47c9d, 0x552c63bc, 0xa16868df, 0x91a8a8a4,
+    0xb6cc1a96, 0xbbd42852, 0xc482dae3, 0xeee9c21c, 0xb23b4980, 0xb6261cc4,
+    0x57555154, 0x142cb2a4, 0xc6c30964, 0xc8962acb, 0x75029247, 0x4ce9186d,
+    0xdaf9ce8f, 0x26e17171, 0x7bc655ab, 0x5b4d4f7b, 0xe381d444, 0xcdd9a6ab,
+    0x209aa810, 0x7538c318, 0xda4c242b, 0x00c21f49, 0xb82b4e73, 0xbcb66d4f,
+    0x214bd550, 0x7557e399, 0xcd263386, 0x5c9a2c5b, 0xa4ab0b88, 0xefb4cd28,
+    0xeb5c91d3, 0xa06c47b8, 0x59a29a82, 0x1aac449a, 0x640ac4e9, 0x56cb2379,
+    0xa56b4ed3, 0x441d6006, 0x9c4e471d, 0x5eb769c3, 0xcbb12e69, 0x473b1b2d,
+    0xce12a614, 0x004c3d86, 0x3d27a839, 0x61461024, 0x36467d4f, 0x1b071fbf,
+    0x8d838f5f, 0xc6c1c7af, 0xe3e0e3d7, 0x71f0f16b, 0x38f8f8b5, 0x1c7cfcda,
+    0x52db107e, 0x5d770f5a, 0x346dfe78, 0xf0d9af7e, 0xd5ca2e03, 0xded61bb1,
+    0xd4447cfa, 0x27ea8fd3, 0x716d5c1b, 0x4fbb7b55, 0x6343555d, 0x889ba4a3,
+    0x1575e304, 0x6b8f20ad, 0x12412420, 0x7b1df1c6, 0x07b9388f, 0x0a200426,
+    0x8e7d45cd, 0x6e64674b, 0x36bb6d08, 0x6d16aa78, 0x36914441, 0xbae6d896,
+    0xc86d57a6, 0xc3c50e23, 0x1c3a3544, 0x4fb67d45, 0x35743549, 0x4f4bc991,
+    0x641579f9, 0x73f92dce, 0xc68931e1, 0x5cf29b7f, 0x0073bde1, 0xad082f9c,
+    0x8e851a32, 0x586a27ba, 0x5565a61e, 0x6b0c9b97, 0x9e1dd8ad, 0x391f6952,
+    0xd0ebd662, 0x162308ca, 0xaa5b17fe, 0xb2ae5228, 0xa61de978, 0x332d5e78,
+    0xa4dac4ba, 0x21c85068, 0x40a09921, 0xd524e3ec, 0x939ce698, 0xcf8e7013,
+    0xd33c154f, 0x751c4757, 0xcea72468, 0x67bccb39, 0xc2924da2, 0xc03b4465,
+    0x90141169, 0x4f8c3940, 0x59ba7578, 0xbcf829e9, 0xeb28b7b4, 0x6e867924,
+    0x4b8460da, 0x20e94013, 0xcee74b8f, 0x3e66922c, 0x17bf936e, 0x2be2b54b,
+    0xd5ba3da5, 0x358d040d, 0xad31551b, 0x2bd1ee13, 0x9aa20121, 0x72419631,
+    0x3dcf4905, 0xb85bccfd, 0x2597ec42, 0x1435adbc, 0xaa55a7f6, 0x4c632692,
+    0x1ba326cb, 0x26c91846, 0x7a44b9a3, 0x8d1c79a4, 0x97ec3300, 0x289e3694,
+    0x66ecf82b, 0xdb20ca90, 0x98e99405, 0x467294e7, 0xd944db22, 0x1a295f0d,
+    0x3d5f1a0d, 0xbd61ac0c, 0x96713dc1, 0x6e2f9c1b, 0x786ac916, 0x499815b7,
+    0x1c0f359c, 0xa55682b5, 0x9b5d620c, 0x1612b245, 0x2296ba2c, 0xc24b6308,
+    0x426d4d1b, 0x45d7d2d2, 0x4482ee34, 0xa98b2c8c, 0xb3e6874a, 0x0864a8c6,
+    0xb6413475, 0x45eb93a9, 0xdfa6c931, 0x0c59aac2, 0x29aa5cb1, 0x237baa69,
+    0x124d4751, 0x515cc32c, 0x9437d698, 0xbb8c3093, 0x8f2403bb, 0xa4234714,
+    0x9b8a0d0d, 0x788ab6dd, 0x22ab6aa9, 0xd9b27982, 0x18bafac6, 0xa8ec52e9,
+    0xa1271552, 0xe4d468a6, 0x2229794e, 0x1aaef54b, 0x5a2d21be, 0xa3b85ea5,
+    0x27e698d8, 0x311eca5c, 0xc96344a8, 0xaf2d8195, 0x65cf6742, 0x36848f38,
+    0x1551a3ca, 0xd453641d, 0x08d21443, 0x6c03caf4, 0x3443cf81, 0x23289368,
+    0x9bdbc57e, 0x3b4f07ce, 0xa4289c14, 0xdb0aba16, 0x2c3d45b5, 0x082b8bd5,
+    0x07768ee2, 0xe6913467, 0x95a820b1, 0xd95c2557, 0xe4d992ce, 0x5347347f,
+    0xb0a4d11c, 0x8a14c9ba, 0x8210391e, 0x0c33acae, 0x6d8c780f, 0x0d06c271,
+    0x3382ba64, 0xefa0461c, 0x7f2484ef, 0x8c4780d0, 0x3e052e7e, 0xf2fbac8b,
+    0x47956f2d, 0x568af18c, 0x4f8afecb, 0x716e63f3, 0xf8dd3db6, 0xb8b62f89,
+    0x14b42d2a, 0xf240d4b1, 0xb82b694a, 0xe9d444c2, 0x7900ff39, 0xf1cc1013,
+    0x0c99e674, 0x377f8df7, 0x5af71415, 0xca75ab6a, 0x983a9710, 0x5c1d8d28,
+    0xd24ee96e, 0x2399cceb, 0xc8351672, 0xa2c65bb6, 0x67070baa, 0x5cc78e63,
+    0x589a151e, 0x5fd58c53, 0x1055aee9, 0x9ea2e946, 0x6c0e0e04, 0x67b22b58,
+    0x9b5dd2ce, 0x678eda3d, 0x3cd6d113, 0x8465279c, 0x8d827191, 0xfcf17929,
+    0x57178aa9, 0x9399df1b, 0xa0291f30, 0x8adf181f, 0xe7c82a6a, 0x8c804792,
+    0xbd0d33f8, 0xed8fb84e, 0x78358aa5, 0x7a633e77, 0x67f2af91, 0x21469e2f,
+    0x3848aea0, 0x1e009b34, 0xa786d5de, 0x16c9465b, 0xc265f2d7, 0x4faa36c8,
+    0x9d9858ce, 0xe2d48c39, 0x53b96edf, 0x8ee5a9dc, 0x49225b8c, 0x9a1aab1d,
+    0xad8a9eb9, 0x7476da79, 0x844ad28e, 0xb903d286, 0xb130a340, 0x42e3be91,
+    0xf916ef6b, 0x8a5aa6a6, 0x49a7a928, 0x070a9ab6, 0x5030c662, 0x96df76b0,
+    0xe90152f5, 0x92d8d6c5, 0xba2d0d5b, 0xe768a108, 0x8f21a98e, 0x8c6756e4,
+    0xe9ba54e6, 0x576e9821, 0xbc10a4d6, 0x253103f5, 0x2a6abaae, 0xa7e516e6,
+    0x306aa29e, 0x6ad99a90, 0x93a068e7, 0x15f5b45b, 0xcb014f35, 0x8d45d8fd,
+    0xfb1cccb2, 0x1e6a18b7, 0x3ca2d5ea, 0x56b2a3e9, 0x93bab4d3, 0x2127ac74,
+    0x1d129674, 0xcb8537cc, 0x564e4f7f, 0x5057baf4, 0x9a1aa9d9, 0xa769e828,
+    0x898eaf86, 0x298e9794, 0x0f21d619, 0xe54d12e5, 0x72526f4b, 0xcd79863b,
+    0xbbf65a41, 0xf2c13aed, 0x2a49b7d5, 0x5fa45d20, 0x727a0929, 0x955eabad,
+    0xb9748ef9, 0x640efe56, 0xae6b5d03, 0x154b73e3, 0xb68ead18, 0x0d269a96,
+    0x532a2d5d, 0x136b1449, 0x6886848a, 0x6a444c0d, 0x116f86e6, 0xfa96c41b,
+    0x954baa2a, 0x8e35a25c, 0xd252b626, 0xa8b62ac1, 0x12c7b0f6, 0xc9f2aa90,
+    0x7759a151, 0x2e24496d, 0x761427f6, 0xdbd68afb, 0x24292a2a, 0x5f35d3da,
+    0xae96ac1c, 0xcd9c873a, 0x4019891c, 0x092cb3d2, 0x6400e49e, 0xf7083bd2,
+    0x5dd526b1, 0x1274cbd8, 0x68aae2da, 0xad32a816, 0xa6ad1657, 0x78a44992,
+    0x65a586e5, 0x8a4c666a, 0x97e3cd3e, 0x10240029, 0xad305b48, 0x15c3b7a6,
+    0x40258d74, 0x0cb94ed6, 0x59ceaaae, 0x3d7f7923, 0xcc891c90, 0x0139e08e,
+    0x09c7b98d, 0xaf62d5e5, 0x7f8af404, 0xffe794ef, 0x47c56f00, 0x4d3aed37,
+    0xadfc00ff, 0x8d49f63f, 0xbf8dd7bf, 0xd7bf8dd7, 0x8dd7bf8d, 0xbf8dd7bf,
+    0x8cb78dd7, 0x6e5ed1e0, 0xd84ab735, 0xea184aa5, 0xebecd08b, 0x4a928969,
+    0xa5515534, 0x47ca8565, 0x2e8bc920, 0x9e339f5a, 0x741d41ec, 0x5a0ab694,
+    0xd6924a9a, 0x42cebedb, 0xd2a04bd0, 0xb33906a1, 0x29c0962b, 0x663e89d9,
+    0xa1e23748, 0xc2c9116e, 0x9c202959, 0x66d44c3d, 0x33495836, 0x2d159045,
+    0xcd74a94f, 0xd3b35a26, 0x5c4ee6a8, 0x3535b1fc, 0xd97ec153, 0xaac85cd2,
+    0xe361d48e, 0x55254d51, 0xdb748641, 0xe51be4bb, 0xc4900635, 0x46c6d932,
+    0x803cd298, 0xb52deb95, 0xd95639d7, 0x48777c3d, 0x04de5821, 0x38da6cda,
+    0x400d2d04, 0x9e474a0a, 0x200df9fd, 0xa623ab65, 0x33eb6a0a, 0x248d2ad9,
+    0x9a5adcd5, 0xa6a119aa, 0xa469591b, 0x575992a9, 0xc8adae42, 0x03d2d024,
+    0x50c330a3, 0x2fb89ad4, 0x97ba042b, 0x75cd428c, 0x900a2da8, 0x67392656,
+    0xc9cdd318, 0xbb65340f, 0xfe6dec76, 0xbcfe6dbc, 0x6dbcfe6d, 0xfe6dbcfe,
+    0xbcfe6dbc, 0x70bcfe6d, 0xafa5f5e9, 0xd5bff5c4, 0x033efb4b, 0x598d8bbe,
+    0xb0c800ff, 0xa7b900ff, 0x3ce3dbc6, 0xc733be6d, 0xe3828564, 0x54703575,
+    0x64c63535, 0x149ea6ab, 0x963e2bda, 0x65310b0f, 0x193d81c9, 0xd36aa0e6,
+    0x8d9bd4a5, 0x056d654d, 0x425de1b2, 0xfcd53476, 0x038da666, 0xa8311a3b,
+    0xbe912c47, 0xd4bdcbfd, 0xe71084e6, 0x2ba96240, 0x217c5ca5, 0x3d5351b8,
+    0x7c6bbe2d, 0x08312850, 0x2ce94445, 0xd758a47a, 0xca643498, 0x3dcb73da,
+    0x5838e7fc, 0x60e38a20, 0x438da058, 0x50122ada, 0xce955f23, 0x70577e9c,
+    0x9e73990f, 0xbfd5f3bc, 0xb4048f14, 0x83263a96, 0x716f6929, 0x41bc6aad,
+    0x99259943, 0x90493f94, 0x581b1a04, 0x8cce7cc8, 0x6c4b4d56, 0x704f57bc,
+    0xb51435a1, 0x4247b074, 0xc6924ec9, 0x1e95389b, 0xc4925305, 0xbc9b1f73,
+    0x9b2c9b0c, 0xa6a7e816, 0x4ebae0aa, 0x78898cac, 0xaa671b71, 0xf142e618,
+    0x04efd9c6, 0x458e1b29, 0xc5dcd373, 0x1c2e99d6, 0xe689a320, 0x1b7b81aa,
+    0x25296d2b, 0xce9acb10, 0x2465dddc, 0xc67b4e1a, 0xf162f75b, 0xd4868a69,
+    0x264d8416, 0x2b6bf89a, 0x5d4d9765, 0x4f9ba844, 0x48089196, 0xcceb10e6,
+    0xae50a1c7, 0x527e90a7, 0x286d3a4c, 0xa6156a6a, 0xbdbb1a96, 0x0c259dbf,
+    0x63ca3134, 0x50bcab13, 0x17e8c853, 0x85f4a59d, 0xb6f4595d, 0x231aaeac,
+    0x9188d6bb, 0x62708863, 0x425115a9, 0x4969cea0, 0x67140000, 0x510c3999,
+    0x27570dcb, 0x24e82869, 0x7a8eb682, 0xf6a99a7a, 0x72c10601, 0x7c33a791,
+    0x12c149e7, 0x6c86bcae, 0xcaa2a6b1, 0xd845900c, 0x15dbbc4b, 0x72fa0635,
+    0x0432a094, 0x2bc8e059, 0x3d2fa865, 0x73e4c8f3, 0x82a4bb38, 0xcc4970e3,
+    0x494bb2c3, 0xea5644c5, 0x55a9d67a, 0xc711e348, 0x5392ce34, 0xfc024c3c,
+    0x67770c89, 0x2934a9b8, 0x5d5ebbb3, 0x888a5aa1, 0x1dc2ad28, 0xa5596aac,
+    0xf9e8254a, 0x003233d9, 0x99c51bda, 0x4b4315c5, 0xa6916a5b, 0x2e29d991,
+    0xa5104991, 0x365a4a5a, 0x29825a6a, 0x118d4461, 0x4832b19c, 0x717db1e0,
+    0xf20d03e6, 0xd9b6e36c, 0x4f356ee7, 0xc4d4d122, 0x7534adb3, 0x1bb7b254,
+    0x589ad69d, 0x9ed965e4, 0x81442c96, 0xe48cee90, 0x619a6171, 0xc013a369,
+    0x7f04f2b4, 0xae104493, 0x7d942b93, 0x6546c890, 0x0065b453, 0xaa4a4c0d,
+    0xbe6d1402, 0x5ceac533, 0xdf2117ed, 0xcdfea8a2, 0x641515bf, 0xd53115d4,
+    0x9ef17940, 0x4e5df383, 0x0bfe46e6, 0xddbbc70d, 0x31bcf01b, 0x92aa2183,
+    0xaed0dd70, 0x39317f84, 0x2cc7e81f, 0x47adba29, 0x1caf1f95, 0xb5eaa6b0,
+    0xbc7e541e, 0xaa9bc272, 0xfa5179d4, 0x6e0acbf1, 0x47e551ab, 0x292cc7eb,
+    0x9547adba, 0xb01caf1f, 0x1eb5eaa6, 0x72bc7e54, 0xd4aa9bc2, 0xf1fa5179,
+    0xab6e0acb, 0xeb47e551, 0xba292cc7, 0x1f9547ad, 0xa6b01caf, 0x541eb5ea,
+    0xc272bc7e, 0x79d4aa9b, 0xfcf0fa51, 0x7474a52e, 0xae825a6a, 0xc6358cac,
+    0x58055633, 0x30630e66, 0xbdbff14e, 0x43533888, 0x43700c4d, 0x44915047,
+    0x56eba234, 0x594e66c8, 0xcf3b16b3, 0xc2729c74, 0x79d4aa9b, 0xcbf1fa51,
+    0x51ab6e0a, 0xc7eb47e5, 0xadba292c, 0xaf1f9547, 0xeaa6b01c, 0x7e541eb5,
+    0x9bc272bc, 0x5179d4aa, 0x0acbf1fa, 0xe551ab6e, 0x2cc7eb47, 0x47adba29,
+    0x17af1f95, 0x73c9108e, 0x1947538c, 0x77509f86, 0x429273d4, 0xb71c34bf,
+    0x6f391d04, 0xdd73e4cc, 0xf0b4e297, 0xa32928a2, 0x0959aea6, 0xd1244285,
+    0x6e90fa80, 0x904aea50, 0x8cb96454, 0x4f9f01f5, 0x5fed2a4f, 0xff993fa5,
+    0xae721c00, 0xf953fad5, 0x2ac7f19f, 0x3fa55fed, 0x1c00ff99, 0xfad5ae72,
+    0xf19ff953, 0x5fed2ac7, 0xff993fa5, 0xae721c00, 0xf953fad5, 0x2ac7f19f,
+    0x3fa55fed, 0x1c00ff99, 0xfad5ae72, 0xf19ff953, 0x5fed2ac7, 0xff993fa5,
+    0xae721c00, 0xf953fad5, 0x2ac7f19f, 0x3fa55fed, 0x1c00ff99, 0xfad5ae72,
+    0xf19ff953, 0xc7e275c5, 0x9e67635e, 0x82b104e1, 0x702e35ab, 0x31ef50c8,
+    0x42a9e7b1, 0xcccd37d9, 0x0d988c32, 0x6cdfd040, 0xbd38f876, 0xa8d3aa39,
+    0x5ac63bbb, 0x5dba1d49, 0x6e0b30db, 0xf08e2aee, 0x5fed2ac7, 0xff993fa5,
+    0xae721c00, 0xf953fad5, 0x2ac7f19f, 0x3fa55fed, 0x1c00ff99, 0xfad5ae72,
+    0xf19ff953, 0x5fed2ac7, 0xff993fa5, 0xae721c00, 0xf953fad5, 0xe1c1f19f,
+    0xc60dac5d, 0x3e84f8a0, 0x9b1703b6, 0x15aaddb3, 0x85e198f4, 0x3919434a,
+    0xcee6a891, 0xf9d46ed9, 0x0ae8f20c, 0x7f9633a3, 0x8ddcb3b3, 0x346ab1ae,
+    0xa2958d97, 0x31ce4795, 0x9f9b47b6, 0x0e2b5875, 0xf07859fe, 0xbab4249c,
+    0xff02c7e7, 0x99e30500, 0xc98f7858, 0x3b92e411, 0xb4a21cc7, 0x26f2e4f5,
+    0x15e558f6, 0x93a7afab, 0x28c7b237, 0x3c795dad, 0x3996bd99, 0xe9eb6a45,
+    0xb1eccde4, 0x5e572bca, 0x656f264f, 0xbada518e, 0x7b3379fa, 0xd58a722c,
+    0x9bc9d3d7, 0x569463d9, 0x4c9ebcae, 0xa21ccbde, 0xf2e475b5, 0xe558f666,
+    0x27afab15, 0xc7b23791, 0x7d5dad28, 0x96bd993c, 0x67dabe27, 0xc10d6882,
+    0x91144d14, 0xe998b3e7, 0x595d21da, 0x6779c66c, 0xfa8c599e, 0xee2dc533,
+    0x4f4b4bd3, 0xe2282e4a, 0x0de2189e, 0x687599b3, 0xe8b4ba50, 0xb3f7396d,
+    0x28c7593f, 0x3c7d5dad, 0x3996bd99, 0xe9eb6a45, 0xb1eccde4, 0x5e572bca,
+    0x656f264f, 0xbada518e, 0x7b3379fa, 0xd58a722c, 0x9bc9d3d7, 0x569463d9,
+    0x449ebcae, 0xa21ccbde, 0xf2e4f5b4, 0xbe58f626, 0x7a9e9270, 0x99e82859,
+    0x128d33a5, 0x169555cc, 0x0e54ce3f, 0xe69b9915, 0x5248a7e7, 0x97e5cc72,
+    0x186500ff, 0x167996a2, 0x65796328, 0x8d23a573, 0xdc13bb4b, 0x3f495055,
+    0xbc811756, 0x2d0c7525, 0x75fa0384, 0xf3b71174, 0xe34a95a4, 0x9163d4f9,
+    0x68f0265c, 0xdf6ffbf4, 0x13aec831, 0x7d7a3478, 0xe498efb7, 0x1abc0957,
+    0xf7db3e3d, 0x842b72cc, 0x9f1e0dde, 0x39e6fb6d, 0x066fc215, 0xfdb64f8f,
+    0xe18a1cf3, 0xa7478337, 0x8ef97edb, 0xc19b7045, 0xbfedd3a3, 0xb822c77c,
+    0xe9d1e04d, 0x63bedff6, 0xf0265c91, 0x6ffbf468, 0xaec831df, 0x7a347813,
+    0x98efb77d, 0xbc0957e4, 0xdb3e3d1a, 0x2b72ccf7, 0x1e0dde84, 0xe6fb6d9f,
+    0x6fc21539, 0xb64f8f06, 0x8a1cf3fd, 0x478337e1, 0xf97edba7, 0x9b70458e,
+    0xedd3a3c1, 0x22c77cbf, 0xd1e04db8, 0xbedff6e9, 0x265c9163, 0xfbf468f0,
+    0xc831df6f, 0x347813ae, 0xefb77d7a, 0x0957e498, 0x3e3d1abc, 0x72ccf7db,
+    0x0dde842b, 0xfb6d9d1e, 0xf56d2be6, 0x1576e9b6, 0x4bd3d2d4, 0x1b646196,
+    0x86d17798, 0x24fceb68, 0xdf3f1e66, 0x11ecc17f, 0x5b958b1a, 0x8ea76580,
+    0xfc89289a, 0x0c6a52c1, 0x10897784, 0x25fae72a, 0x411b7787, 0x6d9cfedf,
+    0xdec5b431, 0x199ab6ec, 0xa8165a2b, 0xc9a6f108, 0xb493d964, 0xa3383f6d,
+    0x7e177ff4, 0xd34eb828, 0x5f474356, 0x3db5ad6b, 0xf52a6e50, 0x75e79824,
+    0xc5cc63de, 0xe6cb9616, 0xcd63709e, 0xc6e74adc, 0xdb62d6a1, 0x311db447,
+    0x376817ed, 0xd533bd67, 0xa3a3bfd1, 0xaaf72d7e, 0x49558a4b, 0x968e6813,
+    0x32765aa6, 0x12918048, 0x0cf2a9a6, 0xccce4274, 0x82f3c4a8, 0x854edcea,
+    0x7591e349, 0xbdc82247, 0xaec3911a, 0xb966a463, 0xe1afd88d, 0x0997f42c,
+    0x7ad6d46d, 0xc5908cbb, 0xd2d4cc14, 0x11a02cf4, 0x2024089a, 0x3dcf7202,
+    0x658bbde7, 0x4be59af2, 0x3ad237c6, 0x53d3f4cc, 0x91a4bad4, 0x3c034654,
+    0xb9d7f27b, 0x24250781, 0x0a52e47c, 0xaa025783, 0xa3124fbb, 0x5069c7fc,
+    0x1100ff2b, 0x9bbfc989, 0x29de543c, 0xada8aba9, 0xadb613f2, 0x64b1b2da,
+    0xa348e358, 0x30cbcd66, 0x47c0c839, 0x25ce811a, 0x966eae8e, 0x31eb11e3,
+    0x066a136d, 0xb4b11ea3, 0x4f79bb0b, 0xbcf1069c, 0xfe8eb78c, 0x4d5bcc38,
+    0xa93dd696, 0x8bb68819, 0xf32ccbb4, 0xb2ac9ed1, 0x6f74f419, 0xc4dfc3e8,
+    0xb605ddf1, 0xdba69e24, 0xa884702c, 0x399e86a8, 0x5616c8dc, 0x51551e49,
+    0x64f36b0c, 0xcc6f5d77, 0xcdba390a, 0x99b1484c, 0xe0228aa4, 0x4151796e,
+    0x4961866c, 0xfe593639, 0xfece7d6e, 0x8090781a, 0x181222d2, 0x9514ce80,
+    0x0e109b51, 0xd81b8559, 0xe1bc01f4, 0xe8504766, 0x197ae8ea, 0x8e9c521b,
+    0x83192647, 0xbabb11bc, 0x1bd3c632, 0x7f076d4c, 0x68c371fa, 0x51c39e61,
+    0xd232a833, 0x3fb00449, 0x789229e7, 0xfa6790a0, 0x52871c2d, 0xf41012f4,
+    0xdbf7cba8, 0x5da02f80, 0xffdf66bc, 0xb6b1fb00, 0xc6e88ff1, 0xb78dc7db,
+    0x972d1c8f, 0x3fc3243b, 0xdadfd4f7, 0x34ee5c8c, 0x15bb1ab7, 0xd4f1143d,
+    0x0aca15cb, 0x7db030a7, 0x54e33494, 0x2e77d9a5, 0xa7477663, 0x32b48dc7,
+    0xc3d4d057, 0x5e1b2c15, 0x68236911, 0x57a4dcf2, 0xde364794, 0xa7a2a553,
+    0x794840d2, 0x7a1b39e3, 0xb183cfe5, 0x84ebd694, 0x997a043b, 0x6697226f,
+    0xa94453d5, 0x60ca1c4d, 0xfde71c35, 0xa448a4ae, 0x8efa12b2, 0x8e1425a6,
+    0xa9b3c90b, 0x9f1ac4be, 0x5542d642, 0x224d1769, 0x41c22cb3, 0xb190994e,
+    0x5946a1e6, 0x6e741466, 0xa76ba102, 0x107735e1, 0x280e14af, 0x69c87529,
+    0x99d6a9a2, 0xbb4c372f, 0x43fd7e97, 0x0b17737f, 0x66e9344c, 0xab679ea2,
+    0xb5bd9735, 0x344acc74, 0xc9a232ef, 0x80d49696, 0x6d32d2a8, 0x67433243,
+    0xa30553d1, 0xd7d4d5b2, 0xa4a4b273, 0xd38ea6a1, 0x7134cd13, 0xa81122a4,
+    0xc99455c2, 0xe6569320, 0x66f5ad2f, 0x4edd69b2, 0xc14df2b4, 0x3563ae99,
+    0x69532b68, 0x5e46b23c, 0xb676772a, 0x004522eb, 0x91d17586, 0x3e54401b,
+    0x461d8ab1, 0x6fa79aba, 0xb3d30d49, 0xcf4b6d12, 0x7ef97a70, 0x92a72757,
+    0x60792a9a, 0x1b735958, 0x2c485542, 0x2a004ab2, 0x2487bd94, 0xaa27dcd4,
+    0x842ff28e, 0x35d2c233, 0x35af8d52, 0xd8952444, 0x629597f4, 0x84865579,
+    0x9e26bad5, 0xf869182a, 0x95a88856, 0xc291542b, 0x292e479b, 0xd90cf438,
+    0xbbd43923, 0xa5f21c4d, 0xc86ac881, 0xb6856ae4, 0x1770e7a2, 0xa16221d7,
+    0xbc6aeca5, 0x1f8bc4b2, 0x06ef5217, 0xdae48182, 0xc33acde7, 0xb2a1b13e,
+    0x5c134fdd, 0xc3052b39, 0x5cf1e868, 0x8d778155, 0x598da4e6, 0xd97847e1,
+    0x46914c5f, 0x5a60728a, 0x73e6b73c, 0xd34a05c7, 0x42a674c5, 0x6a5d3076,
+    0xb6241552, 0x2c571a94, 0x6746f1cf, 0x6de377ba, 0xc7dbc6e3, 0x7f8cb78d,
+    0x26573846, 0xcc7805ab, 0xdfdfe26f, 0x7d00ff29, 0x867127f8, 0x09a2a28e,
+    0xd62a469c, 0x2ac40e2d, 0x693221ed, 0x6a594e52, 0x305eb612, 0x531b7707,
+    0xa7369ef1, 0x4f6d3ce3, 0x459478c6, 0x86e7183a, 0x1324a339, 0x1089b11c,
+    0x384ad091, 0x6eee482a, 0xa56088dd, 0xe9a925a6, 0x86d9e929, 0x3882604c,
+    0x31f10e8b, 0x473c92a2, 0x598b561c, 0xed528993, 0x9c0c890b, 0x40662d5a,
+    0xd1171273, 0x3027b8a8, 0x7807eac4, 0xa8a9e139, 0x8a5acad8, 0x00ff8c95,
+    0x114d2d96, 0xc6c16433, 0x4cf994d4, 0xe7e7069c, 0x46ba01ce, 0x029e8e22,
+    0x61780ac6, 0x8631142e, 0x41b08c24, 0xa3280692, 0x03728330, 0x90e146f3,
+    0x5a8911c0, 0x66621461, 0x8c308d50, 0x42475909, 0x656b99b4, 0x434ec01d,
+    0xc694230e, 0x8d1c45d2, 0xa4896b13, 0x1d37e640, 0x4a60190f, 0xe432ee38,
+    0x2a9a787c, 0x623c9d7a, 0x1f8d0a9a, 0x4b0a6f37, 0x3b9d3ea7, 0xf1b36c45,
+    0xe7a95862, 0x86a72708, 0xc4f81e61, 0x0f81a4b0, 0xd2a9357d, 0x04968b7f,
+    0x5263e254, 0x0d15e129, 0xa010a7b9, 0xc8808c98, 0x7768a7cb, 0x40b73700,
+    0x8d8db903, 0x1a8c9b31, 0xe8400d68, 0xdfa630a8, 0x74e54fa3, 0xdfbcf9eb,
+    0xa3bbd19d, 0x23474d0f, 0xd251f248, 0xb280f2c8, 0xefc6d3bb, 0x2ca4822a,
+    0x804bc88c, 0x480c0851, 0x9a2f1305, 0x691a9632, 0x69e96df4, 0x4ffed9e7,
+    0xa34b026d, 0xb4d19af8, 0xba8c0ef4, 0x9e890806, 0x99314c39, 0x9022d421,
+    0x06910cc6, 0xe446581a, 0xcd4b4d6a, 0x3766246d, 0x458cd81d, 0x318cbd0e,
+    0x2473b4c5, 0x6dc2389b, 0xfa2e3d24, 0xbae7d440, 0xe91e9bcd, 0x67fcd4c6,
+    0xcff8a98d, 0x9ef1531b, 0x85735338, 0x30841e68, 0x3c1aea69, 0x14335bd1,
+    0x96b2c871, 0x81a2f67e, 0xe6444e55, 0xfcfee64f, 0x841b6509, 0xd889078e,
+    0xb48def7f, 0x96274bdf, 0xa66dbcde, 0xb63c59fa, 0x376de3f5, 0xb7e5c9d2,
+    0xbe691baf, 0xbd2d4f96, 0xf44ddb78, 0xeb6d79b2, 0xa56fdac6, 0x5e6fcb93,
+    0x2c7dd336, 0xf17a5b9e, 0x64e99bb6, 0x8dd7dbf2, 0x274bdfb4, 0x6dbcde96,
+    0x3c59faa6, 0x6de3f5b6, 0xe5c9d237, 0x691bafb7, 0x2d4f96be, 0x4ddb78bd,
+    0x6d79b2f4, 0x6fdac6eb, 0x6fcb93a5, 0x7dd3365e, 0x7a5b9e2c, 0xe99bb6f1,
+    0xd7dbf264, 0x4bdfb48d, 0xbcde9627, 0x59faa66d, 0xe3f5b63c, 0xc9d2376d,
+    0x1bafb7e5, 0x4f96be69, 0xfd7fbd2d, 0xc4ffbfba, 0x00107200, 0x02010202,
+    0x09060203, 0x090d080d, 0x02110503, 0x05040103, 0x12061100, 0x15211413,
+    0x36353122, 0x32230795, 0xd3949271, 0x1610d5d4, 0x51413433, 0x93917574,
+    0x20b4b396, 0xb5614224, 0x25e3e1d2, 0x52444030, 0x76737262, 0xe5e2d1a3,
+    0xa1838143, 0xd6b2b1a5, 0x635326e4, 0x55451708, 0xc1a48265, 0x545046c2,
+    0x60b6a264, 0xc3857766, 0xdafff0c5, 0x01010800, 0x023f0600, 0x9acc12d3,
+    0xa9618a45, 0xc5fdc883, 0x1e03298b, 0x51dc6de5, 0xafdddd31, 0x3fe0273a,
+    0x44e775e4, 0x8efc07fc, 0x809fe8bc, 0xd79100ff, 0x1ff0139d, 0xa2f33af2,
+    0x47fe037e, 0xc04f745e, 0xceebc87f, 0xf90ff889, 0x3fd1791d, 0x2300ff01,
+    0xe0273aaf, 0xe775e43f, 0xfc07fc44, 0x9fe8bc8e, 0x9100ff80, 0xf0139dd7,
+    0xf33af21f, 0xfe037ea2, 0x4f745e47, 0xebc87fc0, 0x0ff889ce, 0xd1791df9,
+    0x00ff013f, 0x273aaf23, 0x75e43fe0, 0x07fc44e7, 0xe8bc8efc, 0x00ff809f,
+    0x139dd791, 0x3af21ff0, 0x037ea2f3, 0x745e47fe, 0xc87fc04f, 0xf889ceeb,
+    0x791df90f, 0xff013fd1, 0x3aaf2300, 0xe43fe027, 0xfc44e775, 0xbc8efc07,
+    0xff809fe8, 0x9dd79100, 0xf21ff013, 0x7ea2f33a, 0x5e47fe03, 0x7fc04f74,
+    0x89ceebc8, 0x1df90ff8, 0x013fd179, 0xaf2300ff, 0x3fe0273a, 0x44e775e4,
+    0x8efc07fc, 0x809fe8bc, 0xd79100ff, 0x1ff0139d, 0xa2f33af2, 0x47fe037e,
+    0xc04f745e, 0xceebc87f, 0xf90ff889, 0x3fd1791d, 0x2300ff01, 0xe0273aaf,
+    0xe775e43f, 0xfc07fc44, 0x9fe8bc8e, 0x9100ff80, 0xf0139dd7, 0xf33af21f,
+    0xfe037ea2, 0x4f745e47, 0xebc87fc0, 0x0ff889ce, 0xd1791df9, 0x00ff013f,
+    0x273aaf23, 0x75e43fe0, 0x07fc44e7, 0xe8bc8efc, 0x00ff809f, 0x139dd791,
+    0x3af21ff0, 0x037ea2f3, 0x745e47fe, 0xc87fc04f, 0xf889ceeb, 0x791df90f,
+    0xff013fd1, 0x3aaf2300, 0xe43fe027, 0xfc44e775, 0xbc8efc07, 0xff809fe8,
+    0x9dd79100, 0xf21ff013, 0x7ea2f33a, 0x5e47fe03, 0x7fc04f74, 0x89ceebc8,
+    0x1df90ff8, 0x013fd179, 0xaf2300ff, 0x3fe0273a, 0x44e775e4, 0x8efc07fc,
+    0x809fe8bc, 0xd79100ff, 0x1ff0139d, 0xa2f33af2, 0x47fe037e, 0xc04f745e,
+    0xceebc87f, 0xf90ff889, 0x3fd1791d, 0x2300ff01, 0xe0273aaf, 0xba74e43f,
+    0x632af2d5, 0x5cab3cdd, 0x764aa20b, 0x44f56edf, 0xb37c2279, 0x3ea6501f,
+    0xbfa5e9f4, 0x8b65caba, 0x3a1fe4f2, 0xafcbebf2, 0xf2babc2e, 0x2eafcbeb,
+    0xebf2babc, 0xeb2cafcb, 0xbc2eafcb, 0xcbebf2ba, 0xbabc2eaf, 0xafcbebf2,
+    0xf2babc2e, 0xf23acbeb, 0xf2babcce, 0x2eafcbeb, 0xebf2babc, 0xbc2eafcb,
+    0xcbebf2ba, 0xbabc2eaf, 0xafcbebf2, 0xf2babc2e, 0x2eafcbeb, 0xebf2babc,
+    0xbc2eafcb, 0xcbebf2ba, 0xbabc2eaf, 0xafcbebf2, 0xf2babc2e, 0x2eafcbeb,
+    0xebf2babc, 0xbc2eafcb, 0xcbebf2ba, 0xbabc2eaf, 0xafcbebf2, 0xbf45b02e,
+    0xf62bceb9, 0x6768840c, 0xf47eb4f8, 0x1900ffe8, 0x7f6f3f65, 0x5f93a9d4,
+    0x09dff11f, 0x63705cc5, 0x660b07fb, 0xc4461f0b, 0x7b56ab85, 0xe311d363,
+    0xd0d52e5b, 0xa1d4fd26, 0x640dfc03, 0xd9278b3d, 0x3142d963, 0x596d3815,
+    0x14c7c8a0, 0x3d89f05c, 0x95d9a994, 0x6e76b617, 0x1e923597, 0xc0f2f3e4,
+    0x33efdbf8, 0x579695ec, 0xf11e17b2, 0x07708725, 0xe2688513, 0x46ade32c,
+    0x4d6cc532, 0x8ebf69cb, 0x5b65e420, 0x028662cb, 0x1158c8c2, 0xb40505de,
+    0xc53bdce9, 0x65b6ccd9, 0xb5c2671c, 0xdf869bb8, 0xc8ddc898, 0xf536ce48,
+    0x505756da, 0xa8d23def, 0x76458664, 0x561d7305, 0x3b525463, 0x47714c0c,
+    0xdc408912, 0x71628da7, 0x364f3b51, 0xb1d4fe62, 0xb1fb2c9e, 0xcbaeb755,
+    0x0da1ee43, 0x3386b2d7, 0x9c59738b, 0xae35ecbd, 0xccd3ad12, 0xa6e42f65,
+    0x25be5883, 0x6e4f4a9b, 0x91397b73, 0x1766412d, 0x0868ce03, 0x6c906e3e,
+    0xd1c12b1c, 0x26cee3d7, 0x20b47da5, 0xe0c17724, 0xcbcd21e9, 0x9f8925f1,
+    0xba5a0115, 0x670caa5e, 0x3513db71, 0xa499ce0b, 0x95214fb8, 0x7d2777bf,
+    0xddeb9ee5, 0xdb7ddac8, 0x26f1e96e, 0xd9ea4b5d, 0x3a736cb2, 0x7350006a,
+    0x042cf21c, 0x8d186107, 0x700c2771, 0xe05d12a7, 0x0a9e639f, 0xc6ec18b5,
+    0x19120f6f, 0x9d4beecc, 0xb67a658b, 0xc43581a1, 0x56d45ed9, 0x5a851895,
+    0xd5760bcb, 0x5415d669, 0x8cfde72d, 0x90bd923d, 0xabb1b97e, 0xe28cc13b,
+    0xf165d00c, 0xc988eef9, 0x35109b36, 0x582eaa2a, 0x3767375f, 0xe81ad2a6,
+    0xc3ab1204, 0x716a527b, 0xef611777, 0xb8fac5f0, 0xf47396db, 0x52eee32f,
+    0x8bc5796d, 0x53c4d54a, 0x35b3a0b2, 0xba3da12d, 0xb59f40ac, 0x662412b6,
+    0xd5b1d7b9, 0x393306ec, 0x17c73ec2, 0x4209f338, 0x66ef5196, 0x0fc6233b,
+    0x19eba89b, 0x78b6262d, 0xae996a10, 0xa958892b, 0x62538661, 0x961d5cc3,
+    0x89357f96, 0x65ce5bc5, 0xbbf7f831, 0x56a1881b, 0xef37cbc5, 0x80a6cace,
+    0xb06d51ad, 0x2c86cdc5, 0x449674ac, 0xede6c2ba, 0x71aa4eb0, 0x297b1c2f,
+    0x78e224fb, 0x325635b7, 0xe4c20d1e, 0xe18b0767, 0x4a3db2e2, 0x0a612cd4,
+    0xa8beb7bf, 0x4ce545c8, 0x95bad8d1, 0xdbd52006, 0x4ba1ec59, 0x6f862c8e,
+    0x6f45ec29, 0x94399b2a, 0x5873aa08, 0x0c3272fc, 0x0a2caf8e, 0x2e9e50fb,
+    0x82f7c3c0, 0xa48e5c7a, 0xbcc7944b, 0xd3f8907d, 0xb08d27d9, 0x8b6d9f07,
+    0xe0833b1c, 0x68e1a8dc, 0xb2a9b162, 0x529621d4, 0xcbed6228, 0x4c4a448d,
+    0x40b2cb82, 0xdb5af6b5, 0xdbb83552, 0x2f8eb7d8, 0x5cc431af, 0x29a3620b,
+    0x874261e7, 0x1559b066, 0x2d568a05, 0xd26e6728, 0xc9467d08, 0xee7473c4,
+    0x626cdc02, 0x8aabacba, 0x4778e4e1, 0xacb1f88e, 0x309e70c5, 0x128b2236,
+    0xf672da31, 0x8e02bea3, 0x0cda2525, 0xb0cdda8f, 0x1d2d61b0, 0x6fb7e9a1,
+    0x66c8953b, 0xf9c50332, 0x256fe5ba, 0xf4f7cd7a, 0xca1153d5, 0x30a67590,
+    0xc26600e1, 0x6361865a, 0x12237226, 0xe61ebf53, 0x59733732, 0x9cca637f,
+    0xace1957b, 0x6d174bed, 0xad84a7dd, 0x27e4c990, 0x6685621b, 0xe944a1b5,
+    0x709d36f6, 0xae2fc142, 0xaebd6387, 0xa50c825e, 0xd66036fa, 0x94fb0ddc,
+    0x7167d6ed, 0xea9ae301, 0x73b96bf6, 0xaa4162f7, 0x24f81768, 0x3f9de433,
+    0x29abb88b, 0x26c6c992, 0xbddd13e7, 0xf971217b, 0x1f53c50b, 0xbe90deca,
+    0xd8c258e3, 0x960b4106, 0xd1164172, 0x71a6f3b6, 0x977119c7, 0x0777f010,
+    0x38685fe4, 0x3ab8846b, 0xea9882df, 0xe275dc35, 0x2fc6ebdd, 0xa65aaa96,
+    0x7b457b2a, 0x65c0bc0c, 0xf10a9594, 0xc5130f58, 0x435cc71e, 0xc37d9cc6,
+    0x3eb57ec3, 0xdb6ce021, 0x8e37c45d, 0x5d90cfb3, 0xe0d58a8a, 0x554e26e0,
+    0xacaa963d, 0xb0d77c54, 0x9c5cb76c, 0x6988fd35, 0x439c33e2, 0xdcc421c3,
+    0x9917ca4e, 0x1177bd89, 0x1c5e2b7e, 0x05584038, 0x5aaf671a, 0x6c8a1c2c,
+    0xcf5d7481, 0x71321112, 0x6bf6d133, 0xc7065ef6, 0x469ccdd8, 0xf09f00c7,
+    0xaeccd548, 0xa0fbc4a0, 0x773407ea, 0x5c974773, 0xc73dec69, 0x6cae6f39,
+    0x4ed60a87, 0x52c41563, 0xc45b47be, 0xe98b319b, 0x39cff25b, 0x788e2fab,
+    0x4bce4d03, 0xc50eea26, 0xaedb5a91, 0x3de5cb28, 0x71937d95, 0x55f1c64c,
+    0xe22b4afc, 0x57e49eb8, 0x5e5aebec, 0x8e653133, 0xc8972828, 0xc803336c,
+    0xe3a2dd23, 0x48f611ae, 0xc3340ee2, 0xcf4f6561, 0x3418c7f0, 0x81719baf,
+    0x6d720f22, 0x012c1813, 0xa5d0dd82, 0x3f5cb552, 0x48d6297c, 0x9cc13508,
+    0x2ee3874d, 0x4ffae031, 0x112063a5, 0xc749f9c2, 0x8adfc13a, 0x294bb1a9,
+    0x983d1b21, 0x551f748b, 0xb4281e73, 0x2c6e10ad, 0xffb1d789, 0x6fedb100,
+    0x07658f65, 0x8bba7863, 0xfeba5d6d, 0xabdbb928, 0xb8203b10, 0x148cbc1a,
+    0x264ced72, 0xdc39aa7a, 0xb2c9bf8b, 0x91ec87b3, 0xd0c487ec, 0xe091f6aa,
+    0x95cd23ae, 0x4a3b5bec, 0x57665da5, 0x8d9af198, 0xc05fd2f9, 0xd6fe8938,
+    0xcd3c72c4, 0x35fd9c5c, 0x847344f3, 0xfff77b30, 0x5fa30400, 0x9ff9b561,
+    0x1bf6b5f7, 0x00ff995f, 0xb5615f7b, 0xb5f79ff9, 0x995f1bf6, 0x5f7b00ff,
+    0x9ff9b561, 0x1bf6b5f7, 0x00ff995f, 0xb5615f7b, 0xb5f79ff9, 0x995f1bf6,
+    0x5f7b00ff, 0x9ff9b561, 0x1bf6b5f7, 0x00ff995f, 0xb5615f7b, 0xb5f79ff9,
+    0x995f1bf6, 0x5f7b00ff, 0x9ff9b561, 0x1bf6b5f7, 0x00ff995f, 0xb5615f7b,
+    0xb4f79ff9, 0x142d5ac1, 0x101962aa, 0x1b33739f, 0xf78d4fc4, 0xcfadf6b5,
+    0xafbd7fcc, 0x637e6eb5, 0xab7dedfd, 0xef1ff373, 0x9f5bed6b, 0x7b00ff98,
+    0xfcdc6a5f, 0x23dafbc7, 0x0004d73a, 0x1d65ca64, 0xcc1b23d0, 0x23f78dcf,
+    0xe45a6342, 0xcc108c89, 0xa344ba23, 0xf7759f78, 0xdc6a5f63, 0xdafbc7fc,
+    0xe6e756fb, 0xdad7de3f, 0xfe313fb7, 0xb9d5bef6, 0xb5f78ff9, 0xcccfadf6,
+    0xa6a5bd7f, 0xde646155, 0xb9aa4e7e, 0x4c067946, 0x00fff7bb, 0xfc843506,
+    0x6fd8af76, 0xd1e83de8, 0xfca3d3fb, 0xbdfd9465, 0x375700ff, 0xfed581fe,
+    0xd96bc548, 0xe206fd03, 0x7700ffef, 0x06f63ab2, 0xa2a859f6, 0x72367027,
+    0x48b75ccd, 0x8763a963, 0xa96b7933, 0x782f89be, 0xbc24ba0e, 0xa7419e44,
+    0xf6698bee, 0xae39f62a, 0x758bb7d0, 0xf871feaf, 0x4b630386, 0x3f7818f0,
+    0x3ea3ad03, 0xdcccd529, 0x85bca0eb, 0xf731880b, 0xe500ff5a, 0xa279c547,
+    0xf1c46167, 0x01c31a36, 0x2efbce43, 0x4d2cde65, 0x278fa95a, 0xa6a6dd5a,
+    0xacc811b8, 0x98469d09, 0x8ee34c28, 0xcbf890fd, 0x9e45b88e, 0x82799cc8,
+    0xcf582dcc, 0xb3790cae, 0x8f65f086, 0x5e386278, 0xe3fca592, 0x5c51b660,
+    0xb7990581, 0xd5555aa1, 0x8667db4b, 0x6bbe6af8, 0xa622de18, 0x6bb1228e,
+    0x3ca8bb08, 0x88b364a5, 0x9f5b8cb2, 0xb5ae0f4a, 0x62ae5898, 0x2e121164,
+    0x350ef95c, 0xb45fb5c6, 0x22fbeb65, 0x3326fce5, 0xc58268f6, 0x6489d6e1,
+    0xda03136d, 0x19109011, 0xf91763df, 0x3353db37, 0x33df11dd, 0xfb88483e,
+    0xac183bba, 0x8d3d2b8e, 0x5db3526f, 0x294fb78f, 0x2bb79345, 0xb1eb34ab,
+    0x2ee529e8, 0xfb9d2157, 0xbf032b17, 0x11d1c25e, 0x7eb247b4, 0x3622221e,
+    0x48658888, 0x44f28888, 0x47447744, 0xdfa74674, 0xb8802f9d, 0x2ff1a40e,
+    0x7a647eb2, 0x76957114, 0xf5107072, 0x324ff8f3, 0xcd343d51, 0x0a6c4f74,
+    0xa68825cf, 0x4de2ed06, 0x45fca51d, 0xe77b99c2, 0x75c73d7f, 0x19c66572,
+    0xb7badc91, 0x50dfd4b2, 0x6f3caf82, 0xc9aec728, 0xe7c8d8c2, 0x5bac64b3,
+    0x2b3c5491, 0x5cc73e21, 0xc559ec47, 0x53e0575c, 0x388757b1, 0x37d08487,
+    0x31e8b731, 0xc8eafae6, 0xf8ec915a, 0x80b44cf1, 0xc1b0392d, 0xa94bd3af,
+    0x3b27d7c1, 0x7d8b73d9, 0x2bb56690, 0x3911f854, 0x8ea721fe, 0x32acb892,
+    0xdc0dac1e, 0x005d1c66, 0x0cd5aa3d, 0xcca75530, 0xf8b091b1, 0xbb670399,
+    0x59f6222e, 0xe135dee3, 0x9c4f3c1a, 0xc21777ad, 0x3f67399c, 0x87f0eb8d,
+    0x6835040b, 0xee27d2a9, 0xdd4b9e9c, 0x7c512e5b, 0x92b31c81, 0xecb23e6f,
+    0xb1e6e4f0, 0x38165c9f, 0xa36f88b7, 0xe151db0b, 0x78ec5237, 0xa56bedb2,
+    0xfc2ad7cf, 0x60f56ca9, 0xf7593639, 0xffb7b3f8, 0x1bde2900, 0xe22ca2cd,
+    0x62551cf3, 0x73f7a5a5, 0x3a5f4e44, 0x77a67a4b, 0xc255b1e4, 0xe59b35bb,
+    0x832d8555, 0x31ae31de, 0x7be306f6, 0x3871f75c, 0x02cedd5c, 0x034abac9,
+    0x172a8035, 0x19eb141f, 0x4192aefb, 0x7927aab6, 0x8eacf09a, 0x7af0783b,
+    0x0a2baed5, 0xb5d85290, 0xc6726997, 0x9b93d9f3, 0xf7ecbac5, 0x8329067f,
+    0xeff0bee4, 0x63afdd33, 0x2821a5a2, 0xf5e1cdfa, 0xf6dc4fcf, 0x9b50e3a4,
+    0xed6d3bf1, 0xa15d9083, 0xc1d6fd74, 0xcb919dce, 0xf1622964, 0x453bf9f5,
+    0x52a48dfc, 0x01ab8ea4, 0xb2da972b, 0xdaa0426b, 0x0ccb58c0, 0x7cc44c62,
+    0x9b61afb3, 0xb2d83fbc, 0x1d8c4f17, 0xd8ce0d63, 0x99ed3a6e, 0x73282b8c,
+    0x1d5c0ebd, 0xcca7b747, 0x650ed8c4, 0x7b349014, 0xe091528b, 0x44da62ef,
+    0xa1163171, 0xcf9402f9, 0xe20d71f8, 0xfb994a7b, 0x8f761d9b, 0x11d7b97f,
+    0xe61c9ff1, 0xf3b8e76b, 0x098f1c8c, 0x1533a859, 0x0149d128, 0x540a8a2e,
+    0x69c92d88, 0x552185e7, 0xeb949a90, 0xc9441e56, 0x00ff1c9f, 0xd93fd9a7,
+    0x4e8e6b29, 0x3826c4cc, 0xa6608847, 0x8ac59c7c, 0x00ff0bb4, 0x00ff415a,
+    0xad6bb83e, 0xb3761005, 0xeafe8d66, 0x62682d3c, 0xa85efc47, 0x9df83db6,
+    0x28fe097b, 0x735efbb1, 0xfc4b66fb, 0x2bb29faa, 0x14c3355c, 0x42848f38,
+    0x11471697, 0x3cdba858, 0x8cc57a15, 0x60257c4d, 0x21efbab6, 0x490ec4e2,
+    0x8a4216ae, 0x12188dc0, 0x7746a71e, 0x3c588be4, 0xce36a7b5, 0x79da9821,
+    0xa0608dec, 0xe42e34aa, 0xeca87061, 0x95617296, 0xb1981bb2, 0x94a30afe,
+    0x451c780c, 0x4e290fa7, 0x885b55b2, 0xc4d777e2, 0x137e2d71, 0x8da994bd,
+    0x191e63ab, 0xa5b380ab, 0x18395259, 0xf5b567b7, 0xead91542, 0x7a644632,
+    0xe462b8c2, 0x71c46e98, 0xe208f232, 0x9c5570d4, 0x376b8317, 0xbaed8c30,
+    0xa5aa72b3, 0xb332c828, 0x3047f452, 0xf2b6bdba, 0x1b82edef, 0x6527d916,
+    0x64c59613, 0x5caa39f1, 0xb2876f3d, 0xcb57e915, 0xa924538e, 0x735041b1,
+    0x67479c90, 0xc70a5ab3, 0x51a83c6f, 0xf6494652, 0x35bedd15, 0x9cb9fad8,
+    0x119fbc95, 0xe255e15b, 0xdbc6e8f1, 0x4ae59cba, 0xb5aab87d, 0x344eca8a,
+    0xa6fcdad4, 0x1632b59b, 0x37179c69, 0x4118445c, 0x70e7c68e, 0x1c8b45fc,
+    0x327eec95, 0x5cdd42be, 0xf92b5370, 0x52225718, 0xf7ed151e, 0x048e5d97,
+    0xa58dbd5c, 0xd35d1f77, 0xd8f656ca, 0xd78ceda6, 0xeab0e50d, 0xfe4f640f,
+    0x13f2316f, 0xbe58ec4e, 0x65eaec6e, 0x29811ba2, 0xaf4cb435, 0xae69d40a,
+    0xdbae9106, 0xcd28d4a5, 0x9e66ea8b, 0x62150fcc, 0xaad23e78, 0xfc584352,
+    0x7a1d65be, 0xe24a8c5d, 0x76e4d5fa, 0x8e4a6103, 0xa2303019, 0x8e47df89,
+    0x4e2723cc, 0xae942aed, 0x7032ebe6, 0xb20afcb0, 0xb870b507, 0x6fc3cc99,
+    0xeed9e459, 0xc30c81ad, 0x68839990, 0xb869fb8e, 0xbd5c351c, 0x78eb4dd2,
+    0x8a1464e6, 0xa44f5525, 0x8a656e02, 0xe52c9181, 0x20ce334a, 0x42bc95ac,
+    0x20e63428, 0xfbdf6d6c, 0xf5f9a79c, 0x9c35a67e, 0x839ad4cb, 0xb38d1f6b,
+    0x31deb466, 0x0fb84e5d, 0x98a4f5b5, 0x9fe698a1, 0xead07215, 0xa3b92a9f,
+    0x5d717d9f, 0xb3e6442c, 0x7e780a19, 0x8b89bb1b, 0xfe782ad8, 0x9b990b25,
+    0xaff94e91, 0x1774da0a, 0x7b4d1167, 0x34eb55dc, 0x16983abb, 0x62ab1dab,
+    0xe3cc9189, 0xd8ca8f71, 0xe3716ce2, 0x139f6219, 0xad2d012b, 0xda2cbf8e,
+    0xcbc037ee, 0x4b2f63c7, 0x5d119b56, 0xf680ee56, 0xc4de1a84, 0x87b34044,
+    0x8ca169f8, 0x6a19c4a5, 0xcca5ac79, 0x159bd791, 0x16f161a9, 0x0e06d72a,
+    0x2c3a3735, 0x852cddcc, 0x90c32a21, 0xefa7366e, 0x40ecc396, 0x396d0729,
+    0xf46de3b6, 0x21873d9c, 0x76a84c41, 0x7e4198ea, 0xbc99c6fe, 0x7943da29,
+    0x4d7bbd95, 0x3cf2a545, 0xa673b942, 0x6309fe2e, 0x7faa45f5, 0x50fdd782,
+    0x93978deb, 0x18c13b56, 0x125f091e, 0x25f57162, 0x76cd6087, 0x64368bf2,
+    0x3dd71a2f, 0x714d814b, 0xa3afabd9, 0x3d467e4d, 0x1fae47d2, 0x111f6c6b,
+    0x10eee2db, 0xe3ebe5cd, 0x2caae3ea, 0xf8b167e8, 0xd6eae665, 0xc5b22ac3,
+    0x6fbda8b6, 0xfb9a3dec, 0xa926d8ae, 0x41d42256, 0x55f05ab1, 0x8d4fe6c7,
+    0x9601c31f, 0x54e28da9, 0x5d7cfd70, 0x27b32ba7, 0x60996621, 0x15d7a42a,
+    0x3205d82e, 0xc582db8d, 0x1127d08b, 0x2a5e6f04, 0xf051f49d, 0x087110cf,
+    0x6c163161, 0x2b5a6b21, 0x0b190bcd, 0x0ca50c39, 0x25d24276, 0xd04a9595,
+    0x234fa9d5, 0xdd9ab2b5, 0xd3dd5776, 0xb5975116, 0xe851c98c, 0x1572b4a9,
+    0xff32166b, 0x469a5b00, 0xd8984bc5, 0xa1c4aa6d, 0xbf57578e, 0x77e6ca5e,
+    0xccabee2a, 0xffc6f222, 0xf66f9700, 0xf113d653, 0xbf62bfda, 0x47a3f7a0,
+    0xf18f4eef, 0xf7f65396, 0x19b75cfd, 0x70cc2216, 0xbe3ef8c3, 0xd39d593d,
+    0xe3e04ed9, 0x4424ca71, 0xf0dc7a75, 0xc53e30d5, 0xfb3de1b6, 0x98c6336d,
+    0x372b28ea, 0xc4231cb2, 0x5f5669b4, 0xcbc5522f, 0xebd55b98, 0x47e43920,
+    0x2c60cf9d, 0x98478879, 0xef8879a3, 0xf88ebdd2, 0x32e38996, 0x7a593077,
+    0x21d75e47, 0xdf811c1d, 0x68156fb7, 0x3d6346fa, 0xb953dc9e, 0x238c9fb0,
+    0x316f3bc9, 0x7b16f7ac, 0x2c7dd222, 0x3c70e3f4, 0x6aad841b, 0x0f474e54,
+    0x652429e0, 0xd76bd2d1, 0x92c668c9, 0x658644c6, 0x8f1ceeb4, 0xec75c62b,
+    0xe136beec, 0xe21d7e9e, 0x5dc326ee, 0x08262fc6, 0x6ac53c75, 0xcf8e3857,
+    0x320d1658, 0x491f43e5, 0x3101d9de, 0xbcd15e2c, 0x316a4614, 0x3dfcc7be,
+    0x64c419e1, 0xa0d11fa3, 0x9a6e77b1, 0x229d8a4e, 0x76868892, 0x664e9f8e,
+    0xdeb62062, 0x99b98375, 0x6ef87ae1, 0x2b662538, 0x4a35ad65, 0x66d6a1f0,
+    0xaa6aeb72, 0x126c94c3, 0xa434a402, 0x62b99b23, 0x36a69db8, 0x3d8f73d6,
+    0xb835b18b, 0xbc3887af, 0xf013cfa2, 0x3a862d4b, 0x3107efda, 0x86759c95,
+    0xd8cc84cc, 0xda559b6d, 0x16116b0b, 0x2f2ad1ac, 0x7fda455f, 0xb197f00c,
+    0x1d824f56, 0x7ba50394, 0x2297f889, 0xb3360ea5, 0x50c18244, 0x7a56af09,
+    0x2eac1bc6, 0x50b12dae, 0x8bea3573, 0x8c5376ba, 0x8b4c4ae1, 0x6fa95f27,
+    0x0ba77b25, 0xdf56869c, 0x23b55c29, 0x7224bf11, 0x3e58adae, 0xd51a0566,
+    0xb9646454, 0x3c2cf629, 0x4cc62e0e, 0x18c89e70, 0x5156aedc, 0x8fc58e2a,
+    0x2dcb2b4b, 0xf8c5a837, 0xe35e0283, 0x9abcbb98, 0x8ce0d9ce, 0x52fc725b,
+    0x7ad80a69, 0xa76ee9c9, 0xef2070db, 0x658138cc, 0xdbe6ea18, 0x5adcb280,
+    0x3d4629e5, 0x12ad3d33, 0x3ef900ff, 0x4fbcf3e6, 0x71ac6b96, 0xe25e1607,
+    0xcb9121fa, 0xc897cf35, 0x457b58ec, 0xc11cac56, 0xdeb271cd, 0x586ce2ab,
+    0x23315b6b, 0x1cc5ad9e, 0x37f69005, 0x3102eb62, 0x8c388fd6, 0xb59dacb3,
+    0xbc3e06d9, 0xce2e85a6, 0x602a12ca, 0xc939f5cc, 0x272fb791, 0x8a53b87b,
+    0x8fb88e7d, 0x412d03d9, 0xc50b43f7, 0x9f957bb8, 0xcf5d3947, 0xc5f05537,
+    0x1fb79486, 0x7a4aead1, 0x66a71ecd, 0x41aba804, 0xe3d86ca6, 0x4ff6217e,
+    0x12870c45, 0xea5a26fb, 0x3d037167, 0x401c85a6, 0x1cb60675, 0xd896988f,
+    0xad846411, 0xbaa2d446, 0xc91ca0aa, 0xe9589d03, 0xd7f01f7b, 0x96dea057,
+    0xa9dff0d8, 0xbb4d2ed3, 0x6ddbbcfc, 0x4f6e7afc, 0x3849b889, 0x7f56328e,
+    0xda2e1534, 0x18262752, 0x2d28355b, 0xada5b720, 0xdfcfac88, 0xbfcd0161,
+    0x98b63bd9, 0xcb6df699, 0x683631e6, 0x8a8f7863, 0x6d077bd9, 0x465699d2,
+    0x2df3e4a4, 0xd3a62387, 0xd253593e, 0x3b21d87e, 0xe6b77b30, 0x875f4e88,
+    0x3cc79179, 0x0273272d, 0xd7211cf4, 0xb1f63d93, 0x8020f912, 0xa2d76d27,
+    0xdc8528c2, 0x6989285c, 0xf00cf6b6, 0x9de11a7f, 0xf1aeb745, 0xcb18720a,
+    0xd0a1be52, 0xcaafc8c9, 0x598f68a3, 0xbe937c52, 0x6afb3de3, 0xe1540bdf,
+    0x7028fb16, 0x67b15b08, 0x71116f01, 0xa558f374, 0x883d61da, 0xa60d1665,
+    0x4ca6b190, 0x2451506d, 0x098b952c, 0x91eecabd, 0x2973f863, 0x8c3d76c2,
+    0xed828e3d, 0xc9e3996b, 0xb9f35b5d, 0xa0deae91, 0x94c22b24, 0x8390d261,
+    0x469555af, 0xdce95bb8, 0x45c76ab1, 0xbdb0572a, 0xbac1125e, 0x788433de,
+    0x5ddbb1a6, 0x132b803e, 0x54e0a987, 0x311692d7, 0xea55255b, 0x0bae8818,
+    0x0fc44c61, 0xccd089b9, 0xfb1fc2fd, 0x9558c4f5, 0xf8e50a7b, 0x245e598d,
+    0xcf5d99bd, 0xae381aae, 0x02a97040, 0xc86187ae, 0x86a8f8f3, 0xeea13a75,
+    0xdb7d7af9, 0xfeb570c8, 0x5beca114, 0xb18e97c1, 0xccd86c67, 0x6de6cd56,
+    0x4e0316d4, 0xa6ace6ba, 0x2e187779, 0xcba8d8c7, 0xad76210e, 0x38d779ca,
+    0x22c41fae, 0xf430632b, 0x27e9e36b, 0xe19a30cb, 0xeec20401, 0xcca539ea,
+    0x199f0deb, 0x5e1a63cf, 0x8abdce31, 0x881fa378, 0x83016bb3, 0x6c3939c6,
+    0x9e3de5a2, 0x5cce0a8b, 0xd1041be0, 0x4caffc6e, 0xb23f8bf8, 0xfdedf10f,
+    0x42ce21af, 0xb95d951b, 0xaa7d07a6, 0x97bfc9ab, 0xb2242e58, 0x874f78c6,
+    0x37569415, 0xb4026ca7, 0x5e016106, 0x2c4768e7, 0x11a6a7f5, 0xe9709ed1,
+    0x6ae3f396, 0x2dbe11cf, 0xd57dbfd7, 0x4bd5642c, 0xc953a420, 0x86d08ebe,
+    0xb621595b, 0x1606b900, 0x8c6ec1ee, 0xd8725c59, 0x92ef7786, 0x8cd81d16,
+    0xf8e317af, 0x242fd4e2, 0xe2cefeb0, 0xa35331e1, 0xa1d213ed, 0xf57c5d11,
+    0xbb2d693c, 0x22db1d9c, 0x53f91ede, 0x0fd9436e, 0x4afcc615, 0x875ce5d6,
+    0xeaa26117, 0xd446e027, 0x889d564f, 0x32922859, 0x99715ece, 0x9af87227,
+    0x39bf54c8, 0xa6ac951c, 0xde7ea662, 0xed972177, 0x50cbf339, 0xa88da25c,
+    0xf1ec49ba, 0xd7cc2bd9, 0x34c56e55, 0xea2033e5, 0x02ebf2ed, 0xbbf132c4,
+    0x78767387, 0xe4879582, 0x4a764d52, 0x615136d5, 0xa4ac805d, 0x64d6b8b2,
+    0x4dd66a82, 0x9168ab34, 0x7bcd758f, 0x6899693b, 0x52cc90bd, 0x97153ecf,
+    0xb872444f, 0xb0d759f3, 0xd937b59e, 0x095c7b50, 0x5345edd5, 0x85166692,
+    0x5a0621cf, 0x29ceddbc, 0x0e255e39, 0xced7e930, 0xc415a30a, 0x39d3fea2,
+    0x62f62c6c, 0xc91a563a, 0x5b69d1f6, 0x2a8a0749, 0x706ba30d, 0x279b59cb,
+    0xfc708a7b, 0xacc56e65, 0x63b368df, 0x5a1e833d, 0x8998636f, 0xabfb4929,
+    0x0bcbfd35, 0x118044ec, 0x5d117f01, 0x77f255ed, 0x13395517, 0x654d5fc7,
+    0xed4b97e4, 0xad0cb768, 0x1f4b8061, 0x75d0ea6a, 0x46bc9a17, 0xa3b6bb34,
+    0x953c4dc5, 0xf7329eac, 0x6fc17184, 0x4aadd72f, 0x4a00d1d6, 0x8d644c29,
+    0x4d88812a, 0x143b593b, 0x57003b94, 0x7d000885, 0x1f9c5f95, 0xaaecebf6,
+    0x00ffe0fc, 0x57655fb7, 0xbafd07e7, 0x38bf2afb, 0x4ad6ed3f, 0x3718ab4d,
+    0xc448422a, 0x1da5a360, 0x343e33e3, 0x8bb5da7b, 0x4e5d9ac8, 0x063840e0,
+    0x52fc28cc, 0x6a8a2d86, 0x4b4e0dce, 0x84961a04, 0x25822dc1, 0x6d5b4d1e,
+    0x2157bedc, 0x946add7a, 0x306729fc, 0x576ae4b5, 0xd42f6ea1, 0xa6c72d0a,
+    0xeef46b8a, 0xec33598c, 0xe29976e6, 0xf6092bdc, 0x39ba5fad, 0x64c85f07,
+    0xc86dbfe6, 0x7dd7eee4, 0x98a02eb7, 0x051daf54, 0xd58aaa55, 0x26e98da1,
+    0x3b0f65bd, 0xb473d658, 0xa68de6c8, 0x0c793adc, 0xf9f1b861, 0x56d5753c,
+    0x84b453bf, 0xcc84ca2e, 0xb256975c, 0xa5a21d30, 0xd2aa58b4, 0xea49985a,
+    0x1e1746a5, 0xee6a65ab, 0x436e8b49, 0x5fe27e23, 0x7da1e176, 0x62494324,
+    0xd7552d84, 0x6abd22b8, 0x24aaebf5, 0x66ce55a4, 0xe9457045, 0x81af9a22,
+    0x944c6811, 0x88688bca, 0x7e66de89, 0x13a46ae4, 0x911505d3, 0x89d01213,
+    0xf18e8589, 0x4cbc3331, 0xfcd5d87d, 0x59b758bb, 0x8055e1c9, 0x59d9a6b8,
+    0x4f316ed3, 0xd91562b3, 0x32c300ff, 0xf369e1b6, 0x03e63acf, 0x42df3696,
+    0x7dbb5cb7, 0xc159c428, 0x317b9563, 0x557c18cf, 0x5c7d11b8, 0x6bc56b53,
+    0xd45a2248, 0x16ebb898, 0x96420b72, 0xc415db95, 0xb25078c1, 0x18b97297,
+    0x5db418a1, 0xda6b64cc, 0x51774c75, 0xba953a6e, 0x17a0a808, 0xa76d4ab5,
+    0xd16ed91a, 0xc36253a5, 0xba10613a, 0xd9115ff7, 0x3bf526ed, 0x7b456e35,
+    0xe6566f94, 0x60a75ce8, 0x203c7527, 0xb6863ccc, 0x96438c29, 0x278bb1c4,
+    0xec204be5, 0x50c55696, 0x9d2c79a2, 0x34b4aeca, 0xd2b8ce16, 0x3a45d640,
+    0xfd75ab95, 0xab8a80bd, 0x8f05ba27, 0x2e079036, 0x67c0a63b, 0xe4925a29,
+    0xeb5d3e31, 0xccf2db1e, 0x27acdfed, 0xc57eb5e3, 0x46ef417f, 0x1f9dde8f,
+    0xeda72ce3, 0x1ca1faef, 0x41a99c45, 0xe8a20eec, 0x40d652c7, 0xb3f23bd7,
+    0xbc1655b1, 0x02335214, 0x45d28ae6, 0xe2cd3012, 0xcc5bb475, 0x88c1f89f,
+    0x00ff5f3e, 0x77cfc06a, 0x33b6afbd, 0x00ffa87e, 0x8ced6bd5, 0xf53faadf,
+    0x3763fb5a, 0x56fd8fea, 0xfacdd8be, 0x5500ffa3, 0x7e33b6af, 0xd500ffa8,
+    0xdf8ced6b, 0x5af53faa, 0xea3763fb, 0xbe56fd8f, 0xa3facdd8, 0xaf5500ff,
+    0xa87e33b6, 0x6bd500ff, 0xaadf8ced, 0xfb5af53f, 0x8fea3763, 0xd8be56fd,
+    0xffa3facd, 0xb6af5500, 0xffa87e33, 0xed6bd500, 0x3faadf8c, 0x63fb5af5,
+    0xfd8fea37, 0xcdd8be56, 0x00ffa3fa, 0x33b6af55, 0x00ffa87e, 0x9ced6bd5,
+    0xe727aadf, 0x772c5d3a, 0x5a57a110, 0x93ab895c, 0xf3a6b153, 0xa5158199,
+    0x316b4496, 0x5a8829ac, 0x4fe6f245, 0xb475ae70, 0xfade4ff7, 0x00426692,
+    0x4c11b931, 0x96478c08, 0x22ba6766, 0x62eafc3e, 0xbbdb6d1c, 0x1f73d4da,
+    0x447249f3, 0x4f3bf1fb, 0xf7d799dc, 0xe5a3e6cf, 0xf9f3fd35, 0x7f4df9a8,
+    0x3e6afe7c, 0x3fdf5f53, 0xd7948f9a, 0xa3e6cff7, 0xf3fd35e5, 0x4df9a8f9,
+    0x6afe7c7f, 0xdf5f533e, 0x948f9a3f, 0xe6cff7d7, 0xfd35e5a3, 0xf9a8f9f3,
+    0xfe7c7f4d, 0x5f533e6a, 0x8f9a3fdf, 0xcff7d794, 0x35e5a3e6, 0xa8f9f3fd,
+    0x7c7f4df9, 0x533e6afe, 0x9a3fdf5f, 0xe4d6948f, 0xf2fd94a6, 0xcb9fb9ae,
+    0x9fb0af27, 0xedfc55c5, 0x2afe847d, 0xec6be7af, 0x7f55f127, 0x3f615f3b,
+    0xdaf9ab8a, 0x55fc09fb, 0xd8d7ce5f, 0xfeaae24f, 0x7fc2be76, 0xb5f35715,
+    0xaaf813f6, 0xb0af9dbf, 0xfc55c59f, 0xfe847ded, 0x6be7af2a, 0x55f127ec,
+    0x615f3b7f, 0xf9ab8a3f, 0xfc09fbda, 0xd7ce5f55, 0xaae24fd8, 0xc2be76fe,
+    0xf357157f, 0xf813f6b5, 0xaf9dbfaa, 0x55c59fb0, 0x847dedfc, 0xe7af2afe,
+    0xf127ec6b, 0x5f3b7f55, 0xab8a3f61, 0x09fbdaf9, 0xce5f55fc, 0xe24fd8d7,
+    0xbe76feaa, 0x57157fc2, 0x13f6b5f3, 0x9dbfaaf8, 0xc59fb0af, 0x7dedfc55,
+    0xaf2afe84, 0x27ec6be7, 0x00ff55f1, 0x92345d3b, 0x6c719f3a, 0xfca72c4c,
+    0x3988709e, 0x9f9920fe, 0xb0e2d6e2, 0x03e2fb19, 0x3562f913, 0xaf76fc84,
+    0x3de8afd8, 0xd3fbd1e8, 0x9465fca3, 0x00ffb9fd, 0x81388853, 0x8cb30c20,
+    0x05b531c7, 0xdaaecc91, 0xc9b40ae3, 0x0535fca3, 0x1bd8a897, 0x0f09388f,
+    0x16cd6f30, 0x2e0b1972, 0x49db76b9, 0xe5bc6cf6, 0xca4f738d, 0x22f95346,
+    0x0231823c, 0x1a110331, 0xedfd8dee, 0xbdcf4477, 0x98f1aedf, 0x5d63e2f7,
+    0x91be31f1, 0xdb579552, 0x75e164b5, 0xb951d7eb, 0x00ff64cf, 0x92084b01,
+    0x8921fe32, 0x2e43fafb, 0xb557b1ae, 0x31f71ad4, 0x636e1cf9, 0x6e27d61e,
+    0xe2c871b5, 0xdaa3de2d, 0x7db30691, 0x52dad14e, 0x50ac21b7, 0xff48c2ae,
+    0xb63eb700, 0x67b7cc55, 0xe9717c01, 0x7393e2b6, 0xfa10b968, 0x720b73cb,
+    0x6a985761, 0xba64ca84, 0x719f213d, 0x32e4eabc, 0xe2c464c7, 0xfbdb6686,
+    0xb9a024ca, 0xf5b8c73e, 0x4a47c79c, 0x76daf7b2, 0x9def8992, 0x6509a772,
+    0xdbd01de1, 0x4f835e19, 0x6a5a62fc, 0xf73363b1, 0xe8b57b86, 0xbfed7af1,
+    0xc5a3d731, 0xc7fcb6eb, 0xae178f5e, 0x7a1df3db, 0x6fbb5e3c, 0xf1e875cc,
+    0x31bfed7a, 0xebc5a3d7, 0x5ec7fcb6, 0xdbae178f, 0x3c7a1df3, 0xcc6fbb5e,
+    0x7af1e875, 0xd731bfed, 0xb6ebc5a3, 0x8f5ec7fc, 0xf3dbae17, 0x5e3c7a1d,
+    0x75cc6fbb, 0xed7af1e8, 0xa3d731bf, 0xfcb6ebc5, 0x178f5ec7, 0x1df3dbae,
+    0xbb5e3c7a, 0xe875cc6f, 0xbfed7af1, 0xc5a3d731, 0xc7fcb6eb, 0xae178f5e,
+    0x7a1df3db, 0x6fbb5e3c, 0xc5f374cc, 0xac5aabc3, 0xd6f17bb2, 0xaee62e18,
+    0x9bba731b, 0xd25906e2, 0x83a926ee, 0x4132cb07, 0xeb04b433, 0xb2535db3,
+    0xed881839, 0x6b609315, 0x3024a756, 0x013e9650, 0x1f21dba6, 0x4d8f8565,
+    0xe7b92445, 0x8f5edf21, 0xf3dbae17, 0x5e3c7a1d, 0x75cc6fbb, 0xed7af1e8,
+    0xa3d731bf, 0xfcb6ebc5, 0x178f5ec7, 0x1df3dbae, 0xbb5e3c7a, 0xe875cc6f,
+    0xbfed7af1, 0xc5a3d731, 0xc7fcb6eb, 0xae178f5e, 0x7a1df3db, 0x6fbb5e3c,
+    0xf1e875cc, 0x31bfed7a, 0xebc5a3d7, 0x5ec7fcb6, 0xdbae178f, 0x3c7a1df3,
+    0xcc6fbb5e, 0x7af1e875, 0xd731bfed, 0xb6ebc5a3, 0x8f5ec7fc, 0xf3dbae17,
+    0x5e3c7a1d, 0x75cc6fbb, 0xed7af1e8, 0xa3d731bf, 0xfcb6ebc5, 0x013e5ec7,
+    0x43763f82, 0xef516432, 0x99185309, 0xc94be7f7, 0xa26d1c63, 0x1d26f4c6,
+    0x59aa36ca, 0x58e8e711, 0x6466f180, 0x7e35753c, 0xc3fd8e29, 0xc52579b7,
+    0xb1dcfa26, 0x31e35326, 0xcf24bf45, 0xa41d92dd, 0xe2b37c0a, 0x4e914c49,
+    0xd58e9fb0, 0x07fd15fb, 0x7a3f1abd, 0xb28c7f74, 0xea3fb79f, 0x54e07f71,
+    0xdff195bf, 0x57c73153, 0xb7aa2416, 0x54395c70, 0xef303158, 0x390b5f0b,
+    0x00ff9ece, 0x8d064ec3, 0xb9149fa0, 0x6d8b6a7b, 0xff70247b, 0xbe310b00,
+    0xca82a918, 0xd6da0427, 0x05a65d53, 0x9b3ac693, 0x52ed6957, 0x41894e42,
+    0x89d118f5, 0x98f77bde, 0xf65215d7, 0x138bc857, 0x785e157f, 0xcb931b6f,
+    0x6679b262, 0x4f90d7e6, 0x4d8abd67, 0x56ec362b, 0x6c3155af, 0x538a3632,
+    0xcdce925c, 0x8818c632, 0x3700abf0, 0x7894c2b9, 0x23668b5e, 0x13772cc6,
+    0x744bddf0, 0xc697a7f9, 0x9731e4e9, 0x8b973b56, 0xe378f2d5, 0x1ecee01a,
+    0xc5724593, 0x40c33537, 0x5daf0ecb, 0x6e459133, 0xac9cbd1b, 0x55600feb,
+    0xcc98844f, 0xf6a823ce, 0xb1f6b126, 0x664dc345, 0x27de60d8, 0xf770ee62,
+    0xd91dcb84, 0x2a749930, 0x4685699e, 0x29cf6cf6, 0x63aa926a, 0x6b856af9,
+    0xe946a34a, 0x5103aa63, 0xde418e31, 0x6723337e, 0x7e147ffb, 0x0bfba139,
+    0x7e4fa37e, 0x200df1f7, 0x8700ff6c, 0xe820831d, 0xa400ff82, 0xfb7f3f08,
+    0xdf1af140, 0x9bf2b76f, 0xf6c40489, 0x8dae825e, 0x57849056, 0xc5226e87,
+    0x39e67bcf, 0xda4eefa7, 0x57aad8c2, 0x0eb264ec, 0x4f355b45, 0x4d8bc1a6,
+    0xd6242fa6, 0xf9036b4a, 0x000ba5fa, 0x077f6923, 0x53fd2e69, 0xe4186ba1,
+    0x2d4fc8da, 0x90572620, 0x06745fb0, 0x0babbcc0, 0x374bca07, 0x91488409,
+    0xca84090c, 0xff96b03f, 0x94b07c00, 0xf8bc8a9d, 0xd43307e1, 0xc3d9f3d9,
+    0x58172960, 0xb49125e9, 0x390ccaac, 0x365e8799, 0xbf9564c1, 0x1289af56,
+    0xe78988b1, 0x71c5c936, 0x2b8fc454, 0xe623bda5, 0x31290318, 0x8df3c0df,
+    0x44ba6474, 0x8146aaf8, 0x94c44893, 0x42276db1, 0xded31d1a, 0x24e49ea6,
+    0x8e8cb911, 0x3c8efc94, 0x1ace2deb, 0x67b59eeb, 0xa8c35c4f, 0xf6ae202a,
+    0xf1206cb1, 0x3f215aa0, 0xa6ddcb73, 0xcfaebe52, 0x54bd3c69, 0x0ec914cb,
+    0xc91d8361, 0xc9fd622c, 0xed14f744, 0xbba79de4, 0xdf9078f7, 0x14e0cab8,
+    0x8e33847f, 0xdfcfb8b7, 0x7ba2638d, 0x89546fe2, 0x92f5c2f8, 0x72ca9d92,
+    0x9f993717, 0x675800ff, 0xce9bb5d5, 0x11a4ca59, 0x18030a92, 0xf53babd9,
+    0x20192d10, 0xfbce767d, 0x71306ff3, 0xfde26d1b, 0xc39b61dd, 0xa992b9ec,
+    0x8232499e, 0xd0eda89c, 0x548b72c5, 0x0fac50c8, 0x782e9969, 0x0b06c45a,
+    0xac43989b, 0x31f63175, 0xdcbb556d, 0xea6491fd, 0xc4ca37bd, 0xc52cc088,
+    0x11d4ab89, 0x3a519919, 0x8b2fb719, 0x5c3187e3, 0x86d9c5ec, 0xbc8963ec,
+    0x915db4c1, 0x73fb8a93, 0xc472f3f3, 0x4f2f37cf, 0xddef73ee, 0x895395ab,
+    0x858f1f73, 0x5507c0f6, 0x70b54c98, 0xb45387e5, 0x5cd29874, 0x6c14f4c1,
+    0x30c74474, 0x6ddace44, 0xbad678ba, 0xb9e458ba, 0xe9e95a9d, 0xaefaba36,
+    0xa6de8306, 0x1b13562e, 0xcf440cf3, 0xe2273388, 0xba6cd2ea, 0x269daec8,
+    0x8551945c, 0xa47ceb4d, 0xd7add321, 0x463051dd, 0x7c425232, 0x06e22ade,
+    0xa901d459, 0x9b6aee55, 0x5db8bd52, 0x57b901b8, 0xdefb13af, 0x21942fdc,
+    0xf834b7c3, 0x8e38ee8b, 0x7e72ee4e, 0xc57a3d77, 0x45ed5a3c, 0x01902e14,
+    0x576ab9dc, 0xb25490d4, 0x0e85b018, 0x2ecb5cc6, 0x658e8361, 0x12ce44cc,
+    0xadab3cb5, 0xad953362, 0xd78954d9, 0x65b7525e, 0xf1568e43, 0x997d1895,
+    0xaa491d52, 0x502e3203, 0x93fa32c7, 0x6bbcb861, 0x90b1a2ed, 0xb192601b,
+    0x90e78de6, 0x3954ec25, 0x09e41d91, 0x77dc38e7, 0xdd0de718, 0xb18f1f53,
+    0xfb6dc562, 0xf654fc4a, 0x90911279, 0xad34d879, 0x1812e62c, 0x52580c53,
+    0xc8330207, 0x8447715b, 0x47ae7655, 0xaab95e03, 0x3b47f2a0, 0x561e6d9c,
+    0xe5b2a98c, 0x0a12089c, 0x255a04b3, 0x0c30b606, 0xcae15927, 0xe9769ee1,
+    0x6d65add1, 0xd89e425e, 0x673771a1, 0x73af4adb, 0xe2031d32, 0x47e65626,
+    0x60a8342f, 0x67f649a2, 0x59a16311, 0x13cc6121, 0x350971ae, 0x01c284f5,
+    0xaff64ee4, 0xc330c51c, 0x42907d5c, 0xb8315774, 0x0cacdac7, 0x92404be9,
+    0xdeee2c11, 0x9bd55a00, 0x9ca37979, 0xfc212696, 0x67a71d39, 0x85beb8d2,
+    0x7ad3c7aa, 0x0fe4c0a4, 0x94b99d68, 0x98eeb966, 0xfe2812ef, 0xe3c4ab3f,
+    0x8333f0be, 0x52bc8f38, 0x1fcda3fb, 0xa77b647a, 0xf89fc6ef, 0x5b5f3f13,
+    0x4ac74f58, 0x83f68afd, 0xbd1f8dde, 0x59c63f3a, 0xf59fdb4f, 0x2af0bf38,
+    0xeff8ca5f, 0x3fbcc2a9, 0x3928b6c2, 0x3c7364db, 0x3870574c, 0x5e7888fc,
+    0xab15e1eb, 0xd6f1660c, 0x1d4ba907, 0xa64f6059, 0xc017333d, 0x42cad975,
+    0xc94d7317, 0xffb97320, 0xc2696300, 0x852e6966, 0x1ed7c7b4, 0x5d8f273f,
+    0x308d1e79, 0x177f01a2, 0x675f6c59, 0xb25fab28, 0x8d281910, 0x846bd64a,
+    0xd5e88e38, 0xced99c0a, 0xd9e4bc10, 0x11b3d8b1, 0x5f713720, 0xca6591bd,
+    0xdfaf9aa5, 0x5557003b, 0xcf9605d5, 0xbc20738e, 0x0ea7eecd, 0x35b882bf,
+    0xdd29ca16, 0x8577f667, 0x74791b23, 0xa89f3da5, 0xb3d4475d, 0xce42378d,
+    0x27d3aeac, 0x7d2e49aa, 0xd4b2eb61, 0xd9f53933, 0x9dac59c5, 0xe9885568,
+    0x0dd8312f, 0xe11aeb4c, 0xdf620c07, 0xb0710b10, 0x47b07d20, 0x7ffbdf71,
+    0xa1397e14, 0x1a750bfb, 0x4ffcfb12, 0x9cec3f4a, 0xf800ffb4, 0x97d7e535,
+    0x75795d5e, 0x5e97d7e5, 0x2e56705d, 0x39278cc9, 0xed318b4b, 0xedcb33f7,
+    0x662e6df5, 0xf5bc7c26, 0xe7f897a3, 0xe79d3c58, 0x8fc774a9, 0xc67ab5b3,
+    0x26482a42, 0x9c358abd, 0x625ae465, 0x5b980840, 0x94f30c08, 0xb8cec4c0,
+    0x54691563, 0x537ceb10, 0x38aceb37, 0xe76afe82, 0x0a6ca547, 0xc1da76e1,
+    0x9b3fabd9, 0xe90f1596, 0x40812483, 0xe391ac5c, 0xb3113ecb, 0x151a570e,
+    0x64d99864, 0x95f5ab1a, 0x3f4f241d, 0xc4b0d532, 0x7b60ae72, 0xe2778ebf,
+    0x8a1c1dfc, 0xb8b26728, 0x35661ebe, 0xedd77ced, 0x9db45e11, 0x7c60c1ba,
+    0xc1096160, 0x8c991b6c, 0x99ca6d99, 0x254ce198, 0x9ebde8cb, 0xa7b3e1c4,
+    0x43b7b493, 0x09653de1, 0x05cba8d4, 0x808bb1e3, 0x07b1d992, 0x6c5bc803,
+    0x8621dfd8, 0xf426d9cb, 0x99f8632e, 0xd264b02d, 0x6331c729, 0x5c666671,
+    0xafa106d3, 0x04c477b4, 0xd6987837, 0xf6332347, 0x3fbcc7e5, 0xe8c94489,
+    0x7200ff8f, 0x00ff48ae, 0x795d5e9b, 0x97d7e575, 0x75795d5e, 0xadfc0d82,
+    0x7a97fcbb, 0x3efc8d75, 0xd60bed9f, 0x64f23752, 0xb4e447af, 0xe57579dd,
+    0xaa204fd6, 0xfaacdbd8, 0x868eaee5, 0xbf66054d, 0xc984282b, 0x9ec985f4,
+    0x4bf1e578, 0xbbdc689f, 0xb79825b5, 0xc24e1847, 0x49e1c4dc, 0xf871d941,
+    0xf4844ecb, 0xc9467061, 0x3e575657, 0x7399d6da, 0x024a20f2, 0x53c7b156,
+    0x7f1365ce, 0x8c463c3c, 0xd92a25c5, 0x354a6d5c, 0x9a346687, 0x61019ddd,
+    0x910b4190, 0xf2c9cce9, 0x20b248c9, 0xaeac6f78, 0xf1bc6ec7, 0x773952d7,
+    0x7951f887, 0x94bcaf08, 0x598d8dc7, 0xfa3b96a7, 0xf7b0d91e, 0x0dabd36a,
+    0xc4536467, 0x51f7b2f6, 0x07773d63, 0x6363afd0, 0x9a667aaf, 0xa51037dd,
+    0xefec5784, 0xccb4971e, 0x2ddfdc17, 0x48918576, 0x80ebe35c, 0x25cb4653,
+    0x77e3544f, 0xa1f20639, 0x0ff6ae8d, 0x0958c657, 0x93871bef, 0xd9c0a159,
+    0xe0e2d7c7, 0x57a8336d, 0x5c7c63c8, 0xd7587b30, 0x066d06e6, 0xc464d75e,
+    0x634d6026, 0x2d401d32, 0xc10cda76, 0x82725878, 0x6c15431c, 0x45f8aef5,
+    0x26740795, 0x0c842936, 0x9ef8588b, 0x7303438c, 0x19d4d31e, 0x76a51c9e,
+    0x3be67c95, 0xf52a592e, 0x37a03bae, 0x4dbfba69, 0x298129dd, 0x676e4133,
+    0x1c202730, 0x63a25cb0, 0x70ace13a, 0x2b7715e5, 0xcd4cf234, 0xabb324a9,
+    0xeee3cc46, 0x1e0dd04a, 0x6de9e653, 0x530fa7cc, 0x83b85db8, 0xc1c341c1,
+    0xd8bab9c3, 0xb9dec0e3, 0x74e7da39, 0xeef99aea, 0x31dc859d, 0x4816b60f,
+    0xec869183, 0x05d7f1a9, 0xc6cb67ed, 0xc915beb8, 0x7e93a9d5, 0x0d651f53,
+    0xc28f7ded, 0x0821aa75, 0x56eeeaba, 0xa5eb2be7, 0x0a26268c, 0x7b664d08,
+    0xe399880d, 0xad3c799b, 0x236e277e, 0x2d9b8417, 0xd543294c, 0xb44536af,
+    0x75750eb6, 0x0f0a36aa, 0x47ea7297, 0x965840b7, 0xda257b80, 0x9e6a530b,
+    0xcc8b095b, 0x9cb1ace3, 0x8ad7eae4, 0x8a3904d3, 0x3ba18b79, 0xa1f137a4,
+    0xf5fbad22, 0xcfda1f4b, 0x73657db1, 0x7469784d, 0xc61e8b24, 0xbaf992cc,
+    0x13c37c72, 0x74378fbc, 0x61ed826b, 0x556855f3, 0x736adec1, 0x57e1ced5,
+    0x812f6b28, 0xeb1eeb86, 0xc8476905, 0xf661b3a5, 0xf8cc85f8, 0x6f0871db,
+    0xeacf6fee, 0xbc2eaf53, 0xf1efe2ba, 0x00ff8763, 0xff90b5eb, 0xf89f6600,
+    0x5b5f3f13, 0x4ac74f58, 0x83f68afd, 0xbd1f8dde, 0x39c63f3a, 0xf59fdb4f,
+    0x2af0bf38, 0xeff8ca5f, 0x4402caa9, 0x6662785f, 0x446a247f, 0xcba344a2,
+    0x7b4c1b05, 0xba533ff1, 0xf3bffb37, 0xe67f9647, 0x4cadbbfa, 0xc06ddf38,
+    0xbd7fa308, 0xeaf744bc, 0xc57ca607, 0x96f2881b, 0xf1fd1de5, 0xdd316f1b,
+    0x3fbd4f3e, 0x09126353, 0x3312c5fb, 0xcc5127f9, 0xb8d13c24, 0xd11c13ef,
+    0x2c7fe3f7, 0x63681c7f, 0xf03eb790, 0xa3dc598e, 0xdf7d8cef, 0x4924b5f9,
+    0x6679c468, 0xef117156, 0x8ef6c7cc, 0x4373fc28, 0x35ea16f6, 0x37ac8777,
+    0x22d6cdb3, 0xc4dc3ec6, 0x57ca5490, 0xd1e48ae7, 0x58949208, 0x48671d16,
+    0x390b48c1, 0xa0bc2386, 0xd43e18d5, 0xfa106620, 0x525b2c99, 0x144899ce,
+    0xa141f78e, 0x2bc744e3, 0xc444a694, 0x4e4c04c1, 0xf1b31bbd, 0xf5cf67cc,
+    0x8e9fdde8, 0xaf7f3e63, 0x73fcec46, 0x7afdf319, 0x98e36737, 0xd1eb9fcf,
+    0xc61c3fbb, 0x5e00ff7c, 0xe6f8d98d, 0xf4fae733, 0x977fc76a, 0xbf2fdef7,
+    0xb5bf00ff, 0x8e8fd5e8, 0xad7dfe62, 0x7cacb6be, 0xedf3176f, 0xe363357a,
+    0x6b9fbf78, 0x1babad6f, 0x8bd7ee7d, 0x6dedf6db, 0x6f63b5f5, 0x7bf1dabd,
+    0xaeacdd7e, 0x2e01af22, 0xb1503972, 0x6f82f858, 0x71ea22e3, 0xea4081f6,
+    0xb9b1b842, 0x0c728847, 0x2d01239b, 0x447211fb, 0x7e76a3cf, 0xfef98c39,
+    0xf1b31bbd, 0xf5cf67cc, 0x8e9fdde8, 0xaf7f3e63, 0x73fcec46, 0x7afdf319,
+    0x98e36737, 0xd1eb9fcf, 0xc61c3fbb, 0x5e00ff7c, 0xe6f8d98d, 0x1efae733,
+    0x5218e223, 0x689b1032, 0x615563c3, 0xd55e8c76, 0x2d174bcd, 0xa83aa9be,
+    0xa0bd74c5, 0x99990708, 0xcbc9c59e, 0x7b70ab3c, 0x1f1830b5, 0x0f4101e5,
+    0xcda371fd, 0x7a93c2f0, 0x7b9f649e, 0xa576c5c1, 0xcfdbf45b, 0x2e04f4fb,
+    0xac59b0ba, 0x4ca16416, 0x4d399349, 0xd8924b60, 0x3fbbd18b, 0xff7cc61c,
+    0xd98d5e00, 0xe733e6f8, 0x6eebdffa, 0x7f00ffce, 0x7dfe62b6, 0xfcec46af,
+    0xfdf31973, 0x88d57077, 0xfee2adf7, 0xac46af7d, 0xb600ff7d, 0xd73e7ff1,
+    0x9f580d7f, 0xe72fde7e, 0x6eebdfda, 0x7f00ffc6, 0x7dfe62b6, 0xb11afeae,
+    0x5fccfd3e, 0xdde8b5cf, 0xfe628e9f, 0x1bfeae7d, 0xccfd3eb1, 0xb7b5cf5f,
+    0xbe8dd5d6, 0xedc56bf7, 0xf8bb76fb, 0xf6fbc46a, 0xd73e7ff1, 0x9f580d7f,
+    0xe72fe67e, 0x9afd8fda, 0xfde4ddb1, 0xf7ee8bf7, 0xd16b7fbf, 0xed7f1fab,
+    0xb5cf5fbc, 0x8dd5d6b7, 0xfcc50bbf, 0x735355fb, 0x9a1ba7d8, 0x1e618ebd,
+    0xd8fb2c3b, 0xc72bd79a, 0x64b89e50, 0x122b58c1, 0xb646069b, 0x1c501243,
+    0x1e04feaa, 0x702ee5ae, 0xfbd5caeb, 0x4bfeb22c, 0x1b5cc058, 0x8f557e0b,
+    0x61952784, 0x64e2021b, 0x246200a6, 0xd1e77b8a, 0xc61c3fbb, 0x5000ff7c,
+    0x0dcd5b3f, 0xdc8400ff, 0x186b2586, 0x7946a4fb, 0x8e888808, 0xa2fb00ff,
+    0xc74cbb67, 0x95b5ca3d, 0xf93b15cd, 0x5267d627, 0x1920aba2, 0x9995fa38,
+    0xba8d76b4, 0x472c7bee, 0x85c83289, 0xbf788ff3, 0x7dfd23f0, 0x1d3f616d,
+    0xda2bf62b, 0x7e347a0f, 0x00ffe8f4, 0x6e3fe518, 0xffe2d47f, 0x7fa9c000,
+    0xa6bee32b, 0x39812d0f, 0x653cc4a5, 0xf38bcd93, 0xd4ed816a, 0x541618b1,
+    0x0fea38ac, 0xdaa59398, 0x162b58ed, 0xdba65bdd, 0x32860000, 0xe11a3054,
+    0x2b950d4c, 0xc82ca9eb, 0x96c525a7, 0x612d02a4, 0x96b6a114, 0xe7293a65,
+    0x135adcb0, 0x0bcbf773, 0xace9c0a8, 0x30698c89, 0x7ee15b69, 0xc795b126,
+    0x78e2737d, 0x30572c6b, 0x43bb8dd3, 0x143a56c3, 0xdbab8872, 0x369a85ac,
+    0x860b1d39, 0x6a88ad3e, 0xb94a6eba, 0xd8c7b5c4, 0x968caebf, 0x843fce42,
+    0x4c86a2f8, 0x116bc3d5, 0xb2ce15a6, 0x6ea6d96c, 0x3e6a0fcb, 0x5b292552,
+    0x581896d7, 0xe82a3116, 0x1f7ff89b, 0x07cfe290, 0xd7161f71, 0x6f0c98ed,
+    0x01f58982, 0x84558e16, 0xb6f1d51c, 0x65ce4225, 0xd79440a2, 0xbaa17bad,
+    0xc022e6c9, 0xcce04592, 0x32e3448d, 0x777c4a19, 0xfc0e6bda, 0x5b6a8c26,
+    0x0dcc2f6e, 0x6ed59b99, 0xd7f4ae57, 0xd9dc1a29, 0xe6589505, 0x1b8f3681,
+    0xc99617a3, 0xf5f09022, 0xb2e45497, 0xe16752ea, 0x66970aec, 0x82c4a26b,
+    0xe5689ded, 0x1032433e, 0x82505fe6, 0x6719c135, 0xe1ca0259, 0x800fdc71,
+    0xb7672ca9, 0xa6c2384a, 0x38c1ac2f, 0xa1b18bf1, 0xe7d64f3c, 0x4599113f,
+    0x75f0cfcc, 0x00ff853f, 0xfd706dfe, 0xbae64baa, 0x01aed5cc, 0x2bfc03b7,
+    0xb5562d95, 0x22f1298b, 0x32439b24, 0x2f9293a1, 0x02fc6db0, 0x1afdb1d7,
+    0x6af88a6c, 0x8b9137bc, 0xa73de637, 0x3d9cc31f, 0xb156c998, 0xc8447191,
+    0x8c3e2647, 0x2f50ee48, 0x27a0c4b4, 0xf61ac19d, 0xab8db517, 0x863769d8,
+    0xa70ffe30, 0x58b5f613, 0xaa0a9cb9, 0x787cde99, 0x77528750, 0x5fcc59da,
+    0x1c1b5977, 0x47cc934d, 0x929dbd0f, 0x18c5d9ca, 0xed62eacb, 0x656841b2,
+    0x4e5b793a, 0x31733f30, 0xf71890d1, 0x8ef6477b, 0x4373fc28, 0x35ea16f6,
+    0x7e94f053, 0xdec475b4, 0x9b43fa28, 0x00ff91fb, 0xeeb576d6, 0xbd46f247,
+    0xd748fec8, 0x1ac91fb9, 0x23f923f7, 0x247fe45e, 0xaa9c1a6b, 0x6ed9f549,
+    0xd6aac6b2, 0x634d5bbe, 0x8355b1d6, 0x88d6e53e, 0x06b66329, 0x233a041b,
+    0x05ea2c03, 0x436b970a, 0x23f732e9, 0xea6924d0, 0x97a40826, 0x0303490c,
+    0x40a28d78, 0x4eeea3c4, 0x93569db8, 0xab50c62d, 0x1bfbf064, 0xd5cbaa47,
+    0x1cc2911f, 0x622666b5, 0xd13ad418, 0x242c526e, 0x0e9a37c0, 0xc3059544,
+    0x5c1a5b63, 0x7c26572f, 0x4a68be49, 0x0b880732, 0x7db1669f, 0x8b766698,
+    0x227b35f2, 0x3bccc1e8, 0x0c361d91, 0x86ac671c, 0x68d77304, 0x54b223f8,
+    0x081ccbe5, 0x7665b1db, 0x5cc3d199, 0x029b61a3, 0x4098bcc3, 0xbedbb7bd,
+    0x0db6bf77, 0x67b8ac18, 0xd4d49830, 0x5dd7c8e7, 0x94a5dc65, 0x97c3fa7b,
+    0x868b69bd, 0x8c3d7476, 0xace9d9b0, 0x0c4c4f37, 0x5ad492a0, 0xe5a4d8c5,
+    0x54e4745e, 0x03a20657, 0xbd9b0a1b, 0xde047d60, 0xf3fa30dd, 0xab3b69b2,
+    0x52870ed7, 0xe619907a, 0x2f3176db, 0x751eeea4, 0xd92ca34c, 0x28833dec,
+    0x944883ac, 0xe5bd4909, 0x4558a767, 0x892b8f45, 0x23253131, 0xa158fb95,
+    0x151b6b6d, 0x24672b59, 0x927c0283, 0x8a0fb626, 0xb148606a, 0x08e81e67,
+    0xafc9bb67, 0x35923f72, 0x46f247ee, 0x48fec8bd, 0xc91fb9d7, 0xf923f71a,
+    0x7fe45e23, 0xf6846b24, 0x880b00ff, 0xf59f967f, 0x89782f38, 0xf2218ef6,
+    0x5e531ffe, 0x6b247fe4, 0x8de48fdc, 0x91fc917b, 0x51b9d7a4, 0x72d9d176,
+    0x4fe49a8f, 0x62eab458, 0x9148daae, 0x1c7b6dd4, 0x4aae74bd, 0x4491e514,
+    0x3a6df372, 0xaa58caa6, 0xbbee4b18, 0xd3be027d, 0x562d747d, 0x959c8ca5,
+    0xade54c87, 0x55969ee4, 0x051bc815, 0xe9ba58e3, 0x93c80512, 0x622c2026,
+    0xa3c5d758, 0xa95d57c7, 0x4cd1e526, 0xc659b7d8, 0x49a243cf, 0xbfa24b92,
+    0x5b47756b, 0x1475b124, 0x554f8fe6, 0x6f183c8e, 0x9cdea96a, 0xb6d15e5b,
+    0x52affb38, 0x0ab2db6b, 0xe9ae8000, 0x9b940c72, 0xaf0a119e, 0xb4ceae5d,
+    0xf3585497, 0x08d96af0, 0xc271407e, 0xc79276e7, 0x6dd3e422, 0x4a1475b4,
+    0x9f70eb3a, 0x08df1db5, 0x3b7616ca, 0x25750439, 0x51049fe9, 0x636c6471,
+    0x16edd369, 0x475d6e79, 0x38aeb22c, 0xc859169c, 0x1f28c532, 0x9385b292,
+    0x24ed0b1a, 0x6cb5dc7c, 0xdb823175, 0xa75c6fd5, 0x6494378f, 0x761aab2c,
+    0x6202e442, 0xae18a8bc, 0x7b11e2c8, 0xda81d7d3, 0xc582b5bc, 0x79314f86,
+    0xe2186503, 0xe75184a4, 0xb7cb8d24, 0xb020dd89, 0x6a3cc8d4, 0xe7de3525,
+    0xc32676c5, 0xc52a1576, 0x56682979, 0x56eb62c8, 0xe565fbc6, 0xad93eb64,
+    0x8f630a1d, 0x7987bbaa, 0x646f6227, 0x22d6393b, 0xe4965796, 0xbac0432c,
+    0x21d54212, 0xc559966f, 0xd22b92a2, 0xb95639b5, 0xb2620fbe, 0x7af4685f,
+    0xdb745975, 0xbdbf9563, 0x1d3d14fb, 0x5a5ac99e, 0x72280c05, 0xbbea78b3,
+    0x72adabac, 0xa4ba569b, 0xacb85c7f, 0xa674a96d, 0x9a2066cf, 0xc7ba9ad6,
+    0x4c49205e, 0x852defeb, 0xdc524ab0, 0x10be8972, 0x652e2a7d, 0xa562d78e,
+    0xa1397c03, 0xebeaaad3, 0x10eeec11, 0xe790768b, 0x07a6a74a, 0x29a1becc,
+    0x655f2c19, 0x598516db, 0xf62b76ba, 0x75ec8d9c, 0x2351856b, 0x00ff37d8,
+    0x4cf58697, 0xcf5a9d62, 0xae6e37a8, 0xdf4190c1, 0xf22a34b9, 0xb14bb15a,
+    0x458ec03a, 0x6bbc6996, 0x72ab5adc, 0x32651f4c, 0x20756919, 0x93c46779,
+    0x728f9128, 0xee35923f, 0xbd46f247, 0xd748fec8, 0x1ac91fb9, 0x63f4efe1,
+    0x9300ff87, 0x00ffe92b, 0xebeb1f81, 0xe9f8096b, 0xd05eb15f, 0xf7a3d17b,
+    0xc7f847a7, 0xbe73fb27, 0x03fe17a7, 0x1d63f94b, 0x5cc213f5, 0x032c934b,
+    0x592bf9b0, 0xcdce1f3e, 0x822a591b, 0x322690ac, 0xa9d59b78, 0x1aa86e03,
+    0x55b5c9ca, 0xebd194f5, 0x03e001f5, 0xb18627b3, 0x7f6ec178, 0xc399511f,
+    0x5d239ee2, 0x2173a302, 0xf08c451c, 0xd1616b43, 0xe9da4276, 0xd842aa63,
+    0xe235b72b, 0x3acba5e5, 0x95ea9908, 0x89377e7c, 0x298b8867, 0x922d1cc6,
+    0x88d564c9, 0xe2a9e3ca, 0x913d5cf0, 0x7b3d7e2b, 0x6f760b89, 0xb1968d3d,
+    0x58d8ab75, 0x612a1029, 0xd967b9b4, 0xa3e5ef00, 0x9ce2891f, 0xe8e31577,
+    0xfb8dcae5, 0x2d655129, 0xd53de975, 0xf03bd72b, 0xf1c688a6, 0x2581ba15,
+    0x1a0f401d, 0x58ef8647, 0x0dc7ece3, 0x55b187b7, 0x363c39f1, 0xee7c192f,
+    0xcf0b0be5, 0x391cb214, 0x95b2e891, 0xd1d36446, 0xaa69f95e, 0x9c2c2c74,
+    0xc472686a, 0x612337ce, 0xfbaf5fb9, 0x6d8ec7d7, 0x6f1b1735, 0xa02e8903,
+    0x3a6f7a62, 0x3af98ba9, 0xdbe15fd7, 0xc0a568b6, 0x4ba140c2, 0x656f4026,
+    0xea05ad35, 0x8b567bea, 0xbbd25baa, 0x5d98034a, 0xaa955580, 0xb1a385c2,
+    0x60b0dcc2, 0x1343ca6f, 0x3b7c511f, 0x1ec62836, 0xf04a5204, 0x74b50f1e,
+    0x9f58447b, 0x7c839fec, 0xf1d4cd2b, 0x5767fbb9, 0x939b136f, 0x05b2d7c5,
+    0x0bed5cf6, 0x3ff180f0, 0xbb621f05, 0x35c4b52b, 0x55b117f1, 0xc2ca96a0,
+    0x79cda1ca, 0x85ed8856, 0xabc7e678, 0xef858362, 0x94f1f4c2, 0x71441c30,
+    0xe28445c2, 0x8c415c0a, 0x86ae59c8, 0xcb5b110f, 0xf1b3312d, 0x6a7eeee0,
+    0x2c5b33cf, 0x270248a6, 0xb1770766, 0xc3add275, 0x2c58baf8, 0xed66267d,
+    0x4ab9b0e2, 0x895ac5ec, 0xca700bc9, 0x760ded89, 0x2fb5a82a, 0xb48a9aae,
+    0x380efb22, 0x16c8cdb4, 0x27f00ef3, 0xdb768630, 0x8e999371, 0xbb63dae9,
+    0xf6474cee, 0xbf2f278e, 0x921fa59b, 0x00ff2783, 0xa76ad4c6, 0x68fd28e1,
+    0xd2bf89eb, 0x9df2df1c, 0x2f63ddaf, 0x52539e3f, 0xe92d5bf5, 0x693a13c4,
+    0x0c729968, 0xd196c490, 0xbc4312dd, 0x4cd5d8fd, 0x049dfa83, 0x2c1c975a,
+    0xe3c99960, 0x1892917b, 0x73f2ef99, 0x28acbf47, 0xd4865818, 0xe4aae4c7,
+    0x7c3f408c, 0x71b6c137, 0x6d0f6958, 0x4dad718e, 0xe522b380, 0x2c6fe791,
+    0x96a9dd17, 0x152b5b07, 0x28b67ab8, 0x1120cda8, 0xbc61856d, 0x5d2bc818,
+    0xc97a7fae, 0x47fb9ccc, 0x7939aa31, 0x3bbba720, 0xbb1c648f, 0xaf727822,
+    0x3bae8cb0, 0x770d9b05, 0x47a26452, 0xf6f468c5, 0xf79de613, 0xabacfbe5,
+    0x1e740c7d, 0x047e1b6b, 0x17a89750, 0x12559652, 0x168e53d9, 0xcac522e6,
+    0x1e735def, 0x2666fa93, 0x2a71f761, 0xb77fc68c, 0x93656ed0, 0x20200493,
+    0x209a2067, 0x61a7ec80, 0x557b7abd, 0x26abdb34, 0x4f36a49e, 0x1675a398,
+    0x5d56aa66, 0x1ece22ab, 0x2a5d5861, 0xc67253d4, 0xbd215935, 0x1f6b956d,
+    0xad34a94a, 0x020a16aa, 0x0f134086, 0xaeb653a6, 0x84d4addf, 0x9dfc9a58,
+    0xb5678151, 0x984b42d4, 0xc7238e44, 0x4fb16d59, 0x5ffcd376, 0xf24fe1bb,
+    0x69f987b8, 0x825300ff, 0x71cc00ff, 0x3ff5ed0f, 0x97cebb70, 0x4daeae40,
+    0x28fb4850, 0xdd32d6b6, 0xe1f81044, 0xb99c2bb7, 0x46dc8222, 0x88798724,
+    0x2b79ed89, 0x8247ed16, 0x8d8434f3, 0x77826587, 0x266937f1, 0xe5ceac23,
+    0xb304ecf5, 0x621eee62, 0x598e2981, 0x0c99adc4, 0x71e206cd, 0x6c4d28d6,
+    0xe4064867, 0x93be6cc3, 0x2e8c71d7, 0xe9d95bc6, 0xf7b3dedc, 0xa5adee04,
+    0x99a90b91, 0xbe8ebbb8, 0xdd5a98aa, 0x15910392, 0x9d06e3ad, 0xc0aec953,
+    0x7674195a, 0xa4c97c3a, 0x169b1068, 0x0a525a24, 0x8d753b83, 0x7a55eef7,
+    0x17f1f42f, 0xaab0d2e9, 0x9a160bd9, 0xd9b1f7ea, 0x8db19809, 0x6cb1a54a,
+    0xce2420eb, 0x6b6ce5c2, 0xaf8bc584, 0x505fc176, 0xef573363, 0x28eb52d5,
+    0x564bed8a, 0xc3127897, 0x6cd923ed, 0x99c0c043, 0x600ae1ed, 0xf6ca44cc,
+    0x83b6053c, 0xfcf8c1e3, 0x2c402eda, 0xb392cf3e, 0x1eba7a99, 0x88eb1cd9,
+    0x4b9e27c8, 0xecb123a7, 0xd71ccb25, 0xb1ba77f1, 0x5bd9214f, 0x1d8b400f,
+    0x6722ed52, 0x8d287c67, 0xac92e462, 0xf3844559, 0x1a344c81, 0x294f82b3,
+    0xee4ea7d2, 0x95ebba5a, 0xaa9687eb, 0x84cfa6b4, 0xca0a566d, 0x644ce6fd,
+    0x84941e33, 0x2b2be8a5, 0x677ba865, 0x6505069c, 0xb5e58b6a, 0xed81cfa2,
+    0x19532b3b, 0x276f1355, 0xb0a91b8f, 0xbeebe2e6, 0xad2f14ba, 0xb612a67f,
+    0xd8a2927d, 0x7471fbc5, 0x5cea55c5, 0x304459ab, 0x6311e38a, 0x2ce2a0a6,
+    0x6b374e56, 0x9d99f36c, 0xde334e5a, 0x0a078b76, 0xc6d86a0f, 0x55b275b9,
+    0x88b21454, 0x4aa542b7, 0x76bb5dfb, 0x3eef8a6e, 0x305969df, 0x2613767a,
+    0x3be42c96, 0x57262438, 0xecaa6ae3, 0x6b5821bb, 0x6aaf9532, 0x4f4996a4,
+    0xec787182, 0x62fb4d85, 0x8a199ae7, 0xf75a2a5b, 0x62280f32, 0xca1c9740,
+    0xd9d4ac70, 0x356e66c8, 0x01c80365, 0x422fb690, 0xb07de2c4, 0xc2ca7181,
+    0xbe1b0fe4, 0x3cf7df37, 0x708cfe3d, 0x65f200ff, 0x33f03f7d, 0x616d7dfd,
+    0xf62b1d3f, 0x7a0fda2b, 0xe8f47e34, 0xe41800ff, 0x776e00ff, 0x00ffe2d4,
+    0x2c7f69c0, 0x9ca0be63, 0xcc144089, 0x294fcc09, 0x02cded48, 0xde91495e,
+    0xbcc9db37, 0x1292a16f, 0x09e63818, 0x1d839891, 0x7d66dcf6, 0x1b136fd4,
+    0xbe8dddc7, 0xc4c44ca4, 0xdece7817, 0xef6edf58, 0x1e13dfbf, 0xe5497dfc,
+    0x4aa22d19, 0x869d8976, 0x793ba53c, 0xf9ec3e22, 0x534b4623, 0x668e2a18,
+    0xae100110, 0x9873e73b, 0xa28d8189, 0xc9db7267, 0x60467b3f, 0x372e18a6,
+    0x0a110061, 0xe6bcbfe3, 0xe98e6123, 0x9de4edf2, 0xcc4c4444, 0xdf11d1ce,
+    0x88e43333, 0x06a9bf8f, 0x718f0101, 0x44898c01, 0xce1800ff, 0x749e1ad3,
+    0x0c4679b4, 0xca7196b9, 0xce093b05, 0x3325dcf1, 0xd33d0511, 0x38a9d13d,
+    0x88199012, 0x4679da23, 0x97c4dc4b, 0x9d762692, 0xfdedf2b7, 0x1ebf89a7,
+    0x9d4ffed4, 0x127eaa46, 0xb38ed68f, 0xe0d2faa8, 0xd60c1d9b, 0xd6a23d55,
+    0xfeb4cd0d, 0x5a87f795, 0x102063cb, 0xeae50dcb, 0x06039039, 0x1de522c2,
+    0x9ca1d7f6, 0xfd07ea05, 0x3843af27, 0xfa0fd40b, 0x70865e4f, 0xf41fa817,
+    0xe00cbd9e, 0xe93f502f, 0x85e30b3d, 0x25e98c7d, 0x541fe3b6, 0x24aee1ef,
+    0x16905f6e, 0xed125476, 0x0d8404be, 0x9adac752, 0x4cd6d3d4, 0x074bc836,
+    0x0ef76a41, 0x3ae3187b, 0x5d546f96, 0x9a3fbc7b, 0x71ec262b, 0x258f2d28,
+    0xf2b5dc0e, 0x97b8c031, 0xcde77c35, 0x5a328ab7, 0x7e5a7f9b, 0xc6cea0c6,
+    0xecf192dc, 0x831c5bc3, 0x0639c9b1, 0xe4e252dd, 0x2b8fe9d6, 0x4bdb144a,
+    0x96a5c4b6, 0xfa955915, 0x0f2d626d, 0x2221f002, 0x82a0b3cd, 0x3691091c,
+    0x242cc1da, 0x2e2ba30a, 0x99b0e4e6, 0x1cf2e989, 0x1411289f, 0x9c214314,
+    0x9964ec0f, 0x97c7c355, 0x6d3d1c68, 0x6b69adee, 0x71b4ab2a, 0x58eeba3a,
+    0x515057d8, 0xe932e4d4, 0x0113cd16, 0x1f70708c, 0x7fe94d04, 0x5b9fec66,
+    0x78fd2196, 0x8454592e, 0x8644a2e4, 0xb6b97962, 0xb664dae5, 0x5ad59988,
+    0xc79ec0c1, 0x64a33b4d, 0xa814b5aa, 0xc6dea2d8, 0xf0b86d0c, 0x9881389a,
+    0xa85565d0, 0x6c99c28e, 0x96e4911a, 0xce55c300, 0x5ec1db36, 0x4daaecc6,
+    0x348a76e8, 0x2e1265e9, 0x9a42eae4, 0xe07e5ecc, 0x901b84a1, 0xc172a50b,
+    0xe5e69082, 0x9994b12d, 0x81c07fec, 0xaeaa326b, 0xb1b0a8c6, 0x5977a51d,
+    0xfe3cad2a, 0x58a2e919, 0xb290e5c8, 0x5c793569, 0x9b89192b, 0x1ffb9418,
+    0x6ae429f0, 0x5bb3a976, 0x98b29cc0, 0x926abfa5, 0x1b05e669, 0xe17b962b,
+    0x0a3bcfb3, 0x2786c8b9, 0xfd02ced0, 0x7ad27f1f, 0xbd8033f4, 0xa400ff40,
+    0x0167e8f5, 0x00ff817a, 0xced0eb49, 0xfe03f502, 0x9ca1d793, 0xfd07ea05,
+    0x3843af27, 0xfa0fd40b, 0x6e335c4f, 0xddf16329, 0x6347ce59, 0xb49ad7c5,
+    0x1acad355, 0xae094ab7, 0x75729690, 0xcc85ed5b, 0xe6ee33e3, 0xedc235da,
+    0xcce189b7, 0xaf19988a, 0x9be3ce6d, 0x76c9917c, 0xa557c3b6, 0x5e3d0465,
+    0x0b8cb6a7, 0x986bfa24, 0xf47792db, 0x453f806f, 0xd73a9fb2, 0xfa017ca3,
+    0xd6f9942d, 0xc1135f93, 0xdcf6c7fe, 0xa0aa0bfb, 0x32910b8c, 0x800a14f7,
+    0x304dcea6, 0xe39e72be, 0xb3fc826c, 0xb4131127, 0xec13fc3d, 0xca96686e,
+    0x53a9d43a, 0x111f28ca, 0x3173d1cd, 0x8680fb79, 0xb742eec8, 0x4ac4ccca,
+    0xb6000a42, 0x70045f91, 0x8c010a23, 0xb21d0e98, 0x13480b73, 0xc981c95a,
+    0x81a5c04e, 0x00e48531, 0x88982212, 0xbc2dd199, 0x608bc011, 0xf8ac8914,
+    0x1418c876, 0xb2844479, 0xf7312351, 0xd7786362, 0xfa039ca1, 0xa400ff3e,
+    0x055f0af4, 0xa6310970, 0x03f0012b, 0x60ce98a3, 0xa42c3746, 0x11336f44,
+    0xdf47ccbc, 0x78b6359d, 0x57ded81f, 0xcc5ad15d, 0x2547a7d3, 0x70525ed9,
+    0xce38b62a, 0x0875b621, 0xed106cc9, 0x0373ae22, 0x6386dc01, 0x0f70865e,
+    0x93fefbe8, 0xe057b6d5, 0x5060016e, 0xcf6d37ab, 0x353ac880, 0xb744c945,
+    0x59866566, 0x1c12b6ed, 0x8f67838a, 0x25cac9cd, 0x0067e823, 0xe9bf8ffe,
+    0x3e95223d, 0x5a17e007, 0x154ad1b4, 0x515f23e0, 0xf3083b87, 0x8eb52cb7,
+    0xc44cf7f3, 0x74e9fc7e, 0x003f70eb, 0xd299cbb2, 0x6104bc5a, 0x79f0cfcc,
+    0xc70596d9, 0x1147ca93, 0x65b17afc, 0x7dec0f3c, 0xaa32ea35, 0x819839ad,
+    0xd61db4ae, 0x0a75ab12, 0x025169c6, 0x374101c6, 0xe78849ec, 0x6d3cac79,
+    0x078e6555, 0xa90b00e0, 0x304a152b, 0x4572c892, 0x8e2caded, 0x8ef65c96,
+    0x3f1e1ab2, 0x382fcf2c, 0x170981c4, 0xfa039ca1, 0xa400ff3e, 0x0067e8f5,
+    0xe9bf8ffe, 0xc0197a3d, 0xfaefa33f, 0xc165404f, 0xc820081c, 0x0e4f5999,
+    0x096481d9, 0xce849448, 0x2881624b, 0xd8b79d91, 0xafcb63a2, 0xf4073843,
+    0x4900ff7d, 0xa2630deb, 0x1f7edd8a, 0xd5b3bbc2, 0x3aaaaa5c, 0x1a7d1294,
+    0x5a3992ca, 0x5722bf15, 0x818b5c26, 0x7ddb691e, 0xfd33f03f, 0x3f616d7d,
+    0x2bf62b1d, 0x347a0fda, 0xffe8f47e, 0xffe41800, 0xd4776e00, 0xc000ffe2,
+    0x2c00ff69, 0x00a7be63, 0x6fe33b7e, 0x701d58fc, 0xcbe57c15, 0xbd63a894,
+    0x97f9338c, 0x9625843e, 0xdeece057, 0x1cb2c35d, 0x88e72f32, 0xd7731431,
+    0x7b94b396, 0xd7726342, 0x0d27f10f, 0x7ce02533, 0x1daae4ec, 0xbf2ac33c,
+    0x62c98f21, 0x96b28158, 0xa89aa658, 0xd5a687b0, 0x15d8157b, 0x40242295,
+    0x9988e6c8, 0xf05877e0, 0x0f863ee6, 0xdc99f9d8, 0x7bec54bb, 0xbc1e63db,
+    0x61b742ee, 0x91c6bea6, 0xd5fca50c, 0x795d1592, 0x6a54641d, 0xc59cb5fa,
+    0xc401b319, 0x84ec369c, 0xbedd73e1, 0x9dcb63b7, 0xb9b1e466, 0x2ea0492c,
+    0x8a8a7557, 0x5cd25eaf, 0xab665116, 0x1666b282, 0x0c429bce, 0x718e8f39,
+    0x9aefc38a, 0x25f1067f, 0xd8d7599b, 0x48d22593, 0xfaf81ad2, 0x10046015,
+    0xdcc64626, 0xd3b59179, 0x509808d3, 0xe10fc7f2, 0x1ebca630, 0xde66050b,
+    0x32b28d6f, 0x7872d863, 0xb13db0a3, 0xf234e1d9, 0x7fc64a39, 0x61d1a862,
+    0x5cf35c38, 0xeaf316a6, 0x1dcfd82f, 0x70bc7fc3, 0xbf93577c, 0x15d1cc95,
+    0xa599a52f, 0xd8abe29b, 0xd464c750, 0x35656350, 0x681a8870, 0xb9a2395b,
+    0x8f3cb91c, 0xd16bb015, 0x7c9af046, 0xdfa99a60, 0x68460acb, 0x00ffbe54,
+    0xdf3102bf, 0xe66436ac, 0xc6cc8913, 0x3a11d746, 0xfd2a8404, 0x1ed5be62,
+    0x08fe2923, 0x21c5d073, 0x26f62dab, 0xccf15edd, 0xb7c42771, 0x60157972,
+    0x893de6a9, 0xefe33a78, 0x89aba5b2, 0x0ae20fa4, 0x52131736, 0x22cb3688,
+    0x8488a64b, 0xfa24b9ac, 0x4e09e285, 0xdcc1a3b8, 0x51531c52, 0xf3c145bc,
+    0x337e1c91, 0x64758729, 0x88bbf2ac, 0x16503333, 0x90c97a6e, 0x52380592,
+    0x6086bb41, 0x9a1f4b84, 0xace2d6c7, 0x6a375f76, 0x33430d67, 0x875cc495,
+    0x85ccebe1, 0x4b91bb9c, 0xace94911, 0xa154c1d7, 0x2c9bd1cc, 0x35239e5b,
+    0xdddf24d6, 0xdae32ff1, 0xa8f3c99f, 0x51c24fd5, 0x12d7d1fa, 0x19a400ff,
+    0x3f3be5af, 0x54ee2cb9, 0x6bb8c08b, 0xe757642b, 0x4979c2db, 0x953162e5,
+    0x976867e2, 0xdc978142, 0x610a3d31, 0x88c678b9, 0x65c71e2e, 0xc7f918b1,
+    0xb09ad9e5, 0xef3abdcb, 0xbf5ec5b0, 0xd62ef76d, 0xc4cf1cb3, 0x45c02996,
+    0x30490c20, 0x07de8c2b, 0x958625d6, 0xb76d6856, 0xac262b07, 0x36d4bed4,
+    0x41c38e1d, 0x683d05ae, 0x5b3ec6c7, 0x0e34b15b, 0x66eddcac, 0x3ca38bc2,
+    0x64418a88, 0xdcfd5ad9, 0x278666fe, 0x2c9d1c27, 0x7c78db45, 0x827d975a,
+    0xd9c2fc5d, 0xcaa34552, 0xb4cd8155, 0x4e500c05, 0x50cd56ab, 0xf815fbb6,
+    0x25962eb7, 0x83948657, 0x0e114b95, 0xdb28f516, 0x77cc4137, 0x6e0b4a72,
+    0x261a3ff8, 0x9382ba2e, 0xde26c890, 0x3067cf46, 0x76844d10, 0x72edb267,
+    0xed0bbe41, 0x0b8d7a12, 0x91ee5871, 0x77b99b4c, 0x5d71e4c7, 0x978d1fbf,
+    0x612d0271, 0x69ed592c, 0x66b870af, 0x31c60ef3, 0x0727d3c5, 0x0d418166,
+    0xe90a9b90, 0x8261aba7, 0xd7c580d1, 0xd4ec9bc3, 0x4a05f1cc, 0x20b253b9,
+    0x2bb63116, 0xe53a7b03, 0xd75c224a, 0x6e364b6d, 0x2cafbe76, 0x8b3c49c2,
+    0x134bb624, 0x66db937a, 0x546b3c31, 0x6b585b06, 0x556e6c95, 0x0e88ecea,
+    0xa93a364b, 0x0b14a843, 0x58b1a767, 0xe3f1e511, 0x9707cd48, 0xcfa5508a,
+    0x6a75f72c, 0x6878c852, 0xae8c653d, 0x3800ffc2, 0xf82ec13f, 0x7f0ad7fd,
+    0xcb1fc495, 0x1b9cfa2f, 0xfb337ffe, 0x5d8c354a, 0x469ec040, 0x78cff092,
+    0xb370c1dd, 0x6dcbf7e3, 0xd9ce2027, 0xe5aeab6a, 0x85e4105e, 0x2c46768c,
+    0xb633b0ae, 0x01d841a1, 0xa4d8c8a8, 0x3b2b1c3c, 0x73ca0139, 0xca51c356,
+    0x00dd948d, 0xa506f8c3, 0x35ba5715, 0xe3ba1c0f, 0x83478705, 0x1799619b,
+    0x9279e6e7, 0xf7f8a3e8, 0x6941fb0b, 0x88f4f194, 0x8a553c17, 0xdfef758b,
+    0xa87f03ed, 0xc5150839, 0x95a9b4aa, 0x60612555, 0x62ad0b9a, 0xc16483c1,
+    0x2b00cabc, 0xa4685a19, 0xba783567, 0x1c8e5b9c, 0xb1ab63c5, 0xb2ebf055,
+    0x2da0c615, 0x6709b0c9, 0x6c42d695, 0xecb54d38, 0x7a99ab49, 0xa6aa362b,
+    0x4f9cb2d3, 0x3569a399, 0xf78d76f8, 0xa1474559, 0x95d6c72a, 0x5d299bbe,
+    0x3b56de6a, 0x9d1c4065, 0x654db596, 0x4f0485a2, 0x11a3610f, 0x63cee58f,
+    0x85f02a73, 0x71e1418a, 0x729edcbc, 0xf3e52086, 0x1a62d2cf, 0xbe7ca0aa,
+    0xb341f734, 0x28d92b95, 0x521d6faf, 0x63c50f71, 0xff4a974a, 0x6ebd6c00,
+    0xf61b56a4, 0xedb195ba, 0xc5eb66a0, 0x7db3c767, 0x46ace92c, 0xcd572062,
+    0xd57154c6, 0x5296971c, 0x579b5b91, 0x3fbeebc5, 0x2958415c, 0xa74ad524,
+    0x6cb6ba83, 0x8b698e85, 0x4c4721ac, 0x594a7948, 0x02ab52df, 0xc757169f,
+    0x27c46447, 0x54898e12, 0x5db134ca, 0xdc85bca2, 0xead43190, 0xb6642d2a,
+    0x53f01cbd, 0x13db6b2b, 0x95627e94, 0xce3e4e5c, 0x175bfd12, 0x4cadc9f1,
+    0xcc59296c, 0x05bb1201, 0x6b265840, 0x7b13a175, 0x67c0cca5, 0x58991bb6,
+    0xdeed57a7, 0x78ab51c7, 0x869895b8, 0xae024e53, 0xf57aa552, 0x3e56a292,
+    0xae5856b5, 0x14f4ca15, 0x2516e4c8, 0xea0ab591, 0x9cccda26, 0xc5c0e16e,
+    0x9057c6e2, 0x3aa01ce2, 0x99457432, 0xf756834a, 0xa847af67, 0xf6f1abce,
+    0xb2e5a831, 0xb0e5ccce, 0x93eecdd8, 0xc55aed93, 0x121edfef, 0x6927e28d,
+    0xf62de698, 0x7f6fa79d, 0x4eefdb69, 0x3e4688b2, 0xefccd4c2, 0xefd22e07,
+    0x4f45465f, 0x1ecf3253, 0x94314c9f, 0x686e4720, 0x1c743938, 0xd30edb16,
+    0x9b78c3cd, 0x4a45ea18, 0x473a0bc6, 0xacacea68, 0xce90a1ab, 0x73ad4d31,
+    0x0a54b497, 0x4a3e9006, 0x04995aec, 0x055a6463, 0x81313610, 0xb80aec50,
+    0x4d418672, 0xd94983ab, 0x56a56f0b, 0x9cdd85d7, 0xe8a4bd0b, 0x4383c532,
+    0x3996d592, 0xab5a214a, 0x9e0fd443, 0x075c6536, 0x79f0280f, 0x1b3b568c,
+    0x150e29be, 0x76cbed2d, 0xea4fb186, 0xc91bc326, 0x42a25aee, 0xa820a2c7,
+    0x567ab5ec, 0xa9287449, 0x8d8af837, 0x522c494a, 0xb3688c33, 0xaced521f,
+    0x18b96a65, 0x9dfa989a, 0xecfbe16b, 0x12ccaf0c, 0x571488d2, 0x35d51569,
+    0x3b3c8135, 0xc5e0314f, 0x408e2296, 0xf6c531d0, 0xa5f782b1, 0xaec883f2,
+    0x128f42a5, 0xeb57acf3, 0x6dbd6e34, 0x94a57977, 0xd8a0beea, 0x41c352a3,
+    0xa61a7cb4, 0xdab9a1bd, 0x60af4fa7, 0x72d44e53, 0x84a320b9, 0x7045310f,
+    0x7800205a, 0xc019fd7b, 0x4ea3267f, 0x00ff0cfc, 0x5f585f5f, 0x8afd4ac7,
+    0x8dde83f6, 0x3f3abd1f, 0xdb3f39c6, 0xc338f59d, 0xcb7f1af0, 0xf5a9ef18,
+    0x7b78c5af, 0x72151af9, 0x2f62cb4e, 0xc708f261, 0xb6ef31e5, 0x5ef522a4,
+    0x55ef746b, 0x59631b75, 0x7524202c, 0x12e6cb01, 0xe4e9689e, 0x4e5e189d,
+    0x00ffe11b, 0xc5224e63, 0xdb32c1d2, 0x2ae2d618, 0x018b7d53, 0xcf80f86a,
+    0x16dbbe6d, 0x504aeb9c, 0xe9d15a42, 0xac21952f, 0x8e050f26, 0x60c08db1,
+    0x856a7217, 0x92bb4bfb, 0xd5267bb9, 0xfd7a21bb, 0x72ad2284, 0x4257e833,
+    0x05cb9a16, 0xd9b71125, 0x4e034324, 0xdee50aee, 0xf8f6c3cb, 0x089f3a47,
+    0x18325529, 0xe4ec371b, 0x2aa2d481, 0x7a798af6, 0xa5a71cb7, 0xdd56e7e6,
+    0xe6081d10, 0x091346ea, 0x17bfc682, 0x5bf5e180, 0x68bb8bec, 0xddade46e,
+    0xc86e31c9, 0x4865bf5f, 0x656382aa, 0x9a945228, 0x98545aeb, 0x403eeee5,
+    0x9d2bf5cf, 0xd6f00c8f, 0x861c0253, 0x4266d021, 0x3dd8f26b, 0x7dc1b9c4,
+    0xd808e619, 0x8de27e8b, 0x8e7ce154, 0x7b428a23, 0x97397263, 0xca3873e1,
+    0xcdb99a41, 0x8d6d4ecb, 0x95e645cc, 0x1071757c, 0x081856a7, 0xa5f68d5b,
+    0x48bd6165, 0x874306c3, 0x706de42e, 0x7723436e, 0x50e15f83, 0xd9ed8240,
+    0xbc4a853c, 0x7b530140, 0xf2c98fc1, 0x2a5459de, 0x4393d370, 0xd4a4d915,
+    0x50ab99da, 0xaaac1856, 0x26229632, 0x6c619e04, 0xb620b66d, 0x41611298,
+    0x1331ed77, 0x86714d3e, 0x0be93825, 0xc89a491c, 0x2690a35e, 0x8d173bc1,
+    0x73b33ecd, 0x76f1d158, 0x3e06c898, 0xe44b9a8a, 0xfe7e0889, 0x8c7635ee,
+    0x6b259e63, 0x8373f880, 0xccf592e1, 0x0a79f003, 0x63765977, 0xc0aabca7,
+    0xef0490d6, 0x325112ce, 0xc8dab665, 0xe75832e1, 0xce93ab5f, 0xcc4ade70,
+    0x9aa3c02a, 0xcad61996, 0x08f93de5, 0x6a1397a1, 0xecc4b656, 0x12698ea9,
+    0x5ca5ecd5, 0xcd571577, 0x94aeb33f, 0x5de2cb5c, 0x4154c785, 0x7a8502ac,
+    0xdeb5b015, 0x89a975ba, 0x6c579a22, 0xd6c8657a, 0xd5a9a793, 0xfe12dffd,
+    0x9ffca93d, 0xfc548d3a, 0x1dad1f25, 0x34fe9867, 0xcdcc55ab, 0x8bd54d65,
+    0x56719d01, 0x4cb05f69, 0xe555b544, 0xca9c944d, 0x59998ae5, 0xc804f3c8,
+    0xbad36bcc, 0x439ca39f, 0x777a5df3, 0x8873f453, 0x4eaf6b7e, 0x718e7eea,
+    0xe975cd0f, 0xced14fdd, 0xa6b6f921, 0xf3641fad, 0x34693845, 0x253e1854,
+    0x1185fa42, 0x2c48d904, 0x88282c96, 0x9d929882, 0x4f9b23a2, 0xbbc91eae,
+    0x3b4cb457, 0x13371c29, 0xdb6e9ec2, 0x47084caa, 0x4779cb29, 0xfb78bca9,
+    0x6afb3647, 0x44b20f68, 0xca9d2245, 0x9bf860a4, 0x05efccb3, 0x2787aede,
+    0x272f11ba, 0x2e9f88ba, 0x00ffb786, 0xe0ec2838, 0xeb2378d3, 0x42fa887f,
+    0x1c0308f6, 0xb0fcec2b, 0x482c05c3, 0x40a439e2, 0x8d616722, 0x8ecade1e,
+    0x8f75c6f6, 0x3ec513fb, 0x4f6b7a3b, 0xbda7bd54, 0x7ca9249d, 0x6091ebfe,
+    0xae31ec3b, 0x49c83ed2, 0xacce301b, 0x491c303e, 0xcdefea0e, 0x7ef6ead4,
+    0xf9fb7d7e, 0xbb7fdfb7, 0x64dfb0a0, 0x2ed463d2, 0xdcb0b405, 0xb0012c4f,
+    0x1788b704, 0x2c877143, 0xd9b71bcc, 0x784ba400, 0xfb28349d, 0x76317625,
+    0x84ad61dd, 0x76c364e2, 0x85e70813, 0x06b660a0, 0xe07f23b0, 0x53c8c7b0,
+    0xc87eeca2, 0x29a957c1, 0x2ef8ec93, 0xd73c4f25, 0x25afd870, 0x94375ec9,
+    0x99ca01bc, 0x31110cf7, 0x5527a2d8, 0x60923df9, 0x3a58213b, 0x264eb8bc,
+    0xfe76ce8e, 0x8fec24da, 0xf21f2b6b, 0x3f4b1bd2, 0x3bbdbe87, 0xc439faa7,
+    0xa7d7353f, 0x38473f75, 0xf4bae687, 0xe7e8a7ee, 0x5ed7fc10, 0x1cfdd49d,
+    0xeb9a1fe2, 0xa39fbad3, 0x5df3439c, 0xf453777a, 0x6b7e8873, 0x1c4d19ae,
+    0x8c2a6580, 0x97773ae7, 0x7731cd5a, 0x71845536, 0x3c88ed15, 0x4c924c3a,
+    0xc8738cf3, 0x43888773, 0x9730503f, 0xa55a8458, 0x6ff19661, 0xa5ba46b6,
+    0xd3eb81d5, 0xd7b1957b, 0x550b1086, 0xb920be63, 0x8152fcc0, 0x88ad5f9e,
+    0xcd4bbc3f, 0xfb283055, 0xfb9651f0, 0x7db1c7bf, 0x2c7a8df8, 0xf4afb75e,
+    0xbcb8a1b6, 0x5c346913, 0x94538bb7, 0x2b07d5a3, 0x96064cbd, 0xb9049848,
+    0x8e520eef, 0xbfa3f159, 0xd73749bf, 0xb6abb8c8, 0xc53c821e, 0x3cba9412,
+    0x47ce5c8e, 0x1b6d64c4, 0xf7d1781c, 0x964306f4, 0xac9c5c93, 0x704f37a7,
+    0xc9d4ac96, 0x8b97ec1f, 0xb358532c, 0x0c83dddb, 0xd329784b, 0xcc2b934b,
+    0x787188f8, 0xe5ed9e6e, 0xcff35809, 0x972db784, 0xdf331132, 0x35f9e2cb,
+    0x0f73b18d, 0x6531c272, 0x94035907, 0x379df8c5, 0xe44ab09d, 0x2725ccef,
+    0xe48dcd68, 0x0c63f78d, 0x76b49c63, 0xb9de10cb, 0x234bacb8, 0xea828c21,
+    0xe039f591, 0x5cf07ebb, 0x5d3ef1fd, 0xbe72c9f5, 0x21f5c846, 0x51ccaedc,
+    0x7e877564, 0x1959ec56, 0x76dec1f6, 0xce1b753f, 0x4baedfd3, 0x7a38ca0a,
+    0x732b7fab, 0xea3a8e54, 0x693b9592, 0x5cd56dc9, 0xdd334899, 0x3ded948c,
+    0xae3e61fa, 0xd3ead241, 0xbdccb24d, 0x9654ea12, 0xefb1e6c3, 0x2e91f191,
+    0x7caa6c11, 0xccc16049, 0x37fa4673, 0x6b30592d, 0x07630a01, 0xd70c4a35,
+    0x84753a54, 0xcc3bc28b, 0xef443c20, 0x0dee31f6, 0x6bd845a3, 0x9c736ae4,
+    0x623ebbb4, 0x3199798a, 0x3279b2b4, 0x7794e331, 0x3b667911, 0x111674a6,
+    0xb25e7a8a, 0x232f07e7, 0xff81068d, 0x37268400, 0x8ebfa0e0, 0x551c7d27,
+    0x0cafdbc7, 0x271c7765, 0x1b5c8f29, 0xb3b69c6a, 0x1b21934b, 0x9a4c769d,
+    0x73d67b4a, 0xbb4e3b24, 0x4dc9d714, 0xcd0e533e, 0x0e3d9a39, 0x615a3246,
+    0x2f8ff0d3, 0x86a5b429, 0x32476c3b, 0x31eabc53, 0xd1fc52e5, 0x938a8888,
+    0xe2d9a197, 0x3d82fa04, 0x7272081f, 0x074e268b, 0x68bca06d, 0x1d6ef58d,
+    0xfb62e342, 0x66e8c582, 0xad7d1e57, 0xdd4a96ea, 0x3d219b67, 0xc95a2e66,
+    0x0f316703, 0x1a9ff650, 0x6405f974, 0x15906cc2, 0x28d51c89, 0xd0d51297,
+    0x237c3259, 0xda2710e3, 0x57bca784, 0xf7f244e2, 0xcad2196a, 0x1db62175,
+    0x5caae107, 0x6c5f5bdd, 0xef087fb3, 0x5afe63cf, 0x873fe57f, 0x135fbbbe,
+    0x48b531ba, 0xb7ddadc4, 0xd6cbad7e, 0x55897604, 0xa7c5a254, 0x7284c432,
+    0xa000abaf, 0x81791b8f, 0xeade9fe5, 0x934a55e8, 0xdf37a256, 0x81aa52a3,
+    0x7bf7d715, 0xf73b60e1, 0x7cbf8dcf, 0x9f81dfe9, 0x0bebebeb, 0xb15fe9f8,
+    0xd17bd05e, 0x47a7f7a3, 0xfb27c7f8, 0x14a7be73, 0x6c17611e, 0x5e9d62e3,
+    0x84759cd4, 0xe163bad4, 0x0b9d1c4a, 0x4adb2b16, 0x45c81be6, 0x21915d27,
+    0x33113104, 0xe3601e05, 0x0f6cd2cf, 0x98d759fe, 0x9bf4f338, 0x9600ff03,
+    0x273c5d74, 0x1238871f, 0x308a93cb, 0x1b07cc63, 0x33dc1618, 0xc41d05de,
+    0xe531dd33, 0xf33898d7, 0xff039bf4, 0xd5759600, 0xc95ec2af, 0xc4cc5c0f,
+    0x43cc3931, 0xa63b6642, 0x4885c320, 0x9eee8977, 0xf4d1e9fe, 0x25d947b8,
+    0xb395339d, 0x9fc49ba7, 0xebb6834d, 0x9e155e3e, 0x71e38d53, 0x8e378a2d,
+    0x864b32ed, 0x144690fd, 0xf1ccb670, 0x4c211216, 0xcd966d9e, 0x39c45ff8,
+    0xb6842de5, 0xee2ee529, 0x7019d0e9, 0x36881fef, 0xc465540a, 0x40163878,
+    0xca4a2997, 0x81636378, 0x77a4142f, 0xbfa7bbd8, 0xcfe3605e, 0xfe0f6cd2,
+    0x3898d759, 0x039bf4f3, 0x759600ff, 0xfd3c0ee6, 0x00ffc026, 0x83799de5,
+    0xb0493f8f, 0x5667f93f, 0x71c58d70, 0x5bafb3c5, 0xbe5e6615, 0x4aa8c122,
+    0x399a9832, 0xe1421e61, 0x0d9598b2, 0xfe4e49e8, 0x364a2e31, 0xc13cda89,
+    0xd8a49fc7, 0xafb3fc1f, 0xe9e77130, 0x00ff0736, 0xfc05ea2c, 0x9280ec37,
+    0xb7088620, 0x928bb088, 0x88937b59, 0x9089173e, 0x8e62a72d, 0x9d76dae9,
+    0xbd84c374, 0x05e00c92, 0xc49c0392, 0x7ecff491, 0x0ac77246, 0x4f7bc8ef,
+    0x5bcaed29, 0x29a6d34e, 0x88ec2f9c, 0xcdfa520c, 0xc2f0e759, 0xb677576a,
+    0xa08527b0, 0xe3f17d81, 0xc7f74094, 0x5bbfba7e, 0xe6d27fbc, 0xb93ef5e9,
+    0x793e7d30, 0x7f0e688e, 0x795e8ead, 0xdfe59918, 0x5e67a27d, 0xd2cfe360,
+    0x59fe0f6c, 0xf33898d7, 0xff039bf4, 0x9f759600, 0x9aa51b9e, 0x56cd81a4,
+    0xc89a238b, 0xdb34c852, 0x924426d8, 0xe1d8b174, 0xa43bf95a, 0x5d52184c,
+    0xda1df1fc, 0x25fc548d, 0x711dad1f, 0x9b43fa37, 0xfbb553fe, 0x5c05279b,
+    0xfd328e0e, 0xc4dc36f5, 0xb8924356, 0x8a6fd915, 0xcea4eace, 0x6b2b30d2,
+    0xa530d424, 0x54a09c31, 0xaeb4791b, 0xd68c68f5, 0xffebd2ca, 0x8beb6400,
+    0x056b1ddc, 0x56b26865, 0x873ac850, 0x7c556ada, 0x0f0c020a, 0xace469c5,
+    0x19a33ac6, 0xa66abf9b, 0xd9153a3e, 0x50450947, 0x76221786, 0xd85a5620,
+    0xe2b60e30, 0x654aa7b9, 0xa26be6ea, 0x658ac553, 0xa352004c, 0xe2955810,
+    0x93f1c311, 0x55b9d8a8, 0x08475660, 0x584d133e, 0xa7161e43, 0xa18eca37,
+    0x94db3ea2, 0x57522d6a, 0xe2b2f60f, 0x63db350b, 0xbc2d1c36, 0x466d1cd6,
+    0x26ce5202, 0xa6854d8e, 0x79562167, 0xe3489ae3, 0x4acb7496, 0x4646094f,
+    0x6bcd8e78, 0x812b2d36, 0x0cd7a446, 0x342d165d, 0x15637c59, 0x1c11162b,
+    0xe6762a8e, 0x22ef3322, 0x58aa1d9d, 0x94ec459c, 0xd6aa1df1, 0xc30357db,
+    0x700d7499, 0x966250c6, 0x780b8d8e, 0x99ead7e4, 0x1479f496, 0x52324746,
+    0x7cb25a52, 0x5ec78635, 0xea483cb1, 0x13367bd6, 0x665a9f1d, 0xbec6f830,
+    0x4bbd32a5, 0x594dc923, 0xf01a5b26, 0xc5dbe489, 0x59db2109, 0xe32aca7c,
+    0xe176cdce, 0x1052a171, 0x99ba388b, 0xfc1cb47b, 0x43a106c3, 0x366b3868,
+    0xc68a92ab, 0xb0a6a42f, 0x045d56e4, 0x923d43ed, 0x1a9451c7, 0xf57294b3,
+    0x9442a262, 0xcd7182b2, 0x806a9d8c, 0xecad8a30, 0x2be41d99, 0x150b2a2d,
+    0xfa5aa8fa, 0xd8e21a93, 0xc82e5dbf, 0x45a7eda5, 0xae3300cc, 0x05858c18,
+    0x9d89b25e, 0x64493bc8, 0x3b5aa82b, 0xdff0006e, 0x9efb13cb, 0x2b00ff14,
+    0x9f967f88, 0xc0efd2fd, 0xf5f5f5cf, 0xaf74fc85, 0x3d68afd8, 0xd3fbd1e8,
+    0x9363fca3, 0x53dfb9fd, 0xa7003f8c, 0xfd8eb1fc, 0xecef02cf, 0x3cf6909b,
+    0x7bc6bbe7, 0x252e952e, 0x5c6e19b7, 0x9f1d4fb5, 0xbecaf35b, 0xf6b0cdc5,
+    0x65edf2ae, 0x5637f2d1, 0x48f68c9f, 0x9956c3a1, 0x65998dec, 0x8977e6ac,
+    0x59385cf2, 0x2b262cd1, 0xdf8aeb63, 0x3b99cb6a, 0xd9da345a, 0xcfb91381,
+    0xe1b84e3c, 0x2da3afd4, 0x39f69921, 0x582f7fad, 0xca981148, 0xeae6c052,
+    0x828bb2e4, 0x570b9381, 0x1c8bd916, 0xedf6dab1, 0x99f9e47d, 0xfb1d2bf6,
+    0x73c511e3, 0xe282deb7, 0xdf4ebbcb, 0xbe9db678, 0x89fbd3fe, 0x3f59a7f7,
+    0xff237cc5, 0x0376ee00, 0x3fbd17ea, 0xd4836bf7, 0x7e8add71, 0xacf2860f,
+    0x1d1efb81, 0xe28631dc, 0xf764d885, 0xf843ca0e, 0x8929b780, 0xbd2fd6e9,
+    0x2987b8be, 0x3c1ae28a, 0xec256f1f, 0x7275ec79, 0x5dfe66b6, 0x12541af8,
+    0x1cc922de, 0x65952c57, 0xd6eaa8b1, 0x10a1c69e, 0x4931e2f6, 0xac33076d,
+    0x13df32d6, 0x211ee3d0, 0xf114fbc6, 0xf8b3e5a8, 0x57c96edb, 0x31e56d62,
+    0xa363a836, 0x325bf030, 0x533d45e5, 0xd6cc9037, 0xe529f687, 0x6a83fcec,
+    0x1f00ff3e, 0xbf8f9851, 0x0dd9c3cb, 0x68ee3de6, 0x1f6fefdf, 0x47f1ea7f,
+    0xf95341fa, 0x9faa5137, 0xa3f5a384, 0xa52124ae, 0x83b88470, 0x59434234,
+    0x923324d2, 0x304330b3, 0x774c4c1b, 0xc674c7c4, 0xf1bbd0be, 0xbe9efc47,
+    0x47f1bbd0, 0xd0be9efc, 0xfc47f1bb, 0xbbd0be9e, 0x9efc47f1, 0xbe8bd98c,
+    0xd82bf6ea, 0x874269a7, 0xa5bdceac, 0x7dc8d9ca, 0x78608112, 0x90305fad,
+    0xa37900f5, 0xad42f56d, 0x55495e5c, 0x0989d531, 0x7baca1eb, 0x9765af09,
+    0x0009b2b5, 0x9433668e, 0x00606300, 0x2929f91e, 0x181b269e, 0xcfd0894c,
+    0xbf266eb4, 0xfcb8ba23, 0xc78e7995, 0xe5d0196c, 0x57ea502e, 0xd62130b0,
+    0x8e773943, 0x2373d641, 0x0b9a0b53, 0x24b9b579, 0x5ecd1736, 0x133559b0,
+    0x84753aa4, 0xe4aa7cda, 0x0f8c345f, 0x23ef3c3f, 0xdec4a111, 0xafbd66c5,
+    0x3e90ec2a, 0xaddf76a2, 0x447a1551, 0x3af9440e, 0x5fd0fc3c, 0xed6edbc2,
+    0xc493e0f5, 0x79450ff1, 0xe092e456, 0xad677550, 0x5352bd4a, 0xf7726b46,
+    0x86e0244a, 0x3111857c, 0x11afbcdd, 0xe995135b, 0x90fc2eab, 0x8e08c2ba,
+    0xd56af445, 0x112d48e9, 0x9348c21c, 0x44da89e7, 0x8d7739a2, 0x5839aee6,
+    0x54ac8aec, 0xbb2e3bcd, 0x848c9760, 0xd6b54a9d, 0x1854882b, 0xab5b4731,
+    0xb1fb830c, 0xbe311111, 0x068c15af, 0xebb27545, 0xab92fca2, 0x37a380a8,
+    0x29670c4c, 0x20b7f74f, 0xeaafe543, 0x289138d6, 0x981fefb4, 0x2ad84154,
+    0x8f4172e1, 0xa252660c, 0x3d698b81, 0xa1c27297, 0x70b290b3, 0x549e0288,
+    0x88954021, 0x1880d08a, 0x95613929, 0xf02d6cae, 0xd82a189b, 0x4fa7f6a9,
+    0x5ebbb1ef, 0xede7cbfd, 0xde36cd11, 0x74874cb6, 0x9944308f, 0xd0fefb74,
+    0xfc47f1bb, 0xbbd0be9e, 0x9efc47f1, 0xf1bbd0be, 0xbe9efc47, 0x47f1bbd0,
+    0xd0be9efc, 0xfc47f1bb, 0x6d55b89e, 0x5c90a959, 0x0830b841, 0xbacc370e,
+    0x89287163, 0x6362e28d, 0x7f27bebb, 0x067e97ee, 0xacafaf7f, 0x7ea5e32f,
+    0xef417bc5, 0x9dde8f46, 0x9f1ce31f, 0x9cfaceed, 0x53c68f55, 0x9af57eb3,
+    0x4abd4655, 0x1c163b89, 0xc2a09443, 0x46702585, 0x39022b72, 0x46d889e5,
+    0xf41ac967, 0x493d8a27, 0x7a0df990, 0xa41ec513, 0xbd867cc8, 0x528fe209,
+    0x5e433e64, 0xa947f184, 0xae211f32, 0x0017c01d, 0xc3d522f1, 0x5631cead,
+    0x96920f07, 0xaae5f059, 0x090c99d6, 0x84becaad, 0x590e81d6, 0x9229789e,
+    0xe1576ddb, 0x241eac8f, 0x5acfd7e8, 0x03bf45cf, 0xdba4bae4, 0xf9b8fa38,
+    0xfcec2baf, 0xb01ab190, 0xa4f93dc8, 0xa36d638a, 0xfd373a59, 0x437c338c,
+    0xb02ecc85, 0xc5ddc4df, 0x3a41eae6, 0xadf4ba93, 0x5540bdd6, 0xe69aa56e,
+    0x9c740e4c, 0xa0f71075, 0xbda7adfd, 0x9c631f22, 0x891b1fe6, 0x8715afc7,
+    0x65c350c4, 0x2b0ab5ce, 0xf572ac73, 0x661f836c, 0x7358accb, 0x75715bad,
+    0x2fb7306c, 0x841e3172, 0x32a947f1, 0x42af211f, 0x99d4a378, 0xa1d7900f,
+    0x4cea513c, 0x7f6ac887, 0x3c8a27f6, 0xd000ff93, 0xd6900f99, 0x853fe642,
+    0x56ed8238, 0x6161b863, 0xeb26b662, 0x855b4792, 0x00ac9570, 0x929169b1,
+    0x0db5844d, 0xac06f78d, 0x9821b6c0, 0x513ca1d7, 0xc8874cea, 0x27eb636a,
+    0x00ff3b8a, 0xf22113fb, 0x0f93e21a, 0xa7eaac63, 0x9c38f189, 0xf281cf5c,
+    0xe2643c6c, 0x9dc0ebf0, 0x603547da, 0x5fdc45bb, 0x73dfaa6c, 0x039b17c8,
+    0x59b10333, 0xcfb14fc2, 0xf0ec0210, 0xdcf00bdf, 0x495931be, 0xe40b4f31,
+    0xa84d9019, 0x2ccbcb0e, 0xb5e94cb6, 0x63acf27b, 0x0e9d9970, 0x9f013c49,
+    0x6fada3bc, 0x5dc7901f, 0x9eca64c1, 0x4c90194b, 0xcf46bbd7, 0x1ae08422,
+    0x0213e6b9, 0x4d815382, 0x524e6e8e, 0x7bc486a3, 0x6778e614, 0x8bc54609,
+    0x3f9682dd, 0xb30c3288, 0xa600b291, 0x277fb75b, 0x14e9b2d6, 0xa9ae6929,
+    0xd4e34a9e, 0xc42cfbe4, 0x1ec5137a, 0x867cc8a4, 0x8fe209bd, 0x433e6452,
+    0xee9c425c, 0x6d882323, 0xa156e58c, 0xa68f1a79, 0xf9e3586e, 0x80178b25,
+    0x8b178449, 0xf7db1d25, 0xf053356a, 0x75b47e94, 0x104728c4, 0x6794d266,
+    0x554ae972, 0x29b5ba94, 0x0558c84a, 0x812f60a9, 0x0422ac05, 0x46046200,
+    0x8d362222, 0xf59e4b7a, 0x9700ffbd, 0xefb9a4d7, 0x7df9df5b, 0xf59e4b7a,
+    0x9700ffbd, 0xefb9a4d7, 0x7df9df5b, 0xf59e4b7a, 0x9700ffbd, 0xefb9a4d7,
+    0x7df9df5b, 0xf59e4b7a, 0x9700ffbd, 0xefb9a4d7, 0xc6f9df5b, 0x71b498b2,
+    0x25bf12df, 0xb1c6558a, 0xaa953b4e, 0x970becd8, 0x1c5b04d9, 0x84e6a3e5,
+    0xadae180b, 0x39398b45, 0xde210237, 0x715c5b95, 0xc993a79a, 0x54a72e29,
+    0xa84e64ef, 0xa219b80d, 0xbcfd1b39, 0x412e133b, 0x52172a09, 0xa1b696da,
+    0x63889c96, 0xbbcd283a, 0x27b1b38a, 0xb58cb192, 0x11597242, 0xeca4267d,
+    0xdaa709ae, 0xca5848a4, 0x28b71776, 0xb96d98f2, 0x3b68ac6f, 0x666d338b,
+    0x275b1743, 0x884c1922, 0x4dd06e76, 0xda7bcc1e, 0xa52f662e, 0xf77294e3,
+    0x8b2f2f97, 0x9e4bfabc, 0x00ffbdf5, 0xb9a4d797, 0xf9df5bef, 0x9e4b7a7d,
+    0x00ffbdf5, 0xb9a4d797, 0xf9df5bef, 0x9e4b7a7d, 0x00ffbdf5, 0xb9a4d797,
+    0xf9df5bef, 0x9e4b7a7d, 0x00ffbdf5, 0xb9a4d797, 0xf9df5bef, 0xabbd707d,
+    0xb45cacd6, 0x2c75cfc2, 0x3c2c735a, 0xac7679fa, 0x23d2da39, 0x8080452e,
+    0x08283eef, 0x7f44778c, 0x33f0bb74, 0x617d7dfd, 0xf62b1d7f, 0x7a0fda2b,
+    0xe9f47e34, 0x7f728c9f, 0x71ea3bb7, 0x0c88ac81, 0x20e58a71, 0xec8f1229,
+    0x46212f8d, 0x76fb1ad3, 0xfc5dc6df, 0x5e8671fd, 0x64f45eae, 0xce316878,
+    0x1c878da9, 0x077651f8, 0x5ecbfb20, 0x9a4deaed, 0xb2edf1f4, 0x9a4c2895,
+    0xbeed602b, 0x5697a3da, 0x3c392977, 0x37710d8f, 0xd4a15610, 0xb63e8b9e,
+    0x72ab2a33, 0xd4a9b3b8, 0xaf3df19d, 0xd2dc1d21, 0x8e28fdda, 0x2d31de52,
+    0xd1ca9dbd, 0x4714dff0, 0x07e1e30e, 0x6c85ea2c, 0x5b59b253, 0xdfd8d87e,
+    0x90e373b2, 0x9d24473b, 0xc72d89a2, 0xe359c268, 0xe2ce302e, 0x023271af,
+    0x269e36ee, 0x19436499, 0x56dd6b8a, 0xd63c5fbe, 0x7b4541dc, 0xba1a4b2d,
+    0xbddbd598, 0x952c1315, 0x1c6bb949, 0x46b92d86, 0xdd163a59, 0xba556c56,
+    0xd2b1d6d6, 0x187a1139, 0x3825982c, 0xf34e6076, 0xeb7794e2, 0x97a5718f,
+    0x7d3e1ec9, 0xcfde388c, 0x3a8f3b63, 0x33b662d1, 0x46c1bbf7, 0xba722b72,
+    0x4060e48c, 0x6f94739c, 0xdbedebb4, 0xf377197f, 0x8bb8c3f5, 0x5331b297,
+    0xe3c59b29, 0x302ecaec, 0x5dee151d, 0x4c74774d, 0xe40c82ba, 0x2c11f264,
+    0x90690be2, 0xe5d5ee28, 0x91bd86a7, 0x904bcdea, 0xe25e088f, 0xb452ec18,
+    0xa63415dd, 0x11d1b63e, 0x152652da, 0x35b0afe7, 0x816e3faa, 0x10673ce4,
+    0xe2c6a555, 0xd4f3e3fc, 0x5bdc296a, 0x67a78b51, 0x76453512, 0x5c80cb1f,
+    0x70194bd9, 0x82129208, 0x570f59e5, 0x111e8273, 0x33e40e5f, 0x463fa316,
+    0xb54b5b8d, 0x71d59c74, 0xaee3eb13, 0x04d2139a, 0x666a437b, 0xb9aeac71,
+    0x91e53d83, 0x63242f2c, 0xae3cf8f1, 0x383bd556, 0x3e06390a, 0xb26ce9d5,
+    0xaddf6cdb, 0x142ad360, 0xa929d688, 0x32989004, 0x85199f88, 0xb6db77bf,
+    0xe7ef32fe, 0x4f1b89eb, 0xd6aa912b, 0x550d9ff1, 0xb2dd6b63, 0xc3631d96,
+    0x048d13f1, 0x524ab0c5, 0x4b584a6d, 0x418994df, 0x6b2c1e33, 0xcee29607,
+    0x64ece236, 0xf5bb3df1, 0x510a3ef1, 0x184da75d, 0xf74543eb, 0x642df632,
+    0x590c14aa, 0x44ad3993, 0x8a0a582c, 0xb84c4ceb, 0x2a5c3806, 0xec4a7671,
+    0x2b93f8e6, 0xd5ac97c3, 0xd0d461bf, 0x80da6ddc, 0x5f34e816, 0x8cade6fb,
+    0x13ded46d, 0xc4f2e599, 0x713bd116, 0x6e71278d, 0x3adcc173, 0x5dc7a318,
+    0xe591a75d, 0x78728823, 0x9822b8ca, 0x160012ed, 0x6b7be4a8, 0x7a792624,
+    0xcdd11d73, 0xe77010b7, 0x1ac7710f, 0xbce013cf, 0x3857212f, 0x981b23b5,
+    0xaf5c173c, 0xa1dbc7d3, 0xb4f1b296, 0x15ebae69, 0x0365d526, 0x81029256,
+    0x3e0e4461, 0x47f113f7, 0xb58c551a, 0xafe8b59b, 0x7bb84b06, 0x872b3a54,
+    0x2a1932be, 0xd8362922, 0xc696f97a, 0xba7d3d17, 0xbcd5597e, 0x788a1326,
+    0x174bf6da, 0x244bb190, 0x5a4d5259, 0x411bd33e, 0xa54c6dd1, 0xff73b787,
+    0x47d7df00, 0xeee5df89, 0xcb9512d7, 0x67906d76, 0x971508aa, 0xe023e4b5,
+    0x6919f6ed, 0xdf6fc414, 0x46dd7db4, 0x8f127eaa, 0x9bb88ed6, 0xffcd21fd,
+    0xfeda2900, 0x6a54c6d3, 0xab0c8da2, 0xb263e942, 0xa664dfd5, 0xd73cd4fa,
+    0x97ededb1, 0x325bd36c, 0x56c56035, 0xf3992e28, 0x6a8fd50c, 0x79aa63b4,
+    0xf14aee4a, 0x1b8cabcf, 0x15e01897, 0x3a8da662, 0xbf8daed5, 0x9e649d1b,
+    0xe50b3581, 0x11535aea, 0xc03612d0, 0xe26153e8, 0x9c65768c, 0x61389143,
+    0x53579a80, 0x12288388, 0xd9e23363, 0x2d6e3866, 0xdf88ee21, 0xdfef1bc8,
+    0x1d72ba85, 0xb9a6385b, 0x928db9a0, 0x9b65cd6e, 0xc73ddad1, 0x8cc09820,
+    0xfd72b0ed, 0x293cedcf, 0xff1057fe, 0xfb3f2d00, 0x9f81dfa5, 0x0bebebeb,
+    0xb15fe5f8, 0xd17bd05e, 0x4ca7f7a3, 0xfd9363fc, 0x8c53dfb9, 0x634a06a0,
+    0x77b42712, 0x4dbdabf8, 0x00f05e86, 0xc1fd1491, 0xc4a99f89, 0x97163ab9,
+    0x8a47295f, 0x11fd1a38, 0x4d761e93, 0x2393cf49, 0xea04cda3, 0xb40a05f3,
+    0x97041211, 0xb3e2d94a, 0x3f9fd8bf, 0xc5b3f2c3, 0x4e16d707, 0x036c29de,
+    0xb9b3543a, 0x065bb69e, 0x0e8919d1, 0xa8976b9d, 0xcc579c23, 0xdb110c02,
+    0x14c3035c, 0xe12c5532, 0x23b65178, 0xf6f520c2, 0x1df3163b, 0xe46629bf,
+    0x9b038abc, 0x8f1b3fb3, 0x8fc71461, 0xb63b9643, 0x5b96708d, 0x20c29411,
+    0x671cb831, 0x7232f10e, 0xc7785a79, 0xcb140fe0, 0x2247e121, 0x78cb54e3,
+    0x2d2414bb, 0xb2ddf1a8, 0xa7ec9acc, 0x9743f5b3, 0x59602559, 0x5b65d861,
+    0xb5ceb172, 0x557d2f23, 0xcede2297, 0x7e7b5c50, 0x418e58dd, 0x9e8113e5,
+    0x7f1ed7f8, 0xefe32afd, 0x9cfac0e4, 0xd5db7229, 0x234ea556, 0x65b3d9c2,
+    0x744d0bc7, 0x8d5d2327, 0x285e5873, 0x6632402d, 0x1323dc73, 0xece3ac33,
+    0xdff031fb, 0xec4d6211, 0x5b3b3cb0, 0x4b79338f, 0x8537d136, 0x13a76bb5,
+    0x73d39062, 0xb049cf2b, 0x7a22afae, 0x6a2feb1c, 0xe307d719, 0xbd0c69d5,
+    0xaec5314f, 0x335850b7, 0x96adba62, 0xcab1b22b, 0xb100e689, 0x8a4867d2,
+    0xb6900f22, 0xb7b34ef2, 0x60a7931d, 0x099f7ab8, 0x000c2771, 0x87bc5a34,
+    0x7ae05410, 0x44512678, 0x6b93f289, 0x6a19e365, 0x00118ce0, 0x11051d62,
+    0x1dbc5cc8, 0xe1aaed35, 0x154ce0d5, 0x0bb6c42b, 0xbf043909, 0xd82b7624,
+    0xb2e499e5, 0xac26501d, 0x89e761bc, 0x9cfaef98, 0x709dfe41, 0x131ff2c7,
+    0x7260a4ea, 0x1cc42bbc, 0x477b923d, 0x8a43388a, 0x471162ec, 0x2c7ff012,
+    0xc54cc53e, 0xd541bed4, 0xf90a3981, 0x4983192c, 0x5db10089, 0x3e03a48c,
+    0xba8b33c8, 0x96f0078f, 0xe19b315b, 0x66ca6b20, 0x3971e5d8, 0xd8a71c5e,
+    0x7caddcc9, 0x6de2a685, 0xe4f5f209, 0x00c7ad2b, 0x700a4e5e, 0x728547d8,
+    0xc41f9e59, 0x3a9c07e6, 0x1d825be1, 0x6319147d, 0xdc1426ba, 0xca15577e,
+    0x2ae6996c, 0x677aee3e, 0xfef114b7, 0xbe22d666, 0x2cdebd0e, 0x39fa62c8,
+    0xe6423ebc, 0x3254d66e, 0x6914f155, 0xb3dec7d0, 0xae60196c, 0xa5159705,
+    0x4b550457, 0x1b05a4a5, 0xb6120346, 0x8b05a781, 0x2c61d4c3, 0x0be193e0,
+    0xc49ce193, 0x7bcc4489, 0x62254b5e, 0xaadecfac, 0xeb723b31, 0x2d96dc8b,
+    0xe97666ca, 0x6231aa2d, 0xc47d32d8, 0x43221306, 0x6646723f, 0xb4f3c435,
+    0x53413ced, 0xb693fb69, 0x7b6fbf37, 0x5635eaee, 0x1f65fd7f, 0xc2671dac,
+    0xdb361bce, 0xf6c99a11, 0x5539ab86, 0xebe6634a, 0x16b5a6a5, 0x91b5a41d,
+    0x582e48c9, 0x64d801c9, 0xcce76dcb, 0xd200ff59, 0xeb417f0a, 0x00ff59cc,
+    0x417f0ad2, 0xff59cceb, 0x7f0ad200, 0x59cceb41, 0x0ad200ff, 0xcceb417f,
+    0xd200ff59, 0xe9417f0a, 0xb8854bc7, 0xe957c89a, 0xda59cdc3, 0x73970a92,
+    0xe085a1f4, 0xd359863d, 0xf199483e, 0x246f0bb9, 0x8423d2ea, 0x4a5daab8,
+    0xb8b6dcbc, 0xaf93d7cc, 0x6c0a6054, 0xe2053cb6, 0x5d8095a3, 0x8cb1715f,
+    0xd7e9b4ef, 0x94788643, 0xd462d6a9, 0xab9c23fb, 0xbf1d4b28, 0x80676c49,
+    0xb79944b9, 0xce3b338a, 0x198e95ab, 0xb48554e2, 0xdcc48ac5, 0xa21750e5,
+    0xad1c8248, 0xe43a5ef0, 0x3b0a86c0, 0xc5d019b7, 0x5be2173e, 0x58554f12,
+    0xe4d3ce20, 0xc51ab887, 0x383899ac, 0x5c5a9900, 0x112893d9, 0x98c29852,
+    0x55842200, 0x30cd1b8e, 0xa5eca4ec, 0x2bcce2a9, 0xf3741de9, 0x04e19ff5,
+    0x26840ee3, 0xc3e24cbf, 0x7905cc0a, 0x4c488702, 0x876b1768, 0x502d83b3,
+    0x89ab49d8, 0xf49076f1, 0x510b949c, 0xd521ae66, 0x41c21cdc, 0x4114a6cc,
+    0x42ec0481, 0xbc8a0251, 0x1c96c439, 0x562a6450, 0xc29ca976, 0xc0644d96,
+    0x817d0bc6, 0x785f4660, 0x1ac96746, 0xb8872b61, 0xf5958289, 0xa99e235b,
+    0x0873b530, 0x1f6c0f75, 0x0e18f370, 0x35ca4dfe, 0x00ff2ce6, 0xa03f05e9,
+    0xff2ce6f5, 0x3f05e900, 0x2ce6f5a0, 0x05e900ff, 0xe6f5a03f, 0xe900ff2c,
+    0xf5a03f05, 0x00ff2ce6, 0xa03f05e9, 0xff2ce6f5, 0x3f05e900, 0x05c3f5a0,
+    0xb48a458d, 0x24bd73e6, 0xde16b0da, 0x43561913, 0x56b4de39, 0x396fe613,
+    0x501ec98e, 0x91e60991, 0x87ee9fe6, 0xaf7f067e, 0xe32facaf, 0x7bc57e95,
+    0x8f46ef41, 0xf1339dde, 0xd7f64f8e, 0xcb29467d, 0x31e5d053, 0x5880430f,
+    0x2ba3a197, 0xdcb25c6a, 0xc804a658, 0x90481418, 0x9ac6c4cc, 0xa49cafe0,
+    0xab682e2c, 0x993d2c53, 0x0500ff3b, 0xa795aa3d, 0x63e87dc0, 0xdfe431d9,
+    0x9778796d, 0x8b3ed5d6, 0x7d8997d7, 0xbde8536d, 0xd6937879, 0xd78b3ed5,
+    0x6d3d8997, 0x7bbde853, 0xb5f525ae, 0x94f5a24f, 0x991e3e3a, 0xbcb2e0cb,
+    0x92af6b3d, 0x66a8cdac, 0x2ab70813, 0x2507c7e5, 0xa6f60888, 0x7781304f,
+    0xafc9cfca, 0xb6bec475, 0xbd5ef4a9, 0xdafa12d7, 0xf77ad1a7, 0x6aeb4b5c,
+    0xddeb459f, 0xaaad2f71, 0x75af177d, 0xa9b6bec4, 0xd7bd5ef4, 0xa7dafa12,
+    0x5cf77ad1, 0x9f6aeb4b, 0x0fdfea45, 0x05bb870f, 0xbb2ca5cc, 0xbb557266,
+    0x5aa16a47, 0x334044ed, 0xaeb0dcc1, 0x84f3f795, 0x928b64ae, 0x60068660,
+    0xeb49bcbc, 0xeb459f5a, 0xb6bec4cb, 0xbc5ef4a9, 0x6aeb4bbc, 0xcbeb459f,
+    0xa9b59ec4, 0xbcbc5ef4, 0x9f6aeb4b, 0xc4cbeb45, 0xaa85f79e, 0xe9354ffe,
+    0x100d6c18, 0xc9abe3c7, 0xda48289c, 0x759b3dc7, 0x267bd96c, 0x36c36259,
+    0xf71c668e, 0x00d78a08, 0xd51800a0, 0xfa13c25f, 0xef12d7c1, 0xd9d700ff,
+    0xb79fdb6f, 0xe35f5efd, 0xfe12d7fd, 0xffafe131, 0x836adc00, 0x3ed3eded,
+    0xb7973a13, 0x59c679db, 0x99d2d4e2, 0x5503bf3f, 0x9fe7e4ce, 0xc31d0370,
+    0x098fac11, 0x117edb8f, 0x6f2375c5, 0xe6f9cb2d, 0xb47394e3, 0x5a451073,
+    0xf93b9835, 0xb4318705, 0x63c9ea14, 0x1cbed4ef, 0x144d952f, 0x8bc86145,
+    0x56ec606b, 0x3d1b290a, 0x4c4d1fb7, 0xe78dbf31, 0x69dba6e6, 0xeac9b882,
+    0xe14c40ec, 0xd65474aa, 0xb2e6959d, 0x91c404ac, 0xab60d1b1, 0xbc47a434,
+    0x702c3dbb, 0x129200ff, 0x2de6eed9, 0x0ebf52f8, 0x45edd1f6, 0x4695c49b,
+    0x638561b8, 0xe7d556ab, 0x2ba1d2b2, 0x6551732c, 0x0268581d, 0x75660dab,
+    0x4e66fc39, 0xe0410d2f, 0xeb9ab8ea, 0xbf4778c5, 0x6ec36ea5, 0xaf2df735,
+    0x2c52fb79, 0xf2d76059, 0xc9622173, 0x52b37af7, 0xacd20cae, 0x12adfc25,
+    0xe636bbbe, 0xe5c5805a, 0xa264f2eb, 0x5a44d8c1, 0xd54955ba, 0xad2950d9,
+    0x3b7b3c7b, 0xc2a59387, 0x54451156, 0xcf2cc417, 0x2b15b261, 0xf66bdb36,
+    0xb0a8866d, 0x6f8bed26, 0xeeaec216, 0xe7e4d673, 0x2a80b6ae, 0xba1fb579,
+    0xb8f24fe1, 0xff69f987, 0xfc2edd00, 0x5f00ff10, 0xc75f585f, 0xf68efd2a,
+    0x1f8dde83, 0xe3673abd, 0xaeed9f1c, 0x098de9fe, 0x0a0a948f, 0xe39df13d,
+    0x0a783357, 0x94a993e5, 0x7a755d69, 0x857a07f2, 0x8495ccb7, 0x52fdb6be,
+    0xd29cbb5c, 0x842c89f5, 0x888977b9, 0x2d73f4e6, 0xb37f36f1, 0xbe658e5e,
+    0x6bf6cf26, 0xc4b7ccd1, 0x7acdfed9, 0x9bf89639, 0x47afd93f, 0x6713df32,
+    0x156535fb, 0xa2ec7ab8, 0xa2aca0dc, 0x4d8e06e6, 0x5edd2a2c, 0x74b2f481,
+    0x5d4d2cae, 0xc492f266, 0xe69dc74b, 0x6db6b67b, 0x6f0a66c3, 0x63560a56,
+    0x9a0bc0c1, 0x55b1346a, 0xaa489052, 0x749574a5, 0x104c55f4, 0xd7c2150a,
+    0x5fc2bd02, 0x9eb97178, 0x4bb267d7, 0x30c458de, 0x92433499, 0xc4ca6ca1,
+    0xee194902, 0x2f221120, 0xe367921d, 0xe0abda6a, 0xea5debb2, 0x76d896fd,
+    0x3a72781e, 0xf5047caa, 0x39bb7c16, 0xf962382b, 0xc73d321a, 0x8f134510,
+    0xfa19b052, 0x453e2cf9, 0x93b6b1d6, 0xf61a764e, 0x98c20ac4, 0x49623053,
+    0x716d80b2, 0x369a6a80, 0x63a003ae, 0x2f2d9e97, 0x3518780b, 0x3c14401d,
+    0x4b8a8d3f, 0xd17e63a7, 0x07cf785d, 0xfe6035f8, 0x54f2eb62, 0xcb996c19,
+    0x71cba424, 0x90cd7037, 0x8a481e90, 0xb0380a58, 0x75fc7ddb, 0x53532963,
+    0x8800ff0b, 0xe26d26c0, 0x46c472f3, 0xcb0b7e92, 0x7058a2c1, 0x06ac8963,
+    0xd1acb6e6, 0xa820dd37, 0xd9b59125, 0xbc85ab08, 0xa5b2da84, 0x129af499,
+    0x7cbe3267, 0x1dbc6c06, 0x7518275b, 0xb5da0885, 0x0ee1a2dc, 0x1bf14db0,
+    0x0def06e2, 0x4a3dfbfa, 0x32020011, 0x6f99a3d7, 0x9afdb389, 0xf12d73f4,
+    0x5eb37f36, 0x26be658e, 0xd16bf6cf, 0xd9c4b7cc, 0x397acdfe, 0x3f9bf896,
+    0x000fa8d9, 0x56fe4edf, 0x40555c5a, 0x7b4cf847, 0x1f0316c8, 0x88b54876,
+    0x67c329c1, 0x5a7f48c1, 0x3ae9f7ca, 0x6e07dbe5, 0xbc6742d7, 0x4d1fb690,
+    0xfc1c3167, 0xb31c51b2, 0x5a173a13, 0xb61e4fb1, 0x7dbb3a0f, 0x0e4eae90,
+    0xe75ae7f8, 0xdd9dbc99, 0x5f2020c7, 0x9fd792c0, 0xfe1f5f30, 0xc17c5eab,
+    0xadfa7f7c, 0xf105f379, 0xb5ea00ff, 0xc717cce7, 0xd7aa00ff, 0x1f5f309f,
+    0x7c5eabfe, 0xfa7f7cc1, 0x05f379ad, 0xea00fff1, 0x17cce7b5, 0xaa00ffc7,
+    0x5f309fd7, 0x5eabfe1f, 0x7f7cc17c, 0xf379adfa, 0x00fff105, 0xcce7b5ea,
+    0x00ffc717, 0x309fd7aa, 0xabfe1f5f, 0x7cc17c5e, 0x79adfa7f, 0xfff105f3,
+    0xe7b5ea00, 0xffc717cc, 0x9fd7aa00, 0xfe1f5f30, 0xc17c5eab, 0xadfa7f7c,
+    0xf105f379, 0xb5ea00ff, 0xc717cce7, 0xd4aa00ff, 0xfc782bcd, 0x12490c89,
+    0x3e07dba8, 0x09a53c06, 0x3fe20cd8, 0xf76570f8, 0xeabfdb76, 0xfd43f03b,
+    0x7f617d7d, 0x3bf6ab1c, 0x347a0fba, 0xdfe9f47e, 0xb67fb28c, 0x34a6fb37,
+    0x5a571bd6, 0xb78361a5, 0xabb2d36d, 0x7794a7ac, 0x3036c6db, 0x222855bc,
+    0xdddd874d, 0xbd3cc41c, 0xbfed32a3, 0xa04615e5, 0x11df4f81, 0x4464e075,
+    0x370a62f9, 0xafdfcbdb, 0x9ef89d77, 0x7b1de93f, 0xf1c4efbc, 0xeb4800ff,
+    0x277ee7dd, 0x5e47fa8f, 0x3cf13bef, 0xf73ad27f, 0xe389df79, 0xbbd791fe,
+    0x1f4ffcce, 0xdebd8ef4, 0xff78e277, 0xee75a400, 0xc713bff3, 0x77af23fd,
+    0x3f9ef89d, 0xbc7b1de9, 0xfff1c4ef, 0xddeb4800, 0x8f277ee7, 0xef5e47fa,
+    0x7f3cf13b, 0x79f73ad2, 0xfee389df, 0xcebbd791, 0xf41f4ffc, 0x77debd8e,
+    0x00ff78e2, 0xf3ee75a4, 0xfdc713bf, 0x9d77af23, 0xe93f9ef8, 0xefbc7b1d,
+    0x00fff1c4, 0xe7ddeb48, 0xfa8f277e, 0x3bef5e47, 0xd27f3cf1, 0xf730633a,
+    0x1212c30e, 0x9eb451c7, 0x315474cf, 0x0954cd1c, 0x7b4456b1, 0xce47e1e4,
+    0x5b8ab711, 0x1c9ba2ea, 0x3123e7cb, 0x590987fb, 0xc5bf90bb, 0x7f299f3e,
+    0xf2e4338b, 0x326cf7e9, 0x4c58b649, 0x17e4fe9d, 0xc0fb01b9, 0xc708b003,
+    0x46448c70, 0xe9f2babc, 0x56872854, 0x62b9b9c3, 0x42040466, 0x398c8d39,
+    0x8d0100ee, 0x18e67fca, 0x8b199892, 0xbd8eb1cc, 0x6dd0ab4f, 0xb2a9658c,
+    0xe43edb15, 0xc894ce1f, 0x0700ff49, 0xb8df2868, 0x0b8264a4, 0x9f7c79dd,
+    0x9800a1c7, 0x88812992, 0x3ba53cde, 0x3a5d7e44, 0xb340de85, 0x10d6a55f,
+    0x39593138, 0x9c047c2b, 0x2d42b278, 0xc35d3e81, 0x8c90279e, 0x51f73976,
+    0x961f77af, 0x889a5a35, 0xaa9eb621, 0xc24c96eb, 0x0370dae0, 0x50262227,
+    0xc07ecf3b, 0x2792b753, 0xdb7cf855, 0xae59b647, 0x6be85656, 0x01281cfb,
+    0x9aed5cc6, 0xe891d8b0, 0x2fc8ce10, 0xef37421a, 0xeb588b99, 0xa13e514c,
+    0x2249dac2, 0x0948c924, 0x51c084f8, 0xee716c4c, 0xf7f77b80, 0x7637bff5,
+    0xa3969b91, 0xcab8d8b1, 0xd7673020, 0xd2722d87, 0x2a9c1e22, 0xc51dcb17,
+    0xf8df920e, 0xbad7e511, 0x2b769dfe, 0xe84dae8d, 0x7335c726, 0xf1912f61,
+    0x543347b8, 0x00ffe692, 0xfb36390a, 0x9adf3ad3, 0x97d7e535, 0xe82d5d5e,
+    0x31ca2969, 0xb113d862, 0x33ee8c01, 0x00fff31f, 0xee493ecd, 0xa29c6bd5,
+    0xe3c79105, 0x8d000df2, 0xa26e5d80, 0xe25fee9c, 0xdf174926, 0xfc4ea7dc,
+    0x5d00ff10, 0xc75f585f, 0xee8efd2a, 0x1f8dde83, 0xe3773abd, 0x8ded972c,
+    0x638de9fe, 0x58b005d3, 0x63635fcb, 0x53ab39fc, 0xefdf091f, 0xcca676c0,
+    0xf52ddf47, 0xb5d3d5e5, 0xf163ea68, 0xd7657b95, 0xf4f75229, 0x4a1098f7,
+    0xa7644a84, 0x904bca94, 0xc13d60f9, 0xbba84649, 0x9d25f285, 0x2272e355,
+    0x222f24b7, 0x850920a7, 0x4d615acd, 0xcac01295, 0x723b500a, 0x379c4bf9,
+    0xd9e915ed, 0x53487b72, 0x51642dea, 0x22b799da, 0x85e5bb3b, 0xaab178bc,
+    0x2d55bb18, 0x17f9ce63, 0xa65c5f23, 0xdc8d4b05, 0x9fc71dd8, 0x3ce43da4,
+    0xbcf13de3, 0xb24e4cc4, 0xfb98ca18, 0x874959d6, 0x3e9929dc, 0xac212ccd,
+    0x518ee5f3, 0x611001ed, 0xe5efe6e4, 0x6776a28d, 0xb15cc764, 0x77667fd1,
+    0xab32274d, 0x60d16f1b, 0x471cb8ed, 0x97230a96, 0x2fabedee, 0xd3fa2e6e,
+    0xb06cb94c, 0x3301b2ab, 0x4ef3ccb0, 0x198348de, 0x37c68d92, 0xc6559def,
+    0xec4acc39, 0xae98b975, 0xa4e9785e, 0x04cfddd9, 0x7bdac13f, 0xe1c99abc,
+    0x52c872db, 0x4dee8aa4, 0x5b7585a0, 0x9a1d25db, 0xc795700b, 0xdcb34d50,
+    0x7f3ff631, 0x421da357, 0xedf4daed, 0x522eadd8, 0x18daa364, 0x1b31df63,
+    0xe58ef249, 0xf299e401, 0xca96c677, 0x0196eb98, 0x944062ad, 0xa69628a2,
+    0xe2bf9a39, 0xdfbac725, 0x5d9ebc6d, 0x7d7c953e, 0xbcab5bc7, 0x3e09ae59,
+    0x966739a2, 0x89b7b17a, 0xdddfe4df, 0x377d077f, 0xb37dac1c, 0x6d2998bc,
+    0x97754951, 0x63f2b603, 0x303e8ab7, 0xef74cff7, 0x6abc6f1b, 0xaee357ad,
+    0x21d9cd2a, 0xc34982a8, 0x875c205f, 0xa7b90dd3, 0x76d77d96, 0xb9371ed1,
+    0x8b83d7ef, 0x4a6f701d, 0x5456f1a5, 0x474cd250, 0xf847b034, 0xb9131141,
+    0x31ddf10e, 0x298d89e5, 0xf3c8075e, 0x0fe544bd, 0xb18c6766, 0x272fe6e5,
+    0xbce1dc76, 0x47e3d316, 0x788a9e76, 0x571d96fb, 0x93d6caba, 0x23ef4492,
+    0xc4dbd8ca, 0x06a2c42d, 0x2de5697c, 0x3375baa3, 0x1cbb8552, 0x74213bb6,
+    0x67cb53d2, 0x71a24f96, 0x08c8e2b6, 0xb62d9892, 0x59dbef88, 0xd76c1a85,
+    0xb499227e, 0xac274aab, 0x2ab964eb, 0x630a22b5, 0xe0ee5d92, 0xc4652eb6,
+    0x38a87bf2, 0x80c42d20, 0xcb6748a4, 0x44b13304, 0x4f1c00ff, 0xb384b076,
+    0x51ca2291, 0x553eed4c, 0x38b4b0d8, 0xa698f827, 0x16f11718, 0x103646b9,
+    0x8f18f175, 0xcca24024, 0x0f4d7e44, 0xfe63f07f, 0xe57579ed, 0xa2121ed0,
+    0x56971672, 0xda9336c9, 0x739a0da5, 0x4b5c0f02, 0xf162be98, 0x9843c480,
+    0x08f95dfc, 0xf357e320, 0x6f4edcf8, 0xf2616c84, 0xb136fb18, 0xc5a87dcf,
+    0x05e199e4, 0x7c6aa1c2, 0x6ec41cae, 0x54ef8fb6, 0x04650f82, 0xe468fb18,
+    0xdaaf89f2, 0x2c99c6d1, 0xbeae5008, 0x2c153b49, 0x24c95e00, 0xbe00ff3b,
+    0x7bbc9e0f, 0xf7e3dd88, 0x54c2e33b, 0x2cb83c61, 0x53a32dae, 0x8db58523,
+    0xd82e8eb9, 0x61d54885, 0x5c6155ca, 0x429804ac, 0x64082dcd, 0x6ab1ccaa,
+    0x569be209, 0x0efc1000, 0xb6f0a23e, 0x246b118f, 0x16b0454a, 0x55aab65b,
+    0xe17c5dc8, 0xab936884, 0x650e4b30, 0x44cbf24c, 0x5e29a3b8, 0x84a393a8,
+    0xa6ade46b, 0x3dc632ce, 0xec436f16, 0x379afafe, 0x64174e04, 0xe3914d80,
+    0x399f4873, 0x78ca649b, 0x8da32d2d, 0x23fce222, 0x656f9819, 0x54c5ab1e,
+    0x4aa8c59c, 0x27126666, 0xd4873ccf, 0xd691538e, 0x11dd632d, 0x1f11aa9b,
+    0xc4e0227a, 0x425cb246, 0x43cc0445, 0xbe399cf3, 0xb958b8f1, 0x9f4615c4,
+    0xaf719777, 0xf8bf576a, 0xb5f0b733, 0x4dcc79c7, 0x9473e405, 0x2a6af4f2,
+    0x65dbb926, 0x5fa78f4a, 0x3c20d5aa, 0x21e6e779, 0x23d35e39, 0x25e0361e,
+    0x7698a51a, 0x26e20a31, 0xd9ac7570, 0x415b7ae2, 0xade494e5, 0x96bf4a56,
+    0x9ed3701e, 0x7bd0dd43, 0x7365fd4e, 0xe52e83eb, 0xe53e06a8, 0x345c33ae,
+    0xeb53a922, 0x361603c4, 0xf0788618, 0xdc0a2144, 0x3354c8fb, 0xb2d776ee,
+    0x72d5ecab, 0xeb3d7914, 0x0720aa31, 0xce5ee404, 0x43441164, 0x17e5a603,
+    0x343e6e30, 0x6bf7fb46, 0x6070b288, 0x093b86bc, 0x2caf8a81, 0xd3c18c6d,
+    0x0eb1a05d, 0x08d5f17a, 0x01993c6c, 0xc15499d2, 0xf4f74100, 0x8b59a2c9,
+    0xab72a369, 0x1bc6d1ed, 0xcbe1ea72, 0xdcd6baa6, 0xe8041667, 0x51dda612,
+    0xc94a17c8, 0xbca9241f, 0x61362b8c, 0xf53712aa, 0xba159c62, 0x5173eef5,
+    0xdda92b53, 0x15279851, 0x97c43176, 0xb1a5c430, 0xf63938d4, 0x14769ed9,
+    0x5d5e9747, 0x2f827579, 0x2998c3bf, 0x69e4b8fc, 0xeb1f82df, 0xf80bebab,
+    0xddb15fe5, 0xa3d17bd0, 0xfc4ea7f7, 0xb1fd9265, 0xac31ddbf, 0x2cd9f81f,
+    0xb055fdd7, 0x97faedbf, 0xad98098b, 0x9f26cc8f, 0xb57d4c35, 0x1c36a709,
+    0x519fb6db, 0x802c588e, 0x233e4485, 0x8c73e319, 0xd7c316ac, 0x86b8660d,
+    0x158f3aa6, 0x6a9932a3, 0x75b2e6b1, 0x63962a8c, 0x46e1b661, 0x22ca9dc8,
+    0x08461d13, 0xb7d7f4c9, 0x73388233, 0x8db38b15, 0x72e6088f, 0x7d25493c,
+    0x0b2245ed, 0x4151c5b0, 0x126c52d9, 0x292c53f7, 0x0532e90d, 0x3bf792b2,
+    0x6f93f0cc, 0xb886bb58, 0xce1523de, 0x3961e61a, 0x16393558, 0xf215cb12,
+    0x6a7e6712, 0x2959eb9e, 0xdf395acd, 0xb2919a29, 0x8d495c4b, 0xfc8cd5da,
+    0xbb642071, 0x8ee1f332, 0x944678b6, 0x72f13d78, 0x0495ec42, 0x97320884,
+    0x28116c2c, 0x3b14ef90, 0xf758f28e, 0xae8f9d2a, 0x5866550c, 0x8575dec4,
+    0x352d3b8b, 0xfbd79ad8, 0xcc14062d, 0xa098218f, 0x08c6e43b, 0x279ec7e3,
+    0xcad3b2c7, 0xad8fbd9a, 0x65928ada, 0x5dd3e1d9, 0xfde82f25, 0xc2cc1d8e,
+    0x3e2faf8e, 0xcbcdc9d3, 0x7d50acdd, 0x00ffb7f8, 0xb84e3755, 0xfdb92253,
+    0x89bf9ff1, 0x7b39bec4, 0x2da3c0f6, 0xdfef5b12, 0x9e18d1cd, 0x3722dae8,
+    0xb57d2cfe, 0x4f909c45, 0xfb7a6718, 0xc0d084de, 0x41d41c32, 0xac21061a,
+    0x014a68b1, 0x65f4264a, 0x24bab996, 0x0aa38e4d, 0x8d148b8d, 0x5a59c9be,
+    0x53336986, 0xd3666125, 0xb431537a, 0x3c54ceca, 0xa3c52deb, 0x1324a61c,
+    0xd0793c31, 0x0a0b190b, 0x01f820f0, 0xef1a3b17, 0x16998201, 0x4ad94fee,
+    0xf34066bd, 0x152d0d92, 0xaeae4793, 0xdbb816b4, 0x29b0841d, 0x70c7dccf,
+    0xae719ce5, 0x6ab621d4, 0xbbbe1fad, 0xdb21a215, 0x8bb647dd, 0x99687e63,
+    0xd792e521, 0x6d2d2306, 0x86bfca4e, 0x6315f5b2, 0x322b87b5, 0x2a56d5bc,
+    0x1eadbced, 0x5f0533d1, 0x37f900af, 0x222e30ef, 0x1f63b8f1, 0x2323b87e,
+    0x7f9e1953, 0xcec3d94d, 0x800641e5, 0xbb931c21, 0x39c77505, 0x6d244a84,
+    0x9d08235a, 0x5cdf76f9, 0x57b27017, 0x350ef949, 0x2f5d960a, 0x9be8b164,
+    0xc3ecfd8c, 0x3eaf73df, 0xab3ba1e7, 0x4eae10a7, 0x238e8141, 0x5f5b88a3,
+    0x27c6ab95, 0xd96ae56a, 0xb23bc281, 0x6d42ab92, 0xcc9ebd35, 0x3c32a0d9,
+    0x9e0bad8f, 0x4d8f89a4, 0x8c33c09b, 0x85e718f2, 0x698bb736, 0xaee237d7,
+    0xec89abb5, 0x5bf69769, 0x312d8af0, 0x82bdaf36, 0x10417395, 0xc53ce1f8,
+    0x58a914c4, 0xf0afe468, 0x00d5171d, 0xd94dd9b3, 0xde2a5f09, 0x07a1ce05,
+    0xbfc09c84, 0x4ec19471, 0x9ebe03c4, 0xa1dd1cab, 0xccdf6a4e, 0x03d6e55c,
+    0x6f316f21, 0x05cfd33c, 0xd33c6fb9, 0x87ebbcdf, 0xee2cfc87, 0x422e3f22,
+    0xd95a6abc, 0xb26c5fe5, 0x10b82fb3, 0xe7796ae9, 0x73ea50fc, 0x3eb1f817,
+    0xdfc45b5d, 0x6c9a4d03, 0x3151ec25, 0xc24c5cd4, 0x1af2b99e, 0xb606115c,
+    0x3d51e20e, 0xaf75afd3, 0xa55ca575, 0x206dd569, 0x0761d3b9, 0x69cb6a2b,
+    0xef21e519, 0x0c6486d8, 0x1081c97d, 0xc494481c, 0x39c4add5, 0x2e6856ab,
+    0x17001bc0, 0x33031059, 0x6a42c7ca, 0xe5dc4ad7, 0x2da54fae, 0x506e4806,
+    0x1794731b, 0x6ef8e00f, 0xae98dbed, 0x0b2ba51e, 0xeecad6f6, 0x33b269b1,
+    0x4bc02224, 0x20001086, 0x0531a53b, 0x4065a8b8, 0x92a14a06, 0x51b55acd,
+    0x2e0a0432, 0x884a6e88, 0x959a9be9, 0x364cd62d, 0xc6b21382, 0x37db5397,
+    0xabda78ea, 0x8ee59c91, 0xd4b94edb, 0x0655e143, 0x7979b362, 0xd01ae0d2,
+    0x204440ab, 0xec075b7b, 0xcd8e06d0, 0xbdca3811, 0xb93547b9, 0xa15c76b4,
+    0x6a7310b0, 0x8c47dcbf, 0x1deb8aa9, 0x845558f6, 0x5fc5c742, 0xb146c428,
+    0x21921536, 0x55b90a76, 0xa4429fc4, 0xb9e43af6, 0xab202e51, 0x9475bbc8,
+    0x7191358f, 0xbfcdeff7, 0x2f79977e, 0x8d97b4e4, 0x0b94bb95, 0x417de095,
+    0x2e092167, 0x941b3f76, 0x8eef4382, 0x83b8dadd, 0xfea61cca, 0x03d77244,
+    0xd92152a1, 0x6c386810, 0x42e2d5ce, 0xf459aa61, 0x90892097, 0xdd31d58d,
+    0xf9ba39ab, 0x7727a777, 0x1520bbed, 0x90f86ce0, 0xd1abd611, 0x31ca67ec,
+    0xf6d79b1c, 0x94c3f1b2, 0x7a466dfc, 0x30a7d672, 0xa437ce25, 0xa47b9c87,
+    0x4ebe627a, 0x22e5d780, 0x8a0acb0e, 0xf42532dd, 0x4b4726b9, 0xc562960c,
+    0xbec84d98, 0x240a159f, 0x85c215db, 0xa97465c9, 0xf108e589, 0x0115b216,
+    0x305cc16e, 0x7bd5e688, 0x45d9a7f9, 0x94bdaad4, 0xd842aa9a, 0x63311994,
+    0xd2e1ba02, 0x26923298, 0xf8d6a627, 0x0038d3b0, 0x66d0f081, 0xcc3e191e,
+    0x2ac8e634, 0x08d5f3a8, 0xe3da50d8, 0x63b92a5e, 0x410d51dc, 0xfd06c1ec,
+    0xd6a20090, 0xd86ebe62, 0x5bf76e64, 0x43263db1, 0xb2c03de2, 0x647554bb,
+    0x5c311353, 0x8735103a, 0x1e0aafc5, 0x46fe3aed, 0x7cdc6de3, 0x98ed35f3,
+    0x02bd9fe6, 0x580b0223, 0x422970c7, 0xa0f8580a, 0xf7da3d02, 0xaf5af75a,
+    0x6a998a46, 0x6b0aa6e5, 0x317354d7, 0x44242f8c, 0xa4fbc87d, 0xc480b053,
+    0x4c0ccc99, 0x8c388eea, 0x2b56cc58, 0x037b8b19, 0x348a1ddc, 0x87c45e93,
+    0x01ebe5dd, 0x767f7f8f, 0xfe21f89d, 0xbfb0beba, 0x1dfb558e, 0x1abd07dd,
+    0xef747a3f, 0xdb2f59c6, 0x15d5fd1b, 0x6716bb31, 0xe9b77519, 0xf01022d5,
+    0x42297b85, 0x1c41556e, 0xeca0f688, 0x99a0b0c9, 0x5803e8f6, 0x32ee94c4,
+    0x4bf360b7, 0x6289f238, 0x7ff147ef, 0xf8e33bee, 0xb99f78e3, 0xfde533af,
+    0x35e47759, 0x8547ce5a, 0x6a5ad9f2, 0xca63ec3d, 0x59ac4aae, 0x4e8e590e,
+    0xc5e4aad0, 0x1414cc77, 0xd3c67709, 0x663a1313, 0x2777784e, 0x55143d41,
+    0xfb3845a7, 0x2b95bac6, 0x25922a8f, 0xb70557d9, 0x948a947c, 0xb08acf3b,
+    0xd13c861d, 0xef6df598, 0x339ad790, 0xf2bdad1e, 0x5f3ef31a, 0x437e97d5,
+    0x7acc685e, 0x6bc8f7b6, 0x567ff9cc, 0x790df95d, 0xdbea31a3, 0x34af21df,
+    0x7b5b3d66, 0x8ce635e4, 0xfc6eabc7, 0x98d1bc86, 0x90ef6df5, 0x70cca1d5,
+    0xa921de35, 0x4ded5564, 0x6aa392ab, 0xc82751bb, 0xa3a2af75, 0x6438a01c,
+    0x724484c5, 0xdd5c953f, 0xe2631dea, 0xb0640aaf, 0x284ddcf8, 0x2ac78ea5,
+    0x45cf469e, 0x33ecdc7c, 0x2d5775b0, 0xcb6d0b63, 0x8f283ea6, 0x30f33137,
+    0xf598d1bc, 0xd790ef6d, 0xad1e339a, 0xf31af2bb, 0xb7d56346, 0x675e43be,
+    0xefb2facb, 0x19cd6bc8, 0xf9de568f, 0x2f9f790d, 0x21bfcbea, 0xbddc39aa,
+    0x3ebc783b, 0x12b2ca1e, 0xae2aa9cb, 0x45a16abd, 0xa6a9948a, 0x278e4dc7,
+    0x382c6139, 0x4fa0981e, 0x74c61d73, 0x8695cfc6, 0x94f93e67, 0xdf00ff94,
+    0xc61313ae, 0x619172e1, 0x0d9f9819, 0xc964ab62, 0x75e55651, 0xc4b22ba6,
+    0x1944a049, 0x88b2ca21, 0xb68d81e5, 0xdca2d718, 0x4f35fa15, 0x0bc7bafd,
+    0x23857738, 0x98ab9b25, 0x70e98db5, 0x22b137d6, 0xdaa31d31, 0x390941af,
+    0xd9a97093, 0x5131740e, 0x300d7a48, 0xae35d4b5, 0xc28ff519, 0xc24793dc,
+    0x555a5f70, 0xcd1f7cf9, 0xdb77dbc9, 0xdd05cd6e, 0xe511f72d, 0x7ffd6edf,
+    0x86737864, 0x5eb38c25, 0xe1d16bba, 0xad18709c, 0x865bddbc, 0x64eaa5d7,
+    0x29047926, 0x0896490f, 0x04caf7e7, 0xe4062f37, 0xeb267c30, 0x0c3fcdad,
+    0xdef0c6b1, 0x48373b32, 0x7a9023c1, 0x9595b69e, 0x5588ed3d, 0xc8b13655,
+    0x79dad3a5, 0xc44e23b9, 0x52f00e4f, 0x4ee5959a, 0x51293c58, 0xa78bc7fc,
+    0x57acd46a, 0x5ecf5cd5, 0x7986f46a, 0x3e784ebc, 0x14f27256, 0x788267e3,
+    0x84023971, 0x0497aa74, 0x0f2b78a3, 0xf5ae8052, 0x56a52d0d, 0x6bd19c45,
+    0xfa2462a3, 0xb3c0e96b, 0xe5c4b9aa, 0x71867b78, 0xe9527bb6, 0xb1812704,
+    0xc61e26f7, 0x2e7cbff4, 0xc4124fd6, 0x8213372e, 0xcf907118, 0x99bba3d8,
+    0xee70c7c9, 0x59c42007, 0xf6d4858a, 0x54d5c63e, 0xc9c399bb, 0xc99aad0c,
+    0xb7743997, 0x37a812ae, 0x7db957c7, 0xdeb21d2f, 0x42d5e102, 0x2c1f3614,
+    0x4a08a8e0, 0xee959b0b, 0x92745c92, 0xd3ca875c, 0x2de509e5, 0x459dc58b,
+    0x14cee0d9, 0x8cce528a, 0x47d2fa5c, 0xfb779764, 0xe8e55954, 0xdaa77bcb,
+    0xa7fbf9e0, 0x9e5dbbbb, 0x96f009cf, 0xee247a34, 0x400faead, 0x346911ef,
+    0x481a0006, 0xb0de4cea, 0x5ecac5aa, 0xc45b72d6, 0xdd6a4890, 0x52b8542a,
+    0x84b68e5d, 0xc7deed5f, 0x3582eaf8, 0x2956929b, 0x7ccd2997, 0xf6b443e6,
+    0xc92b567b, 0x8984fda1, 0x2403960d, 0xd6ac5782, 0x827bb84c, 0x306b7856,
+    0x295ca482, 0x5760a953, 0xb8ae1561, 0x5c88d459, 0x3a753b52, 0xd07c2081,
+    0x9383f1e9, 0xf094bdc6, 0xf831043f, 0x6b1de2e4, 0x509df51d, 0x5a27230c,
+    0x3f8c9695, 0x46f31eb5, 0x9e611532, 0x624e1dd3, 0xe5e46a2f, 0x2cda0dd7,
+    0xf18c031f, 0x4bc76d0b, 0xef9f4eeb, 0x87625514, 0xf1fa30b4, 0x84a9ea0d,
+    0x792a5ff8, 0x9ec74740, 0xbd52e3a6, 0x530467bc, 0x0d2b64c9, 0x838f75aa,
+    0x5321cda8, 0x324a59c2, 0x9ebc2359, 0xcac1cbc0, 0x75a5e469, 0xcb905b4b,
+    0xf499404e, 0x8b2533a9, 0x3273ace0, 0x07805d92, 0x54db2983, 0xbb755a2c,
+    0xb2fd4956, 0x56a6d2b4, 0xac2c9640, 0x56f9939c, 0x015115e7, 0xb2ab5a5f,
+    0xa814deb8, 0x532f77cb, 0x98c0a388, 0x7665a59c, 0x5cbbae07, 0xa51d7ecb,
+    0x7326a9ce, 0x67af5589, 0xb9265199, 0x7713e366, 0xf885671d, 0xd3465f1e,
+    0xc3573aaa, 0x68640975, 0x7349ae64, 0x5b20b33c, 0x89900473, 0x0873cc72,
+    0x55b176cf, 0x06fcf8b1, 0x71652e1a, 0x0d3bad75, 0xd342a584, 0x78fd36eb,
+    0x03b47365, 0x77b0e82e, 0xde280812, 0x2f596326, 0xd07eeec3, 0x43f03bcd,
+    0x617d75fd, 0xf62b1cbf, 0x7a0fba3b, 0xe9f47e34, 0x5fb28cdf, 0xaafb37b6,
+    0xfd28e1a7, 0x5288eb68, 0xa5ce219e, 0xd4e5ce29, 0x9131ab94, 0xe4a5945a,
+    0xa5d4022c, 0xad059885, 0x01201061, 0x02312010, 0xf41a1131, 0x777d8897,
+    0xbdd6f993, 0x5d1fe225, 0xaf75fee4, 0xd7877849, 0x6b9d3f79, 0xf5215ed2,
+    0x5ae74fde, 0x7d8897f4, 0xd6f99377, 0x96bb6ab1, 0xcd02e4cd, 0x56c1f5ca,
+    0xac329973, 0x9b08d712, 0x235f5e1d, 0x42f3656b, 0x862a64d4, 0xd882314c,
+    0x1be39c1e, 0x4e73886f, 0xdd0a19aa, 0xf93236a9, 0x4beb2807, 0xa3065f84,
+    0xd27142b2, 0x67a49d92, 0x9afb37be, 0x39cf61cd, 0x6d5e6e9c, 0xb1d4ed65,
+    0xda8c5c39, 0xf51bf81a, 0x3e49ad68, 0xdc152cd3, 0xa0b50a0f, 0x4ac9ca33,
+    0xc6957766, 0x4ce3a8d2, 0x388636be, 0x6a5a34f2, 0x3364d365, 0x9e587187,
+    0xaf8c65df, 0x362e1675, 0x55de9ae3, 0xe245b930, 0xa6bd0547, 0xf1ebf598,
+    0x5bbe1857, 0x9b52ce4a, 0x8cc33322, 0x58430475, 0xf093d3be, 0x853c0d91,
+    0x0527c98a, 0x2065af38, 0xfc32b444, 0xce5cfc34, 0x3a87f848, 0x8ba113c2,
+    0x64ccd4ab, 0xe6d7914f, 0x39bc86c5, 0x170b14ac, 0x0f008b5a, 0x61fe12ca,
+    0x6335a2f1, 0xbbcb8b25, 0x8357812d, 0x64b34fdb, 0x119e8cdc, 0x4cbc728b,
+    0x8d8cb7da, 0x9521bae5, 0x59c6f66d, 0x293bd9c7, 0x8113d835, 0x874a7154,
+    0xcc329937, 0xbbf5bb5a, 0x73c8143e, 0x1f3f4657, 0x8e7dc4f5, 0x75b5473b,
+    0x21856a55, 0x49b86de9, 0xdb89c52b, 0x9bc13157, 0x8cf829cc, 0xd7230b16,
+    0x59e59d1c, 0x76e80c3b, 0xc2417bf0, 0x2a3c75d7, 0x2ee33031, 0x5d9ec65e,
+    0x25fd7da7, 0xe45d1fe2, 0x49af75fe, 0x79d78778, 0xd26b9d3f, 0xdef5215e,
+    0xf45ae74f, 0x777d8897, 0xbdd6f993, 0x5d1fe225, 0xaf75fee4, 0xd7877849,
+    0x6b9d3f79, 0xb5ddec85, 0x1696e566, 0xdb62a97b, 0xc9e765db, 0x9dc36a96,
+    0x726123ce, 0x9807442c, 0x460494a7, 0xfa881836, 0x63fe179c, 0xa96f7f88,
+    0x0b6a30f5, 0xec829734, 0x27f15539, 0xfa42d25e, 0x986d59ac, 0x99f915b6,
+    0x66e11ae1, 0x32bbe3a0, 0xf93a3db1, 0x0079dd02, 0x7ec0437c, 0x47ae22b5,
+    0x3ded2ba3, 0x3f1e72a6, 0xb7483b85, 0xf485d2a5, 0x75b4097c, 0x3c2f8fa6,
+    0xcff1fddd, 0x01f1fd0e, 0xa05cc792, 0x6b772a19, 0x2bc8548c, 0x3f08c91f,
+    0x99ad2f1e, 0x437b9422, 0x357d0055, 0xcbfc8a45, 0xcf1b5b6a, 0x7189672e,
+    0xb2c58a3d, 0x0e47dbca, 0x2b759b53, 0x26ef8cae, 0xcd26a679, 0x39221f85,
+    0x984a71f9, 0x9cb777ef, 0xaf82816c, 0x92a16e20, 0xb7d5398a, 0x522b7723,
+    0x61b67669, 0xae592a72, 0x44698d22, 0x420ea295, 0x9977f63b, 0x28228981,
+    0x91a7552d, 0x542f56bb, 0x9bc904a6, 0xab467fa8, 0x6905bb78, 0xc3c07a15,
+    0xae0a6003, 0x8c2d945d, 0x6592a594, 0xa3c0b901, 0x5e116aac, 0x876c4471,
+    0xdb01d328, 0xe0faf944, 0x4f0e9964, 0x470e9e1b, 0xecabbb6f, 0xffd5552b,
+    0x6b58b600, 0x827a232b, 0xcc3c4a25, 0xa398c793, 0x7c9d2f75, 0x79108fcc,
+    0x688e79c3, 0xb94585df, 0x8e5d8801, 0x2d8b272a, 0x5abb0ac4, 0x11747724,
+    0x986791f8, 0x1ddac7a3, 0x6fe351cc, 0x31ba6d3a, 0x387bf089, 0x9a379646,
+    0x33cc52ce, 0xbb5ea568, 0x558881b1, 0x2bc8fe83, 0x9eb42d22, 0xac5ba36a,
+    0xf7639031, 0x5a656929, 0xbbb02879, 0xa5884f1c, 0x35d8665e, 0x7751c52a,
+    0xdbab6c6a, 0xaa5b1708, 0x5fcc76ac, 0x7ba28b2a, 0xb3169494, 0x35aaa008,
+    0xc6266715, 0x9d45f439, 0xf356a35b, 0xb0e7562c, 0x7adabfc7, 0x6b6416d0,
+    0x02d696f4, 0x02a0b98c, 0xb7208522, 0xf499c15f, 0x9964ec64, 0xb1465f0f,
+    0x1a735cf1, 0x1568eedc, 0x435d291d, 0xa88c9468, 0xdc47e3d7, 0x6a1946d6,
+    0xe29b93ba, 0x6d0fa57c, 0x1daf0070, 0x28740c73, 0xdcc2b0bd, 0xa621d62a,
+    0x02f1427d, 0x23f11d51, 0xa62cb2ae, 0x259e8a15, 0x445d41af, 0xf1aaa6c3,
+    0x26165cf8, 0xd25c527a, 0x135b1e4e, 0xd32733ca, 0x16dec8b2, 0x51761cc9,
+    0x18a3eb96, 0x592d76cc, 0x86558b43, 0x50c612d5, 0x1a8a2b4d, 0x1ab33ecd,
+    0xa5d4cbce, 0xa10b96ca, 0x3c2f8fe9, 0xec950946, 0x53ea52d4, 0xd3fe658c,
+    0x4a19b272, 0x22c37211, 0x0ca601cb, 0xc5a38e6a, 0x375b4890, 0x1c423168,
+    0x813823d0, 0xf09526c7, 0xb2cd92af, 0x5d82e4a1, 0x751b286d, 0x5d5f93e6,
+    0x9c444a2e, 0xb9252d02, 0x9128b206, 0x89829081, 0x272cab75, 0x3dd6b258,
+    0xd7743fed, 0x65d8a434, 0x992237f7, 0xefa3ed9e, 0x1fb04644, 0xca1f318f,
+    0xfc92b535, 0x0cede73e, 0x3f04bfd3, 0x1bd657d7, 0x63bfc2f1, 0xa3f7a0bb,
+    0x9d4eef47, 0xfb25cbf8, 0x92ba7f63, 0x4de18dd9, 0xcb23265b, 0xb4050730,
+    0xfa664d7e, 0xc85de2b1, 0x6fd5c95a, 0x998a9dfc, 0xb5b41d17, 0x0d2cde45,
+    0x33ccc99b, 0x771438b7, 0xacfb6d4c, 0xd7a54b7e, 0x6bd336ec, 0x75e9d4a3,
+    0xc905277a, 0x276fe4d4, 0x7473db36, 0x67f06fcf, 0x850c8f47, 0x93c2a0e0,
+    0xc072233a, 0x829932d2, 0xc8b02ae6, 0x41341741, 0xdef74a73, 0x1ab17c22,
+    0x409967c7, 0x4d56294e, 0x3ded5277, 0x8d5136d7, 0x13e513b6, 0x6b8f9bd3,
+    0x59744c6c, 0xdce493d3, 0x5697e7f6, 0xacab5e75, 0xdb1e883b, 0x7693a31d,
+    0x67519367, 0xfd812e3d, 0x3ecbea80, 0x5ebdedc9, 0xe6e46a5f, 0x54bcc534,
+    0xc756c8d8, 0xbb363178, 0x4ca7ae74, 0x96bd8679, 0x56bd0ad1, 0xe4a2aa5b,
+    0xa0f50d59, 0xd7266aa5, 0x33c32967, 0x8925e238, 0x6ad971f5, 0x830859bd,
+    0x777d026d, 0xc69d3a26, 0x9978ad4c, 0x421ffe0b, 0xda772246, 0x89a34d72,
+    0xd5f216ec, 0x4baeb5ca, 0xadc47880, 0x786c5bac, 0x52341c3f, 0xa1867a75,
+    0x592f8385, 0x15937055, 0x2b597b04, 0x5876ad86, 0x56e4e188, 0xbfaf2b51,
+    0x3b32956f, 0x5ee50c4b, 0x82eadad3, 0xbbf210aa, 0x89820aa6, 0xc575f92d,
+    0xd2746639, 0x95aeb9cc, 0x36589d6a, 0xeedabe00, 0x89e4de16, 0x5a532b55,
+    0x03a0d265, 0x05d18636, 0xaefb2332, 0x0964a117, 0x235f9756, 0xd8288a71,
+    0x8b2c5981, 0x8fe7d5ac, 0x839944b8, 0x221a9fe5, 0x8fef7847, 0x5d1fc3a9,
+    0x349e5c19, 0xc59e79c1, 0xa2ddea18, 0x5d79051c, 0xcafb5da2, 0xc28424d7,
+    0x78c33b79, 0x785bf722, 0x2ff194be, 0xfae0bfab, 0x7d89a7f4, 0x0700ff5d,
+    0x4b3ca5d7, 0x3ef8efea, 0x5fe229bd, 0xf5c17f57, 0xfa124fe9, 0xaf0ffebb,
+    0xd597784a, 0x7a7df0df, 0xaebec453, 0xeb8300ff, 0xf5259ed2, 0x5e1ffc77,
+    0xab2ff194, 0xf4fae0bf, 0x5d7d89a7, 0xd70700ff, 0xea4b3ca5, 0xbd3ef8ef,
+    0x575fe229, 0xe9f5c17f, 0xbbfa124f, 0x4aaf0ffe, 0xdfd59778, 0x537a7df0,
+    0xffaebec4, 0xd2eb8300, 0x77f5259e, 0x945e1ffc, 0xbfab2ff1, 0xa7f4fae0,
+    0xff5d7d89, 0xa5d70700, 0xefea4b3c, 0x29bd3ef8, 0x7f575fe2, 0x2a8af5c1,
+    0x4dc44b9c, 0x793c39b6, 0x72685355, 0xda62b6a9, 0x5ed8ba66, 0x9b550e09,
+    0x9ccb04b9, 0xe6991936, 0x5fb22e1f, 0xa1fddc87, 0x87e0779a, 0x0d6be4fa,
+    0xb15fe1f8, 0xd17bd0dd, 0x4fa7f7a3, 0xfd9265fc, 0x42dd9fad, 0x53463200,
+    0x24312202, 0x02dd5344, 0x33f31d31, 0xdf11d13d, 0x8a4c5d3a, 0x9d56b630,
+    0x47b335fa, 0xf735b184, 0xef9a7edb, 0xb99f5a36, 0x7f2cc7b8, 0x7034af8b,
+    0x5bf8c547, 0x8ee635e5, 0x0bbff808, 0xd1bca67c, 0xe1171fc1, 0x9ad7946f,
+    0xfce22338, 0xf39af22d, 0x5f7c0447, 0x5e53be85, 0x8b8fe068, 0x6bcab7f0,
+    0xf1111ccd, 0x4df9167e, 0x3e82a379, 0x29dfc22f, 0x477034af, 0xe55bf8c5,
+    0x088ee635, 0x7c0bbff8, 0xc1d1bca6, 0x6fe1171f, 0x389ad794, 0x2dfce223,
+    0x47f39af2, 0x855f7c04, 0x685e53be, 0xf08b8fe0, 0xcd6bcab7, 0x7ef1111c,
+    0x794df916, 0x2f3e82a3, 0xaf29dfc2, 0xc5477034, 0x35e55bf8, 0xf8088ee6,
+    0xa67c0bbf, 0x1fc1d1bc, 0x946fe117, 0xee38b1d0, 0x7942430c, 0x85abe496,
+    0xf228ab81, 0xc59fcf12, 0xa993fb28, 0xd0256ebb, 0x0db4eff2, 0x7711a555,
+    0x9bab4b77, 0xd0b63356, 0xd11dcd21, 0xddc3c6b0, 0x00ff0bae, 0xb73fc431,
+    0x8bd5fed4, 0x75c3871a, 0x85357c92, 0x7efc147b, 0xceb16e02, 0xa4bd01c7,
+    0xb6ec7176, 0x50ee796d, 0x14396fc9, 0xebc40cf3, 0xe06b160d, 0x183e8113,
+    0x2d21bfc5, 0xc35d80ad, 0xecf9e196, 0x8c0b1934, 0xa66bdde4, 0xe7b20609,
+    0xbc13123b, 0x83b19684, 0x9f482a5d, 0xcce3700d, 0x1b54b054, 0xc7ae8a9d,
+    0x2022e038, 0x3699d39a, 0x1c767cb2, 0xffcc14c9, 0x7ec06900, 0x287fc43c,
+    0xf04bd6d6, 0x33b49ffb, 0xff10fc4e, 0x618d5c00, 0xf62b1cbf, 0x7a0fba3b,
+    0xe9f47e34, 0xf28c00ff, 0xfbb3b55f, 0x1e49eeaa, 0xaf5bc72d, 0xf7e8ac8a,
+    0xb0e96175, 0xef540dfb, 0x89d2b4e2, 0xcb789c50, 0xf1592e82, 0xefcc5ba7,
+    0x3d33df33, 0x593e33f3, 0xdafde39f, 0xb55c56ab, 0x945a38ef, 0x9719733b,
+    0xa37d6390, 0xd139fe79, 0xb48abbda, 0xa8dbeb8a, 0x0d3180d9, 0xe99368e7,
+    0xfd8ec899, 0xb11cd3dc, 0xfdf7bcdd, 0x92dcb64a, 0x5ebd7b5d, 0xe5e5d9c8,
+    0x5d84407f, 0xfbccb4c9, 0xf3c41059, 0xbf7b7944, 0xbca7d4b5, 0x84ad3c9d,
+    0x92d6aee3, 0x6d579b2e, 0x680f5e91, 0x59a266db, 0xc723530c, 0x7ba28d19,
+    0xfb564ee7, 0xefc5daf4, 0x470af9f7, 0xc2b5fa7f, 0xbec68765, 0x7056d5f8,
+    0x51654a6c, 0x445e97d2, 0xc0a80baa, 0x6d267df7, 0x77e6feb6, 0x7eb7a3d7,
+    0x6b9c5f15, 0x0abfdbd1, 0xe835ceaf, 0x5785dfed, 0x76f41ae7, 0xf3abc2ef,
+    0x773b7a8d, 0xc6f955e1, 0xf0bb1dbd, 0x5ee3fcaa, 0x55f8dd8e, 0x47af717e,
+    0xbf2afc6e, 0xb7a3d738, 0x9c5f157e, 0xe05b996a, 0x15ed229e, 0xb2317431,
+    0x84f87375, 0xb0829da1, 0x1d7407d7, 0xeac0b484, 0xfb92f372, 0x83e4ed51,
+    0xcfa8bafb, 0xecc87bad, 0x376ebcb8, 0xbc55af97, 0x35aa0ffe, 0xabf3dbba,
+    0xcfcbad97, 0x7b7adad3, 0xba9ff3f2, 0x6b7d47d5, 0xc565475d, 0xbd9cf162,
+    0xf0e7ad7a, 0xebd4356d, 0x5ebeceef, 0xd2a94fb7, 0xf27bbad8, 0x34b719f5,
+    0xe1773bfa, 0xbdc6f955, 0xaaf0bb1d, 0x8e5ee3fc, 0x7e55f8dd, 0x6e47af71,
+    0x38bf2afc, 0x7eb7a3d7, 0x6b9c5f15, 0x0abfdbd1, 0xe835ceaf, 0x5785dfed,
+    0x76f41ae7, 0xf3abc2ef, 0x3fac618d, 0xaf697103, 0xcc3dc696, 0xd4b2ad92,
+    0x4e63a89b, 0xc0ce7c76, 0x443b2503, 0x1addd1ce, 0x731f7ec9, 0xbf6986f6,
+    0x91eb9f82, 0x85e337ac, 0x4177c77e, 0xde8f46ef, 0x9ef13f9d, 0xfea3f64b,
+    0x00ff89ea, 0x7f9496f9, 0xff4959d9, 0xcb6bf000, 0xbabc2eaf, 0xafcbebf2,
+    0xc1babc2e, 0x955cfe0e, 0xaf00ff78, 0x9b3dac59, 0xdc62edb6, 0x356bf5fc,
+    0xaa6b592c, 0x47fba2ae, 0xd6485bb8, 0x31c25e91, 0x7cf180d3, 0x6b3b734f,
+    0xa070390c, 0xeba49b07, 0x33f73296, 0x28f671b5, 0x3b15ef73, 0x26b0271d,
+    0x412c47c8, 0x5b22d096, 0x20e6d6ef, 0x635e0a0e, 0xd5ae5916, 0x0641296b,
+    0x21a424bb, 0xec4a9065, 0xfd9e1e59, 0x9e3dc5a5, 0x44982b6b, 0x7098d6d7,
+    0x7f7173f7, 0xe2467d4d, 0xd4faf8b3, 0x351119ec, 0x2e252d35, 0xf2c4cc94,
+    0x494eddce, 0xf2291923, 0x58a7efcc, 0x8e9e47b3, 0xe72a832b, 0x0c5b8f1d,
+    0x0ea3653b, 0x9414ea59, 0xc9cc8c98, 0x138a8f1c, 0x781b3303, 0x62ce81b3,
+    0x3c8a5171, 0x728afb8d, 0x31b1edfa, 0x800c86d0, 0xd560f9b4, 0x3dc11cce,
+    0xdbddce25, 0x2eafcb6b, 0xebf2babc, 0xbc2eafcb, 0xfe46c0ba, 0x3f26de5c,
+    0xb7fafa2d, 0x00ff4bf8, 0xbde05a5a, 0x8843fee3, 0xafa96f7f, 0x794d7e24,
+    0xc96bf223, 0x485e931f, 0x47f29afc, 0xc8abd3e4, 0x855ab13d, 0xa26487bc,
+    0xf6ef3721, 0x54ec8941, 0xedd1d679, 0x9bdf920e, 0x905462a3, 0x82bd466b,
+    0xdcf64908, 0x2aeb5c4f, 0x5625bbb0, 0x3097a9dc, 0x4751edcd, 0x9ae065a5,
+    0x3eb7b68b, 0x6a7a6856, 0x095e4422, 0xc9c5167a, 0xe258a4b1, 0x10198c1e,
+    0x9416d611, 0x745ab82a, 0x75e824a5, 0xc55ccf9e, 0x37387bb6, 0xa3fd06b3,
+    0x565bcaa7, 0xed6615a6, 0xa453538b, 0x3a2ab6fa, 0x6dac9db9, 0xe8d5816c,
+    0x65ab9d2f, 0x5a497968, 0x57a6d67b, 0x5a09b308, 0x2639194a, 0x7dbbbbba,
+    0x1ec36077, 0xa2774d84, 0x65df65f0, 0x7a6a6b30, 0xc81cb5cb, 0xb1d65180,
+    0x2dea0dc9, 0x8cc8989b, 0xa148eaa6, 0x4dd9950e, 0x3d19a077, 0xab80d932,
+    0x12a8ab50, 0xf48698ee, 0xbf272eac, 0x58bbe394, 0xe6c6d075, 0x8f2f6bdf,
+    0x79d6821c, 0xa3c26cac, 0xa3495bb4, 0xf5c4e168, 0xb2a49267, 0x4754d41d,
+    0xe512dd36, 0x0dde85f1, 0x16215198, 0xc7d4c9b9, 0xf5a59d92, 0x4ff07551,
+    0x8149af19, 0x55f8fafd, 0x9b952851, 0x1621a345, 0x8235466b, 0xd60a6efa,
+    0x4084b201, 0x9af26ed9, 0x6bb1c7e0, 0x12038b7d, 0xda5c9175, 0xdaf62bdb,
+    0xdaf8c5e2, 0xedb14c6e, 0xa16c091a, 0x20000eb6, 0x1a852c1c, 0xb2a108b9,
+    0x5a84b0c5, 0x6f95b930, 0xef51ce12, 0x263f92d7, 0x35f991bc, 0xafc98fe4,
+    0x794d7e24, 0x016bf223, 0xc47c1edd, 0xd1fecf7d, 0xe197acad, 0x66683ff7,
+    0xfe29f89b, 0x7ec31ab9, 0x77ec5738, 0x68f41e74, 0xffd3e9fd, 0xbfe41900,
+    0xacee3f6a, 0x6319d580, 0x593a5971, 0xd97d2c97, 0x29d70a51, 0xba0f6058,
+    0x9636af28, 0x281e6dd7, 0x1600ff77, 0xebf2babc, 0xbc2eafcb, 0xcbebf2ba,
+    0x0a3459aa, 0x0236ea98, 0x79fed6c2, 0x90fc1a49, 0xe4ac59c8, 0x2900ff7e,
+    0x1e00ff8c, 0x27beaeaf, 0x32367187, 0xe4ae626b, 0xafe27871, 0x3c9f7a91,
+    0xb2ec00d6, 0xf37aa6c3, 0x9398c2de, 0x8382c6df, 0x6a9cb4f1, 0x53718b11,
+    0xe4c62b0b, 0xe4ea53ad, 0xf6b78bb1, 0xaa63a560, 0xde99b822, 0xf71c657c,
+    0x089094f2, 0xc3b1e308, 0x46ddc18e, 0xc5ea9a30, 0x2eeba890, 0xb8746ced,
+    0xd026f52e, 0x3b475ac8, 0x4b474c41, 0x20f571c4, 0x328794cb, 0x2b3b5e6e,
+    0x9bc5d619, 0x1bd3caa9, 0x7d50fb35, 0x0493c28e, 0x392e89b5, 0xd3a00044,
+    0x5cfbb502, 0x21bc0ef2, 0xc4802b6b, 0x832f9c5d, 0x6809b37f, 0xb9c032e1,
+    0x36f97a8e, 0xa4de8f76, 0xea5826e0, 0x2437ca86, 0x1b828a2b, 0x8ec31eae,
+    0x217f014b, 0x96dbd55a, 0x67398643, 0xc4b9460d, 0xf26aadae, 0xbd908f1b,
+    0xc457cfcc, 0x38c76023, 0xe5757949, 0x5d5e97d7, 0xd7e57579, 0xd7255897,
+    0x46a6c61d, 0x26db4aa6, 0x387a5d76, 0x69b50aeb, 0x01ee39ed, 0x6694af85,
+    0xb0a6a57b, 0xc19e16fe, 0x4c732cf7, 0x2839e27d, 0x75aa00ff, 0x38e67fc1,
+    0x9ffaf687, 0x205b67ba, 0xa79555ec, 0xb2bc8bab, 0x4a725a30, 0xa55d896a,
+    0x252c5b89, 0x0374b844, 0xb169cad1, 0x9f9e32d1, 0x3255b13e, 0xb7909596,
+    0xf1e4c691, 0xac92439c, 0x31adce1d, 0xe364b116, 0xd92d2685, 0xb13495c7,
+    0x9267a496, 0xe74802bc, 0x7eae3ca3, 0x2116e54a, 0x4d76f3d6, 0xb9ba554c,
+    0x83dd54ac, 0xea2d2c21, 0xb6632546, 0x76d18178, 0x01f551c8, 0xba9c8589,
+    0x9f202342, 0xab2285ec, 0x7cee02cf, 0xbae0d879, 0x98a54e58, 0x3bbd78e9,
+    0xd31b62c9, 0x2682ecea, 0x6c79148c, 0x72426657, 0x15e2602e, 0xd49c3960,
+    0x646e5357, 0x8a60fce6, 0x6a43a956, 0x372db452, 0x9c7b3b79, 0xd4bde475,
+    0x052c4259, 0x04cc29b4, 0x23375fd9, 0x6ded05d5, 0x8e133818, 0x0866da71,
+    0x89778660, 0x5a846bf2, 0x8f174256, 0x856b95c2, 0xf587ecb1, 0x2fd3c5f2,
+    0x579e7913, 0x684e7ca6, 0xcbbfe3f1, 0xd84668b6, 0xf882bf94, 0x365a175b,
+    0x946e8f67, 0x51e5cae0, 0x25a53bf1, 0x3697d45e, 0xca853cc1, 0xd9efb845,
+    0x041273d1, 0x1d9b989b, 0x35679d6c, 0xdcad9f26, 0xbfb61745, 0xf4bab92a,
+    0xcd6ad12c, 0x0ebab433, 0x1a313325, 0x2d6e31ab, 0xeb79c23f, 0xd9cf2e4f,
+    0xa46dbb39, 0x51cdec1a, 0x5ab92a26, 0x964aea10, 0xc4fdf4d6, 0x3f136d99,
+    0x3c7ec0b9, 0xd6287fc4, 0xfbf04bd6, 0x4d33b49f, 0x00ff14fc, 0xbf618d5c,
+    0x3bf62b1c, 0x347a0fba, 0xffe9f47e, 0x5ff28c00, 0xaafb33b5, 0x66a4a8b1,
+    0x783f015a, 0x60008581, 0x26c43d51, 0x31433033, 0xddac3131, 0x15beac5f,
+    0xc997a931, 0x65e803d4, 0xae154490, 0xba4620b9, 0xe0d57a79, 0xba3902e4,
+    0xbf6f5849, 0x6b770c28, 0xfc169ed0, 0xa700ff99, 0x0b4fe8b5, 0x00ff4c7e,
+    0x27f4dad3, 0x7f26bf85, 0x137aede9, 0x3f93dfc2, 0x29bcf6f4, 0x2eb88663,
+    0x58dc7e95, 0x8b2787f0, 0x5778c35a, 0x3530250b, 0x0e888f32, 0x1479c799,
+    0xb7f1364f, 0x9c21d4dd, 0x16efc11d, 0x58a4bd22, 0x4617d747, 0x174a6bc5,
+    0xcdd4a121, 0x05cca3ad, 0xd85a0dde, 0x31241205, 0xb842af31, 0xfadffe57,
+    0x67fb587b, 0x21239cc1, 0xa19e4b91, 0x602eae1f, 0x526d5914, 0x889cef86,
+    0x51524dde, 0xb31c27c9, 0xf14ecc1b, 0x173c0b1d, 0x796841c2, 0xeba3b525,
+    0xda404d86, 0x2393b0e9, 0x7a46e78c, 0x41b9ed80, 0x5c406084, 0x972c3ef0,
+    0xff2b5ca1, 0x3dfd6f00, 0x57b842af, 0x7bfadffe, 0xe0e8b155, 0x6c5b11ce,
+    0xbe1b8891, 0xc863a1b8, 0xb9793aa6, 0xe55e6633, 0xcfb01173, 0xbf73df7e,
+    0x1ff09545, 0xfa168203, 0x5b055af5, 0x66a1658d, 0x6a611dca, 0x96106fd8,
+    0x30c186c2, 0x1105970c, 0x4e4c4ce3, 0xc113c497, 0x59d91f9c, 0x37c26a72,
+    0x03d52ee2, 0x205b8ce3, 0x2b4edff0, 0xd0cad413, 0xb07e4e5d, 0x82598efb,
+    0xc39b759a, 0x21570f3c, 0x2c9d1491, 0x7abafe7b, 0x33508bac, 0xe5e5184a,
+    0x5cb15259, 0xd8801ee6, 0x5963e77a, 0x3306a6b7, 0x3ff059a2, 0x1081810b,
+    0x04f11018, 0x294f1810, 0xbb874709, 0x26264aa4, 0x09bdfe3e, 0x9fc96fe1,
+    0x845e7bfa, 0xcfe4b7f0, 0x42af3dfd, 0x67f25b78, 0xa1d79efe, 0x33f92d3c,
+    0x6b4f00ff, 0x18f11438, 0xde2e209c, 0x94184725, 0x7665473d, 0x1b339317,
+    0xdd66b54f, 0x75350f97, 0x16ba04f2, 0xe3c3363e, 0x41e1fa9e, 0x96111776,
+    0xca39afea, 0x39dd3559, 0xdbda2547, 0xda2d7bc2, 0xa7ce1091, 0xfbc173b6,
+    0xf1e5e580, 0xe10ebdb9, 0x3e66cc3f, 0xdca1d799, 0xc78cf927, 0x3bf43ad3,
+    0x3100ff84, 0x5667fa98, 0x78877b9f, 0xa07a954e, 0x7254d9b9, 0x6359ef76,
+    0xa90bc899, 0x444b9c49, 0x32e3c95d, 0xc1ca0ac3, 0x63fc1d0a, 0xbcceac25,
+    0xda0a8770, 0x22372557, 0x80cd52d0, 0xab0a39b9, 0x3c484eb9, 0x31275d34,
+    0x26d18d0c, 0x112c2652, 0xcdf34026, 0x1cc2e1aa, 0xa3559720, 0xf5adf47e,
+    0x8c4d82f3, 0xebc30a72, 0x532c23ae, 0x692b3ada, 0x7d90b308, 0x678ca0ac,
+    0x2ab9f16d, 0xc2c127bc, 0x58cb423c, 0xcc5688a4, 0x64039195, 0xf27d3ed3,
+    0x730bd073, 0x41b31416, 0xd8b558f5, 0x0533710f, 0x9f70a16a, 0xd86ab607,
+    0x916a7975, 0x52b2e99a, 0xf99a5cc2, 0x857ce0f2, 0x00f3b8cb, 0x316edb96,
+    0xf6ecda3d, 0x96842fb8, 0xf2578dee, 0xb2c5b274, 0xc44d55ee, 0x636a8e77,
+    0x53d64379, 0x3cb3f81b, 0xc51adfb3, 0x700967da, 0xab560671, 0x3941a06d,
+    0xae8275ae, 0xde22a558, 0x3cc7b86c, 0x7294b1b2, 0x8e24c749, 0xc6b805f3,
+    0x5cc29348, 0xc60c1e1c, 0xaabbca58, 0x9ae6de9c, 0x6ac94aec, 0xb61fcbe4,
+    0x7979bccc, 0x9d6803f9, 0xf4b73bce, 0x00ff843b, 0x67fa9831, 0x9f70875e,
+    0x4d1f33e6, 0x095e3268, 0x1e4349e0, 0x8f31a0da, 0xd8a4eee2, 0x5ee3544a,
+    0x3c0666d3, 0x25c70657, 0xfdfdbec9, 0x130e31da, 0x948816e1, 0x666bb4c0,
+    0xe41159c4, 0xc1651631, 0x88e50591, 0xf1fb1230, 0x843ff41a, 0x983100ff,
+    0x875e6bfa, 0x33e69f70, 0xd06b4d1f, 0xc6fc13ee, 0x7a9de963, 0x987fc21d,
+    0xaf337dcc, 0xf34fb843, 0x75a68f19, 0x2ee10188, 0x571e4917, 0x23e5221c,
+    0x15510d2d, 0x7235c4c4, 0xa21e7379, 0x98c379e6, 0x39a27908, 0x59bba384,
+    0x7eeec32f, 0xf037cdd0, 0x3572fd53, 0xaf70fc86, 0x3de8eed8, 0xd3fbd1e8,
+    0xf28c1fab, 0xf71fb53f, 0x13c26f55, 0x12d7c1fa, 0xf5d346c1, 0xff2e99c1,
+    0x1b79bc00, 0x00ff3306, 0x7f4ccc38, 0xb9e6fe14, 0xc9ab3164, 0x6c2b9e56,
+    0x95fb4435, 0x5d8c2bda, 0x65d66c59, 0x79b6554b, 0xf832f006, 0xf676a272,
+    0xc1acbbbf, 0x92294363, 0xad00ffb6, 0xe12218fb, 0xcb8961db, 0x7bcd09cf,
+    0x28534c2b, 0x2a1965c6, 0x5bcbfea8, 0x06e8aa2e, 0x691b424b, 0x2b3021dd,
+    0xedb53177, 0x6a89cfa8, 0x0e5cfda6, 0xe369aa5e, 0x75249d66, 0x6616f16e,
+    0x6327398e, 0xf6a46117, 0x2bc64476, 0x90131619, 0x95d6b598, 0x6d4f2584,
+    0xc79a1dba, 0xc7104511, 0x4760af50, 0x92328993, 0x47a69eb0, 0xb816d91b,
+    0x30897485, 0x967da3fd, 0x17cf833c, 0x93faf6c9, 0x50ac884b, 0x4f71e3b2,
+    0xc3319c49, 0x356a1652, 0x342cbf93, 0x5335d598, 0x6082d8b0, 0x742656cf,
+    0x586d64c4, 0x33f848b1, 0x98da761d, 0xe33964c3, 0xe63d9776, 0xffbafbc6,
+    0x22394e00, 0xe45bf3e9, 0x92575f81, 0x12997520, 0x598cdfc6, 0x3b18afdf,
+    0x9f55b377, 0x2575848b, 0x500a6788, 0xec491d0c, 0x3622a2ac, 0xa5f6a582,
+    0xb345250b, 0x9c02816d, 0x2b471077, 0x931fd531, 0x9e03931c, 0xb115177c,
+    0xf3cb60e4, 0xdc9500cb, 0x2ed2f287, 0x5b0ded69, 0x10dd3e10, 0xbb8f9013,
+    0xfe87c7f5, 0xcf6acb4d, 0x637b0506, 0x1c1b0e91, 0x41df1c50, 0x01ad3c52,
+    0x2820e1f0, 0x365c2c78, 0x35ed9059, 0x2893f361, 0x7bd9c9f6, 0xc9570c14,
+    0x6386c4d6, 0x38ae760b, 0xb633596c, 0xaf8138ba, 0x2364a04e, 0xba8d6e21,
+    0x82b2c64b, 0x22dbd9d6, 0xc891acd5, 0xd74053f0, 0x9c2ac83a, 0xeb5553c1,
+    0x7d42a86b, 0x61c12a41, 0x9b455e83, 0x506550cf, 0xf3bc0733, 0xefbc8dc7,
+    0xfe219efb, 0x3f0a8e3c, 0xbe66e8e7, 0xf09707a7, 0x33e17360, 0xd26d8af7,
+    0x687f8f28, 0x6c16f7df, 0x38cbbd36, 0xd5864adc, 0xbaab63e4, 0xc59cebd5,
+    0xd2148aca, 0x6df56180, 0xcc36c5b3, 0x36445672, 0x1089cfc1, 0x477c9b59,
+    0x9b0dc98e, 0xe008c7ec, 0xd62a565b, 0xb2245da5, 0x7d5374af, 0x176f6364,
+    0x265e2b51, 0xf3413c3b, 0xb3dcb1c9, 0xb46fab3a, 0xe4a7b258, 0x6fb3b3d8,
+    0xb566b568, 0x325765f2, 0xc39873cc, 0x2d078b9c, 0xca20caf1, 0x4c59e77b,
+    0x373bb241, 0xe4c65707, 0x0cfb162b, 0x8ba9099f, 0x3fddedc8, 0x61b9dc6d,
+    0x7d97b7e5, 0x7522e6fb, 0x85f0e485, 0x990a59aa, 0xad6a5d97, 0xae1d3e85,
+    0x137107eb, 0x55592543, 0xb6f9b2a0, 0x8db32f4c, 0x1642a2db, 0x367a052a,
+    0xa4a9a32b, 0x89ec0e33, 0xe370715b, 0xc14e6019, 0x1e2e89ef, 0xd93cf2c7,
+    0xe3e0db3c, 0xc9291925, 0xedf07e99, 0xdbb7dd7c, 0x7185bf4b, 0x8f597071,
+    0x99e285b5, 0xebae5eb3, 0xdb9edfc6, 0x6b327bc4, 0x8d1aacc0, 0x2daa0cd6,
+    0xa478b45f, 0x36eb51a0, 0x591fed69, 0x1aa8589f, 0xc3681f70, 0xb63fbee2,
+    0xaf3d2282, 0x3272d1c2, 0xfde49093, 0x5bb9cff7, 0x391309f1, 0x1f09e282,
+    0x8ab912ad, 0x32edd9fa, 0x78948d33, 0xf0d58c62, 0x66bff727, 0xf0681f1c,
+    0x10ee63b7, 0xdf1e72f1, 0xfcf0a2dd, 0xedfae7dc, 0x66dba929, 0x0e1eba64,
+    0x9b57dfb5, 0xe4a300ff, 0xfe94d4be, 0xece691f3, 0xc6fa269e, 0x7fb7a47f,
+    0xbdeac663, 0x5e81bd54, 0xa97110c7, 0xb44f4cd9, 0x85dcdbdb, 0xb4eb4eb5,
+    0x0249cca5, 0x99582c9e, 0x53ee4019, 0xfe6daf3a, 0xdb67c911, 0x1c8797c3,
+    0x19bab7ca, 0x8378cad7, 0x7d1fc7db, 0x9b4df2d4, 0xe8d6a1aa, 0x9e75d6c0,
+    0x561316cb, 0xf130bf55, 0xc54fa911, 0x4eb808e4, 0x7dab43a6, 0x25931c19,
+    0x5d82f8f5, 0xc70a2b39, 0x9ce415d0, 0x095f1482, 0xe77636ae, 0x6b93a25d,
+    0x0cae7ee2, 0x3367be63, 0xfaf8888b, 0x3efc9235, 0xd30cede7, 0xd73f057f,
+    0xc66f5823, 0xee92fdea, 0x1f8dde83, 0xf8b13abd, 0x49fb23cf, 0xc67500ff,
+    0x2b066f4c, 0xdeb52031, 0xcadc15ed, 0xf4581939, 0x3515d4c6, 0x72edd5b5,
+    0x50e2c308, 0x438a6f6a, 0x6f2e98d3, 0x377fe13f, 0x5e2bfa99, 0x6ffec27f,
+    0xbc56f433, 0xfc8500ff, 0xade867de, 0x0b00ff79, 0xd1cfbcf9, 0x17f6f35a,
+    0xa28f79f3, 0x27dce7b5, 0x451fb3e6, 0x4ed8cf6b, 0xe6b527ef, 0x76d78a3e,
+    0xbcf90b7b, 0xf35ad1c7, 0x59f313ee, 0xe7b5a28f, 0xf3e62fec, 0xcf6b451f,
+    0xe6cd4fd8, 0x9fd78a3e, 0xcc9b9fb0, 0x3faf157d, 0x98377f61, 0x785b2bfa,
+    0xdeb70b7b, 0xfe36e6e9, 0x1efed64a, 0x316f7ec2, 0xffbc56f4, 0xdefc8500,
+    0x79ade867, 0xf90b00ff, 0x5ad1cfbc, 0xf317fef3, 0xb5a29f79, 0xe62ffce7,
+    0x6a453ff3, 0x87439c3a, 0x21c6df00, 0x23ca604e, 0xe384f2ee, 0xf47e0a42,
+    0xf84f8c49, 0xf161a451, 0xb6ae535d, 0x1e579b9d, 0xddc80f22, 0x83f6e928,
+    0xa5a2df01, 0x23ebdaaf, 0x996b7a9a, 0x916492e7, 0x940f8f4e, 0x683d2997,
+    0x00ea4ab3, 0xbd7dec18, 0x99ce66ba, 0x38ebf572, 0x39ca6239, 0x2502a6c4,
+    0xb5f12d52, 0x87439c3c, 0x2985fb31, 0x7dcc04cc, 0x87c1c7cd, 0x1700ffb4,
+    0xaff37b31, 0x377fe13f, 0x5e2bfa99, 0x6ffec27f, 0xbb56f433, 0xf749d8f3,
+    0x2bfa98d7, 0x2cecd95d, 0x3ee6d17f, 0xf09fd78a, 0xfdcc9bbf, 0x613faf15,
+    0x79f8bf7b, 0xe7b5a28f, 0xb3e627dc, 0xcf6b451f, 0xf6bf4fb8, 0xd597c72c,
+    0x17f6f35a, 0xa28f79f3, 0x7087bfb5, 0x96fefd9b, 0xade47f63, 0x3067c02a,
+    0x36606a32, 0xadf29521, 0x14144859, 0x89781643, 0xe3ed0406, 0x4789c401,
+    0x8adac674, 0xb670c8ca, 0x756baf36, 0x4f8fafe3, 0x6dd9c211, 0x2e4d00c3,
+    0x8fd956d7, 0xa4a6c72a, 0x0e85d6a8, 0x22898afc, 0x17f6f399, 0xa28f79f3,
+    0x27ece7b5, 0x451ff3e6, 0x4fd8cf6b, 0x8a3ee6cd, 0xbdb09fd7, 0xc73cfcdf,
+    0xfef35ad1, 0x9f79f317, 0xfce7b5a2, 0x3ff3e62f, 0xf8cf6b45, 0x7ee6cd5f,
+    0x6c65d08a, 0x265b5e5f, 0x7a85e68d, 0xd5e87aa8, 0xbb45db76, 0x36a5b80c,
+    0x32bf15c3, 0xc482b412, 0xbbcc08c6, 0x668a64a0, 0x99796766, 0xf29999ef,
+    0x99ddcfcc, 0x3f057fd3, 0x6f58a3d6, 0x92fdeac6, 0x8dde83e6, 0xb13abd1f,
+    0xfb23cff8, 0x534efd49, 0xee7f3699, 0xfd90b4d7, 0x8879cbdd, 0x9a677a1f,
+    0x6e23de77, 0xfea97dfd, 0x7d9dfabf, 0xfabffea7, 0xfea77d9d, 0x7d9dfabf,
+    0xfabffea7, 0xfea77d9d, 0x7d9dfabf, 0xfabffea7, 0xfea77d9d, 0x7d9dfabf,
+    0xfabffea7, 0xfea77d9d, 0x7d9dfabf, 0xfabffea7, 0xfea77d9d, 0x7d9dfabf,
+    0xfabffea7, 0xfea77d9d, 0x7d9dfabf, 0xfabffea7, 0xfea77d9d, 0x7d9dfabf,
+    0xfabffea7, 0xfea77d9d, 0x7d9dfabf, 0xfabffea7, 0xfea77d9d, 0x7d9dfabf,
+    0xfabffea7, 0xfea77d9d, 0x7d9dfabf, 0xfabffea7, 0xffa77d9d, 0xd41fdf00,
+    0xc1f900ff, 0xeb9f82bf, 0xe337ac51, 0x73c97e75, 0x8f46ef41, 0xfc599dde,
+    0xa4fd9169, 0xbc6dd7b4, 0xfeb1788c, 0xef084c39, 0x9d89eee4, 0xc4dcbfcb,
+    0x9d32a2ed, 0xa748a6c8, 0xccf7ccef, 0x5a7400ff, 0xba847dbf, 0xe8640534,
+    0xb167dd5e, 0xc98a20c5, 0xc59dbbdf, 0x704fe313, 0xdf4f9108, 0x0e5cc5d4,
+    0xedbc1528, 0xc6e5e616, 0xdece00ff, 0xf7b98fd4, 0xc9df3620, 0x3ee032af,
+    0x0de9732b, 0xf1019779, 0x6b489f5b, 0x8a0fb8cc, 0x5e43fadc, 0x567cc065,
+    0xf31ad2e7, 0xb7e2032e, 0x99d7903e, 0xb9151f70, 0xcbbc86f4, 0xcfadf880,
+    0x5ce635a4, 0x7d6ec507, 0xe032af21, 0xe9732b3e, 0x0197790d, 0x489f5bf1,
+    0x0fb8cc6b, 0x43fadc8a, 0x7cc0655e, 0x1ad2e756, 0xe2032ef3, 0xd7903eb7,
+    0x151f7099, 0xbc86f4b9, 0xadf880cb, 0xe635a4cf, 0x6ec5075c, 0x32af217d,
+    0x732b3ee0, 0x97790de9, 0x9f5bf101, 0xb8cc6b48, 0xfadc8a0f, 0xc0655e43,
+    0xd2e7567c, 0xd4ab721a, 0x0a4d76f0, 0xda4aa16d, 0x95bcd6c7, 0x50853b47,
+    0x0b9bd8dd, 0x1217cc1d, 0x3e246260, 0x4620b95d, 0x22a68824, 0x99792322,
+    0x8888e89e, 0xc8fdccf2, 0x355d51d1, 0xf109f264, 0xc6b2586e, 0x6fbb34c5,
+    0xa074bd1e, 0x17e94ed6, 0x071bc788, 0x8de41973, 0xd8ccbba7, 0x3ee4cc2f,
+    0xb099d792, 0x7dc8995f, 0x6033af25, 0xfa9033bf, 0xc1665e4b, 0xf421677e,
+    0x82cdbc96, 0xe943cefc, 0x059b792d, 0xd2879cf9, 0x0b36f35a, 0xa40f39f3,
+    0x176ce6b5, 0x491f72e6, 0x2fd8cc6b, 0x923ee4cc, 0x5fb099d7, 0x257dc899,
+    0xbf6033af, 0x4bfa9033, 0x7ec1665e, 0x96f42167, 0xfc82cdbc, 0x2de943ce,
+    0xf9059b79, 0x5ad2879c, 0xf30b36f3, 0xb5a40f39, 0xe6176ce6, 0x6b491f72,
+    0xcc2fd8cc, 0xd7923ee4, 0x995fb099, 0xaf257dc8, 0x33bf6033, 0x5e4bfa90,
+    0x677ec166, 0xbd96f421, 0x208509b3, 0x7d03b0fb, 0xacf8b747, 0x9fe5cced,
+    0xb59de5e3, 0x1a644c19, 0xf6ec0ed3, 0x8cbab0e9, 0x701ef2a4, 0xd656bed9,
+    0x98f4c468, 0xf2b82570, 0x0ddd8d97, 0x00ff18fc, 0xbf619d5a, 0x4bf6ab1b,
+    0x347a0f9a, 0xcfeaf47e, 0xed8f4ce3, 0x36fea925, 0xf4fdfe2f, 0xd9dd56fb,
+    0x3b11d3a8, 0xfd9cdb2e, 0x945479b2, 0x7be778af, 0x990878cb, 0x32838881,
+    0xe569839d, 0x82c30e56, 0xcb8fa13b, 0xe37f984a, 0xaea12a10, 0x0cec7e26,
+    0x78f41aed, 0x98df76bd, 0xf5e2d1eb, 0xaf637edb, 0x6dd78b47, 0x1ebd8ef9,
+    0xe6b75d2f, 0xbd78f43a, 0xeb98df76, 0xdbf5e2d1, 0x47af637e, 0xf96dd78b,
+    0x2f1ebd8e, 0x3ae6b75d, 0x76bd78f4, 0xd1eb98df, 0x7edbf5e2, 0x8b47af63,
+    0x8ef96dd7, 0x5d2f1ebd, 0xf43ae6b7, 0xdf76bd78, 0xe2d1eb98, 0x637edbf5,
+    0xd78b47af, 0xbd8ef96d, 0xb75d2f1e, 0x78f43ae6, 0x98df76bd, 0xf5e2d1eb,
+    0xaf637edb, 0x6dd78b47, 0x1ebd8ef9, 0xe6b75d2f, 0x8563603a, 0x4cadafd4,
+    0xc8de6374, 0xa19616b2, 0xf1c83ee6, 0x04b03e10, 0x1318ca19, 0x73e58d2c,
+    0x37f51310, 0x889fdb89, 0x8c7f01aa, 0x71be8d31, 0x4350fc13, 0xfac6ef05,
+    0xef68ebf2, 0xdf47f299, 0xa71ab99f, 0x303cf9c3, 0xac685ae4, 0x1eb37c59,
+    0xb4ecca70, 0x48d69c3b, 0x234d1f01, 0xd2a8c03b, 0x754c1b62, 0x5516b95d,
+    0xaaf5dbf8, 0x443e28e0, 0x4576d972, 0xee1c7245, 0xfccf9c85, 0x4530d2a6,
+    0x02efb830, 0x2e640998, 0x14ed861b, 0x3c8d91e1, 0x425d6bad, 0x412a779a,
+    0xd1d200ac, 0x599edb09, 0x1de528e5, 0xdb7666a6, 0xe63cfd7a, 0x8cae9505,
+    0x77431bc5, 0x12b35d75, 0xb0abd57b, 0x2b90bdcc, 0x34572923, 0xd8fd4444,
+    0xccb01928, 0x211e378e, 0x6488b194, 0x962b715d, 0xe9d119ea, 0xb4f2f204,
+    0x6a00ffdc, 0xce79c24a, 0x35f7917c, 0x1b73f375, 0xa8f6f861, 0x67add06c,
+    0xb04b6da9, 0x305795de, 0x599c8e36, 0xf2166af7, 0x00ff0611, 0xd5224a74,
+    0xede2c8b2, 0xe7151f37, 0x9ea54225, 0x6331baa5, 0x9683cbdc, 0xfffe8d36,
+    0x6e3c2f00, 0x3a31cc61, 0x874fe4cc, 0xd5ed88a3, 0xa82855bf, 0x8374c320,
+    0x3af93940, 0x50ceb228, 0x285b58de, 0x11f39dbc, 0x9c1baedf, 0x7e38266e,
+    0x667765fe, 0x28ec31e6, 0xd3a5890a, 0x21c8d69e, 0xca425403, 0xb3a0c779,
+    0x948e9029, 0x0a95341f, 0x6c63c808, 0xcb5e27a3, 0x38eb64e9, 0x8edd459f,
+    0x182e6c22, 0x09e729a1, 0x91e88e91, 0xb8a7fb9d, 0x4dd56ca0, 0xd3ea05bc,
+    0x3bd4c79e, 0xb4af85f5, 0xaeaaad36, 0x9ed145cb, 0x52576497, 0x2501c121,
+    0xdfed86d4, 0x2383acdd, 0x67b78a25, 0x6bb59918, 0x35cf5a1f, 0x1a8fd3e5,
+    0x6008926c, 0xdb7e3a80, 0x1eeef2e3, 0x89769ae7, 0xfc1ab3c1, 0xe1d90655,
+    0x8e0aaeea, 0x52d62a7c, 0x689bc3f0, 0x8fdc98d2, 0x35b40a94, 0xe379e4de,
+    0x7526a27d, 0x3e5efb16, 0xaac35e87, 0xc77ed163, 0x551bf945, 0xaca9fae0,
+    0x04f2163b, 0x3ebb0fb2, 0x202f9729, 0x36734b73, 0x00fa38b2, 0xab99bea3,
+    0x4e16a469, 0x279c3cd6, 0xc8cb3155, 0x7d5032d7, 0xe89e0331, 0x79179fe6,
+    0x2707578b, 0xef38bb8d, 0xb5469607, 0x70956953, 0x72cdf2c8, 0xb5864a17,
+    0xde689e81, 0xdf91b56b, 0xb164d7ac, 0xb1e2c18b, 0x5b3d41e5, 0xbbd58aae,
+    0x6f689a45, 0x9c737f45, 0x79e7a4b9, 0xb78df28e, 0x8db3ee99, 0xacd621b7,
+    0x9d4b1251, 0x0c6362d6, 0x6967025b, 0x4ec862e5, 0xfd9e8837, 0x97d737a6,
+    0xdddf8158, 0xf8274278, 0xa757c1e3, 0xacc100ff, 0x3ff5e177, 0x5bb25e68,
+    0xb96f7fcf, 0xe5354bfb, 0x5d5e97d7, 0xd7e57579, 0x5d5d5e97, 0x06ee96b5,
+    0x162f56d8, 0x27a6565d, 0xbd31c522, 0xa11e23dd, 0x43fc7444, 0x9de21fe6,
+    0x49a790f5, 0xc838cb42, 0x3e93d22e, 0xd05ddc43, 0x62da0891, 0xf11d194e,
+    0xbc113132, 0xa31a6dc9, 0x15756d89, 0x549190ac, 0x07093c95, 0x6e97e60b,
+    0xe8e4e5d9, 0x9ab3f380, 0x1cd2c63d, 0xaa614dfe, 0xdcada2e5, 0x1232546e,
+    0x75efe3a7, 0xd669beab, 0x660326b1, 0xd2a02cb1, 0x0c3c8fe5, 0x338bbfed,
+    0xedc3383e, 0xaaa8d063, 0xcb961ab7, 0xc8c3842f, 0x1b817926, 0x36394bc1,
+    0x509e22e5, 0xf779f1e6, 0x4ebde583, 0x715351b5, 0x36bbd3a5, 0x5d5a09d9,
+    0x93d1cbcd, 0x3b99f9d8, 0x10244711, 0x343f47f2, 0x2b3a0741, 0x754bc5e4,
+    0x4164e38a, 0x81f2866d, 0x242b8f4c, 0x0a0e9663, 0x4c062626, 0x774cf17e,
+    0x2eafcbeb, 0xebf2babc, 0xbc2eafcb, 0xdf98e2ba, 0x3f053cba, 0xb19bf6f3,
+    0x7f0cfea6, 0xdfb04ead, 0x25fbd58d, 0x1abd07cd, 0x67757a3f, 0xf647a6f1,
+    0x2afdd792, 0x3afc00ff, 0x4edddd56, 0xf13f1022, 0x31ae71a0, 0xbe8bf789,
+    0xa70cad3e, 0x56afe413, 0xb0b3b4f0, 0x8982c653, 0x091405dd, 0x6eb9795a,
+    0x1ef39e1e, 0x73948020, 0xc91cc104, 0x101b4680, 0xc113cdc8, 0x6455a84f,
+    0x1e2fc908, 0x0731ed71, 0x7b8058c9, 0x04252edb, 0xc8e5412e, 0x62ab0eb6,
+    0xab5c63ac, 0x49d53ef7, 0x776c391a, 0x98557b73, 0x582ed574, 0xda3f7bf7,
+    0x523ec5e7, 0xdd4cb59d, 0x7e977a8b, 0x3255e9d2, 0x1c766c24, 0x4781357d,
+    0x0af5745b, 0x0adfac3d, 0xe444f959, 0xc74c2766, 0x20bbaae3, 0x56765903,
+    0x9345a5ee, 0xb09002d7, 0x82d84cd1, 0x954c0b01, 0xf276e78a, 0xee383eed,
+    0x57ad5ccd, 0x1e37e714, 0x9dbd45d9, 0x0f971656, 0xec5c4fba, 0x37b6760d,
+    0x584b9089, 0x31131351, 0x8fb8c6b4, 0x57b56f21, 0x3d7684bd, 0x56795e23,
+    0xcaac5630, 0xc554365c, 0x23c2b94b, 0xb96281c5, 0x7941dd4b, 0x9c357335,
+    0xeb4a95b3, 0xc68842e4, 0xfd4e6b36, 0x48460b44, 0xbeb35d1f, 0x1ccc5bf2,
+    0xbf78db46, 0xe1535877, 0xad94b9c3, 0xa0330ac4, 0xe806ac97, 0xc061399a,
+    0xb95218e9, 0x3a617207, 0xc44a4a41, 0x5f2b85a5, 0x3813cb5c, 0x6b44c6b7,
+    0x2ccdbecd, 0xa3d51caf, 0xd2297797, 0x89f1ceee, 0x6b680f28, 0xadcca927,
+    0x3d6280ba, 0x0a5b380b, 0x146dcecb, 0xaadedc62, 0x4df3fd49, 0x503a464e,
+    0xe7454817, 0x89f507d5, 0x00072250, 0x0889196f, 0x56b1f73b, 0x6553d42b,
+    0x4e12712c, 0xad92e100, 0x60e354cc, 0xa13c98a8, 0xb3b34362, 0x94367d99,
+    0xb1685239, 0xf57aa787, 0xc853032f, 0xbc0e7bdc, 0x73f1dcf4, 0x45c4b41c,
+    0xd6027472, 0xec4a0925, 0x9aa3793c, 0xfb349c67, 0x8b6dfcf8, 0x75732b55,
+    0x284fbe5c, 0x800a390f, 0x62b02dd8, 0x8115f23d, 0x728c1ba7, 0xe11343ee,
+    0xcc986364, 0xedee4977, 0x3dd0ea50, 0x744bc63a, 0xdce113f2, 0x0b4362c2,
+    0xb419f5e9, 0xbfe3c4f4, 0xf1642c55, 0xb3d32ab6, 0xdc65ba62, 0xd00e22e8,
+    0x050ccb43, 0x73acacb5, 0x95c5e213, 0x4ce28f07, 0xcbbaf873, 0xed143063,
+    0x0ee32be4, 0xda9c13b8, 0xacd631a1, 0x646e6ca7, 0xe61e41d3, 0x9ae3025b,
+    0xfe216903, 0x85bdb614, 0x25935e9a, 0x13894cb5, 0x2076025b, 0xc4249f21,
+    0x441c4cfd, 0xaa93cded, 0x9b78df3d, 0x4cef5102, 0x00ffc44c, 0x3848fd14,
+    0xd21307fe, 0x1400ff93, 0x0893170b, 0x3929fe29, 0x5ee7f711, 0xd316775d,
+    0x7fef27f7, 0x45fcb11e, 0xc7d8cc9c, 0xe17a4d5d, 0x3af8c196, 0x3ac891c5,
+    0x5a7b7f90, 0x9bd64a54, 0xba72403b, 0x537ca464, 0x71bd7b95, 0x73de0f07,
+    0x771f6b78, 0x455c392e, 0x05d9a195, 0x036c15d6, 0x9980ca5a, 0x2040e660,
+    0xc1e953bc, 0x400960b2, 0x2a7d19a0, 0xcce0d9b7, 0x70640367, 0x11f6fb18,
+    0xc891a963, 0x22215336, 0x20b151b0, 0x75e919d9, 0x89b84085, 0x2cc7e982,
+    0x19d4d86b, 0xb7b0447c, 0x47ccceb2, 0x35f6d446, 0x8258dabe, 0xee30932d,
+    0xd5168975, 0x423ed2ba, 0x55db99e5, 0x99889cd2, 0xcc45b20f, 0x6ea307d3,
+    0xb40cb13f, 0x19cf55f3, 0x07121311, 0xb3efd105, 0x89e9dd1c, 0x19d923de,
+    0x4e9390d1, 0xc5787865, 0x6d65974a, 0x26a615b9, 0x5a99a0c8, 0x3702ab62,
+    0xb0403b80, 0x19a2d8e7, 0x86be3a11, 0xed880f67, 0x215e0939, 0x232c0c39,
+    0xcb668b35, 0x55399be7, 0x8047bd2e, 0x92ccf992, 0x6c1971a8, 0xb833b04c,
+    0xc957ebe7, 0x9cdd2c9d, 0x14d11695, 0x80a6e18b, 0x17828d85, 0xe221e502,
+    0x188b44f3, 0xd1be3105, 0x4386db3d, 0xb259af88, 0x8ddf149b, 0xfbfec675,
+    0x1d584565, 0x4396a281, 0xd8a3d604, 0x2093ae98, 0x59da4f82, 0x6538cb33,
+    0x421e1217, 0x62791a8d, 0xa8c07fb1, 0xab5dd0c5, 0x54a1e988, 0x2ec650a8,
+    0x7c7f49f0, 0x73f59813, 0xdf6d90f2, 0xda39bcca, 0x8dbfca88, 0x5393f630,
+    0xaa93e9a6, 0xde644127, 0xc6b32fac, 0x841c27c6, 0xdc8b67d8, 0xc66f4c3b,
+    0x59cb0039, 0x3be5727e, 0x15c29878, 0xcda28836, 0x684729a4, 0xdbf54eae,
+    0x8a16685b, 0xdc1103f7, 0x6edb2236, 0x90ccb807, 0x0c571cc5, 0x7791a7d7,
+    0x6bc5dc42, 0xc4e2abc2, 0xd612e1f4, 0xcb40ec4e, 0xef540c12, 0xccc03c1e,
+    0x33d76ac5, 0x86b18485, 0x129e64c9, 0x9b7c2dbc, 0xbd6c7572, 0x1d3451b6,
+    0xc7c19d6e, 0x89e4125b, 0xbe710163, 0x3051c0dc, 0xb5a3c448, 0x8903f731,
+    0xd51b9932, 0x22961c18, 0x4d169b9d, 0xada6c666, 0xa8e6127a, 0xc42a9ac7,
+    0x28f71908, 0x89232622, 0x75f3e369, 0x620519e5, 0xaf890da7, 0x5445b58a,
+    0xec8aada2, 0x5494b7b4, 0xa3ebb205, 0x1849677e, 0x66aceb92, 0x78c072c7,
+    0x2a7ed582, 0xb34d8cb1, 0x785c1ac6, 0x7261c9a3, 0xba4ed135, 0x8eb555ac,
+    0x2ec98a3a, 0xae5a50c7, 0x095a9fba, 0x12253005, 0xce764722, 0x719c6009,
+    0x683a4474, 0x166baaec, 0x553d07a1, 0x8e5ba9bc, 0x04268424, 0x608cf1b6,
+    0xd6e5b5c8, 0xb9fb770c, 0x88e29f39, 0xe77b64c3, 0xebf147ef, 0x3f7df81b,
+    0xa8ac17da, 0x5fc9e4ef, 0xe200ff8e, 0x7579ddb4, 0x5e97d7e5, 0xe575795d,
+    0x355c97d7, 0x67a7b488, 0x7352506c, 0x920b6347, 0x59b6425f, 0xb518c6c6,
+    0x5b2cae95, 0x10cc0561, 0xd5f473a6, 0xcf31ccc9, 0x1cf9c6df, 0xd2176b76,
+    0x6c8f70cf, 0xa79101a6, 0x849b8cd5, 0x5c18c586, 0x11b74f3a, 0x6dab5c8f,
+    0xf87ce6d7, 0x38f6da9d, 0x43275346, 0x5e9e52a7, 0x842e832c, 0xc9702b05,
+    0xfa64689c, 0x44d2ea6d, 0xaf6e2f9c, 0x7920394c, 0x639ea3bd, 0x73cec681,
+    0x58e8e085, 0x78c860e2, 0x6324f532, 0x8b62e331, 0x89808a0a, 0x497ebd81,
+    0x39da755d, 0x6460b138, 0x49acc34a, 0x73fd7011, 0x026e9ce2, 0xb65e0dc7,
+    0xb0909156, 0xdd42bb35, 0xe62eed74, 0x2f828d38, 0xbb1cc9b1, 0x0a433107,
+    0x4b70ba79, 0x3096f1ea, 0x51705433, 0xb78e2173, 0xfb50f646, 0x7c8d4c25,
+    0x67d56b7a, 0xf8958c55, 0xd7f594ed, 0x40bebd5c, 0xe9225d96, 0xd0c2a7bb,
+    0x5371539b, 0x55f9f8c2, 0xb41212b3, 0x244bfebe, 0x3c89e327, 0xf8896c76,
+    0x77b1cdd1, 0x2eafcbeb, 0xebf2babc, 0xbc2eafcb, 0x00ffe2ba, 0x3d1ccbbb,
+    0x59ed00ff, 0xdf00ffc8, 0x4d933fcb, 0x00ff18fc, 0xbf619d5a, 0x4bf6af1b,
+    0x347a0f9a, 0xcfeaf47e, 0xed8f3ce3, 0x50faaf25, 0xb5f100ff, 0x00ffbe4c,
+    0xd97f4414, 0x5d5e2716, 0x9ec37579, 0x0c8ebf06, 0xb1b30e8e, 0x2c374ab9,
+    0xf5b51874, 0x606d9100, 0x1825c920, 0xe581bbc7, 0xa74e9e32, 0xe2014c51,
+    0xe7c31c1e, 0xe1ee36d5, 0xcb8d1f7c, 0x7c528b39, 0x62935c30, 0x9e097bad,
+    0x8867e659, 0x790b0ca6, 0xd31094c4, 0x1ff03608, 0x5572e60e, 0xac401cf2,
+    0xe98d9bf5, 0x42459bd9, 0xa4bf6b8b, 0x339bbda6, 0xd780b9db, 0x889281d4,
+    0x5090589e, 0xecd3f1cc, 0x4e95715d, 0xc835a32c, 0xf635739e, 0x7dbd71be,
+    0x025165ca, 0xb6a5dba1, 0xb8c6bbdc, 0x80372ed3, 0xdbe05faa, 0x45adb036,
+    0xd75839a2, 0x4b1a4cad, 0x1341e18e, 0x89be184e, 0xdef0964c, 0xa71ad6e2,
+    0x4bd3e60f, 0xdcc88a27, 0xbc4f6d76, 0xda19d6da, 0x7853132c, 0x64993988,
+    0xcf3b4a39, 0x57e693c4, 0xd7f63237, 0x0f9a55b2, 0xe10fd253, 0x48957654,
+    0x2dbded74, 0xaeb0d914, 0x3621e549, 0x32416c01, 0x13cf1127, 0x902d6be3,
+    0xd6756c55, 0x47d61147, 0xb3892443, 0x0952665f, 0x920be9e7, 0xe2cbf15c,
+    0xdfd13e97, 0x0c9f3add, 0x7e6295b2, 0x0d2fd61a, 0xca782659, 0x327a7b09,
+    0x36e11235, 0xe9dca9ba, 0x8cfa8b72, 0x55915777, 0x353afbfb, 0xa3c81647,
+    0x8533ee56, 0x56258d73, 0x3acd5acd, 0x1aa934a4, 0xdae56a55, 0x79b26ce9,
+    0x1386aa7a, 0x2de5d219, 0x6cbe7285, 0x73f2de33, 0x8d93ecdb, 0x58b23613,
+    0x5ae7fdd3, 0x648a4822, 0x3722bacb, 0xb8b6bd9f, 0xce9631f7, 0xc986b954,
+    0xc58dbd54, 0xe6b21bd3, 0x90b94016, 0xbc5731ba, 0x2746fa52, 0xc8ada259,
+    0xa17b4d45, 0xf048b662, 0x9cb53fa6, 0x07089e52, 0x08d3211a, 0xb22b1d26,
+    0x74f3c544, 0xb642f7c8, 0xe5688e92, 0xb384b58d, 0xf014b04b, 0x167e32fb,
+    0x77417c2b, 0x97d33810, 0xf5a1dd3d, 0xbee9212b, 0x64992a9b, 0x84e9984d,
+    0xc0f84073, 0x800e0ed1, 0xe46854ba, 0xda413cb3, 0x40c8bb66, 0x91611e2b,
+    0x98e35ecc, 0x0711a614, 0x14fe3654, 0x96896b8c, 0x65a16b35, 0xd6b7e195,
+    0xca4939b3, 0x8cc9b264, 0x5296059d, 0x35879dd1, 0x4a88e448, 0xbe024054,
+    0x8024e693, 0x318b97a3, 0xf55df0c9, 0xf61e5b78, 0xf84966d1, 0xce6595cc,
+    0x21cf922e, 0x225bc955, 0xc4c277c0, 0x782b9320, 0xc379bcf7, 0x7ca17859,
+    0xaafa15b2, 0x361fc3da, 0xd415a98b, 0x296a472d, 0x9935b092, 0x11618004,
+    0x49e02a97, 0x1796218c, 0x3b3a5c97, 0x08c5acfb, 0x80ef00ff, 0x79f096fa,
+    0x97a33310, 0xae922185, 0x006b7d58, 0x50976ace, 0xb5ed1345, 0x33d03c9b,
+    0x099118e2, 0xe56af7c4, 0x58ace322, 0x2a563b9d, 0xcf875f34, 0x9cb54543,
+    0x679f6869, 0xc13b61a7, 0x73ebc684, 0x53b07c02, 0x0bf3f41a, 0xfa249eea,
+    0x619e5e33, 0x9fc4537d, 0xccd36b46, 0x9378aa2f, 0x797acde8, 0x124ff585,
+    0x4faf197d, 0xe2a9be30, 0xe935a34f, 0x3cd517e6, 0xb666f449, 0x7ac33b8e,
+    0x8c3e89a7, 0x78c7d3d6, 0x38bd9f68, 0xfe89248e, 0x98a7d74c, 0x27f1545f,
+    0xf3f49ad1, 0x249eea0b, 0x9e5e33fa, 0xc4537d61, 0x3669469f, 0x51d8c713,
+    0xea297775, 0x0971042f, 0x0c27b572, 0x2e967259, 0x8931b644, 0x9f9128e5,
+    0xacc64421, 0xc81ef2e4, 0xb8dd4758, 0xc686adce, 0x73ae3c17, 0xa6df81e5,
+    0x3dd44a9c, 0x03c01dc3, 0xafcb771f, 0xa9be304f, 0x35a34fe2, 0xd517e6e9,
+    0x66f4493c, 0xfac23cbd, 0x8c3e89a7, 0x5f98a7d7, 0xd127f154, 0x0bf3f49a,
+    0xfa249eea, 0x619e5e33, 0x9fc4537d, 0xccd36b46, 0x9378aa2f, 0x882fcde8,
+    0x3923e52b, 0xd48b2e77, 0x774d5ba8, 0x0b45a7d3, 0x6abe656f, 0x6c0ba15d,
+    0x4083c2b4, 0xb502c134, 0x6e8990f3, 0x9ec02025, 0x81095953, 0xdc19e27d,
+    0x8d69fe67, 0x33e3100f, 0x664c2c38, 0x8b59f6c9, 0x8b91e4cd, 0xe4a2b498,
+    0x5a7bccba, 0x76ae0f45, 0x85427e3c, 0x33b025ca, 0x791b923c, 0x4b7f82fb,
+    0xaf295fb1, 0xe94f703f, 0x35e52b76, 0xfd09eee7, 0xa67cc52e, 0x3fc1fdbc,
+    0x94afd8a5, 0x27b89fd7, 0xf215bbf4, 0x04f7f39a, 0xbe6297fe, 0xe07e5e53,
+    0x57ecd29f, 0xdccf6bca, 0x8a5dfa13, 0xfb794df9, 0xb14b7f82, 0x3faf295f,
+    0x76e94f70, 0xe735e52b, 0x2efd09ee, 0xbca67cc5, 0xa53fc1fd, 0xd594afd8,
+    0x7bc95795, 0x5aaae419, 0xe6286391, 0xd5abf8b3, 0x94e3c246, 0xd546282d,
+    0x2ac4ae76, 0xba8b3b4d, 0x3114b666, 0x5ca24266, 0xfe79b2e4, 0x81f48603,
+    0x295e4509, 0x5aa5a2c5, 0x1591dfeb, 0x0a612fd5, 0xdba764c6, 0xcf4cd618,
+    0xb7dd738c, 0xf427b89f, 0x9af215bb, 0xfe04f7f3, 0x53be6297, 0x9fe07e5e,
+    0xca57ecd2, 0x13dccf6b, 0xf98a5dfa, 0x82fb794d, 0x5fb14b7f, 0x703faf29,
+    0x2b76e94f, 0x5c1035e5, 0x1feac043, 0xb8c565ba, 0xbf8f11d9, 0xf9450430,
+    0x83c04d23, 0xc342d6a2, 0x76356bd5, 0xd5184002, 0x3aa5f7af, 0xd92545d0,
+    0x5c588baa, 0x6b4c22e4, 0xe608f624, 0xc5e06f19, 0x0debd4fa, 0xb27fddf8,
+    0xd17bd05c, 0x56a7f7a3, 0x7fe4197f, 0xd27f2d69, 0x8d00ff87, 0xdd2aaeac,
+    0x1d85e3c4, 0xfd522b9f, 0x56ad9199, 0x31badce2, 0x64466416, 0x901bd96b,
+    0xab7bb696, 0x169f0ded, 0x092f5b0f, 0xeb3dd716, 0x89294fb3, 0xbfc15db1,
+    0x7a711673, 0xa3bc940b, 0xdb9e05d4, 0xd16b844c, 0xc61c3fcb, 0x5d00ff7c,
+    0x7d6235fc, 0x9fbf98fb, 0x1fbbd16b, 0xfffcc51c, 0x6d7d5b00, 0x76efdb58,
+    0xb7df5ebc, 0x1dbbd16b, 0x98df4fde, 0xd16b9fbf, 0x00fffda7, 0x3e7ff1b6,
+    0x580d7fd7, 0x2fe67e9f, 0x6ef4dae7, 0x7f31c7c7, 0x00ffd63f, 0xfb37765b,
+    0xf317b3fd, 0x67377afd, 0x9fbf98e3, 0xabad6feb, 0xd7ee7d1b, 0xa8f6f98b,
+    0xec856364, 0xaddc683a, 0xf137a76f, 0xceecd561, 0x9da57407, 0xf920f9b0,
+    0x4bb97939, 0x67f97d97, 0x5e9eacc9, 0x8bf55178, 0xc9cd7625, 0x6d316444,
+    0x9386f6e8, 0xd65e5d7a, 0x370764b9, 0x394c372f, 0x3c96dfb6, 0xc76af49a,
+    0x3e7ff1c6, 0x3e76a3d7, 0xf6f98b39, 0xb1dbfab7, 0xcf5fccf1, 0xfed3e8f5,
+    0xf6f98b37, 0x7edafab6, 0xe2b57bdf, 0x47af7dfe, 0x1773fc2c, 0x397afdf3,
+    0xcf98e367, 0x10bfea9f, 0xa3aa40f1, 0x153bf329, 0xb5280b88, 0xf1d8cd66,
+    0xd4c16253, 0xa5a6eb63, 0xdd6e9962, 0x60b56969, 0x01b13112, 0x28e1a76a,
+    0x89eb68fd, 0xdf1cd2bf, 0xddaf9df2, 0xe9d36f99, 0x8b8c7263, 0xc571ee93,
+    0x7c015d14, 0x560cdde7, 0xa6448964, 0x2f37cf0e, 0x746c5365, 0x0d5a58d6,
+    0xb5d8e6b8, 0xceeb7cc3, 0x2ef5252c, 0x53dbae59, 0xdd316e16, 0xb246613b,
+    0xd8f7e097, 0x5b5aa5b2, 0x619a8c2b, 0xc450737b, 0xea72688f, 0x5d553167,
+    0x658aabdb, 0xc6558bec, 0x4a26c2c1, 0x98cf9b26, 0xd5eff3ea, 0xdf226ba8,
+    0x378dbf9b, 0x1b557b58, 0x7d10af92, 0x8f3d63aa, 0x78f79508, 0x31320193,
+    0x328bb723, 0x65d5493e, 0x5dd52d1e, 0xca63f080, 0x9762d2f4, 0x96aa337c,
+    0x956a575f, 0x163a58c0, 0xe7f61afb, 0x60139c3e, 0x38e28d76, 0x13bbf7b1,
+    0x7a517938, 0xc65e139a, 0xbdd6e42e, 0x0ac10b60, 0xbaf6b8ec, 0x60c331de,
+    0xd736b121, 0x6a69054e, 0x124a66ca, 0xfe0953cc, 0x9d2b6bd9, 0x359d61ab,
+    0xaababa41, 0x33693ae2, 0x0e90e680, 0x7f23b9bb, 0x797ba817, 0xa770b47f,
+    0xfc435cf9, 0xa900ffb4, 0x38e69fc1, 0x9ffaf683, 0xcd49a7b8, 0x8d1c59ba,
+    0xaa08089b, 0x14e3b460, 0xedaa41a4, 0x453675c0, 0x649231e5, 0x50b757c5,
+    0x58bb5a91, 0x1d30926c, 0xa015bb15, 0x28d3882a, 0x9a2adab1, 0x9b05399a,
+    0x07729569, 0x2deb6a97, 0xddec396c, 0x9d4d4f59, 0x512015a2, 0xb6cecb19,
+    0x0e65dc20, 0xe79a56d3, 0x65fbbc77, 0x47d7e61a, 0xacea4221, 0x9277c46d,
+    0x7414e7d8, 0xd52f45a6, 0xafdba0d2, 0xe3c68dbd, 0xb8b358ef, 0xbbd907f6,
+    0x6256b56e, 0xaaa94c51, 0xdb4958d8, 0x6ac7aa05, 0x5a5b37b0, 0x2db04ac7,
+    0xc5ca388a, 0x6b36f28a, 0x2ed5ca63, 0xd661fc8d, 0xd2c8089b, 0xac5775ab,
+    0xb75adb8b, 0x32864563, 0xa6586cda, 0xcb0093ea, 0x04ef353d, 0x29d576ea,
+    0x1af95cb3, 0xa72d90b9, 0x35919868, 0x6380ad91, 0x8c6a6b30, 0xb190d5d4,
+    0x29216b46, 0x812b98bb, 0x85769136, 0xf35c5275, 0x6e6ad34a, 0x88dfbe09,
+    0x5b45925c, 0x1683ea6a, 0x8b3989f2, 0x7712b1e9, 0x71dd622f, 0x47bf8e91,
+    0x9aac761e, 0x6d523efb, 0x7dc2b2d7, 0xad92dd2a, 0x55265d8a, 0x65cf8a39,
+    0x037615c6, 0x20308a0d, 0x88527e2c, 0xcaf99a13, 0xaa1595f6, 0xfe983c41,
+    0xa8f1fe99, 0x64cb4dc3, 0xc8b649b4, 0xb0668b55, 0x830a6188, 0x18c954dd,
+    0x66b1634d, 0x911d3513, 0x287459c7, 0x88fbd8b1, 0xae440bb0, 0xd69e0dc1,
+    0x4fe8e44e, 0x56214963, 0xd630594e, 0xce691be4, 0x586a234b, 0x22ae5481,
+    0xad955dd6, 0x0dba04dc, 0x8d9e2467, 0xcae90239, 0xb462adcf, 0x4edbf873,
+    0xd9faf53a, 0x6abb2d4b, 0xe4b18ffa, 0xae0453aa, 0x45da669f, 0x26dec32f,
+    0x33e57ab2, 0xf28c84bd, 0xc9bbf8c0, 0x838cdd6a, 0x37aadc2c, 0xaa185713,
+    0x5f17556c, 0xc9498a5d, 0x7558b60d, 0x82ea827c, 0xd4a9daa9, 0x47b2d650,
+    0x3191d261, 0xcf682710, 0x9e72cd03, 0x2dedb6d5, 0xb5ea51ad, 0x62646c65,
+    0x0375b477, 0x8b0e9223, 0x8bc66aa1, 0xd6177059, 0x94e6604d, 0xf997eaaf,
+    0x7600ff33, 0x9600ffaf, 0x4d2bd4bf, 0x5abf18fc, 0x1bbf619d, 0x9a4bf6af,
+    0x7e347a0f, 0xe3d7eaf4, 0x05ed8f4c, 0xff60faaf, 0xc4f5b800, 0xfc178adf,
+    0xb9d78aaf, 0xf71ac91f, 0x5e23f923, 0x6b247fe4, 0x8de48fdc, 0x91fc917b,
+    0x923f72af, 0x2968bf35, 0x780a78c9, 0x5045b38b, 0x130fbeec, 0xba3697f1,
+    0x15d54edd, 0xd9edace0, 0x5df23fba, 0x0ee67d5e, 0x1606ab4e, 0x9039630a,
+    0xf65bd351, 0x3eee99e8, 0x7a983728, 0x37435b44, 0xf49d598e, 0x221623ce,
+    0x83a7ac50, 0xf524b70e, 0x770a7ae2, 0x4e6edf68, 0x7d05ee96, 0xf08f79fe,
+    0x9b7658a3, 0x31e500aa, 0x23aef2d6, 0xd2c58083, 0x1b6b2ba6, 0x660e4472,
+    0x82490e65, 0x37c306d2, 0xd3320229, 0xd42fd288, 0xdeb4abb2, 0xe893d6d6,
+    0xd2a277cd, 0xfa540e62, 0x0c2327c7, 0xe5908349, 0xf3608bb1, 0x4635c884,
+    0xf052c7b8, 0x9525478a, 0x3ae556a3, 0x9c9d49e5, 0xb565ea8e, 0x32b89d6a,
+    0x214a6b90, 0x579e5d30, 0x98e6310d, 0x1467cc0d, 0xf089d5b7, 0x5aa86c5d,
+    0x8b259c35, 0x2aab5eb9, 0x6e6e63a4, 0x4ddcacab, 0xafbbdf11, 0x288fe533,
+    0x552b7639, 0xd04c8626, 0xcd9ca997, 0x02606ff0, 0xbd8d9188, 0xacf0c5be,
+    0x38d0bcbf, 0xb6acbd9f, 0x462a996f, 0x4a149529, 0xceab9e30, 0x0b33c1d3,
+    0x1d3adaee, 0x7df32640, 0xf98e88c2, 0xc91fb9d7, 0xf923f71a, 0x7fe45e23,
+    0x8fdc6b24, 0x917b8de4, 0x72af91fc, 0xc235923f, 0x36fa7fbb, 0x2173f957,
+    0x127e2af5, 0xb88ed68f, 0x982d6196, 0x4ccd209e, 0x98f62c4c, 0xa69d959c,
+    0x07f6b53b, 0x00ff6c7e, 0x3bb0afd9, 0xcdfe67f3, 0x9bdf817d, 0xec6bf63f,
+    0xffd9fc0e, 0x605fb300, 0xfdcfe677, 0xbf03fb9a, 0xd3ec7f36, 0xd5b2a80c,
+    0x4e9f157b, 0xa7ea69dd, 0xecc05aad, 0x39100e62, 0x1aa04053, 0x20d87496,
+    0x989a84d5, 0xbda2843b, 0xf4f1b62a, 0x702c516b, 0xcdb51657, 0xadbc6675,
+    0x05b6ed58, 0x3ec98235, 0x459cc9c1, 0x54042664, 0xe66b9f10, 0xb822dd94,
+    0x7295ab76, 0x630dd94b, 0x3b393517, 0x5d70c436, 0x0484e9c9, 0x23062279,
+    0xc969b56d, 0xf228f6e1, 0x30bb6b96, 0x458c6d13, 0x5ed8ae84, 0xbe1e4bb3,
+    0x55c7b2c2, 0x5b2264bb, 0x8b516ed7, 0x6049ad58, 0x3b579f08, 0x7f037d90,
+    0x367dd387, 0x0784e393, 0x043d6c6b, 0xfb9d0927, 0x8b5dd70b, 0x42ea411e,
+    0x2d483c60, 0x6e9039e3, 0x8857d92c, 0xb1376d15, 0xf20846dd, 0x41d4f1d8,
+    0xb797b363, 0x84057c53, 0xc3ee5132, 0x750aa26d, 0xd9d8154b, 0xfbed4a11,
+    0xbb99fdb0, 0x2ea9fa26, 0xf8e9d357, 0x13c5be90, 0xdd5cce05, 0x9747b94d,
+    0xbf03fb72, 0xd7ec7f36, 0xb3f91dd8, 0xbe6600ff, 0x9fcdefc0, 0x07f635fb,
+    0x00ff6c7e, 0x3bb0afd9, 0xcdfe67f3, 0x9bdf817d, 0xec6bf63f, 0xffd9fc0e,
+    0x285cb300, 0xcd333224, 0x13c51dc4, 0xfd97e713, 0x199cfac9, 0x3f8863fe,
+    0x8bfba96f, 0x29560b69, 0x2b932fe6, 0xba34b6da, 0x2c5f3cfd, 0xc1a8f37e,
+    0xdd54a9b4, 0x3973fb3d, 0x35028920, 0xf8467a86, 0x5f093b6e, 0xe9856fb6,
+    0x890e4b95, 0xb2cbb888, 0xaa4565d7, 0x555698eb, 0x1d831a77, 0x203d0501,
+    0x9f79b674, 0xde54e7e2, 0x1c8e6c7e, 0x18e4d7a8, 0x4bceeb98, 0x26db6b1d,
+    0xd257394a, 0x201adfaa, 0x39969ba7, 0xc3989976, 0x31eb182f, 0x294b1f14,
+    0x7cdaac91, 0x5265cb8c, 0x5aea32d8, 0xab2b468b, 0x82a65b55, 0xb6075bfa,
+    0xf35cc638, 0x55eb672d, 0xdcb093b1, 0x7dad56bd, 0x55352d55, 0xdbc69427,
+    0x58439400, 0x5785ce50, 0xc2108bc5, 0x85427b16, 0xd34c1031, 0xc264e9b2,
+    0x34b100ff, 0x560e2d05, 0xd0e1ebb0, 0x8c1d0c9b, 0xab6d91a3, 0x57defdb4,
+    0x6e6ea724, 0xcfe3ca58, 0x6fbb0ea9, 0x8448e510, 0x76e94210, 0xf33cbfee,
+    0xf97ec144, 0x27624c5f, 0x47dec69b, 0xc128fa6e, 0x370ebbb8, 0xbdd0b397,
+    0xc562438b, 0xf622aa96, 0x1bda214b, 0x4e9bb56e, 0x240b6c64, 0x4a81904a,
+    0xef0a0191, 0x4fb058c4, 0xe597f81b, 0xb43a4d6c, 0x8395222b, 0x8135cbb7,
+    0x55218652, 0x7c7f9c43, 0x85e55440, 0xb5488cfd, 0x009b4859, 0x604f85fa,
+    0xb0014662, 0x3a463c38, 0xa743b6c7, 0x1c63a593, 0x2ee408c9, 0xda4bccaa,
+    0x1dd671e7, 0x3e41d018, 0xade4c7a5, 0x0b75cc95, 0xac265c3b, 0x695b1513,
+    0x1aa81836, 0xd4ccd7b5, 0x61d419f4, 0xb40079f9, 0xf56eaf28, 0x65cac92a,
+    0x1c27a46d, 0x91cb2e0d, 0x0e05ad2a, 0xd14444d7, 0x9aa3622b, 0x96852876,
+    0x7211f3fd, 0x45b1b8b5, 0x9cbd7631, 0xb5b15643, 0xa0d7eb35, 0xb4645f9c,
+    0xe579a2ae, 0x6c532ab5, 0xd9e245b9, 0x4d5f3653, 0x37f628be, 0xb152a55f,
+    0x635f89d0, 0xb53969a7, 0xc7f61756, 0xe5d2a65f, 0x1cc34246, 0x39cc8e5d,
+    0x42a98add, 0x178a7a46, 0xc9038769, 0x0d38c306, 0x2982e5f7, 0xeffe1d98,
+    0xfddb4e2c, 0xe45faadf, 0xbfdafdcf, 0x00ff5afe, 0xf037ad50, 0x756afd62,
+    0xbf6efc86, 0x3d682ed9, 0xd3fbd1e8, 0x328d5fab, 0xbf16b43f, 0xe2fe83e9,
+    0x287e13d7, 0x2bbef25f, 0xab9c7cf7, 0xcefa1a8e, 0xcc298762, 0x90c2a73d,
+    0xf9e0b1a3, 0x8669bfbf, 0xb7f77396, 0x6954f7d6, 0x45ad4d95, 0x956d1a2f,
+    0x4e46007c, 0x7954491b, 0x93aab56f, 0xc6c99ac8, 0x8f01b9ea, 0xebd1b01b,
+    0x6b1889ed, 0xe7b85065, 0x4e701b8f, 0x8e05ad0d, 0x15c4236f, 0x45844c02,
+    0xc28ed576, 0x92c3a0df, 0xcd0a869d, 0xff374738, 0x3b621600, 0x0da849e7,
+    0x47318b4a, 0x8963a88a, 0xcf155aac, 0xb38d335f, 0x64c3ac8f, 0xa2b52380,
+    0x30495584, 0x48ec3a80, 0xc25bec94, 0x57a97f59, 0x0732f724, 0x5972e518,
+    0x478c255d, 0x3005b26b, 0xf3e7f0da, 0xb1dab22e, 0xf0988297, 0x3c42aef6,
+    0xf1632a13, 0x313c7d85, 0x5be5e887, 0xacdd16e1, 0xce61a4c3, 0x314af8a4,
+    0x53f05a3d, 0x18e336d0, 0x772b676a, 0xe0188096, 0xf66fcbf2, 0x0a4f1942,
+    0x6782e6d8, 0xb5930143, 0x4ecc5c96, 0x6721cbf3, 0xe5333116, 0xeee46de8,
+    0x1bf4ead5, 0x083f2c1d, 0x53aebcdb, 0x53def7df, 0x2239533b, 0x6bc84d3e,
+    0x89f6a2be, 0x1351d999, 0x89ebc43b, 0xb218b5b1, 0x97a95449, 0xe67624f1,
+    0x271571cc, 0x774c54d5, 0x9a124717, 0xe11e5104, 0x6df7708d, 0x5fe1bb3f,
+    0xcbbfb2c1, 0x53a90f99, 0xb47e94f0, 0xd115c475, 0x0825cb9f, 0x95d065ce,
+    0x6ac5f32e, 0x1616b24a, 0xecc180a5, 0x22300020, 0x1103dd31, 0xf348af11,
+    0xfcb1b03e, 0x99477afd, 0xe78f85f5, 0xcf3cd2eb, 0x3f7f2cac, 0x7de6915e,
+    0xfaf96361, 0xeb338ff4, 0xd5cf1f0b, 0x8ff8357a, 0xd1b2d62f, 0x6ce4c958,
+    0x767fc30a, 0x883f97d6, 0x1a3307a5, 0x9158c17f, 0x7165cd7d, 0xf56ce2ea,
+    0x0aece2c4, 0xda2c6e59, 0x7ae0f101, 0x1886c866, 0xca45a8a7, 0x4ce34710,
+    0x69f77777, 0x33e7c558, 0x8aaf7991, 0xb25f87f0, 0x974f0682, 0xe831d5ad,
+    0x6972e38a, 0x02169633, 0x6a445b44, 0xb671e8db, 0xf858224f, 0xb1b0ba12,
+    0x46d21e7d, 0x8954ed09, 0xa8eefba7, 0xcc0cc438, 0x8a45bc6a, 0x91e9666f,
+    0xfa0ab2ca, 0x23b3c9f2, 0x925b5a89, 0x2faedaa3, 0x83952ca6, 0x6c89ad62,
+    0x6b55b685, 0x450e0f92, 0x8246cc6f, 0x57a72c78, 0x93e7f5d3, 0x28144366,
+    0xd52e953c, 0x69217d71, 0xd6ec4cad, 0xce36b209, 0xb0905cab, 0x44f7891c,
+    0x64814bc4, 0x6755c85a, 0x7885e417, 0xbea9f7db, 0x31bb6ccf, 0x2b54c62b,
+    0x50adec97, 0xab84c272, 0xcaab88b3, 0xf350dac6, 0x29944184, 0xa96ce3eb,
+    0xc88f9d63, 0x3edc0664, 0x19635cdf, 0xdaac5bb4, 0xb070a75d, 0xf62b4132,
+    0xc01653f9, 0x10ba6f31, 0x332e859c, 0x15a5d8ca, 0x1b96af32, 0x63c321ee,
+    0x629b3510, 0x6cd713a3, 0xeb363109, 0x30170db5, 0xb9604e08, 0xe9752408,
+    0x16d6671e, 0x48af9f3f, 0xb1b03ef3, 0x477afdfc, 0x8f85f599, 0x3cd2ebe7,
+    0x7f2caccf, 0xe6915e3f, 0xf963617d, 0x338ff4fa, 0xcf1f0beb, 0xbfdc0bd7,
+    0x362dd765, 0x16cbd073, 0xf4714d18, 0xf952cdf2, 0x794ae68c, 0xf7030216,
+    0xe73e6284, 0xf3cfe0d4, 0x7dfb411c, 0x4477dd4f, 0x74cf74cf, 0xf31ddd6f,
+    0x9747f43e, 0x5bd82a5e, 0x05caf1c6, 0xdfefc43b, 0xe94e1edd, 0xb5f793fc,
+    0x26da6865, 0x06d90bad, 0xd53e056f, 0x01e20445, 0xc6f68981, 0x7dc3c272,
+    0x67de72a3, 0x201269bb, 0xc08d8321, 0xa3206688, 0xf19859fc, 0x31d0dea3,
+    0x5f4c57b7, 0x9cda5879, 0xad4b37eb, 0x78bc79b4, 0x654d8909, 0xfd6bb8ee,
+    0x305aa2b0, 0xcbc76609, 0x5d0da391, 0xd9a9e377, 0x476270b4, 0x097b65d4,
+    0x9383d9ad, 0xc4736cc8, 0x8fc5e744, 0x5986acbb, 0x2bc5586c, 0xb12eeb14,
+    0xb66d7541, 0x27d5aadd, 0x21e05ea4, 0xa95fb90c, 0xbc00ff27, 0xa7bb8f88,
+    0x1645b6a2, 0x5721475d, 0x8b0e911d, 0xab6d0813, 0x5e5d8c3d, 0x566e664e,
+    0x3095a85d, 0xddd850b9, 0xb2950947, 0xc70a3248, 0xb1b6ed5e, 0x56ed5a6e,
+    0x24a95965, 0xde18bc2c, 0xde4b76ad, 0xeab8102d, 0x8cce70e2, 0x1e0cddf4,
+    0xbe18526e, 0xe1aaef75, 0xae2e6ce2, 0x2396704d, 0x57616ca4, 0x4c265586,
+    0x65e3baf6, 0x543e9366, 0xce546634, 0x4192ad84, 0x00ff92fb, 0xd5ee7f26,
+    0xd7f200ff, 0xbf6985fa, 0x53eb1783, 0x75e33fac, 0x4173c9fe, 0xde8f46ef,
+    0x69fc5a9d, 0x75a2fd91, 0x1f4c00ff, 0x84b816f7, 0xa7e8b56f, 0x36eb9138,
+    0xc2c342aa, 0xe58c293c, 0xae8ea5e9, 0xb17c3207, 0x1936b83b, 0x69dbef99,
+    0xfa11d7f3, 0x7ad38786, 0xfa11d7f3, 0x7ad38786, 0xfa11d7f3, 0x7ad38786,
+    0xfa11d7f3, 0x7ad38786, 0xfa11d7f3, 0x7ad38786, 0xfa11d7f3, 0x7ad38786,
+    0x453cc3df, 0x0ef0dfbf, 0x79bde93f, 0x43fd88eb, 0x79bde943, 0x43bd88e7,
+    0x5e6ffa8f, 0x502fe279, 0xd79bfee3, 0xa3886776, 0x38ec00ff, 0xf5a600ff,
+    0xf5239ee7, 0xf5a60f0d, 0xf5229ee7, 0xf5a60f0d, 0xf5229ee7, 0xbde93f0e,
+    0xbd88e779, 0x6ffa8f43, 0x3fe27a5e, 0x6ffad050, 0x3fe27a5e, 0x6ffad050,
+    0x3fe27a5e, 0x6ffad050, 0x3fe27a5e, 0x6ffad050, 0x3fe27a5e, 0x6ffad050,
+    0x3fe27a5e, 0x6ffad050, 0xe738365c, 0x2b4eb158, 0xb62ebae4, 0xff60ad80,
+    0x6517b300, 0xf629449d, 0x265b3900, 0x988fb323, 0x66794a20, 0x3f556364,
+    0x47eb4709, 0x90fe4d5c, 0x9400ffe6, 0x23eb7eed, 0x5ad782da, 0x59a529dd,
+    0x554461f5, 0x7011e785, 0xdc6b1af9, 0xa8265add, 0x03721c4c, 0x3c05339d,
+    0x845ce2ba, 0xa843de2e, 0xf368a8c4, 0x395a28a4, 0xd48e13e8, 0x6b5077fb,
+    0xec28f500, 0xcad59eb9, 0xd92b4064, 0x5ded7c85, 0x5eac369a, 0x94c86f57,
+    0x91d5fa32, 0xbbc5ea43, 0x8ce1bd86, 0xe3185e47, 0x2210ba5f, 0xd6e08e00,
+    0x57722f6f, 0xca551c08, 0xda8b9552, 0x21964dc6, 0xc55cb52a, 0x34f6925d,
+    0x17d6ce92, 0x7d7dd9e9, 0x08c84484, 0x5f236782, 0xf54ed788, 0xb080357a,
+    0x44b55e1c, 0xc522bb58, 0xdd449d2e, 0xd7ca8103, 0xa63c6675, 0x2a977a93,
+    0x71dab0f2, 0x7d5739d9, 0x77aa421c, 0x8f428fd3, 0x6bb9f887, 0x457eb180,
+    0xd5740ac9, 0x29930b7c, 0xe58dd559, 0xb90d5b35, 0x718c9553, 0x59e5f5fe,
+    0x55911127, 0x6f7eea4b, 0x93645629, 0xebed6ecb, 0x65843d86, 0x57da35b3,
+    0x91aad468, 0x369967af, 0x28b1f767, 0x8417bbba, 0xe328626f, 0x3c3096f3,
+    0x446c1949, 0xd61ac52e, 0xec57a594, 0x45d26c57, 0xefb1d68a, 0x86d911c8,
+    0x76abbb2a, 0x485b8c8e, 0xcc125ba4, 0x4baf4895, 0x0da7461d, 0x2ab5a6e7,
+    0xda13aa5d, 0xef258a2d, 0x7ab75f36, 0x143aece3, 0x47dbeea5, 0x69ada400,
+    0x4f4c8c05, 0xfc53b8ee, 0x5afe21ae, 0xcfe0d47f, 0xfb411cf3, 0x30dd4f7d,
+    0x1b57e55c, 0x00d5ac78, 0x10828675, 0xb58bbb0f, 0xcc59bf5e, 0x6f565a91,
+    0x84355930, 0x3b3f5f2b, 0x600a4208, 0xb8b362eb, 0x6f2c7dd0, 0xc47dd308,
+    0xac5a51e5, 0x85f3bbba, 0x5864a862, 0x2549a0d4, 0x818dfd22, 0xdeaf9216,
+    0x707d69fd, 0xb5be1077, 0x90a95795, 0x56459fa5, 0x5d1fc39b, 0x4a667dcc,
+    0x42f35c62, 0x335a1691, 0xa21aeb29, 0x108f6b18, 0xce5923a6, 0x823ca57c,
+    0x366a3932, 0x2eba7eb8, 0x5329d3aa, 0x4c26d858, 0xe22603d5, 0x5f5b3505,
+    0x052c551e, 0xca063663, 0xac8e144b, 0xf175cd58, 0x68d3c96c, 0xbd8e13ab,
+    0x22e3c497, 0x4649102d, 0xee84cf56, 0xa356ebd3, 0xe98aa43c, 0xe4db9792,
+    0x4da1c8ea, 0x3aed6716, 0x82cfa2c2, 0x7ae6d11b, 0x0c5c7dbf, 0x49c72ebe,
+    0xf6200527, 0x8ec31232, 0x09389f94, 0x3311ee98, 0xa626d6ac, 0x29865d49,
+    0xa1a79c63, 0xef736c80, 0x253f2e71, 0x38872a62, 0xec388b4d, 0x8053d768,
+    0x4d1b9c27, 0x859cfcfc, 0xbf9f33cb, 0x4533f9c3, 0x73e049ec, 0x9c8e1f55,
+    0x157279c3, 0x9a90c589, 0xa74a1b4c, 0xebd4fee0, 0x55285cdf, 0xe341bab8,
+    0x1732f1b5, 0xd58a76eb, 0xa47296b1, 0x1b2b764f, 0xd7c7ac8c, 0x5c62d355,
+    0xb35ea16e, 0xacbbc26f, 0x09f65ea8, 0xf5db01ba, 0x87646436, 0x96037337,
+    0xeb971db2, 0xb8412f7b, 0x97ac66f6, 0xdb4e7d5d, 0x852d0e14, 0x1936a352,
+    0xba82386e, 0x0de3f6ae, 0xe989cf89, 0xc9bfe4fe, 0x7fb5fb9f, 0xa1feb5fc,
+    0xc5e0675a, 0x0febd4fa, 0xb27fd9f8, 0xd17bd05c, 0x56a7f7a3, 0x7f641abf,
+    0xf9479d68, 0xb800ffe0, 0x8adfc4f5, 0x8aaffc17, 0xc2cb89fa, 0x91bfd92a,
+    0x5ea15bca, 0xea45d56e, 0xebe3eaf4, 0x35d86bd4, 0x1bd5a92d, 0x2d6ecb66,
+    0x7a4b6f70, 0xa04a5109, 0x1c70ce58, 0x344d58f5, 0x8bac12b3, 0xa70b2ce9,
+    0xcc2e6316, 0x1cad9135, 0xb84909d3, 0xeed7da22, 0x2c242c14, 0xd1b86001,
+    0x95fcf7a9, 0x75413671, 0xafcb152a, 0xb450b59c, 0xba2e4db1, 0x4f589748,
+    0xac8ecd92, 0x60a81c00, 0x18315c66, 0x55ae66d5, 0x5789b304, 0xac83ae8a,
+    0xd927afc7, 0x75ad581d, 0x2d7bb9c4, 0xf58a4556, 0xa6346837, 0x506ce5c3,
+    0x577c4da5, 0xf431e664, 0x257f2d67, 0x4f3569d9, 0x9e52ad08, 0xb036f54e,
+    0x182923da, 0x4e03cb8e, 0xb66dfbb8, 0x41506617, 0xbfd9738c, 0x4bc8d566,
+    0x69eca6f1, 0x6c751c37, 0x1833d22e, 0x159b0eea, 0xa9c4de0a, 0x9884aa0b,
+    0x3d1c6058, 0xab0d2387, 0xf8983bd3, 0x792a91ba, 0x6c0218fa, 0xb74df9a8,
+    0x36ae59ec, 0x85b73962, 0x10c96bae, 0x51308d4f, 0x0d68f7b4, 0x6b6d6179,
+    0x421b4f37, 0x8db771d2, 0x69a52d56, 0xe5e824ed, 0x87a25516, 0xd77e5dd8,
+    0xf36cf3ca, 0x56a47531, 0x0e265ece, 0x38c22786, 0x2ca0a8f8, 0xad6661c4,
+    0xa1437876, 0xbf676667, 0x3164c2b1, 0x06533220, 0xda78457e, 0x5eca5cc8,
+    0x2a56d0c2, 0xb03456b5, 0x94b6f0f5, 0xa9f6b4e1, 0xc170502b, 0x975c060d,
+    0x1a16336c, 0x09e60ab6, 0x7b815acd, 0x34f9edda, 0x349ba8d6, 0x57d8a2aa,
+    0x64d1e26b, 0x33e40d2b, 0x8aaecea5, 0xd6c14c57, 0x9958ce88, 0xc5295831,
+    0x258f95aa, 0x30393250, 0x505ddcb4, 0x897b7512, 0x5bd7e7ae, 0x2d14f84a,
+    0x5b6d9031, 0x4ed98d03, 0xdaacf217, 0x9ef5d655, 0xd57d63b3, 0x83c764ec,
+    0x8d17e56d, 0xa4c9b22a, 0xc55e1776, 0x9ea20536, 0xbb2a084f, 0x2c00e612,
+    0x6168237a, 0x848b616f, 0xcfb3b81e, 0xf0d2846a, 0x851d7b92, 0xb0ddb8a6,
+    0xb6d6bb8a, 0xabd9257e, 0x6a55ca62, 0x24111120, 0xa4ac5c45, 0x2c6eba09,
+    0xaecc55ad, 0x7a8833be, 0x355a15e5, 0x463cedc2, 0x6c40a04c, 0x77f6b68f,
+    0x914d6ea5, 0x1328598e, 0x7562a40d, 0xd5b2b26e, 0x3bc75aed, 0x8682bc18,
+    0x0c09d4b3, 0x0dbac2ab, 0xf87e616d, 0xfbd58d62, 0x57048452, 0x776ed9d6,
+    0x95623923, 0xca2db23c, 0xdec129b3, 0xd772d568, 0xbdfadb5a, 0xe698ab36,
+    0xaf93d46c, 0x685f5d61, 0x97bb6229, 0xb539c020, 0x0493fd7e, 0x14205e8d,
+    0x28e64a29, 0x9ba08bb5, 0xb994f600, 0x6833d43e, 0x8e890a59, 0x8591aba1,
+    0x358922d3, 0xca32e4b2, 0x155bc52c, 0x33ea5c99, 0x1bd69398, 0x25a7a154,
+    0xdd511e7b, 0x1e132017, 0xc9a70b32, 0xe13a5361, 0xdff2c16f, 0xa5fe77cb,
+    0xfa51c24f, 0x2d7ed6d1, 0xb373e250, 0x58b4bc19, 0x60316524, 0xb16f7f82,
+    0x318324d6, 0xb354304c, 0xc306569a, 0x8ca00d31, 0xcda724a6, 0x6ceb59dc,
+    0xf3fad047, 0xdb7a1677, 0xbc3ef411, 0xb69ec5dd, 0xaf0f7dc4, 0xad677137,
+    0xeb431fb1, 0xeb59dccd, 0xfad0476c, 0x7a1677f3, 0x3ef411db, 0x9ec5ddbc,
+    0x0f7dc4b6, 0x3cb174a6, 0xc98ace60, 0xf1e4e9cd, 0xcc48d247, 0xb89c3541,
+    0xc958e469, 0xc396490c, 0xf71b5112, 0x569099c6, 0x103b8e07, 0x57b72df3,
+    0xa3d91d7f, 0x3b201079, 0xf7e98403, 0xc99088c9, 0xcf40c977, 0x37f85b97,
+    0x876dfd8a, 0xb45c1ffa, 0x6d6d1cb0, 0x5ace929c, 0x2eae71d7, 0x3d129841,
+    0xe5298497, 0x9f199882, 0x79c43427, 0x8e186474, 0x6e5c202f, 0x289e1cc9,
+    0xeedf7185, 0x0cdb30e6, 0xb6ee136d, 0xdbbc4ef2, 0xc3b67ec5, 0x37af0ffd,
+    0xb1ad6771, 0xcdeb431f, 0x6ceb59dc, 0xf3fad047, 0xdb7a1677, 0xbc3ef411,
+    0xb69ec5dd, 0xaf0f7dc4, 0xad677137, 0xeb431fb1, 0xeb59dccd, 0xfad0476c,
+    0x7a1677f3, 0x3ef411db, 0x6b7162b8, 0xe75baab6, 0xe4be2b7a, 0x854fd4be,
+    0x36ead559, 0xb7a86bba, 0x2a873c6f, 0x22729587, 0x5312c55c, 0xe6fa16ae,
+    0x4f1ff42c, 0x0bbcd835, 0x7b7979d8, 0x69477b72, 0xcd3391ed, 0xd3a547bf,
+    0xcda9dbee, 0xbe7b1dfc, 0x4f98fc3a, 0xf1dd6be6, 0x7fc2e4d7, 0xe3645f33,
+    0xfe84c9af, 0xc7cbbe66, 0xf31ff63f, 0x394ef675, 0xffb000ff, 0xb2af9900,
+    0x87fdd771, 0x903ecdfc, 0xab98e3d8, 0x9773a865, 0x769e80c9, 0x0bc286d6,
+    0x1ed4559e, 0x807bbb4e, 0xc79b4bc4, 0xfb76d882, 0x4c7e1d27, 0xf635f327,
+    0x98fc3a4e, 0xdd6be64f, 0xc2e4d7f1, 0xef5e337f, 0x1326bf8e, 0x27fb9af9,
+    0xd800ff1c, 0xd9d7cc7f, 0xc3feeb38, 0xdfbd66fe, 0x274c7e1d, 0xf8ee35f3,
+    0x3f61f2eb, 0x71b2af99, 0x7fc2e4d7, 0x8eef5e33, 0xf91326bf, 0x757cf79a,
+    0xcc9f30f9, 0xafe3bbd7, 0x66fe84c9, 0x7e1ddfbd, 0x35f3274c, 0xaee3d431,
+    0x1326effe, 0x8a0c9af9, 0x4a19fa39, 0x16293254, 0x56010b0c, 0x16ab29ea,
+    0x3c8f9140, 0xc536c70c, 0x13dd1331, 0xfc2c6f3b, 0x9d5abf1c, 0x1b00ff61,
+    0x9a4bf62f, 0x7e347a0f, 0xe3d7eaf4, 0x05ed8f4c, 0x3c00ffa8, 0x594ff81f,
+    0xed76529c, 0x535b1c59, 0x6179664c, 0xd7fa92b6, 0xf1699e94, 0x25d95d46,
+    0x3c302543, 0x68cc3be4, 0xb125d0d4, 0xb0c52065, 0x7b0c0c64, 0x624b4c88,
+    0x98ee8912, 0x4327de98, 0x9b56c98f, 0x5e90d574, 0x2e8fb052, 0x2a02b5ea,
+    0x7281a6b0, 0x4adfe975, 0xeb29bbd4, 0xb352a228, 0x9d650253, 0x1f53a949,
+    0xb8219e76, 0x10fbe254, 0x59b40d34, 0x3e792c5f, 0x63586ca2, 0x32d8e0ca,
+    0xa2bb6492, 0xf774eac0, 0x974d2464, 0x54b23412, 0x90c0bbe9, 0x7179c9be,
+    0xc7879374, 0x6aa909f6, 0x8941a4c4, 0xccdd1eb1, 0xbc938e2a, 0x61634b69,
+    0x636eb71a, 0x9971742d, 0x6be3cca2, 0xe5b1b656, 0x753345eb, 0x3bd5b017,
+    0x4b512da2, 0x6f88d0d6, 0x11333929, 0x55ac06ce, 0x5adec6ce, 0xf9a0cd08,
+    0x7c60235e, 0x6c297f31, 0x246f532d, 0x1cd26dc2, 0x844cca88, 0x789eaea3,
+    0x5724dee5, 0x02790a8a, 0x6779af80, 0xdb96f679, 0xee661d56, 0xb0b72027,
+    0x01223964, 0x2f41c8d8, 0x4ab3e798, 0x25ce59f9, 0xc7aadbcc, 0x38579b5e,
+    0x17c41993, 0xd2d3963a, 0x3ce7a218, 0x4411d6a9, 0x19768e4f, 0xfb4e86b5,
+    0x79484772, 0x1bbd4e4a, 0xa912c8ca, 0x445e6d64, 0x3ecdee63, 0x9990abd0,
+    0x0ed946b1, 0x5726d3c7, 0x9e0a0b02, 0x118ee1ba, 0x668604fe, 0xe9d8c4b5,
+    0xd33e7b65, 0xbc8ee054, 0x62dab7d7, 0x13497d3f, 0xccc77e46, 0x087f966c,
+    0x5c59a788, 0x38dc357d, 0xea1885c9, 0x480f94da, 0xcf97daa9, 0x616eae8a,
+    0xbe63f131, 0xbebf0b26, 0xa55fc534, 0xb1f56a6a, 0x72285436, 0x7e5cbd7a,
+    0x0acb182d, 0x3ae46239, 0x5c020557, 0xe5c91cd1, 0xfabd151f, 0x8d9f64c7,
+    0x96e1c898, 0x5993e3f4, 0xa5334e8b, 0xc7db6cda, 0xead3530b, 0xb68d312e,
+    0xc44401c8, 0x896b5a58, 0x8a0ca674, 0xb6d3c7fd, 0x39fc8b79, 0x6c3806e0,
+    0x05c1292e, 0x435ed464, 0x75ea2ba5, 0xd05abd0e, 0x38ddfcda, 0x5e803964,
+    0x5db620d8, 0xb909d99a, 0x0d1bc566, 0xd85be459, 0x5b0db12a, 0xe13a15ae,
+    0x86ed0c23, 0xb15d80b9, 0x4f83aa62, 0x53c126a6, 0x6b5ee642, 0xcda08599,
+    0x600c228c, 0xeed4c283, 0x6dcf0dd5, 0xa036a3a7, 0x80c7bbcb, 0xd6b78d98,
+    0xd558b155, 0x2178eb19, 0x7b46335f, 0xd0c8612f, 0x96274b79, 0xb4e2e039,
+    0xcbcb6dc4, 0x35f9bccd, 0x6c553176, 0x0e747d10, 0xb068df52, 0x397816b2,
+    0xab5561f6, 0xa87d2e10, 0xaecfc38a, 0x0cfb23c8, 0x2685f872, 0x7d7c7dbc,
+    0x9f43aef2, 0x947d8c8b, 0xaae15bf5, 0x201da94a, 0x1515c45a, 0x39de0ba1,
+    0x421d9bc8, 0xc2905ce7, 0x795515e7, 0x9537cd0e, 0x5cc80975, 0x08c5abed,
+    0x3175e22d, 0x12b67ba4, 0x612258e6, 0x14ccb9b0, 0x9c316498, 0x891198cd,
+    0x11882922, 0x99229918, 0x77c440f2, 0x88dccfcc, 0xfe709def, 0xdc40d426,
+    0xb6ac41a5, 0x3794f7bd, 0xf8cd7621, 0xa8797fac, 0x882dd653, 0x69dfe7ee,
+    0x95faef98, 0xeb47093f, 0xfe4d5c47, 0x00ffe690, 0x687fed94, 0x29003ae2,
+    0x6a0b3705, 0x8e0ad9c3, 0xd207f2d2, 0x2e8fad14, 0xf1e88a63, 0x495768cd,
+    0x1f13c664, 0xa744300e, 0xd57e5a11, 0x13b7079e, 0x8e9cf81b, 0xbe6d64c5,
+    0xd60eec7e, 0xffef64f7, 0x5f102a00, 0xa5393472, 0x0e85cfa2, 0x8c9f3c96,
+    0xc723e89b, 0x4660ef25, 0xb4dbab79, 0x1442ae32, 0x5c49450b, 0xd5d37e76,
+    0xcbf49523, 0x79fb2c5c, 0xc9ecd144, 0x5aa9dac9, 0x9d26e5d0, 0x92f3d5eb,
+    0xc1abbdda, 0xa137af74, 0x08da914d, 0x9e2e6125, 0xe78bad54, 0x3800af36,
+    0xb41c27eb, 0xa77d646b, 0xf57ea39f, 0x9cb6b9e7, 0xd5beecf4, 0x317b4eda,
+    0xaeefab2d, 0x1b565a03, 0xbad06a48, 0x587453b4, 0xac98567f, 0xd41935d2,
+    0x96c27a2e, 0x82423149, 0x11a642dd, 0x4a79e01a, 0x47fb6366, 0xc4957f0a,
+    0xfa4fcb3f, 0x63fe179c, 0xa96f7f88, 0x2c1f69f5, 0xe410cf73, 0xe6684bc6,
+    0x2a6e8ce5, 0xbbbc7960, 0x47cccc44, 0xbf9f7993, 0x8fec0fae, 0x3295a925,
+    0x365eb10d, 0x73e4f69a, 0x496b83d7, 0x12d89598, 0x5a887454, 0x12bf1227,
+    0x4ebb9763, 0x57cd449c, 0x2be6cfdc, 0xb1fd95f6, 0xb13f865e, 0x7f2a7acd,
+    0x2c4b58bb, 0xe5e4d891, 0x0cd1f4eb, 0xae1157dc, 0x0aa5cf1a, 0x46d1ae53,
+    0x5070d54e, 0x4bbb720d, 0xda936e27, 0x80e98808, 0x6131ec5d, 0x43851189,
+    0x1041de5a, 0xdce21198, 0x0a09ae98, 0x11f035aa, 0x770c3330, 0xe6f80615,
+    0xc9723487, 0xc33ac557, 0x8709feb7, 0x3a3ac476, 0xdfe7b6c8, 0xd2d8fbe1,
+    0xc0d525c9, 0x091f582b, 0x2a76a1d3, 0x96cf304c, 0x3e20bba5, 0x13da11de,
+    0x760222bb, 0xa3b1a35c, 0x388cd525, 0x145a75de, 0xbaadc3a6, 0x83206bc6,
+    0xd18d6db0, 0xd9816955, 0x3d62b28c, 0xb85eab38, 0x579cae7b, 0x422c64c8,
+    0xd0a9e42c, 0x43a8caa4, 0x1ad596cf, 0x36f6c957, 0xae9829b1, 0x72558dbc,
+    0xc1066bd6, 0xe94d4df5, 0x11c8f388, 0xcb0e5ae4, 0xac7571e4, 0xaf0ea3d4,
+    0xec58285c, 0x5d22b3bd, 0x8e2de958, 0x8c8ff59e, 0xcc195b0a, 0x144f2c5e,
+    0xa9082b8d, 0x8a701679, 0xd2c82c1b, 0x6ac740c6, 0xbb000ebc, 0x8f54cd7a,
+    0xa7239653, 0xd17682d6, 0x82b62502, 0x79b0f1b5, 0xad130e6c, 0xe275ec9f,
+    0x762debcd, 0x51199343, 0xbd2a1273, 0xafdb6a60, 0x7db2bed6, 0x2313ce7e,
+    0x79acd462, 0xd546f68a, 0xc1cbe3d4, 0x404585e0, 0xffbe988c, 0x4d336a00,
+    0x5ae8e6ba, 0x3ca99226, 0x6ce679ce, 0x08e95773, 0xe0560e43, 0x173ee65d,
+    0xc1c149c4, 0xcb7c0512, 0x3bd70a6d, 0xd849dd4e, 0x4b877cb7, 0xc9c4b0c9,
+    0x9e6a3b6f, 0xbcdb0a2a, 0xa0507c1c, 0x661934ec, 0xf97146fe, 0x15b0ae69,
+    0x24130ca6, 0x6c632e11, 0x032b211c, 0x5839621e, 0xd14d2619, 0x3deccd6a,
+    0x5d41b681, 0xf148a3cd, 0xabb7ab39, 0x53f310b2, 0xc1863d25, 0x4c705034,
+    0x3a836a6a, 0xa2050c64, 0x1517f2ea, 0xf6cc308c, 0x3b8a3a92, 0x901e7688,
+    0x8385e4df, 0x691b4ce1, 0xa8e77460, 0x4186321d, 0x36110cf7, 0xbf0e932b,
+    0xe104fa50, 0x9a2b6910, 0x03d0727a, 0x76240b60, 0x183211e7, 0x8f29f62d,
+    0xe8dfc3ab, 0x00ff0fc7, 0x3fd35726, 0xa7d62f07, 0xcbc67f58, 0x83e692fd,
+    0xbd1f8dde, 0xcff8b53a, 0x6a41fb21, 0xfe07cf3f, 0xcc10d413, 0xc4c40c89,
+    0x3131edc4, 0x1e1313df, 0x3ab98f49, 0x7061c982, 0x44c44799, 0xf0f8cb76,
+    0x8d11c36d, 0x49601986, 0xf7d1666c, 0xca8b484e, 0xafdf5352, 0xd5673845,
+    0x7a8df3c5, 0xae3ec329, 0xd16b9c2f, 0x71f5194e, 0x8a5ee37c, 0x8babcf70,
+    0x53f41ae7, 0x5f5c7d86, 0x9ca2d738, 0xf9e2ea33, 0xe114bdc6, 0xce17579f,
+    0x0ca7e835, 0x71beb8fa, 0x673845af, 0x8df3c5d5, 0x3ec3297a, 0x6b9c2fae,
+    0xf5194ed1, 0x5ee37c71, 0xabcf708a, 0xf41ae78b, 0x5c7d8653, 0xa2d7385f,
+    0xe2ea339c, 0x14bdc6f9, 0x17579fe1, 0xa7e835ce, 0xbeb8fa0c, 0x3845af71,
+    0xf2c5d567, 0x8653f4fa, 0x385f5c7d, 0x339ca2d7, 0xc6f9e2ea, 0x1eecb8ba,
+    0xf8671b0b, 0x56e32917, 0xfaf79536, 0x5736694d, 0x8908dfbf, 0x5b30b1fb,
+    0xa4cc884e, 0x8848a688, 0xa68864a6, 0x9e299277, 0xf99e99f9, 0xfa99ef99,
+    0x47093f95, 0xeb5947eb, 0x119c5d1f, 0xca9aaf5f, 0xe2dab3bf, 0x75a44d09,
+    0x4667d86f, 0x7411bbca, 0x919b2bac, 0x462ee6cb, 0xed340f09, 0xe032bdbe,
+    0xf949d20f, 0xe032bd86, 0xf949d20f, 0xe032bd86, 0xf949d20f, 0xe032bd86,
+    0xf949d20f, 0xe032bd86, 0xf949d20f, 0xe032bd86, 0xf949d20f, 0xe032bd86,
+    0xf949d20f, 0xb88aad86, 0x62f2d8c3, 0x775236ed, 0x768e8853, 0x52664d4b,
+    0xcc8ea9bd, 0x97b443dd, 0x8bbfed30, 0xc729723f, 0x491a7b16, 0x56505785,
+    0xc7827842, 0xb08f1184, 0x2ca963c9, 0x525603c5, 0x768e6d64, 0x5ba06dd4,
+    0x05d8959a, 0x677a2417, 0xbd4d3ec0, 0x6d242f25, 0x9387f6dd, 0x8bbf3bba,
+    0xe32cfa58, 0x8ebe630f, 0x79056d30, 0x3264220e, 0x43fbdb62, 0xc834a57a,
+    0xc7fd604a, 0xee612f28, 0xd5ef699e, 0xfb73fd55, 0x3a6eda17, 0x2e77b14c,
+    0x58cb1c67, 0xfe9633c9, 0x35a195f7, 0xa63c08ec, 0xaf9415c2, 0xee774590,
+    0xc77c2dc4, 0x343e4c04, 0x113623e0, 0x31f19919, 0xf39c9911, 0x1d4d9111,
+    0x64a688c8, 0x67e67b8a, 0x5ca6d779, 0x3f49fa01, 0x5ca6d730, 0x3f49fa01,
+    0x5ca6d730, 0x3f49fa01, 0x5ca6d730, 0x3f49fa01, 0x5ca6d730, 0x3f49fa01,
+    0x5ca6d730, 0x3f49fa01, 0x5ca6d730, 0x3f49fa01, 0xd30cd730, 0x8fecb8ed,
+    0xda93734a, 0x657b56f1, 0xac32f516, 0xe9d8b46f, 0xcf579eab, 0x1c896fd2,
+    0x7f07068e, 0x11aef32e, 0xfe32669c, 0xec9c1042, 0x7d54693a, 0xfdb25498,
+    0xa2339c7e, 0xc8cfc905, 0x73dbbc7c, 0x49de9672, 0xcf79a3d7, 0x1df9dd55,
+    0xf59c377a, 0xd091df5d, 0x5ff0ee62, 0xaf5ad911, 0x5ddbfabe, 0x1d9ca976,
+    0x9aabf58a, 0x76130fce, 0x092b6208, 0xee24c70c, 0xc5fabe53, 0xc407fc25,
+    0x160d2716, 0x5e34a706, 0x7d1d3004, 0xa42ec4f7, 0x40d77031, 0xe833dd31,
+    0x582da95a, 0x778a4af7, 0x70cb4a8b, 0xab227b96, 0xf6925937, 0x586977ba,
+    0x166de745, 0x3b768718, 0x0859152b, 0xac92b011, 0x1024dd7c, 0x18af5231,
+    0x982d7c5a, 0x54859242, 0xab3851a7, 0xd1940add, 0xb9ba261b, 0x6e5b2495,
+    0x650e634c, 0xe61a7b8e, 0x58279b4c, 0xae7039ac, 0x9e0c7e65, 0xbf8e61fb,
+    0xe70ab7d6, 0xe8d0300a, 0x43608f72, 0x264aba0a, 0xfeb65766, 0x78e23e4d,
+    0xf9ab2c23, 0x5a6e5107, 0x90c863c7, 0x9176ec5b, 0x66bae278, 0xdf1eefaf,
+    0x5dacba72, 0x4730dbf6, 0x2a84a81c, 0x6f347365, 0xe96d2ef0, 0xe96ca135,
+    0xcb58212b, 0x76bddfb1, 0xf6e0d39e, 0x1b1921ec, 0xcf05de35, 0x97931e0f,
+    0x79be9ed9, 0x00ff425e, 0xa92b310a, 0x9cd8c595, 0x36e6467b, 0x7d4c8529,
+    0x92b86d6a, 0x953ca2b0, 0x618a2e27, 0x79d0caf8, 0xc26b6220, 0xddd2621c,
+    0xb28167c7, 0x2f2725d9, 0x3b63c993, 0xd6f23e46, 0xb87c9011, 0x34afddab,
+    0x752a17d9, 0xf9d91d20, 0xb43c4fab, 0x910c844d, 0xeb3f9e8c, 0x93233357,
+    0x3c9b066d, 0x3d7a7419, 0x88608e85, 0xc8f22b2e, 0xe531adb3, 0xdb18488e,
+    0x77a9577d, 0x17177383, 0xddc18218, 0x6e7da539, 0x852c40bd, 0xd98f77bc,
+    0x8bb70919, 0xd82ac26a, 0x864a7c91, 0xf310c514, 0xf5a95f73, 0x81a9759e,
+    0x0d5b19e2, 0x4bc46f61, 0x05599f0a, 0x84cdf091, 0xe4da6c82, 0xa72a0773,
+    0xaf5e2c2a, 0x248c9e67, 0x2a47aca9, 0xc6bcaccf, 0xe5591c4f, 0x00fff165,
+    0x87b4b2bc, 0xd2b052ad, 0x52f66012, 0x5a592963, 0x43cede96, 0x84f2c85e,
+    0xae76c375, 0x826b0172, 0x27572573, 0x95b448e1, 0x4497be55, 0x98c1b264,
+    0xa299851e, 0xb0d69cde, 0x2e8d0db0, 0x0d6f8555, 0x0ab2fc56, 0x240ff85a,
+    0x681c5685, 0xe5e94256, 0xe418423a, 0x9f742964, 0x619d5ccd, 0x27f9b156,
+    0x651db356, 0xa41d59b2, 0xbd52321a, 0x153c5a05, 0x1148ad9a, 0x95255c97,
+    0x3f71d86f, 0x3e2a5631, 0x24762cc3, 0x0a52f4c1, 0x0f84ea1a, 0x19f38428,
+    0xe8f50893, 0x77d573de, 0x8d5e477e, 0x77573de7, 0xdee875e4, 0x7e77d573,
+    0x3d345847, 0x87a39766, 0x5a724970, 0x57530c32, 0x6c31408e, 0xc080d802,
+    0xa28444e2, 0x27264a24, 0x1cfc4cbf, 0x619d5abf, 0x2f1b00ff, 0x0f7a4bf6,
+    0xf47e347a, 0x3ce3d7ea, 0xa805ed87, 0x1f3c00ff, 0xa6fb4ff8, 0xfd28e1a7,
+    0xbf89eb68, 0xf2df1cd2, 0x19edaf9d, 0x2a658c81, 0x1656ecd8, 0x56e122bb,
+    0x33e3dbaf, 0x39b1aed4, 0xdb8202ca, 0xec6021cb, 0xd6dae372, 0xed910a57,
+    0xd5af1269, 0xc88e72d2, 0xf1529d63, 0x5d05c127, 0x9465268c, 0x7d5aea4a,
+    0xa8e1ca74, 0x69893c5e, 0xb902dbb5, 0xdbd3990b, 0x8c07caa9, 0x9c1a6bb7,
+    0xd9ac9cad, 0x8bd54a7f, 0x855aafc8, 0x61943d6b, 0x4db50f5e, 0x55c376b3,
+    0x6bae6562, 0xb850a16b, 0x92328dec, 0x762c9b1c, 0x57f3c298, 0x719be3c6,
+    0x25a3179d, 0xc6676f9a, 0x70aa8295, 0x8739cdb6, 0x2ee1fbb8, 0x506df01a,
+    0x2487ca01, 0x115fa266, 0x5664cc50, 0xebc9ce11, 0xaad3c4d6, 0x971e85dc,
+    0xa8a84b3f, 0x0503ee6b, 0xcc8a597d, 0x88c43c5f, 0xbeac0a69, 0x8715cf9a,
+    0x67ce51b2, 0x6b63adbb, 0xc2ee7958, 0xb0c6f639, 0x902796cf, 0x1101e577,
+    0xdffd1888, 0xc4957f0a, 0xfa4fcb3f, 0x73d2219c, 0xfbf3ba55, 0xbe61d8f4,
+    0xbf6d29d7, 0x6ffbc62c, 0xfbfa7b3b, 0x1bc6d76e, 0xb77dfdfc, 0xfe0de36b,
+    0x69429d7e, 0xc6556875, 0xaf65ede5, 0x9f8c9588, 0xc53e2b54, 0xb4b7d517,
+    0x35c4aadb, 0x34aa9235, 0x0ed92b8e, 0x7aeacbd4, 0xaeafd24d, 0xf0570e2f,
+    0x7e6e436f, 0xe1ab6bdb, 0x800fa46e, 0x7edd3efb, 0xd39ed2dd, 0x4ecd850c,
+    0xf1a57584, 0x6ef5db5f, 0xd9f66dde, 0x0b85a28a, 0x4fdab647, 0xa485ac35,
+    0x441da7d0, 0x65b219b4, 0x2730b9cd, 0x4456d11c, 0x664882b9, 0x355b00ff,
+    0xf9b18256, 0x99b1034f, 0x9e83d70b, 0x960a19e9, 0x71add4b5, 0x53c8cf87,
+    0x50d30127, 0xa5e43181, 0xa3a63e47, 0x6ea3c872, 0xa2c42d72, 0x02b9bbad,
+    0x91e8bb75, 0x4231a516, 0x0201e1ad, 0x70d31e30, 0x3e99d4aa, 0x6503cce7,
+    0x7c03ab78, 0x2a8c4a71, 0xdfae65ec, 0x769491bd, 0x74b2e5e6, 0xc10ab8d4,
+    0x686fb090, 0x51148155, 0xd7854baa, 0x0040866d, 0xac55b2b1, 0x8be32be5,
+    0x5da3d7b5, 0x3b1772b7, 0xd236eb3d, 0x468d6b16, 0x65be45d4, 0xfe52b332,
+    0x4545f8d4, 0xbdeae8ad, 0x670dc866, 0xcb662763, 0xec95c395, 0x7211d2b6,
+    0x2abb8dc0, 0x2b6a9cbc, 0x0d56bc8b, 0x26b05b76, 0x7b8388d6, 0xa603ce32,
+    0x891a09d3, 0x9731c3c6, 0xc657b6b6, 0x3af0df2f, 0x685fd7a9, 0xd76bfded,
+    0x4547de6f, 0x04d8ee02, 0x2c85196f, 0xbd510fab, 0xcd8b310d, 0xc60b9ad3,
+    0x5ee12f37, 0x2c8a93dd, 0x69da5ea7, 0xa5099059, 0x677d18e1, 0x5b9521be,
+    0x8182558f, 0x73b7ae99, 0x469087d7, 0xad869d62, 0xaba2ce98, 0xae196fe4,
+    0x4eab65a6, 0xf55c2437, 0xcb8e1d56, 0x136b8f1c, 0xc206922c, 0x203dce0e,
+    0x830a2dc8, 0xf8e1562d, 0x7b163146, 0x26cf4e26, 0x2743223f, 0xdab6aed9,
+    0x94232aaa, 0xb1e6fb1d, 0x1ebaa7d9, 0x7c9da33d, 0x33d9a9ba, 0xb8d6acb4,
+    0x425e2939, 0xd26be52e, 0x1651e25c, 0xf58a036f, 0x5406960a, 0x0d861392,
+    0xdb7cae63, 0x9085b90b, 0x51cf2a04, 0xac77e563, 0xf9bbae56, 0x4cedb246,
+    0x71af5b7f, 0xac2c9a06, 0x715714a4, 0xa5d82f22, 0xd53da265, 0x32a198f9,
+    0xa88e3852, 0x57c6fed4, 0x32d78b45, 0x1b59eda9, 0x19b7ea98, 0xee184355,
+    0xbb78ef68, 0x0a5dc1ae, 0x0bd4ecb5, 0x98649597, 0x953c09b1, 0x763baf7a,
+    0x590b0de9, 0x5b7a212b, 0x23af6c8f, 0xb0a98530, 0x2d11a34b, 0x8d088b74,
+    0xc346d57d, 0xdb49a7fd, 0x6553372c, 0xa35a743d, 0x8125e16e, 0x481435d4,
+    0x694b555a, 0x06663160, 0x7d5215bb, 0xb20463d0, 0xedb62f03, 0xcfbf617c,
+    0xbe76dbd7, 0xebe7df30, 0x48a6c887, 0x32b0868b, 0xccbc3345, 0xcc1b35ce,
+    0xcfccf7cc, 0xf0339ddd, 0x756afd72, 0xbf6cfc87, 0x3de82dd9, 0xd3fbd1e8,
+    0xf28c5fab, 0x8716b41f, 0x00fff0fc, 0x02b966e0, 0x9d476040, 0xd2c269ad,
+    0xcddc4685, 0x05c50b73, 0xf9bcf18e, 0x60046666, 0x9467448e, 0x37af8af8,
+    0x7254baf0, 0x00ff0d6e, 0xe55468c5, 0xf238fe38, 0xfa24d2eb, 0x4df32db3,
+    0x569f447a, 0xaf69be65, 0xccea9348, 0xe935cdb7, 0x96597d12, 0x22bda6f9,
+    0xdf32ab4f, 0x49a4d734, 0xe65b66f5, 0x3e89f49a, 0xd37ccbac, 0xd527915e,
+    0x6b9a6f99, 0xb3fa24d2, 0x7a4df32d, 0x65569f44, 0x48af69be, 0xb7ccea93,
+    0x12e935cd, 0xf996597d, 0x4f22bda6, 0x34df32ab, 0xf549a4d7, 0x9ae65b66,
+    0xac3e89f4, 0x5ed37ccb, 0x99d52791, 0xd26b9a6f, 0x2db3fa24, 0x447a4df3,
+    0xbe65569f, 0x9348af69, 0xcdb7ccea, 0x7d12e935, 0xa6f99659, 0x355b65bb,
+    0xe492d2ef, 0x8a0835ed, 0x42ee5314, 0xa841ccc2, 0x6390fb32, 0x9982dcb7,
+    0x093f95fa, 0x5c47eb47, 0xa447e34d, 0x1fbbbf39, 0x5e6b67fd, 0x6b2c7fe8,
+    0x8de50fdd, 0xb1fca17b, 0x963f74af, 0xf287ee35, 0xfed0bdc6, 0x1fbad758,
+    0x8aa11acb, 0xd6c8dcc7, 0xdbc32445, 0x3975f150, 0x0e961932, 0xb8da6ed6,
+    0x1f39a939, 0xd9911af9, 0x8e56b30f, 0x1a9b5c51, 0xd82e5444, 0x4a7dcaae,
+    0xad7145cd, 0x35a36a59, 0x31c0d951, 0x451101c2, 0xcba1ad46, 0xe50dc8af,
+    0x9939e28d, 0x51964607, 0x18336bd7, 0x347b8dc7, 0x5ee75e51, 0x82f6968d,
+    0xe53ed5aa, 0xf9528b2e, 0x9bc8a671, 0x87fc95a3, 0x52627a5e, 0xac7cb815,
+    0x2bd9cde0, 0x278dee37, 0x82855045, 0xd7c5532b, 0xe662d506, 0x6d094dc7,
+    0x27c4668b, 0xc1e675a9, 0x7bd58919, 0x6cbd8eb8, 0x88e76788, 0x225ad61b,
+    0x8ab158b4, 0xc7ea5ea1, 0xaa09c396, 0xdc5ad475, 0xaad40358, 0xc8d8e7e8,
+    0x1a735980, 0x6b4ea992, 0xb66a4a51, 0xcd7ebd57, 0x8c24284d, 0x96129c81,
+    0x99922041, 0x11402582, 0xc7c81400, 0x1acb1fba, 0x63f943f7, 0x2c7fe85e,
+    0xe50fdd6b, 0xfca17b8d, 0x3f74afb1, 0x87ee3596, 0x4fb8c6f2, 0x87b8f06f,
+    0x00ff69f9, 0xae6e8753, 0xb38e9524, 0x636aa394, 0x8a9749fe, 0x7ff29abd,
+    0x310a5978, 0x0c49f212, 0xae3e968f, 0xba292437, 0x7631b6ac, 0x86989260,
+    0x89bcca53, 0xb2ef959d, 0x225a9deb, 0xdd466f2b, 0xabdcf46a, 0xcde98100,
+    0x7c087b72, 0x8347d60f, 0xec629726, 0x67b75251, 0xed693ffb, 0xde9e3e9d,
+    0x9c47ea12, 0x17fed93e, 0xd163533f, 0xbfd9c6d3, 0x236b214f, 0xaed82d16,
+    0x5233aed2, 0x449d7ebd, 0x69f85283, 0x58d6b9cc, 0x47c035e0, 0xa748242a,
+    0xabd45d7e, 0xfcdd7681, 0xd423533e, 0xb63d7a5a, 0xe4e938ae, 0x068b2c4d,
+    0xf29776c6, 0xc06209d9, 0x7eee9a88, 0x6d9e874d, 0x973433f5, 0x2f7bc5f5,
+    0x5a511469, 0xef51330b, 0xbd56aa53, 0x93a4b763, 0x3a0ca0d9, 0xecabb73c,
+    0x18f94ad6, 0x87187264, 0x51bd4a78, 0x2e6d0c4a, 0x2eb857a5, 0x9ce6c855,
+    0xf28a3511, 0x4bdbd505, 0xda45ca2d, 0xbeb26a92, 0xcbfb6ae0, 0x288b5d1e,
+    0x333366bc, 0xb445ad8a, 0xe5f352d5, 0x28b4f175, 0x3641b2f4, 0xcba574d0,
+    0xdec82ec7, 0xe6717de4, 0x4a57aeb0, 0xf512d777, 0xe6c58e61, 0x62ab949b,
+    0xa14bf26b, 0xca76c82d, 0x4cf3abb6, 0xca5ed92c, 0x8800ba2b, 0x2686cb41,
+    0xe39c3a4c, 0x2fab1015, 0x56a66aab, 0x74224f9e, 0x1ac9d7ea, 0xb8c675b2,
+    0xabc56405, 0x2ba30b23, 0xbd6cc55b, 0xa21386b5, 0x14143c7b, 0x8bd5c35b,
+    0xace151cd, 0xa1a755d3, 0xb95e3708, 0x615fc598, 0xb15bb8b2, 0xb6aeaa15,
+    0x961ca03b, 0x66b7192d, 0xa1348448, 0xd4ae156c, 0x131c494e, 0xb5ceaf8d,
+    0xf730b678, 0x9da87d30, 0x2795cbb3, 0x20d05dd8, 0x2ff319ea, 0x1773b5a8,
+    0x5d8ada25, 0xc4d9d5eb, 0x45c810fe, 0x51c694ba, 0xa4bcf918, 0x4dfbb22a,
+    0xbe355d85, 0x6259bed9, 0x05dd2d2a, 0x0daeab2c, 0x76d21593, 0x4a3b99b3,
+    0x6e03125f, 0x5946525f, 0x51509ce1, 0x09bf20aa, 0xbb2e255b, 0xeb483d16,
+    0xc026891f, 0x14939d89, 0x10e6c614, 0xaa97b115, 0x4d51c65a, 0xf572a568,
+    0x9403b6a1, 0x49f2e67b, 0x7b6101e7, 0x8708d5a5, 0xccaeb5a0, 0x55756028,
+    0x802c0b77, 0xa296caac, 0x24a34a11, 0xcc58c18f, 0xe59e427e, 0x11c05491,
+    0x97da94e2, 0x988bd0fd, 0x0cb8a12c, 0xf0cd1b95, 0x475e2395, 0xc7cc7533,
+    0xaf6a1534, 0xaacb6c84, 0xc4f32795, 0x976395b1, 0xba15cda9, 0xd522b2bc,
+    0x9302f5f3, 0xca669920, 0xe46df42a, 0x399e469f, 0xc2accff7, 0x26ad3651,
+    0x32a15b39, 0x98138708, 0x32f372e7, 0x01f5917c, 0x1863026b, 0x22acb542,
+    0x3c67d848, 0xde3100a0, 0x03314544, 0x3b33df11, 0x9c411d6b, 0x1f6e7cbd,
+    0xcbb38f13, 0x6a16c33c, 0x229e4250, 0x6481e551, 0xe2f7ef10, 0xcbc1cf74,
+    0x1fd6aaf5, 0x00ffaaf1, 0xf7a0b765, 0x4eef47a3, 0xc8337ead, 0x1f5ad07e,
+    0x00ffc3f3, 0x24c59a81, 0x9772940b, 0x31b10f32, 0xe81827dd, 0x29eaaaa8,
+    0x590110fe, 0x9c7c606b, 0x8ddcbfe5, 0xd7e57579, 0x85c64a97, 0x5b2cab91,
+    0xcb25d699, 0xcf416160, 0xfc1a243e, 0x6a77e5bf, 0x9d1747c6, 0x4a5567c7,
+    0x2d05b747, 0x7396b5a1, 0x1e6236b4, 0xf78261fe, 0x7c44e27e, 0xb960187f,
+    0xf417fd61, 0xd21dba27, 0x67664a67, 0xb7192296, 0x2f5eee24, 0xe5ddcb97,
+    0x19d814d5, 0x4d536f63, 0xa5ad14b0, 0x72262f03, 0x2542ded6, 0x49000496,
+    0x11e223a0, 0x3cd0f8f2, 0x62e0c8e5, 0x469e688f, 0x9ff62c81, 0x449cf224,
+    0xbb733fed, 0x5ccc48bf, 0x84381ae2, 0xebfab0d8, 0x93ee8a1b, 0xcd4e4c41,
+    0x9982492b, 0x81e5e688, 0xaebf8fee, 0x036ebfc9, 0xed95bbae, 0x9f620353,
+    0xb742a451, 0x9b5c306c, 0xf390c890, 0x937b4114, 0x35299131, 0xc5047b85,
+    0x2d05947d, 0xc1f95f23, 0xfb3fdc81, 0xb2648da8, 0x8dadefc9, 0x0b8c0194,
+    0xda63ae0d, 0x11a8ca21, 0x4950e5e5, 0xe225c535, 0xec720c44, 0x950fc37c,
+    0xca4510b6, 0x913e902e, 0x2c8a7f17, 0xc54b92db, 0xfc9de82e, 0xa9d3fb59,
+    0x4277d2b1, 0x4c7f6927, 0xdc3c31fa, 0xe4764bbb, 0x76609adf, 0x7977dddf,
+    0xc32c8475, 0x629e5adb, 0x2af56cbb, 0xd56db3d4, 0x40930997, 0x3292961a,
+    0x29dd4b7b, 0xfc923e6b, 0xfad82979, 0x7bca1a6d, 0xca3b53c5, 0x0d98c2d2,
+    0x048e94e7, 0x8f784366, 0x7ef76de1, 0xb696a4f6, 0xc988c418, 0x11441100,
+    0xc80c28cf, 0x9711c4c4, 0xa7944770, 0x4a9d37ba, 0x0fb626da, 0x010906ba,
+    0x1c13f18e, 0x6f145bc2, 0xc71b1313, 0xe5756292, 0x5d5e97d7, 0xec791e15,
+    0x14191af9, 0x28dc5fd9, 0x94161b4d, 0x8b3a797b, 0xfc40066a, 0x1d5112a3,
+    0xa7523fc5, 0x68fd28e1, 0xbe523deb, 0xae5e6151, 0x01592b6b, 0x24239c38,
+    0x14f68b12, 0x1a37eaa0, 0x11503e6d, 0xb019768e, 0x2232e6b6, 0xd9799d99,
+    0x7dc0a55e, 0xecf5aa15, 0x556a0df1, 0x60afe3cc, 0x9112b8f0, 0x298c4f5c,
+    0x9d64e258, 0x42639f61, 0x10663c86, 0x0cae48f3, 0xca6df7c6, 0xe2596dd8,
+    0xd10f87ac, 0x69b86315, 0x0d5a4d4c, 0xb2e77d11, 0xb4872d70, 0x1284f505,
+    0x61b2482b, 0x241e46c4, 0x2b2fa66a, 0x25ace8c4, 0xc442bd96, 0xd6011706,
+    0x565dea7a, 0x3c44313d, 0xb94e6410, 0x90e35f62, 0x51d76bca, 0xf2e2a53d,
+    0xacbd1a96, 0x21cecdb1, 0x6ad4a47d, 0xb4389cf1, 0xd36c8051, 0x70aac6a8,
+    0x6b3d2b6c, 0xea515d90, 0x1c239123, 0x8d5b2693, 0x59657cdc, 0x167e7c19,
+    0x2ccf61a6, 0x664d0e67, 0xcd5a151b, 0x305631aa, 0xafd16370, 0x762c796c,
+    0xd995dd89, 0x3c58f9ba, 0x96a3b194, 0xea85fcb8, 0x632eb758, 0x47abc219,
+    0x4553ca68, 0xc04f8785, 0x66496f2c, 0x299812f8, 0x8d990132, 0xcb43bba7,
+    0x82b46d90, 0x8756cb1c, 0x80507087, 0x59b15c34, 0xa2181392, 0x929aaef6,
+    0x0177cafd, 0xcdfdf378, 0xf6d4be23, 0xc36de49e, 0xcf966978, 0x31105f4a,
+    0x94f78d18, 0xca63b4c4, 0xde28894b, 0xb86d4c23, 0x0e6a5db9, 0x35dc0da3,
+    0xe3825886, 0x2c997397, 0xce837844, 0x47eec71c, 0xdf98379a, 0x88a13d50,
+    0xd06aab02, 0x853bdc35, 0x4dad3880, 0xfd710597, 0x8125fb88, 0x72c11401,
+    0xef82d4ef, 0xf83cd518, 0x32aca0e7, 0xa8dc6afb, 0x811d2e58, 0xb4a5aeae,
+    0x0b7ec2a5, 0xd3662ee6, 0x3c26b235, 0x6ff22052, 0x6fa18adf, 0xac35618a,
+    0xca951561, 0x0e078cda, 0xb969614f, 0x47b88ab5, 0x174a3983, 0x23991266,
+    0xfe88f99d, 0xe56a0cec, 0x9760d69c, 0xc38ff215, 0x2f5cb526, 0xddec430e,
+    0x4f7710a9, 0x0249eca8, 0x460355ab, 0xb564d2e7, 0x03015496, 0xa410c310,
+    0xf143268e, 0x6e6e13e4, 0xa0870f86, 0x152a44d7, 0x1897f5f7, 0xacdb05c3,
+    0xae9c6280, 0x12b20172, 0x4e3b5230, 0xe66f56b0, 0x66e673ae, 0xc36437cf,
+    0x502dbf70, 0x6f697eaf, 0x4e1a6e0a, 0x4e1d6dc1, 0xa7b9aa4e, 0x7ea3e0da,
+    0x7938626d, 0x9bb344bc, 0xbc87a0ee, 0x1c3b7c70, 0xd3f96a85, 0x1927a464,
+    0xcec923de, 0x7fbf7310, 0xa7b66929, 0x6bb0e488, 0x16bddbc4, 0x9dc303e3,
+    0xc156b972, 0xb7196763, 0x6251e582, 0xcf359d72, 0x0e5a15f8, 0xbcc6f228,
+    0xe052afec, 0x9dd78a3e, 0x075cea95, 0x9ce15ad1, 0xfbd04586, 0x35e49c6f,
+    0xe0f58aa2, 0x215639a1, 0x4855d37e, 0x60a9f240, 0x9b87223e, 0xe4dc626e,
+    0x35e5748a, 0xd052b729, 0xb4d2ad74, 0x55d6da10, 0x09acfcbe, 0x8c1710fe,
+    0xb3c60ea6, 0xc4f219ef, 0xb50c8591, 0xa4df2978, 0x6189c2ac, 0xf17528fe,
+    0x7d2c6f6e, 0x5f58a3ce, 0x6b5fa77c, 0x536dbde6, 0xaf7d6de8, 0x4fb5f59a,
+    0xbef6b5a1, 0x3ed5d66b, 0xf9dad786, 0xfa545baf, 0xe66b5f1b, 0xe8536dbd,
+    0x9aaf7d6d, 0xa14fb5f5, 0x6bbef6b5, 0x863ed5d6, 0x3a2b72d1, 0x72b1d11c,
+    0x340f6be6, 0x0fdbe27d, 0x3e00ffdf, 0x7acdd7be, 0xdad0a7da, 0xeb355ffb,
+    0x6b439f6a, 0xadd77ced, 0xad0d7daa, 0x266ebee2, 0x2f63e23b, 0xc6febb57,
+    0x355ff3d6, 0xaffd3f33, 0x7d6de857, 0xb5f59aaf, 0xf6b5a14f, 0xd5d66bbe,
+    0xdad7863e, 0x545baff9, 0x6b5f1bfa, 0x536dbde6, 0xaf7d6de8, 0x4fb5f59a,
+    0xbef6b5a1, 0x3ed5d66b, 0xc66ad786, 0x23720e63, 0x3bd91bf6, 0x7fea7c63,
+    0x5603558f, 0xfcbb65ad, 0x604d3117, 0x7247027f, 0x48a648de, 0xa648668a,
+    0xef999977, 0xf99e9999, 0xe92c9f99, 0xeb97839f, 0xe33fac55, 0x6fcbfe55,
+    0x8f46ef41, 0xfc5a9dde, 0xa0fd9067, 0x87e73fb4, 0x350b00ff, 0x1fe37fc2,
+    0xd400ff11, 0x75fb4fdc, 0x5e97d7e5, 0x50f5fa5f, 0x977abf23, 0x2d6700ff,
+    0x35439671, 0xab32c64e, 0xe8b13630, 0x4d94abed, 0xa78b979b, 0xd80c1254,
+    0xcc77b199, 0xf12e4f8c, 0x5997c7bc, 0x919f76aa, 0x0b38d9b9, 0x0a7a75b5,
+    0x054981af, 0xc65e7d52, 0x370be7a1, 0xd689a079, 0xa0c054b6, 0xde9c9563,
+    0xdab184d3, 0x78729c9c, 0x759d724a, 0x27d8ebe3, 0x45466dde, 0x2fe2a3d0,
+    0x5d25a47b, 0x15d80082, 0xc4228f72, 0x195c5058, 0xb6f0c660, 0xf3de2ec6,
+    0x913c2894, 0x5352672d, 0x32ca5937, 0x996c914f, 0x9c2cbf6f, 0x913be5c6,
+    0xc4999f61, 0xcd2c6116, 0x0da59664, 0x32e9d1f7, 0xe72c9325, 0xbef87947,
+    0x77f7242f, 0xcb2daeef, 0x70acae53, 0x9748f861, 0x381baa8a, 0xb0a92e2a,
+    0x3cce25d3, 0xe632318d, 0x4fc0659e, 0xd1868c28, 0x5cb2e13b, 0x23af1d2c,
+    0x3edfcb92, 0x556b7a24, 0xd9dcce7b, 0x13db982e, 0x91208402, 0xab80e3c9,
+    0x8994aea4, 0xd9bf0fa6, 0x4c0faf0a, 0xc4db2acb, 0x42d2ab30, 0xde6c74ac,
+    0xd33d8352, 0x87244b12, 0xf3ea4c91, 0x1908f444, 0x4c14e92a, 0xc55efdea,
+    0xb1c3b594, 0x7965a9c2, 0xb01a4c4d, 0x73b3e395, 0x1632f226, 0xcbb6d56f,
+    0x9a59ce40, 0x98c826e2, 0x45aed759, 0x981a6d22, 0xf02c142a, 0x397470a1,
+    0xac52a87d, 0xe665cf69, 0x88a8cd61, 0x85e4d92e, 0xb9a63757, 0x4b5a7581,
+    0xec016b1e, 0x5b13d668, 0x6b8db58f, 0xa810baec, 0x0da7e44c, 0x81bba773,
+    0x47c9c871, 0x8889645b, 0x2417414c, 0x3618efc8, 0xcc216a70, 0x8ec998b3,
+    0xbd5ed378, 0xf1c2f596, 0xaa73958a, 0xb323942c, 0x426cfb72, 0x2ed215e4,
+    0x6ffcf9a2, 0x69b8ab64, 0x9c953640, 0xd40a890c, 0x58c9d6e4, 0xd46c9562,
+    0x4daa01b7, 0x88d25c16, 0xc1072120, 0xcbc32e47, 0xdeba1bae, 0x867fd35e,
+    0x62b05aa8, 0x33461d30, 0x8e76a69c, 0xd14e29ef, 0x3bba23f7, 0xffe535a2,
+    0x5f5eaf00, 0xd5e5f5fa, 0x5bcbdf00, 0x5600ff2f, 0x523f211b, 0xfd28e1a7,
+    0xbf89eb68, 0xf2df1cd2, 0x58a9af9d, 0xb011768a, 0x249f2992, 0x6666340c,
+    0xbe238a7f, 0x121e7975, 0xf1695ca3, 0xd72963ae, 0xac52807d, 0x1376b2e1,
+    0x854db52d, 0x474d3b3d, 0x898a0263, 0x1e60b5e7, 0xf2b6aab2, 0x920d07b6,
+    0x4754adeb, 0x5af35a21, 0x7e9d1e6d, 0x37b97ddb, 0x407e4f0b, 0x11aedd2a,
+    0x6a61bf63, 0xdace1b59, 0xb7edbbe1, 0x765b3f55, 0xedda152d, 0x92d32a78,
+    0xa79267bb, 0x19c2d234, 0xc65836b9, 0x0cade455, 0xd8091c34, 0x9ac5a485,
+    0x55fbe7ca, 0x0fa72c49, 0x1085c7d5, 0xcad14d78, 0x573abd32, 0xbb399501,
+    0x2a20ab42, 0x8c36b0d8, 0xab00bb46, 0x1c376cad, 0x4b8531ae, 0x95385288,
+    0x754bb062, 0x7dace241, 0x42cd8e51, 0x63415ea0, 0x394b9459, 0x69a0c1b9,
+    0xb7b4fb9a, 0xefe6528e, 0x957a510b, 0xf1c36bca, 0xd22a7304, 0xe3ca5c9d,
+    0x575376f3, 0x0d97089e, 0x3d5016b2, 0xdbb9f129, 0xb8cd6300, 0x559231eb,
+    0x57ad1ede, 0xabcb6231, 0xed8bb536, 0x56165bca, 0xb60d69b9, 0x9c1c66b7,
+    0x52b6e92b, 0xaed1ea82, 0x853ed9c6, 0x3177c225, 0x94b635c2, 0xdbe055d5,
+    0x70b21eb5, 0x5683f6c8, 0xf3097b52, 0xe4358c4c, 0x47910e6b, 0xc60d2c8d,
+    0x3d12d777, 0x156d3877, 0x4a328cb8, 0xb8d9c5a8, 0x6d7bb7cb, 0xccaccc1b,
+    0xbacc6a8f, 0x356b0aae, 0xb5e2aeaa, 0x983baf4e, 0x5a01ae4a, 0x8c11c708,
+    0x5544dac9, 0xde6e59ec, 0x2b4f70b8, 0x95d3e629, 0x64c69dae, 0x5995977a,
+    0x37cfaab5, 0x484c3b2b, 0x776989cc, 0xa6ec589a, 0xbd5e2b5b, 0xeb1c940b,
+    0x39d6d51c, 0xeb62be4c, 0x536e141e, 0xdd6ba1b4, 0x54c7148f, 0xbc737a46,
+    0xac6a7714, 0x4d8ebd56, 0x4ee660f9, 0xaaaa8bbd, 0x954666a2, 0xd34a594a,
+    0x29a1eb66, 0x28e652b5, 0xda6d826c, 0x78a7d816, 0x59ac090c, 0x8da26573,
+    0x122facae, 0x66e99634, 0x89e5aedd, 0x75205fad, 0x15b69620, 0xd2b71259,
+    0xad291882, 0xdbba9fb1, 0x73bc325c, 0xa0aafdb1, 0x66d2d864, 0xed7a1133,
+    0x8d51ce27, 0x76b14aae, 0x4f549b95, 0x9aca9593, 0xcaef4ced, 0x0be2f1e1,
+    0x9e011f5c, 0x4e09bab6, 0x3982c20f, 0x4f54032b, 0xeddf11b7, 0xc9e90ea3,
+    0xa9354f48, 0x4e944c74, 0x3a59dfed, 0x2e04bb0b, 0x0addf6e2, 0x7a9ec8a2,
+    0x76c45ac7, 0xa42c0f81, 0xa3dc0999, 0xfb8093c5, 0x145e7dbb, 0x882b00ff,
+    0xfd9f967f, 0xcbc1cfd2, 0x1fd6aaf5, 0x00ffaaf1, 0xf7a0b765, 0x4eef47a3,
+    0xc8337ead, 0x1f5ad07e, 0x00ffc3f3, 0xe848f584, 0xc059ecac, 0xaad3bc59,
+    0x716b93a1, 0xd6ab10f9, 0x26778072, 0x09d34715, 0xd1efc068, 0x0b6f3c7f,
+    0xf624a666, 0x9998ee98, 0xd3fb89ef, 0x71f77afc, 0x5fa7bff0, 0x1a858f64,
+    0xd82f348b, 0x846064a5, 0xcab4546c, 0xd83811cf, 0x06931aa2, 0x14771444,
+    0xdd316d41, 0xb3e4053a, 0xd6822c59, 0xd90beb5c, 0x65c1361b, 0x0d90b431,
+    0xa604b286, 0x6947a63b, 0x5643bbdb, 0xac58d933, 0xaf601db4, 0x80704b19,
+    0x65e4c1ac, 0xa65f5771, 0x03883028, 0x864c0f54, 0xd5766420, 0x2a775e51,
+    0x51bca1b1, 0x015bca10, 0x49b2cca5, 0xc4174876, 0x4a44dd57, 0xeb268f9e,
+    0x33730f22, 0xcadf581a, 0x2629bc5c, 0xe7e5869a, 0xcb1b85d9, 0x73b8e69d,
+    0x7e9c004e, 0x9676483b, 0xce7b8c17, 0x3caf4497, 0xe58425a9, 0x9a4c2b53,
+    0xceef69aa, 0x7496d7d5, 0xf3bc8741, 0x6f118418, 0xac7ecf3b, 0xd6e7ad2e,
+    0x7b4db55d, 0x484c8b60, 0xa47b415a, 0x61b01558, 0xd6fb9dc9, 0xbb9f20c8,
+    0x7283671a, 0x6dfdb1b7, 0xfd86bdba, 0x5f5e9d8a, 0x39e8d473, 0x3b6ffb7c,
+    0xfab66f73, 0x5dca5071, 0x962356a4, 0xfabc54c1, 0x9eeff1c4, 0x125a4a57,
+    0x7666ded1, 0x7ebee33d, 0x591883fe, 0x5c8ea54b, 0x371f2ff3, 0x5c96349f,
+    0x49857bc4, 0x9867406f, 0xc785b788, 0x593e458c, 0x72304e9d, 0x5e1aa3d7,
+    0xb35f7c5c, 0x86c76714, 0x74ebd4f7, 0x1922db27, 0x1077bfde, 0x55bfeb7e,
+    0x93395bd1, 0x4c668aae, 0xed6494a8, 0x625855a5, 0xb5ae33d1, 0x630641bc,
+    0xb844e261, 0x62732119, 0xee1e6667, 0xf47b19ec, 0x63ef447b, 0xd62ce4b1,
+    0x7b7fcfeb, 0xac0e2eba, 0xf7eec5f8, 0xd5dfcff2, 0xc07aa19a, 0x2b2bb955,
+    0x05d38695, 0xd447c916, 0x334c5951, 0x3c53f9a6, 0xa444cb75, 0xa71dc60f,
+    0x97ed48bf, 0xc9ec5bec, 0x4dbbd51a, 0xd7b3bfa6, 0x7584700f, 0x87245d58,
+    0x50be54f0, 0xf71ab91f, 0xa7bff071, 0x173eee5e, 0x91ecebf4, 0xbafda3f0,
+    0x1a78273e, 0x97ea5831, 0x12cd5d55, 0xbddfc811, 0xd524c54e, 0xdb1e33a9,
+    0x87652ec8, 0x428539b0, 0x7ef782a1, 0x127eaa2e, 0xb88ed68f, 0xcd21fd9b,
+    0xda2900ff, 0xb846d7fd, 0xad4d9f73, 0x4500c89d, 0xa6395168, 0x1110c246,
+    0xc9148105, 0x8e367914, 0xd8d088f9, 0x93ac5270, 0xe63240e8, 0x0e4e135f,
+    0x414ed36c, 0xeaa61d30, 0x58aaa4b9, 0x7907664b, 0x72466e0e, 0xec6048b0,
+    0xb806e341, 0xa17d9a5a, 0x902abc99, 0xb02b4576, 0x7c994b4b, 0x4d956357,
+    0x30412202, 0x2e597e23, 0xb3832861, 0xc11a8c07, 0x8676696a, 0x41aaf066,
+    0xc1ae14d9, 0xf1652e2d, 0x34558e5d, 0xc0048908, 0xb964f98d, 0x260da284,
+    0xe90e3249, 0x6911f62a, 0x88bfdd33, 0x196accfa, 0x1185adef, 0x9d58de3d,
+    0x6235ee61, 0xf45ee7b5, 0xe1e4c463, 0x812ad0a7, 0xd89030d6, 0xbeb8d250,
+    0x3211c181, 0x01c98505, 0x260626d3, 0x92174fae, 0xd1d6cdc8, 0x2afcd43a,
+    0x2c5183be, 0x32d63187, 0x4e75ac78, 0xce47a582, 0x406c58d5, 0x566953c7,
+    0x4dabaae7, 0xb69a7dbc, 0xbcba59eb, 0x316e59aa, 0x9c8c56c3, 0xc5666b5e,
+    0xc70e5d34, 0xbbaa9e2b, 0x5ff7bc14, 0xe8fa5367, 0x91f934ea, 0x55ebba6a,
+    0xb0ea16bb, 0x70a92da5, 0xa0b269ba, 0xe5d6bab0, 0x6f695f7d, 0xee3a503d,
+    0xca8ab7f6, 0x5cf72762, 0x1057fe29, 0x3f2d00ff, 0x8b38e4ea, 0xa56f9b22,
+    0x959b048d, 0x67db1444, 0xa19ab20f, 0xb2be0709, 0x098f7a8a, 0x8987679e,
+    0xb0e5b605, 0x83db80cf, 0xc91c7ee2, 0x5ae11db3, 0x1897b875, 0xa39013aa,
+    0xf435850c, 0x832e1789, 0xd4412621, 0xc7ce9583, 0x07711012, 0x5a96accb,
+    0xe2ebb4c8, 0xbcc85ce8, 0x344e0011, 0x2dcbaed2, 0x400d8b14, 0xc25c204d,
+    0x92b0d8e0, 0x3cc608da, 0x2ae6c668, 0x295b5783, 0xb842a642, 0x82178058,
+    0x2c2c206e, 0x56632b5c, 0x4164102d, 0x058335c0, 0x779429bf, 0x337100ff,
+    0x62fd72f0, 0x6afc87b5, 0xe86dd9bf, 0xfbd1e83d, 0x8c5fabd3, 0x16b41ff2,
+    0xfff0fc87, 0x503de100, 0x9f2d00ff, 0x13976ea8, 0x004c8795, 0x37de52c7,
+    0xb4f3750f, 0xcccd0e7f, 0x7f32ec7b, 0xfe298d8d, 0xafc2793d, 0xe87bb8a8,
+    0xafc2799d, 0xe87bb8a8, 0xafc2799d, 0xe87bb8a8, 0x57bf7d9d, 0xf43d5cd4,
+    0x547db84e, 0x9dcc85ee, 0x192b59fa, 0xc303af14, 0x1775d2a7, 0xb8126a7b,
+    0x4d6ff3c3, 0xbc63e15c, 0x14a698a4, 0xaa6d4444, 0x02c07287, 0x2f2d2c2d,
+    0xaac305fb, 0x84e5143b, 0xe111541d, 0x811c1b99, 0x302bdb8a, 0x4ef98de6,
+    0x59626d23, 0xb5a3d54a, 0x10dba598, 0xa370c60d, 0x1be15341, 0xb4123a54,
+    0x6099caf0, 0x04c9b2cf, 0x68c6ab81, 0xf872218f, 0xcb2447ea, 0x2b05369f,
+    0xf3e11d0e, 0xeb8a3a23, 0x62405cd9, 0x9f10db4b, 0xc7e7626d, 0x76a4f110,
+    0x90e05ed3, 0x630f554a, 0x7f788767, 0x7be21392, 0x66621474, 0x0ed4430d,
+    0x2f300776, 0x77e4399a, 0x1db768d7, 0xe3d73e9d, 0x7c3887b7, 0xddbc3a62,
+    0x4eec2f29, 0x2ee52de2, 0xb3401491, 0x5567126f, 0x76306396, 0x87eb15dc,
+    0x9903e6d6, 0x85b41996, 0xeec4587e, 0x9128382f, 0x7fb27251, 0xad6ad6c1,
+    0xe65251db, 0x10790e2f, 0xc33d5cac, 0xaf37d6b0, 0x04536949, 0xb0c01bb1,
+    0xbe78f32d, 0xc7bffc36, 0x35ca25a4, 0xaac6cbba, 0x80375c14, 0x88931dea,
+    0xe0c9af90, 0x8971689e, 0x20ca0a09, 0x222666c8, 0x0f864063, 0x58165a2b,
+    0xe1ddfab0, 0xac29c8fd, 0xb16d6f9b, 0x58d61b33, 0xd27dbc11, 0x8d383786,
+    0xcaa6c85c, 0xd16a3d3b, 0xbff53361, 0xa737f3c3, 0x6aa0d7b7, 0x888afdad,
+    0x8d385129, 0x3ef6df93, 0x23930c9c, 0x5daded60, 0x2e3caf6e, 0xe8e18059,
+    0x0ced9582, 0x4cc59818, 0x7998af73, 0xde707ec3, 0x8d37a239, 0xa8afc279,
+    0x9de87bb8, 0xa8afc279, 0x9de87bb8, 0xa8afc279, 0x9de87bb8, 0xa8afc279,
+    0x9de87bb8, 0xeee42c65, 0x3fa3ebbe, 0x5b9c004c, 0xb6c1c3c2, 0x8c95a667,
+    0xe6bd920a, 0x01409167, 0x6f3b33cd, 0x7e2af533, 0x8ed68f12, 0x21fd9bb8,
+    0x2900ffcd, 0x14d7fdda, 0xaccc3eba, 0x7e7f852a, 0x1c5bc602, 0xf41f058b,
+    0xf19f2b45, 0x75f93b5b, 0x7b959b8e, 0x2c8c9550, 0xaba27604, 0xb8595fc8,
+    0x0371e75d, 0xb63bdee6, 0xa0cbdbee, 0x10f56863, 0xa26f537c, 0xe86bdc9e,
+    0xbfa588ed, 0x5be642b7, 0xed88f1bf, 0x7ab4b1a5, 0xb9293e88, 0x356e4fd1,
+    0x14b17ff4, 0x5ce8f677, 0x31fe77cb, 0x9566b41d, 0xe25394f4, 0xe4d5a92f,
+    0x98d4bd8f, 0x687f3f89, 0x71b903d7, 0x13c7ae17, 0xeebaa665, 0x0e0be558,
+    0x66dff049, 0x83396c43, 0x5a90b200, 0x00834962, 0x6d4c443b, 0xed625e1a,
+    0x9572d41a, 0xb4248778, 0x143d8eaa, 0xb14a93d9, 0x0cb90b19, 0xa8202141,
+    0xb51a64b9, 0x868eed54, 0xcbbfe65e, 0x4b6fef61, 0x56f56d6c, 0x1f46d124,
+    0x3e18938b, 0x18db6c63, 0xea6d713a, 0x25585bb4, 0x3941b633, 0xc15b6fbb,
+    0x66dfd267, 0x0414a916, 0x63bf9da6, 0x1205a9fc, 0xaac82e99, 0x3d6a9321,
+    0x0b677cb2, 0xea0b54af, 0x89242273, 0x0ac040fb, 0xc27700ff, 0x0f71e59f,
+    0xaffed3f2, 0x00ffed15, 0x2c7fc7b8, 0x8f6fb5e3, 0x8f88b3b8, 0x070ee027,
+    0xd5c6d5c9, 0xe148ece1, 0x2a16455d, 0x94968bc5, 0x72f217eb, 0x0aad9ccc,
+    0xa614674d, 0xac3a24ba, 0xdc36c75c, 0x4214ce5a, 0xd87b7131, 0xbe7eee8e,
+    0x17c51b2b, 0xb2d2b238, 0x6bf66c89, 0x806c6bf9, 0x10471caf, 0xd12b3ac7,
+    0x626b455f, 0xb5870a56, 0xe1b979e2, 0x63b723ce, 0x25f69929, 0xb8b364ca,
+    0x3177bb70, 0xc689f556, 0x3288b794, 0x95365b36, 0x9776ca8f, 0xebd7b436,
+    0xb0ebe7d3, 0x3a6da442, 0xd9f8e5ce, 0xb1e5ab17, 0x2e54c6de, 0x6dd0a070,
+    0x097e7570, 0x93eb3c56, 0x83ed65f0, 0x00db2a5b, 0xba2c179b, 0xd363cb49,
+    0x3a2405d7, 0xe163e33a, 0x16122354, 0x71ac887d, 0x335e7c05, 0x65f12e8a,
+    0x64d76484, 0xad0c3941, 0x8ed772d6, 0xeebd0521, 0x675fd0e8, 0x21028942,
+    0xcf103bd5, 0x6670d663, 0xb75daf44, 0x954b5cc1, 0xf672a4c8, 0xc96cdd32,
+    0x7a950c60, 0x7ad867cd, 0xf8b65eeb, 0x75817231, 0x3d02fac4, 0xf83b799c,
+    0xcf9c263b, 0x21be760f, 0xc4b19aa5, 0x7866ab95, 0xcf9c2bb3, 0x7dcdadf2,
+    0xeca6209e, 0x1e268c7d, 0x432233fe, 0x8db32229, 0xba8e6453, 0xf6af6919,
+    0xfccceddf, 0xad58bf1c, 0x1a00ff61, 0x7a5bf6af, 0x7e347a0f, 0xe3d7eaf4,
+    0x05ed873c, 0x3c00ffa1, 0xaa19f83f, 0xf5b3e51f, 0x00ffd00d, 0x7ef71f93,
+    0xace29de2, 0xeb5171ab, 0xcd9fd9b1, 0x792a69d1, 0x31cb1982, 0x25701032,
+    0x5e2ee423, 0x6366dc52, 0xdaee185c, 0x9f63c738, 0x6de4c998, 0xaa7dc94d,
+    0xbc33b9bc, 0x7b60814b, 0xc694dc75, 0x504096f5, 0x04096cc3, 0x96519fa3,
+    0x32f4d5a6, 0xa4e19275, 0x26a6be24, 0x715a1154, 0x62c15a6d, 0x8ed2abb0,
+    0x5bb822cb, 0x6688126a, 0xc0031b4e, 0x84c6fbb0, 0xe4b5a652, 0x1686515f,
+    0xb2874f68, 0x57e73756, 0xa6a0a1b6, 0xddebdca9, 0xae8602ab, 0x5746e008,
+    0x52057bcf, 0x3be2ddd0, 0x60155b11, 0xd7868aac, 0x532ae50c, 0x7d0e727b,
+    0x6ab15ba6, 0x4d8c80dc, 0xeb39f4b7, 0xb4660581, 0x1548acd3, 0x804347c5,
+    0xc11c9378, 0xf58e7d96, 0x2a74cea3, 0x3fc77dcc, 0x3c905fad, 0xe2bfcea5,
+    0xebe572d6, 0xea8d6e55, 0x882214b8, 0x74675b3c, 0xa270113b, 0xab185fc5,
+    0x8dd42a8d, 0x07086f60, 0xe7d0134b, 0x59553e13, 0x540598ed, 0xec98c5b7,
+    0xb8223d87, 0x8baa2efb, 0x6e847f0e, 0x213bf9b1, 0xf98b948b, 0x292bbb0e,
+    0x61b726ec, 0x67e3d35a, 0x2bc87259, 0xa51ce2b4, 0xceec8f1b, 0xdc35ae2c,
+    0x8eee3383, 0xfc33b656, 0x81d52990, 0xb922c05d, 0xb98987ec, 0xa5f96056,
+    0x48f9e1b5, 0x00ff4b9b, 0x9fac070c, 0xfb71fc1b, 0xb90b45fa, 0x8b752e1a,
+    0x697344dc, 0x6a453b36, 0x59c290a1, 0x876557c5, 0xed0aa8ab, 0xd006da96,
+    0x28752dfb, 0x1b556c5b, 0x19154b6d, 0x5e5f60dc, 0x436fd838, 0xec346597,
+    0x32e2140f, 0x657e2ebd, 0x5485d5a6, 0x4b2b1a4b, 0x9658767a, 0x3c59b322,
+    0x27f955a4, 0x90d3bb1c, 0x09abe7ba, 0x5631d675, 0xf64fc056, 0x8b95b14f,
+    0xb4d9c608, 0xca8a91c8, 0x70a59894, 0x05a1ac2c, 0xaf8cfb6f, 0xf94f45fa,
+    0xabd4c732, 0x5a3f4af8, 0xbb76cf3a, 0xbc16611c, 0x51ed9637, 0xab0c9e5a,
+    0x63df8e45, 0xb7c915af, 0x6f88a485, 0x22584a37, 0x982c5fc9, 0xfb1a6fc1,
+    0x25fe8d67, 0x4800ffc3, 0x379eed6b, 0xfd0f97f8, 0x78b6af21, 0x3f5ce2df,
+    0xd9be86f4, 0x70897fe3, 0x1ad200ff, 0xfe8d67fb, 0x00ffc325, 0x2bcf6a48,
+    0x6e81d5b8, 0x594e8a9d, 0x12c4c052, 0xe2df119f, 0x5b7762e4, 0xb90f6e45,
+    0x78dfb1ce, 0x256e8dd4, 0x33ae50f6, 0x3b1489d3, 0x4a98911a, 0x85890981,
+    0xa427c6e5, 0xff2bad85, 0x01a8dd00, 0xc408b063, 0x1ec59734, 0x9c274bca,
+    0x3116c431, 0x00644ee2, 0x39b20dae, 0x2c1c9688, 0xb9477005, 0xfc8e0840,
+    0x92a611a3, 0x49d9a3f8, 0x3886f364, 0x093cc682, 0xc31580cc, 0x8998231b,
+    0x17c0c261, 0x00947b06, 0x31caef88, 0x32172b1a, 0xc16e7f5c, 0x48fbceed,
+    0xed7158c2, 0xd6ceb11c, 0xb4858de4, 0x536e4444, 0x5ada46b4, 0x1e00ff0a,
+    0x626c1212, 0x52b03553, 0x3edd31a5, 0x9173a9b1, 0xa4b759e4, 0x4404a9ae,
+    0x79bea6b3, 0x0fd9419e, 0x46f69ab7, 0xb1dcfab4, 0x1063d659, 0x2e8057f7,
+    0xb9318470, 0x1fc03452, 0x1e393d8e, 0xbfa3f152, 0x736e9041, 0xd5b721d9,
+    0x3cf34ab7, 0xcb177712, 0xd14e0fbc, 0xcbe16565, 0xa71c3113, 0xdace441b,
+    0xf8f735c8, 0x8dacddf2, 0x76ebc85e, 0x987d85d1, 0x7b26b15c, 0x32329935,
+    0x67c20423, 0x88da4b9e, 0xf16c5f87, 0x7fb8c4bf, 0xb37d0de9, 0x1200ffc6,
+    0xa400ffe1, 0x1bcff635, 0xfe874bfc, 0x3cdbd790, 0x1f2ef16f, 0x6c5f43fa,
+    0xb8c4bff1, 0x7d0de97f, 0x00ffc6b3, 0x00ffe112, 0x51c335a4, 0x40e72b88,
+    0x2c0a394f, 0xc95d5798, 0x3791092f, 0xd41815a8, 0xe1484344, 0xae3ba77c,
+    0xde624b06, 0xe468ab3e, 0x52c854a9, 0x9d3e2c7f, 0x55b7e9ea, 0x082c06d0,
+    0x1483776d, 0x300056ce, 0x4c79c279, 0x18c6a344, 0x6165749d, 0x4ae99029,
+    0x2aa507a4, 0xf4e9e5e5, 0xe5e4e5f6, 0xe53679f1, 0x6ddbeee5, 0x0c387103,
+    0x17aa3126, 0xc58f9902, 0x0b6ba451, 0x00b0a932, 0x01b29075, 0xe132a57c,
+    0xa96c8819, 0x0ef27b52, 0x8747d3d7, 0x959594f0, 0x554d5e02, 0xaf6b5431,
+    0x0986b322, 0x004af085, 0x9a8b816d, 0x90213624, 0xc644d650, 0x2fd25bc6,
+    0xb1b96203, 0x1e4319d5, 0xbda90f5e, 0x41572e0a, 0x4b4fa9b4, 0x881ab57a,
+    0x39bab284, 0x998e6a12, 0x9c768704, 0x275e0c38, 0x4b952e87, 0xb1646a75,
+    0x6c4a5c38, 0x12709bd0, 0x394d406c, 0x48b54441, 0x9ad51073, 0xd7171a2c,
+    0xa88de503, 0x3c3972e7, 0xe9e2b63d, 0xbe46afdd, 0x70a8840b, 0x48de0ea2,
+    0x5cf9ab50, 0xb45be982, 0x5e9f77bb, 0x5d7027b8, 0xd877ac65, 0x6e447979,
+    0x7cf83164, 0x13f91b5d, 0xd32e6426, 0x6eadd4c7, 0xe3840df3, 0xa052963b,
+    0x11379375, 0x72c68934, 0xf139224c, 0x7bfb67a6, 0xd62f073f, 0xc67f582b,
+    0xde96fdab, 0x1f8dde83, 0xf8b53abd, 0x41fb21cb, 0x0fcf7f68, 0x876a06fe,
+    0x00ffc3f9, 0x0f8d2cad, 0xfce5ccfe, 0xe500ff91, 0xc4effd30, 0x2f67f49a,
+    0x423f4cfa, 0xbf9cd16b, 0x09fd30e9, 0xff7246af, 0xf4c3a400, 0xcb19bd26,
+    0xd00f93fe, 0x2f67f49a, 0x423f4cfa, 0xbf9cd16b, 0x09fd30e9, 0xff7246af,
+    0xf4c3a400, 0xcb19bd26, 0xd00f93fe, 0x2f67f49a, 0x423f4cfa, 0xe15bed68,
+    0x33acbbec, 0xc4939d93, 0x9a6e0e89, 0xafe241c5, 0xab1c0104, 0x8de11e01,
+    0x9d77def6, 0xe58c5ee7, 0x874900ff, 0x337a4de8, 0x1f26fd97, 0x958b34a1,
+    0xab2e7778, 0x430f5a35, 0x7d12b97e, 0x80b9ac36, 0x308259f9, 0xf68d522e,
+    0xbb9f2131, 0xe129a913, 0x33e5beac, 0xb400ff33, 0xf99ee5c1, 0x4de800ff,
+    0xfd97337a, 0x35a11f26, 0xf45fcee8, 0xd7847e98, 0xd27f39a3, 0x5e13fa61,
+    0x00ffe58c, 0x4de88749, 0xfd97337a, 0x35a11f26, 0xf45fcee8, 0xd6847e98,
+    0xeb38c143, 0x768ee558, 0x646d549f, 0x394c2063, 0x84d8dac7, 0x9c3e9de2,
+    0xbcdcc640, 0xeff7bca7, 0x5ba94f1e, 0xb0fe84f0, 0xe9dfc475, 0x4ef96f0e,
+    0x9f0cd5d7, 0x364bda8f, 0x7be313ca, 0x0b1a675f, 0xde261eb1, 0xe353a8ef,
+    0xb67bee6f, 0x67b5cad3, 0x8727ade4, 0x623519b0, 0xf6916357, 0x0daf91db,
+    0x510e58c8, 0x633435eb, 0xa0b5ecc6, 0x53c0ed9d, 0xf99e353d, 0x6efc58cb,
+    0x5974284f, 0x76e30585, 0xba6816b7, 0x958c5ef4, 0xc28a025b, 0xd607cde7,
+    0x6bfa8b84, 0xe3dc1819, 0x4569679e, 0x52ef3578, 0x715586a5, 0xcd461df5,
+    0xd0e7c08a, 0x2c336c71, 0xcc25d2aa, 0x68478b18, 0x4f340c07, 0x87a3eb57,
+    0x86a80bf2, 0x3ccb482d, 0x9c4b4aaf, 0x427d3055, 0x722e5448, 0xb9d80129,
+    0xbfa37b66, 0x22c80d5e, 0xd8323441, 0x17667edc, 0xede81c61, 0x8aa806d7,
+    0x84e14ccc, 0xa6f3b847, 0x8bee011b, 0x2c3dd6c5, 0xd4951ded, 0xcc768cf0,
+    0x53cea6f1, 0xa21c8a2c, 0x7424be7c, 0x6d0cd6d8, 0x5ca7743b, 0xb9317746,
+    0xa6c7ea3a, 0x08cb1c67, 0xb335557d, 0x404da997, 0x1b40724e, 0x31c75dcf,
+    0xd9bf51ca, 0x4e67b823, 0x4b689aae, 0x2ef5cda2, 0x415472a3, 0x21f3e0a5,
+    0xf6ba15b7, 0xb4aaed40, 0x54580189, 0x7c96c81a, 0xb62552a6, 0x0311f532,
+    0xc931180b, 0xabdd59d8, 0x6e56a6da, 0x22456eed, 0xc92ada60, 0x02918458,
+    0xb395478c, 0xe5333dcd, 0x376a3ccb, 0xeb826a27, 0xeeba3831, 0x61c93995,
+    0x885bb537, 0x29b89708, 0x5509c28a, 0xc09a4fe2, 0x30817819, 0xb661ec57,
+    0xa6236d8c, 0xb59307bb, 0x2d741e5b, 0xc09e035d, 0x3a75bce3, 0xb1098b86,
+    0x1021aa5b, 0x8129287d, 0x73398d93, 0x5c34685d, 0xabc57c2c, 0x2f752a75,
+    0x4acdc108, 0x8beb61d3, 0x2e20e54f, 0xeca47e9d, 0xaafc4fd5, 0xb4c2a0f9,
+    0x5ad91941, 0x74c5b66b, 0x65cab25c, 0x532a6821, 0xa2d54273, 0xe12c8941,
+    0x06983d0a, 0x1812f3be, 0x8af86ebf, 0xc91cbed2, 0x2e2e2ae6, 0x28650b56,
+    0x074bcd51, 0x766d9e4f, 0xc6273446, 0x76b08894, 0x12522e28, 0x3fc3ab9f,
+    0xf983b8e7, 0xecadbe50, 0xaef7148b, 0x58573b85, 0xda27aa9a, 0xbc415568,
+    0xe3035995, 0x2221e639, 0xb2790fa5, 0xaacb6344, 0xad42455c, 0x756f75da,
+    0x28c869fa, 0x0e3a6215, 0xb66c4934, 0x25b36435, 0x618b2dc9, 0xeff10f09,
+    0x8a45ab11, 0xe990c70a, 0x869b5614, 0x3d275561, 0x4cc7a2dd, 0x685dad4d,
+    0x709ddddd, 0x2b426627, 0x97d451c3, 0xd97387af, 0x75dae52c, 0x58ea85a7,
+    0x21c238b1, 0x93b8e5cd, 0x62805e25, 0x96165895, 0xda739205, 0x413c56f0,
+    0x8af57283, 0x7515c4c2, 0xc25b35b2, 0xb525ec56, 0x8a1ddc72, 0x5f2535bd,
+    0x25e7145b, 0xbc79a889, 0x7c604e5e, 0x9d8cd57c, 0x574cecc2, 0x56fb3551,
+    0xb4625109, 0x1077ea31, 0x887fb865, 0x51c1afa1, 0xe1d890c8, 0xba9ad2ec,
+    0xea5704f9, 0x17f62e74, 0x78e55235, 0xf86c3585, 0x86bc05c3, 0xe18fdfc5,
+    0xa932e584, 0x96ec18a7, 0xde8ed562, 0x95dbc9c3, 0xb556a9dc, 0x4a32085f,
+    0xedacabda, 0x25d0c731, 0x99d07499, 0xa6aa4367, 0xd6b60e47, 0xac18207b,
+    0xec46daed, 0x295f973b, 0x77b89b76, 0x8dc79c1d, 0x01a90bc7, 0x12e11fbb,
+    0x5913f3ac, 0xd9aa5258, 0x61cfb170, 0xdb1c474e, 0xaf8074fc, 0xb84b18c2,
+    0x9d11b4ba, 0x465e5cca, 0x1728fef5, 0x35f1401e, 0x41bb7572, 0x5f4a5a76,
+    0x59762c85, 0xca8c7214, 0x11aed385, 0xcb9edcc6, 0x5a08c993, 0x22241acd,
+    0x97743142, 0xc864f56a, 0x567bac73, 0x6f56eb40, 0x197b644e, 0x499414da,
+    0xecc7832d, 0x62052ab3, 0x7b0d73b8, 0x76ac4e07, 0x2ddbaf92, 0xa7c5e9e7,
+    0xf70500f5, 0xac9a36ac, 0x828e719d, 0x41e935d4, 0x0edbd6b4, 0xbc24b7cc,
+    0xc798cadd, 0xe964ace2, 0xd6569be4, 0xc88a095b, 0xcc81b0d7, 0x9649b355,
+    0xd9c799d7, 0xfaf6d5c8, 0x622cf55c, 0x5f2d3239, 0xad09ae68, 0xaac2001c,
+    0xb65c558c, 0xa99ba75f, 0x9edde616, 0x76fe7066, 0xce8271fa, 0x289581ca,
+    0x3b6e03a9, 0x295e2694, 0x2cd66052, 0x83484e33, 0x5bd66a2f, 0xe9e5ef87,
+    0xa62e32e2, 0xd78639aa, 0x62cc376d, 0x59965d9b, 0xac752a84, 0xc5521374,
+    0xdc8af008, 0xdc625987, 0xdc723aa7, 0xc3f4c34b, 0xc75d991a, 0x795e2fe3,
+    0xd5c3a2f6, 0x7ce59154, 0xa3a3d91f, 0xe456db6e, 0xec316a63, 0x29a75101,
+    0xf3e6c369, 0x1c9323af, 0x8b2f3d46, 0x52bddb79, 0x35316aaf, 0x5773d8aa,
+    0xd5c6c852, 0xa7c6964d, 0x0432b36a, 0x845c74bc, 0x51d4bc90, 0xb447c64e,
+    0xc5db1c4b, 0x02069751, 0x9013b1f3, 0xdf37e0b3, 0x5f720508, 0x32b12376,
+    0xfac0cad8, 0x17605dc4, 0x1930064b, 0xe5b4de66, 0x71152771, 0x1bbb0f37,
+    0xa5420533, 0x8cf87a2c, 0x98aa2cf1, 0x0361d30d, 0x76ed4ac3, 0x4fda933a,
+    0x069b7421, 0x602b4e31, 0x08dfe2a9, 0x0c37f148, 0x18e838a3, 0x57b63226,
+    0xc5cbba24, 0xa0e3b928, 0xb52c1756, 0x63a4dc69, 0x0c48495d, 0x6fb2ee76,
+    0xeb72b654, 0xdcb55c78, 0xdc4eac33, 0x26bc82d6, 0xd84c1bcd, 0xc6ef7a44,
+    0xf976a45c, 0xf5b50346, 0x964320f9, 0x00ff4c23, 0x56ac5f30, 0x8d00ffb0,
+    0xbd2dfb57, 0x3f1abd07, 0xf167757a, 0x82f64396, 0x1f9e7fd0, 0x0fd50cfc,
+    0xa3fab3f3, 0x9300ffd0, 0x727ff71f, 0xd01fbfe5, 0xf5b74efe, 0x9f107e2b,
+    0x9bb80ed6, 0xffcd21fd, 0xfada2900, 0xbadac3ae, 0x26436bac, 0xac964a19,
+    0x33aae3a6, 0xb3d3b49a, 0xad0fde55, 0xb79bd276, 0x35d8f545, 0x7ae4a258,
+    0x51924a9a, 0xed77254b, 0xab8f9f62, 0xcb82ab86, 0xe40a2db0, 0x337b3571,
+    0xc3b1e2ca, 0x5b46f56a, 0xdd140b31, 0xb40a7659, 0x3cc22984, 0x55cbc0f2,
+    0xb9295d76, 0x05345c61, 0x2757b995, 0xc458cbd3, 0x6cbbf085, 0xe53e0ebb,
+    0x08ed92a1, 0x64ddb204, 0xc3b5b258, 0x4c9c02ac, 0xcd8a5758, 0x1753319b,
+    0x24771e4b, 0xdad8be18, 0x8093e9a9, 0x4cf8025d, 0xbcbc2277, 0x5642e214,
+    0x7a66524c, 0x4dbd9241, 0x2cd6da92, 0x2c44120b, 0x948a305f, 0x2682e13e,
+    0x78cc303e, 0x75f713c3, 0x50cecc95, 0xec59f3c8, 0xc6294e06, 0x1a1df43a,
+    0xb90ab2b4, 0xa3372d6c, 0xe64b3b2a, 0x95e98a60, 0x9c271894, 0x291c1b2c,
+    0x79301f0e, 0xc325a34c, 0x674fc9ed, 0xa69e1db1, 0x2e7e9c14, 0xa3eef6eb,
+    0x13a4382f, 0x43bd7f06, 0x3c31766f, 0x40716e4a, 0x4f235764, 0x495ddada,
+    0xbd2bedf0, 0x3f3d03f1, 0xfb61c9de, 0x93932f67, 0xe30cccdd, 0x95695373,
+    0x0cc51152, 0x73a50da6, 0x764927fb, 0xfd02f732, 0x0b654257, 0x42dbc64a,
+    0x57655df8, 0xc8f12ad5, 0x96c7f5a7, 0x648b4b81, 0x3bcc5d70, 0xd9dda53d,
+    0xa9c85507, 0xf11df769, 0xd5516127, 0xdb1cd38d, 0x6c09c4c9, 0xd84566e9,
+    0x5a5daa7c, 0x1d2533c6, 0xa72f6bb2, 0x6c0aedd4, 0xf56293e3, 0x5bcacc77,
+    0x3774cd56, 0x676b9494, 0x3c580c4e, 0x0265e740, 0x11ee0dac, 0x6a96b253,
+    0x5cc9205d, 0x22cb8faf, 0xa5a6a6cd, 0xd18edb77, 0x65a31ab3, 0x16646361,
+    0x5abbc656, 0x6c5700c9, 0x1c5d8aaf, 0x97ad2cbb, 0x659e7ef8, 0xabacf1d6,
+    0x4135bf42, 0x34283b76, 0xe838e1f2, 0xa532993e, 0xea90f636, 0xb1bededc,
+    0x8a9419d7, 0x9185b136, 0x7fb88b96, 0x5ccc9015, 0x90b55d26, 0x911967a3,
+    0x5ad51e66, 0x5dcb5a76, 0xd0c7822b, 0x2b8b59ad, 0xa7de1435, 0x2ce5ad2e,
+    0xdd163a64, 0x713016c2, 0xc9568a8c, 0x778c9193, 0xe5629683, 0x270da920,
+    0x326c6bad, 0xcc810b6c, 0x28b03225, 0x78f5e53a, 0x10f7fc67, 0xee172a7f,
+    0xfef99e37, 0x3e41a83f, 0xdb191243, 0xdd46b1cb, 0x19aec7df, 0x6ee65c5d,
+    0x08a57084, 0x86948ca3, 0xc534d702, 0xd68b5365, 0xe4c09557, 0xac013951,
+    0xae5948b9, 0x7d20ddaa, 0x3c045091, 0xc9ee65e2, 0xd75d9b65, 0x865cd9b1,
+    0x181d8b30, 0x1463a6fc, 0x4e267b35, 0x2c3486d8, 0x2874d0a9, 0xd671b5b9,
+    0xeadc62a8, 0x14286369, 0x0c993af5, 0x2b3cb645, 0x93bea9e4, 0xb0088298,
+    0x1448780a, 0x2cb79aa4, 0x1e77224e, 0xf2773075, 0x0236e984, 0xea5deced,
+    0x21a7f5e2, 0xa09d9a8d, 0xb4936b11, 0x2ae495d7, 0x2e352964, 0x5fa4ace9,
+    0x29b6a451, 0xc029416e, 0xe664882c, 0x5672b972, 0x0f45e642, 0xbe43f6c9,
+    0xa98fbf4c, 0x1b19b28f, 0x089faea8, 0xec400d08, 0x75aa0945, 0x654ec911,
+    0xbbb64ae9, 0xda74139b, 0xe3c68ebf, 0xf695b95a, 0xc62e4671, 0x630dca4e,
+    0x8cc3860b, 0xd221b6f2, 0x0421304e, 0x2c722df2, 0x35f26126, 0x2ec60a62,
+    0x8aa873e1, 0xbe8f1f02, 0x2078a9a9, 0x899527e6, 0x7ff54d89, 0x67974aef,
+    0xe3fc7adc, 0x5e62b598, 0x29620ecf, 0xa9a76ee1, 0x45a99800, 0x912c3699,
+    0x58f50220, 0xe7d8ca29, 0xe9b65c6f, 0x300a54a2, 0x62466132, 0x0f3b4ff6,
+    0xf1cd4ab5, 0x553a16ca, 0x4f315e93, 0xd51b551c, 0x57a963e9, 0xd9e7183a,
+    0x4a294166, 0xf2c84f90, 0x86cbbeda, 0xcccae13a, 0x1cb190b9, 0x512f7431,
+    0x7b83da6b, 0x8eec58cd, 0x7dbe4a2d, 0x0aea3a9a, 0xe0462699, 0x9466b029,
+    0x7561af31, 0x8547effa, 0x689e7db3, 0x4c50c55b, 0x1b468c3e, 0x65a97d1f,
+    0xf8d6d8ea, 0x69cfb43b, 0xd7adeb0a, 0x6a21bfc8, 0xd0e968ad, 0x87845d7d,
+    0x4eb5c333, 0x63364cdd, 0xaed1f2b5, 0x8038c555, 0x490ba8bc, 0x3e56c1c3,
+    0xea8d5dcb, 0xedee8a5c, 0xba975529, 0xf4490b50, 0xcc582a60, 0x0bd66a65,
+    0x6ac2eff4, 0x53d41406, 0xa52e7b49, 0xf730e484, 0xd88976d5, 0xf7dabce5,
+    0xa535c742, 0xeb1a62af, 0x7691f01a, 0xab1af959, 0x2e6bf1aa, 0xb6bb1aab,
+    0x1ac0b26d, 0xc58c6358, 0x75a96a63, 0x7aa0c16b, 0x60e81022, 0x572d93cb,
+    0x77bdbd5d, 0x5a353d72, 0x8da1dfc9, 0xec38a522, 0x0d334b5e, 0x90429ef0,
+    0x2fd72ef6, 0x1f6e36b3, 0x2a97db25, 0x22d72b57, 0xc80364ad, 0x4bce4e75,
+    0x46de4a19, 0xe25dcc9d, 0x11331eca, 0xc5cc3b39, 0x6e526d31, 0x8f7f2c5a,
+    0x5548c75a, 0x2e840b65, 0xf6243d53, 0xb0e58170, 0x7e7bb976, 0x2d73214f,
+    0x9679927f, 0x3a0e17bb, 0xa37c5675, 0x9514bace, 0xe50d1e53, 0xebd57019,
+    0x96b38c48, 0x05f3cf34, 0x116bc5fa, 0xb27fd5f8, 0xd17bd0db, 0x56a7f7a3,
+    0x3f64197f, 0xf9072d68, 0xc000fff1, 0x00ff50cd, 0x3daa3f3b, 0xff31f90f,
+    0x54ee7700, 0x3246b391, 0xebdaad4f, 0xf8ecc861, 0x5d65c246, 0xaae5e470,
+    0x46ed0554, 0x5e374dee, 0x4704c755, 0x1213b94e, 0xb3a4c62c, 0xcadb7438,
+    0x9d62abd7, 0x185e7837, 0xaa787751, 0x196278b3, 0x47694c41, 0x16728f27,
+    0x60d43125, 0xb7857ec7, 0x03c5512e, 0x79953a6d, 0x9ba895c8, 0x2e9c2b16,
+    0xd429aec0, 0x30a422b9, 0xf8b46da1, 0xc73d414d, 0x0b1cb8af, 0xaa5c59ea,
+    0x5c9a66c5, 0x569e98b9, 0xdc28762e, 0x88bf4466, 0x3b4a6486, 0x8f3566e2,
+    0xf082729b, 0xaeba208d, 0xb9f49981, 0x3feb60a6, 0xb6e56b99, 0xb05c128f,
+    0x57c300ea, 0xeee6d230, 0xefdb78df, 0x8df7adef, 0xa7fafebe, 0x42573391,
+    0x4321aeeb, 0x2a515d04, 0xb2ac0e5d, 0x4b202024, 0x454e07b4, 0x73b13387,
+    0x79737740, 0x55e9f263, 0x73ee1cd3, 0x4c5c4b01, 0x40614c6e, 0x76cff700,
+    0xff1d51e4, 0xa3467f00, 0x400618da, 0x8c4fbc43, 0x4f5e2213, 0xe413d32e,
+    0x733f96d7, 0x437ffc96, 0xd4df3af9, 0x7f42f8ad, 0x68e23a58, 0xa0fdef9e,
+    0xc5fccfcc, 0xf943b091, 0x707f6246, 0x266b5393, 0x15ecdd2c, 0x65b449fb,
+    0x69c70aee, 0x5d52b8e4, 0x0a5755ed, 0xec7299eb, 0x4188ab76, 0x43261ff3,
+    0x46a80626, 0xf014b435, 0x96b13e29, 0x9409de40, 0xa0402ec4, 0xe7d50565,
+    0x4722e662, 0x6fbf0f92, 0x7b79772c, 0x65b59afc, 0x408acc63, 0x306759a6,
+    0x8273b1ec, 0xb9b3bcba, 0x62e0b449, 0xcff27907, 0x5e756690, 0x3e8c1972,
+    0xaab1ec3c, 0x5c78ac5a, 0x5089188a, 0xb8ca5ab8, 0xd2d3358b, 0x964c6163,
+    0x4e4804bc, 0xcf63ba64, 0x1db8d2a7, 0x489a350b, 0x71638a72, 0x11d34e60,
+    0x13253231, 0x910912e5, 0x99219831, 0x79d78919, 0x4cc47744, 0xfd7d90cf,
+    0xe2ef9eb7, 0x13bd9f89, 0x19317e3a, 0x638e336b, 0x7bb54a0a, 0xb78f1577,
+    0xd8df1edf, 0xe783d0d9, 0xd84481e9, 0x43d80dac, 0x6887049c, 0xefdf78db,
+    0x8b15dd7d, 0xa850a956, 0xdd4a5201, 0xeb2ab5a9, 0x9116af5d, 0xa5521754,
+    0xd0b36eab, 0x15056328, 0x8309099a, 0x4a08006b, 0xc5f08357, 0x6513be1a,
+    0x37065216, 0x1233742a, 0xd9e972d9, 0xdac7d24c, 0x34c9b557, 0x5685ef20,
+    0x523526d7, 0x01b0c820, 0xc7935562, 0x81359532, 0xe5f2c9dc, 0x34b14a17,
+    0x03416acd, 0xd7be8af1, 0xae65c3b4, 0xf11c1bad, 0x2df244b9, 0x3e35a8c4,
+    0x1f33b4a5, 0xc5522767, 0xbbd2b172, 0x5dc8915e, 0xc9eaf01a, 0x2b9f3e70,
+    0xaa2dc20e, 0x234a01b3, 0xd49560da, 0xef0bc7fd, 0x289f5bf7, 0x712abcf7,
+    0xfd53fdbf, 0x05f3cfd2, 0x116bc5fa, 0xb27fd5f8, 0xd17bd0db, 0x56a7f7a3,
+    0x3f64197f, 0xf9072d68, 0xc000ffe1, 0xce7952cd, 0xe70bbbc0, 0x1428279f,
+    0xf77f19f2, 0xf33f5322, 0x688c236b, 0x8f3b95f2, 0xcc6df750, 0x329479ae,
+    0x9089893f, 0xfd22fe38, 0x4aa284cf, 0x7add0abe, 0xe89a99d6, 0x42d1a8cb,
+    0xb61c2ae9, 0xdbd79298, 0xc39ac010, 0xcbaa968f, 0x835ad35d, 0x0bbf17db,
+    0x135cb5d5, 0x893bbc71, 0xac515ef0, 0x53be4a77, 0x9b8c8595, 0x169d7ab5,
+    0x0030edd4, 0x73a78dc8, 0x12202212, 0x1581618d, 0x8cbb5a2c, 0x3023868c,
+    0xea582e85, 0x5e0c0f59, 0x01b64fb8, 0xc85ad31e, 0x678b135d, 0x6f9d5f01,
+    0xa74a6412, 0xb1e8b055, 0xf8f66b17, 0x79ac2d5b, 0xdd57ea00, 0x41846cb7,
+    0x5997dabb, 0x3117644f, 0x47410041, 0x920d6d97, 0x195b5543, 0x56f275c5,
+    0x176d2103, 0x2c331411, 0xa1e4931a, 0x82e32b46, 0xb9707ce5, 0x2dc7972e,
+    0xe7f6dc89, 0xa1ecb6e6, 0x289278b2, 0x97b7fee4, 0xc4f51b64, 0xf6c75b3b,
+    0x5f8351b6, 0x49c5b35f, 0x11128ec8, 0xbfc1e03c, 0x8e08e038, 0x963e596d,
+    0x1513e742, 0xbe84479c, 0x2cc56db7, 0x22156bc2, 0x4c2eabe9, 0x186bdec4,
+    0xdcec8f4f, 0x5d2b0a6d, 0x8db5082f, 0xafcc61dc, 0x1d7e9540, 0xa18885c5,
+    0x6d56bd8b, 0xc15cd426, 0x5ec3b1f6, 0xca150b5d, 0xb2f669e2, 0x4b2975aa,
+    0x4a71703a, 0x8646ce16, 0xbfabca62, 0x3c8a9513, 0xb56f8b3a, 0x9bfcad6e,
+    0x9e8cc566, 0x5d0cb2f6, 0x24979d1a, 0xad3584ea, 0xd28d6b43, 0x93997d47,
+    0xc02bc9b0, 0x988a137e, 0xd176e1c9, 0x5b31ebb8, 0x3165b80f, 0x1abe6d09,
+    0x452ba5c6, 0xf64dc53a, 0xdaabf641, 0xcfa2c7b6, 0x2d03a6ef, 0x038e65b9,
+    0x2481938b, 0x7bbb3ee4, 0xcd6a3274, 0x2f7ad9ee, 0xdd5f72ce, 0x3152d5da,
+    0xb3ed08fe, 0x138a11d5, 0x9991ef8f, 0xb3c963c3, 0xf7f0aad8, 0xe408390f,
+    0xf06b8801, 0x298ea5b4, 0xb0368381, 0xca4c0279, 0x5f4aad7d, 0x7e4458b9,
+    0x98c164e1, 0xb759be2c, 0x00ffbf53, 0x634752a3, 0x98fd7d16, 0xbb033ae6,
+    0xf994e869, 0xc75bdf36, 0x75e13596, 0x203eef0f, 0xc75c5f48, 0x00c18578,
+    0xffbe464e, 0xc0aee100, 0xf33e0af5, 0x98c56386, 0xc802c7fd, 0x8c761044,
+    0x3b6d9cec, 0xea39984d, 0xf3b66d41, 0xc4bbec28, 0xbe9cfc4e, 0xa364ed4e,
+    0x531f4721, 0x0fee391e, 0x7881b2ed, 0xd73b88a9, 0x68d7a2b9, 0xc6e8f1b2,
+    0x8eb83fde, 0x789b3399, 0x82b803f2, 0x57662f93, 0x3ae003c4, 0xae149cb7,
+    0xb2e3b4b6, 0x215e107e, 0xd1e803ed, 0x781e7c53, 0x54b6c68e, 0x312a840c,
+    0x2ccf96eb, 0x7317addd, 0x783117d2, 0xd91a393b, 0x55672561, 0x577aae42,
+    0xa1c83c92, 0xc18edc9b, 0x60b380d4, 0x9ac6c316, 0x6d85e052, 0x53b983cd,
+    0x59e9761b, 0x794ec4b7, 0xa1e6aad5, 0x1793b74e, 0x12c0394c, 0x33e50e94,
+    0x8858e3cc, 0x0c4c9144, 0xc08ce94c, 0xed64c857, 0x7274710e, 0xaddfc1ae,
+    0x788aae5b, 0xde4a65ac, 0xb2e23713, 0xad876351, 0x99121935, 0x7b1aa774,
+    0xcceadc19, 0xf5eca4af, 0xe3a02a74, 0xb1e1979d, 0xc22e97ac, 0x314378ab,
+    0x9b52d459, 0x090b010b, 0x923c398a, 0x1381f052, 0x8ee5685d, 0xe1b52d4f,
+    0x9dc56a8d, 0x219e2bee, 0x17e78463, 0x7e232317, 0x25ddc30f, 0x874626b2,
+    0xd950f062, 0x81742812, 0x91741851, 0x58fa9869, 0xd6f09bbc, 0xd86ad8b1,
+    0x58293ba7, 0x6bb70a70, 0xb13629b1, 0x1c10cbb4, 0xc7b479d9, 0xbed7c585,
+    0xef4ece57, 0x3808296a, 0x29c4d317, 0xe28ddb96, 0x15bba34c, 0xbb2c1355,
+    0x29b4fa1a, 0xb222ee63, 0x4ae058a2, 0x1daba6f1, 0x0caf3231, 0x66cb1e51,
+    0x8b7becf1, 0xc7b8db6f, 0xefd55d57, 0x6bdd55cc, 0x53e06633, 0x72e5f93e,
+    0x55f5e512, 0xc32200ff, 0x000b1495, 0xaa7833c6, 0x4ec92d83, 0x55911f57,
+    0x8b35c755, 0x222babb5, 0xe2baae97, 0x72658f3a, 0x17f4b7b0, 0xc31272ce,
+    0x9db3f600, 0x431b7b70, 0x596e77c1, 0x1c5b78cc, 0xac98b4e7, 0x012aea5a,
+    0x33daaab6, 0xd42c52b1, 0x7c91f36d, 0x06435507, 0xccb4cb21, 0x1654df7b,
+    0x0c6393b1, 0xdc18b056, 0x4060ce8c, 0x48be2346, 0x2322628a, 0xd67666be,
+    0x13130927, 0x5e218a38, 0x0cc1c4c4, 0x9b9571df, 0x3e13a5dc, 0x4c95ede5,
+    0x6d59c27d, 0x7fd2fddd, 0x8af50be6, 0xaaf123d6, 0xb76500ff, 0x47a3f7a0,
+    0xfeac4eef, 0xd07ec832, 0x00ff995a, 0x00ffc000, 0x00ff0fef, 0x6526ea1f,
+    0xa89ea1ca, 0x3f6e4aa8, 0xac91a7c4, 0xaf55a1bd, 0x36652232, 0x7b251e12,
+    0xb1243272, 0xe02ed814, 0x83b19028, 0xfddd4ec9, 0x715bd55a, 0x8be13f04,
+    0x21950bea, 0xb6b960f7, 0xca695edb, 0xc8e7ba7a, 0x4f39cdeb, 0x1df95c57,
+    0xea29a779, 0xaf239feb, 0x5d3d6534, 0xe675e473, 0xaeaba78c, 0xd1bc8e7c,
+    0xcf75f594, 0x329ad791, 0xf2b9ae9e, 0x5346f33a, 0x473ed7d5, 0x7aca685e,
+    0xebc8e7ba, 0x574f19cd, 0x791df95c, 0xebea29a3, 0x34af239f, 0x735d3d65,
+    0x8ce675e4, 0x7caeaba7, 0x94d1bc8e, 0x91cf75f5, 0x9e329ad7, 0x3af2b9ae,
+    0xd5534ef3, 0x5e473ed7, 0xba7aca69, 0x95ebc8e7, 0x97b95c78, 0xd9651cde,
+    0x72bfbd9f, 0x3bbea33b, 0x6f41bbe7, 0xd0c4b789, 0x52ec6c0f, 0xf16be143,
+    0xbca2441e, 0x3f70f64c, 0x21b1d821, 0x01e213c9, 0xca03f24e, 0x2984aea0,
+    0x5456aa75, 0x50b5aa6c, 0xff42883c, 0xfd58c500, 0xce3bbbdf, 0xf5d1bed1,
+    0xaccb871b, 0x217b8f99, 0xedb66acb, 0x1c71fb38, 0xccac7283, 0xf8f24c4c,
+    0xaef8548e, 0x93ef8b57, 0xf51cca71, 0x584bfc1d, 0x2c676cbf, 0x46b198fb,
+    0x6ed67d7f, 0x402e73db, 0xb0dc27e2, 0x29d7c6e3, 0x5fe072e1, 0x8697f178,
+    0x5ea3247f, 0xbafaca68, 0xc1ebc8e7, 0x9ac885c5, 0x436de786, 0xab7f1b0b,
+    0x8dae845d, 0xf9c25c80, 0x2b84767a, 0xbcc484cb, 0xc825c96a, 0x68fefc78,
+    0xe7bafaca, 0x19cdebc8, 0xf9dc565f, 0x2ba3791d, 0x239fdbea, 0x7d6534af,
+    0x75e4735b, 0xabaf8ce6, 0xbc8e7cae, 0x75f595d1, 0x9ad791cf, 0xb9adbe32,
+    0x46f33af2, 0x3eb7d557, 0xca685e47, 0xc8e7b6fa, 0x5f19cdeb, 0x1df95c57,
+    0xea2ba379, 0xab239feb, 0x4b369c32, 0xd247cd9e, 0xf73616ea, 0x7a689532,
+    0x2a7b2576, 0x96a89d23, 0x2d289957, 0x20dad396, 0x46f328b6, 0x3ed7d557,
+    0xca685e47, 0xc8e7bafa, 0x0bb606ea, 0xd4dfdf27, 0x4cd4467d, 0xeb52f80f,
+    0xfff29542, 0x87361f00, 0xb2f56521, 0xd9df415c, 0x63b7bf46, 0xb4c3fcf0,
+    0xcb43aabb, 0xcc1b2173, 0x3d3b822c, 0x5ae2dc62, 0x45523242, 0x32534432,
+    0xccbc3345, 0xcccc7ccf, 0xf9ccccf7, 0x85a5fb67, 0x2c5718fc, 0x8c91f1cf,
+    0x2f80e5c7, 0xe347acc9, 0x6fcbfe55, 0x8f46ef41, 0x165a9dde, 0xc2cb42d8,
+    0x3956fc37, 0x1f6c5f60, 0xd48922dc, 0x30abdb8c, 0xda312351, 0xdd13df55,
+    0xf6feee31, 0xda354bbc, 0x45169fb9, 0xfeef22ea, 0xfb960809, 0xdc1e00ff,
+    0x99e4ddb3, 0xd7728de5, 0xe51165b5, 0xa3622fd9, 0xde4701f2, 0xffca798d,
+    0x7c2cc700, 0x7fe5bca6, 0x533e96e3, 0xf1bf725e, 0xaf291fcb, 0xe5f85f39,
+    0x9cd7948f, 0xc772fcaf, 0x57ce6bca, 0xe56339fe, 0xff2be735, 0xf2b11c00,
+    0xff95f39a, 0xf9588e00, 0xffca794d, 0x7c2cc700, 0x7fe5bca6, 0x533e96e3,
+    0xf1bf725e, 0xaf291fcb, 0xe5f85f39, 0x9cd7948f, 0xc772fcaf, 0x57ce6bca,
+    0xe56339fe, 0xff2be735, 0xf2b11c00, 0xff95f39a, 0xf9588e00, 0xffca794d,
+    0x7c2cc700, 0x8d9cb6a6, 0xb7e38fe9, 0x3335e563, 0x3b333333, 0xcc7ccfcc,
+    0x7e6696cf, 0x60eecfec, 0x8fb364d6, 0x94488121, 0x8de2ce7d, 0xb5bb3ba6,
+    0x00ff2be7, 0x9af2b11c, 0x00ff95f3, 0x4df9588e, 0x00ffca79, 0xa67c2cc7,
+    0xe37fe5bc, 0x5e533e96, 0xcbf1bf72, 0x39af291f, 0x8fe5f85f, 0xaf9cd794,
+    0xcac772fc, 0xfe57ce6b, 0x35e56339, 0x00ff2be7, 0x9af2b11c, 0x00ff95f3,
+    0x4df9588e, 0x00ffca79, 0xa67c2cc7, 0xe37fe5bc, 0x5e533e96, 0xcbf1bf72,
+    0x39af291f, 0x8fe5f85f, 0xaf9cd794, 0xcac772fc, 0xfe57ce6b, 0x35e56339,
+    0x00ff2be7, 0x9af2b11c, 0x2fab7de5, 0xb5e7bc8f, 0xeee4dd91, 0xa8ee9f32,
+    0x67826209, 0x0b18dbbf, 0xe7febe8d, 0x00ffdd31, 0xede41afd, 0xbca72495,
+    0xbea7b4cb, 0x3c921f7e, 0xee7ef991, 0xa5a722b1, 0xcc35e1a5, 0x980cdac2,
+    0x376acd8e, 0x6e674ad8, 0x3dfeeff8, 0x911abd07, 0x8423fafb, 0x4a8a39ae,
+    0x79634079, 0x7666de99, 0xef99f98e, 0x5dbefb99, 0x9ffc887b, 0x1f71afd1,
+    0xee35fa93, 0x00ffe023, 0x7cc4bd46, 0xb8d7e81f, 0x1afd838f, 0x7ff011f7,
+    0x3ee25ea3, 0xdc6bf40f, 0x8dfec147, 0x3ff8887b, 0x1f71afd1, 0xee35fa07,
+    0x00ffe023, 0x7cc4bd46, 0xb8d7e81f, 0x1afd838f, 0x7ff011f7, 0x3ee25ea3,
+    0xdc6bf40f, 0x8dfec147, 0x3ff8887b, 0x1f71afd1, 0xee35fa07, 0x00ffe023,
+    0x7cc4bd46, 0xb8d7e81f, 0x1afd838f, 0x7ff011f7, 0x3ee25ea3, 0xdc6bf40f,
+    0x8dfec147, 0x3ff8887b, 0x1f71afd1, 0xee35fa07, 0x00ffe023, 0x7cc4bd46,
+    0xb8d7e81f, 0x1afd838f, 0x7ff011f7, 0x3ee25ea3, 0xdc6bf40f, 0x8dfec147,
+    0x3ff8887b, 0x1f71afd1, 0xee35fa07, 0x00ffe023, 0x7cc4bd46, 0xb8d7e81f,
+    0x1afd838f, 0x7ff011f7, 0x3ee25ea3, 0xdc6bf40f, 0x8dfec147, 0x3ff8887b,
+    0x1f71afd1, 0xee35fa07, 0x00ffe023, 0x7cc4bd46, 0xb8d7e81f, 0x1afd838f,
+    0x7ff011f7, 0x3ee25ea3, 0xdc6bf40f, 0x8dfec147, 0x3ff8887b, 0x1f71afd1,
+    0xee35fa07, 0x00ffe023, 0x7cc4bd46, 0xb8d7e81f, 0x1afd838f, 0x7ff011f7,
+    0x3ee25ea3, 0xdc6bf40f, 0x8dfec147, 0x3ff8887b, 0x1f71afd1, 0xee35fa07,
+    0x00ffe023, 0x7cc4bd46, 0xb8d7e81f, 0x1afd838f, 0x7ff011f7, 0x3ee25ea3,
+    0xdc6bf40f, 0x8dfec147, 0x3ff8887b, 0x1f71afd1, 0xee35fa07, 0x00ffe023,
+    0x7cc4bd46, 0xb8d7e81f, 0x1afd838f, 0x7ff011f7, 0x3ee25ea3, 0xdc6bf40f,
+    0x8dfee447, 0x9ffc887b, 0x496fa0d1, 0x893bc37c, 0xcf300f72, 0x78db89df,
+    0x1f517b9f, 0xe000ff7b, 0x00c4ffef, 0x0001102b, 0x05020102, 0x01030403,
+    0x00000101, 0x00010000, 0x51312111, 0x91614110, 0xf17120f0, 0xe1c1a181,
+    0xd1b14030, 0xdaff6050, 0x01010800, 0x213f0100, 0x4e796c33, 0xa50a5034,
+    0x295695ea, 0x1500ff4f, 0xd7ebf57a, 0x7abd5eaf, 0xafd7ebf5, 0xf57abd5e,
+    0x5eafd7eb, 0xebf57abd, 0xbd5eafd7, 0xd7ebf57a, 0x7abd5eaf, 0xafd7ebf5,
+    0xf57abd5e, 0x5eafd7eb, 0xebf57abd, 0xbd5eafd7, 0xd7ebf57a, 0x7bbd5eaf,
+    0xeaacec2e, 0x3130f292, 0x4c16c0ad, 0xc811244f, 0xdfabcb56, 0x767f5f76,
+    0x5f767f5f, 0x7f5f767f, 0x767f5f76, 0x5f767f5f, 0x7f5f767f, 0x767f5f76,
+    0x51767f5b, 0xdf9771af, 0xdddf97dd, 0x97dddf97, 0xdf97dddf, 0xdddf97dd,
+    0x97dddf97, 0xdf97dddf, 0xdddf97dd, 0x97dddf97, 0xfd96dddf, 0x65eeb7cc,
+    0xf765f7f7, 0xf7f765f7, 0x65f7f765, 0xf765f7f7, 0xf7f765f7, 0x65f7f765,
+    0xf765f7f7, 0xf7f765f7, 0x65f7f765, 0xf765f7f7, 0xf7f765f7, 0x65f7f765,
+    0xf765f7f7, 0xf7f765f7, 0x65f7f765, 0xf765f7f7, 0xf7f765f7, 0x65f7f765,
+    0xf765f7f7, 0xf7f765f7, 0x65f7f765, 0xf765f7f7, 0xf7f765f7, 0x65f7f765,
+    0xf765f7f7, 0xf7f765f7, 0x65f7f765, 0xf765f7f7, 0xf7f765f7, 0x65f7f765,
+    0xf765f7f7, 0xf7f765f7, 0x65f7f765, 0xf765f7f7, 0xf7f765f7, 0x61f7f765,
+    0xbc0c5aad, 0x232200ff, 0x3cf9c75c, 0x1b295ef7, 0xbd38ab6a, 0x5dae1a07,
+    0x5fc5ac4c, 0xbc2ac3b9, 0xcca68092, 0x08eccc21, 0x5716843c, 0x16a42daa,
+    0x6110493c, 0x8e268be3, 0x293512a0, 0x81b81856, 0x0ba3e56d, 0xbcfb3c2d,
+    0xb1d092b4, 0x0d587221, 0xf031b5ae, 0x446569e9, 0x9439acef, 0x924a2b8a,
+    0xb425830a, 0x19561608, 0x8d6719ea, 0xa03c85de, 0x8c763acc, 0x06dde498,
+    0xe0ccb650, 0xcd055165, 0x7a908a77, 0x992dc4a8, 0x6a8a7646, 0x54a9ae39,
+    0x1cbb8054, 0xf1a4e4cf, 0xce1506fc, 0xf079e069, 0x9e692ce5, 0x8aa70068,
+    0xc113598e, 0x645b94d1, 0x8013b466, 0xf60e5b35, 0xd7bca71b, 0xf7412c67,
+    0x0bf7fa3c, 0xbccd2946, 0x8c101a1d, 0x25848218, 0xb5ba2a18, 0x3471c413,
+    0xd2154902, 0x37b296ef, 0x5d8c8585, 0xa0fd711e, 0x620b304a, 0x15b4458a,
+    0x9f3d47ac, 0xe1e3014c, 0xc99145b0, 0x769b4bd7, 0x87e83d41, 0x08ad2d80,
+    0x118458e1, 0x5081aac3, 0x6541b0bd, 0xca2a16f3, 0xf14bb010, 0x4114d076,
+    0x9f5bb258, 0x4d350684, 0xcac63fd1, 0xcc71b3a8, 0xc4f55039, 0xbe7c7cf9,
+    0x2f1f5f3e, 0xcbc7978f, 0xf2f1e5e3, 0x7c7cf9f8, 0x1f5f3ebe, 0xc7978f2f,
+    0xf0e5e3cb, 0xed9a3a91, 0x3fa55cd0, 0x71fb296e, 0x7e8adb4f, 0xe1f653dc,
+    0x43c10a26, 0x4dac80dc, 0x3710f1cc, 0xcae80491, 0xf653dc7e, 0x14b79fe2,
+    0xeda7b8fd, 0xa36e47c6, 0x8fc8654c, 0x692b9e02, 0x52c7bae7, 0x29ed754a,
+    0x2459b4d7, 0x3e213697, 0xca1bc0db, 0x084e68f2, 0x2eca01dd, 0xbe6e7518,
+    0x7b235f8a, 0x79ea3690, 0x9bb3543d, 0x648ff16a, 0x729042c8, 0xb1ef2a7e,
+    0x97dc4fda, 0xe2748687, 0xb554e986, 0x6e3a13da, 0xe0520b00, 0x45e82a03,
+    0xd628ec93, 0x214e52a8, 0xf08f1754, 0x000cea7c, 0x1c080000, 0xab6300ff,
+    0xae411207, 0x1a361105, 0x9152a7bc, 0x270b1b8d, 0x807b77b8, 0x577fe26e,
+    0xa78d6358, 0x09b67ef0, 0x259c4858, 0x36cd102a, 0xf6809763, 0x7e6cf784,
+    0xa819effe, 0xfaa71f32, 0xe15e7c81, 0xa8ccc4c2, 0xe3c98d4e, 0x75c067a1,
+    0xb359e02c, 0xb0400dba, 0x4a4107b2, 0x0b800616, 0x24625656, 0x6c405bf2,
+    0xd491826a, 0x0d0c1f77, 0x86d026e2, 0x57568aa1, 0x9c89aaa1, 0x1d94a09e,
+    0xd41c116b, 0xa1aa1244, 0x34328598, 0x012dd176, 0xe462448d, 0xf221dbd2,
+    0x6da89216, 0xeb94f63a, 0x69af53da, 0x3aa5bd4e, 0xdaeb94f6, 0x4e69af53,
+    0xf63aa5bd, 0x53daeb94, 0xd8026eaf, 0x1441520a, 0x9e12b419, 0x6823b3dc,
+    0xe4db32de, 0xb511a439, 0x9c4f0fd5, 0x83d02071, 0x8a68b262, 0xfe698e25,
+    0x96b4a39b, 0x538851e1, 0x628670b0, 0x85d062fa, 0x370e5581, 0x4f6ef767,
+    0xfdafb482, 0x740169a2, 0xb9047c35, 0x26a81415, 0xc393e4d4, 0x358a7b90,
+    0x108415eb, 0xc6794a32, 0xcda45e12, 0x3b4e122c, 0x1c065ad2, 0xc578c805,
+    0x4210900d, 0xaa2e6c1b, 0x62411951, 0x92cde126, 0x4c23c5bf, 0xb5512e88,
+    0xcce7464f, 0x53c48fdc, 0xa209b93a, 0xa74cc865, 0x24542654, 0x85b45a3f,
+    0x843f12ce, 0x82264b83, 0x315afe3a, 0xdfbd37be, 0xd3884931, 0xff3c52b1,
+    0x7ea82f00, 0xb80b0913, 0x79da8ab7, 0x8d88beee, 0xf44285cf, 0x4013c35a,
+    0xa5c0bd9d, 0x81f5a3e2, 0xe0adcfc0, 0x8c9ae68c, 0x7a416b6b, 0xefca49a2,
+    0xcdfd0454, 0xd7006581, 0x9b3b90ca, 0xf65b007b, 0x860b3048, 0x5a8986e1,
+    0x18935599, 0x4be29d75, 0xe635ca5f, 0x8ea6e624, 0xd7f2690c, 0xfc76d6e6,
+    0x1a631650, 0x3cd30361, 0x902ef25e, 0x87bbed66, 0x6c7fd675, 0x0011ce72,
+    0xb796e254, 0x75029378, 0x8f8299d5, 0x8915efbd, 0x2705e168, 0x9769bc6c,
+    0x5f03a188, 0x689271e8, 0x910b4dc5, 0x482fb8a4, 0x22058a6b, 0xb48b2c6e,
+    0x22d0a992, 0x15a4c908, 0xfbf189a0, 0x172b210c, 0x13040fee, 0x3a73cdcd,
+    0x9509bee4, 0x4b7cc932, 0xbbfe5f7d, 0x89eef1c3, 0x5f090b2a, 0x82ac238b,
+    0x0c85f1d1, 0x2d2cf1cd, 0x2404386d, 0x05b04ba1, 0x94988e61, 0xe7a0c172,
+    0xceb89318, 0x85117a9e, 0x02328dd8, 0x43101d04, 0xa577cb0a, 0x55138806,
+    0x362b130b, 0x69cb933f, 0xe296c8f1, 0x9c2e8583, 0x07199639, 0x54df05a8,
+    0x3bd09bd3, 0xf295da47, 0x5083c896, 0x22c42f0e, 0xc571821a, 0x96a05637,
+    0x9c0c1fd3, 0xc435d865, 0x6d6333d3, 0x486123de, 0x458b8fd1, 0xc8ec20f2,
+    0x8b6a1f16, 0x67a46e68, 0x736ed496, 0x4281523b, 0xb5552c84, 0x82be51af,
+    0xb021596b, 0x4a49c610, 0xd2311bf1, 0x234802ed, 0x84e78ca2, 0xa54ea547,
+    0x8921954a, 0xa048e490, 0xc3812d1c, 0x882a5598, 0x219803b6, 0x3ffe1657,
+    0x35074afa, 0x7039abb1, 0xcfc795f1, 0x1c618947, 0xba2f9091, 0xc60263d1,
+    0xca18be2c, 0x62a8412b, 0x571a2ce0, 0x56054050, 0xf7375588, 0x2016cad0,
+    0xe01e5322, 0x810a941d, 0x5631e66d, 0x52979ee6, 0x733a3c64, 0xa143e6ea,
+    0x3879b981, 0x30c8fc36, 0xc9da2eb0, 0x7bb59beb, 0x23876ee1, 0x7d398200,
+    0x20d68048, 0xc6ad16aa, 0x8ab74cb3, 0xbeee79da, 0xec898688, 0xd3abb021,
+    0x951fc6b0, 0x3858522b, 0xe46c6ae7, 0x9ecfcc6a, 0xe763cfc7, 0xf9d8f3b1,
+    0x3ef67cec, 0x8f3d1f7b, 0x63cfc79e, 0xd8f3b1e7, 0xf67cecf9, 0x3d1f7b3e,
+    0x7ec19e8f, 0xaea35687, 0x2158d81b, 0x7399b55c, 0x22d6d697, 0x9e5a3504,
+    0x0bf5c16f, 0x26780937, 0x108e0054, 0x4d23b86a, 0x5918f331, 0x374a5f22,
+    0x374a374a, 0x374a374a, 0x374a374a, 0x374a374a, 0x374a374a, 0x374a374a,
+    0x374a374a, 0x1dea354a, 0xa105ab52, 0x313883c1, 0x6c36bbfd, 0xcd66b3d9,
+    0xd96c369b, 0x9bcf66b3, 0xb3d96c36, 0x369bcde7, 0x5a1d4c44, 0x1d27ad4e,
+    0xda0de905, 0x89b5837a, 0x5ac1a582, 0xa07d7e66, 0xd3bc0f58, 0x9eb6e22d,
+    0x6b50ac7b, 0x76e48a74, 0x2aa43550, 0xae641920, 0x76b788e9, 0xd4191df2,
+    0x416b9142, 0x2fd2355a, 0xd815ec4c, 0x587ad983, 0xd048b697, 0x2cb12cc0,
+    0xb34ebddc, 0xa3dfb442, 0x0150e507, 0x6a130b54, 0x3a6ee633, 0x5e3d7f20,
+    0xb9e9b4eb, 0x163cbd40, 0x61d2edd8, 0x00550c6e, 0x978ac102, 0x28956796,
+    0xb1410007, 0x00ff96d1, 0x7ebfdfab, 0xeff7fbfd, 0xfd7ebfdf, 0xdfeff7fb,
+    0x5bf87dbf, 0x792a6bdd, 0xd728c160, 0x77fcb206, 0x0023b649, 0xd57f0103,
+    0xbfdfef77, 0xf7fbfd7e, 0x7ebfdfef, 0xeff7fbfd, 0xb300badf, 0xce89571d,
+    0x2ae29b40, 0x3b630dcc, 0xe2d9a846, 0x19da4057, 0xb0b3e61f, 0x86ec0815,
+    0x3d4f5bf1, 0xd55ad2d7, 0xc3c3962f, 0x7a34d628, 0xfd43c654, 0x0a8e540a,
+    0xfb8e4686, 0xa61469d7, 0x58ae1f5e, 0x5ec02b71, 0x4040ad84, 0x06cc52bf,
+    0x9b88d276, 0x57585a45, 0xaa33ce2e, 0x3a76fe17, 0x1eb6e41e, 0xc55a9358,
+    0xb9814681, 0xe7fe3bee, 0x9efbefb8, 0x7beebfe3, 0xb900ff8e, 0xe7fe3bee,
+    0x9efbefb8, 0x38eebfe3, 0xce58e615, 0xa529431b, 0x92f6c946, 0x29f84a9f,
+    0x6cea90a9, 0x005d3716, 0x9942dd8a, 0x1b2abc74, 0x6649bf22, 0x0bdfe822,
+    0xadc05584, 0x8da50ccc, 0x309e19e2, 0xaf9a5561, 0x4fdd49e3, 0x4b594ada,
+    0x00ea558b, 0x8754501c, 0x718f085b, 0xc73df7df, 0x1df7dc7f, 0xdc7300ff,
+    0x71cffd77, 0xc73df7df, 0x6a06dc7f, 0xe4366559, 0x414d1a4a, 0x00000c32,
+    0x4710d131, 0xf87d4ea2, 0x7a6e8782, 0xf7df714f, 0xdc7fc73d, 0x49707437,
+    0x0145d8c2, 0x862dd7ce, 0x5f28658c, 0x84e94771, 0xdd86d8f4, 0xafe6aaa3,
+    0x0dbd729d, 0xa8a1b172, 0x83e21412, 0x6d2e3118, 0x73e5860c, 0x04200aa5,
+    0xbeeb49f2, 0x575bb25d, 0x5a84c1cc, 0xd7a4406e, 0xdc202482, 0xbfa9e754,
+    0xa469cd3b, 0xb323d504, 0x246749c3, 0xec87bea2, 0x81b050b6, 0x8926f8e6,
+    0x273ea3ef, 0x18874225, 0x36a22f76, 0x04858803, 0x03e47288, 0x6e01c3a3,
+    0x6017ab45, 0x0901a0cb, 0x98a9b8cc, 0x3642284f, 0x53baa916, 0x92403d34,
+    0x67b5cabc, 0xdf71cf35, 0x7fc73df7, 0xe3e445dc, 0x8266e862, 0xa31b40e3,
+    0xfe312d84, 0xbae7692b, 0xc75a4bfa, 0xd5ce299d, 0xc89253d6, 0xd264cf25,
+    0x5b23936a, 0xadc4a8c0, 0x9150d8da, 0x08f680e5, 0x24fe134c, 0xe5100af4,
+    0xe121346d, 0xa768c55e, 0xe07e4cf4, 0x776600ff, 0xf6c0bbaf, 0xa93db5a7,
+    0x7b6a4fed, 0x548fda53, 0x56006ca9, 0x2a986cc0, 0xe9db96b5, 0x928c6cc7,
+    0x12dd7358, 0xf2c64651, 0x13f56570, 0x688f0407, 0x6d2da1ce, 0x5902a982,
+    0x157b5da9, 0xda7f5238, 0xb69632d7, 0xa782985a, 0x4ec8fdbe, 0x0c612596,
+    0x6e384a25, 0x7a45e4a0, 0x9eda13ac, 0xb5a7f6d4, 0x4ceda93d, 0xdfde7444,
+    0x3a06c081, 0xb5e7847f, 0xd73ca83d, 0xf55d5033, 0x8d7701c6, 0x001f8723,
+    0x1e8aad48, 0x32b4c6ec, 0x52b42f13, 0x802cd448, 0x83e409dd, 0x64c9d82b,
+    0x127c431c, 0x03a064ac, 0x8c98b437, 0xce9acd28, 0x18dd1230, 0x81243ebd,
+    0x6019b716, 0x7a1b5a12, 0x1337f74b, 0xdfee2003, 0x50526e56, 0x38a6d011,
+    0xaf1683ad, 0x0a91d408, 0x143dcd9c, 0xe7272c2d, 0x55a91662, 0x5585d485,
+    0x86621910, 0xcbeca434, 0x01b75944, 0x9d20d8c9, 0x55344d4f, 0x5d7e6c8b,
+    0x60445d01, 0x91f97516, 0x445931cb, 0xbd14e663, 0x5b4deda9, 0xd3c21c7c,
+    0x9eb6e21f, 0x75c2ac7b, 0x1a3a7c6c, 0x59d77485, 0x2ea31568, 0x4c3ca326,
+    0x0d13c06b, 0x6281d3e4, 0x68a10aca, 0xca902b2d, 0xaa7819e8, 0x03b8b02f,
+    0xb5463061, 0x408f67a4, 0x3d6181a1, 0x482d8687, 0x402387e3, 0x87f368d2,
+    0x5d8d01b0, 0xb072162b, 0x0a488583, 0x9585c2aa, 0xed346c1a, 0xe1580d0a,
+    0x5f7520b8, 0xa89ff2e1, 0xddcbb27f, 0x774c386e, 0xa71baac2, 0x1e84010e,
+    0x3d18f850, 0x1c0e8743, 0x6df77238, 0x2f6d5a86, 0x015cb99e, 0x2c0b5ab0,
+    0xe4a443a3, 0xea104440, 0xb9e6be15, 0x0e857298, 0x9d74d860, 0xf41a9927,
+    0x46e659c7, 0x227019db, 0x67af9ae7, 0x09fe2e68, 0xe170381c, 0xc75a87c3,
+    0x34244a36, 0xfab2c61d, 0x39589283, 0x392b3027, 0xcabd24cd, 0x13e02564,
+    0xec702c8e, 0x15b592bc, 0x035ce7b5, 0x5fd84261, 0x37ace3e4, 0xfad62b86,
+    0xc1a49cef, 0xaebd6a69, 0xd46af272, 0x749dd756, 0x205bd080, 0x4535c8fb,
+    0x6c141445, 0xa100e96d, 0x9fd941b6, 0xcad82635, 0xab96166c, 0x5080f1da,
+    0xcfec205b, 0xe9672791, 0x6d6bde32, 0xe75bdd9e, 0x340fb379, 0xd67bc7ba,
+    0xb426d637, 0x22bb2650, 0xd18d041d, 0xeb2c3c13, 0x7829ab4c, 0x32dbb243,
+    0xf9c8664d, 0x04aad066, 0x700522c2, 0xea4860af, 0x479983a3, 0x9ea7adf8,
+    0xe8d5e9eb, 0xabd98032, 0x7745f8e4, 0xc12e1002, 0x65eda5b0, 0xe0158bc5,
+    0x37f3d0bc, 0xb414a568, 0x0591e5a5, 0xd9f58879, 0x9b041ab3, 0x55b900a5,
+    0xcf674e49, 0xd79f920d, 0x313d389a, 0x96174cd1, 0x9b64b6b3, 0x484daf0a,
+    0x8a7cdfae, 0x7129200d, 0x92090bf9, 0x98b12dd5, 0x951a058d, 0xb94eae92,
+    0x75529bda, 0x518858e6, 0x817224a9, 0xfc41cd75, 0x3fb89f39, 0xea561fde,
+    0xf4cbea2d, 0x277e8527, 0x85277e85, 0x7e85277e, 0x227e8527, 0x6006a840,
+    0x8ed6082d, 0x0e9b7877, 0x89fd319d, 0xa5216a0f, 0x694573ce, 0x8a6b1900,
+    0x2bf4a8ce, 0x396a45da, 0xca626154, 0x227c2d43, 0x3b686859, 0x104fb209,
+    0xdf09e8c6, 0xc75114ed, 0xcbbeb256, 0x718d5bee, 0xd05216b2, 0xf6abdec2,
+    0x85a7a9ab, 0x7e85277e, 0x277e8527, 0x85277e85, 0x7e85277e, 0xd2000021,
+    0x87b33d0a, 0x7e0f0044, 0x78e25778, 0x5778e257, 0xee2053e2, 0x04d9d278,
+    0xaaac2dd5, 0x5913fe24, 0xeac1976b, 0x26b241f5, 0x15cecade, 0x9daa9956,
+    0x156909ec, 0x374d5cb6, 0xc9b40040, 0x0441e761, 0x2d7c1ed6, 0xaa397074,
+    0xc0c1e249, 0xa48a4f67, 0x58e88f04, 0x8dd57898, 0xe4908370, 0x65839613,
+    0x294e4241, 0x982c975c, 0xf6f1cac5, 0x4d2020f1, 0xdf254183, 0xbc31a00a,
+    0xa88dd7d7, 0x69f999c1, 0x290b9114, 0x878571bb, 0x71de0bce, 0x78e25778,
+    0x5778e257, 0xe35778e2, 0xfe359bd1, 0xbae7692b, 0xb6d14ffa, 0xdce9b63f,
+    0xc097f809, 0xc4384567, 0x65542418, 0xa492fb3e, 0x74792ba5, 0x02b4229c,
+    0xf848460e, 0x088d2b89, 0x313c2195, 0x4c4bb25c, 0xfc1e3dad, 0x97639329,
+    0x8cc48cc0, 0x172e5d4d, 0x0100a457, 0xf4c2c056, 0x3ade2678, 0x51a8e03c,
+    0x78d1a3ea, 0xea7d914b, 0x802ce250, 0xbf18b44f, 0xc191318d, 0x12a40220,
+    0x604301a0, 0xe08f8368, 0xeb9fdcd5, 0x3ef15f1f, 0x7f00ffe0, 0xb483ec83,
+    0x651f7039, 0xd6814afd, 0x156c2280, 0x22efa363, 0x233c2dd6, 0x0375388a,
+    0x2bcee11e, 0xf78c832a, 0xa12ad22f, 0x7cd6e61b, 0x90cd2a2f, 0xaad6bc62,
+    0x821dd434, 0x024095ea, 0xd18f51ef, 0x5d21b7f7, 0x5745c813, 0x4806c1ee,
+    0x9d5b0284, 0xca952c85, 0x98237f54, 0x1ba5a162, 0x279a7034, 0x6613d269,
+    0x755e32db, 0x56681a33, 0xa28f84b9, 0x70aadc31, 0xf8162e05, 0xc9b3b615,
+    0x13d788a2, 0x90a20a9e, 0x559dc617, 0x481b1037, 0xc6921ce0, 0x4cf8f1ae,
+    0x4513d066, 0x3da6ae64, 0x879fd259, 0x07a5b04e, 0x84644b62, 0x64d0016e,
+    0xbbca3698, 0x3b8dca48, 0xe8ba6e03, 0x8e43fa03, 0x8c49a340, 0x01787b7e,
+    0xbc8ce524, 0x68a2aa41, 0x05f20942, 0x81cabeac, 0x617d0c34, 0xb6e24ba7,
+    0xa4af7b9e, 0x2a2a10fd, 0x211a8059, 0x2a59a04b, 0x3321715f, 0x65097300,
+    0x242678ac, 0xd6242014, 0x82250ce0, 0xb40d8f1a, 0x0d75db5b, 0x590dae3c,
+    0x9d5b6d81, 0x9a021b4f, 0x2b254be9, 0x42b910a0, 0xc0b0155b, 0x1414e04c,
+    0x0ce05406, 0x3baf08ae, 0x55453d98, 0x8e394823, 0x253acf15, 0x82118d4b,
+    0x151d402a, 0xa211c535, 0xd3553694, 0xe07e53fc, 0x7d7800ff, 0x2a14a541,
+    0x94488978, 0x2c167a54, 0x0052b158, 0xa4a52364, 0x06e87082, 0x9a64f692,
+    0x7e8d6660, 0x02788a68, 0x927cef66, 0x2dbbc99e, 0xca005b72, 0xbf0589f8,
+    0xcdb51062, 0xb828e9f3, 0x29ce90e5, 0x06105488, 0xee0414a2, 0xe670cca2,
+    0xbc614b90, 0x91e41157, 0xb6078622, 0x0238e4ba, 0x34bde190, 0xe1050f02,
+    0x8d877e41, 0x2ca82f93, 0xc262b158, 0x388f6e6b, 0xa8520d89, 0xb58058e1,
+    0xb67105cd, 0x24e20191, 0x961a30c9, 0x23089f62, 0x437d3890, 0xf5959bef,
+    0xd4329a34, 0x12d2f987, 0x8ad12aa9, 0x4d07cdf3, 0x8489c0ab, 0xb076c5e1,
+    0xc2ca0c14, 0x3fb6c06e, 0xd998c8d4, 0xfc240161, 0x9fd4c8e3, 0x4f5cc7c0,
+    0x276ee102, 0x23d01d75, 0x4972acec, 0x078871bc, 0x9b0d6a30, 0xdbaff3d0,
+    0xd3d02846, 0xab9d6a04, 0xf4a3205e, 0xf178dc42, 0x02b91235, 0x0d61992a,
+    0x96c7e104, 0x0490b27a, 0xd92285d7, 0x2bbe74c2, 0xfabae769, 0x774dd57e,
+    0xbbf49282, 0xb8fb31b1, 0xad58eaca, 0xa026a72e, 0x3c12ea0d, 0xca58b225,
+    0x8bd67bc4, 0x969ffdd3, 0x9d14a543, 0x690d38b7, 0x7cdee0ee, 0x6a65890e,
+    0xb682f7c5, 0xa2692ca8, 0xf2411706, 0x2b51101a, 0x56381dba, 0xef903a4a,
+    0x37c25c32, 0xc45b9b4a, 0x4d210b71, 0xefaf09b8, 0xd02106aa, 0xa2f46f37,
+    0x12d44d12, 0x7a8296f0, 0x0d00ff3e, 0xdcefd7ce, 0xecafef1f, 0x7321dcdb,
+    0xad00c147, 0x0311d624, 0x6e54a774, 0xd8cc1e23, 0xb95b8b53, 0x62140dc3,
+    0x2b95c1d4, 0xebe6c300, 0x9ba26929, 0x82dd7456, 0x57d8339b, 0x479714a0,
+    0xb3cd38d2, 0x1823d62c, 0xbb21b9a9, 0x94b4b27d, 0x3a925e4b, 0x848e97e1,
+    0xa80d6048, 0xa64d8123, 0x4278d0ae, 0xd87e12e5, 0x2ad715fe, 0xe052b940,
+    0x37499855, 0x4b879d78, 0x96eecc76, 0xcbe4733d, 0x4db9294d, 0x315bd37b,
+    0x9f35ef31, 0x11ca0923, 0x061a3264, 0x1c8e8c8b, 0xa23a95b3, 0x23dc9e98,
+    0x39cff330, 0xc1145962, 0x222cd951, 0x8df75888, 0x16db4257, 0x62dc5d0a,
+    0x396cd550, 0x043769e6, 0xb42356a7, 0xabeaae89, 0x0d0f07f5, 0xce35c28b,
+    0xc32b6d84, 0x6306e1ee, 0x9870c4f0, 0x2a841b87, 0x0901ecac, 0x6b042645,
+    0x6936853c, 0x32892501, 0x03506687, 0xad5e5d0a, 0xeab49365, 0x898cf314,
+    0x6c16447b, 0x9781d7e7, 0x27522e4e, 0x45869d34, 0xc228a1e6, 0xf528e0ef,
+    0x1441d060, 0x58319f21, 0xac24488a, 0xf1d16be2, 0xc5d7ddb7, 0x58f73c6d,
+    0x064f7b82, 0x312ae13b, 0x48ac11e8, 0x9c27460d, 0x438d5e70, 0x39a8e705,
+    0x50d26bed, 0x61410cb8, 0x18f3221c, 0x9957bbab, 0x7bc4ac23, 0x6858e9a6,
+    0xfc5c0112, 0x1c4d479d, 0x0cb401e7, 0x88b2d41c, 0x85bca29f, 0x48dcf644,
+    0x15a037f5, 0xf4963c3a, 0xaad88100, 0x881d8e0a, 0x751573f6, 0x6aa2ae54,
+    0x060a4baa, 0xb3e40e70, 0x208489e1, 0x404b3914, 0x96b2873f, 0xc3b5ec96,
+    0x501f7a16, 0xeac3efe4, 0x8f912ef1, 0x33c76bf6, 0xd7ebf5e8, 0xf8cbcabb,
+    0x20aaed95, 0x7ff38a80, 0x5b158d84, 0xdf34120b, 0xdfe83910, 0x94aa1868,
+    0x6d99ab18, 0x703c9ca3, 0x054d04aa, 0xd813b905, 0x3d7aadb5, 0x6a814ec1,
+    0xd586209a, 0x3626979e, 0x9ab3bfb0, 0x5191910a, 0x5dc01006, 0x68a9f4a7,
+    0x9fea378c, 0x402d3439, 0x10a204d7, 0x3625f228, 0xb4d599a2, 0xafb7ead5,
+    0x4b7abd5e, 0x3056a243, 0x909b08b3, 0xbe444c88, 0x1d451817, 0x4714c498,
+    0x8c4d63b3, 0x632f2181, 0x493d2b85, 0x2f2181cd, 0x586ac4ce, 0xbab12a76,
+    0x2aea9414, 0xf3b13a13, 0xc0b44467, 0x24328200, 0x31ac6b53, 0x42b46d08,
+    0x208e8aaf, 0xc659c5d4, 0xc53a6250, 0xab8a54ac, 0x5070374a, 0x8090bd3e,
+    0xc06aed28, 0x5a6f4aa9, 0x4d855d4e, 0xfa326d84, 0xc9f63d33, 0x078494d8,
+    0x35c08c3e, 0x757a027e, 0x38cffc2b, 0xdcdef7d8, 0x3b86ac09, 0x89133a87,
+    0x3a019893, 0xf60672de, 0x60ac0aa7, 0x9d3276e5, 0x94a6c8ac, 0xe15df058,
+    0x0b3c17b0, 0x560065e8, 0x46260ca0, 0x8c321064, 0x3198687a, 0x004a2f4f,
+    0x0dc94a47, 0xf62d6cfd, 0xa96ab6db, 0x262e5843, 0x12f90910, 0xab1205ea,
+    0x1918dd6d, 0xca5dcf98, 0x9ea7adf8, 0x50abc6eb, 0x4d805919, 0x19da31ce,
+    0xaa6485c3, 0x7385f115, 0xc309c6a0, 0x62f0f408, 0x0b24186d, 0x84cd3402,
+    0xb10400ff, 0x11c14a57, 0x6d04ce64, 0xb66d0026, 0x00ff122d, 0x248c2e00,
+    0x0a3501d6, 0x84c361f4, 0xda17d065, 0x0ca1c391, 0x084373db, 0x96c2c68b,
+    0x9d8d38d7, 0xe19ca11c, 0xed1a644c, 0xc59ca733, 0xca672aa8, 0x4768c947,
+    0x082f13e4, 0xc2a82156, 0xa120c901, 0xb6c2e178, 0x6240aadb, 0x134dba2c,
+    0xebfb07f7, 0x3aed22fb, 0x8eac3352, 0x4fcdf18c, 0x0f059425, 0x884370ac,
+    0x98bec9c4, 0xa71859de, 0xc3ee5736, 0x02acc356, 0x79e6742d, 0xb2f9bd85,
+    0xf7620154, 0x41508ad2, 0x07db293f, 0x96ebf034, 0x436d12a8, 0xafb2300f,
+    0x60250f7c, 0x2c6e0c53, 0x8b19ba53, 0x4b361182, 0x61b924ad, 0xc47f5486,
+    0x73a9adc1, 0x00ff7c74, 0x752d47e0, 0xa7adf84a, 0x15fceb9e, 0xcaf38e7a,
+    0x17131448, 0x679171ae, 0x530677f7, 0x4df343b3, 0x06c6e26d, 0x0ff5b37c,
+    0xe726b5cd, 0xd35ee2a3, 0x78f4e902, 0xfc3c9e6d, 0x40dee89e, 0x9345dfbc,
+    0x4362901c, 0xc206d03e, 0x4c463a77, 0x9f6efaae, 0x82104dbe, 0xd0d51a5a,
+    0xc57332f2, 0xa347eb46, 0xde3fb83f, 0x8d3b5a1f, 0x59b84ac5, 0x9f3e8a40,
+    0xb87abd5e, 0x25485700, 0x5ca934b5, 0x17751701, 0xa3465f2e, 0x33bd3911,
+    0x69710d5a, 0x4d347876, 0xb5f6c57f, 0x25aeacab, 0x02326ad1, 0x75c6fbfc,
+    0x8c4dc92b, 0xc7d6865e, 0x802a765d, 0x09f82320, 0x32003b8c, 0x176ea843,
+    0x4c1483c6, 0x8d2e9215, 0x6342ba9f, 0x7674392a, 0xaade8ce4, 0x790a8b83,
+    0x328ce6a2, 0xa8879142, 0xafd7ebf5, 0xe5a4f25b, 0x018524bb, 0xd7b47f84,
+    0xda8aaf54, 0x56b1ee79, 0x14c8be18, 0x34b53509, 0x3ef24a15, 0xcfe7f399,
+    0x40737059, 0xd8f39db0, 0x4b194801, 0xcb464644, 0xe95f018a, 0x7a68ddcb,
+    0x31948c51, 0x6d731f38, 0x9eb5f1fa, 0x7b3e9f80, 0xd9d8cb4c, 0xea393539,
+    0xa0a06906, 0x12887e12, 0x164dc57b, 0xc3a868d5, 0x2087a450, 0x8a75a9ec,
+    0x8d015b02, 0x8c250eaa, 0x70b44766, 0x2900b2e5, 0xbdc6eb49, 0xc9713dba,
+    0xe313e8f3, 0x050d28ca, 0x41cecd06, 0x7800ffcc, 0xa6a40e7d, 0x0a1c736f,
+    0xfd0e7fc0, 0xdfeff7fb, 0x2a5e71bf, 0xc84d241c, 0xc06267ab, 0x282a1626,
+    0x381129c4, 0xdf6fd43c, 0x43f92de1, 0x3985da06, 0x8d006b68, 0xdf84bf52,
+    0xfbfd7ebf, 0x8a25eff7, 0xc0c4200c, 0x7f4c80ef, 0xdbd5d461, 0xb4155f8c,
+    0xa578ddf3, 0xf4a83941, 0x584a51db, 0xfb855398, 0x7235a733, 0xa2c4a017,
+    0xda724f45, 0x52d019cc, 0x64d4d214, 0x082e44a6, 0x379702ce, 0x23d517f0,
+    0x0071335e, 0x270ff886, 0x2505b1c2, 0x4fa35ec6, 0x1cc35cbc, 0xedbe7088,
+    0x4f39c757, 0x2ec0595b, 0xd6be7e8f, 0x60b7dd27, 0xa723f054, 0x7732cbb6,
+    0x34081ed9, 0xe1a10f29, 0xe98a2aa9, 0xc54bbe8c, 0xe180f6d6, 0x496e85be,
+    0x7a279689, 0x482cb4e6, 0xa6c19b96, 0x6caf4718, 0x882baa72, 0x50746e0f,
+    0x7c2f3ea0, 0xb458a374, 0x239c1a02, 0x8db54e2e, 0xedab48f9, 0x5ab682a5,
+    0x117a8360, 0x5a090280, 0x6e00f021, 0xae100ec3, 0x1c10796b, 0x1fdce7aa,
+    0x917df1ef, 0xd93ff7cc, 0x5cc9b1ce, 0xa9d13169, 0x39cf8983, 0x003ea676,
+    0x121bf5e3, 0xd6b362aa, 0x71acb5b8, 0xca1f9bda, 0xfc5f58dd, 0x4e752527,
+    0x9ea7ad78, 0x6c2ac5eb, 0x411e2a8c, 0x03d368ed, 0x3519f9c0, 0x009b8bf4,
+    0xe4163065, 0x0cb7ed4d, 0x1c4af218, 0x04ecf420, 0x200a1614, 0xa05e717b,
+    0xa6529a1e, 0x1d13a017, 0xea187aa4, 0xade14551, 0xffac06bf, 0x88a80500,
+    0x0a8422a0, 0x78ba02f0, 0xec137b5c, 0x06a8eb30, 0x26eec16b, 0xb0b41937,
+    0x12770100, 0x52b3e11e, 0xad06016d, 0xcfbcd157, 0xe2f02fe8, 0x006a5e2d,
+    0x0ee66c94, 0x182b1f43, 0x43c1c96c, 0x4a199a8f, 0x4ea9331c, 0xc910cc8e,
+    0x97567fcc, 0x59e6aa05, 0x2c04b044, 0xcedd74f9, 0x4884c929, 0xd161831c,
+    0xd230b668, 0x709fd4cb, 0x64f4b17f, 0xfa203bed, 0x264b3f58, 0x3aaad788,
+    0xaad3e974, 0x44833402, 0x8e3aacb1, 0xb3bd1420, 0x3259b909, 0x2716a326,
+    0x93d1d063, 0x13c1292a, 0xc98d2c59, 0x0eb01916, 0x48464738, 0xafc0c980,
+    0x7e042ce0, 0x2447db8d, 0x0ece1104, 0xb326ca70, 0x544ae36d, 0x4b92fcf1,
+    0x33f2ce70, 0xa32f7bdd, 0xf3008f8f, 0x9d4e673d, 0x85ed743a, 0x5c34706a,
+    0x3f43b741, 0x39d595b5, 0x7b9eb6e2, 0xfeb36fac, 0xb47fb7d4, 0x993da22f,
+    0x01403d35, 0xcdfdbd48, 0xa62391f0, 0x0a0715da, 0x1ed65a3f, 0xbba13d56,
+    0xb350e057, 0x0300ff94, 0xe3d688ae, 0x5008f813, 0x0a8542a1, 0xd0ea8a17,
+    0x236a013c, 0xabae8464, 0xb8d22fef, 0x3ee8201a, 0x2b102ddc, 0x69a12328,
+    0xd16950bb, 0x73446ba4, 0x82453e34, 0x6d4ee74f, 0xce9c3a89, 0xa739675d,
+    0x455b592f, 0x792bbd7c, 0x58a90fcf, 0x66e365f5, 0x94226232, 0xb02d68cc,
+    0x3f68f115, 0xaaae242d, 0x85994280, 0x471d241f, 0x9a5400b2, 0x6302820f,
+    0xd6b7a690, 0xd59f09a8, 0xce681c76, 0x47a69a55, 0xa93a2c82, 0x3a3648f0,
+    0x0347891a, 0x0eb4aef0, 0x2ce201ae, 0x7c920a12, 0xac8cebed, 0x07fc8fd6,
+    0x77922f37, 0xee79da8a, 0xf7b1dabf, 0xdb29fb07, 0x71a9e433, 0x96a984b5,
+    0x91ec044d, 0x506f92a9, 0xa552a9d4, 0x5e680858, 0x4092906e, 0x583d0d81,
+    0xdb1a1b45, 0xd0c96c59, 0x2f3331eb, 0xa98c110b, 0x61dd216d, 0x2a1994a7,
+    0xbe748408, 0x11c438ab, 0x1fd6629c, 0xa6bdb372, 0xead3cd48, 0x8decd5aa,
+    0x034155a0, 0x1caad509, 0x122351a1, 0xc6167b69, 0x6c71c7f6, 0x2bca2095,
+    0xa9542a3d, 0x7a7caa52, 0xb8aa33a1, 0x10173406, 0xe1bc650d, 0xfb666b37,
+    0x312bad9b, 0xc59093a0, 0x567c5d11, 0x151f2b3e, 0xc5c78a8f, 0xf1b1e263,
+    0x7cacf858, 0x1f2b3e56, 0xc78a8f15, 0xb1e263c5, 0xacf858f1, 0x2b3e567c,
+    0x8a8f151f, 0xc955cdc1, 0x436694ab, 0x378e1035, 0xa7adf803, 0x8f37eb9e,
+    0xddab0fbd, 0x3ebb579f, 0x5e7d76af, 0xd9bdfaec, 0xeab37bf5, 0xeed567f7,
+    0x9fddabcf, 0xaf3ebb57, 0xec5e7d76, 0xf5d9bdfa, 0xf7eab37b, 0xcfeed567,
+    0x579fddab, 0x76af3ebb, 0xfaec5e7d, 0x7bf5d9bd, 0x67f7eab3, 0xc3cdeed5,
+    0x31decda9, 0x205a1b59, 0x00e251b6, 0xd4155431, 0x6a79d89b, 0xfed420c1,
+    0x954aa5aa, 0x52a9542a, 0x2a954aa5, 0xa552a954, 0x811c954a, 0x75b0cc6a,
+    0x0c9109a9, 0x8806b5b2, 0xcc37de48, 0xcc66b042, 0x69b30c6b, 0x0228a08b,
+    0x3a236f5e, 0xc4b954d9, 0x9ea4dbc6, 0xf821af60, 0x16729c69, 0x634c2193,
+    0xfd9b1dee, 0xd87f1520, 0xd0a23993, 0x96f1865a, 0x21c31d2f, 0xfb8c2a13,
+    0x1b9d384c, 0xcd9ced33, 0xead00227, 0x03cb193b, 0x8cd5041a, 0x6b6db222,
+    0xb595f411, 0x18460287, 0x699b24c6, 0xa4c20fc9, 0x5202d455, 0xec9a83d3,
+    0x8ff4deaa, 0xc38c97ca, 0x502c44c4, 0x960c638a, 0x73c6ea64, 0x1d30e339,
+    0x033954c4, 0x432ca051, 0xd637a0a2, 0x4b2e59e6, 0xfe86e6cd, 0x02ba2633,
+    0x48c1c2c6, 0xa1504a99, 0x485bdc87, 0xf8a33a5e, 0xeb9ea7ad, 0x709fa9fd,
+    0x1dd7b17f, 0xcc8b680d, 0xa998c322, 0xafe471e1, 0xa21b7045, 0xdb5605b5,
+    0x2a4e04d5, 0x78d0389b, 0x5e940178, 0x050a8e0e, 0xa399352f, 0xcca5e23c,
+    0x2815c4e2, 0x2bd007f9, 0x2bddb230, 0x733c8768, 0x9ea12065, 0x803f893c,
+    0xe0ba6cf2, 0xa3390a00, 0xbbce8a51, 0x3c3651ae, 0x8934a69a, 0x038feaed,
+    0xb5c8b9c4, 0x0bdc7911, 0x29b06e38, 0xf44c6844, 0xa9c4a07d, 0x2f11b4de,
+    0x14a90993, 0x35e78d65, 0xce9b8a19, 0xc0a87e74, 0x3c946dc6, 0xd7f01923,
+    0x60606e39, 0x9a2ce419, 0x2f0050e3, 0x706c016a, 0x1a525f07, 0x6a3234c8,
+    0x65d4a532, 0xf2505bc0, 0xb26f5101, 0x11a875b7, 0x3f62a6b5, 0x612179fb,
+    0x5c78a459, 0xc549081d, 0x8d027205, 0x6ab29ac8, 0x6820a0eb, 0x25422cb4,
+    0x00e42041, 0x8ee46903, 0x8c15401c, 0xec4089b7, 0x90a36737, 0xc5c29e0c,
+    0x01ef8ec3, 0x51cb45de, 0x07c6f348, 0x95772a83, 0x0de540ef, 0xc06108c5,
+    0x44420cc4, 0x85754812, 0x7ee6f8f6, 0xc86de4fb, 0x44312f2e, 0x0183b1bc,
+    0xd046ee98, 0x8c00f60c, 0x260b51b0, 0x56838152, 0x9a5ca56e, 0x9c7787b1,
+    0xe784b430, 0x5b804e47, 0x29c656f2, 0xaa60120d, 0xab78c116, 0x1efe2069,
+    0x1d176285, 0xb650c01a, 0x5c0c8abc, 0x5eed2664, 0x928e178c, 0x0bf03335,
+    0x3fd276b1, 0x829e1306, 0x91503e00, 0x3faae3f9, 0xee79da8a, 0xf799dabf,
+    0x0dc3fb07, 0x13debbab, 0x55d32e50, 0x0417111b, 0x9d00ff81, 0x0d8f2762,
+    0xec91628a, 0x2eb16c7a, 0x6d181853, 0x25ba3fb1, 0x868538d0, 0xb81570ec,
+    0x9919e771, 0x41fe1e94, 0x81200297, 0xccd5f151, 0xcce815b4, 0x69d2cb37,
+    0xa9ef6dcb, 0x395bc53e, 0xd017fe68, 0x95a0be57, 0x532d1909, 0xf168e946,
+    0x8c2cf8a8, 0x49e62c23, 0x9ab9a67a, 0x10550488, 0xf08ba82e, 0x2b64d55e,
+    0x5159102a, 0x17458aac, 0xd3dd81da, 0xd70442c0, 0x6e114fc4, 0x213ffe38,
+    0xfd5b9c9d, 0x44faae66, 0x16d5d652, 0x26eee9b5, 0x43f0054b, 0xdc98aa3b,
+    0x886d2c53, 0x65a2d2de, 0x03459428, 0xbd3ee903, 0xb4cc28af, 0xc6cf1d2c,
+    0xcd1940b9, 0xb2d2bb59, 0xa1424abd, 0x3a0ce942, 0xdc3e6a31, 0xc900d7d4,
+    0x2880e129, 0x4dc6c5b0, 0xa377c785, 0x16aec160, 0x12a23922, 0x5ec07667,
+    0xdf39789e, 0x080e42d4, 0x3dafd610, 0xe9a5be5f, 0x45282665, 0xdd668c3c,
+    0xb8548d55, 0x3bce9d84, 0x21d49d8a, 0x14070214, 0x2d802863, 0x24256019,
+    0x38a9e92e, 0x890440e5, 0x135d8b11, 0xaace4814, 0x9e1b57e0, 0xf7ee8d5a,
+    0x3d0e2d49, 0x029f36df, 0xc8d9b324, 0x85f3fe11, 0x787037a5, 0x38caae13,
+    0x0048081c, 0xd887cc66, 0x8636208f, 0xf232ce4c, 0x62558858, 0x030490d1,
+    0x86793880, 0x6bc08696, 0x8beca7e3, 0x34b05b91, 0x67172800, 0x56fc491d,
+    0xfe75cfd3, 0xdc5343d6, 0x2aaf028c, 0xa31653e6, 0x181500ff, 0xb18599e8,
+    0xe941b074, 0x8a74ca64, 0xbc670c42, 0x882406bf, 0x21631751, 0xe82ce51d,
+    0x6b1644b8, 0x6ff39a29, 0x7638399a, 0x962efc8b, 0x17834ed1, 0x00ffa4d0,
+    0x7fbcad6b, 0x39ded7ad, 0xf391b7d9, 0x31452bba, 0x44f526ef, 0x6012a3b2,
+    0xc6ebe62f, 0xbecd4bee, 0xdc34fa68, 0xc9c9dbec, 0xec5cb4c3, 0x869af0db,
+    0xbd126d96, 0x14965bb0, 0x40a30349, 0x4738e800, 0x46cd12e5, 0xc3e90819,
+    0xafd86620, 0x7115754f, 0x3a0d9440, 0x4309375e, 0x965c2031, 0x6ce6068b,
+    0xef0e9f91, 0xa41d576c, 0x07c1bf14, 0x99341b2d, 0xb6bbe2b9, 0x88726e96,
+    0x5a999379, 0xb6531a9d, 0x8629d564, 0x6d9b3227, 0x3e15c9f0, 0xa3181ba9,
+    0xb825f013, 0x87e5a3db, 0x2ab7302f, 0x6ed35c3e, 0x4c29ea99, 0x5e715755,
+    0xc086bedd, 0x2818f349, 0x09690e72, 0x59e657f7, 0xa1c112a1, 0x4a45b80e,
+    0x3ab726b0, 0x0e54acf5, 0x8e60da25, 0x9c690d72, 0xd85277f8, 0x1d9105a0,
+    0x56465a14, 0xf5592e93, 0x9e084af1, 0x2470bd03, 0x34b57882, 0xb8bf2955,
+    0xea36816c, 0xe1788479, 0xd107a892, 0x159f172a, 0x7fddf3b4, 0xf7d490b4,
+    0xd0267d38, 0x9f24cc8f, 0x3f3d0876, 0x00ff00ff, 0xf1fe00ff, 0xec96d988,
+    0xb98645e6, 0x9cbe45ad, 0x14000aa7, 0x6b83bd45, 0x25d3958d, 0xce708367,
+    0x0fb42cac, 0x33870d70, 0x4a925680, 0xf11084ec, 0x8621cca3, 0x46c5ad52,
+    0xd9506be2, 0xefa24df0, 0x4fedda06, 0x2e36e92e, 0x67c6d488, 0x4552f174,
+    0xff592f54, 0xff00ff00, 0xff00ff00, 0x05648700, 0xfcf02733, 0x18c6c922,
+    0xd4b3c5ed, 0x6801b689, 0xc25ad912, 0xec440cfb, 0xcb20602a, 0x8fe504a6,
+    0x4fd54139, 0x31a1f798, 0x849fc270, 0xabb3634c, 0xbc6f0ebb, 0xcc2b3c05,
+    0x41e9cb54, 0x913c42fe, 0x28548416, 0x9aa66e47, 0x00a3b566, 0x442f3981,
+    0x49664cdb, 0xada95294, 0x55d78e11, 0xc531457b, 0x7b3120e9, 0x129eaedf,
+    0x44334528, 0x182543a0, 0x3171d55e, 0xa09d809e, 0xa4116c3b, 0x2695c152,
+    0x145439d8, 0x82428579, 0x1785a3a5, 0x49c3cbdd, 0x0fbc8869, 0xeaef9adc,
+    0xdbb72de3, 0x2381dca4, 0x731091f0, 0x349227e2, 0x6749c426, 0x829a1aae,
+    0x882e80ce, 0x5492d103, 0x692b3e2f, 0x96c2bae7, 0x4e69af53, 0xf63aa5bd,
+    0x53daeb94, 0xbd4e69af, 0x94f63aa5, 0xaf53daeb, 0xa5bd4e69, 0xeb94f63a,
+    0x69af53da, 0x3aa5bd4e, 0xdaeb94f6, 0x4e69af53, 0xf63aa5bd, 0x53daeb94,
+    0xbd4e69af, 0x94f63aa5, 0xcd02daeb, 0x59463975, 0x65050b43, 0x0b2d9416,
+    0x8c59b396, 0x6cc7f60f, 0x9f1e58b0, 0xa7c7ea35, 0x3126df35, 0xbf141d8b,
+    0xd8df29b3, 0x0c623c2d, 0x107db4b5, 0x686113c5, 0x950a3132, 0xd81125ea,
+    0x109d8970, 0x1f258eb7, 0x1c569dea, 0xe742fbf0, 0x8f124478, 0x6a0a4981,
+    0xc68a2e93, 0x5879053a, 0x1219d0ac, 0x3a90b3d1, 0x8baa2fbd, 0x3d00c048,
+    0x2abc8cfa, 0xc8a2195c, 0x180578e7, 0xbf2e39ce, 0x511405aa, 0x45511445,
+    0x14455114, 0x51144551, 0x913c7f74, 0x1c934bc6, 0x812a24ab, 0xadf89cab,
+    0xfdeb9ea7, 0xb9a7e6a9, 0x04ce061c, 0x28005712, 0x92be5c80, 0xc876fed5,
+    0xffac4e6c, 0xafd75300, 0xf57abd5e, 0x5eafd7eb, 0xebf57abd, 0x4d44afd7,
+    0x37c23b99, 0x66394b92, 0x4269a565, 0xa958aa0a, 0xd0f87b2c, 0x34b8e0d8,
+    0x6c140d0b, 0x92de3288, 0x4f3b370f, 0x818415df, 0x9f0783c1, 0xf9d707f5,
+    0x63074a72, 0xf73c6dc5, 0xe6b4ca59, 0xefb32775, 0xbfcf9efa, 0xff3e7bea,
+    0xfbeca900, 0xefb3a7fe, 0xbfcf9efa, 0xff3e7bea, 0xfbeca900, 0xefb3a7fe,
+    0xbfcf9efa, 0xff3e7bea, 0xfbeca900, 0xefb3a7fe, 0xbfcf9efa, 0xff3e7bea,
+    0xfbeca900, 0xefb3a7fe, 0xbfcf9efa, 0xff3e7bea, 0xfbeca900, 0xefb3a7fe,
+    0xbfcf9efa, 0xff3e7bea, 0xfbeca900, 0x8e91a1fe, 0x7ed43f67, 0xfb0dc673,
+    0xc2339c80, 0x82420845, 0x4ee5d082, 0x9ee5ca55, 0xcae7a97c, 0xe7a97c9e,
+    0xa97c9eca, 0x1997cae7, 0xefaa05ce, 0x50ac03db, 0xccb25485, 0x03911144,
+    0x40e5f34b, 0x19746d13, 0x7292c40d, 0xa7f2792e, 0xf2792a9f, 0x792a9fa7,
+    0x2a9fa7f2, 0x9fa7f279, 0xa7f2792a, 0x01202a9f, 0xc0b63620, 0x80647449,
+    0x8b5a08ca, 0x8250be67, 0x0a2b0304, 0x1753f684, 0x4c2633fc, 0xc9643299,
+    0x9adf2b93, 0xd43823b9, 0x53223093, 0xffa9f353, 0xb7e32200, 0xb260a4f0,
+    0x26535e7c, 0x6432994c, 0xa5958ec9, 0x5069d539, 0x94701c0b, 0x31ae72aa,
+    0x7b9eb6e2, 0x9aa9f6af, 0xda35e49e, 0x13f8f7be, 0x00ff00ff, 0xc3fbace6,
+    0xed8e6a98, 0x9497943c, 0x091c3b90, 0x9d9461e1, 0x3dfe2d48, 0x63745d79,
+    0xc6654879, 0x4dc257a4, 0x190b487c, 0x19ef1f6a, 0x2b014e53, 0x53545db4,
+    0x43219992, 0xfa4d23c0, 0x00ff00ff, 0x00ff00ff, 0x787ef50f, 0x7007a02d,
+    0x37f8fc1e, 0xff069ffc, 0xdfe09300, 0xfe1b7cf2, 0xc87f834f, 0xa750e3e6,
+    0x41b68812, 0x963757a6, 0x27c749c6, 0x66501d0e, 0x2f83cd9a, 0x28125ae9,
+    0xce683c81, 0x88102e81, 0x4ab08dd4, 0x4b6605cd, 0x60361eee, 0x4c1b2abe,
+    0xa0e6aa75, 0x63b59a71, 0x2ec9e421, 0xc699cfb2, 0x10ad46ed, 0x033500ce,
+    0x981d2c14, 0xd6529169, 0x5446d8da, 0xf96ff093, 0x00ff0d3e, 0xe4bfc127,
+    0x9ffc37f8, 0x9300ff06, 0x877fdbed, 0x1e8253a2, 0xbae7692b, 0x72b913c5,
+    0x2e97cbe5, 0xe572b95c, 0x5c2e97cb, 0xcbe572b9, 0x1c5c2e97, 0x11ade49e,
+    0xd3d6925c, 0x31f71ac0, 0xb9f2945f, 0xe7ca73e5, 0x9e2bcf95, 0xb83b0657,
+    0xc93b6aa9, 0x644b99b7, 0xc8ab1467, 0x021f00ff, 0x858384ae, 0xa4baad16,
+    0xc7d71707, 0x943005ac, 0x7436c493, 0x8ef3542e, 0x6675cc0a, 0x11deeb88,
+    0x715f0011, 0xd1d39223, 0xbcd2b4f9, 0xf25c79ae, 0xca73e5b9, 0x2bcf95e7,
+    0xb386a695, 0x6d2b092a, 0xf2cbb40b, 0x1a2f2755, 0xeb73184c, 0x3be58486,
+    0x0c53e4c7, 0x2f878984, 0x907ac186, 0x4c49e7d7, 0xd55300ff, 0xab0aba40,
+    0x19d852eb, 0xd42c8f0b, 0x6bfe206b, 0x6d5c58ee, 0xa1400217, 0xa9c66544,
+    0xc31d69d5, 0x8ede69ef, 0xafa05d62, 0xfa1f1858, 0x5ac0cd30, 0x42a17c1a,
+    0xed4457b5, 0x4bc8f19b, 0x7db9fc2a, 0xc297c1c5, 0xab8500ff, 0x610eaf24,
+    0x7b9eb6e2, 0x1aa9f6af, 0x0bafe49e, 0x2d0b217d, 0x20240569, 0xc259655a,
+    0x29a4a907, 0x5c2e97e8, 0x4fe78cb6, 0xd0211610, 0x0b81a4c1, 0x42671df6,
+    0xf584154d, 0x6a77722f, 0x5e08467c, 0xb182a566, 0x19ad00f0, 0x34e1e8b8,
+    0x743b1d1f, 0x82de4eed, 0x8e673885, 0x8555fba4, 0xe3537be7, 0x1912b44d,
+    0xa04c9129, 0xb58280e7, 0xde532d13, 0x9f878dc5, 0x9654e172, 0xbaac0076,
+    0xd313c886, 0x64b95c2e, 0x348a694e, 0x161ed215, 0x339d0aac, 0xaa0d716d,
+    0xeba0a7de, 0x744aaad7, 0x0ba0056e, 0x66510646, 0x16a006eb, 0xc2683bd5,
+    0x6b185505, 0xa1a71d0c, 0x1e43b908, 0xdcc5f689, 0x420b36a8, 0xa7a3a137,
+    0x2843e469, 0x2800ea88, 0x425669bb, 0x0fa31137, 0xfd7743d0, 0x64464f49,
+    0x93137559, 0x5da4cf66, 0x9dd2ccb9, 0x979882a5, 0xd598bc6a, 0x628ab119,
+    0x5043efc5, 0x690cb01d, 0x7bfc9cd8, 0x449ff5c1, 0x82a9d7eb, 0x52fa0206,
+    0xbedab714, 0xf1309832, 0xd63d4f5b, 0x9d99555b, 0x9dd99dd9, 0x9dd99dd9,
+    0x9dd99dd9, 0x9dd99dd9, 0x9dd99dd9, 0x9dd99dd9, 0x9dd99dd9, 0x9dd99dd9,
+    0x9dd99dd9, 0x9dd99dd9, 0x9dd99dd9, 0x5dd89dd9, 0x0f267599, 0x02622401,
+    0xeea7a49f, 0x4efae860, 0x2cd8cbe7, 0x5427f5cc, 0x00ffe354, 0xb7a07b0f,
+    0x193c13be, 0xd3806f61, 0xdf811044, 0x4c694041, 0xa185edd4, 0x7dea12fc,
+    0x0038050e, 0x555d91d6, 0x03988162, 0xee7bcc6a, 0x18735048, 0x15a27e83,
+    0x61899b1d, 0xb88c8042, 0xd582424b, 0xaeca80ae, 0xbe7e9c03, 0xa71c4be1,
+    0xaaab89d3, 0xa664f713, 0x799fa858, 0x5499313e, 0xfaa086d7, 0x1d405730,
+    0x08ba21c3, 0x143c23a7, 0x48387951, 0x8f0dcc5d, 0xf7d17746, 0xb56a219e,
+    0x315929d5, 0x361d66c7, 0xd3846cf4, 0x108e98d7, 0x23085c11, 0x3e8a06b2,
+    0x6954a674, 0x9c8f1a58, 0x7768883a, 0x5fac2762, 0x884ce39b, 0x5862b48b,
+    0x4f446bf3, 0x6c49824a, 0x2adb5f33, 0xfac395d2, 0x44a833c7, 0x720c5196,
+    0x60a00122, 0x2635630a, 0xd7cab566, 0xb67b78f2, 0x95e49a16, 0x249507e4,
+    0xdf887263, 0x665e467a, 0xfd15e1a0, 0x16e9d504, 0x46c1c8dd, 0xbbf8aa86,
+    0xc8d08a19, 0x0a08f1a0, 0x3d4f5bf1, 0x8d47fbd7, 0x6685734f, 0x964600ff,
+    0x900df0c0, 0x30182cbd, 0xea79cd60, 0x7c6d2daf, 0x169662b1, 0xeb7741d1,
+    0x4dab16eb, 0x5f6eafc7, 0xd8cf34a4, 0xb29a72fa, 0x1df3b615, 0xbe75e7fa,
+    0x607dfdbe, 0xa1ba802a, 0x2aaebbaf, 0xbaa2898a, 0x6b663a7b, 0xade5a5cf,
+    0x938be8a7, 0x4416637b, 0x73baa289, 0xc1e0e9c3, 0x81da0183, 0x6460c993,
+    0x6d5348b5, 0xdd8e40cd, 0x3feb1131, 0xd8bc9e06, 0x81c6acbc, 0x88e8b712,
+    0x1bdd5c5f, 0x084a3118, 0x38be2a5a, 0xd2507230, 0xa821fbdf, 0x1c3b836d,
+    0x344c7428, 0xaeb44ea3, 0x6d16e55a, 0x6bd4aa66, 0xdf9de56b, 0x757d1df2,
+    0xbcdcbc9a, 0xea79d1f4, 0x10f5d38e, 0x8b78ce34, 0x5eceb54e, 0xc9b519a5,
+    0x57d08525, 0x0e453c5a, 0x3e3b0765, 0x79dac997, 0x2c573018, 0x15e5e9d3,
+    0xf3d641b1, 0x01cf97d6, 0x58511aaa, 0x7aca91c7, 0x65c16030, 0x5defa572,
+    0x856fc4ba, 0x75f539e8, 0x55156aa1, 0x10c4cbb5, 0xf3b415bf, 0x2c9e78dd,
+    0x255357fb, 0x50523a29, 0x35af7f02, 0xdddddddd, 0xdddddddd, 0xff99dddd,
+    0x4210e900, 0xcfd356fc, 0x87d6e075, 0xd2588c03, 0x0564b16b, 0xc98eba02,
+    0x3a6ad5f1, 0xc2d8bfaa, 0xeed4a528, 0x886bd285, 0xd75cdc52, 0x969c313e,
+    0x99ea6f53, 0x93c96432, 0x32994c26, 0x2693c964, 0x6432994c, 0x87dfe5c8,
+    0xe1e7aa61, 0x207b2819, 0x504c7679, 0x11ad0a80, 0x6504e6d6, 0x0f419ba2,
+    0x95bafaab, 0x52a9542a, 0x2a954aa5, 0xa552a954, 0x542a954a, 0xf8b128c6,
+    0xafd2d9b0, 0xb98c99ac, 0xc1b4fd8b, 0xdf6b5442, 0x15bf5811, 0x78ddf3b4,
+    0x24676835, 0x81fe2df5, 0x2dae4afa, 0x6d3caee6, 0xa2a176b9, 0x358d9598,
+    0x052cec7d, 0x7ebf577f, 0xeff7fbfd, 0xfd7ebfdf, 0xdfeff7fb, 0xeafd7ebf,
+    0xc792500f, 0xcb00b38d, 0xe39fb415, 0x742068a8, 0xe0ca530d, 0x6a0094d1,
+    0x82ab0e98, 0x9ebfd005, 0x2c67a0a8, 0xead79613, 0xe35d0a29, 0xf2ad5f18,
+    0x81405d43, 0x90cd8d31, 0xa4cf54ab, 0xec42da3a, 0x1ee93fce, 0x88eb6c20,
+    0xe82a7adb, 0x0d7a7f8c, 0xa3aaf288, 0x65c42928, 0x3930d14b, 0xe1094a4d,
+    0x1468550b, 0x4368a940, 0x3b6e246c, 0xa1546675, 0xdb9516db, 0xaa861ea2,
+    0x493d1fcc, 0x6ca5e282, 0x9539c0e2, 0x5a0c0418, 0x593751a0, 0xe5c37d80,
+    0xe802cfa1, 0xd60486c9, 0xb93aca84, 0xda158aa7, 0x9e6128f9, 0x1a04b0ac,
+    0x013c8c75, 0xbd1688ca, 0x22c8a3f1, 0xea800eb6, 0x7118d23b, 0x4adc96ec,
+    0x4950259a, 0xc25173e5, 0x4e06e305, 0x09b78665, 0xbd44ba99, 0x2d57cbad,
+    0x4a36650e, 0x29d9946c, 0xa66453b2, 0xf5914dc9, 0xc5c39275, 0xb9b9170d,
+    0x1a167914, 0x7e1532df, 0xc4394022, 0xa54d51d2, 0x13062b6d, 0x93ad3b74,
+    0xa28676d1, 0x330c4f00, 0x310a416c, 0x422f34e4, 0xc1247390, 0x614d1be5,
+    0x59cbb01e, 0x75616b89, 0x36259bca, 0xd9946c4a, 0x6453b229, 0x2caec9a6,
+    0xf75a2b0f, 0xebb83dab, 0x9eb6e297, 0x5673ac7b, 0xe86a565a, 0x5e0057e7,
+    0xdf71cff5, 0x7fc73df7, 0xea822cdc, 0x159694ef, 0x34805810, 0x5c3917dd,
+    0x5b3188c5, 0xc2ac5f3d, 0x9012a90f, 0xc5bd97ed, 0xce40c93c, 0xbf073d9e,
+    0x5f8d0691, 0x042264b8, 0x04826535, 0xae43c41c, 0xe4d37e84, 0x63b5855b,
+    0x2aeb613c, 0x1c788432, 0x58fd64ad, 0x24d4e30e, 0x2a8d4224, 0xb6523411,
+    0x7c3c8952, 0xa4c95032, 0x1db0b03a, 0x4467166c, 0x4859c7d5, 0x3671eb0c,
+    0xfa02e271, 0xd887876e, 0x6ea5e060, 0x0aa1664c, 0xd95a5041, 0xc8903141,
+    0x56d1b539, 0x75d6a047, 0x2d1684fa, 0xd453d6fb, 0xe72d134d, 0x4f64d019,
+    0xdc3365a9, 0x80ccfd77, 0xccaeb693, 0x1c9aebe8, 0x3f2a15f8, 0x5e42593b,
+    0xefed4a64, 0x1c64d237, 0x72d441a3, 0x1ff98042, 0x85fb7f01, 0x963fc6fa,
+    0xb00e9fda, 0x530cd33f, 0x748cf6a2, 0x049d865e, 0x99ec72c4, 0x14c3862c,
+    0x374a13cd, 0x0417d5d0, 0xad47052c, 0x1c9805f8, 0x0feaa265, 0xc2e7924e,
+    0xbdc43f1f, 0xbcb041e3, 0x80962504, 0xc65a15cd, 0xed3860ce, 0xa8fb2aa2,
+    0x40d3380f, 0xcea2386b, 0x369a50b1, 0xc5545952, 0x40682809, 0x5fd22a44,
+    0x6647ce64, 0x62186a02, 0x35d5d155, 0x9b01cef2, 0x69f5fb48, 0x5064aa37,
+    0x5f1008c6, 0xc2193dbe, 0x658258bd, 0x62f6f5dd, 0x61f15a42, 0xc938390a,
+    0x9170db14, 0xd7bcb72b, 0x47b481f1, 0x81151ad0, 0xc000f04c, 0x2911e0a2,
+    0x9edb33d2, 0xb7e7f6dc, 0xcbedb93d, 0xadb588ed, 0x83f823ee, 0x7d150306,
+    0x86a55dc4, 0x4cc82924, 0x44923a46, 0x04f77a9a, 0x8b70810e, 0x0ec9614e,
+    0x50263347, 0xaa5c8971, 0xa8338a26, 0x38cc6992, 0x51733506, 0x8fe3c94a,
+    0x0bde2003, 0xcfedb93d, 0xdb737b6e, 0xe3f6dc9e, 0xa0a9eb72, 0xc04b17d2,
+    0x5670dbde, 0x692bfea5, 0x3bf0bae7, 0xa98cf4e7, 0x9ef62e5e, 0x81a5f6d4,
+    0x8058e7a8, 0xceb20b4a, 0x9c045fb8, 0x2701b8c3, 0xba08bfda, 0x44b9b955,
+    0x2000963c, 0x52ca2c8a, 0x374bd348, 0x8a5678b3, 0xc3954114, 0x6f7447c0,
+    0x122dae01, 0x2d20de10, 0x45a26a60, 0x1ad55280, 0x85b5d5f7, 0x09662fac,
+    0xf63c2b56, 0xd376c82a, 0x2b72266a, 0x29937e3a, 0x824ba4f3, 0x8e026e93,
+    0xac13b105, 0xd298c712, 0xa69b700a, 0x85bd8602, 0x26cb8945, 0x3d0ec360,
+    0xccb56bb9, 0x8ffc7c95, 0x4c7aa292, 0xec07ac19, 0x7bdeed18, 0x5d68bf58,
+    0x60ae2eca, 0xf48a7d39, 0x73e9d424, 0xdda824a8, 0x2930b5ef, 0xbc028ffb,
+    0x5a51d425, 0xb46830d5, 0x6211be30, 0xdacec397, 0x8d46d707, 0x8c68341a,
+    0x65805613, 0xbbd6005d, 0x825ac244, 0x45cf8d7b, 0x6e54341a, 0xf3e1e89c,
+    0x8dc8766a, 0x1bcf014a, 0x18909be3, 0x1a5d5f59, 0xa3d16834, 0x61780145,
+    0xa42c3fed, 0x4230b6ac, 0x96ddf2ac, 0x0531b124, 0xa4028325, 0x7e59fee9,
+    0x30180c46, 0x0683c160, 0x2a30180c, 0xb4f1c6fd, 0x2e8490d4, 0x57d2f872,
+    0x300d5508, 0x6030d87a, 0x4b0283c1, 0x0a925e2f, 0x8cd64b8e, 0x3e9ba49c,
+    0xd32904d9, 0xfcf99db8, 0x75cfd356, 0x3e1e32e0, 0x3c69ac52, 0x54710eed,
+    0xc1f6e835, 0xb32a8c5a, 0x78d8452a, 0xa561e456, 0x296ef69f, 0x5bc54aa7,
+    0xb6817954, 0xe21c65c6, 0xe5d84096, 0x3d33a73d, 0xafdfcfe5, 0xa561e4ac,
+    0x0e73f69f, 0x7a214773, 0xe466a2d3, 0xafada8d5, 0xa0948a2a, 0x8b3135ea,
+    0x1dc36c40, 0x44811beb, 0x32502296, 0x4b651a2c, 0x4b9afc69, 0x708f080f,
+    0x1698c474, 0x9cee1ad3, 0xaca862fd, 0xb7a72a9a, 0xdd72a92c, 0x6e698d5c,
+    0xaf874ea9, 0x98f5c3d7, 0x699cc065, 0xf1187b86, 0xad8a5a69, 0x92e0b75f,
+    0x4bfc9109, 0xb65743f6, 0x425b1798, 0x97110699, 0xb7492826, 0xac1e6206,
+    0xd92de482, 0x35cb4066, 0x4bda841d, 0xd56316d2, 0x869b831c, 0x00dcc1e1,
+    0x10d666e6, 0x18f430f9, 0x57be3594, 0x7a13c5f6, 0x354d29ad, 0x00ffa246,
+    0x6663cc99, 0x40a316dc, 0x12f2a2b6, 0xa864a58c, 0xed210840, 0x5b505867,
+    0x26557b07, 0x92d067e5, 0x56a66290, 0x654be183, 0xc256eb6c, 0x491f3c52,
+    0xbf33731d, 0x81188419, 0x581f42e7, 0xc99e68d7, 0xc27de10b, 0x0572dce1,
+    0xb4d16c86, 0xe4cc3154, 0x20c63c18, 0x1a699432, 0x29b12678, 0x0f0d5349,
+    0xbd50a445, 0xa0f19935, 0x81050e3a, 0x6880d95d, 0x7f34c0f9, 0x3ddc63a6,
+    0xfb013bed, 0x44441111, 0x6a221c69, 0x71e62427, 0x08b8bbf0, 0x27570f55,
+    0x3d4f5bf1, 0x1e2d86d7, 0xbfc64b0c, 0x13bfc213, 0xc213bfc2, 0xbfc213bf,
+    0x12bfc213, 0x146da98b, 0xa8c242f3, 0xd1110112, 0x15e20d1c, 0x9caa2729,
+    0x157a92a9, 0x9f5060ea, 0x5f851891, 0x81d15859, 0xc8d3ad1d, 0x441899b8,
+    0xd699d24a, 0x08ab22b3, 0xad4c56ba, 0x4efc8404, 0x91d4caad, 0x5c832d90,
+    0x9f7ef5a6, 0x055c84b2, 0x3dcbdb71, 0x5778c2d2, 0xe25778e2, 0x78e25778,
+    0x5778e257, 0xe25778e2, 0x100d2010, 0xfd38dba3, 0x86800170, 0x1399a882,
+    0x95d69309, 0x52a9542a, 0x263f6995, 0x49a220c1, 0x4e137dce, 0x82605d1c,
+    0x7daeddd0, 0x063245f3, 0x494a42f9, 0x0d275d9b, 0x4ac8107c, 0x766dc922,
+    0x59a46cf1, 0xfbc42906, 0x20edc9ae, 0x19f6c8ba, 0x2b515447, 0x00ffa85c,
+    0x542a9500, 0x06a552a9, 0x623bf25e, 0x31114bc0, 0x6a541f91, 0x5e0c4c01,
+    0x3c804d2a, 0x11516dac, 0x91981f73, 0xc6aacb23, 0xca52630d, 0xe7f92eb3,
+    0xb75cdb22, 0x73fb94b2, 0xeda6f9e2, 0xce185247, 0xc87815ba, 0x15abccd6,
+    0x98d354c3, 0x01849564, 0x52c54c51, 0x5f8e3197, 0x25593ed1, 0x405a88b1,
+    0xb1218131, 0xb3cd8863, 0xaca0d582, 0x24d031f2, 0xf5ac950e, 0xb2a00830,
+    0xa261bad2, 0x57336d74, 0x5e5180d3, 0x3798a269, 0xcd2321cf, 0xace9da08,
+    0xd47c6585, 0x0b9ad7cf, 0xf8784bb3, 0x1181de5d, 0xa7ad78e3, 0x0114eb9e,
+    0x2407fed9, 0x6b7db3eb, 0x56235cdb, 0xbc9e1389, 0x537ed333, 0x00625e9b,
+    0x016ab920, 0x96df1691, 0x8c057c06, 0x046ad57c, 0x7b716048, 0xcf6e3154,
+    0xe5579fd2, 0xacd154b8, 0xacc0d021, 0xa0161bd3, 0xa2ed0b00, 0x8a80d8de,
+    0x21d448d1, 0xad4af670, 0x34110d66, 0x873f2360, 0x336fd13f, 0x701b4f35,
+    0x36ea0114, 0x75b3d96c, 0x5afd270a, 0x556c192c, 0xd2544c18, 0xf9c4e799,
+    0x69849ba0, 0x06c74aa5, 0xc534a416, 0x91bd0233, 0x1ae57bcb, 0x0d9d4413,
+    0x49ad785d, 0x61144df2, 0xe99c1428, 0x6c8b3761, 0xd877a79d, 0xd50426a7,
+    0x680548ba, 0xc6bea33a, 0x3dd0ea6a, 0xfaecd527, 0xd96cd4a3, 0x83cd66b3,
+    0x0ca6951a, 0xe08db336, 0x5164047f, 0x54200291, 0xd02ae005, 0x0719710b,
+    0x05021700, 0x08138796, 0x5ceaa8c6, 0xa8f129dd, 0x6b1a7024, 0x21361de8,
+    0x4d266d90, 0x103589e5, 0x1669cdf8, 0xd268503a, 0x9363a577, 0x41102e33,
+    0x819f71b3, 0x02ebdc32, 0xeac6261d, 0xa1f4039e, 0x62ccdde9, 0x09ee4ae8,
+    0x2be3a7c9, 0xab3f98d9, 0xdd859f08, 0x751046c0, 0xb4154f71, 0x1178ddf3,
+    0x3c488bd3, 0x2084ac35, 0xeba10644, 0x8fc7e3b1, 0x00ff3c1e, 0xe1f35d72,
+    0xbcb56b8d, 0x9dd99837, 0xcfbc7e4e, 0x8212787e, 0x34ed23d8, 0xbbfa5ce8,
+    0xa5cf4bce, 0xd279afe5, 0x9d72b6e4, 0x3e73f9cd, 0xeabca992, 0x78fdbcf5,
+    0x8fc7e3f1, 0xc7becf18, 0x0703853f, 0x85ec6f8a, 0xea2410fc, 0xa0163242,
+    0x70792906, 0x168280b0, 0xc6fc20e9, 0x657ed259, 0x8da28496, 0xbafb1299,
+    0x82c75442, 0xcbbd7d9b, 0x893f4638, 0x99d5e88c, 0x3542d565, 0xf69f2533,
+    0x172c0a61, 0xb6e97d12, 0xd9e83378, 0x53104022, 0xa3a6d92c, 0xe6d1e72f,
+    0xfb11c65c, 0x59adbd50, 0x05d34796, 0xad606bb8, 0x47710806, 0x58127ca1,
+    0x4ccb966d, 0x4125a103, 0x07fc80fb, 0x2059f689, 0xe884c39c, 0xb5997006,
+    0xcf5abba2, 0x1ac11add, 0xf0120037, 0x9435521e, 0x7509cd32, 0xa9264108,
+    0x25781f2e, 0x83d112f2, 0xd54413ea, 0xaf3af010, 0x21d0bb0b, 0xb415cfa1,
+    0x6663ddf3, 0xd23ff729, 0x70c84ae2, 0x53122786, 0xbe009c02, 0x3d4fd1c2,
+    0x90a80205, 0xdc166642, 0xb24e7c58, 0x0f194953, 0x78e3cccf, 0xdbf96e80,
+    0xeae7e5e9, 0x800a9be5, 0xec026500, 0xe2e71fe4, 0xe92f4493, 0xd05b2a14,
+    0xc0b89fb9, 0x9b3ce088, 0x138c1f63, 0xd48209aa, 0xe9480c41, 0x5510b50c,
+    0xe4b726fd, 0x78b3530a, 0x11d281a6, 0x0f885da1, 0xaf40a6eb, 0xa87390af,
+    0xad6ddde5, 0x0c08df42, 0x27275a02, 0xb0505620, 0x3c08421e, 0x30a626a7,
+    0x0b582cf8, 0xaac3287a, 0x0e2a862b, 0x085611b1, 0x34850592, 0x1ae48884,
+    0x6ff857c7, 0x4ddfcf5e, 0x20d11f0f, 0x6b56b65b, 0xb0af57e5, 0x68341a8d,
+    0x46c081d5, 0xea99f4c4, 0x87b8d4c4, 0x45b341c0, 0x510e2360, 0x6419e629,
+    0xf94e686b, 0x8bfbcd3b, 0x6946dd4d, 0x4db045c6, 0x2beabc26, 0x29b4f06e,
+    0x82123039, 0xf7a2e82e, 0xdeea96eb, 0x68341abf, 0x5f3ca3d1, 0x28e92850,
+    0x074eb4ce, 0x5f432bf4, 0x1eb76268, 0x30bd9224, 0xd526e355, 0xb89f1a15,
+    0xdee0f522, 0x5d4ba9a1, 0xe7203dab, 0x887e4f0d, 0x352449a2, 0xbd40703f,
+    0x24e2d813, 0x4962fa95, 0x290c9224, 0x8c4ad90a, 0xa55dc30b, 0x0ff5a56a,
+    0xe7997882, 0xee79da8a, 0x5a3978bc, 0x1a41f668, 0x134247e9, 0x4b72e871,
+    0x70a4a028, 0x5f3c2e11, 0x4db5a3b1, 0x562c8b59, 0x2471e699, 0x3cd55580,
+    0x8c760d9a, 0xd3a203de, 0x425e7fe1, 0x195a00ff, 0xfc0908e6, 0xad0859eb,
+    0x60a4910e, 0x1964e75d, 0x095958f2, 0x29b469d4, 0xf2125c69, 0x5411a21a,
+    0x8c468587, 0x8be231f3, 0xa1d1251f, 0xa5da3593, 0x9826ceed, 0x96a666b3,
+    0x2801ae84, 0x5fee2b14, 0x4b41dd50, 0x5264c4c2, 0x64f6b982, 0x2a4ca4db,
+    0x701a9285, 0x5dcdf5f6, 0x46918bea, 0x90e5c4e1, 0x20a7168f, 0x825053ca,
+    0xb6359eb0, 0xec0811c1, 0x7cd30620, 0x459157b8, 0xaf7f2a6d, 0x0415915b,
+    0x4c0f402c, 0xf284700c, 0xc1ec9174, 0xb552a804, 0xb8a05100, 0x8d628841,
+    0x9a588a4a, 0xfbe20f33, 0x3ad25421, 0x131949a3, 0x4f515aaa, 0xa9a56bc3,
+    0x6810a51f, 0x223556a1, 0x1ac966f1, 0xca2b8afe, 0x6d0227cc, 0x8189b0e0,
+    0x855c1c15, 0x8e20560d, 0x320eda06, 0x6b6f00dc, 0xee618efc, 0x292a4632,
+    0x02a26566, 0xc876cfd4, 0x3bb73c05, 0x917a0c71, 0xa2ac3219, 0xf9014f73,
+    0x46649d66, 0x5ff510d4, 0xb68ca795, 0x0a52ce10, 0x9255e45a, 0x8fa1b9d8,
+    0xd9215941, 0x0aa2375b, 0x2dbb9a31, 0x54a17fed, 0x5c6e4c9c, 0x83fcb8ae,
+    0x1e399df0, 0x49d04f22, 0x180146a0, 0x21937b9a, 0x382546a4, 0xf0d3e5ac,
+    0xe1a20a1c, 0xb08fc83c, 0xb4444cef, 0x9f020695, 0x45b2f834, 0x3a312e3d,
+    0x961d4f94, 0xc74ea49e, 0x73c67969, 0x84125adc, 0x68550315, 0x54382aa1,
+    0x1ecfa03e, 0x9ea7ad78, 0x0767c6eb, 0x609707a2, 0x22820085, 0x9fbb2f59,
+    0x2fb18023, 0x9335ea0f, 0x32994c26, 0x2693c964, 0x6432994c, 0x4a261788,
+    0x99c0bd33, 0x283a124e, 0x44cc0750, 0x5050aea4, 0x9f7e7cab, 0x8f295fef,
+    0x83d5b6c7, 0xeb601dac, 0xc13a5807, 0x70cf0ed6, 0xaac780c7, 0x63644562,
+    0x03b4441b, 0xfc8e4760, 0x7c609e2f, 0x0ae643d6, 0x8251041a, 0x1748920e,
+    0x984c1374, 0xa57951d8, 0x521e918e, 0x6d41cddb, 0xb1ad0a73, 0xcaaac82a,
+    0xb00ed6c1, 0x1dac8375, 0xcc07eb60, 0x150ad7e8, 0x240c2f31, 0xaae0d9eb,
+    0x061b8b02, 0x1e0f2e66, 0x82773c3f, 0x20009c19, 0x7a190f07, 0x234b8c29,
+    0xa5cfd4bd, 0x66b10339, 0x9263c939, 0x9bb2a0aa, 0xe7caa3e8, 0xd4ba3a09,
+    0x4028c3ee, 0x33ad529e, 0x32dc24e4, 0x6f6fa7e4, 0x75520d18, 0x480224e1,
+    0xcc341835, 0x8acea271, 0x647272b0, 0x211e533e, 0xf1d5039f, 0x0d9ad240,
+    0xaf2650a8, 0x482f6e7b, 0x76d881cc, 0xdc7f223a, 0x48f84420, 0x09022cd6,
+    0xb413b258, 0x7305d62b, 0x8aac1b49, 0xa12592a7, 0x1c578168, 0xbb814b9f,
+    0xbfe44b7a, 0x1e8fa746, 0xdc837805, 0x20c43740, 0x7c851327, 0x75cfd356,
+    0x9dc400ff, 0xc783ecc3, 0xa92c8afa, 0x4e92f229, 0x19a0408f, 0xa42ac463,
+    0x6109b95c, 0x21a4620e, 0x0a2f86a2, 0x021fdc6a, 0x3b453a13, 0x2ffce6d1,
+    0xa852ee11, 0x20dcb716, 0x395a137f, 0x9ebc2a2b, 0x5a5de0f4, 0x64b278b5,
+    0x3f6695da, 0x334e6db9, 0x84790be5, 0xb4e5552a, 0x43803452, 0x0bfcc69a,
+    0x5dcce801, 0x23bfd79e, 0xd766cf25, 0x29e3a565, 0x64b098e1, 0xbbcda0a3,
+    0xacc9cffd, 0x773ea9cd, 0xb94cee10, 0xf484c34d, 0xa89cc9aa, 0xe8bf9308,
+    0xc27c2e43, 0x3b9d66af, 0xde381114, 0x65667ebe, 0x409006dc, 0x8b088011,
+    0x48a32d3e, 0x2ba1292b, 0xd3545f44, 0xbbcae7ee, 0xe6f3057c, 0xc5e240a5,
+    0x030b54ab, 0xd5b84242, 0x0c5c4e0b, 0xcb93dec8, 0x59361e0c, 0xdc22468c,
+    0x05c6715c, 0x044b26c3, 0x28163e19, 0x57ae8a36, 0x2bbec289, 0xf1bae769,
+    0x3cdab19c, 0xcafc90db, 0x1672c085, 0xe607cdc2, 0x54a50312, 0x49fd17cd,
+    0x9d4ea7d3, 0xd3e9743a, 0x3a9d4ea7, 0xa7d3e974, 0x59ab860c, 0x3da0ea03,
+    0x82720ed4, 0xa30949e6, 0x46bd4d49, 0x20faf000, 0x353f2f45, 0x3cf3cb3c,
+    0xcb3cf3cb, 0xf3cb3cf3, 0x3cf3cb3c, 0xcb3cf3cb, 0xc4762bf3, 0x6ec10703,
+    0xfd1dc9ae, 0x8f19dd7c, 0x0502e255, 0x560d895b, 0x9af63bc5, 0x034fe41a,
+    0x3d26913c, 0xc0943901, 0xec1ce926, 0x7d72fa12, 0xb6990005, 0x2ff39374,
+    0xcc2ff3cc, 0xf3cc2ff3, 0x2ff3cc2f, 0xcc2ff3cc, 0x62cc2ff3, 0x67c39a10,
+    0x0b9dcb0c, 0x2c37eba0, 0x2b1cac74, 0x5deac3cb, 0x177c4437, 0x2ab8d5b5,
+    0x4ec65c89, 0x7424d038, 0xe1a6b5d7, 0xe3999324, 0x8e014003, 0x7d6d6a24,
+    0xc54b1921, 0x794b0fc0, 0xbbe0632d, 0xc1abbaa7, 0xc61523af, 0x4d050951,
+    0x5d022374, 0x5303b819, 0xe680fb73, 0xb01fecbd, 0xe8cfcb3b, 0x01953b6e,
+    0x3400864e, 0x76046b34, 0x05269604, 0x63b34a20, 0xadc8cf84, 0xef3967f9,
+    0xcc8df4c8, 0x62b3930f, 0x264f4595, 0xedd75eae, 0xd3a43840, 0xee928b80,
+    0xb77d1dbb, 0xb90681ae, 0x22eb586e, 0x508f57c0, 0x9b836841, 0x4b09b5a1,
+    0x630b8c14, 0x08efa8ce, 0x0bcbd200, 0xfca31697, 0x75cfd356, 0x78e539e3,
+    0xd9aeb48e, 0x55051857, 0x4ff976b8, 0x30b7972b, 0x52930299, 0xe9d4bcae,
+    0xadaee11e, 0xb6c0d89d, 0x582f4ec0, 0x33647493, 0xe4e22e00, 0x11b5ec95,
+    0xa0a0a3b0, 0xf4729b80, 0xe8846a92, 0x0824876d, 0x98985268, 0x6ae79059,
+    0x3abe5096, 0x04cc8db1, 0x9ccc7e8f, 0x1366cb61, 0x65a11d98, 0x6c36a492,
+    0x26d5cb90, 0x2a3a02a1, 0xb420d154, 0x91425a23, 0xd3a245aa, 0x1a7ba53c,
+    0xeb8d2bc1, 0xd790cb6a, 0x4162d009, 0x86d97130, 0xad822ab4, 0x7fdf1000,
+    0x450d01d4, 0xa7508283, 0xf0101047, 0x238c2c52, 0x5f79ae3c, 0x809a980c,
+    0x36c5ca31, 0x0f2f4a5c, 0xce36c3ac, 0x36afd724, 0xbf959621, 0x01778461,
+    0x4d414948, 0xd1d80d68, 0x95099451, 0xb9e5c2f9, 0x3b818970, 0x80898763,
+    0xc9363e7d, 0x1a35b88e, 0xcff1648d, 0xeea5d5f4, 0x10d955c1, 0x914e2035,
+    0x7001fada, 0x6c0ae255, 0x414a7311, 0x09f9aa0e, 0x76c5636a, 0x90160719,
+    0x7810835e, 0xd241a293, 0xb1a3459a, 0x144a3c66, 0x1952611d, 0x1a492020,
+    0x4dc0d7a2, 0x0a505084, 0x4f589f3e, 0x13843853, 0xda6c096d, 0x82056459,
+    0xe29eded9, 0x482e7879, 0x50e98c22, 0x614bcdf6, 0x63b91a36, 0x923b29f8,
+    0x1a454356, 0x3e7ff30a, 0xece8d10a, 0x916c0118, 0x303a7c42, 0x3a44ae95,
+    0x0ea60a18, 0x0322a732, 0xf9ba5493, 0x7d5975a1, 0xebf57a7d, 0xc152afd7,
+    0xc0642655, 0x198bcb61, 0xf57a1d7d, 0x35002018, 0x232c1119, 0x218a45a2,
+    0xaa5c5555, 0xb9ca55b7, 0xbd5e5f5f, 0x9cebf57a, 0xa444b8fc, 0x44d2b45c,
+    0x09e4af04, 0x1588c93f, 0xf1dc5615, 0x6dc53faa, 0xc258f73c, 0x365cc61c,
+    0x8e3a8bda, 0x00ff17f1, 0x42d69052, 0xa5a97689, 0xcc22bd00, 0xd7d14109,
+    0x422cd300, 0x77e4bab0, 0x83091b3c, 0xf89ba5bb, 0xc0f8695d, 0xa6ef0acc,
+    0x990c0042, 0x9a69c313, 0xdc438fe1, 0xa28961c9, 0x63094737, 0xfb332749,
+    0x124f0be5, 0x4d72501c, 0x4c9c5148, 0x3e8e2649, 0x42a04921, 0x2a812e62,
+    0x10d894d8, 0x449dc27b, 0x7bd0d127, 0x5447f78e, 0x3894a5ee, 0xf4a217db,
+    0x20509a12, 0x33b35da0, 0x8f2f30b3, 0x202aea6e, 0x624c710a, 0x75482105,
+    0x9d88e11d, 0x9f5e89ef, 0x52a30bb2, 0x05e456a5, 0x20c10539, 0x7620606a,
+    0x8c1c0516, 0x4a2e480d, 0xc6b2c150, 0xb8fd0264, 0x89f9f4cd, 0x1bbbb2ee,
+    0x05707f48, 0xe68554cb, 0x3c9f7478, 0x6244d567, 0x4abdb21c, 0xe1d772d8,
+    0x9e0da475, 0x962af8c2, 0xf0b86a0e, 0xe3604729, 0x68a0d486, 0xb8dd322a,
+    0x9e5e0342, 0xa45e3bd7, 0xb7c205d3, 0x883ad224, 0x4e13008f, 0x3c711307,
+    0x96106fee, 0x8153709b, 0x9e1991c3, 0xdaac7702, 0x0a7a3b15, 0xafea128d,
+    0x1a51a5c9, 0xcb0239d4, 0x439247fe, 0x5fdca12e, 0x98704eee, 0xadf887b1,
+    0xc5eb9ea7, 0x565ff538, 0x3f7a31ed, 0x0190e868, 0x200d1008, 0xe40807b6,
+    0xdb6b9675, 0x657e8047, 0x0f1076c7, 0x8430d4c7, 0x195a8d88, 0x32499625,
+    0x1c5d0135, 0x0c834e02, 0xfc8210b1, 0xd4008089, 0xe03605f4, 0xc91c8db6,
+    0x668f02f7, 0x2cb79669, 0xf93667ec, 0x13fcae55, 0xa831209a, 0x34b78dbe,
+    0xb5248e56, 0xb14e9c31, 0x95cd6c55, 0xc1a19ef2, 0x4dad923b, 0x06172558,
+    0xb632fd73, 0x78cf679f, 0x20ae7dc0, 0xf4c61f42, 0x9e5f41bf, 0x249eaa14,
+    0xa64ab144, 0x7d00ff06, 0x52615c64, 0x40080c05, 0x0e0003c3, 0xe878fa1b,
+    0xf8b9f1b9, 0x978a06d7, 0x27e27eb2, 0xfe01999f, 0x8018d917, 0x9cd714c6,
+    0x1d863ac0, 0xe5175cbf, 0x2435b88d, 0x4cca32ea, 0x5140c58d, 0xa5c49424,
+    0xd08b1bbf, 0x012449a0, 0xc9300210, 0xa1013648, 0x4602690b, 0x538822d1,
+    0x5370e655, 0xd1716178, 0xebb40600, 0x335a9f03, 0x0f131aef, 0xda723584,
+    0xab2ffee9, 0xe0abb493, 0xa83a68e3, 0x82380f65, 0x88797a43, 0x0a4700ff,
+    0x84a56161, 0xec2cee51, 0x4d95c408, 0x03e50265, 0xd77cfa8f, 0x9ea7ad78,
+    0x3e4ee8eb, 0x11b13d45, 0xcd04eb10, 0x3ad197ca, 0x32f0eb74, 0x88bc6be8,
+    0x327b7aa7, 0x228daab4, 0xaf3a67ca, 0xa1e6f648, 0xa9202ab9, 0x7e4ac872,
+    0xe7628bcc, 0x6a9c8fd6, 0xca30364c, 0x6a03152c, 0x28074217, 0xbe9521eb,
+    0x7da31888, 0x6085022b, 0x92e29439, 0x20b63041, 0x776ed66a, 0x85f3623d,
+    0x16204c40, 0x95d9414e, 0xc7ed2283, 0xadb2ea34, 0x21a33d90, 0x6944e8c1,
+    0xb1e0b186, 0x49c6c9bf, 0xa872df21, 0x389a390e, 0x643b9dce, 0xee28481e,
+    0x99e48425, 0x4fa94f39, 0x4e21b97b, 0xfbe01f06, 0x5eee1520, 0x78e3bcac,
+    0x858ae0c5, 0x1ad00060, 0x7310e7da, 0xf7af2122, 0x6e4f3d19, 0x1a27ea1c,
+    0xeeca80bd, 0x804c3a78, 0x5f28f696, 0x6a6d5b36, 0xf5ca43ac, 0xa3a85130,
+    0x0611e8ee, 0xaee4e7c0, 0x371234d6, 0x8ae26c95, 0x64986b59, 0x2194122f,
+    0x1a40b25a, 0x6f2efc89, 0x2c154e99, 0xad736d1c, 0x304876a2, 0x8b2c0df7,
+    0x492bc141, 0x37e3099c, 0xc143f393, 0x85f3bfae, 0x3b823658, 0xaf746941,
+    0x4891e065, 0x2883785e, 0x40206520, 0xb4a8cdac, 0x0627d0d5, 0xd8fe1bad,
+    0xcf37037c, 0xf1aef9e8, 0xd63d4f5b, 0x0eae933a, 0x3dbbf008, 0x8d624b02,
+    0xd124f259, 0x392c824b, 0x43da1b48, 0x0cbfe200, 0x07ca70e6, 0x5a01103a,
+    0xc4a3e137, 0x01e67016, 0xa3945a95, 0xb6237144, 0x9f49e4a6, 0x7137e33c,
+    0xebfab7a0, 0x096771ac, 0x18b5925f, 0x26085dfb, 0x9a07897c, 0xd60428a6,
+    0x82bc5d8f, 0x5422af35, 0xf2b8bc0b, 0x260cc21b, 0xf8fe57a6, 0xa131b02c,
+    0xd323b183, 0x47c3203e, 0x82fa40c9, 0xf5b70507, 0x7676a1eb, 0xa77ad14e,
+    0x7030104d, 0xf420e86f, 0x229148a4, 0xa38d6f4c, 0xb41b6a2b, 0x0c55826d,
+    0x2b280aa0, 0xa1d48f44, 0xd3277a68, 0x15802692, 0x9a0c1bad, 0x16fa0460,
+    0x5c6dc18a, 0x28c43997, 0x4ec91002, 0x850455e8, 0xee7a38d2, 0x82192982,
+    0x4f39176d, 0xc8f1d1b0, 0x05452518, 0x8820b18a, 0xaa18a1c2, 0x48ea71ca,
+    0x89442291, 0x792ee815, 0x85cb3267, 0xe707b854, 0xcc943325, 0x81004f43,
+    0xad4548b5, 0xbaabf35a, 0xda293724, 0x12fe4ce3, 0x9c88cb5c, 0x622155eb,
+    0xa2d11190, 0x07c4b9ee, 0x9a483016, 0x298cc8e5, 0xbba68834, 0x962622a7,
+    0x337ed152, 0xcecec498, 0xb9b6dde8, 0xd540d8fc, 0xd3563ccb, 0x2de375cf,
+    0xf0d2b7e2, 0x18a198b7, 0x2fa6e8cb, 0x168ba5f8, 0x62b1582c, 0x877c8cc5,
+    0x1aacd221, 0x58e05433, 0x20ed1ab1, 0x0a033563, 0xb647d628, 0x4ad1a263,
+    0x00ae5a08, 0xb158d6db, 0x728bc562, 0xe8171b90, 0x9da1fa75, 0x996003a4,
+    0xe6ba2ca1, 0x1bee34bd, 0xb78cc0a0, 0xff163257, 0xa48c3400, 0x68301cfc,
+    0x0fd14366, 0x8d983401, 0xb66818d0, 0x6cb8d7e5, 0x0e981662, 0x90ec41a8,
+    0x39552b41, 0x9bd70234, 0x578ce855, 0x3a105395, 0x01747743, 0x479a9568,
+    0xa80c8fda, 0x1ee4b60f, 0x0d7e942a, 0x5055f008, 0xcc37b2a3, 0xadfc5a17,
+    0x224d0322, 0x0a4704f5, 0x9c702049, 0x4f59c723, 0x16881523, 0x0b915e9f,
+    0xc398d80e, 0xc5781bd1, 0xbf6705c7, 0x05753d5e, 0x4dd4655c, 0x14742866,
+    0x306c0b0c, 0xc1c1c622, 0x2f1aa857, 0x1653c109, 0x5e592f7c, 0x84bace18,
+    0xa8d0c70b, 0x3c5dedeb, 0x3c437fa4, 0x7f1a6692, 0xb4384a53, 0xa681b9c0,
+    0xb88c728a, 0xf9f09f07, 0xd528536c, 0xf015f404, 0x1180d75a, 0xf874ab7d,
+    0x023b80f1, 0x2fa832d4, 0x4a94eada, 0xe1512d71, 0xaa9f00bc, 0xf1fb00b5,
+    0x42854146, 0x759eed65, 0xa0b47ec1, 0xfc9568d6, 0xf5722e0e, 0x041aee63,
+    0xc98de9cd, 0x368e86dd, 0xea482d8b, 0xbb5af5a5, 0x49851b61, 0x47257a5b,
+    0x72f4a287, 0x0d1c2529, 0xd6a5f847, 0x0a803316, 0x14475f8d, 0x692b1ebc,
+    0x91c4bae7, 0xefbcf0b6, 0xb0fdd985, 0xe10ea47d, 0x4251a249, 0x2dd5e451,
+    0x62647475, 0xce11bc73, 0xc08b3fa1, 0xe5351a66, 0x36d3f3aa, 0x5ab5721e,
+    0x0ca73832, 0x12b6908e, 0xb8bd2585, 0x63a4b121, 0xfaaee30c, 0x8097c4ec,
+    0xd09e6065, 0x5ac64414, 0x06b33e31, 0xeaf7cae7, 0xe73f3f65, 0xc39510f5,
+    0xcd40523e, 0x10969ce1, 0xa2459ec6, 0xd2e04b1a, 0xc146b514, 0xa4e07c2d,
+    0x9bd0a840, 0x0a3da4fe, 0xd3cb6256, 0x74ab82ca, 0x4ab7557d, 0xf87b0567,
+    0x777bad12, 0xa628486f, 0x5cf755aa, 0x2a9155f0, 0x256c4394, 0xea251607,
+    0x82774a3a, 0x376f8054, 0xd5053892, 0xd7590cda, 0x706fb046, 0xd5b07375,
+    0x57e22207, 0x4facdca7, 0x42128c5f, 0x9ced1918, 0xaad8fb80, 0xc607d384,
+    0xbcbd490b, 0x7677abb1, 0x3416c0c0, 0xfa6baa68, 0x7b9fa8cb, 0xa18043d0,
+    0xa2454014, 0x4270f09b, 0x3ab55bd9, 0x82319e73, 0x7d240690, 0x59000268,
+    0x02404299, 0x27833907, 0xda804ea6, 0x023cd23c, 0x7441ceee, 0x21a901e5,
+    0xbbd204ae, 0xa255be21, 0x9d41f4df, 0x724ec539, 0x4ad97359, 0xccc61242,
+    0x20bc15aa, 0x10060e46, 0x154f73a7, 0x7dddf3b4, 0xf09de906, 0x83353dbb,
+    0xe9d7a8aa, 0xc860a42c, 0xd12a7e44, 0x6e3bc3e5, 0x67b0d195, 0xdeaaf773,
+    0x4680ec28, 0xd02c59cd, 0x86a1c061, 0xc92a24bf, 0x13d531ce, 0xd1da8a68,
+    0x4474bb47, 0x0ad11241, 0x76a69b7d, 0xb517505a, 0x8ca587e8, 0xa7343a71,
+    0xecc2bcd9, 0x014e3c6f, 0xb408501b, 0x98e5aa8a, 0x6b951408, 0x2218d648,
+    0x8aa02682, 0x13f5b366, 0x5483f5dc, 0x103082ce, 0xb7ee826d, 0x421f9dd0,
+    0x50d9c8d0, 0x37311784, 0x7492c828, 0xa9e9db48, 0x4671644a, 0xec5e0135,
+    0xf103ebe3, 0x48b53764, 0x2bb0f51c, 0xa0c7069b, 0xcacbf0c2, 0x503cf9ce,
+    0x7ddd3306, 0x6a1ea005, 0x5dd785c8, 0x20391dad, 0xb0eb17ad, 0x7238c1c4,
+    0x1b60cf8a, 0x97357d8a, 0xeafc21c0, 0x0b44be94, 0x4db203a0, 0xa426914c,
+    0x5bbfb7b4, 0x8259fc72, 0xe3568bd1, 0xfbfbac69, 0x4085d30f, 0x53337aaf,
+    0xabf5aa65, 0xba72fbd3, 0x9ea7ad78, 0xb29cc5eb, 0x5ada6849, 0x392b9ca6,
+    0xe6d865e1, 0xc70c16ac, 0x2d2875a6, 0x552bd2d7, 0xd67122b1, 0xffa61111,
+    0xc69dde00, 0xa3495553, 0x8d4f5b28, 0xf4a33196, 0xbb2dda3a, 0x001800ff,
+    0x0283a6bf, 0x25c1c21e, 0x7692504d, 0xeb02d043, 0x58746755, 0x0d0b2fda,
+    0x754fc054, 0xdf1bc8cc, 0x510c0f70, 0x53e1abd4, 0xaa6feb96, 0x9d9400ff,
+    0x98a8f673, 0xd408780c, 0x4ae80d2d, 0x4fde9dd0, 0x44196372, 0x1ef0b3a4,
+    0x549c5e29, 0xaa17380b, 0x04f07a8e, 0x840af0a9, 0x89301144, 0xc4481e91,
+    0xf22653c7, 0x288c5e08, 0x32886761, 0x9ea9086d, 0x8d4a2802, 0x82ce3f94,
+    0x94a9ea80, 0xc3100ea5, 0xc0059f9a, 0xa6ca9c2a, 0x8da7d12f, 0x3d1e2686,
+    0x887a8e89, 0x38317013, 0xa5770ae6, 0x51388451, 0x8bd4b0f9, 0x76a8665a,
+    0xb58975c8, 0xc4102293, 0x6acc8a6d, 0x21c23897, 0x46b59a68, 0xf0ba44d1,
+    0x0619d254, 0x268aab8b, 0xc1c818aa, 0x1e3914a2, 0x4a56cdf9, 0xb95c01f5,
+    0x9b499563, 0xdb07991b, 0x89e2f635, 0xa4aa1125, 0x5600c851, 0xe2726867,
+    0x86a21770, 0x98f62f38, 0x4f5bf154, 0x3583d73d, 0xffa873dd, 0x38fdc400,
+    0x3b2c9752, 0x5253c567, 0x10d8cf11, 0x00605b06, 0x7f5e59d4, 0xbdd96ca4,
+    0xdfeff7fb, 0xfbfd7ebf, 0x6c36eff7, 0xb57196e3, 0x0d425996, 0x2d73cb02,
+    0x014d122d, 0x43dc7542, 0x3b8af78e, 0xd5605408, 0xc6c1fa82, 0xcf16dca9,
+    0x423d0dd9, 0x61a454b2, 0x9bc893b0, 0xae466f27, 0x14077531, 0x79da34ba,
+    0xf7064f35, 0x350170ba, 0x83638437, 0xc9e426f9, 0x99dc6e93, 0xa7db6d32,
+    0x5544589d, 0xe32d4488, 0x9ade6e8d, 0xc77468b0, 0x05de3690, 0x814898bc,
+    0x1e817260, 0x7fe694da, 0x98fa49e0, 0x555554a0, 0x4ecafe5b, 0xadc14073,
+    0x282ce45d, 0xa95c56d5, 0xfc82b6e2, 0x6ee461ed, 0x244e0d91, 0x539e6af2,
+    0x6e4bdd48, 0x6092f205, 0x6aab83b8, 0xc9954e53, 0x9209c1a3, 0x5a2d3255,
+    0xb346ae8e, 0xa5f4c746, 0x542a954a, 0x4aa552a9, 0xa9542a95, 0xa60ca552,
+    0xc8261461, 0xcb1988d1, 0x500b2d28, 0xbe5cb9da, 0x634e5a9b, 0x95b059c5,
+    0x329a6249, 0x22fa038d, 0xa552a954, 0x542a954a, 0x4aa552a9, 0xb3442b95,
+    0x78e032ce, 0x6b853155, 0x2333ed5f, 0x61e9f5e8, 0x81aea5d3, 0x155a0871,
+    0xaeb15200, 0x143473bf, 0xf50ad443, 0xb11034b1, 0x9eb40b56, 0x72d2692b,
+    0x51b53c47, 0x46d982e4, 0xf1d9a652, 0x7cdcf8b8, 0x1f2d3e5a, 0x478b8f16,
+    0xd1e2a3c5, 0xb4f868f1, 0x2d3e5a7c, 0x8b8f161f, 0xe2a3c547, 0xf868f1d1,
+    0x3e5a7cb4, 0x8f161f2d, 0xa3c5478b, 0x68f1d1e2, 0x5a7cb4f8, 0x161f2d3e,
+    0xc5478b8f, 0xf1d1e2a3, 0x7cb4f868, 0x1f2d3e5a, 0x478b8f16, 0xd1e2a3c5,
+    0xb4f868f1, 0x2d3e5a7c, 0x8b8f161f, 0xe2a3c547, 0xf868f1d1, 0x3e5a7cb4,
+    0x8f161f2d, 0xa3c5478b, 0x68f1d1e2, 0x5a7cb4f8, 0x161f2d3e, 0xc5478b8f,
+    0xf1d1e2a3, 0x7cb4f868, 0x1f2d3e5a, 0x478b8f16, 0x71e3a3c5, 0x3164b8f1,
+    0x8287fbd8, 0x67ae87e6, 0xa5c34141, 0x3aa3333a, 0x333aa333, 0xa3333aa3,
+    0x3aa3333a, 0x333aa333, 0xa3333aa3, 0x3aa3333a, 0x333aa333, 0xa3333aa3,
+    0x3aa3333a, 0x333aa333, 0xa3333aa3, 0x3aa3333a, 0x333aa333, 0xa3333aa3,
+    0x3aa3333a, 0x333aa333, 0xa3333aa3, 0x3aa3333a, 0x333aa333, 0xa3333aa3,
+    0x3aa3333a, 0x333aa333, 0xa3333aa3, 0x3aa3333a, 0x333aa333, 0xa3333aa3,
+    0x5cae323a, 0x00daff3f, 0x0001030c, 0x00030002, 0x92100000, 0x49922449,
+    0x24499224, 0x92244992, 0x49922449, 0x24499224, 0x92244992, 0x01922449,
+    0x24499204, 0x92244982, 0x49920049, 0x24499224, 0x92244992, 0x49922449,
+    0x24499224, 0x90240110, 0x40902000, 0x04481000, 0x00000012, 0x49920400,
+    0x20499224, 0x92044892, 0x09802041, 0x24400000, 0x80200010, 0x00800409,
+    0x00080000, 0x92244890, 0x09020001, 0x00400204, 0x82244092, 0x48002408,
+    0x00018200, 0x10000000, 0x40902001, 0x00010000, 0x80204112, 0x49928c01,
+    0x24499224, 0x0000003a, 0x00000000, 0x00000000, 0x00200000, 0x01120000,
+    0x93c71300, 0x000000e0, 0xff1c0500, 0xff00ff00, 0xff00ff00, 0xff00ff00,
+    0xff8bdb00, 0xff00ff00, 0xff00ff00, 0xff00ff00, 0x0012c600, 0x4055ca08,
+    0x00000000, 0x2449020f, 0x927ef5aa, 0x4cc22e49, 0x1d596092, 0x24213d2d,
+    0x747d1000, 0x00000080, 0x24391e00, 0x9b974a92, 0xa98f24c9, 0xbb441520,
+    0x966c01e3, 0xa1232048, 0x60b7e600, 0xb43c0000, 0x3ddf0000, 0x180000a8,
+    0xfd9238c0, 0xd05abaf4, 0x4001906c, 0xf1ae4e72, 0x39000010, 0x04499204,
+    0x92244112, 0x49802400, 0x04080000, 0x10200092, 0x11fb5282, 0x00000020,
+    0x12000022, 0x00102408, 0x24000000, 0x12240990, 0x40120040, 0x3a0e1221,
+    0x000088f8, 0x00800400, 0x04401020, 0x02030100, 0x41102000, 0x24099220,
+    0xf0054a80, 0x8024106f, 0x00090200, 0x82204802, 0x06000048, 0x2441001b,
+    0x90240082, 0x27940001, 0xc175f0b9, 0x10000000, 0x41822049, 0x20490200,
+    0x1200401e, 0x01800440, 0x28089220, 0x02004804, 0x0d900000, 0x04010020,
+    0x00200112, 0x00000000, 0x00000000, 0x10040100, 0x40020000, 0x00008200,
+    0x00004002, 0x00802009, 0x00001000, 0x00000000, 0x08020000, 0x00010004,
+    0x02040900, 0x49920000, 0x24089224, 0x00004992, 0x00000000, 0x04000000,
+    0x02204090, 0x49920041, 0x00491224, 0x92240000, 0x00000000, 0x00000000,
+    0x00000000, 0x00822001, 0x00401024, 0x90244810, 0x49120000, 0x00001004,
+    0x00000000, 0x00000000, 0x24410200, 0x92244980, 0x00000449, 0x04008000,
+    0x00204812, 0x00000000, 0x00000000, 0x82040000, 0x00000000, 0x00000000,
+    0x92244900, 0x01100041, 0x24059224, 0x92244992, 0x49802449, 0x00000004,
+    0x00000000, 0x6d9d0000, 0xb66ddbb6, 0x5cb46ddb, 0x220e7e92, 0x48c25d59,
+    0x00000002, 0x00000000, 0x3f010000, 0x3cd20259, 0xace4f20e, 0xb49dbca5,
+    0x567f2f7a, 0x491204da, 0x24499224, 0x90244992, 0xa3d4596d, 0x873a1afe,
+    0xe227196c, 0x0ac619e8, 0x2448d024, 0x92244992, 0x49922449, 0xfe14d324,
+    0x69f9b479, 0xf6ef84ee, 0xdbf76fdf, 0x44f600ff, 0x00004090, 0x00000000,
+    0x20010000, 0x80000800, 0x40000048, 0x20080000, 0x82004882, 0x00002009,
+    0x00000000, 0x02000000, 0x09120040, 0x04009004, 0x92244902, 0x49922449,
+    0x00410224, 0x00000000, 0x00000000, 0xff00ff04, 0xff00ff00, 0xff00ff00,
+    0xff00ff00, 0x00004000, 0x00008000, 0x82000800, 0x49922449, 0x24499224,
+    0xff7f4292, 0xfff9f500, 0xff00ff00, 0x0008fe00, 0x00040000, 0x09000000,
+    0x00000004, 0x00000000, 0x92100000, 0xd3212c49, 0x30489224, 0x00020400,
+    0x00008004, 0x92240112, 0x49922449, 0x2c499224, 0xa11a4992, 0x42922485,
+    0x24080000, 0x00004880, 0x00000440, 0x00000000, 0x00000000, 0xd2a46d7f,
+    0x6d9b266d, 0x800440ac, 0x00100000, 0x20088200, 0x00000000, 0x00000000,
+    0x24000000, 0x90004900, 0x00000000, 0x24090024, 0x90200190, 0x00000000,
+    0x00000000, 0x00000000, 0x08802448, 0x00410200, 0x92044902, 0x01002000,
+    0x24091020, 0x92244992, 0x00802449, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00004002, 0x00000000, 0x00000000, 0x922449f2, 0x49922449,
+    0x000000e5, 0x00000000, 0x4280a001, 0xff00ff3f, 0xff00ff00, 0xff00ff00,
+    0x8700ff00, 0xa547a442, 0x746298e2, 0x922449b8, 0x4912601c, 0x9504c125,
+    0x86ca8c2c, 0x15af9e6e, 0x7f159c14, 0x138cfe70, 0x6ddbfeca, 0xb6ada919,
+    0x091269db, 0xf9789434, 0x7aecc640, 0xb66d1144, 0xdbf87fdb, 0x6d23b46d,
+    0xe46ddbb6, 0x24ba6ddb, 0x06a50300, 0x426458ca, 0x0040d062, 0x80244900,
+    0x00000000, 0x04491200, 0x92004100, 0x49820448, 0x20081024, 0x90204992,
+    0x41100000, 0x00000000, 0x82000100, 0x01000401, 0x00011024, 0x02004100,
+    0x41000040, 0x20010000, 0x00004082, 0x08000040, 0x00489224, 0x82204902,
+    0x08822449, 0x24490204, 0x12000002, 0x00902009, 0x00000000, 0x00244082,
+    0x41820400, 0x24411204, 0x02004910, 0x49920400, 0x04098220, 0x90004992,
+    0x41922048, 0x04419220, 0x92200080, 0x49100448, 0x00088220, 0x02200100,
+    0x00000000, 0x24008204, 0x00240002, 0x00100041, 0x00000000, 0x10000000,
+    0x01922449, 0x24499204, 0x92244112, 0x09002401, 0x00090220, 0x00000000,
+    0x00000000, 0x04000020, 0x00004810, 0x00102000, 0x20498204, 0x02240890,
+    0x2449925e, 0x92244992, 0x00004834, 0x00802049, 0x20400000, 0x80000182,
+    0x48822008, 0x80f25504, 0x07b39792, 0x806000ff, 0x01020449, 0x00481004,
+    0x92244992, 0x48922449, 0x08089024, 0xb61abcf8, 0xf1fc4ba5, 0x20009200,
+    0x80244982, 0x00000000, 0x00000000, 0x82200100, 0xa09acd2e, 0x939b0d12,
+    0x12000022, 0x00002401, 0x20080000, 0x00000000, 0x41000000, 0xfbbfed04,
+    0xedfbb7ef, 0x000084be, 0x04089024, 0x10000000, 0x00000441, 0x00000000,
+    0x10004982, 0x49802441, 0x24080000, 0x12204992, 0x00902409, 0x00009220,
+    0x00000000, 0x00920441, 0x00000000, 0x10000080, 0x49000400, 0x00480200,
+    0x10004002, 0x01122009, 0x04089200, 0x00000000, 0x08000000, 0x24090020,
+    0x90004100, 0x48800000, 0x20499000, 0x00044110, 0x40100008, 0x00081224,
+    0x82000810, 0x40102000, 0x00000000, 0x00000000, 0x48000000, 0x00019024,
+    0x10244112, 0x01000000, 0x24411200, 0x00000002, 0x00000000, 0x00000000,
+    0x92204010, 0x00002408, 0x20009224, 0x80044012, 0x40922409, 0x00000000,
+    0x00000000, 0x00102400, 0x00000000, 0x00200000, 0x00000001, 0x20000000,
+    0x00000000, 0x00000000, 0x00011200, 0x92244992, 0x49922449, 0x24499224,
+    0x92244992, 0x49922449, 0x24499224, 0x10044892, 0x49922449, 0x24499224,
+    0x92244992, 0x49922449, 0x24499224, 0x92244992, 0x41922449, 0x00c4ff3f,
+    0x0101112e, 0x02010200, 0x00070404, 0x00010103, 0x11010000, 0x41312100,
+    0x91716151, 0xd14010a1, 0x503020f1, 0xf0e1b181, 0x60c19080, 0x00daff70,
+    0x01030108, 0xff103f01, 0x80ba9000, 0x144c53ba, 0x1d65f1f5, 0x20d8691c,
+    0x1a6c8074, 0xcef78122, 0xdfcff97e, 0x3fe7fb39, 0x9cefe77c, 0xbe9ff3fd,
+    0x7ecef773, 0x39dfcff9, 0x7c3fe7fb, 0xfd9cefe7, 0x73be9ff3, 0x1452cef7,
+    0x59031474, 0x05afa0d0, 0xc31bba43, 0x5f6ad7c2, 0x37d12a2b, 0x5d3dc2fa,
+    0x4c12cee4, 0x18b13cd4, 0x000429b2, 0x583194ab, 0x020a4d7a, 0x57a10aba,
+    0xe80e1146, 0xa8825748, 0xc2983e6e, 0x0a18152e, 0x42850515, 0x3c4c4cf7,
+    0x20470290, 0x8e512716, 0xaa90c540, 0xa80302d9, 0x82d92100, 0xe71f4143,
+    0x50672f1c, 0x1ae2c279, 0x3a0707ad, 0x7a021f12, 0x6509a16d, 0x63cf2917,
+    0x29954687, 0xdb50e904, 0x14e517d8, 0x42a15028, 0x28140a85, 0x8542a150,
+    0x5028140a, 0x88bbb050, 0xbd48b0ce, 0x01261eaa, 0xe674c8e0, 0xc02f4846,
+    0x4067eba7, 0x23534c22, 0x140a557e, 0x42a15028, 0x28140a85, 0x8542a150,
+    0x5028140a, 0xf7dddd74, 0xbd81c88e, 0x619d5a98, 0x58259b50, 0x9844f2b3,
+    0xe2c26195, 0x81f9d0cb, 0xc7480b8e, 0x381ae9ca, 0xe65f0c63, 0xd3736bb6,
+    0x833cf472, 0xa5d9e734, 0x16ae6204, 0xb7f99c67, 0x6a17ef59, 0x18f30e1a,
+    0xa716b018, 0xc7c53fe4, 0xe070c37a, 0x41728868, 0x4c1e4c9e, 0x4c1e4c1e,
+    0x4c1e4c1e, 0xa30a4c1e, 0xf17b0d7a, 0x572c11e3, 0x265a8f70, 0x6685de07,
+    0xd5dd9556, 0xc69d0e97, 0xcc5354b3, 0x476631ae, 0xec32eb61, 0xc152bc08,
+    0xaa5197cf, 0xcdcc85d0, 0x95634c04, 0x14d36bae, 0x11631eb7, 0x2ea12f1b,
+    0x42279414, 0x1e4c3ea2, 0x1e4c1e4c, 0x1e4c1e4c, 0x12e60e4c, 0x08580a10,
+    0x513c6c08, 0x9c3ff3c8, 0x5ac52567, 0x755d45aa, 0x3c983c57, 0x1da90898,
+    0x42b0b503, 0xa90b9612, 0x2023bdc2, 0x123657f7, 0xaa0664c1, 0x04f74c7a,
+    0x51a07751, 0x7c59a9d9, 0xc30fc792, 0x64c56d8a, 0x6d1f07c8, 0x7423b962,
+    0x756c081b, 0xd15b67df, 0xa2cd3b74, 0xa4616f77, 0xe654eb50, 0xa111c082,
+    0xe127e6e0, 0x1600ffc7, 0x4a3ae0b4, 0x0b3e1b22, 0x02186ffc, 0x31191d26,
+    0x6c1b460d, 0xc7d5c158, 0x593d0081, 0x4a7d7e5c, 0x66253700, 0x1550253f,
+    0xd24aa857, 0x1bc8b9ee, 0x8f2926a0, 0x82935e45, 0xcf471ab7, 0x2b3e326f,
+    0x03017860, 0x1e4c1e42, 0x7be4084c, 0x2c88090d, 0xe44f48e0, 0xb6602dc9,
+    0xb6941e13, 0xdf0a32bf, 0x1e438676, 0x4411893d, 0x66bc39e2, 0x3d1c1ee8,
+    0xb6eb4351, 0x6248a4ca, 0x7e5e6da7, 0x8170d618, 0x03380016, 0xc8c79fc8,
+    0x96d200ff, 0x1a1b2f91, 0xfe9c9e7a, 0x22222242, 0x058c591e, 0x2a2484b6,
+    0x0f91a358, 0x14cef33a, 0xaa61c275, 0x0fb81ead, 0x75866106, 0xf9d28160,
+    0x411f2cd7, 0xcfee22c9, 0xc3c2e831, 0x0599baec, 0x2297c126, 0x0f331600,
+    0x639a0024, 0xc045a907, 0x5bf294e6, 0x7f1345a4, 0xc68fa317, 0xc0898888,
+    0xf6e22c9a, 0x39eb7f47, 0x9ff3671e, 0xdd5de453, 0x4a14bffb, 0xa644ce7e,
+    0x6d043a8a, 0x4f33e242, 0xa24dc9d3, 0x2a79d5ca, 0x1f60a43f, 0x925831bd,
+    0x6725d439, 0x469286db, 0x89bdc005, 0x408c1566, 0xbb110703, 0x66af16cf,
+    0x311488b8, 0x24c460bf, 0x10804d04, 0x68fe6113, 0x0999ab2b, 0x44d87aa8,
+    0x2489cf2d, 0x40d2780c, 0x73c9d0e9, 0xcd9399f1, 0xac70d368, 0xb5f9115e,
+    0xe6688260, 0x6ecae079, 0x31fa49c9, 0xc5c5c98b, 0x47a603de, 0x98258a04,
+    0x17c1491c, 0xb37c8a8b, 0x287a8f48, 0x2d53d939, 0xcee48071, 0xdd7d78c2,
+    0x2b51fcbb, 0xd1121ff8, 0x3c00ffd8, 0x994a263f, 0x2bcc61b3, 0xb52b5085,
+    0x9dbbf086, 0x6a15850c, 0xc42e4d04, 0x260ef8e4, 0x022840a0, 0x6a0340a5,
+    0x55e25780, 0x412d2f3a, 0xa2040649, 0x0ed0395a, 0xb59bcedf, 0xa5a507ad,
+    0xdb9cb4a4, 0xdae6dea9, 0xd8e4b033, 0x74b4a485, 0x1437c1e2, 0x7d4a92c3,
+    0x8b983a60, 0x0a05ce85, 0x82480450, 0x9a13b329, 0x0481bbd4, 0xaffc05f0,
+    0xd31898ea, 0x00cc10a1, 0x78855360, 0xe11c2022, 0x8f1fed84, 0x783c1e8f,
+    0xd0d65af1, 0xeb8183a7, 0x03182f9d, 0x35145041, 0x74d20b0e, 0x00013038,
+    0x613e02b9, 0xb33d072f, 0xdf14ed68, 0xc0c31dd8, 0xcf8977d6, 0xce6bbc76,
+    0x4eb4f3fc, 0x5ee3b53b, 0xbc91e777, 0x29465bfe, 0x00ffd29d, 0xf1781c90,
+    0x118fc7e3, 0xb8911f9d, 0xdf36b1a1, 0x193aa9c2, 0x529174da, 0x1e3f3e57,
+    0xbb143a3b, 0xf0bc6be7, 0x1a91f3cb, 0x5e06ed08, 0xabaf39fa, 0xa66baf69,
+    0x71f3eeb6, 0xbcd24c9b, 0x3657977b, 0xce772974, 0x83e179d7, 0x2f8bb941,
+    0x0609e478, 0xc70e8710, 0x05c6e149, 0xa72ce602, 0x7a59670c, 0x6c8d0eb7,
+    0x39bef39a, 0x71d246de, 0xf0baf25c, 0x8102db71, 0x86531673, 0x00ffac33,
+    0xed8fde6e, 0xad090d32, 0x7a6bae6d, 0x1dcd79f5, 0xdb36cd52, 0xbe77b735,
+    0xc036dc32, 0x81cdbdd0, 0xa7fe0a33, 0x9be24913, 0xc4053f29, 0xbd89d2d4,
+    0x6a578144, 0x887700e1, 0x4cb82aac, 0xf9971eac, 0x70145532, 0xacae5002,
+    0x0750797d, 0x82b0bcae, 0xb661c5f1, 0x0e8a3c1f, 0xa60d0c82, 0x354b3182,
+    0x79a9cd20, 0xcb2f846d, 0x7919e523, 0x4ae03b9a, 0x3b1f406c, 0x3068908a,
+    0xad883bc5, 0xea9fc2c9, 0x24d9fda5, 0x4c38d287, 0x9f4760d9, 0x0381c00c,
+    0x21430be3, 0xf2e040f2, 0xed70b53c, 0x5c431328, 0x6d80604b, 0xea3cdf60,
+    0x523395b5, 0x446bc346, 0x3ff07fb0, 0x2c50cce4, 0x5d8932bb, 0x5e47b990,
+    0xfd7640db, 0x870efe18, 0x7cd11e1a, 0x3e30e641, 0xb2b8ba35, 0xc0c5ea01,
+    0x447c06b0, 0xd7bb6629, 0x120a5532, 0x3aa70524, 0x258a2a1b, 0x5f991a2b,
+    0xc70e19ae, 0xd2fc92a1, 0x34646c5a, 0xe1b0d122, 0xd01d991c, 0x19b98bf5,
+    0x3ab5dfe0, 0xb86f5db6, 0x9c0c2bbb, 0x889a114b, 0x61a6620a, 0x023a3a95,
+    0x6f44018a, 0xae8501f2, 0x77c2103d, 0xdfce7c29, 0xbfd0c9ac, 0xdea54a4a,
+    0x83f61ce0, 0x229f8662, 0xa699a78a, 0x58537041, 0x50450a60, 0x0b0416d2,
+    0xaab46297, 0x1d9d62a5, 0x62e7024d, 0x104471bf, 0x385b060a, 0x12fa1a22,
+    0x6c089a68, 0x1ec84f69, 0x0240a01c, 0xb30a80aa, 0xa073b536, 0x5009ab94,
+    0x086072a2, 0xe73244a4, 0x0970942d, 0x97822f36, 0x279837a1, 0x28f41719,
+    0xfa1cd68c, 0x2c00c32d, 0x60a39df8, 0x381d7f50, 0xb34e333b, 0x042489f3,
+    0xb2022515, 0xd5c1f222, 0x195de7e2, 0x053d568b, 0x4309387e, 0xb6958f09,
+    0xea00ff6f, 0x43e2ac8f, 0x9d83fc80, 0x9aee17ee, 0x6f1cb79b, 0x6ed81d3e,
+    0x8790d593, 0xc4de140d, 0x7c8ef443, 0xb856e812, 0x0e31bb43, 0x1827f0fa,
+    0x08850348, 0x38048434, 0x2e8bd231, 0x093694a9, 0xea2185af, 0x85bfdbba,
+    0x83542504, 0xa11f6d3f, 0x1fef84cf, 0xc3f7e4cc, 0x30874220, 0x7b00ffc4,
+    0xe3eb73fc, 0x6be15c93, 0xa137cfcc, 0x07c54b32, 0x62ea241c, 0xfee1d7ed,
+    0x00ffddd5, 0xc9f9f697, 0xe9fa362b, 0xf100ff12, 0x6c1f1632, 0x855e8793,
+    0x1cf8d4bd, 0x953508f9, 0x15237ce6, 0xceb192cc, 0xc8327ee0, 0x30bfa3ca,
+    0xb4e4eeb1, 0x19bf6e0e, 0x7a59a05a, 0x9cca747b, 0xd956e34f, 0x6ed55823,
+    0x3f420eee, 0xd26d0c29, 0xbf6c454f, 0x4a2334ec, 0xe04bc20a, 0x4564c8ae,
+    0x5b20995a, 0x7c19380b, 0x4e1ea250, 0xe18348f8, 0xc4dc25bd, 0x70fec661,
+    0x445ca17f, 0x21a7522b, 0xd5f9ac2c, 0x7fb9d8c1, 0xbaa6c8d2, 0xc2dcf185,
+    0xc0d767dc, 0x407c0073, 0x08502c46, 0xb6adbc47, 0x7f27ea2f, 0x582c1627,
+    0x8bc562b1, 0xb1582c16, 0x168bc562, 0x7e039629, 0x804c8696, 0xcef93f36,
+    0xc5020aea, 0x6009cca1, 0x60940f24, 0x0c0683c1, 0xc1603018, 0x180c0683,
+    0x83c16030, 0xc60dec04, 0x96e2218a, 0xa07f0325, 0x3c33ac11, 0xa020a8d1,
+    0xb1506c69, 0x10881810, 0x533e4060, 0x30180c06, 0x0683c160, 0x6030180c,
+    0x0c0683c1, 0x16a61f18, 0x483c1e0e, 0xcaa57314, 0xa2f01804, 0x3852dc8c,
+    0x4ca3cfa1, 0x86d99a44, 0x7af76480, 0xef9e5c1f, 0x4d86eb43, 0x5adfe8eb,
+    0xd3c440f4, 0xf3757181, 0x99f3a8dd, 0xcfe3809f, 0x462e6797, 0x8a4171c9,
+    0x20a8a0a0, 0x0aed8229, 0x8f4c56e4, 0x40b1c30c, 0x8109e8dc, 0x95ada0c8,
+    0xe5ea4d77, 0xd1541801, 0xd9ed46a3, 0xa1307ba3, 0x29e41ffe, 0x92409445,
+    0x4034b2b1, 0x9d517cf2, 0xf8142106, 0x4580387a, 0x2f4dd3c7, 0x27ed3b0d,
+    0x0549998d, 0x8a8f6306, 0x3a845156, 0x97e9bb35, 0x5e1da1ab, 0xd431e04c,
+    0x6d5adadc, 0x10884a01, 0x940a8914, 0x239bc68a, 0xa10404b3, 0xec884804,
+    0x0e276244, 0xf5a1774f, 0x3ef4eec9, 0x6987dbb8, 0x252e6fd3, 0x80213041,
+    0x50e50c32, 0xdf1aaa88, 0xa49cc2cf, 0xb2022240, 0xfb122082, 0x07a1f83e,
+    0x14ec4251, 0x64b096ef, 0xf2f61387, 0x43e1d481, 0x732bea70, 0x01447a15,
+    0x823ca080, 0x00c17d7f, 0x8328d751, 0x7053e1b4, 0x316c1162, 0xbce09695,
+    0x77f84576, 0x86448389, 0x8ce824ef, 0x0e0301e2, 0x7eea6260, 0x4d48cbbd,
+    0x1fc9d82e, 0xa0c3fd3c, 0xf500ffba, 0x5cbbe559, 0xe8db6c71, 0x81409180,
+    0x530ccb0d, 0x8021c6b4, 0x0222e31b, 0xe92c36e2, 0x58508485, 0x31559c86,
+    0x03901c79, 0x0f147426, 0xb8641818, 0x30c09a15, 0x2794a3d4, 0xac911175,
+    0xd9a1193a, 0xdf4a59d5, 0x196ce6d4, 0xd940ef00, 0x64738843, 0xc81dd3c2,
+    0x71014b1c, 0x3d9627b1, 0x42e82743, 0x2a2813e8, 0xb5495d40, 0xe088a15d,
+    0x38fbe0d7, 0x3e17ad50, 0xbfdef11c, 0x5fef78de, 0xe1b31fef, 0xb015d4a1,
+    0x3946cc02, 0x6db82e65, 0x4256d978, 0xa13a23fb, 0x61891040, 0x055b019f,
+    0xafdcce3d, 0x8784d101, 0x4c23455d, 0x8e33c0f3, 0xef36c4af, 0x8fa46fa6,
+    0xe9fda530, 0x00a43e4a, 0x7d78351a, 0x6807011d, 0x100f3360, 0x623aa98e,
+    0x12c0b977, 0x30e32c1d, 0x57684201, 0xa74c6379, 0x1b2b5f3c, 0x7ffd6783,
+    0x5651d777, 0x45469d02, 0x62f446f3, 0xf8e40301, 0x8628d9ae, 0xfcb6c033,
+    0xab5b3287, 0x2c9961c0, 0xba97101a, 0x7e9b03ba, 0xcffbd73b, 0xe7fdeb1d,
+    0xf1fef58e, 0xfe73e71d, 0xfcfc7e6d, 0x402f6afa, 0xd7cd973e, 0xfae8affa,
+    0x71ade3b0, 0x65ad95ab, 0xfb155964, 0x6164298e, 0x342ae229, 0x00ffae76,
+    0xc98891e5, 0x11e373a1, 0x28d2e1fd, 0xd49917ea, 0x5481e6cc, 0x695c3965,
+    0xa041a2e2, 0xae4299bd, 0x5a20edf3, 0x2464aa01, 0x848691fd, 0x5d39fa5e,
+    0x0bc8e871, 0x82050a8a, 0xc1950ecb, 0xb441a236, 0xb06b9304, 0x0f130e58,
+    0xc6c85205, 0x9c4741d9, 0x3910d280, 0x61430631, 0x2bbde74e, 0x64565d09,
+    0x8e250260, 0x803e24a3, 0xf38e4bc3, 0x9236800d, 0xdc6326e7, 0xd252546e,
+    0x11005132, 0x2839457d, 0xa16c947e, 0xe2df2414, 0x65dc58b1, 0x62185f06,
+    0x604b8e5a, 0xec2c6a00, 0x27be7d07, 0x53c89d90, 0xb1191ed5, 0xe3b6eba6,
+    0x08afb8f6, 0x4eb03e00, 0x21ca7659, 0x0ad902f0, 0x26a030bf, 0x58421b17,
+    0x04640b8a, 0x284f9faa, 0xfe97995f, 0x57a1e227, 0x5aca5d01, 0x0c059261,
+    0x3d14d9ea, 0x042da8a2, 0x7ea064b2, 0x1e589c4a, 0x388c9314, 0xd0deb91e,
+    0x00c51ca7, 0xa4062100, 0x23300553, 0x75bb304a, 0x00599740, 0x29504822,
+    0xb3035428, 0xaa417009, 0x45dee6da, 0xd063bc72, 0xd0c2739a, 0x1d054168,
+    0x27fd80ce, 0xcef0a5a2, 0xba010393, 0x28334efc, 0xc11ca11b, 0x6a536059,
+    0x790211df, 0x4a10d49b, 0x29908500, 0x02f00104, 0x2085d7e8, 0x20440e38,
+    0x5eb4e6e1, 0x74a74894, 0x8d049f5f, 0x887e4ca2, 0x57390e21, 0xd23968a1,
+    0x82a07594, 0x6d72312a, 0x19773809, 0x61addf74, 0x21bec491, 0xec9daa47,
+    0x161631b2, 0x5774898f, 0xae93154e, 0x65f37eaf, 0x3bd925db, 0x4d68a65d,
+    0xf752534b, 0xbb6f6e4e, 0xede42e52, 0x3d307c7a, 0xf132f784, 0x9e7476f4,
+    0x81ed4fe7, 0x2dac75f0, 0xf3f8f1f7, 0xbbfbf28b, 0xf8f1f76d, 0x6b179bf3,
+    0x979dd8a5, 0x5ae1302d, 0x9a1591b0, 0x7482019a, 0x54070874, 0xffbeccdc,
+    0xbb5e7600, 0x34d4b0e6, 0xa5730f35, 0x2a0d32f1, 0x7c7fecf2, 0xa98540cc,
+    0x5ea77ba9, 0xbb64bb6f, 0xf0bc6ba7, 0x799fe4cf, 0xfc6657c9, 0x859c8706,
+    0xc40cf0b3, 0xdec42a86, 0x47a9e840, 0xf57abdca, 0x5eafd7eb, 0xebf57abd,
+    0xbd5eafd7, 0x72ebf57a, 0xca26a41a, 0xb0cb4480, 0xce00ff37, 0x8044c7dd,
+    0x8d520a94, 0x6ce54329, 0xcd66b3d9, 0xd96c369b, 0x9bcd66b3, 0xb3d96c36,
+    0x0ad02366, 0x86221490, 0xfe225204, 0x279e95ac, 0x8e6a47f0, 0x20600c45,
+    0x2b575222, 0xe5aa5428, 0xfbf27df6, 0x9f7df93e, 0xbecfbe7c, 0x2fdf675f,
+    0x998defb3, 0x8c232bcf, 0x187a0f72, 0xc30be0da, 0x904b3445, 0xdf675f3c,
+    0x3a36bc16, 0x746dea00, 0xf7d997ba, 0xe5fbeccb, 0xfbf27df6, 0x9f7df93e,
+    0xbecfbe7c, 0x2fdf675f, 0xd997efb3, 0xfbeccbf7, 0xe2b357e1, 0xb31eea40,
+    0xf5e39915, 0xf2582d64, 0x67bfe7f1, 0xfac073f1, 0x63fac063, 0xc063fac0,
+    0xfac063fa, 0x63fac063, 0xea61fac0, 0x0e27fc41, 0xe77b3af3, 0x88317c48,
+    0x1493e734, 0xa0cb4448, 0xb42a6584, 0xb23c4d9c, 0x4ec473de, 0x5e818301,
+    0x35d3541e, 0xc0f47045, 0x2217106d, 0x121f81f9, 0x7e2f7c1b, 0x86c66481,
+    0xf481c701, 0xc7f481c7, 0x81c7f481, 0xf481c7f4, 0xc7f481c7, 0x74c3f481,
+    0xffe13a83, 0x9f9c8500, 0x58fdf937, 0x24603bf5, 0x3b4e83a2, 0x9ff9d708,
+    0x8888888c, 0xc553d5b3, 0x381fbcae, 0x5c6ee73c, 0x362210a2, 0x99d8806f,
+    0x4e6f12f9, 0x2d0f1888, 0xbb05cc16, 0xa50d4f04, 0x85c2ce4b, 0x8c22970a,
+    0x38f9c584, 0x149be6b6, 0xd0aa84e4, 0x1700b480, 0x442649e4, 0xbc474444,
+    0xd802429a, 0x74e404f2, 0x00b2fa73, 0x8a400001, 0x22624404, 0x69609226,
+    0x876a806c, 0x001fb04b, 0x2a55e56b, 0xa552a954, 0x542a954a, 0x4aa552a9,
+    0xa9542a95, 0x9b4f9ac2, 0xd02e8c37, 0xeee07f96, 0x9a6cf086, 0x6d205bce,
+    0x9b84f1a5, 0x82d60352, 0x14281fe8, 0x42a15028, 0x28140a85, 0x8542a150,
+    0x5e28140a, 0x59bcf8e7, 0x23e54806, 0x09e50efe, 0x4bf979ad, 0x4300ff46,
+    0xd899b4f2, 0x8542a150, 0x5028140a, 0x0a8542a1, 0xa1502814, 0x20449842,
+    0xc0f1943f, 0x3ee4cd41, 0x74895419, 0x4ec61f8b, 0x94f4a2d1, 0x5cd01354,
+    0x32f1cc75, 0x21518922, 0x2a9f1c2d, 0x0a8542a1, 0xa1502814, 0x140a8542,
+    0x42a15028, 0x5ce41785, 0xe60881d4, 0x7ca0237c, 0xb87ada9b, 0x588e8e04,
+    0x3e7af665, 0x03ab2898, 0xd426a055, 0x06c3c503, 0x0776a1ad, 0x0b6cc221,
+    0x91c192c8, 0xe362c51b, 0x3d5a3830, 0x9e390bfa, 0xe4987740, 0x49ce135a,
+    0x77404f46, 0x74c3f3e7, 0xd7322414, 0x3295d264, 0xccac1048, 0x10d3c709,
+    0x8158c22b, 0xbdb46c6c, 0x1a6c5826, 0x6741b0d7, 0x46943a1e, 0x6f99b703,
+    0x462d2d65, 0x14e36cd6, 0x6d316143, 0x9262b617, 0xfd272430, 0xb551a6a1,
+    0xc96c6399, 0xc07d6e4d, 0x3d4a12bc, 0xa86368cf, 0x4578c55b, 0x942aee48,
+    0x32d05b96, 0xa880a56a, 0x2d101288, 0x5137591a, 0x06160ac2, 0xd00a9831,
+    0xbd865bce, 0xf6858a0c, 0x6b983e7a, 0x3a6c88a1, 0x1a8352e2, 0xe4046550,
+    0x23ce9f79, 0xeca890cb, 0x3da76e57, 0xd91e7b32, 0x9e6c8f3d, 0x634fb6c7,
+    0xedb127db, 0xc9f6d893, 0x42647bec, 0x33fb655d, 0x35455f50, 0xaca8771c,
+    0x4c284079, 0x00452f22, 0x61a0c620, 0xdea91b34, 0xa5d39497, 0xd3640c44,
+    0x3550477c, 0xc1884c13, 0xb43ae918, 0x84af400d, 0x91c163c4, 0x94e76f87,
+    0xdb634fb1, 0x93edb127, 0xecc9f6d8, 0x3df6647b, 0xd91e7bb2, 0x016c8f3d,
+    0xc8e177ae, 0x9dbd64e3, 0x29367ef0, 0xc6fef035, 0xd3c38e82, 0x983c983c,
+    0x7772e408, 0x1e35b217, 0xa16fd5c1, 0x6b047610, 0xc3e7e0cc, 0xc65e6385,
+    0x03c7c028, 0x2c90ecf5, 0x6761130e, 0x2b72e5af, 0x946cceaf, 0x51605d96,
+    0x06bc7116, 0x2d9fb0cc, 0x056155dd, 0xba6a9840, 0x86100154, 0x830f096c,
+    0x7ab6794d, 0x2d6bb3d5, 0x88263765, 0x2c30bf0e, 0x9a20d408, 0xfd6523d4,
+    0x1243d78f, 0xe083a506, 0x95ef4576, 0xa2ded9f7, 0xfe68c75d, 0xf5904776,
+    0x4863141f, 0x2045005f, 0xc7a8af0d, 0xd9b90187, 0x72e62b29, 0x5897280d,
+    0x77c2ac65, 0x5a4fc6ef, 0x8cd1a20a, 0xa2c86383, 0xf100932f, 0x818db56d,
+    0x116cf742, 0x2ca3814f, 0xc435270a, 0x729d3833, 0x471cbdbb, 0x06a01b60,
+    0x8fa8e0c4, 0x6320b844, 0x16567228, 0x145e5cb3, 0x626105b2, 0x392840e8,
+    0x68cd84c1, 0xe54bdd6e, 0xc9f20c38, 0x69518bd8, 0x01061ec1, 0x84eae0cb,
+    0x04074c32, 0x96382b6d, 0xbdc39648, 0x7360222c, 0x023d5478, 0x88a96a0c,
+    0x0c89c854, 0x94250514, 0x1c807e03, 0x6fd44640, 0x70b8ee76, 0x1a0e72d5,
+    0x7b008da0, 0xf03428b9, 0x8a23e512, 0x7c2a8886, 0xea6791b9, 0x564b85d2,
+    0x976c8d22, 0xc8e03020, 0xaa380a4b, 0x2d8773b4, 0x82496e9d, 0x00e7ad60,
+    0x33eb3096, 0x946de308, 0x56f011bd, 0x151f5465, 0x4c8321fc, 0xe8dd955f,
+    0x02858fe2, 0x37347560, 0x390f140a, 0x9c3ff3c8, 0x1aadb042, 0xef8c6d3b,
+    0xe5eadb97, 0x7db9faf6, 0x6f5faebe, 0xeadb97ab, 0xb8faf6e5, 0x41a75da0,
+    0xfc30f255, 0x66a2e7d8, 0xe1380cc4, 0xc3d1d852, 0x578628af, 0xb6a33f40,
+    0x45586c2b, 0x3a207248, 0xc03a6acf, 0x5a618afe, 0xd51888b9, 0xa5fc2b48,
+    0x8691fcdc, 0x389578b2, 0x6f516b32, 0x84126449, 0xf6e54ad2, 0xbe7db9fa,
+    0xab6f5fae, 0xe5eadb97, 0x7db9faf6, 0x6f5faebe, 0x1e0097ab, 0xbc80d04a,
+    0x4119b40b, 0xb7f8194b, 0xe4eca323, 0x6f1e7c3a, 0x9d2c11c5, 0x30c41ff0,
+    0x5aad2c22, 0x12614e12, 0x27d139ef, 0x09ddabf8, 0xd3913032, 0x0e656cf1,
+    0x860244a7, 0xfe6fb84f, 0xee1c21f0, 0x84e03c10, 0xa70021ae, 0xa6fd06b6,
+    0x30a9116d, 0x701a8076, 0x2c41170c, 0x77c88a73, 0x74367a77, 0x232e728c,
+    0x8d8f7a82, 0xa8c3c477, 0xa0ce34c8, 0x6042bce5, 0x71524126, 0xf6e1342d,
+    0x9abe796c, 0xe49471c0, 0x34887da9, 0x001bdf2f, 0x7f3414b8, 0xb071e49d,
+    0xc9fd106f, 0xaa022649, 0x181060f7, 0x9e72c646, 0x24ae5889, 0x4143be03,
+    0xbfe82dbc, 0x282f43e1, 0x50fb8813, 0xdfcfbe92, 0x0656e0c3, 0x0bd13a35,
+    0x2253805c, 0x0ce49603, 0x63502a45, 0x58fe2262, 0x0a8542a1, 0xa1502814,
+    0xc22eb642, 0x4557e2c4, 0xb33f4265, 0x649b331b, 0xaf2ad5e1, 0x502814e3,
+    0x1f8542a1, 0x33d8a0d8, 0x68ba84ae, 0xaba54867, 0x94fa7426, 0x04e2e647,
+    0x40201008, 0x08040281, 0x7e8b8010, 0x3fdbd117, 0x6d0e0d4f, 0xdd514ce7,
+    0x183f2043, 0x04028140, 0x11e46d08, 0x748d554f, 0x714ebd12, 0x90c12580,
+    0xcd51775d, 0xc04bf4f8, 0x480aa850, 0x6ee5d950, 0x118407f4, 0x6a105a8c,
+    0x193d0e9f, 0xbc7aae38, 0x46928a50, 0x93354912, 0x0eac8953, 0x6e17b904,
+    0xe33baff1, 0x443bde9c, 0x0ff2e01d, 0xd020cb13, 0x33dfb61b, 0xdef96eaf,
+    0xae6cd246, 0x28aecb3d, 0xb945ad8a, 0x9a72c774, 0xa1b33967, 0xbb76be4b,
+    0x45500ccf, 0x8fa08804, 0xd01c7322, 0x8f681a68, 0x727cd470, 0x1da098ab,
+    0x83ecac6a, 0x0a372114, 0xd2ac1ac8, 0x9d1ab391, 0xdc5ba325, 0xe71bdd9a,
+    0x7656b858, 0x16cda34b, 0x2ac8f6cd, 0x67efca0a, 0x2e9ddd15, 0xb45dd002,
+    0x755da416, 0xc59a7b9a, 0x28e12001, 0xcba9c173, 0xc72777c7, 0xdf743cc2,
+    0xb82c9a09, 0x25a500ff, 0x5a19d608, 0x4e6aeabc, 0x0ce5b046, 0xc24cca7c,
+    0x689a5297, 0xe4175144, 0x8fc7e3f1, 0xf1783c1e, 0x1e8fc7e3, 0xe3f1783c,
+    0x801a00c6, 0x01282b43, 0x406d00dd, 0x33b8075c, 0x42a8d784, 0xd51f36a9,
+    0x222671e2, 0x354b7ba7, 0xbdfb6246, 0x8d3e5eb1, 0x3e5e197f, 0x1c6eae8f,
+    0xb0153201, 0x631d1a8a, 0x3eabc35a, 0x2b19319c, 0x91363828, 0xc5828716,
+    0x414c0904, 0x1ee8f0da, 0x079ac9aa, 0x2a908cc4, 0x115a2195, 0xb7b06252,
+    0xd5d59e89, 0x5b42442b, 0xea4e09f1, 0xaf671828, 0xa4199d71, 0xc49ad051,
+    0xa37a4ce4, 0xd8cf18c1, 0xd4d10869, 0x100989d8, 0x4bf0a20e, 0x011534ab,
+    0x0c3a0f5b, 0x544e6911, 0x67450c55, 0xc76a82b6, 0x59b26c36, 0x351c2410,
+    0x710799be, 0x8c21c503, 0x1d84cbec, 0xf5e064a4, 0x3efa780d, 0x8f3e5eb9,
+    0xb67757ae, 0xbaa13b14, 0x247026c0, 0x83efeab7, 0xe937b58b, 0xa62ff89c,
+    0x9e533905, 0xeecae40f, 0x5921c5f6, 0x033855f5, 0xf1ba6675, 0xa25aec88,
+    0x640d8929, 0x791a38d1, 0x1d285635, 0x9bac6e37, 0xed3aa365, 0x7de61297,
+    0x366da072, 0xb01c910b, 0x74dc1e38, 0xec88146e, 0x2f191cc7, 0x25a8f287,
+    0xe2ac6253, 0x45b62f80, 0x3261d97e, 0x5600bce4, 0x07136779, 0x58f2c165,
+    0xf9de135e, 0x4ca71db7, 0xc422c2f4, 0x01c58b33, 0x56c3cb16, 0x25cd7416,
+    0xf4d3fc44, 0x0549d242, 0x20310426, 0x8e997288, 0xfc2fb1b4, 0x0e01ce7c,
+    0x5d912820, 0xde5dd9de, 0x30bde2d9, 0xc97b10d0, 0x3ad531fb, 0xc00eaefe,
+    0xe855415e, 0xc20215e8, 0x822802e4, 0x4794500c, 0xc979ec48, 0xfadc9ff0,
+    0x143d197c, 0xd2e34e30, 0x196b8a88, 0x4b283918, 0xa6d890ec, 0x80ce37b0,
+    0x9c6191ac, 0x72ae6008, 0xe8852089, 0xa24a6715, 0xb84f6288, 0x9b47fe14,
+    0xc48ca271, 0x1c91ef77, 0x44fa6938, 0xd41d7814, 0xe116e75a, 0xce1a1ad4,
+    0xb9d254a6, 0x1490e550, 0x863e095f, 0x4112cda8, 0xfb3831e0, 0xa094d402,
+    0x7720c3a7, 0x0790f6d0, 0xf44f4e45, 0xcbe2b919, 0x424750e9, 0x372878c4,
+    0x2c84bc35, 0x0e015aa7, 0x60e2500a, 0xe9715812, 0x085f9e35, 0x0f7df1ac,
+    0x87be78a6, 0xfac53fd3, 0x1b443831, 0x1bfb82dc, 0xb40bac1f, 0xd0101740,
+    0xde68402a, 0xd56a51be, 0x5aad56ab, 0xabd56ab5, 0xb55aad56, 0x22a0d56a,
+    0x4442340a, 0x80291ee1, 0x3c00b884, 0xfff60380, 0xff9fae00, 0x112d00c4,
+    0x02000101, 0x03050201, 0x03000304, 0x00000001, 0x21001101, 0x41715131,
+    0xf0d1a161, 0x10918140, 0x20f1b130, 0x8060c150, 0xdaff7090, 0x02010800,
+    0x103f0101, 0x59d800ff, 0xa0d3eb20, 0x145c00a0, 0x5c17c8a2, 0x33ae4b13,
+    0x13fd8d86, 0x2ccbb22c, 0xb22ccbb2, 0xcbb22ccb, 0xd3f14d3e, 0xa6cad423,
+    0x45414913, 0x00ee3f62, 0x886078a2, 0xf0567589, 0x2fb10fc2, 0x10c08f2a,
+    0x2f000000, 0x02def602, 0x17e815e8, 0xc41de510, 0x511271fe, 0x7572ca2e,
+    0x7725ab30, 0x83c8077c, 0x340e5d01, 0xd464620a, 0xfefe9c3a, 0x6f49ad80,
+    0x2228df5d, 0x1b67d762, 0x274237b1, 0x699a413a, 0x8bb037c6, 0xb50e5034,
+    0x7d1c325e, 0x140a852a, 0x42a15028, 0x28140a85, 0x8542a150, 0xff25140a,
+    0xde50a900, 0x858abea5, 0x0e15b860, 0xcd244516, 0x50f4a50f, 0x0a8542a1,
+    0xa1502814, 0x140a8542, 0x42a15028, 0x544bb280, 0x31cf91cf, 0x98c4b1fc,
+    0x45b9689e, 0xf6170e64, 0x22108902, 0x51110b60, 0x356a52d9, 0xc06c4760,
+    0x1554bc64, 0xad8ba702, 0x5fa8272f, 0x5c8822dc, 0x6de46983, 0x800e5436,
+    0x5bf0b5b0, 0xb81974cb, 0x53333672, 0x11c5b088, 0x2c04421f, 0x16748811,
+    0xd35438ca, 0x74e57871, 0xbab23d7d, 0x5dd99e3e, 0xae6c4f1f, 0x57b6a78f,
+    0x2bdbd347, 0x95ede9a3, 0xc1f6f4d1, 0x3965cc1c, 0x430d434e, 0xcd7c3b0a,
+    0x0d480571, 0xb0ba0ad5, 0x7c395b52, 0x4cc84e09, 0x00058395, 0x230cc604,
+    0x1ae5c20c, 0x8d9d0484, 0x2470151b, 0x1686f2ac, 0x8b532a8a, 0xe0e6540d,
+    0x3ccd1c8f, 0x4820380e, 0x1a409094, 0x5a281581, 0x657bfae8, 0xb23d7d74,
+    0xd99e3eba, 0x6c4f1f5d, 0xb6a78fae, 0xdbd34757, 0x9b85ea2d, 0xa71d1b74,
+    0x1d970e9a, 0xc7886c0f, 0xd7800309, 0xd3475706, 0xe9a32bdb, 0x29e081ed,
+    0x25c81398, 0x0280f504, 0x9bae911f, 0x9d833dac, 0x470ebea1, 0x145f0c08,
+    0x492b8c33, 0xa45a01b4, 0x4681a8eb, 0xb14020e8, 0x26b13036, 0x05d61614,
+    0x00a8a82e, 0xd99fb10c, 0x4c3705ae, 0x8cd352df, 0x9548d1ab, 0x4d227617,
+    0xdb76838c, 0x55861ec8, 0x2117c82a, 0xa0845d80, 0xae3c6300, 0x80f48147,
+    0x44ecd5cc, 0x0284b498, 0xeba994e4, 0x0d2bb249, 0x80ead7b0, 0x0bc3306c,
+    0x2a657421, 0x36035da8, 0x89b48bd8, 0x4692e24b, 0x29727221, 0x78582851,
+    0xa549ceca, 0x5ad421c4, 0x91154d54, 0x9e3eba16, 0x4f1f5dd9, 0x44c0806c,
+    0xb1213d15, 0x9550ba48, 0x8e2e607f, 0x5a300558, 0xc12c0975, 0xd4039249,
+    0xa642f122, 0x5f784621, 0x89b5dbd5, 0xba94b2fa, 0xad971952, 0xc812097d,
+    0x33c09966, 0xfa050088, 0x2f42bf44, 0xe5440ecd, 0xfc7ce63f, 0xe7f0f339,
+    0x3f9fc3cf, 0x39fc7c0e, 0xcfe7f0f3, 0x734a83c3, 0x83018422, 0x3e1a3ac4,
+    0x1fd97f30, 0x9ae280ef, 0x0d2c2308, 0xe1018da8, 0xbcdc48e8, 0xb7839436,
+    0xe01408ca, 0x39fb2701, 0x407c81e0, 0xb1228044, 0xe28eaa66, 0x227ad996,
+    0xb1b40847, 0x9282152c, 0xb274bc12, 0xdd4c46a7, 0xe1e733f7, 0x3e879fcf,
+    0xf8f91c7e, 0xcfe1e773, 0xc23b879f, 0xbd5e7837, 0x9f3d3843, 0x0b5d20e3,
+    0x7ca62eec, 0xf0f339fc, 0xaf27bde0, 0xbe9b332a, 0x126d04a2, 0x795a4134,
+    0xe79e5587, 0x31e7a464, 0x2268b374, 0x60fa1b01, 0x3a80698c, 0x6e1282ab,
+    0x76be8824, 0x16058b30, 0x220962d5, 0xc2ce5707, 0xa3aa00a9, 0x7d24b2e1,
+    0xe1394cd9, 0x928531be, 0xc5234053, 0x2ae69261, 0x22c5a0bd, 0x8f0c6069,
+    0xcf6b8b05, 0x98b0d755, 0x9c749d42, 0x50a0812d, 0x06a9c116, 0xc29e3349,
+    0xda495cd1, 0x2c05d345, 0xcc85c062, 0x45a3e7d0, 0x098d26e1, 0xb0966cab,
+    0x1a235e4b, 0x5191dec4, 0x45393405, 0xf69e5d6f, 0xf06ea700, 0x9fa92bbf,
+    0xfc7c0e3f, 0x318fe039, 0x75faf75d, 0x2a647ffe, 0x2a802714, 0x105774ce,
+    0x44204741, 0x403f3bee, 0xebd2055e, 0xf1d8cba1, 0xd9a447fd, 0x0ecab244,
+    0xda4ce7e6, 0x378a9669, 0xec3495b0, 0x10fdf4e8, 0x1881b988, 0xc63bc6f0,
+    0x89540005, 0xf3e4a54e, 0xc0c69b35, 0x2268a822, 0x78895154, 0x36881271,
+    0x52d501a9, 0x732db41f, 0x016da09a, 0x0a6c70d1, 0x150abe48, 0x1c422bb1,
+    0xf9172e2d, 0x3e9fcfe7, 0x1f1efc7c, 0x78e6151e, 0x6be0d97e, 0x73dd78e6,
+    0x7638b566, 0x1af87c1f, 0xd733a7dd, 0xbbfe2e3b, 0xcbe63bbf, 0xcecfaebf,
+    0x9d1df364, 0xa09160ab, 0x00ff30e0, 0xe7f3b93c, 0x463d9fcf, 0xc84e68dd,
+    0xaf08903e, 0xa3f40ae8, 0x05085129, 0xacfa29c0, 0x564df4f9, 0xf1ac57cd,
+    0xe5d499fe, 0x9df3b7fb, 0x64977c97, 0x38c0e5e9, 0x9d2bcc3b, 0x55b35513,
+    0x07783ceb, 0x8cbfd807, 0x6e5ecba9, 0xd41b3650, 0xfabbec2c, 0x80effcee,
+    0x57987758, 0x6fd840be, 0xe3c9b350, 0xf177e3f3, 0x91e7e0e7, 0x9be5cbd3,
+    0xc92ef92e, 0x2388cbd3, 0x04835820, 0xdea0ac42, 0xb983f148, 0x04d7352a,
+    0x3b331064, 0x9e6b21e5, 0x60bf4a40, 0x6d7843e5, 0x0458121b, 0x9de8a9a4,
+    0xab80fd80, 0x3803308c, 0x90dadc1d, 0xb00a69c8, 0xc94a8e23, 0xda5f24d2,
+    0x98487d0e, 0x7c099313, 0x1ba3e1f2, 0x318b6940, 0x8beed101, 0x322cb585,
+    0xc43ad138, 0xda14c159, 0x80a9c109, 0x2a73fc1b, 0x0335304b, 0x8588dc2b,
+    0x0a2df1d8, 0xfc2e2f08, 0x94a07bc1, 0x4b468181, 0x6d80aac0, 0x22e58a4d,
+    0xa10d6827, 0xbb11cad9, 0x36d25277, 0x8619e822, 0xf1a27533, 0x9893e5b5,
+    0xc222e07f, 0xec7eb7b9, 0x06f3846b, 0x053cba1a, 0x4d2ee6bb, 0x480de128,
+    0x13eb3af2, 0x0a4c0616, 0x452c00ff, 0x861602c0, 0x47ea1adb, 0x25fb7c9e,
+    0xb0c33641, 0x15a801b5, 0x6d05b801, 0x0f61083b, 0x02a309c2, 0x071ca23f,
+    0xeab50000, 0x555ca3b3, 0x9c24375d, 0x03543714, 0xb5cb8448, 0x58902e64,
+    0x0761d6d4, 0xc4501972, 0x058df3e5, 0x928200a8, 0xd2a40431, 0xb01fe209,
+    0xb8135467, 0xb97f79fc, 0x8840800a, 0xc8402482, 0xa53a28a5, 0x0d2010e7,
+    0x49250a11, 0x514a8912, 0x40443f39, 0x9aa20451, 0x51ea944a, 0x8727e235,
+    0x154851e8, 0x38958305, 0xe3d1150f, 0x31342b86, 0x2582602d, 0xe0e00b82,
+    0xed48caae, 0xda4110ac, 0x15303d9c, 0x02405500, 0xda00e8aa, 0x733e06af,
+    0x40d19144, 0x3d65928f, 0x9a10b921, 0x4a0b2811, 0x4104d780, 0xa8540010,
+    0x178c0559, 0xcf7e9c71, 0x51fd74ca, 0x704786cc, 0x02286d49, 0x6a35fa81,
+    0x20a53d3b, 0x290c259c, 0x5b01eb0f, 0x8787cb3a, 0x10e01253, 0x4ac259d4,
+    0xb5b8931e, 0x7070e4a6, 0x1728a1df, 0x34673c9b, 0x295d7882, 0x95aeb3f7,
+    0x403c9e4a, 0x05d502e6, 0x83a5902a, 0x17730085, 0x7cd361b9, 0x400e5979,
+    0xb3419526, 0x8c130637, 0x5d052017, 0x00cd2b80, 0x41707cbf, 0x9a266487,
+    0x0e1242d5, 0xe8824043, 0xa1460885, 0x356f0506, 0x960a4177, 0x9f048c5a,
+    0xc4480984, 0xe141d8ef, 0xfae9948f, 0x70abc6bf, 0x0414b491, 0x606d9c93,
+    0x83cd142e, 0x7d6935d5, 0x69bc9060, 0x1d894a0e, 0x928cf012, 0x383133f5,
+    0x5a9acf92, 0xce4bd142, 0x35ea21da, 0x7c3da7e3, 0xbd86cbd1, 0xc25ec560,
+    0x10408eca, 0xc18769fa, 0xabdabefe, 0x4154d366, 0xc92e7c31, 0x4011201c,
+    0xa20562cb, 0x64f089d9, 0x6c20f796, 0x840e883c, 0x82280022, 0x0baee2d8,
+    0x49a884b7, 0x609a10d3, 0x445c04d1, 0x141da8e0, 0x92850929, 0x91b06053,
+    0x1ac5a0a0, 0xd5182a19, 0xd64155e7, 0x291fec8f, 0x4a49f5d3, 0x012d030b,
+    0xf7a2b9c2, 0x58631ce9, 0x141a5ef0, 0x7f650882, 0x54673f54, 0x63a62e9b,
+    0xfd444152, 0x6de88502, 0xa1112913, 0x1f69a2a4, 0x28140aa3, 0x8542a150,
+    0x5028140a, 0x0a8542a1, 0x955eda15, 0x54882362, 0xff1ae04d, 0x1e82de00,
+    0x64e35d9c, 0x45401565, 0xc34b3f22, 0x381c0e87, 0x87c3e170, 0x70381c0e,
+    0x0e87c3e1, 0x0447de00, 0x02684b0a, 0xf45fd115, 0x08e5d70c, 0x24075513,
+    0x7c021426, 0x202a1d2b, 0x695aa6a3, 0xbf49bf48, 0xf7fbfd7e, 0x7ebfdfef,
+    0xeff7fbfd, 0xf97ebfdf, 0x517b9be5, 0x18497ca2, 0x2c2986b4, 0xbb407a1c,
+    0x8a16aed6, 0xa7135404, 0xab42e578, 0xa7e08493, 0xa4e3ad8d, 0xe60a14cc,
+    0x617a589b, 0x31d73e5d, 0x6fc5838a, 0x5da3739d, 0xd3f07dfa, 0x808386ad,
+    0x052cb002, 0x05fe60e8, 0x98ea6c65, 0x55afdc9b, 0x53484e37, 0xad377dc3,
+    0xda2831e7, 0xe9858746, 0xf481c0f7, 0x02315ad3, 0x56d802d4, 0x3a5d1644,
+    0xc34e8d36, 0x3a23f107, 0x94242296, 0xcbab6894, 0x496f2169, 0x5332c3cd,
+    0x584f4c61, 0x5be151a1, 0x6b745ae7, 0xac377d73, 0x482605e6, 0xb0d7124b,
+    0x518d4a17, 0x4901b454, 0x8ed739cd, 0xd2c4a232, 0x27470f3b, 0x17b3c109,
+    0x14de0782, 0x041089c4, 0x64a369dd, 0x37b12bdc, 0xf3c8d74f, 0x792351f0,
+    0x005f4321, 0x985e1ea3, 0xc839733c, 0xbaece95d, 0xe27657ba, 0xc1852e44,
+    0xef3c24c4, 0x60af6018, 0x2bd36074, 0x1c05242b, 0xb3f6682a, 0xe78a1162,
+    0xd2a70145, 0x0508b5b6, 0x44e36c44, 0x9372adc0, 0x74d1c2e2, 0x062e50b3,
+    0x61d5a2a4, 0x556e14c2, 0x850646ab, 0x701fc3d5, 0xc225b23c, 0x2a54a501,
+    0x2805970e, 0x4d9cbe60, 0x7f490562, 0x026a2547, 0x840b01a7, 0x95801092,
+    0x7cb0ec24, 0xa894b0f6, 0xfb6a846e, 0x088dd1c9, 0xa4dd3ca7, 0x0954d491,
+    0xa22c6032, 0x03b21220, 0x06850248, 0x0c9c96ec, 0x1705dc25, 0x8923e742,
+    0x5e14a72c, 0x4c4148b1, 0x48a2b82e, 0x09411390, 0x50f83abc, 0xbd95a66c,
+    0xbd8769c6, 0x4b3944c2, 0x477c04b1, 0x0170ca22, 0xf86bba84, 0x65a39936,
+    0x570f3b7f, 0x91cf453e, 0x88aef972, 0xa83878d0, 0x5b850aca, 0xddb23ab8,
+    0xbbc511dc, 0xa79db210, 0xda97622d, 0x67269760, 0xa6f574f3, 0x0b04b630,
+    0x6279318f, 0x098bc162, 0x14249978, 0x2f7b862c, 0x89fd9449, 0x156f254c,
+    0xab146a16, 0x55f562ba, 0x11c7d757, 0x5629c858, 0x80470879, 0x9e75d005,
+    0x0c44b1b7, 0x9c41c42d, 0xdb40450c, 0x6550d3a0, 0x11e7a0d8, 0x78920688,
+    0xd805ce94, 0xba06b4e5, 0x129214b7, 0xb916f899, 0x9b3630b0, 0x6a40acaf,
+    0x3ea7064a, 0xa13bea2c, 0x5853a9d1, 0x3e17f9b9, 0x7191cf45, 0xbffc80f9,
+    0x65fefafd, 0x8ac7c13c, 0x3a32f977, 0x0c5c2c3f, 0xae8914c0, 0xc092cbd9,
+    0xaa4c0033, 0x9a22049d, 0x942060cf, 0x0aa899ac, 0x1db580b1, 0x26f9e4c3,
+    0xca158620, 0x84b5687a, 0xc30a38f0, 0x4d7f2a72, 0x14111ea4, 0xc6884265,
+    0xc385c25e, 0x1543c1f1, 0xf1cc13bf, 0x868bb379, 0x20dc5efd, 0x0ba03628,
+    0x5c5c0e56, 0x05c26ee0, 0xf902766d, 0x9e0c88ca, 0xfcdcc4c4, 0xcf059024,
+    0x7ea01e1d, 0x99e1e183, 0x10feea72, 0x308834d7, 0xbf804dc1, 0x605d9908,
+    0x026c192b, 0x8c1e6805, 0x61868882, 0xf101e787, 0xdc01f0c0, 0xd62014f1,
+    0xe0aa887f, 0xc2451c61, 0x9422af00, 0xb3709806, 0xb8844c74, 0x32ea6186,
+    0x202064b6, 0x44730361, 0xbd990489, 0x97bcac0e, 0x8867fbfd, 0xfc8f843e,
+    0x44c18bc2, 0x77523bc4, 0xe327b3c1, 0x5ee3f889, 0x02109d4a, 0x3283064a,
+    0xa8155b0c, 0x760c3855, 0x950c6c35, 0xb7183810, 0x321f4090, 0xba993cc5,
+    0x3827bd8a, 0xb196c060, 0x688bb810, 0x54cfbe2d, 0x751984a2, 0xd83a2813,
+    0x0068a155, 0x098a0129, 0xeb8c4291, 0x18fc8855, 0x953cc116, 0xc4c229bc,
+    0x370b72ab, 0x39b78231, 0xd2f69f65, 0x47611105, 0x01434c10, 0x5f860636,
+    0xe904433c, 0x40c21b12, 0x9584ae76, 0x91282a6c, 0x94512e56, 0x9b07d5f8,
+    0xd0a03d4d, 0x4b26c393, 0x088954a5, 0xee035cc1, 0xc5e43dcd, 0xcf0e8136,
+    0xf8c9458a, 0x2c387ee2, 0x5735405c, 0x54005ec5, 0xc59c8102, 0xa0e65c2f,
+    0x5e3faa91, 0x831aa3b9, 0x16ac4b6c, 0xdd0c0dc2, 0x104bbec2, 0x3e088fb1,
+    0xfdc2a05f, 0x6c44f041, 0x9134a400, 0xec9b9600, 0xd0450490, 0xcb4a3600,
+    0xda278f40, 0x4d356bf4, 0x317e351d, 0x3c34efe2, 0x66fe4c07, 0xdf7cddf9,
+    0xe9bccfa4, 0x5b988ef1, 0x17dfd495, 0x8143264f, 0x79baf2d4, 0x3183483f,
+    0x970fec58, 0x963a6e66, 0x41a3b033, 0x54804233, 0x69aac5a1, 0x66bd6ae6,
+    0x97ee5d3c, 0x62fae990, 0x5d79067e, 0x69a2993c, 0x8ef1abe9, 0x68fd66a6,
+    0x37a8831c, 0x3903ae2d, 0xab1404a9, 0x3264ee43, 0x124de9b3, 0xa3d16834,
+    0x341a8d46, 0x46a3d168, 0x6b341a8d, 0x12053c53, 0x79458d01, 0xd9f900ff,
+    0x7526eaa3, 0x1f916b13, 0xbfdfef4b, 0xf7fbfd7e, 0x7ebfdfef, 0xeff7fbfd,
+    0x0a61bfdf, 0x526c7c04, 0xc6b018e3, 0x64dcfe71, 0x496621cc, 0x1b9a8869,
+    0x00000000, 0x00000008, 0x64020100, 0x647bfaf4, 0x647bfaf4, 0x647bfaf4,
+    0x647bfaf4, 0x647bfaf4, 0x617bfaf4, 0xbad4a9f3, 0x7a340709, 0x90fb2818,
+    0x0a2105da, 0x7a325201, 0xe1b13d7d, 0x50e72298, 0x63450adf, 0x7bfaf42c,
+    0x7bfaf464, 0x7bfaf464, 0x7bfaf464, 0x7bfaf464, 0x7bfaf464, 0x7bfaf464,
+    0x7bfaf464, 0x7bfaf464, 0x7bfaf464, 0x6a20d760, 0x367ddb06, 0xb5fd3bc7,
+    0xf5555f1f, 0xae77673a, 0xdd71bd3b, 0x5cef8eeb, 0xbbe37a77, 0xb8de1dd7,
+    0x5e9756d8, 0x3c9ed541, 0x94e4e3d4, 0x05c64388, 0x8889d491, 0x0a668a32,
+    0xda455964, 0x5a20aa61, 0xb24f2ec8, 0x75e05f0c, 0x4c6015a1, 0x60db9a48,
+    0x81223145, 0x9ea39231, 0xaac405bc, 0x1c1585cb, 0x77c7f5ee, 0x71bd3bae,
+    0xef8eebdd, 0xe37a775c, 0x3b17d7bb, 0xea9257e6, 0x830dd3eb, 0x19b4fdd7,
+    0xcd19e80a, 0xf2f4d522, 0xb8de9d89, 0x77c7f5ee, 0x71bd3bae, 0xef8eebdd,
+    0xe07a775c, 0x51e9514e, 0x1ec26350, 0xa10f9ea3, 0x94742859, 0x47e0553b,
+    0x643c664e, 0x31444693, 0x12dc3844, 0x3b4f0318, 0xd9ac832c, 0x8492102f,
+    0x8c009076, 0xe1e86c25, 0x798fc04e, 0xcbe496af, 0x8851e214, 0xee78d248,
+    0xae77c7f5, 0xdd71bd3b, 0x5cef8eeb, 0xbbe37a77, 0x7bdf05d7, 0xecc12daf,
+    0xb67f3c6e, 0x1a514414, 0x229c8822, 0xd9044f6c, 0x02671488, 0x7844071a,
+    0xf4abf8a2, 0x28140aa5, 0x8542a150, 0x5028140a, 0x0a8542a1, 0xc0972814,
+    0x64949e83, 0x540004c1, 0xd100ff00, 0x883482dd, 0x08467198, 0x12691531,
+    0x0fc2f9a6, 0x948ca28d, 0xa7d34bbf, 0x743a9d4e, 0x4ea7d3e9, 0xe9743a9d,
+    0x9b4ea7d3, 0x09402227, 0xda888661, 0xd6e6029c, 0xe31395e1, 0x94f4a54d,
+    0x46a3d168, 0x68341a8d, 0x8d46a3d1, 0xd168341a, 0x6dcc20a2, 0xe4338487,
+    0xf47af177, 0x0393dd1a, 0x3e9e7f6c, 0x3e0d8317, 0xd768227c, 0x563a488c,
+    0x020dc482, 0x6d6ca143, 0x42953e0e, 0x28140a85, 0x8542a150, 0x5028140a,
+    0x0a8542a1, 0xd2d3890c, 0x230f4ca0, 0x3828fd00, 0x896c1353, 0xd0c4b5e0,
+    0xebdd99f1, 0x2a202a88, 0xf0a90230, 0x8b91af00, 0x185ef72a, 0x0fd2a9b1,
+    0xf0128f23, 0x4365ace0, 0x082dca09, 0x40acb0f6, 0x82810053, 0x9068d392,
+    0x1d80cc25, 0x8cb94261, 0x4ab1e016, 0xba903c02, 0xd81d30e6, 0x69a1608a,
+    0x6853a872, 0x9215641b, 0x836826a9, 0x2a4eea69, 0x8a02c82a, 0x112ac420,
+    0x6368124a, 0xa15306c1, 0x056d5e90, 0x62158320, 0x3c50db29, 0x515059f9,
+    0x112ddb30, 0x42d98238, 0x2488024f, 0x618e28a0, 0x2026b065, 0xd92a5e21,
+    0xbc006e98, 0xdf16edd4, 0x71d643e2, 0x82a46149, 0x964d81d0, 0x4f57e8bc,
+    0xc357b20a, 0x108a6880, 0x00109230, 0x440e9151, 0xee1c4a1a, 0xd62cc1f5,
+    0xc64d8c87, 0xaa53aad9, 0x7aa1e370, 0x10101c0e, 0x09c6091a, 0xebdd193f,
+    0x775cef8e, 0xd7bbe37a, 0xeeb8de1d, 0xae77c7f5, 0x8d8fa313, 0xc5024c54,
+    0x37235ba8, 0x9461982c, 0x6a001531, 0x9c42f818, 0xd5165320, 0x81e10209,
+    0x6f057a38, 0x1d94a011, 0xaa74b3bb, 0x8dbb850e, 0xaaac2218, 0x835b51d4,
+    0x081e1217, 0x4eb6ec2e, 0x40cc8def, 0x8eebdd99, 0x7a775cef, 0x1dd7bbe3,
+    0xf5eeb8de, 0x03ae77c7, 0x693c8a44, 0x6528ab25, 0x3900ffe4, 0xa8505088,
+    0x33527869, 0x3eba72c1, 0x1f5dd99e, 0x01956c4f, 0x83dd522e, 0xd590d966,
+    0x2db7388c, 0x83df0e13, 0x2fd61027, 0x36df92d2, 0x792d9e09, 0x554c01e4,
+    0x8250cfc5, 0xd61833cc, 0x0caa21c2, 0x832abc0c, 0xa088cf8c, 0x4dd30704,
+    0x08836047, 0x8c018b09, 0x79056584, 0xc1705151, 0xf21ecf2a, 0x62cb43a0,
+    0xddb9a9b0, 0x4621a230, 0xd4aa89e1, 0x29f18e09, 0x92682658, 0xca9dd24d,
+    0x21645a75, 0x6a8c5a96, 0xb2144afe, 0x3892732a, 0xc39bd3a8, 0x2943b350,
+    0xb8aadca0, 0x460de804, 0xff740f6f, 0x33a17500, 0xaf2c84b7, 0x4ca3a681,
+    0x9ab849aa, 0x51d0c045, 0x98fd0814, 0x3d7d74e5, 0x002053b0, 0x544e7e25,
+    0x7e1a013c, 0xbc02d886, 0xda994782, 0xcfbf7996, 0x1e505bb6, 0x1df1c446,
+    0x3bbee270, 0x22beab39, 0x08f43540, 0x1e82d418, 0x2022ae42, 0x8259e35f,
+    0x219ed301, 0x4b608301, 0x2c82ca9c, 0x0220360a, 0x3ca2a710, 0xd814061d,
+    0x22d42a10, 0x244d9426, 0x4b207428, 0x92449fd0, 0x3d3246be, 0x993e3d97,
+    0x0c99c298, 0x7f6d0628, 0xf6ba6e3d, 0x02132ce8, 0x054d1b44, 0x9c2bd04b,
+    0x53b41406, 0xd5c0f6c6, 0x0b836dbc, 0x430ba8f8, 0x39dd8529, 0x8b35750f,
+    0x8620447a, 0x71034602, 0x383f8bda, 0x18b7c0a1, 0x856ac599, 0x75a0961e,
+    0xf3776561, 0x7295980d, 0x20c07150, 0x73f2e7da, 0x7fa6488e, 0x59d0652b,
+    0xec5c8622, 0x6c9f7ff3, 0x5970cd71, 0xc4ca2252, 0x075e70c3, 0x0c678f1d,
+    0xe3142001, 0x7767ad45, 0xbe3bdbc7, 0xf1ddd93e, 0x8fefcef6, 0x7d7c77b6,
+    0xede3bbb3, 0xd300ff85, 0x95f9c2fa, 0xd1a049b3, 0x236093d4, 0x6c75fc0d,
+    0x7be7425a, 0x94633d8d, 0x2b98ed85, 0xd9236a78, 0x824432cf, 0x52e301b6,
+    0x70a3359b, 0x22bb6d6c, 0x5cf4c2e5, 0x49464504, 0x598ec026, 0x1cfb09c4,
+    0x195818b1, 0x6c1fdf9d, 0x67fbf8ee, 0x3bdbc777, 0xddd93ebe, 0xefcef6f1,
+    0x7c77b68f, 0x6ac5b07d, 0xa8d97980, 0x0a5f3574, 0xe4f34f5e, 0xcb21f32d,
+    0x7f1fc7bf, 0x73f8f90c, 0x60c0e1e7, 0x0716e049, 0x9301bd2c, 0x9e6296d2,
+    0x8ca4d78b, 0x7b324ae2, 0xc3c25b14, 0xd010d808, 0x00b5a9f4, 0x144950cd,
+    0x8fb58d21, 0x0767d3e0, 0x0466ed58, 0x52f621dd, 0xee4a408a, 0xd0d47bb6,
+    0xa171945c, 0x270ac622, 0x80110c24, 0x4d42ec6e, 0x12cc1889, 0x6ceab11a,
+    0x785a8f05, 0x56319634, 0xd998a79e, 0x70be86d5, 0x326b0330, 0x62477dee,
+    0xa902a9a8, 0x29c152c2, 0x26de0d36, 0xb682492a, 0x63411012, 0x554eb1a2,
+    0x3501f793, 0x5edadb37, 0x53681625, 0x209b6d2b, 0x590a0ee1, 0x0ad27032,
+    0xf28583e9, 0x01d5b886, 0x116fc071, 0xcfe1e74f, 0x9237872e, 0x8101faeb,
+    0x08e7b0dc, 0xd08264ab, 0x2d698803, 0xe8887b0f, 0xe47eeaa1, 0xcbe572b9,
+    0xb95c2e97, 0xdc33f872, 0x50828181, 0x3e07a116, 0x87bd6afa, 0x60b95d83,
+    0x72b9c47e, 0x2c97cbe5, 0xda0622a9, 0x62937599, 0xcd15f483, 0x07e8b999,
+    0xc70b421a, 0x00ff7cf6, 0x7cf6cf67, 0xcf6700ff, 0x00ff7cf6, 0x7cf6cf67,
+    0xcf6700ff, 0x00ff7cf6, 0x7cf6cf67, 0xc96700ff, 0xeb52d426, 0x0c6e9321,
+    0x15490d61, 0x0d00baad, 0xffda1148, 0xf6cf6700, 0x6700ff7c, 0xff7cf6cf,
+    0xf6cf6700, 0x0d55ac7c, 0x03a55704, 0x24f398ee, 0x2ba000b0, 0x2f3b808e,
+    0x4ec0d1f2, 0x48824429, 0x024ba250, 0x2853a12e, 0x2d965028, 0x05fd2c7a,
+    0x3f76c005, 0xfeee1be3, 0x3800ffbb, 0xdf7576dd, 0xa987c7f9, 0x71bd73da,
+    0xbce509f8, 0x05a6479e, 0xe33f76c0, 0xc953d31a, 0x5c63eead, 0xe35fd3d7,
+    0xba35e311, 0xf3bfebec, 0xed440086, 0x4b66328c, 0x60dc8042, 0x44c4590c,
+    0x94955894, 0x1a76b8ab, 0x70d0e11d, 0x210f8010, 0x8635be37, 0x795983b3,
+    0x03fe6c9e, 0x3489e9cb, 0xfbbdcba3, 0xa842a7fe, 0x484b216c, 0x290509d6,
+    0x1400ff57, 0x0c7a3182, 0x1ce806c3, 0x55404130, 0x63efce2e, 0x7d224807,
+    0xd56ab522, 0x5aad56ab, 0xabd56ab5, 0xb55aad56, 0x9015d06a, 0x40d7992e,
+    0x5e01f44a, 0xc080e702, 0xd66e834f, 0xfe6d1db6, 0x3c089fdf, 0x1424fa83,
+    0x8bfc18a9, 0xf9ab23db, 0xbf3ab27d, 0x9026db97, 0x20847850, 0x2978a5de,
+    0x085602ce, 0x72d324ce, 0x8aeca420, 0x85193545, 0x2821085d, 0x01de9a0d,
+    0x40dd86f4, 0x2d0d9650, 0x87aad3c0, 0xf8c8000d, 0x18134f8b, 0xa3a84c92,
+    0x057c5efa, 0x4436d7ac, 0x4e40944d, 0xfd5ec3d5, 0xebd09699, 0xb88efcde,
+    0x23c4413c, 0x014c3d9e, 0x18468e38, 0xda0e42dd, 0xe9300438, 0x00ac0c51,
+    0xac5a27e9, 0x1e176a99, 0xc0a35727, 0x9c345343, 0x00e2b395, 0xa002d587,
+    0xa916188a, 0x502e948a, 0x025504e9, 0x3455a2e1, 0x0aa192e8, 0x91892d62,
+    0xd9befcd5, 0xedcb5f1d, 0xeddda79d, 0xd388e096, 0x293b2f46, 0xe0f6bfa2,
+    0x3c430edb, 0x8f87360d, 0xffc147a6, 0x83277100, 0x9e1cfed1, 0x87efc18f,
+    0x0061cd29, 0x7ea5efa2, 0xc3ba3ad8, 0x9434b478, 0x6b118148, 0xdba08643,
+    0x28912db5, 0x20788aca, 0xff614bde, 0xe9447100, 0x44209359, 0x63105422,
+    0x01ebadae, 0xc6302e08, 0x41c0a50d, 0x839d0860, 0x1831ace8, 0xbd0c70b2,
+    0x0b3ff0dd, 0x26800230, 0xa398d64e, 0xe015c37e, 0x864fe925, 0x082921c3,
+    0x4ed0c046, 0x890c7052, 0x060380c8, 0xd7108c86, 0x29c09568, 0x9924cdfe,
+    0xde26eade, 0xd0f79a51, 0x2befd2b9, 0xd7591690, 0x44550528, 0xaeaa824d,
+    0xf7e0474f, 0x831f7cc9, 0xffe023df, 0xc874b800, 0xe0099ed4, 0xb77f3bbd,
+    0xdc9ceb93, 0x196b8d70, 0x36852014, 0x3c42113b, 0x041f6922, 0xe3873ce7,
+    0xc70f79b6, 0x0b8c746c, 0xa51dc39a, 0xed70642b, 0x085aab40, 0xec206227,
+    0x7bd5282e, 0x7356e723, 0x17dba0c4, 0x81080b14, 0x91548195, 0x1c8f2ea9,
+    0x6165e7ae, 0x19323a1e, 0x0cf344cc, 0x1008bc12, 0x1bb9a6c3, 0xc60a09b4,
+    0x308f6710, 0x96ad38ee, 0xe385c50a, 0x4a682e11, 0x5a408e08, 0x078c2e40,
+    0x590cc135, 0x081a4a1d, 0x439b0701, 0xb3e7ea1b, 0x4ce6dda0, 0x152ee766,
+    0x02a0db0b, 0x10103cf8, 0x254d5904, 0x08f249d8, 0x0d9d9a64, 0xce0bb448,
+    0x70309f69, 0x93c3fdb3, 0xb6e3873c, 0x6cc70f79, 0xd88e1ff2, 0x06207d4b,
+    0x085cac62, 0x70fbaff4, 0x1f009c63, 0x7e4b1f60, 0xeff7fbfd, 0xfd7ebfdf,
+    0xdfeff7fb, 0xfbfd7ebf, 0xafaaaaea, 0xbfeed52a, 0xc4ffe9fc, 0x01102b00,
+    0x02010200, 0x03040305, 0x00010101, 0x01000000, 0x31211100, 0x91611051,
+    0x4120f0d1, 0xe1a171c1, 0xb14030f1, 0xff605081, 0x010800da, 0x3f010001,
+    0x05f47410, 0xf4abb1db, 0x95ced536, 0xc2b4666b, 0x1a472ece, 0xe200fff4,
+    0x2e97cb65, 0xe572b95c, 0x5c2e97cb, 0xcbe572b9, 0xb95c2e97, 0x97cbe572,
+    0x72b95c2e, 0x2e97cbe5, 0xe572b95c, 0x5c2e97cb, 0xcbe572b9, 0xb95c2e97,
+    0x97cbe572, 0x72b95c2e, 0x2e97cbe5, 0xe572b95c, 0x9b942cbb, 0xb2d61197,
+    0x96340199, 0xbcf79927, 0x8a382ae4, 0x35c89a62, 0xe2c7aaf4, 0x05580656,
+    0xabb286de, 0xf31d9ef7, 0x78e63b3c, 0xeff0cc77, 0x33dfe199, 0x8767bec3,
+    0xf90ecf7c, 0x3cf31d9e, 0x053ae6bf, 0x56df587a, 0xf0cc7778, 0xdfe199ef,
+    0x67bec333, 0x0ecf7c87, 0xf31d9ef9, 0x78e63b3c, 0xeff0cc77, 0x33dfe199,
+    0xed60bec3, 0xd03bec08, 0xec206d62, 0x8767d19b, 0xf90ecf7c, 0x3cf31d9e,
+    0x7778e63b, 0x99eff0cc, 0xc333dfe1, 0x7c8767be, 0x9ef90ecf, 0x3b3cf31d,
+    0xcc7778e6, 0xe199eff0, 0xbec333df, 0xcf7c8767, 0x1d9ef90e, 0xe63b3cf3,
+    0xf0cc7778, 0xdfe199ef, 0x67bec333, 0x0ecf7c87, 0xf31d9ef9, 0x78e63b3c,
+    0xeff0cc77, 0x33dfe199, 0x8767bec3, 0xf90ecf7c, 0x3cf31d9e, 0x7778e63b,
+    0x99eff0cc, 0xc333dfe1, 0x7c8767be, 0x9ef90ecf, 0x3b3cf31d, 0xcc7778e6,
+    0xe199eff0, 0xbec333df, 0xc95c6f63, 0x345cb64d, 0x3b1ce7c1, 0xf829cb57,
+    0xfc9cae1f, 0xdc59dc66, 0x2271de2b, 0x059ecdf0, 0x49d2abca, 0x42e2b06d,
+    0xc5b80b1a, 0x677ce380, 0x951faae8, 0x0b81ed8d, 0xdc1847f0, 0x0b62e51b,
+    0x15080bb8, 0x7887ec6d, 0x9022c801, 0x1c3b5aca, 0xf0ca1ef6, 0xb90257ca,
+    0xb66cc534, 0xf1198c5e, 0xc1e489a5, 0xbf4d5909, 0xc49977e9, 0xc2e5ad0d,
+    0x1a02da6c, 0x7d16362e, 0x81eec802, 0x70258037, 0x114e3e3f, 0x6570e9af,
+    0xc9968b7f, 0x891b6bb5, 0x4ca8aa90, 0x13f87d38, 0xcb5b7d1c, 0x9282350b,
+    0x6c524a5a, 0x6c20077c, 0x924f9dc9, 0x101e196e, 0xcf1e6edb, 0xa6657a71,
+    0xf7bf063e, 0x68d36467, 0x07d51fdd, 0x614f7c09, 0x6c100002, 0x04e74c4f,
+    0xe04512b6, 0x01845ae9, 0x8281a5cb, 0x025d426e, 0x00a37e08, 0x5db40244,
+    0x22b669ee, 0x52d6d9cc, 0x4e5de8f2, 0x888542e1, 0x25d1d3ac, 0x6b3304a4,
+    0x2db1d05a, 0x1e2d4736, 0x8e069980, 0x02a1a576, 0x6f58d48e, 0x2f603f1c,
+    0xdee276ad, 0x4721a459, 0x25645395, 0x2f12e136, 0xb14392f1, 0x148aa029,
+    0xbfec93a2, 0x72b95ce8, 0x2e97cbe5, 0xe572b95c, 0x070397cb, 0x2c2d46b2,
+    0xd3993aea, 0x9bcd66d5, 0x06a67436, 0x5e19c4e1, 0x3d13b0c0, 0xfa648d41,
+    0x66d507f7, 0x69369bcd, 0xab13818b, 0xa5ac981a, 0xf26df862, 0xda8ce7fb,
+    0x4bf2680c, 0x5257cee8, 0xb590ba72, 0xa69cb1d5, 0xab30f69f, 0x99451398,
+    0x52e33af7, 0x20810ac4, 0x03c6e742, 0x2a4a6524, 0x98520303, 0x494c3f9f,
+    0xcf278723, 0xb0b690dd, 0x7c6573a0, 0xfb878591, 0x12b95e7f, 0x11a4640e,
+    0x98a12f7e, 0x3b309f1a, 0x15009403, 0x25809a40, 0x7c1b97c6, 0x69016963,
+    0x4f98bd38, 0x7d01b0c2, 0xd29d95e4, 0xa788969f, 0xdca4e979, 0x6a15ceed,
+    0xefeaf198, 0x05ee4cfc, 0x4d397154, 0x39671073, 0x3b4b0ed1, 0xd8eaee41,
+    0x0d793afe, 0x54b6d81d, 0x04c69ab2, 0x4c57c3a5, 0x32695b3c, 0xe3bd3a8f,
+    0xc9c801f0, 0x0e88d601, 0x003354ab, 0x1ad4c155, 0x66884ff7, 0x8b61c489,
+    0x40446688, 0x1bc06ac4, 0xd4bb8d70, 0x29160055, 0x238fe149, 0xc5456414,
+    0x70b410c5, 0x345ec63c, 0xc1b037b3, 0x99ceab85, 0x68e84b72, 0x7503216a,
+    0x16510a58, 0xb1bcd952, 0x1f447f0a, 0xb6660aba, 0x9cf8d3e9, 0x75e5a4ae,
+    0x39a92b27, 0xeaca495d, 0x7252574e, 0xd49593ba, 0xe5a4ae9c, 0xa92b2775,
+    0xe35db518, 0x5f8e7dd1, 0xc7bb7510, 0xe7fcc76c, 0x4ed120f9, 0xe1860720,
+    0x0da7290b, 0x18b4f9bb, 0x33c1dc90, 0xb0ba5304, 0xaa9ae18f, 0xb1377d50,
+    0x6089d575, 0xe6c460a9, 0x1625f20c, 0x70faf01b, 0x69724412, 0x2b0d1c61,
+    0x9a68a38d, 0xe200ff61, 0x04d6f603, 0x80c0133b, 0x32779836, 0x58693c02,
+    0x82c6283f, 0x3e60f755, 0x98cebec7, 0xca6ceec3, 0x8d123a36, 0x9c42848e,
+    0x03c43e1a, 0x0d467179, 0xeaa96b12, 0x07f0c750, 0x446b41dd, 0x215c33c8,
+    0x406abc81, 0xcccd0698, 0x5b3a0226, 0x55f65c5d, 0x4be93ec7, 0x25234ee0,
+    0xa38f3448, 0xae743612, 0xfaf7a8b5, 0xac597a59, 0x1fc5d83d, 0x5d74496a,
+    0xd1ac6ef0, 0xb2c6cccf, 0xc9d4891e, 0x4539027f, 0xfa320181, 0x85e52058,
+    0xb5b02dba, 0xcf30c94b, 0x4fb758a1, 0x8900ff68, 0x5ce3850e, 0xf37df949,
+    0x30e86dc6, 0x5f3ecf5a, 0x966f4434, 0xb4b60679, 0x95b2f356, 0xfe5c6553,
+    0x5515ebb7, 0x43db1125, 0x66c38b72, 0x1642a78f, 0x5b69cadf, 0xe96ade97,
+    0xc0c3bba3, 0x24987e32, 0x9784f851, 0x6278d04f, 0x7821edc9, 0xe0cb325f,
+    0x610df15f, 0x6f2ee4b8, 0xe762e822, 0x07bef6ed, 0x9a743ed1, 0xd7376b98,
+    0x8506535b, 0x5c74e04a, 0x152a4980, 0x33a7cbe2, 0x2e118b0d, 0x8bfa5e30,
+    0xc5a56e9a, 0x5dbf8759, 0x2725f7e0, 0x4929a346, 0x7eaac3e4, 0x4b4876eb,
+    0x00ce20c1, 0x26ca2ca0, 0xb40088e2, 0x7c82b441, 0xa387fc32, 0x010fcb1a,
+    0x0e817c32, 0x42a87b99, 0x914a1127, 0xc284e9ab, 0x93ea059f, 0x873535c5,
+    0xa19cc795, 0x451e4a9f, 0x703f461d, 0xeb72c86a, 0xda1a315e, 0x3fa48aa6,
+    0xc78b360a, 0x47fa1520, 0x942e2fe2, 0xe14005ef, 0xa6b1b3af, 0x8b579de6,
+    0x80010820, 0xdbc36850, 0x1dfe2cf1, 0x32bf5c5c, 0x00ff4854, 0x66265c21,
+    0xd6b6ca3b, 0x60244085, 0xb3817cb1, 0x531ae593, 0xbbd02c56, 0x9b85c079,
+    0x8a7fab10, 0x0c98b08c, 0x84a890c9, 0xe162718b, 0x84b59113, 0xd725fa5e,
+    0x3d4db0ea, 0x6e785f15, 0xfcd3a7e7, 0xa7dc6318, 0xc2d05921, 0xe8a9057d,
+    0xac74028f, 0x39205a58, 0x2d24029b, 0xdb4f9ce9, 0xae96c6d9, 0x2e16011c,
+    0xbb913080, 0x7e85fd27, 0x20507ca3, 0x50a12628, 0x79ea8613, 0x6ef235c6,
+    0x2a6f0c02, 0x695d0bde, 0x4434872e, 0x05efbede, 0xae58b8f1, 0x199e0526,
+    0x0152c92b, 0xef03712f, 0xb184c682, 0xdf60797e, 0x92d02938, 0x347b202d,
+    0xa8c0491e, 0xcdb3da40, 0xe0a41af2, 0xb5b22011, 0x8c074170, 0x6f324e1a,
+    0x3feada2c, 0xcbd471c1, 0x0e52d2c7, 0xe70a3931, 0xbd06be96, 0x71d2d399,
+    0xa368fc15, 0xc0417090, 0x22a41997, 0x054a2b87, 0x9737c155, 0xde663cdf,
+    0x23e10b83, 0xffab3786, 0x9943cc00, 0xa10a6182, 0xcc5fa59d, 0x26a3bf50,
+    0x6432994c, 0x4c2693c9, 0xc9643299, 0x40202593, 0x4a0bd0a0, 0x0db81ac2,
+    0x121ec405, 0x05694f8d, 0x07226c11, 0xd1272a3a, 0x0883c8d4, 0x0f3ca288,
+    0x06e17bc8, 0x504589e8, 0xc7a8b923, 0x156cf55f, 0x91e81fdc, 0x1a8d46a3,
+    0xa3d16834, 0x341a8d46, 0x000bd868, 0x80240056, 0x00054003, 0x0281407f,
+    0x20100804, 0x04028140, 0x7d211008, 0xc79ed65a, 0x4020d4d3, 0xe9140281,
+    0x88be6e21, 0x41402010, 0x2dd0823a, 0xc0a9c120, 0x260f4d18, 0x20a0d701,
+    0x47c43e08, 0x8709c403, 0x80251a00, 0xb36c2c69, 0xbe2f6f82, 0x41a1cd78,
+    0x68bf9803, 0xb4a79e9c, 0xce43f4b2, 0x88fb99bb, 0x3e47c846, 0x4ca004ca,
+    0x6881afd0, 0x826a51e0, 0x836a65d0, 0x5ca9c42c, 0xb4d26a30, 0x61566d59,
+    0x148ac625, 0x0b2d245a, 0xb42f7443, 0x6b668139, 0x65b3a0e8, 0x3891e59c,
+    0x29af189a, 0xdd1eeb09, 0xff543b57, 0x7e0f3800, 0xc8aa384d, 0x22f403c4,
+    0x4f3d390c, 0x47430268, 0x42116eb3, 0xe688143c, 0x03df9a31, 0xfa43ad52,
+    0x9bcd6693, 0xb3d96c36, 0x369bcd66, 0x66b3d96c, 0xab2e2fcd, 0x7aaf912e,
+    0x59682d12, 0x613796f5, 0x14e51924, 0x404170d1, 0x5501402a, 0xab32005a,
+    0xc9b13280, 0x5c6aa3be, 0xfd2b6f3e, 0xcd66b349, 0xd96c369b, 0x9bcd66b3,
+    0xb3d96c36, 0xbdb1cd66, 0x79af9407, 0xac0c3da1, 0x75547525, 0xa1e42f4a,
+    0x00c1e427, 0xb1b4c06c, 0x0deb361b, 0xef172e03, 0x9eefcb13, 0x10486f33,
+    0x5a00e43b, 0x94594a1f, 0x45d15d50, 0x70d9da61, 0x905ec2e1, 0xd7fc0e23,
+    0x8dab1715, 0xdaf48245, 0x1b80af8c, 0x0620af13, 0xac65c498, 0xeb3efa9c,
+    0x2ff400ff, 0x2263d3f6, 0xa927d1c5, 0x69612529, 0xe0e032e8, 0xb59e34c8,
+    0x95524a29, 0x52f8cc80, 0x4470421c, 0x0ddcce0a, 0xb7a709ab, 0x2295c751,
+    0xf50c0c77, 0x6585bbba, 0x4aae4411, 0x9e138023, 0xca6eebdc, 0x5b2b2c0c,
+    0x583771ec, 0xaa9041fc, 0xbb1bae2b, 0x634427f0, 0x124d69a9, 0x4f4de115,
+    0x94528a5a, 0x55b019a5, 0xd8a0e864, 0x5910af80, 0x6f1c2bcc, 0x8b7b2274,
+    0x17072a1f, 0x165a36a2, 0x25aa52f1, 0x49c954f1, 0xaccb38fe, 0x26085cbc,
+    0x55bafed6, 0x474b1bbf, 0x4b715d64, 0x9e6f8095, 0xdb49551b, 0x398f12ae,
+    0x5f97389b, 0x6ba004f2, 0x00ea2aaf, 0x12046b1b, 0x51849c8f, 0x13300286,
+    0x669f3e6b, 0x52f977cd, 0x8568b825, 0x88a66e23, 0x2d699e0a, 0x058aae38,
+    0x9a708536, 0xbb2d55b2, 0x94bb4289, 0x750c95c4, 0x07cfe900, 0xadb739c8,
+    0xa1cf832e, 0x0c64d082, 0x68fca2e0, 0x7d3b4650, 0x8c2e831d, 0x30252a3a,
+    0x35472812, 0x29b5cab9, 0x2fa9ad6d, 0x1ca054da, 0x2f04ab14, 0x32109a5b,
+    0xf055a38d, 0xefcb7f16, 0x486f339e, 0xfc563210, 0x5e381c25, 0x42ebcf67,
+    0x9f8da30e, 0x2c937ca1, 0xf2a756c9, 0x37d784c3, 0xc513cd76, 0xad1d400b,
+    0x063fa39a, 0xd02c1ece, 0x0cf45768, 0x03932df8, 0x89a6eb02, 0x737ecad4,
+    0x3be7a7bc, 0xbc737eca, 0xca3be7a7, 0xa7bc737e, 0x7eca3be7, 0x4c0cbc73,
+    0x0c021ec4, 0x07d0b021, 0x1faf67e2, 0x7574e59e, 0x8dd782eb, 0x593209d4,
+    0x4a742314, 0xb400ff34, 0x0c000a2e, 0xd497a3c0, 0x3c3a9543, 0x20bce464,
+    0xe55d81a6, 0x78ea9209, 0x8c419639, 0x634db30e, 0x1b644221, 0xf353280a,
+    0x393fe59d, 0x9df353de, 0xde393fe5, 0xe59df353, 0x19de393f, 0xbc1c2534,
+    0x9037dbef, 0xfb4896f0, 0x5c6096dc, 0xe7a754fb, 0x737eca3b, 0xe8290dbc,
+    0x51a79a36, 0x784ade40, 0xc335460a, 0xe58b087c, 0xf2426897, 0xd463d77e,
+    0xdee275d0, 0x82112efb, 0x44b3d925, 0x90803a95, 0x21d0a860, 0x8eb2b5e6,
+    0x64f6483d, 0xc26896e4, 0x1d98b6b9, 0xa7b4445b, 0x9b1683d9, 0x00c3dfba,
+    0xeb4670b3, 0x619d03aa, 0xb6d2c0ea, 0x9af7d44e, 0xdc4a9de8, 0xaedaa75b,
+    0x3401f8e5, 0xf713b842, 0xbeee49e6, 0xde39eb03, 0x00e18815, 0x90ea1542,
+    0x2d6671a6, 0xc1a22486, 0xf27c3e53, 0xed469ab3, 0x21adc280, 0x3fe5fc66,
+    0xf353de39, 0x054ce59d, 0x690936b6, 0xf44697d6, 0xffd9c4ed, 0x78be2f00,
+    0x1a20a1cd, 0x5900ffcd, 0x68c7be73, 0x864bcfcd, 0xa11c5548, 0x2a34b041,
+    0x4e457005, 0x0a20ec20, 0x870a0034, 0x48c8e044, 0x1410a863, 0x8002fa2a,
+    0x86ad162f, 0x75681065, 0x5aa440b4, 0xaec6765d, 0x869c4558, 0xaa9b4a47,
+    0x37abea6e, 0x78b756a5, 0x495ceca9, 0x8a6aedbe, 0xf09a1419, 0x1b4090c6,
+    0x7f31fbe0, 0x994213cd, 0x55216cec, 0x3fc6c648, 0x00f706a9, 0x91c0bf7b,
+    0xfea33a88, 0xa152ce46, 0x1c30ec7b, 0x65093da4, 0xe8f0a3e0, 0x446cad1f,
+    0x582c160b, 0xe5d162b1, 0xbbd01416, 0xd55e31af, 0x15243216, 0x857921ac,
+    0x1746c41e, 0x00d51d66, 0x02c0a82f, 0x5cfdb115, 0x997208f2, 0x82dcb6d9,
+    0xcae55cb6, 0x2feb5ceb, 0x01264a0d, 0x1c19131b, 0xaccc6194, 0xac1e3248,
+    0x46290ea3, 0xc5423dbd, 0x5f2c168b, 0xde00ffac, 0x72c78108, 0x20e6c8d5,
+    0xdf57fe73, 0x147658f0, 0x16b8cb12, 0x894f02dc, 0x8b74c35a, 0x98c28a45,
+    0xa34d8121, 0xab413909, 0x5c8445cd, 0x70444544, 0x5213d188, 0x8736a900,
+    0x1641ab5a, 0xba88bd80, 0xaf4eae6c, 0xc2d6c594, 0x517337ef, 0xf676f242,
+    0x7c66e669, 0xd97c4796, 0x53f3aa9c, 0x3172d82c, 0x0b96d260, 0x08585e4d,
+    0xaa018832, 0x1406d6a0, 0xbdcbc460, 0x6c64841c, 0xc41a3996, 0x1834c6be,
+    0xce366ce0, 0xb3ce614c, 0x63276777, 0x95867d36, 0xb7cbb4a1, 0xd9688c1c,
+    0x596af62c, 0xfaf6b197, 0xd1c0e40a, 0x00883d80, 0x69000824, 0x2d193139,
+    0x2527b3ac, 0x7ff7666e, 0x7917ce74, 0x892c88bb, 0xc39bed13, 0x169f23a3,
+    0x33f087d1, 0x556cae38, 0x086ad4a7, 0x85ad84bd, 0x009a5172, 0x489a6d24,
+    0x51a59551, 0x23f42e91, 0x19cff7e5, 0x5c42a9b7, 0xc69f4d72, 0xf588f2c2,
+    0xa503d8dc, 0xcc280ee0, 0xd0fe6d90, 0xc55933e7, 0x64ab2498, 0x497178b9,
+    0xe8c29654, 0x7852aa6c, 0x861bbc00, 0x6a3e5cd3, 0x7744e013, 0x720e6418,
+    0x85439693, 0x4533c55c, 0x22e060a1, 0x11dfc7ad, 0xa24e44e6, 0x9e469344,
+    0x0af6b2f0, 0xfd15e349, 0x282a5890, 0x4a51e888, 0x90f86b5d, 0x1cd3fc5a,
+    0xaad2b1b9, 0xe5501ab5, 0x0bbe18fe, 0x84ea0567, 0x55b90124, 0x7eabfb2a,
+    0xdfeff7ab, 0xf66533be, 0xe019788b, 0xac391153, 0xcdf3cf80, 0x4ef0e005,
+    0xbfda53ae, 0x3e806b37, 0x47e081b1, 0xad2d4c3b, 0x5a95192a, 0x4928dcb7,
+    0x6ab935b0, 0xd00672b9, 0x18e39983, 0x10ca0a59, 0xbced8a37, 0x5d73450a,
+    0x4da14ed4, 0xa98ae277, 0xcbfa7c96, 0xbfdfeff7, 0x44baea7c, 0x16008d16,
+    0x055ea3e5, 0x8e0288c6, 0xe7bf46a1, 0xebfbfda2, 0x38320f90, 0x0c62131d,
+    0x98d56011, 0x5db6e632, 0xb571dcbb, 0xede125da, 0x8ddc0f30, 0x49920f01,
+    0x410c0a6d, 0xfdb930cc, 0xb82d2820, 0x1a793853, 0x0203134f, 0x4bdfc305,
+    0xc058ab1e, 0x2b3ec5b9, 0x8286d3cd, 0x354ec643, 0x67aa264e, 0x3bc22b03,
+    0x4d4f4b75, 0x949db78c, 0x9aaf9520, 0x226f0036, 0x4132b73e, 0x321c039f,
+    0x392f9521, 0xfe0e7cd4, 0xa36af81e, 0x29a7778a, 0xe4f1fd7e, 0x0c080004,
+    0xb0075600, 0x47a6cd70, 0x339eefcb, 0xc9a91768, 0xe728a353, 0x6b0defd5,
+    0x71ea15f3, 0x088c9a37, 0x4532995a, 0x143e7719, 0x92e2f6ae, 0x5e02ac20,
+    0x24b34e38, 0x21d27f1e, 0x1b8572a5, 0x371884c0, 0x9908270a, 0x63b90ae5,
+    0xb346beea, 0x3ca79dbe, 0x1efc7a18, 0x66e12108, 0x28938603, 0xf80aac50,
+    0x5f4ed70e, 0x5aca8432, 0x954c433c, 0x4c57309b, 0x2b09333b, 0xe2b914bf,
+    0xeb60215f, 0x0d68883f, 0xa6d62306, 0x16115381, 0x03287913, 0x01a96bd9,
+    0x67677dee, 0x195fe03f, 0xa5dcdc4e, 0x02e45a54, 0xcaf8098c, 0xfeb8a036,
+    0xf0366041, 0xc736843a, 0x6b48d4b3, 0xa64aa9ac, 0xb24447c5, 0x69a9ec80,
+    0x2298487d, 0x88c78614, 0xa4e3c184, 0x16a28201, 0x6a608bd2, 0xe453cbe9,
+    0x79040caf, 0xc1e1e4d2, 0x72c4b9d6, 0x7bf9b353, 0x8ee4026c, 0x8d89ddc7,
+    0xbf460a4e, 0xc19f561b, 0x53d5723a, 0x3844c897, 0xf6dfe246, 0x15ac41af,
+    0x2f355f79, 0xafe742e8, 0xb5d2a0bd, 0xaded27f4, 0xec679269, 0x8d588215,
+    0x70a72a89, 0x55fc7313, 0xe1c4e3cc, 0xf3ae8384, 0xb5f26509, 0x14892460,
+    0x52307b2c, 0x9d352d9d, 0x874dc6eb, 0x3186e4e3, 0x85d419b9, 0xc365a4ca,
+    0x539953bd, 0xcb611658, 0x37193750, 0x787f2418, 0x77fe59f5, 0xab8b095d,
+    0x795aaf9c, 0x6dc6f37d, 0x76432c08, 0x23756e36, 0x18e0d11a, 0xd01ddb51,
+    0x65a647fb, 0xa32e1439, 0x6a638522, 0x21d28698, 0x252eb47a, 0x45238006,
+    0x2f53aca3, 0x23c845b0, 0x88e9fe33, 0x0693e9a5, 0x09d202c4, 0xf18c57d0,
+    0x001f4c43, 0x7685707e, 0x4205a00c, 0x30a26415, 0x30056606, 0x42074935,
+    0xd2764d78, 0x3a07591c, 0x9fbc279a, 0x2fbc9469, 0x08e8c2e0, 0xb3b13ed4,
+    0x2999f782, 0x00f16f85, 0xd1561fa3, 0x419246a3, 0xcc6fe18e, 0xc710ee08,
+    0x2d85d362, 0x842d05af, 0x28c51213, 0x0ae4e7eb, 0xbd77f167, 0x83e6b1c9,
+    0x7e408b08, 0x71473480, 0x80aeb5fa, 0x65f401d7, 0x488c79e8, 0x2e0f87dc,
+    0x17ae0c30, 0x156b114c, 0xe1d8e446, 0x1dd412a4, 0x3710b0d5, 0x02cc6b6c,
+    0x8018f9fb, 0x2c1a0b20, 0x34f5b67e, 0x43a3d168, 0x925cc956, 0xce523aaa,
+    0x02578309, 0x4e17b67e, 0xad36feb8, 0x07bd0b47, 0x4eb8d3d7, 0x16808779,
+    0xf18f69b0, 0x2eb518eb, 0xd317b107, 0x2c18041b, 0x4d5516cd, 0x0a4e244a,
+    0xa25dda89, 0x3acc38ab, 0x44f37058, 0x4e3241cf, 0x45a80a80, 0x8e362e2a,
+    0x1a1c165e, 0x847191ca, 0x19a52546, 0xa34c775f, 0xcdeeaafb, 0xf6918ee2,
+    0xe89989a2, 0x20668c89, 0x90c82a72, 0xfc9d95f4, 0xa9f8a0e7, 0x2d2ca652,
+    0xd8b23ecb, 0x64542484, 0x16139188, 0x382787f0, 0x47b4185b, 0x7c5f5e6a,
+    0x1b409bf1, 0x1b9ddd41, 0x9042081d, 0x4a0af836, 0xc88a4452, 0xa14517b5,
+    0x40482f9a, 0xa442c90a, 0xadb512b4, 0x2eb9d4e1, 0x10e01e5c, 0x76301d07,
+    0xb162f651, 0x75dcfa01, 0x5f6305b1, 0x67b65d01, 0xf6c38bfb, 0xb08fcc38,
+    0x1cd1314c, 0xfe940697, 0xe8eb4e8b, 0xde5222d2, 0x089ba32c, 0xac2c182d,
+    0x80a0d972, 0xf04187e4, 0x9a8ef641, 0xe4044cef, 0xd95cd433, 0x57ad8465,
+    0xc53f50f1, 0x57c1e899, 0x069b3792, 0x9e8df481, 0xf37ce7a5, 0x3a84faeb,
+    0x9aed59ad, 0xa032cdc9, 0xa71f9d56, 0x304c9312, 0x87594735, 0xc5e8a5a7,
+    0xc28beb14, 0x9540e000, 0x8f8e4be6, 0xa2093c2e, 0xfd37d8c6, 0x7f449fef,
+    0x917141f3, 0x6c29a316, 0xcda18acd, 0x372af378, 0x634164d6, 0x8954e395,
+    0x1e2f2b6c, 0x27f221c8, 0x44688cb1, 0x7fdbf200, 0x4dd96201, 0x5081b500,
+    0x43414117, 0x65371654, 0x1e2b80fc, 0x16835fa7, 0x466d0119, 0xc2a05643,
+    0x17811414, 0x08961403, 0xf0146dd3, 0x8da4e089, 0x0690ee36, 0x2c09f874,
+    0x09a89555, 0x5445ba77, 0x10b30846, 0xe0f27498, 0x85428f40, 0x5267a369,
+    0x08bab608, 0x618da706, 0x6f5629b1, 0x6e64c5d5, 0x74c28890, 0xc24076f1,
+    0xb794f7fb, 0xe3ca1fd9, 0x79d3b006, 0xa8525e36, 0xcb4ed33f, 0x951bd97b,
+    0x050875a4, 0x00d6136d, 0x0c8665c8, 0x679ed0c6, 0x502db804, 0x7b02f4d1,
+    0xe9b8bf39, 0xd2d1306a, 0x19cf8f03, 0xb22494d4, 0x1ce17af6, 0x8172a241,
+    0xf9291836, 0x4eee2596, 0xff78f820, 0x80914a00, 0xe67cebb8, 0xbf3019ab,
+    0x44d421f6, 0x32856fdc, 0xcbe5400d, 0x339eefcb, 0xe86f2168, 0x31674caf,
+    0x4508e5f0, 0x87eac4f3, 0x01ae530c, 0xc3624bd7, 0x35ea0292, 0x1fcda189,
+    0x25ed12a9, 0x40890980, 0x115c2086, 0x4a4e9f59, 0xcfcadeb1, 0x85c01ea2,
+    0xc1acd98d, 0x91560d39, 0x19dc14a9, 0xb3fcda08, 0xa36527a8, 0x3569c4a3,
+    0x48921e88, 0xc8c60e80, 0x443696b2, 0x309b928f, 0x5fcb9085, 0xd67da702,
+    0xab1eb307, 0x9a144932, 0x4307477c, 0xaf0a0e45, 0xad863ec4, 0x18f08f4b,
+    0x9d5ed22b, 0x43fc40cd, 0x7278a997, 0xa51f03b4, 0xcf675441, 0xdcf96e9f,
+    0x4c31e5b1, 0xbcd3dc3a, 0x4be2c470, 0x5081bac1, 0x8a03206b, 0x1e949eaf,
+    0x3f35ccf7, 0xa5b40a7f, 0xb6044e65, 0x178692b9, 0x28abee0d, 0xd635da31,
+    0xc2522a05, 0x824c5a91, 0xd254841e, 0x72a288ca, 0xb1d175bc, 0x0d9b842c,
+    0x5b6a0e04, 0x80dca1b7, 0x4502e230, 0x1602b080, 0x0100081b, 0x80060040,
+    0x3e9f8f7a, 0x62cef97c, 0xf0f9cd82, 0xcde2708e, 0xcb9312d8, 0x5bd09ef6,
+    0x8a5d45f5, 0xa2678366, 0x11b20537, 0x334324c6, 0x118bac94, 0x820b53d0,
+    0xd431769e, 0x0fc9a955, 0x53eb83da, 0x5959808a, 0x840d8060, 0x9b3af832,
+    0x99d109e3, 0xd8784336, 0x11ec57fd, 0xb8409048, 0x29bb2b7d, 0xb0e86766,
+    0x42eee053, 0xa851d53d, 0x35222f12, 0xb2245674, 0xf7721411, 0x597a8504,
+    0x83423410, 0x7156f35b, 0x99eb7601, 0x59a850d0, 0xee41364b, 0x62e67c18,
+    0x529ed372, 0x2ac450f5, 0xc528cc32, 0x942d620b, 0x0d417add, 0x14054369,
+    0x0a795a59, 0xb3b46a82, 0xcd7c277b, 0x003084e1, 0x812b10d8, 0x9c72a56d,
+    0xcfa4b864, 0xd488b249, 0x1ca7833f, 0x3691e09f, 0x30d6db9c, 0x5ed05b4c,
+    0xbe55c29d, 0x9e609d78, 0x9bf17c5f, 0x57cb9e7a, 0xc0e14ab0, 0x8bc5bfa2,
+    0x1252106a, 0x5a6ecb1a, 0x15578473, 0x98b85b6e, 0x1204031a, 0x075c922f,
+    0x91a2af3e, 0xc065ce96, 0x3035a10d, 0xe413051a, 0x8fd33973, 0x588c43ad,
+    0x56ec50b1, 0x5e6b51ea, 0x0f18b7b5, 0x1b15e645, 0x50916b53, 0xb4ca0015,
+    0x56d5ec06, 0x917b55d9, 0x490283b8, 0xb150ca74, 0x354921b3, 0xa886172a,
+    0x48226093, 0x440ab766, 0x6f4d280c, 0xce14950b, 0xa8936211, 0x7da8f54d,
+    0xc18b08a5, 0xf105fe6c, 0xea48268d, 0x64201a3d, 0x388a4865, 0xed01e20c,
+    0x2f0fadf4, 0x0d1d7168, 0x459d0d10, 0x2ec331d1, 0xe0fc0f46, 0xf4b077b9,
+    0xcca13551, 0x2c31a390, 0x6d864125, 0xe4412cef, 0x9016d314, 0xa26f3641,
+    0x0e1bfc6a, 0xf06a98c1, 0x206477d3, 0x7557120f, 0x1d216f97, 0x0289326b,
+    0xfc7f23fd, 0xa57a1b18, 0x19cff7e5, 0xb13df0b7, 0xdbc7f258, 0x8eac46c3,
+    0xe61ad1a1, 0x00ff5f6b, 0x82170461, 0x393d9474, 0xeaf650b0, 0xdbccb3f2,
+    0xc2b2629d, 0xa05696f5, 0xd1fad9d8, 0xda03a022, 0x066dd04a, 0xd2816bf7,
+    0xd2046b0d, 0xac39adca, 0xaa7861ae, 0xaec3ace2, 0x27a3e168, 0x78b6230f,
+    0x8c179c2d, 0x9bfd25e2, 0xbe6064fe, 0x22914884, 0x6eaad956, 0xd6c03b7a,
+    0x0b203646, 0x549e092a, 0x5cf8aaac, 0xd5dd3825, 0x5f98e218, 0x4036e3a1,
+    0x58e52622, 0xc6951078, 0x118b0ba5, 0xa06170a1, 0x3a3d53a2, 0x49885ecd,
+    0x99450acc, 0xd832f5b0, 0x2fe36fe7, 0xee9d19a5, 0x6db8c427, 0x2cc63473,
+    0x0c7af6bb, 0x1a04c461, 0xdce22e52, 0x458e1c01, 0x8944a2ea, 0xb1062712,
+    0xe28c880c, 0xedcf554b, 0xf7e5a57a, 0x56b419cf, 0xbf8ff36c, 0xdea9bf2d,
+    0x66f8d405, 0x8081ceca, 0x381c8ede, 0xf32e4270, 0x20e6d4ab, 0xc42045d3,
+    0xc728db6f, 0x0606f5cb, 0xc667e5da, 0x3e90b47a, 0xab81a366, 0xa3e82b6a,
+    0x460c0e87, 0x20150b88, 0x41222e37, 0x2d31fa84, 0xcea0c187, 0x4b170009,
+    0x5df42d41, 0x997631c0, 0x30ea40b9, 0x1edac91a, 0xadf7f5ea, 0xd4631171,
+    0x1af27367, 0x46634298, 0x288a38ca, 0x0e9ff1ca, 0x85bbb60a, 0xc0efe373,
+    0xf5531335, 0x8b179c8d, 0x1a06c536, 0x7aed721f, 0x6eb7dbed, 0x2077bbdd,
+    0xa1ea4367, 0x46c2457f, 0x3eb4fb04, 0x78db295c, 0x41157ce8, 0x3d283ce3,
+    0x4b282f07, 0xbce220e2, 0x1a6dde09, 0x1cfef4dc, 0xdd6eb920, 0xdbed76bb,
+    0xedb171b6, 0xc2dc3ecb, 0x8215b3bf, 0x2a6915af, 0x47998c55, 0xf9be3ca5,
+    0x56e236e3, 0xdeb458f9, 0x4159988d, 0x524838a5, 0x9a16d617, 0xd7a58c66,
+    0x08104ad4, 0x54866290, 0x0cd42858, 0xbbfd7e41, 0x340a9ce1, 0x59a21728,
+    0x3c9633a2, 0xb50184a6, 0x6d8d23c2, 0x251922f0, 0x45025c48, 0x05f34374,
+    0xd0f9a32b, 0xfb08a0d8, 0xc6d92a60, 0x6b254870, 0x4f271022, 0x343c10e6,
+    0x0a3d6248, 0x318942e4, 0xc608ec91, 0x432a3c2b, 0xc4c7c5cc, 0xe7d68415,
+    0x7a50b702, 0xc924a0c0, 0xa5e3fd1a, 0x046d6a1a, 0x0f4bab54, 0x18c27d10,
+    0xfd8c3f3c, 0x19fcae6b, 0xa1b172ca, 0x1f11e29c, 0x016e2a61, 0x7edfdf6e,
+    0x24080ace, 0xf0adfa28, 0x95169b5a, 0xf8b305cf, 0x7d3cc697, 0xb3a2ba92,
+    0x1eddd544, 0x95775b53, 0xdd584369, 0x37b7f69d, 0x400d2e9d, 0x0fb5e625,
+    0x367157e2, 0x1f286068, 0xc13696f8, 0x9eefcba7, 0x60256e33, 0xb09d8d61,
+    0xe3910da3, 0xdc004e89, 0x8fee029b, 0xe16f6486, 0x88459d55, 0x277d712f,
+    0x128112e2, 0xbe4a0955, 0xdc5b2b3e, 0xd2044bf5, 0x06477887, 0x1989382f,
+    0xe510377b, 0xe0f72989, 0xb08db768, 0xc4df194e, 0xcb834f88, 0x0308c355,
+    0xea986287, 0xfe184cc5, 0x731fc778, 0x860b10d4, 0xf0f00ab6, 0x49cbfc59,
+    0x4ca4866c, 0x067b48c5, 0xfa45bdc4, 0x905036f9, 0x8ce2a0e5, 0x730fc12d,
+    0xa17f607e, 0x715ad9ec, 0x3fb4286a, 0x72f3889e, 0x9fbcf46c, 0x48e511f9,
+    0xc5684030, 0x5db25690, 0xd982373b, 0x74e2a530, 0xeb7c55bb, 0x5db4c8d7,
+    0x652e9325, 0x30180c96, 0x3d6f5b60, 0xa441a372, 0x7b7b48e9, 0xa6de2c18,
+    0x24d902dd, 0xef86c422, 0xaf65157d, 0x9d1d31c6, 0xa34259c6, 0x27784846,
+    0xacc0709a, 0xb8f7a9c4, 0x4bc24455, 0x28e237c4, 0x539eb6cd, 0x5cd7d46d,
+    0x4701e36e, 0xcf804185, 0xa1a64548, 0xab7723a6, 0x30180c06, 0xbfa31d60,
+    0x5f9d2745, 0x065fd4ed, 0x78be2f9f, 0x20b4a2cd, 0xcabb4b07, 0x2f39ebce,
+    0x95e7581f, 0xb23cb90a, 0x8b85b0d5, 0x5198d284, 0xc8601aa3, 0x20078b39,
+    0x7e91833a, 0x754005f0, 0xfb6c1f0b, 0xa9c7bcb1, 0x08d3836b, 0x553452b8,
+    0xffe1a24f, 0x3f6c3800, 0xa3676a02, 0x5314ba64, 0xcd66b3d7, 0x426c369b,
+    0xcbf2db79, 0x88f8859a, 0xd38ac65a, 0x2ba5b2fe, 0xb607173a, 0x26c6983d,
+    0xb994cc45, 0x465d3813, 0x1662735c, 0xb63696a6, 0x232840b2, 0xcb900e60,
+    0x0a46202f, 0xd2a2318c, 0x932c0dd6, 0xa05b8d45, 0x8ed09f9b, 0x5957ced1,
+    0x5aa6c1a9, 0x78692d1c, 0x158ea6b9, 0x1bb454d7, 0x528a2ade, 0x0890f405,
+    0xf4099a26, 0x972183d8, 0x4bdadf28, 0x9d90c960, 0x18093857, 0xe12384f1,
+    0x3e78ef0d, 0x26232eb9, 0xa7f6846e, 0x48ceb712, 0xc49faf5c, 0x2d1f7da7,
+    0x0088c1ae, 0x91e42fec, 0x3e295da7, 0x525552f4, 0x24a89b73, 0x85c43271,
+    0x21d46276, 0x598b2657, 0xef9feb7f, 0x1d4649b6, 0xae568aab, 0xaebda290,
+    0xbe2fcf7b, 0xb4bfcd78, 0x47b6e0bd, 0x138a3f50, 0x2c5e2c2c, 0x0b21cbb2,
+    0xf52ff222, 0x86d2e263, 0x0c068351, 0x32e16336, 0x19334c47, 0xf7520106,
+    0x038b219e, 0xe23f6365, 0x14da83be, 0x3126d154, 0xb34435ca, 0xb2e17081,
+    0xc9643e1a, 0x7d9315d8, 0x660666ba, 0xb1d6a759, 0x9008e9c5, 0x9c0ab094,
+    0xde2cb095, 0xfb39872f, 0x84e78ef5, 0x16467b2f, 0x20603c33, 0x83026000,
+    0xc16030d2, 0xa400f980, 0x1df70180, 0xad4ea215, 0x1553c1dc, 0x0d1e59aa,
+    0x18bc391f, 0x3716db91, 0x166bf59f, 0x62b1582c, 0x2c168bc5, 0xc562b158,
+    0x592c168b, 0xbdac827d, 0x00ff4009, 0x9980867e, 0xf17c5f7e, 0xc052429b,
+    0xeaa20800, 0xaa5fdd29, 0x073ef3be, 0x7fe033fb, 0xfb073eb3, 0xb37fe033,
+    0x33fb073e, 0x3eb37fe0, 0xe033fb07, 0x073eb37f, 0x7fe033fb, 0xfb073eb3,
+    0xb37fe033, 0x33fb073e, 0x3eb37fe0, 0xe033fb07, 0x073eb37f, 0x7fe033fb,
+    0xfb073eb3, 0xb37fe033, 0x33fb073e, 0x3eb37fe0, 0xe033fb07, 0xa0dfb27f,
+    0x385a3987, 0xe7e82058, 0xfd63de30, 0xe41296b3, 0xfd11b845, 0xcfe7f351,
+    0xf97c3e9f, 0x9fcfe7f3, 0xf3f97c3e, 0xbfb7dfe7, 0x42fe02e1, 0x4e09dc10,
+    0x1ed24962, 0x215954c1, 0xc5256e1b, 0xc2080cb6, 0x77258fe9, 0x15ef4a9e,
+    0x9de92151, 0x1984ac9a, 0x1a0cd845, 0x640204bd, 0x07a57e9b, 0x798625b8,
+    0x84ac4c26, 0x82562545, 0xe442f434, 0x6783cc02, 0x4f4ebcc0, 0x20a2b21c,
+    0x5d0d6365, 0x2fce30ac, 0xaa808219, 0x98560112, 0x96169605, 0x8a3f076f,
+    0xe8da5388, 0x10c20d43, 0x2cec7639, 0x31413261, 0xe92b475c, 0xbb9605c5,
+    0xa9a5fe53, 0xa2ee6685, 0x18104875, 0x7d699dc5, 0xcae16e28, 0x54a12303,
+    0xa42365d9, 0xd12c5dd3, 0x3032d381, 0x45faa012, 0x8094a585, 0x999c92d9,
+    0xa0000631, 0xa2232222, 0x24fb4823, 0xe47957f2, 0x0884f1ae, 0x5addd1a0,
+    0x878a2314, 0x4b1091ad, 0x1688d61b, 0xa96cda8d, 0x5dd696d2, 0x3cab7ac5,
+    0x36e3f9be, 0x8227d3fe, 0x96f718d9, 0x848aab23, 0x571480a9, 0xb9224477,
+    0x8ad123f6, 0x6450e8ef, 0x323648c1, 0xe685a963, 0xc046d580, 0xb5a853f1,
+    0xb0c91688, 0x86dcc1f8, 0xd2f5002d, 0x17b8b526, 0x5ef1ca45, 0x40acbb2a,
+    0x300711c9, 0xe37be380, 0xdc7558a1, 0xaaf14101, 0xb892e1b2, 0x4d0cb06f,
+    0x26702f37, 0x845f1801, 0xe1432f04, 0x8a1994c0, 0x7310d2ea, 0xdfc381fb,
+    0x0d578340, 0x4c921610, 0x9d632b1d, 0x2c9008a7, 0xb889058c, 0x618da020,
+    0x921a2182, 0xd98f84e9, 0x7f084a5a, 0xe610c104, 0xb853724e, 0x63fe9c35,
+    0x76714d5f, 0x8b5ab0c3, 0x714d0c72, 0x5e62eafb, 0x041982ec, 0x7ea2bf66,
+    0xbf3c6a07, 0x1bfc32c9, 0x8d0ba99e, 0x152a724c, 0x4a6caf55, 0x0050af30,
+    0x141aa8c2, 0xd6230a00, 0xf05f4dd9, 0xb457f79c, 0xb8bdbae7, 0x92aece6d,
+    0xeb974409, 0x6aca00f8, 0xf86412b9, 0xc92f1571, 0xce1c9bd2, 0xc24f1662,
+    0xbaad8a8d, 0xb63dd033, 0x063e5c7f, 0xa4712f7d, 0x98f70a72, 0xecc43649,
+    0x0df7428b, 0xea41044c, 0x5e305625, 0x0a360855, 0xbab5628b, 0x234e0825,
+    0x4eacc675, 0x50948558, 0x14342849, 0x0b442d32, 0x60de5730, 0x20233873,
+    0x00e2536e, 0xd2a6e934, 0xa9f511ed, 0xee431194, 0x6c5a391b, 0x94e50431,
+    0x4c9d6f52, 0xe23a024f, 0x997f1d92, 0x3d374a26, 0xee39edd5, 0x75cf69af,
+    0xb031417b, 0x7f0d5b87, 0x3e6413ef, 0x9bf17c5f, 0xe6100b42, 0xa4cecdc2,
+    0x2ca973b3, 0x374beadc, 0xcecd923a, 0xa973b3a4, 0x4beadc2c, 0xcd923a37,
+    0x73b3a4ce, 0xeadc2ca9, 0x923a374b, 0xb3a4cecd, 0xdc2ca973, 0x3a374bea,
+    0xa4cecd92, 0x2ca973b3, 0x374beadc, 0xcecd923a, 0xa973b3a4, 0x4beadc2c,
+    0x1a913a37, 0x4036d687, 0x341ca55a, 0x52517ffc, 0x2b4c23f3, 0x57f4ae2a,
+    0xd7bf7661, 0xbd68a061, 0x87f488d6, 0xadd05715, 0xcc98aa70, 0x9c8eeb06,
+    0xe0bb4e03, 0x92c95bfb, 0x1bbed94e, 0x068ea714, 0xa1e68e95, 0x0e501538,
+    0xe102ef79, 0xa6810352, 0xb3805a80, 0x63e9b053, 0x8e1ae41b, 0x9640862b,
+    0x69c2299a, 0x41337352, 0x41b99f49, 0xeb1d0036, 0x368eb052, 0xebec4558,
+    0x95ac8ee1, 0x4a3a96fb, 0x2612a93b, 0x7ac23e2d, 0xcfaeb131, 0xce6e1c28,
+    0xc16ca36c, 0xf065cc92, 0x374c4793, 0x80a48940, 0xda7d2e99, 0x001c451e,
+    0x5c10134a, 0x84eaf313, 0x70a0c2f0, 0x040602c1, 0x1234b206, 0x3632ebc1,
+    0xfe2f8b36, 0x495986b5, 0x21051387, 0x07b18915, 0xbacab679, 0x31c423d8,
+    0x7d59fd7d, 0xd17259fd, 0xe222c46f, 0xbffc8451, 0x8170f6ad, 0x78e58172,
+    0x983358a9, 0x1bfae0b1, 0x458d0dde, 0x5344e613, 0xe408f38e, 0x4f5b70c5,
+    0x516f567f, 0x7a0e811b, 0x0c0e54e8, 0x18113ac7, 0x9df43b86, 0x17023362,
+    0x2a2d6535, 0xd62dde56, 0x50528a94, 0x78d84e89, 0x3859ed3d, 0x93ad3120,
+    0x3c6d09d3, 0xb9821fb9, 0x9298b451, 0x55a5845b, 0xd8461e51, 0x4a7613f1,
+    0x99f10460, 0x1a355272, 0x7236b53c, 0x52db2499, 0x3b4e5214, 0xfafbba6e,
+    0xb0fafbb2, 0x3abde6b0, 0x06366ce0, 0x8dc33397, 0x008010cb, 0x6a2d880a,
+    0xe6111a33, 0x9eefcb47, 0x70236833, 0x63a3f33b, 0xe8d828a1, 0x123a364a,
+    0xa3848e8d, 0xd828a163, 0x3a364ae8, 0x848e8d12, 0x28a163a3, 0x364ae8d8,
+    0x8e8d123a, 0xa163a384, 0x4ae8d828, 0x8d123a36, 0x63a3848e, 0xe8d828a1,
+    0x123a364a, 0xa3848e8d, 0xd828a163, 0x3a364ae8, 0x848e8d12, 0x0df49126,
+    0x202e5fc8, 0xe807e6d7, 0xde80cb2b, 0xbc6b8beb, 0x185c4480, 0x53104d21,
+    0x2b9696e8, 0xbae14c6c, 0x8ac589c4, 0x3f37979b, 0x8a0962a1, 0xb2a20905,
+    0x676ce17b, 0x9d22be69, 0xb9ca6b03, 0x6d5ac44a, 0x05d35dc1, 0x59221799,
+    0x8e3aeecc, 0x9196415a, 0x6a7b0aa2, 0x00404c5b, 0x02015600, 0xb660a5dd,
+    0x5881dde4, 0xbb02b608, 0x83cdbd0d, 0x7045d87a, 0xcb176db1, 0xebee635e,
+    0xa708502a, 0xc9853129, 0x0bb16b30, 0x54692d88, 0x5a103622, 0xcdd01d1f,
+    0x52abe11f, 0x1ec000ff, 0x965755c9, 0x214cfa98, 0x1d635889, 0x66e601c3,
+    0xa016a004, 0xffe4ea97, 0xc98dd900, 0xe9aee036, 0xfd99f385, 0xb515b58a,
+    0x8ab45ce5, 0x5be5b22a, 0x2a867757, 0x67cf79fc, 0xbec5d447, 0x1c60f512,
+    0x05cd16a8, 0xc6e58ef1, 0x36236802, 0x970b3601, 0xa2fb34a7, 0x4e1523d1,
+    0x028779a5, 0x6038a058, 0x9642e7e8, 0x5a042891, 0xec058141, 0x894ada79,
+    0x52f4c6d5, 0xa574068a, 0xae5b0b80, 0x886ef839, 0x44758e49, 0x8358b3b1,
+    0xbe174982, 0x26f83465, 0x4bc294bd, 0xeef227c1, 0x65937180, 0xdc169663,
+    0x0e211f8a, 0x6d645d59, 0x167b00ff, 0x7365c244, 0x4e180755, 0x3b0f287a,
+    0x5c0f180f, 0xb8f5616f, 0x9c1a4605, 0x6a38340a, 0xe2796f47, 0x61a4118e,
+    0x731c32a6, 0xbe65b6ed, 0x03cad147, 0xf5c69c57, 0x19b9626c, 0x22fdf928,
+    0x7684aca8, 0xafb1b4c4, 0x966880d4, 0xab49bb81, 0x328321cc, 0x05f86b71,
+    0xfbf24e60, 0xfbdb8ce7, 0x7263fe45, 0xbf9e4e64, 0xf4043190, 0x8d045178,
+    0xd96c369b, 0x6d72a980, 0xae58074d, 0xb4ccb2f0, 0x438cf425, 0xee7163a8,
+    0xe3e41798, 0x139fae10, 0x39fe5d6d, 0xfac1c259, 0x569e1f95, 0xc688c4b3,
+    0x7f3500c8, 0x4600fd27, 0x2035c834, 0x1d4ec2f0, 0xc5b97b67, 0x8550b7a8,
+    0x92a4f88f, 0x7021b538, 0x6c365b7f, 0x2f66b3d9, 0x19e8db0c, 0x83fe0656,
+    0x94a02340, 0x20cb2287, 0x52d9142c, 0x18704db4, 0x9bc81016, 0x3fdc61e8,
+    0x8056610d, 0xb974c0f9, 0xc3ac9cc5, 0xdf472e0e, 0x1660646a, 0xbd347a17,
+    0x667b4ddc, 0xf718e046, 0x806c3568, 0xe51d9844, 0x2bfeb9e4, 0x982b1a33,
+    0x5da251b3, 0x42a261dc, 0x3369ac1d, 0xde4abafb, 0xeb532b8a, 0x664c7382,
+    0x4d569c04, 0x24118b5c, 0xba933f2d, 0x8252912b, 0x75bbb504, 0xa4a29e7c,
+    0x9d561fe0, 0xade4fa2e, 0xec4d7080, 0xecb3f941, 0x21810964, 0x9d172c5e,
+    0x029ea447, 0x30f4bba2, 0xf066cff4, 0x1b33c1d7, 0x78e36a7a, 0x9fbf86b3,
+    0xc6f37d79, 0xa80c006d, 0x9f4d0b2d, 0x52574ee2, 0x9593ba72, 0xa4ae9cd4,
+    0x2b2775e5, 0x495d39a9, 0x574eeaca, 0x93ba7252, 0xae9cd495, 0x2775e5a4,
+    0x5d39a92b, 0x4eeaca49, 0xba725257, 0x9cd49593, 0x75e5a4ae, 0x39a92b27,
+    0xeaca495d, 0x0df5274d, 0xaecbaec9, 0x20378b09, 0x40d8420b, 0x4e955e92,
+    0xea9f5b0a, 0xf3655a00, 0x66b05460, 0xab6bb487, 0xb9dd5d46, 0x86923952,
+    0x7040150c, 0x34d539f1, 0xfeb01832, 0x1049b3f1, 0x3edf955a, 0xd7d12a06,
+    0x3217b428, 0x32c2bd6e, 0x3cb5c6c8, 0xbf93d47c, 0x268beb21, 0x7085993d,
+    0x0c045869, 0x189aedf5, 0x095a1d37, 0xa00a9468, 0x01015719, 0x8699f081,
+    0xd38b140e, 0xaafb7785, 0x9d76c462, 0xbcfb5395, 0xbb3feffe, 0xfbf3eecf,
+    0x3feffebc, 0xf3eecfbb, 0xeffebcfb, 0xeecfbb3f, 0xfebcfbf3, 0xcfbb3fef,
+    0xbcfbf3ee, 0xbb3feffe, 0xdef2eecf, 0xbb9fe4e1, 0xcf360fb9, 0xbd6c5aae,
+    0x47eb2ffa, 0xd39b12d2, 0x773a71c1, 0xe525718d, 0xb719cff7, 0xc63c92f6,
+    0xc41a4ee4, 0x040336da, 0xe31916c8, 0x6855d32b, 0xfe084961, 0xb7dbeda2,
+    0x76bbdd6e, 0x6eb7dbed, 0xed76bbdd, 0xfc1dafdb, 0xa94b2c8c, 0x5ca2b42a,
+    0x6f66d34d, 0xffd8ad57, 0x68808c00, 0x07f98f7e, 0xafe927f5, 0x25053ea7,
+    0x0d15d980, 0x02d23874, 0xb6167473, 0x6f3a816f, 0x166a38f2, 0x3cdf97bf,
+    0x8181d066, 0xf62e6da3, 0x00fff50e, 0x4575b625, 0xb64575b6, 0x75b64575,
+    0x4575b645, 0xb64575b6, 0x75b64575, 0x4575b645, 0xb64575b6, 0x75b64575,
+    0x4575b645, 0xb64575b6, 0x75b64575, 0x4575b645, 0xb64575b6, 0x75b64575,
+    0x4575b645, 0xb64575b6, 0x75b64575, 0xa33e6943, 0x43753172, 0xff4e3c66,
+    0x37910000, 0x6b04d03e, 0x2a0a65b5, 0x589ddbb2, 0x2d56e7b6, 0x6e8bd5b9,
+    0x9ddb6275, 0x56e7b658, 0x5279b115, 0x70b0c408, 0xb16210d9, 0xb4d6086c,
+    0xb7c5285b, 0xcd94b03a, 0x641ae698, 0xdb42a9f7, 0xe7b6589d, 0xd5b92d56,
+    0x62756e8b, 0xb6589ddb, 0xb92d56e7, 0x756e8bd5, 0x589ddb62, 0x2d56e7b6,
+    0xed84dbfe, 0x4a6d32b6, 0x0d402824, 0x0c6e0203, 0xe44b8c0b, 0x74705c62,
+    0xa7612162, 0xe3f158f8, 0x3c1e8fc7, 0x54a8896b, 0x4355a662, 0x2451995e,
+    0x02ca49e0, 0xcb4b1148, 0x9c288307, 0xf3f112fe, 0x1e8f5163, 0xe3f1783c,
+    0xbd6a5cc6, 0x600fb2f9, 0xd2356a54, 0x7bad6577, 0x12463bdb, 0xed6f5d06,
+    0x9eefcb93, 0x1eed6f33, 0x41c98df9, 0x0f3ac76d, 0x3c173cf5, 0x3c173c17,
+    0x3c173c17, 0x2d173c17, 0xc2dd18b0, 0x8408f3f3, 0x11379754, 0xa0dd53d1,
+    0xc998bfcc, 0x86631c60, 0x6a41d74f, 0x9d2b42b0, 0x09024bd0, 0xf62ae4ba,
+    0xe8239cab, 0x134c26c4, 0xcb94b1f3, 0x678b3491, 0x73c10f50, 0x73c173c1,
+    0x73c173c1, 0x70c173c1, 0xf5826453, 0x5e863249, 0xe900780a, 0x46955dc6,
+    0xbdad8bae, 0x2c168b45, 0x2356e159, 0xe33ccd5f, 0xb1cd5c94, 0x3338ab8c,
+    0x5b9335cd, 0xa944c29a, 0xde864584, 0x243a02c6, 0x45e29572, 0x03f7b0c3,
+    0x506d0e7d, 0x5ca9adaa, 0x8604e0c0, 0x9f7700ff, 0xe36432be, 0x174a4da8,
+    0xa2048b12, 0x1d71b230, 0x7e6d21ba, 0x27a8d015, 0x3adf00ff, 0xfd6083b1,
+    0x2c164b7a, 0x14d0b158, 0x411d0551, 0xa9863e2c, 0xf37df956, 0x19086dc6,
+    0xf7b1ef50, 0xf7b12fef, 0xf7b12fef, 0xf7b12fef, 0xf7b12fef, 0xf7b12fef,
+    0xf7b12fef, 0xf7b12fef, 0xf7b12fef, 0xf7b12fef, 0xf7b12fef, 0xf7b12fef,
+    0xf7b12fef, 0xf7b12fef, 0xf7b12fef, 0xf7b12fef, 0xf7b12fef, 0xf7b12fef,
+    0xf7b12fef, 0xf7b12fef, 0xf7b12fef, 0xf7b12fef, 0xf7b12fef, 0xf7b12fef,
+    0xff481fef, 0x38e7a600, 0x7d776baf, 0x3302e884, 0x94e89813, 0xbb29d1dd,
+    0x447753a2, 0x4d89eea6, 0xba9b12dd, 0x2a2f0a23, 0x9869815f, 0x96b2e7e7,
+    0x58a3010b, 0xce1a099a, 0x0a0eb798, 0x5f245917, 0x303587a8, 0xbe5470f4,
+    0x0e0200ae, 0x17c13db5, 0x5ec397cd, 0xdd4ced50, 0x27b28469, 0x6534034e,
+    0xd1dd3408, 0x53a2bb29, 0xeea64477, 0x12dd4d89, 0x3725ba9b, 0x6fae4574,
+    0xe92d08ae, 0x8a0980a0, 0x417521a0, 0x8403100a, 0x29603d1b, 0xb798042d,
+    0x773c0c4a, 0x4362fee9, 0x4bc90827, 0x119fae67, 0xb3e43ceb, 0x1e256c8c,
+    0xae24ee25, 0x21d265be, 0x5baa83c7, 0x1400f83a, 0x1a02aa38, 0xe3ca02e6,
+    0x1078ecb4, 0x12d3ba06, 0xf40c9baf, 0x69c794ca, 0xd2c57dd1, 0x614359d9,
+    0xf6cef927, 0xd20b48c1, 0x0ec19f35, 0xb442aa1a, 0xa8411433, 0xf17c5f1e,
+    0x4b687f9b, 0x62476ecc, 0x163255d0, 0x59f16a3a, 0xf0433006, 0x0f40d418,
+    0xabd56a49, 0x33724d43, 0x4a84c35c, 0x2c38ce20, 0x53089232, 0x3a230476,
+    0xe7a51f22, 0x5d5aab08, 0x6054f912, 0x64f26062, 0x300baacd, 0x032ac80a,
+    0x9b3260a9, 0x0cce9995, 0xc9a0a645, 0xec7f0cf5, 0x86551c08, 0x70924a2d,
+    0x6b84b3d2, 0x38a38c15, 0x2d25f244, 0x2924cc71, 0xfbaf5f01, 0xcce31bd3,
+    0x500bd48c, 0xc869a255, 0xfac814e8, 0x69b55a6d, 0x3d625bfd, 0x4a2877fb,
+    0x1394aa70, 0xa8045338, 0x9fa597aa, 0xfb36763e, 0x7840d70c, 0x5da90366,
+    0x50cf7722, 0xa13f2dcb, 0x20fc0e1f, 0x51016e20, 0x2cf71cee, 0x4d894d45,
+    0x7b7310d1, 0xa3206660, 0x33e96960, 0x0eac8cc7, 0x1edff733, 0xd42cc6d0,
+    0x77bdc300, 0xc6d62d74, 0xa590a204, 0x66d48fa0, 0x625bd27f, 0x1aceb007,
+    0xbe9f2b79, 0xbbe3c325, 0xbba71a46, 0x1829da93, 0x2c4c3aea, 0xa2c1e840,
+    0xafbdc261, 0xd0e0a209, 0x7b455bea, 0xef1e43ad, 0xe47c3ea3, 0x78d88dd3,
+    0xf4c2f46c, 0x7910a256, 0x6dc6f37d, 0x4801950e, 0xf77bdf3c, 0x2feb1eb7,
+    0xffd28ef2, 0x2fed2800, 0xffd28ef2, 0x2fed2800, 0xffd28ef2, 0x2fed2800,
+    0xffd28ef2, 0x2fed2800, 0xffd28ef2, 0x2fed2800, 0xffd28ef2, 0x2fed2800,
+    0xffd28ef2, 0x2fed2800, 0xffd28ef2, 0x2fed2800, 0xffd28ef2, 0x2fed2800,
+    0xffd28ef2, 0x2fed2800, 0xffd28ef2, 0x2fed2800, 0xffd28ef2, 0x1fed2800,
+    0x9473c3f8, 0xab020d62, 0xd0af0ea0, 0x8801b68c, 0x6bfb1c01, 0x465fb013,
+    0xe11f1e37, 0xb7f72d5e, 0xda87a80c, 0xb3e8a5b7, 0xa185c230, 0x0cfd7ef3,
+    0x1b500753, 0x8ba4aa85, 0x994e7d8a, 0x8caa1a1f, 0x9b59b48e, 0x2d5dbbd3,
+    0xe2c11317, 0x5eabde01, 0x0e78dfb4, 0x8e135438, 0x32422f0f, 0x446ca8b8,
+    0x15003884, 0xf41d1660, 0xa49145a2, 0x0200ffc2, 0xdd6b3ee6, 0x37beac4e,
+    0x7ededdd8, 0xa4cf181d, 0x9022820d, 0x81731a58, 0x04086ac9, 0x98101778,
+    0xb62856b5, 0x1a0a598b, 0xb15c81e3, 0x44993925, 0x5aa1af0b, 0xbb00df6f,
+    0x5c490d46, 0x6e1fc1af, 0xe53e0a2f, 0xf827bcf3, 0xc66f05aa, 0x35a00b52,
+    0x9d67836f, 0x46ec3a28, 0xce7285fd, 0x331826b5, 0xd07a8758, 0x9ba125a5,
+    0xe23e86ae, 0x23588044, 0x57743464, 0x72a2b760, 0x5db9ae91, 0x41dca842,
+    0x6ebfe24c, 0xc3b9f6b7, 0xe4869bc8, 0x98910c57, 0x369f60f3, 0xdad741cf,
+    0xb640cd8d, 0xdfd4cb9f, 0xc37afe40, 0x7b70a025, 0x5240ab05, 0x0240c202,
+    0x89b8880d, 0xa9894c84, 0xb8a7501a, 0x57e5066b, 0x79cabf7a, 0x6dc6f37d,
+    0x317fa6fd, 0x3c03c1b9, 0x27dcba32, 0x7138d25f, 0xca8fc7e3, 0x32ee97d1,
+    0x3aafae56, 0x08e156c5, 0x4c63b194, 0x898b355b, 0xd314b5b6, 0xd9c37ead,
+    0x833ab4a1, 0x0cc008c6, 0xc0068006, 0x30c52006, 0x242a2820, 0xc84515ba,
+    0x9db276ab, 0x8efbc40f, 0x64672a73, 0x9603ec6e, 0xb5ccb972, 0x5b4fe7b3,
+    0x487a6f13, 0x2a044ca8, 0x523914c9, 0x174a9782, 0xa9d752a4, 0xda430366,
+    0xa354c51e, 0xa549e197, 0x49c9298d, 0x78fa4c4e, 0x56c4e3f1, 0x8689ebd2,
+    0x481d3cd0, 0xb6ef0c76, 0xf021f594, 0x5f6875a8, 0x7c5c1275, 0x6b79e1cf,
+    0xab0310ae, 0x1cde264c, 0x2d6bd178, 0xb5d57a0b, 0x120ff57e, 0x6a2b09aa,
+    0x8ccbb500, 0x1c1541b1, 0x8e6c8222, 0x16afd152, 0x171cea21, 0x547b52b8,
+    0x2663fb44, 0x75c96be2, 0xab2dd515, 0x5fcfb55c, 0xc915a9df, 0x9b985aee,
+    0x296d0183, 0x5f4b115a, 0x3fea971c, 0x437b9c49, 0x9543a0e6, 0xa1886c7e,
+    0x1db5f0cc, 0xe9e6d08d, 0x650be5ca, 0x2039d1a2, 0xef324eab, 0xa0142803,
+    0x6bacb047, 0xa8f6d0d8, 0x46d5002d, 0x5594a2d0, 0xa12656dd, 0x74899162,
+    0x436151e4, 0x387ae845, 0x5763e3f1, 0x9837dfe4, 0x09721e11, 0x549ba875,
+    0x5745294f, 0x5f7e2b8f, 0x439bf17c, 0x9ddd900b, 0x70499d9b, 0x9a8e0c04,
+    0xc8b75488, 0xf052b45d, 0xcbda53b5, 0xdddacad3, 0x16d7d996, 0xd916d7d9,
+    0xd7d916d7, 0x16d7d916, 0xd916d7d9, 0xd7d916d7, 0x16d7d916, 0xd916d7d9,
+    0xd7d916d7, 0x16d7d916, 0xd916d7d9, 0xd7d916d7, 0x16d7d916, 0xd916d7d9,
+    0xd7d916d7, 0x08d7d916, 0x56238d06, 0xdfd69b2e, 0x2689fee7, 0x3fb5a334,
+    0xcd78be2f, 0xee800da0, 0xb05e2e40, 0x41bd26e9, 0xde03c288, 0x2d40ba46,
+    0x005a008a, 0x720efba3, 0xa09944ea, 0x176561d2, 0x305aa54a, 0x8028b2d2,
+    0xdd8efa6b, 0xdbed76bb, 0xbbdd6eb7, 0xb7dbed76, 0xddbbdd6e, 0xeb85deaf,
+    0xa506eba7, 0xfd13aa2d, 0x3498e42f, 0x90587bd1, 0xa10227a9, 0xa7c41633,
+    0x373554ab, 0x763ba7fa, 0x6eb7dbed, 0xed76bbdd, 0xdd6eb7db, 0xd9ed76bb,
+    0x2a3748c4, 0xd4a91618, 0x3d070300, 0x44402c2e, 0x0f9e3cba, 0x0f8115b2,
+    0x339eefcb, 0x250a006e, 0x4380f103, 0x656feaf6, 0x68971dca, 0x298d8491,
+    0xcb381a18, 0x4211341f, 0x7f9086a6, 0xd96c36ab, 0x9bcd66b3, 0xb3d96c36,
+    0x369bcd66, 0x9db5d96c, 0x6ee5b614, 0x26e58e10, 0x9fac6fb5, 0x046666e5,
+    0xbd4d1914, 0xb8c0e21d, 0xb50474fb, 0x80aa0050, 0xeb1b222e, 0xbea9621b,
+    0x4dbe8ef3, 0x4d2f9a01, 0xb2202eb5, 0xb2f400ff, 0x19597687, 0x0a135aeb,
+    0x41e3dfec, 0x74d84528, 0x1a15e09f, 0xd40f2125, 0x7082cbf0, 0xee4d1cd4,
+    0x45c501bd, 0x26c00833, 0xfc47deb3, 0xa784219c, 0xdc586e87, 0x7aa37597,
+    0xe01f1cc5, 0x222a2203, 0x00546c45, 0x3c8259a8, 0xe82151e9, 0x9c737235,
+    0x71374219, 0x41680217, 0x741d37be, 0xfc431065, 0x6879e569, 0x719b88d4,
+    0x52613fd4, 0xc6845119, 0xba1f805c, 0x172c0264, 0x248cc8eb, 0x0b70254e,
+    0x16b2ea5a, 0xd4033338, 0x6fded1db, 0xe905e4a8, 0x351683b2, 0x85824108,
+    0x114d4410, 0xc21126c2, 0x7c57c445, 0x716d49d6, 0x4f783fab, 0x84f713de,
+    0x783fe1fd, 0xf713de4f, 0xc7da7084, 0x51ae4058, 0x96865455, 0x0047184a,
+    0x0a8352ac, 0x3ab4acd6, 0x0106904e, 0xc06c1abf, 0x953e6191, 0xd56e7756,
+    0x90cc0e3a, 0xb25a8589, 0xe27cb5d6, 0x37ec6179, 0xb5364b29, 0x09ef275f,
+    0xf07ec2fb, 0xef27bc9f, 0x7ec2fb09, 0xb8478cf0, 0xa18900db, 0xa62a256b,
+    0x9fede2ca, 0x663cdf97, 0x528f45d0, 0x06ca9b15, 0x61db731d, 0x16d24b95,
+    0x0005abda, 0x5ca9d6e8, 0xa651a014, 0xa1e61a98, 0x3877a570, 0x778c8582,
+    0xbc0b0ad7, 0xda8aad9f, 0x017db200, 0xb28de37d, 0xa4ce8321, 0x98cffd28,
+    0xd9013b35, 0xcdef4f71, 0x92219630, 0x3a228696, 0x8642772b, 0xdfd80c84,
+    0x1f937c5d, 0xb664a22a, 0xac1234c1, 0x65800687, 0x8089d44d, 0x24b34a5e,
+    0x61ba2469, 0x388b4f23, 0xead8f165, 0x5c4d7dcc, 0x18891971, 0x316bf983,
+    0x73483ebc, 0x7570784c, 0x61a8514a, 0x7a297522, 0x2f7d7c91, 0x5e9a2ec2,
+    0xc566332a, 0x85b9177a, 0x82b69756, 0x42a43f51, 0x4253608e, 0x52354522,
+    0x59aa4611, 0x2262582c, 0x6b934a18, 0x7c9d6d19, 0x77b29f47, 0x4c303597,
+    0x08bc6d35, 0x4123644f, 0x3a60671b, 0xaa8c0c21, 0xad719617, 0xed5a4c6d,
+    0xf291af15, 0x2877aa11, 0x9a27f864, 0x4aab41c7, 0xac3d6610, 0x8fd6ef7e,
+    0xdb86a10f, 0x51ae76f0, 0x772a0025, 0x92b7de64, 0x9835f623, 0x9d09ec27,
+    0x95e0d394, 0xb5d500ff, 0xdbc94f14, 0x775fa16b, 0xcdd46a41, 0x081a8ce0,
+    0xa1812947, 0x76c6c80e, 0xf09c6da1, 0x2d28e0a4, 0xa162069e, 0xf8f788a1,
+    0x2c3c9aef, 0xd8210345, 0x902428a0, 0x9e8c1310, 0x0a523a7c, 0x6ef50d19,
+    0x3037cf52, 0x29defa4a, 0xd4da0de4, 0x3e305118, 0x51dec9fe, 0xe108d869,
+    0x24b130cb, 0x7bd02785, 0xed7b0ece, 0x15fa552e, 0x54950820, 0x258d3d86,
+    0x6f696fbf, 0xf65bdadb, 0xbdfd96f6, 0x696fbfa5, 0x24dadb6f, 0x062d942d,
+    0x0b2cf65a, 0x5c47b27d, 0xb49b13f9, 0x0566130e, 0x3e9d23e0, 0xfaceb74a,
+    0xd4c2eac2, 0x854ea5b0, 0x3bcfd0c1, 0xfad275b9, 0x4e139062, 0xab3c1a53,
+    0xcc731179, 0x72dcc92e, 0x6c5085d8, 0xc697042b, 0xdb40a9c5, 0xfd96f6f6,
+    0x6fbfa5bd, 0xdadb6f69, 0x96f6f65b, 0xbfa5bdfd, 0x689f686f, 0x45bd37f1,
+    0xa5908301, 0x2c5f988e, 0x7cac5e9a, 0x36e3f9be, 0x3ca9d7e0, 0xd5721958,
+    0xa7690fdd, 0x7eca3be7, 0xa841bc73, 0x7226bfea, 0x9270ea5f, 0x5895e0ce,
+    0xf5935258, 0xc34e8a33, 0x03ce3b1a, 0x8151d118, 0x20474672, 0xef454015,
+    0x149942c8, 0xf72b9c43, 0x202ea765, 0xe0c1fad9, 0x5b141175, 0x319d4593,
+    0xda2e2757, 0x54114d1d, 0x3028e512, 0x32c89c29, 0xb1c4d245, 0x81da74e6,
+    0x1d270519, 0x1782b160, 0xab0350d1, 0x8fbb38b9, 0x33bada90, 0x53660bf0,
+    0x1420109d, 0xbb0a0a90, 0x925c6f60, 0x40242d90, 0xd11a2ae3, 0x0177e07f,
+    0x4db25e87, 0xcd40c9fb, 0x6277decb, 0x27cdaaf0, 0x8ca10c9d, 0x9fde13cd,
+    0x3c0cef9c, 0x77f11200, 0x3e17c1e7, 0xd9042be6, 0x9815815b, 0x62b1ce5e,
+    0xd583595c, 0x91482412, 0x3f171522, 0x306a80ba, 0x1b015701, 0x9642832d,
+    0x5822a203, 0x58abdc58, 0x4f771f4d, 0x9aeee97b, 0xd7becebe, 0x7d0cd9d7,
+    0xd1679d09, 0xfdfae41e, 0x72d52f7b, 0xff442dea, 0x22918100, 0x24128944,
+    0x65490c47, 0x9f6ecf7e, 0x94182590, 0xd6042163, 0x0eb2c402, 0x0835eee9,
+    0xf3f73978, 0xc1603030, 0x180c0683, 0xd0c16030, 0x2a17edef, 0x57a2c190,
+    0x1d828ae5, 0xb4fe7bec, 0x83c16040, 0x79110f06, 0xc166727e, 0x748526ab,
+    0x512e90ad, 0x55dc2a21, 0x3c8ba06e, 0x36e3f9be, 0x691c0180, 0x7d7bee97,
+    0x4c912b63, 0xfcbb2db1, 0xbf1dc217, 0x211e9ee3, 0xa0b08032, 0xf1dda260,
+    0x0ba799ab, 0xc06a01c2, 0x6941e122, 0x1b15594c, 0x552a9a65, 0x55b11295,
+    0x20028855, 0x6d2bc9ee, 0x6cb975b3, 0x5cf7accb, 0xb9521432, 0x584184a1,
+    0xa64103a8, 0x72696b81, 0x163555f5, 0x050896d3, 0x858b00ab, 0x6431a505,
+    0xee682a5d, 0x26588222, 0xc5304b1a, 0xae82408a, 0x7202469b, 0x14ed4b83,
+    0x38001100, 0x84895044, 0xde48ca70, 0x2b4c8b02, 0xad76612b, 0x18171fe6,
+    0x94d880d1, 0x0b034c18, 0x684f1b79, 0x4a734113, 0xc45caea5, 0xd8c09674,
+    0x32f106bb, 0xc606d6e3, 0xc281dcd2, 0x15482064, 0x05286686, 0xa3b560a8,
+    0x0a2a1404, 0x09165110, 0x30d59083, 0x2a842ce2, 0xd46a372b, 0xdb05ddb6,
+    0x800004bc, 0x00030800, 0x38340005, 0xf0784f5e, 0xcd86f82f, 0xf8b24b60,
+    0xa66db7cb, 0x9c3561a7, 0x115df54c, 0xc2a6fbbb, 0x569455b2, 0x9ccf44dd,
+    0xbdbd4ac5, 0x2d1420cb, 0x071ccd93, 0xec673dbb, 0x29b7cc19, 0xcc7d3026,
+    0x6d228014, 0x1c83be4b, 0x690a9075, 0x68337fba, 0x1ef5621b, 0x5dec951c,
+    0x4b97b0cd, 0xc8928b4c, 0xdeccfdb1, 0x2904caa2, 0xbc2df352, 0x8a7e1213,
+    0x317f8a24, 0xdde6a285, 0xe44f72ea, 0x5776103b, 0x91bd3d35, 0x713b8150,
+    0x0903a364, 0x8030596a, 0x5d8d6c29, 0x5adcd651, 0xe52ec85f, 0x64e00656,
+    0x788266d1, 0x71742261, 0x5feb56c6, 0xbb033f03, 0x67a27590, 0xa2e48b08,
+    0xe9a853d8, 0x07d53039, 0x9345c7df, 0x00121129, 0x0a200205, 0x44444004,
+    0xc4f34d1f, 0xc025f9a6, 0xa83c0fc4, 0xc6f37d79, 0xf165e86d, 0x5c545561,
+    0xaeeeeaaa, 0xeff79b5e, 0x8b7da2df, 0x8702194a, 0x868a3a56, 0x21b8a173,
+    0x2b9240d6, 0x52351242, 0x169c9b96, 0xea6a525b, 0x1129a2fb, 0xc9f871dd,
+    0x90b9af43, 0x0827e8f8, 0xfe7c87f4, 0x0c8f7cc7, 0x598b3d1c, 0xc5a83cb4,
+    0xa01db642, 0x92abe4f6, 0xfb4a7791, 0x051273e3, 0xaf7aac06, 0xfd7ebfdf,
+    0x10eb8af1, 0x5a00b45b, 0x755546ab, 0xff65af78, 0x220e7500, 0x220265f1,
+    0xf3f9bc3e, 0xa19dcfe7, 0x98a90c90, 0xdd9500ff, 0x075c174c, 0x54716720,
+    0xf61e6e45, 0x2e9dc48a, 0x6db29862, 0xb2e7a73d, 0x1880c6ef, 0xaa31e408,
+    0xd8f813c6, 0x505c2813, 0xef2c7682, 0x37527a28, 0x4c31e5d8, 0xe733827f,
+    0x7c3e9fcf, 0x45d3a8ea, 0x296461de, 0x60fa2216, 0x0ac05721, 0x850f8ce4,
+    0x7b1f249b, 0x76985c0d, 0xd50e5aac, 0x09693adb, 0xa44360dd, 0xd9aa5518,
+    0x10a5a20e, 0x1189821c, 0x55847a8a, 0x88828878, 0x9bcc84ee, 0x45404ad6,
+    0x75330175, 0x93d16521, 0x0d4c4a02, 0x0ee7c2a4, 0x380ab41e, 0x487ed360,
+    0xa8e1f5c0, 0x48d60087, 0xa94b0881, 0x4192aa03, 0x515e200d, 0xe0133b36,
+    0x34264671, 0x0382e9ec, 0x407ac5da, 0x1af9fe26, 0x8e00a37b, 0x8201c010,
+    0x9eeffa0a, 0xefcb17d9, 0x7068339e, 0x7de5c1c0, 0x18e7d8db, 0xbfb01968,
+    0x6ed8f574, 0xf5b1d69a, 0xa44ead8a, 0x5bcb6d51, 0xd39d0a2d, 0x5862a0d6,
+    0x55196ec7, 0xc1597d1a, 0x9fed091e, 0x9f673d01, 0x19864343, 0x91bedce1,
+    0x5496c78c, 0xb11918aa, 0x2071bf24, 0x2404df76, 0x205dd51b, 0xa9efccec,
+    0xa9638847, 0x23e5916e, 0x7fc482e0, 0x441696c4, 0x0637af2e, 0xceec983f,
+    0x2d3d88d8, 0xdd6eb7db, 0xc288d04d, 0xc02bf5e1, 0x7a195a85, 0x484838c2,
+    0xf2232ac2, 0xcbedb4c1, 0x141605a6, 0xfafc32f6, 0xafdb4604, 0x3bb4985a,
+    0x8ee2e07a, 0x2ad55703, 0x8b8733fd, 0x4a6767e2, 0x009e0c20, 0x7bec7e72,
+    0x7a153835, 0x3f05253d, 0x72ccfa62, 0xbbddd804, 0x85dbed76, 0x52118e2d,
+    0x2189720d, 0x403080eb, 0x51285394, 0xc3026441, 0x7d028c1b, 0x11217f57,
+    0x50758846, 0x24c7f7be, 0x02147475, 0x450c6988, 0xf9b2d035, 0x3885263c,
+    0x001038b9, 0x6b234caf, 0xb0171934, 0x28f8b398, 0x1494e562, 0x10402eb0,
+    0x6c598b2f, 0x14176aa2, 0x027d7c03, 0xa7d087bf, 0x2834abd9, 0xdf264552,
+    0xb500d43c, 0x502048e7, 0xf97ee132, 0xe3f9be3c, 0x4c92e236, 0xd9ebcbaf,
+    0x82ae68bb, 0xb95c2eb3, 0xb1f2e572, 0x7ba5c35e, 0x095fc54a, 0x8205117a,
+    0x05324b85, 0xfb2a7050, 0x1e5266cd, 0xc81e08d8, 0x53c00614, 0xb9109a49,
+    0x2da0d541, 0x286b61f7, 0xaad68eaa, 0xcb755fb3, 0x58442aef, 0x1cb4b02c,
+    0xd1822aa8, 0x00036b6d, 0xda021002, 0x19510286, 0x1ab09ccb, 0xad02c0a2,
+    0xb1b1b0a2, 0x7dbbdb96, 0x97cbe572, 0xc8585a2e, 0x0a3afc51, 0xf195e825,
+    0x791740af, 0x1a4e2f09, 0x4d086c15, 0x1e7c81c0, 0xa4674b10, 0xfa4aa20c,
+    0x0d5b2a0c, 0xb03846aa, 0x231c49ce, 0x4ab862e6, 0x44c1973e, 0x00ff9274,
+    0x019a765c, 0x8ff7e525, 0x1100f554, 0xb3aa8c48, 0x160f79aa, 0xe8d50954,
+    0xde519c3f, 0x68b30387, 0x189c3f06, 0x913b0102, 0x0a27ed29, 0xcb9c2665,
+    0xf9b59f3c, 0x6191250f, 0x34c2aaf9, 0x6da5165c, 0xe50bca08, 0x7053c76b,
+    0x5ac5c8d1, 0xee913ab7, 0xae11d0b4, 0x087af584, 0xc4e4a96a, 0xb08a0452,
+    0xc8b83101, 0xbc307d0d, 0x0c728037, 0xba057ec8, 0x678e8f7a, 0x6ff1b723,
+    0x00ff6e9e, 0x339eefcb, 0x72080168, 0xcacaef2f, 0xab2a3d88, 0xb071b87d,
+    0x365b5c46, 0x3e61646c, 0xb19c269a, 0x787d0d8f, 0x25061c81, 0x4e410711,
+    0x36686dfc, 0x311a6795, 0x791d49d6, 0x9b0deeb3, 0x72edd1c6, 0xb1e2aa62,
+    0x84cbfbda, 0x524bc1e1, 0xb628d23c, 0x0cba505d, 0x509dfece, 0xe9739c2f,
+    0x41e0f0b9, 0x22eaf1ca, 0x2675253f, 0x58f0577e, 0x538b736c, 0x1d67e013,
+    0x924cec60, 0xbaeb0d16, 0x3019e5a8, 0x0ad62894, 0x1469070d, 0xa634e941,
+    0xd466daa6, 0xd5d0a269, 0x0011e82c, 0x9084127e, 0x0ea451fc, 0x146b0258,
+    0x452f36b1, 0xd573b8f7, 0x80bc25ae, 0x1e88434f, 0x2e5e139f, 0x45fb6340,
+    0x704f7cbd, 0xdfeff7fb, 0x300247ab, 0x00c00600, 0xa19100ff, 0x121d461a,
+    0x45536790, 0x814aab12, 0xe2345958, 0x52174578, 0x59ecea4e, 0x887d35ba,
+    0xd5a8b0ed, 0xc2448325, 0x3804df51, 0xc8a7bdb9, 0x09109822, 0x02550340,
+    0x8df5bd85, 0xa525226c, 0x27788926, 0xf7d767b2, 0x7ebfdfef, 0xf2f1e3db,
+    0xc5ae25f8, 0xfaa07d98, 0x91f7103e, 0xab73c1e4, 0x05d4659d, 0x6b7450a6,
+    0x5814e72a, 0x745b5874, 0xb660be29, 0xbb88d05a, 0x2d29335a, 0xde2a7a89,
+    0x1471aef0, 0xe601ebee, 0xa8166e66, 0x2a035440, 0x84ab1b88, 0xa2a35814,
+    0xd800ff28, 0xa8ced5b9, 0x2b647af3, 0x0775b15a, 0xd45137b1, 0xced5b944,
+    0xd4445085, 0x89a63e2d, 0x5c9dab73, 0x9047e7ea, 0x52290a98, 0x89c569b0,
+    0x856bcc7e, 0x96ced054, 0xa541b194, 0x6cae7638, 0x7d4d1e15, 0xcff7e5f9,
+    0x2c12b719, 0xe9dc3fd7, 0xa41b7b08, 0x93fdd489, 0x5182d1a5, 0x6c8b4682,
+    0x68e2e001, 0x991b5ced, 0x74a44442, 0xc3dfb5c3, 0x7ab12044, 0xa0066471,
+    0xc04a784f, 0x6beff481, 0x0026b1cf, 0x67e23406, 0x44738086, 0x1102a2e2,
+    0x66c0a3d0, 0x00ff0df3, 0x9ed637dc, 0x12211ddf, 0xd1983a1c, 0x3a17df66,
+    0xaa1064ca, 0xed2100f3, 0x01031b32, 0xff363b4c, 0x35017a00, 0x4d382a8e,
+    0x16e1c854, 0x5ed4edc2, 0x480c54bc, 0x0205c7bf, 0xbbb9962d, 0xc961da5b,
+    0xe6c93b24, 0x1fc27f44, 0x159d5e16, 0xf8981306, 0x23e5bd34, 0x74737a04,
+    0x3a8cba90, 0xf997716e, 0x00385c96, 0xdf22f953, 0x4174c886, 0x53f76ca0,
+    0x1317b33d, 0xb7fa3890, 0xa1841528, 0x2fc81f43, 0xd4b8dd8c, 0x7daf82a3,
+    0x030c0831, 0xe8389478, 0x5bb5795f, 0x6c1c89b3, 0x502ba333, 0x5b6cc8e7,
+    0x41a02549, 0x0a5965fe, 0xe159f8a7, 0x76cb9654, 0x2900ffd5, 0x009bd928,
+    0x071a8418, 0x8bc8b55a, 0x5ed34c89, 0x9f714b0b, 0x2d1964eb, 0x26479b14,
+    0x878a8c4e, 0x8437be9c, 0x28732591, 0x026c25a8, 0xc022b2bb, 0xe7413b06,
+    0x5793d606, 0xae23ab10, 0xe978b0e0, 0x1a2812aa, 0xf83a57bc, 0x700b1142,
+    0xa2203115, 0x84619e01, 0x443468dc, 0xa5404bd5, 0x7e409ebb, 0xa4565689,
+    0x2c87d7c5, 0x27f865df, 0x0d25542a, 0xdc57191c, 0xd0b82320, 0x86c70614,
+    0x74c5efd1, 0x7d204070, 0x2f95b631, 0x21b640a2, 0x23884ab1, 0x2cfc6344,
+    0x24a02022, 0xcb34b3f4, 0x339eefcb, 0x9c5a6968, 0x5eb125f9, 0x4c444174,
+    0x492aacc6, 0x45c520c8, 0xd80974bb, 0x9c02fd85, 0x369bcd66, 0x66b3d96c,
+    0x6c369bcd, 0x18d6aed9, 0x80020300, 0xd2000d30, 0x4b66731c, 0xc0196956,
+    0xc9f1965c, 0xcd0470c9, 0x00233653, 0xd90b5ec9, 0x6101d24a, 0xe01f371c,
+    0xdd6e37c8, 0xcced76bb, 0xb87c49cd, 0x672cf1a6, 0x921f1202, 0xd06aa992,
+    0xfbd9646a, 0x6a930964, 0x5b5383d8, 0x45738ff1, 0x5e3741ea, 0xc4368659,
+    0x844eb9b9, 0x57264a15, 0x8f1247f0, 0xb7dbed5e, 0x49b8dd6e, 0x71daf106,
+    0x3c89a111, 0x12686904, 0x19a2ca66, 0xb4db451c, 0xd98ad978, 0x54b88d3f,
+    0x11efc63d, 0x95182a6c, 0xce82331c, 0x5ac8ec1e, 0x7182db4c, 0xef80c249,
+    0x9abfc1f1, 0xc08b7ee5, 0x5724c20d, 0x816ed8e7, 0xca4c0c45, 0xc51b48d5,
+    0xfa153c17, 0x685d44a6, 0xba91a00e, 0xe2715396, 0xd098f05b, 0x4c1a8889,
+    0x91161306, 0xa0b2d442, 0xb1c2f49c, 0xb1e4110a, 0x64553089, 0xa61c270e,
+    0x6d93ea45, 0x52a3c27f, 0x9508a942, 0x39834d86, 0x485b0a23, 0x118418b5,
+    0xacc50909, 0x2882a525, 0xc6956940, 0x1209badd, 0x24f4a645, 0xa6d2e824,
+    0x5db135a0, 0x7c5f3ee6, 0xe17f9bf1, 0x195f89be, 0xb87dadd1, 0x23215908,
+    0xd8318c36, 0x7c2c8776, 0x83c31d5e, 0xb1828739, 0x091844a3, 0xa9094ec1,
+    0xf13b84b3, 0x22003780, 0x103bde17, 0x51902039, 0x0baef88b, 0x6583a047,
+    0x6622bb9a, 0xb422c002, 0x4060dcac, 0x5175d420, 0x0d301d51, 0x94b46e01,
+    0x130b2f03, 0x9ce904a2, 0x183294c0, 0x4be2aebb, 0xef36f84a, 0x80e2b9aa,
+    0x554da20d, 0x3d6c2d11, 0xb0530ce3, 0x7cd09224, 0xa18a8709, 0xc3b0a6cb,
+    0xf46ae2a4, 0x1b236ff6, 0x6211c808, 0x53bc8a11, 0x9650a484, 0x9a577bb6,
+    0x75b67dca, 0x3544014e, 0x339cbb00, 0xd7494263, 0xdcae6aed, 0xb3297226,
+    0x842c466a, 0x6f691f4b, 0x56ca9cf4, 0x8c652363, 0xb0a24845, 0xac67d03a,
+    0x4bea2e13, 0xcfbad8e3, 0x085492e2, 0x5aa9da0a, 0x94c93464, 0x27c1f12a,
+    0x339eefcb, 0xc9ab3768, 0x6b05a353, 0x45ead5f3, 0xaa7b8e14, 0x551d9748,
+    0xd1c00090, 0x638842e9, 0x537f6045, 0x783c1e8f, 0x8fc7e3f1, 0xf1783c1e,
+    0x1e8fc7e3, 0x20408321, 0x6719a195, 0x2c401920, 0x628b234a, 0x89233822,
+    0xc4c28b8c, 0x88800848, 0xe40847d8, 0xc3e1eb71, 0x1a1c0e87, 0x129a769a,
+    0x515bd817, 0x1a05f57e, 0x48d8a1b0, 0x5c082a0f, 0xd58c70e5, 0x11c4e033,
+    0x1a2a6e2c, 0xa2657029, 0x8536eb57, 0x6ce8c33b, 0x85b59b48, 0x2ed98e67,
+    0x8aaba2c5, 0x344cc09f, 0xe1a61862, 0x1c0e87c3, 0x48153d38, 0x51a48192,
+    0x713847a4, 0xb4aa9bc0, 0x872919be, 0xda9a6112, 0x808d248a, 0xec82802e,
+    0xee92fdc2, 0x0011092c, 0xb8b325b6, 0x5dcba453, 0x5d8cd5b3, 0x5bfe9aa7,
+    0x4358b4c2, 0x50e80363, 0x6e385cd8, 0x5aa15f2e, 0x18647248, 0xfd317242,
+    0x935241c1, 0x7e57b6b4, 0x3c365d72, 0xfc336849, 0xac6e53af, 0x0efe4db2,
+    0x105c287e, 0xbd085678, 0xe3ded431, 0xf8169a68, 0xe8ce200b, 0x341d4e60,
+    0x2aece8fa, 0x11994684, 0x3347e57e, 0x6b40a6da, 0xdf8d4a54, 0x4915c92e,
+    0x710ad616, 0xb064f161, 0xe3a923e6, 0xedc03ce4, 0x9e9b118e, 0x179798d0,
+    0xcc2c0105, 0xae2cf579, 0x9f9ad1a0, 0xad607434, 0x4fbd724e, 0xf9be3cab,
+    0xabe236e3, 0x8302adb0, 0xa3af2bfd, 0x75b75d51, 0xbf9ac47b, 0xdbf27e56,
+    0xd3ccbbfa, 0xfc7b7a0c, 0x15c37a92, 0xb72a798f, 0x46094d41, 0x824cd0a6,
+    0xa4a25504, 0xcf832129, 0x98670001, 0x452a4393, 0x604a029c, 0xa4025094,
+    0x92db2418, 0x2587f293, 0x152b066c, 0x10c4eabe, 0xad0fc905, 0x0295d473,
+    0x0d6da0bd, 0x26a05350, 0xdfad3d96, 0xa03b252a, 0xac8bd741, 0xa01182e8,
+    0x0f23eddb, 0x733f0e0e, 0x037b8e4e, 0xa8e9fce5, 0xb0ef84a2, 0x842c802f,
+    0xc1fc3842, 0x4202f488, 0x99394b60, 0xe4c1b2cd, 0x7f5b4e5d, 0xfd6d7957,
+    0x6dd0e05d, 0xff786f9e, 0xb3ae4900, 0x6351ecb7, 0x6dbc578a, 0xda38852b,
+    0x64f5e05c, 0xeb35e812, 0xcf49a2e8, 0x8f7b35f6, 0xecdbf572, 0x4e052cd5,
+    0xf3f23477, 0x5e208d50, 0x8babba1e, 0x4221366a, 0xaee35324, 0x25746786,
+    0x6799e41c, 0x16031e31, 0x00ffc539, 0x7876220a, 0xab7952ee, 0x49e5927b,
+    0x322f783c, 0x57944c22, 0x061ab009, 0x21413a48, 0x0441311f, 0x10c60a49,
+    0x7c44c289, 0x6ae7eb13, 0xf4f8335f, 0x29b131ec, 0xda700f10, 0xa00bdd02,
+    0xae814094, 0x3ef7f93a, 0xf90b0e90, 0x9422c12a, 0x5197763d, 0xd26f65a1,
+    0x2a9ada4f, 0x832a9aac, 0xeba23046, 0xd2ab7635, 0xbc32b8fd, 0x467014a3,
+    0x213c4486, 0xfd3d0fc6, 0xe8dc39e2, 0xe31e659d, 0x59ac5568, 0x00ff1c90,
+    0xe7f3f904, 0xc33e9fcf, 0xc0d8d611, 0x2aa0aa24, 0xcd800396, 0xe7f3398e,
+    0x073b1030, 0x250205a3, 0x0731c788, 0x895700ff, 0xab2a1414, 0xf3f97ceb,
+    0x328dcfe7, 0xa4e8986d, 0x0fed1106, 0x525da95a, 0x52e4244e, 0xcbe313f1,
+    0x68339eef, 0x8ddd50b0, 0xb84e8d46, 0xbf9a624b, 0x199f34ab, 0xcad616de,
+    0x51b09fa6, 0x7dbce6ac, 0x1a573621, 0x2b070041, 0x90fd6a40, 0x0214789f,
+    0x58df7cca, 0x6e152ad0, 0x4229ebf6, 0x5f596848, 0xc02ca320, 0x4ce29886,
+    0x6741593d, 0xb73f2d04, 0xfd8c8c72, 0x8440c3a5, 0x59622d3f, 0xec5605d3,
+    0x371fb29e, 0x82923875, 0x95cf6ea4, 0x01876382, 0x1522cd28, 0x613cd543,
+    0x281482d2, 0x8280aba2, 0x870ea82d, 0x59bae4c0, 0x5625c960, 0x8755e3f5,
+    0x1459272d, 0x0ab52edf, 0xd140ef70, 0xd51ef502, 0x5cf18107, 0x1fafb924,
+    0x01ba6f49, 0x17af4803, 0x6d40c117, 0xcbedefa9, 0xc617faf0, 0xe9d97d2c,
+    0x0a8a1a3a, 0x587d0c48, 0x67dd01b5, 0xcb80ea87, 0x09b90588, 0x7f71f890,
+    0xed01b2f8, 0x451222f3, 0xa15782ba, 0x8b11287b, 0x46937354, 0x24a7e089,
+    0x6360c95d, 0x9d7a6580, 0x27603f90, 0x4cfab8fe, 0xaf3516fa, 0xc63214b5,
+    0x08c1ab12, 0x2c1d72d9, 0xc080befc, 0x3883a095, 0x362612b5, 0xce0fa347,
+    0x756e93f0, 0xbdd12913, 0xfc903ec4, 0x7ec83182, 0x54fbaea7, 0x32c1c572,
+    0xe1cd7577, 0x2ec1c640, 0x88b16a1a, 0x143c91c2, 0xc5420d73, 0xed9f107a,
+    0x899642b6, 0x233512b5, 0x339eefcb, 0xf5dd256e, 0xc92a416d, 0x21d9a057,
+    0x42cddc92, 0x10c04853, 0x1ad69108, 0x07eecfd2, 0x3f6f72e2, 0xf9587f79,
+    0xc302e60b, 0xd8ded455, 0x3205439a, 0x678471ae, 0x199c9c0c, 0xb6510512,
+    0x9f8c3212, 0x1e042640, 0x20e2d3f8, 0xc27940c4, 0x3017a90b, 0x96681100,
+    0x2e0868c4, 0xb4123397, 0xcedde81a, 0xc54168af, 0xaec122e5, 0x48621ec3,
+    0x3948b19d, 0xb0853085, 0xa48920e3, 0x00ff17e9, 0x5b49a670, 0x76e224cc,
+    0x1a5bdbc3, 0xfc834a6c, 0x842c49fc, 0x31232c51, 0xd9dc5216, 0xc0623f34,
+    0x50014283, 0x92950247, 0x9b801b9c, 0x00ffde0d, 0x86d7f5f5, 0x43d3024b,
+    0xd99a0524, 0xf1a5e10f, 0x9f9f1e90, 0x86277799, 0xfeb1dc9a, 0x46fdbb50,
+    0x0d1d21f1, 0xe82d45ba, 0x0e70b796, 0x80591f50, 0x6b24ae4e, 0xc41cad66,
+    0xe41596c9, 0x06a662fa, 0x023183a9, 0xb6dfa072, 0x2d7f96dd, 0x99f47cd0,
+    0x2a2d2e6b, 0xbf612940, 0xfcadbad5, 0x848d7947, 0x9a941fe6, 0x3518ec5c,
+    0xe93d00cb, 0x00ffa7f6, 0x97ecb8eb, 0x53f0b125, 0x0543ca25, 0x09d8b3b5,
+    0xa0e1f08e, 0xc6f37df9, 0xb9bbc46d, 0xd9344b11, 0x7b698a5d, 0x32cbd043,
+    0xe371bca0, 0x004420c6, 0x5d008d2a, 0xad320055, 0x41f97010, 0x69f5ad2d,
+    0x92fdf29d, 0xe71aefb0, 0xdd802089, 0x5d00ffad, 0x4dd11a08, 0x68d35341,
+    0xe8a12c00, 0x27146b88, 0x89ef2372, 0x85705670, 0x1344878e, 0xc0aebe21,
+    0x44dd763f, 0x2cc6d71b, 0xd7169d56, 0x191e833a, 0xf7aba19b, 0x18f112f6,
+    0x5c4c6a4b, 0x598c8c2f, 0xb4aba865, 0xd0198014, 0x78be6ab3, 0x716a8a21,
+    0x8ff9d107, 0x1011301e, 0x186c4c88, 0x141028a5, 0xf005c220, 0x1f401ec1,
+    0x8700ff65, 0x0b87f1a5, 0xb0ae2101, 0x0536d019, 0x46a6f15e, 0x0560aaf7,
+    0x261f8813, 0x2045d061, 0x4030b056, 0x7daa7b49, 0x582b81d4, 0xa8658317,
+    0x4009f36b, 0x10c09e23, 0xa52c591c, 0x7bc84a3e, 0xca5e770a, 0x18276e21,
+    0x00fff1ed, 0x9b837676, 0xc2bb011f, 0xfc371209, 0x90493900, 0xd8c21ffa,
+    0x810b0730, 0x4b45b134, 0xbbacc262, 0xf5257de1, 0xb84379df, 0x060a6681,
+    0xc65260d0, 0xd569dde2, 0xa6d284cb, 0xbd191e23, 0xc6812bdc, 0x51c8b5ee,
+    0xc9f78cc3, 0xdc22e099, 0xf88dacd5, 0x228a04ea, 0x8c1425ef, 0xe88feb80,
+    0xfbf241c3, 0x28da8ce7, 0xd6367915, 0x5a6a8516, 0xeae536f3, 0x89927e3d,
+    0x6e93df72, 0x59320eaf, 0x91f5e623, 0xc0770d57, 0xa9a6fe91, 0x4d1e7892,
+    0xf4417b67, 0xc25c2c7b, 0xf54654e6, 0x02a37f4c, 0x07c9e5e9, 0x84dc0abd,
+    0x4763c3f9, 0x81208150, 0x07864137, 0x554561ac, 0x2e96d459, 0xd6f79c89,
+    0x51734a46, 0x83c9efc2, 0x50c98922, 0x2f52047a, 0xcb39782f, 0xf5c2f6b9,
+    0xf859852f, 0x2c6a7a5e, 0x3f18df7f, 0x2abc505a, 0xa398c688, 0x0b21aae1,
+    0x62c6e8a2, 0x4a7ba0d8, 0xd5934ff3, 0xff00ff7b, 0xff00ff00, 0xa145f700,
+    0xda5ec91c, 0x166615a6, 0x5c541c29, 0x34f886af, 0xc51b87a6, 0x140e5f11,
+    0x34c944a9, 0x408a8289, 0xcfc400ff, 0x2963fad2, 0x2b900f3b, 0x16924ab0,
+    0x3b5613c0, 0x753b00ff, 0x52025820, 0x6025f4d1, 0x287a0a4e, 0xb7a01995,
+    0x08ee991c, 0x00ffad0f, 0x00ff00ff, 0x00ff00ff, 0xd71d0dde, 0xbd2eeff8,
+    0xb6071a7e, 0x81689989, 0x155d5572, 0xa81a3a11, 0xaea1a410, 0x53293ead,
+    0x00ff38c0, 0x7da5420e, 0xaa1e74b0, 0x26afd8d5, 0x20bebdc6, 0x10fa9222,
+    0x9ef399b5, 0xfb6a8233, 0x463ca58a, 0x22d05f19, 0x0da13335, 0x9518688e,
+    0xa032bcba, 0xe3d76455, 0xbe2f4ffa, 0xb6b8cd78, 0x7f17c23b, 0x3af31f72,
+    0x58b3aaf7, 0xe4c878a6, 0x506851a1, 0x69b45eb4, 0x83c140fc, 0x30180c06,
+    0x7006c460, 0x2af89a68, 0x064b9c80, 0x73a1c30c, 0xeb344811, 0xa5b93605,
+    0x02488a77, 0xb01e05e8, 0x0683c160, 0x3919670c, 0x2b5091b8, 0x3147bd34,
+    0x71e8c589, 0x646ac04b, 0x35ca14c0, 0x3c3802d5, 0x4367a0b1, 0x12a10056,
+    0x1e12d9c5, 0xb3088702, 0x10c48c5b, 0x1f1f6fd7, 0x46fd199b, 0x1a8c4504,
+    0x52a86301, 0xbfbd5261, 0x536b01f1, 0x11cc02c5, 0x31d27b4c, 0xe62a388b,
+    0x36a6e544, 0x51ef00ff, 0xba3f4149, 0x74078aee, 0x5ad1cd48, 0xde8e6401,
+    0x2f8ee1e4, 0x2f3a8f6b, 0x5ed5c6fd, 0xb7257842, 0x08a9a062, 0xf1c44b18,
+    0x0860b4ae, 0xa1528bf8, 0x67b267ec, 0xd5431f32, 0x132c4287, 0x2a56c310,
+    0xb77b4701, 0x6005f799, 0xdf33dd14, 0x056459b1, 0x4c8de675, 0xc2b904b9,
+    0xce7205d5, 0xb6bda298, 0x7bfd1c88, 0x14abec72, 0xb01d6185, 0x292c0183,
+    0x47e3c1cd, 0x3ca06102, 0x2b285bed, 0xe131e088, 0x8544e817, 0x01a369f3,
+    0x735aa906, 0xc30a3a4f, 0x8503322a, 0x5884a8c6, 0x5180cb52, 0x0f4c0cc1,
+    0x5d12b6fd, 0x8ac51f4b, 0x527f039e, 0x90e26c74, 0xc9836663, 0xbed44876,
+    0x46136610, 0xea72b9c9, 0xaee6cf06, 0x6a1aa187, 0x60e74060, 0xe0d0c78e,
+    0x8a0bcfd8, 0x29a76212, 0xf1ca9822, 0x8d84f11a, 0x87be530b, 0xdf9777f1,
+    0x42d0663c, 0x627fbb03, 0x61c91028, 0x5fce3d77, 0x5b7e6bde, 0xeb81cc98,
+    0x229b80ba, 0x33a51b8c, 0xd5b582b2, 0xa0878117, 0xcb407904, 0x71ac3202,
+    0x146d94b3, 0x1d4b8790, 0xa7069a4a, 0xbcc512a6, 0x3f4e9411, 0x1c63a60a,
+    0x0baf5d5f, 0x9c32750c, 0xee4a3633, 0x71ac47a4, 0x2d77095a, 0x916c03c5,
+    0xa9166b16, 0x67c54295, 0x6632045b, 0xf0250dce, 0xc56dcc95, 0xbcb0ee94,
+    0xa9cb758e, 0x112da737, 0x99b2da84, 0x7ca68e48, 0x672f70f8, 0x18db6533,
+    0x72564ab6, 0xa10f9868, 0x8828c2ea, 0xa22622d2, 0x8eec2336, 0xce88d947,
+    0xb4aa462d, 0x5c2da029, 0x98d71d1c, 0x56b4d011, 0x425a1130, 0x90ce0300,
+    0x5aeb2859, 0x4f199f44, 0xb85e354c, 0x1d44670a, 0xb1dc81c6, 0xac1966b0,
+    0x19148dde, 0x78557434, 0x2f9b0c68, 0xcbfd6bc2, 0x0631f7f0, 0xa17da21f,
+    0xb5941ea5, 0x9c026d6e, 0x348bfd3a, 0x5bf5016e, 0xc80b2eaf, 0xcce62d04,
+    0x89faf680, 0x50be279b, 0x6b17a630, 0x1b2ec039, 0xa40a1a5c, 0xb31c141d,
+    0xa59fdd6a, 0x4b97168e, 0xd88f1402, 0x60dcbbeb, 0x83c21044, 0xc49902f5,
+    0x3dae8d80, 0x2fdcef96, 0xe6c3f210, 0x8c4ff989, 0x94c22967, 0x5aecbe94,
+    0x2f5515d8, 0x7c5f9edf, 0x007f9bf1, 0xf4b776a2, 0xca38c185, 0x0398abb6,
+    0x640d19c8, 0xf9708895, 0x81305edd, 0x6236dd31, 0x6ce781c8, 0xb4ae8c63,
+    0x343adeb2, 0x2cbdb014, 0x5510e96c, 0x55ae844a, 0xc5b26083, 0x50943735,
+    0x09ba8b90, 0x714bed91, 0x26321b3e, 0x93d5b0d0, 0x8db08d48, 0x420be085,
+    0xe41ecac5, 0xc3588e1a, 0x0316c8e0, 0x88216130, 0xec90bd7f, 0xc4ddcc50,
+    0xa7020c82, 0x514306b8, 0x8004cbf5, 0xd501e088, 0xe2b10c76, 0x19b768a9,
+    0x53f71e6f, 0x9ed0e374, 0x352ca2c9, 0x7057c7a5, 0x226b3cf7, 0xfb84b45d,
+    0x685864b7, 0x351471cb, 0x936751b1, 0x3b51e474, 0x078e8e94, 0xa6f7ce22,
+    0x684370f4, 0xc3bcaeb9, 0xf67967c8, 0xd0ddd120, 0x94298054, 0x4c1347d4,
+    0x48d9ba7e, 0x283a2638, 0x650c9656, 0x4a990c2d, 0x05ef04c9, 0x44437891,
+    0x487840e6, 0x322a2144, 0x8a9902e7, 0xf23aa84e, 0x53b0134a, 0x72ec7ac5,
+    0x7de9b5f4, 0xaf562bd1, 0xa00f58dc, 0xfe8516a5, 0x5f7e55d5, 0x439bf17c,
+    0x5fb72971, 0x5d9513e7, 0x2800fffa, 0xaf9200ff, 0x21c1d85b, 0x10652a55,
+    0xc276572c, 0x5b0610ac, 0x7429d288, 0xdf5e6fdd, 0x189301f6, 0x9bbc7aa1,
+    0x958dea48, 0x9dc8dfe7, 0x2869be6e, 0xda1dcb33, 0x63806fdf, 0x0cee5e0d,
+    0x6c0e820b, 0x9aaf042b, 0x445c5ae4, 0x1508b414, 0xab9f3244, 0x62079663,
+    0xb8544499, 0x64b8c486, 0xe44cc67c, 0x179b0c8c, 0xf126587d, 0x481427b9,
+    0x42582f86, 0xce687398, 0x90d3e13e, 0x6d9d0617, 0x34a6250c, 0xa5a74a7e,
+    0x5349ad20, 0x9fac5ad4, 0xc29e4204, 0x5200a61c, 0x82d88800, 0xcab94e42,
+    0x16e7420d, 0xc985fe62, 0x8250dd80, 0xdb020d01, 0xa19af47d, 0x6b253c97,
+    0x94967502, 0xc85593a3, 0x3eb5e5e0, 0xce476390, 0x58258153, 0x40348b24,
+    0x8e519e58, 0x2fcd5371, 0x80169677, 0x4c9c0593, 0x1d18b867, 0x66367e8b,
+    0x0e453fbf, 0x0057d462, 0x1ed4db34, 0xa8121f1f, 0x625f3d73, 0x6d5b81a6,
+    0x84cb1082, 0x0ea0e2f0, 0x965b894d, 0xc9803255, 0xce108c34, 0xdb7d9f67,
+    0xcdbb8a5e, 0x6ee2f9d6, 0xe2312ef8, 0xa8801a7c, 0x848a9434, 0x3ffeb2ae,
+    0x522b69d9, 0xe25b1fc3, 0x9fbb2237, 0xf37d798e, 0x6cc16dc6, 0xdd4385d0,
+    0x2cbd0714, 0x0ab74fd8, 0x02b38268, 0x45940b87, 0x10624f14, 0x5211fc3e,
+    0xdd2e7aa0, 0xdee4eebb, 0xf0bafa1f, 0x61d56d20, 0xc3fa5557, 0xd4dbe0ec,
+    0x4443a150, 0x130f3a0d, 0xe044e976, 0x850d5f19, 0xb3346419, 0x6084a6aa,
+    0x11660aad, 0x207b4700, 0x484899b5, 0x1280e28c, 0xe0904d66, 0x26341054,
+    0xd924aa54, 0x5fd4d083, 0x5d9003a8, 0x7de88465, 0x1ff0d280, 0xd6a2fc42,
+    0x61909edc, 0x9300ff19, 0xf3e8b7a7, 0x576dcde7, 0xf9f3e9eb, 0xb08ac7f3,
+    0xac7d8eed, 0x2dd94e3b, 0x4a3c400a, 0x3c20e213, 0x6671e77d, 0xc0b402b2,
+    0xe5161074, 0x19602e2a, 0x7a5f12d1, 0x21e94a1f, 0x7f099cc4, 0xe354c7b2,
+    0x840e3a0c, 0x8387068c, 0x10df9717, 0x3f04bf06, 0xe7582253, 0x29572f4f,
+    0x08b53e23, 0x08062289, 0x4c233688, 0xc47b7359, 0xfa19a813, 0xe4abf0f8,
+    0x6a98aff2, 0x836b39c1, 0xb55a2dfa, 0x56abd56a, 0x6ab55aad, 0xad56abd5,
+    0x58ab9441, 0x08138052, 0xdf639888, 0x541b6726, 0x5551a84f, 0x4da3b4f4,
+    0x63d29603, 0x40085a96, 0x00012808, 0x0c5001c0, 0x56ab457f, 0x6ab55aad,
+    0xad56abd5, 0xd66ab55a, 0xa5c2ea94, 0xa8db5606, 0xcdfea5a8, 0x90714867,
+    0x202d4b3c, 0xde42686a, 0x400b6560, 0x9fa26941, 0x06e97d22, 0x6e216956,
+    0xa70e0889, 0x5928e1fb, 0xcf1ae5f4, 0xe75ab7be, 0x65de636b, 0x0377dabd,
+    0xfcbf48b6, 0xe5d26249, 0x5c2e97cb, 0xcbe572b9, 0xb95c2e97, 0x97cbe572,
+    0x72b95c2e, 0x2e97cbe5, 0xe572b95c, 0x5c2e97cb, 0xcbe572b9, 0xb95c2e97,
+    0x97cbe572, 0x72b95c2e, 0x2e97cbe5, 0xe572b95c, 0xb12d97cb, 0x80232061,
+    0x2bc18655, 0x33149402, 0x04f409f0, 0xed310dc6, 0x1dc4ecef, 0x767df37c,
+    0x878eb68b, 0x3bf4ca69, 0xdaa1574e, 0xd30ebd72, 0x9c76e895, 0xe5b443af,
+    0x2ba71d7a, 0x5e39edd0, 0xf4ca6987, 0xa1574e3b, 0x0ebd72da, 0x76e895d3,
+    0xb443af9c, 0xa71d7ae5, 0x39edd02b, 0xca69875e, 0x574e3bf4, 0xbd72daa1,
+    0xe895d30e, 0x43af9c76, 0x1d7ae5b4, 0xedd02ba7, 0x69875e39, 0x4e3bf4ca,
+    0x72daa157, 0x95d30ebd, 0xaf9c76e8, 0x7ae5b443, 0xd02ba71d, 0x875e39ed,
+    0x3bf4ca69, 0xdaa1574e, 0xd30ebd72, 0x9c76e895, 0xe5b443af, 0x2ba71d7a,
+    0x5e39edd0, 0xf4ca6987, 0xa1574e3b, 0x0ebd72da, 0x76e895d3, 0xb443af9c,
+    0xa71d7ae5, 0x39edd02b, 0xca69875e, 0x574e3bf4, 0xbd72daa1, 0xe895d30e,
+    0x43af9c76, 0x1d7ae5b4, 0xedd02ba7, 0x69875e39, 0x4e3bf4ca, 0x72daa157,
+    0x95d30ebd, 0xaf9c76e8, 0x7ae5b443, 0xd02ba71d, 0x875e39ed, 0x3bf4ca69,
+    0xdaa1574e, 0xd30ebd72, 0x9c76e895, 0xe5b443af, 0x2ba71d7a, 0x5e39edd0,
+    0xf4ca6987, 0x18c44c3b, 0xe6b74317, 0xdbe77900, 0x00d9ff9c, 0x50545448,
+    0x302e312f, 0x30303220, 0x0d4b4f20, 0x7265530a, 0x3a726576, 0x49776c20,
+    0x2e312f50, 0x20312e34, 0x74746828, 0x2f2f3a70, 0x61766173, 0x68616e6e,
+    0x6e6f6e2e, 0x2e756e67, 0x2f67726f, 0x6a6f7270, 0x73746365, 0x69776c2f,
+    0x0a0d2970, 0x746e6f43, 0x2d746e65, 0x676e654c, 0x203a6874, 0x35363634,
+    0x430a0d33, 0x65746e6f, 0x542d746e, 0x3a657079, 0x616d6920, 0x6a2f6567,
+    0x0d676570, 0x6154450a, 0x22203a67, 0x37616539, 0x31346136, 0x30386135,
+    0x63366537, 0x430a0d22, 0x65686361, 0x6e6f432d, 0x6c6f7274, 0x616d203a,
+    0x67612d78, 0x36383d65, 0x0d303034, 0xff0a0d0a, 0x00e0ffd8, 0x49464a10,
+    0x01010046, 0x00f00001, 0xff0000f0, 0x004300db, 0x01010101, 0x01010101,
+    0x01010101, 0x01010101, 0x01010101, 0x01010101, 0x01010101, 0x01010101,
+    0x01010101, 0x01010101, 0x01010101, 0x01010101, 0x01010101, 0x01010101,
+    0x01010101, 0x01010101, 0x4300dbff, 0x01010101, 0x01010101, 0x01010101,
+    0x01010101, 0x01010101, 0x01010101, 0x01010101, 0x01010101, 0x01010101,
+    0x01010101, 0x01010101, 0x01010101, 0x01010101, 0x01010101, 0x01010101,
+    0x01010101, 0x00c2ff01, 0xac000811, 0x0103d000, 0x11020011, 0x01110301,
+    0x1e00c4ff, 0x04010000, 0x01010103, 0x00000000, 0x00000000, 0x05030400,
+    0x02000706, 0x0a090108, 0x1c00c4ff, 0x02020001, 0x00010103, 0x00000000,
+    0x00000000, 0x03010000, 0x06040205, 0xdaff0807, 0x01030c00, 0x03100200,
+    0x01000010, 0x069632fb, 0x6ce8a107, 0xb0c1061b, 0xe0060a28, 0x8d0a28a8,
+    0x820a2a51, 0xde6ca8c0, 0x06060606, 0x06966e05, 0x3df5ac07, 0x16f7b085,
+    0x4615d8ec, 0x1a14abe0, 0x421654a2, 0x0b2cb0a0, 0x60e06133, 0xe9556060,
+    0x8151cf78, 0xe966f6e8, 0x83821b6c, 0xa0a48add, 0xb050c52a, 0xb084352a,
+    0xcc020b2c, 0x181878d8, 0x0f5e3215, 0x237b63d1, 0x6b37d860, 0x04352874,
+    0x360a2aa0, 0xc3824ab2, 0xe9621658, 0x58da352c, 0x05061e3d, 0xf58c973a,
+    0x6cd18f1e, 0xf7b8c53d, 0x28a08012, 0x4a5853c5, 0x0b59cc82, 0x352e6431,
+    0x820b5d9a, 0x1c98f5a3, 0x28f00cbf, 0xb659b437, 0xfaac76d7, 0x790ddab7,
+    0x927bb3f4, 0x634dcf75, 0x597ccc12, 0x90b0f047, 0xd8f86228, 0x9efd64a2,
+    0xee7ab6b3, 0x7b04abc6, 0x8f56b3ef, 0x7b040f96, 0x7df19d64, 0xf347bb27,
+    0x639c135e, 0xa81cb79d, 0xeae8574e, 0x31fa995b, 0x65cddff2, 0xcd329eb7,
+    0xce036d59, 0x31a34ceb, 0xb8249157, 0xd95ad7f3, 0xd4a147a7, 0x79d1435d,
+    0xd95d1775, 0x6a37ab4d, 0x4b0b9b0d, 0x4f888b7f, 0x9c9ef5a4, 0xb32ed6ad,
+    0x5ef500fd, 0xe510c423, 0x34ca51ce, 0xbf2e7279, 0x325bcd5f, 0xb6d6da5c,
+    0x559887bd, 0xc6b2e79c, 0x73023d69, 0x3e87d3a1, 0x455de4d2, 0xb6b5e67b,
+    0x3c9bf19d, 0x02b058dc, 0xb7b9b7bf, 0x684c6879, 0xe88fe01c, 0xfc9bdcde,
+    0x67a51bdd, 0x97f15961, 0xf52f8f8d, 0x38cdfbf6, 0xdef91c62, 0x3ec30029,
+    0xbaf4d04f, 0xf3a368a6, 0x7cedc76a, 0xfde5efee, 0x518ac082, 0x7be12f6b,
+    0x7b5235b9, 0xa96a9614, 0x1b0997fd, 0x9b823ce8, 0x97ea919a, 0xd86937ad,
+    0x679d2879, 0x6f57f56e, 0xb65ee764, 0x6bb82cfc, 0x3ce91efd, 0x74b7aa3b,
+    0x931e5da8, 0x4b87dee5, 0x38c992cc, 0xf3b95b53, 0xa25fe595, 0xc6dc0e6b,
+    0xcfaa185d, 0x100f3b9e, 0x6617678d, 0xe5a91e73, 0xb6c4a10f, 0x497f0372,
+    0x82ae6a8a, 0xb5abd8d5, 0x6ff5083a, 0xb52d8148, 0xf5500b27, 0x06fb705e,
+    0x734f2536, 0xfdd1596a, 0x7f7ce997, 0x7efaeb9a, 0xe1dcd340, 0xe186e6b9,
+    0x2e5ef471, 0x6f15e73f, 0x4c3574b1, 0x4549e7ac, 0x4f03fe76, 0x11cff159,
+    0xe9c29e66, 0x36e8138e, 0xaa3bef8b, 0x0a459aa4, 0x88fa35ba, 0x16541f15,
+    0xd094cbbd, 0x8ab8accc, 0xbcf0ae13, 0xe4f03eca, 0x1dd39d7d, 0x575db58f,
+    0xfca9d18b, 0xf9efa9e3, 0x25f49e8f, 0xaf1c6d34, 0xb3e0d0b9, 0xef5ad5bc,
+    0xb91cde0a, 0x9af1b117, 0xb04777ef, 0x71521ff9, 0x2d1befac, 0xfcbb606a,
+    0x5a5562bd, 0xff86be15, 0xd5d8ce00, 0x1284f573, 0xe6f9f6cc, 0xd8c39f8e,
+    0xb4b1afe7, 0x69f917bb, 0x3c5645bf, 0x5f860b55, 0x01bd6a2d, 0x63ec9c93,
+    0x57e45dd5, 0x5697617f, 0xe3b1dfde, 0xb629b65d, 0xa0a9b5d5, 0xd26d82b9,
+    0x955b0c74, 0x5ffc75fd, 0x0c154676, 0xc98e7a73, 0x1d5a899a, 0xad773f9a,
+    0x473d4091, 0xcf437661, 0x14f25b33, 0x31c651af, 0xeaf779ef, 0x6f6e3d77,
+    0xdbf8b7d5, 0xecdbfacf, 0xe41eaf39, 0x75df6d36, 0xbf2a6b6f, 0x2d459543,
+    0x74352797, 0xc850f2d9, 0xbbda222e, 0x1b3c4751, 0x4d396962, 0xcd73ef60,
+    0xe6a8b1b1, 0x89bab7a0, 0xc7d5ae5e, 0x9e87ca6d, 0xd572d848, 0x512da76d,
+    0xea4ff95c, 0x58cd07f2, 0x7675c8c9, 0xe7b4933c, 0x33fcb65a, 0x335def45,
+    0x5e490506, 0x66f916db, 0x80f4ecb3, 0xaed4be41, 0xd5602550, 0xb63a9fbc,
+    0x6f68b717, 0xb2faccf3, 0x0cd4a5d5, 0xde3de8d8, 0x63f52a1e, 0x4fa31abb,
+    0xbb923a5f, 0xe47d1bf4, 0x7da7d5fc, 0xf49f23f3, 0xfa4e63ea, 0x1ee3963f,
+    0xbbd1418f, 0xbaa46b9c, 0x723fe554, 0x6d311396, 0xc37a3664, 0xd1a69db8,
+    0x9284c59c, 0xadb8f61d, 0x93ae649e, 0x9625af4d, 0x70af39a2, 0x7e55da84,
+    0xdba89136, 0xc3ed5cee, 0xbe7dcc6b, 0x9f6f3ceb, 0x1778ed74, 0x60b6f594,
+    0x7a70b545, 0x99215c3c, 0xbc40d230, 0x8ee2f170, 0x806d1946, 0xfc1c332b,
+    0x360c45c2, 0x4eb0ae58, 0x25cb4958, 0x02c674db, 0x7b5e5f26, 0xb4e7177f,
+    0xa0843d6a, 0xbbd0c52c, 0x20802064, 0x24806808, 0x40204108, 0x2122d910,
+    0x20238104, 0x48208144, 0x3f781c14, 0xc52cb005, 0x041084c0, 0x91928130,
+    0x04104820, 0xc21284b0, 0x04124850, 0xc9482001, 0x12402011, 0x821a6a1c,
+    0x11c8b880, 0x32124020, 0x32109140, 0xc2124044, 0x32104890, 0x8c04255a,
+    0x53c21281, 0x03110924, 0x059316e3, 0x321294c0, 0x04124044, 0x12482081,
+    0x48200104, 0x20810412, 0x914c0943, 0x0d810412, 0xc6112294, 0x8d4ad0a3,
+    0x24855d70, 0x5802c948, 0x20418940, 0x86c21048, 0x4a36444a, 0xc9a43044,
+    0x44240311, 0x0f89960c, 0x2a00c4ff, 0x04010010, 0x00000103, 0x03020206,
+    0x00000001, 0x01000500, 0x06020403, 0x12100711, 0x17151413, 0x26163620,
+    0x35302521, 0x0800daff, 0x01000101, 0xeaea0205, 0xeaeaeaea, 0xeaeaeaea,
+    0xeaeaeaea, 0xeaeaeaea, 0x5d1dfeef, 0x5d5d5d5d, 0x5d5d5d5d, 0x5d5d5d5d,
+    0x4c5d5d5d, 0xf9779de9, 0x757575f5, 0x75757575, 0x75757575, 0x75757575,
+    0xff4ca633, 0x00ff0e00, 0xaeaeae2e, 0xaeaeaeae, 0xaeaeaeae, 0xaeaeaeae,
+    0xd475a6ae, 0xff3399ce, 0xaeae1e00, 0xaeaeaeae, 0xaeaeaeae, 0x4ca6aeae,
+    0x9da9abeb, 0x836fea32, 0x009b027f, 0x08fd09d1, 0x80d82f13, 0xd64faf15,
+    0xfded37e9, 0xd3e27e3d, 0xfaeb4799, 0xb09faa94, 0xd76df7e9, 0xca468df5,
+    0x2cf5d5c3, 0xd5535f95, 0xb6fa3b6e, 0xec7e1ba7, 0x9dedd7d1, 0xdd9be66b,
+    0xfed26ab4, 0x1e16d0fd, 0x753ca2e1, 0xb9548f7d, 0xd7594f66, 0xb7f79221,
+    0xcb3143ea, 0xa21835d9, 0xf2a1e1fd, 0x24d3653f, 0xd2682fc2, 0xb9fe6a26,
+    0x19cedba7, 0xa01fb1a3, 0x6b00ff65, 0x62c3bf23, 0x3b696831, 0x50d46d36,
+    0x69237a12, 0xe825747e, 0x629fd8ef, 0x8b66dfc6, 0xae7623ef, 0x79867254,
+    0x4e31331f, 0x084c281f, 0x965beccd, 0x89a091e2, 0x95da32f5, 0x9627962b,
+    0x56ecf2b4, 0x09c352ec, 0x776ace66, 0xba3f9b22, 0x66c5076c, 0xb38fdfcc,
+    0x5aa9831c, 0x5f5f575a, 0xa6fe0ff4, 0x7f56be69, 0xcc26ca4c, 0x3a67e71b,
+    0xbe3ecf72, 0x66592b6b, 0xf6759e44, 0xf7cd09f8, 0x599d4ccc, 0x0c733066,
+    0x2e3517ab, 0x5f462965, 0x0961f518, 0x595eabf2, 0x88e6c5e7, 0xc1f321b9,
+    0x3d804652, 0x19114503, 0x907e0db6, 0x27bf04f3, 0x46b592ba, 0xd472b619,
+    0x49f9951c, 0x1635d381, 0x78563f20, 0xf8df8eaa, 0xf25f73e5, 0xafc4e0b7,
+    0xa35993de, 0x23362b88, 0x89885d83, 0xe2ba9508, 0x3616108d, 0x8032cc90,
+    0xa507b954, 0xc3fae054, 0xc6ca5849, 0x35196bc8, 0x1adeb8fb, 0x3f219f5f,
+    0x5f4bbbb8, 0x5fe54ed7, 0xa99991ea, 0x910eb416, 0x0d48955b, 0xb1e784d6,
+    0x4bb546c9, 0xf9934882, 0x4b92db2e, 0x97f07ce1, 0x3c0f0ad3, 0x0e3dd932,
+    0x8bb5099d, 0x0bd285fa, 0x16640e61, 0x854b413a, 0x484a6d55, 0x776a1969,
+    0x7722e4c8, 0x0c101ead, 0x512b147a, 0x6bcd2e5b, 0xc905b763, 0xb0a5dc83,
+    0xb078704c, 0x15a39170, 0x5428c2da, 0xc823c636, 0xac163265, 0x8534f6cf,
+    0x2e7c96db, 0xbe3a2882, 0xa2044d51, 0x166e98b3, 0xe679850d, 0xc3ce07dc,
+    0x164e2d73, 0x3a723584, 0xc495ca30, 0xd9384cfa, 0xc07d34d2, 0xd1378a7e,
+    0x91bca7f2, 0xc170e0f3, 0x10f5667b, 0xf57c18bb, 0x00ffeeab, 0xadf40a4a,
+    0xd66fd66b, 0xf82fe0da, 0x8ee558da, 0xd11fe113, 0x26571903, 0xacaff51e,
+    0x733f0362, 0x90ea5714, 0xd31a5619, 0xbbe92746, 0xa8ed9308, 0x64f2be14,
+    0x612ad95c, 0x954c67c2, 0xb4cc329c, 0x9357fdb2, 0x0199a9ee, 0x46cc14a8,
+    0xd178fd9f, 0xfac7223a, 0xd1eb5cc0, 0xc424200a, 0xaea1d531, 0x2446dc5a,
+    0xcc16d1b0, 0x9fe635a4, 0x766c1901, 0xc42e446a, 0xcc1a6d50, 0x46a532e1,
+    0x82013be9, 0xee5cabd6, 0x3f178cb3, 0x24356e30, 0x17c65bf3, 0x5365232b,
+    0x5dc3181b, 0x96a3e499, 0x09832036, 0x842503db, 0xb0525fc3, 0xf45a224e,
+    0xf4816b82, 0x1359ec29, 0x31dc39eb, 0x385e7fa8, 0xe9157ff5, 0x940340bb,
+    0xa2c28d85, 0x7cfd562f, 0xab8098c8, 0xc4721555, 0x51ecef22, 0xd88994df,
+    0x6a040b1b, 0x69050441, 0x639ca1d6, 0xf410c221, 0x4db1a3e1, 0x6e3367f5,
+    0xd39c6455, 0x7b361dc7, 0xccc20c92, 0x1ef9d531, 0x58823148, 0x19e1c2e3,
+    0x55fb3069, 0x09a753db, 0xd8d872b9, 0x5cd0b120, 0x31a9b5d4, 0xfff734d8,
+    0x60d95e00, 0x1a3ad882, 0x8a9f7fdc, 0x3ce957be, 0x57134412, 0xecdc0f9c,
+    0xd6ca0b79, 0x581e4733, 0xe0394760, 0xcf8558bf, 0xc63298f1, 0x65abacf8,
+    0xd18ed730, 0x56a854fd, 0x45f1241e, 0x76d63a1c, 0x041c8c6a, 0xb22f9a38,
+    0xc6e7c30d, 0xad5c683c, 0xd724633b, 0xe5e58ea7, 0x204a6b2d, 0x15544b84,
+    0xd4223995, 0x70cfdbc9, 0x7bfd5fd3, 0x5f9f6f67, 0xd19aea35, 0x76c94b4d,
+    0x3f513a1a, 0x6f07da4b, 0x6a4b4336, 0xa7441814, 0xd9a6c986, 0x5fc6c2b2,
+    0x496570aa, 0x67bba0fe, 0x99dc8a33, 0x0641ab64, 0x2de2296b, 0x9d861d91,
+    0x9c61478c, 0x88d8d370, 0x55646db1, 0xea6f97b2, 0x398b189b, 0x0f04fbea,
+    0x6e14227e, 0xf835a95b, 0x92a952ad, 0xace00883, 0x8c57c6f4, 0x4b4ce138,
+    0xb1bdfe4c, 0x9b84d9b4, 0xbd5ca158, 0xc5f0b631, 0x07a997c3, 0x4057d9f8,
+    0x0a3ae047, 0x588ae694, 0xccc615e9, 0xe0336e23, 0xfcd7b734, 0x6235ab39,
+    0x01594614, 0x351eb1d2, 0x2923e0aa, 0x1c37d887, 0x814acc3a, 0x21320073,
+    0x5f3494b2, 0xdad56312, 0xb28bd59a, 0xad9c05e0, 0xc6d9786b, 0x8c713989,
+    0x29d7fa65, 0x5d29ab0e, 0x4af1fa2f, 0xe73e7cbf, 0x3f7b5f9c, 0x1ff709ae,
+    0xce9b2a36, 0xe6c5b34b, 0xd77ff1c5, 0x3c3c1b45, 0x5fcfdff0, 0xf8c40cce,
+    0xabcfd979, 0xfa1f9d1f, 0xe4d07c95, 0x4fcd5f2f, 0x63f3b144, 0xcd5f4b78,
+    0x3e941876, 0xa146b171, 0x358e9df3, 0x586c9d1f, 0x62ef3c2c, 0x47b6af5f,
+    0xc4b6f58f, 0x898df3b1, 0x63e3fc9d, 0xd9419777, 0xcf37ac32, 0xeb085836,
+    0xbe086791, 0x643259fc, 0x4c2693c9, 0xc9643299, 0x26339399, 0x99cc4c66,
+    0x99cc4cb1, 0x66323399, 0x97c9cc64, 0x26535757, 0x6432994c, 0x4c2693c9,
+    0xc9643299, 0x994c2693, 0x0edf6432, 0x32994ca6, 0x2693c964, 0x6432994c,
+    0x4c2693c9, 0xc9643299, 0x32f82793, 0x2693c964, 0x6432994c, 0x4c2693c9,
+    0xc9643299, 0x994c2693, 0x2693c13f, 0x6432994c, 0x4c2693c9, 0x93c53799,
+    0x32994c26, 0xc4ff876f, 0x00114b00, 0x03010202, 0x02020303, 0x060c0306,
+    0x0100000b, 0x11040302, 0x00131205, 0x22142106, 0x15412331, 0x33240732,
+    0x34615142, 0x17168171, 0x52433525, 0x95916353, 0x4410f0d1, 0xf1d4a162,
+    0x60553026, 0x94927270, 0xffd3c1b1, 0x010800da, 0x3f010103, 0xe000ff01,
+    0xd2ac1014, 0x56107b04, 0xb1e50952, 0x07b8c6cb, 0x9e2208c3, 0xc4c0b75c,
+    0x07cecf67, 0x870dbf9e, 0xe96b00ff, 0xffe3fd87, 0x1d4fef00, 0xb00b9526,
+    0x9874c65f, 0x1dd2fbf3, 0x5b7f5045, 0xfe401c7e, 0x5f681ddf, 0xeee27ea2,
+    0xd0daf26a, 0x945a68ae, 0x34c14b10, 0x0894df90, 0xc6afd8e6, 0xdb885ac2,
+    0xf1b03ab6, 0xbf9e1f8c, 0x03e90fbc, 0xfe8f1efd, 0x7ef83ff1, 0xe907bcbf,
+    0x1fcdfc03, 0xf8dfe2fd, 0x84feae7e, 0x8f4fd37b, 0x70e8e396, 0x4de61c26,
+    0x6a3c5355, 0x85eff65d, 0x27416177, 0xf6ae6e1f, 0xb946b52e, 0xe6e933b5,
+    0xf030e21d, 0x72ee32da, 0x918d02c5, 0x1204ee7c, 0x480e0670, 0xd4d46eea,
+    0xcb8b1660, 0x2249fa4c, 0x48b35d86, 0xd9c73473, 0x07447f1c, 0x0ecc3d3e,
+    0xcfbffbc5, 0xa3b67652, 0x94faab1f, 0x3896d3d8, 0xf933db25, 0x0a712eb1,
+    0xc30c1566, 0x10f1e61e, 0xd44900ff, 0x017eb3dd, 0x785a9e61, 0x9f5534ad,
+    0x339b3f13, 0x335d0b16, 0xa782cb10, 0x8fb01d73, 0xdaa3a7f4, 0xc03680da,
+    0x729a9b96, 0xcd7679ad, 0x9f4d9b27, 0x0adfe3d5, 0xee719106, 0xb48f106f,
+    0x85fdaaa7, 0x8df5d9ae, 0x41c7a311, 0xad955977, 0x87768d6d, 0x1f731569,
+    0x43188d24, 0xe73262bb, 0x3a3e96c2, 0x34a9971d, 0xa7b37422, 0x2d4e46bc,
+    0xefa325cb, 0x7d054105, 0xeb32f026, 0xdb0faee4, 0xf48f3838, 0xc652dc6d,
+    0x73da46b2, 0x4f198a24, 0xc39061aa, 0x18c22023, 0x00c3631c, 0x7a80e0c3,
+    0xc97df6fe, 0xff9dcee7, 0xff9fdd00, 0xfa4d8f00, 0xec2dee3d, 0xc356c791,
+    0x094ee247, 0xc1672cf7, 0x26a23bc3, 0xd57810fc, 0xd9635c9a, 0x27fb99f1,
+    0xcf0aab55, 0x3752f43c, 0x4b7d8493, 0xf928eb2c, 0x196a8947, 0xb1fe6163,
+    0x6404c117, 0xadf6d211, 0x16e58dd6, 0x0c49046a, 0x1435b94d, 0x9436e26d,
+    0x90801ae1, 0x78c7888d, 0xbb319e5d, 0xf6500776, 0x4962b11e, 0x3a7d8661,
+    0x650a2049, 0xa090794e, 0x0977c16d, 0x5bdd272b, 0xd81e9dfd, 0xc46824bc,
+    0xcf6c5bd5, 0xdc3c905b, 0x3567d266, 0x4b2ab494, 0xbced3ef8, 0xc8531f3f,
+    0xa2d6f6e8, 0x9387783e, 0x392ef319, 0x115cfdc7, 0x1f4fba17, 0xfa0f7399,
+    0x021d3ddf, 0x3cabb2e2, 0x018d7423, 0x96ca4e20, 0x4aaefe57, 0xcf2773c0,
+    0xf11fdfe4, 0xd0c99571, 0x7310832e, 0x6148721a, 0x4ef627f2, 0xdb160209,
+    0x0eb6cb09, 0x8f4f6f36, 0x3432dc70, 0xecc09e0b, 0xe0959791, 0xc2b8a23b,
+    0x4d3f9739, 0x129c55cc, 0xe4e338d8, 0x082a761f, 0xbd7440cf, 0x75c03f1f,
+    0x1b681afa, 0x7b12d541, 0x36a46b77, 0xda689ddd, 0x4bb258b1, 0xc2df0703,
+    0xaf027941, 0x0de42bd3, 0xd501f7b8, 0x6da3e93e, 0x268d044f, 0x244b52c5,
+    0x449ae189, 0x2455e418, 0x31f289ee, 0x876f6d9c, 0x5f497f52, 0xbf3dbba4,
+    0x7e897e4f, 0x63397a11, 0x10466a82, 0xe464a2cc, 0x8956065b, 0x5f466cd0,
+    0x2b397fa6, 0x9eba3682, 0x6a37fde1, 0x294dc7bd, 0x54aad1d8, 0xaaf5e32a,
+    0x95136677, 0x89451323, 0xe7f87821, 0xb78b0450, 0xbd8231ec, 0x952e690b,
+    0x24bd525c, 0xcbb24f6c, 0xe4c4ceaa, 0xe9579035, 0xb1ba3bab, 0x4872572e,
+    0x725069e7, 0xa7d4053f, 0x5e9d324b, 0x06068b8b, 0x3ed7731c, 0xe5db6f9f,
+    0x90e32740, 0x37d08e7b, 0xb71f6ee3, 0x71598c35, 0x262955aa, 0x881947c9,
+    0x7c16c5f1, 0xf27b4bfb, 0xbc51e440, 0x2bef2ee0, 0xdec90581, 0xa2d5d6c2,
+    0x1a39c640, 0xbc8a2349, 0xc3f8a04a, 0x93a930d8, 0xc54d8eca, 0xf9cf17ce,
+    0x515453ad, 0xa739fe68, 0x120ff7b6, 0x322c9dad, 0x77fba044, 0x4ef59335,
+    0xdef0e540, 0x00ffc9d5, 0xb6ba4837, 0xa23ae116, 0x1f116b5c, 0x0346d04e,
+    0xe286e4e9, 0x5c44ace7, 0xcdca0d92, 0x47d401bf, 0xabf820ee, 0x2088e605,
+    0x559ae6d5, 0xd3393390, 0x995257eb, 0x69eea64c, 0x70685b11, 0xcc6f63ac,
+    0x506f0f0b, 0x35004556, 0x57a52461, 0x496cfd91, 0xd21de0ca, 0x56d426f1,
+    0x689fe590, 0xe0243f19, 0x38793d75, 0x80352d83, 0xb4f8dc86, 0x3983922c,
+    0x336ea350, 0xed60b7e1, 0xc35dc7f8, 0xa40e77a5, 0xaed0489a, 0xe641cf9a,
+    0xa67af05b, 0x4bd3e2a8, 0xc7bfd6bf, 0x97518aa8, 0x5c1bee00, 0xd8dc566c,
+    0x2feaa28e, 0x62db1662, 0x36a48617, 0x4911161c, 0x536f0562, 0xb4819122,
+    0x0f3b24e6, 0x3ea38d96, 0x6d0f8154, 0xec788256, 0x198f08d3, 0xf624cf42,
+    0xb1afc4c4, 0x33265488, 0x58958419, 0x3bc7d848, 0x9a7a9287, 0x5392c4b6,
+    0x2e549934, 0x7331a9d8, 0x31e313b4, 0xc8c33ff9, 0x6ec9eae9, 0xd4fab436,
+    0xd5b6a9f0, 0x9a50d5d7, 0xbf62edba, 0x02843096, 0x5bebaf37, 0x33a0c643,
+    0x26751448, 0xb66ab39f, 0x90c309bd, 0x8481b531, 0x18dc67fc, 0xdc69bfcc,
+    0xcf67fe97, 0x8ef67456, 0xfcbab0b9, 0x99762041, 0xd5eed8c1, 0x11656e94,
+    0x8c252fef, 0x1a2ea70f, 0xce19f84c, 0x1c37430b, 0xb4acc352, 0x401aeae9,
+    0x3e678962, 0x531c709b, 0x9125f7a8, 0x80f2aa9d, 0x80c1caca, 0x6d86a920,
+    0xa51a15d2, 0xd06e44d8, 0x80392d83, 0x1216e695, 0x36f88e38, 0x9161ee48,
+    0xb11dc352, 0xef76ac80, 0xf31fba05, 0xebd0d3fe, 0xe7e77fec, 0xb9511bad,
+    0x4175b747, 0x658aed56, 0x72f527e6, 0xc7f15ce8, 0x6d84c88c, 0xed07bbc7,
+    0xbff6f69f, 0xa96b6b72, 0x7ead2eaf, 0xe496fe48, 0x19efe496, 0x64f7685e,
+    0xdb182149, 0x1fd84f90, 0x7dd7333e, 0x3c897b5b, 0xd3fd2e8d, 0x99042a54,
+    0xf2647a00, 0x1938d417, 0x4510e6c7, 0xd7cf9d9f, 0xffcfec9f, 0x9dd68100,
+    0x0cd0db58, 0x2c4fa55c, 0x1eefec5e, 0x121f6727, 0x30e4f34b, 0xabfcf7dd,
+    0x5a99d6f1, 0x160cab07, 0x1f251bab, 0xbbbe4732, 0x931f0b42, 0x8a159b14,
+    0x9301efab, 0x9c2fbf3b, 0x74d3a31e, 0x9a456109, 0x2b23a5a0, 0x376d7525,
+    0xa16d924c, 0x4c152541, 0xe784eaca, 0xdc65458e, 0x29fc98a0, 0x1a7d34e9,
+    0x911e2d55, 0x27c372b9, 0x76c6d243, 0x55863392, 0x389571f0, 0xe311a4f2,
+    0xaa3414ab, 0x0e1df271, 0xb9bbc08b, 0x5d93de9a, 0x51180364, 0xbd8dd402,
+    0x4833bfc5, 0x78e00348, 0xf4f5d339, 0x48df5dd3, 0x382e9ded, 0x8bc545a7,
+    0x0d6a54d6, 0xde6d1c5a, 0x8c63ec5e, 0xa2e99704, 0x8ded1645, 0x9e35bfe5,
+    0xa382d4ed, 0xaed2a3c7, 0x3a933056, 0x7b3db24e, 0x57a61c3c, 0x90e8b6e3,
+    0x70d75961, 0x3c02aa13, 0xa1d6dd38, 0x6475fadd, 0xf82d2f79, 0xefac39b5,
+    0x8a1b3dad, 0x8c3ce7f1, 0x3b6f4a93, 0x23cb24a4, 0xc33406ec, 0x0b0ed52e,
+    0xd7fddb75, 0x4d516ba3, 0xf40b75ea, 0xf9bd81a7, 0x92ccc9b2, 0x49a05800,
+    0xdcdc2e67, 0x1d647cc4, 0xb101a0ca, 0xbfd83e74, 0x4f921b5e, 0x7b3cd124,
+    0x2eac49d2, 0x4ec91ee6, 0x2bf74856, 0x00e49e8d, 0x5c467778, 0x51cd0960,
+    0x2f9e0e2f, 0xc05a0e35, 0xd577b116, 0x861572b4, 0xe5b2d0c6, 0x09365255,
+    0x9d698f00, 0xdc59c438, 0xe9acd73a, 0xb816deb4, 0x7d681e2e, 0xd43a6455,
+    0x62589ed5, 0x70136478, 0x097b344b, 0x98440175, 0x95ab7d05, 0x8f50bd7d,
+    0x146ed44c, 0x2da9b582, 0x2c234155, 0x44b20c77, 0x2761c055, 0x5957ef0a,
+    0x28bb0d9b, 0x63554664, 0x0dbffab5, 0xa27eba0a, 0xd59a2096, 0x9ccc86b4,
+    0x32c5ac76, 0xbcc39cd5, 0xb2df5b0e, 0xba430597, 0x48a0f132, 0x6c8ba34c,
+    0x191db37d, 0x9a1dbfa6, 0x51c82eb1, 0xad347263, 0xa789c34d, 0x3c84788f,
+    0xec281bdb, 0x4256955d, 0xb1d939d8, 0x1dba682d, 0x98302fa3, 0xd58f9094,
+    0x25a6d4e9, 0x89642401, 0x8d6564b8, 0xa4015876, 0xc8aeac10, 0xe884478e,
+    0xd74d9fdc, 0xc246456c, 0xcbab24c3, 0x5d0382e9, 0x1d4894a4, 0x1f2491e4,
+    0x24767a50, 0xf16c75b5, 0xdc5496a2, 0xcddbf72f, 0xa7a3067d, 0x615a7ac5,
+    0x9e9947a3, 0xb7bc89b8, 0x2bef4b34, 0x45fae52e, 0xcd5fa1cb, 0x076db81f,
+    0xac970e3d, 0x5d5f00ff, 0x1e9d3e8f, 0xe825a89b, 0x5ce691b9, 0x2613d7ab,
+    0xf980e136, 0x3b8155c6, 0x9f13fcb6, 0x0a6ea303, 0xd3b5e4ba, 0x61ad8245,
+    0x22d2c22b, 0xca21c229, 0x9c45144e, 0xfff6a110, 0x70ce0700, 0x84baeb01,
+    0x66cb69b6, 0xcfab7615, 0xec8c1459, 0x90aab00c, 0x827ccea9, 0x0fbae23c,
+    0x16ee47fb, 0xffd8d85d, 0xfe27fd00, 0x36bf501d, 0x5bba4295, 0xe7b41cab,
+    0xca535659, 0x0d94503d, 0x69e308d0, 0x2498de25, 0x1011dc96, 0x0398e036,
+    0x722bb5a8, 0x592a074f, 0x4d8e0b8a, 0xcc36a62f, 0x9459e341, 0x92fd8e18,
+    0xb3bcd82e, 0x58f26ca4, 0x9d03c411, 0xed66bd6f, 0xfaa914fa, 0x83a8b3a6,
+    0x2e1fcf14, 0x0886354c, 0x57a8724b, 0x1a31be12, 0x99c7e62e, 0xfa0d9019,
+    0xde74e937, 0x32a9a3d4, 0x97d2a6c7, 0x31b3358e, 0xf3a468e6, 0x056ca7b9,
+    0x555562e3, 0x321f36f0, 0x9a9458fb, 0x379675dc, 0x6155a9b7, 0x4846c438,
+    0x60a7dc88, 0x6c72043b, 0xe2065df2, 0x9e0ff3a7, 0x5634b797, 0xef291a8d,
+    0xa2a3b2f0, 0x8077ab2e, 0x4b9f92a7, 0xaccd6e9f, 0xb53152d8, 0x410c2388,
+    0x96327dee, 0xd5ba6e9f, 0xc592517d, 0x914ed34b, 0xdf85b3ea, 0x113d8d15,
+    0x316ecd8a, 0xb13c47b4, 0x0e39d388, 0x328c6a17, 0x249628f7, 0x005836ae,
+    0x99f42f4b, 0xc45596f9, 0x66365f58, 0x9f3b39e3, 0x1db8731b, 0x41a5edc7,
+    0x97ce506b, 0x5b13235d, 0xb6db4224, 0x2b53e1ec, 0x22fe6dee, 0xd3369c0b,
+    0x1d27389f, 0x284dc176, 0x526bad5d, 0xa236278a, 0x3cc103ae, 0xd2ceb4b0,
+    0xca481442, 0xb2d10eb8, 0x50ee0bb1, 0xd431b2a5, 0x32ddbdfd, 0xa9cd0eea,
+    0xeff6eac3, 0xbcdaf127, 0x27872ac0, 0x3248b01e, 0x024aec30, 0xa723313c,
+    0x598d565d, 0x35567cfd, 0x86084d13, 0xc2ec9976, 0x6b2a5a77, 0xadb0d9ac,
+    0x22735b16, 0x4c050bcc, 0xa75d0780, 0x483da72e, 0xc69f36ee, 0xd3b2e796,
+    0x8dd9e44f, 0xb8400286, 0x68b182c4, 0xb8df46de, 0x0edc6419, 0xdaab9158,
+    0x1cad503a, 0xee0856cf, 0x4a700cb7, 0x6699f393, 0x47166032, 0x32331741,
+    0x1bc167ed, 0x1b65469a, 0x18b5d449, 0x20746a68, 0x6d832eaa, 0x56b33795,
+    0x17261996, 0x481e4924, 0x1de64818, 0xd6082ad2, 0x6577fb50, 0x5aa72af7,
+    0xd32c5674, 0xc72c11f5, 0x14935b7d, 0x4b3b324d, 0x2ae095b7, 0x5e1c6f9c,
+    0x98e236a8, 0x1a0fb801, 0x907a828c, 0x0d9f7a34, 0xa5ad20c3, 0x694988d6,
+    0x982f85ab, 0x08d39d58, 0x49fdd3d7, 0x5c794858, 0xf91d5eed, 0xc6aaf5f6,
+    0x87b452c3, 0xe6460e38, 0x20197804, 0xf8f81979, 0x3c82cfcf, 0x75fcd211,
+    0x1d3f85da, 0x2c8526a4, 0xbd533dc2, 0x789ea279, 0x77520964, 0x44aea001,
+    0x4240f9d2, 0xc71643c6, 0xa9bf3a90, 0xedaabee9, 0xae56a163, 0x258d018d,
+    0xb5a1098a, 0x1645d20c, 0xaee4821b, 0x94b751a1, 0x2a152bca, 0x3a2729c0,
+    0x5adf9e2d, 0x0faa05ab, 0x5366942d, 0xcf0dab61, 0xf81e89bd, 0x0f60ac90,
+    0xb0dbde68, 0xd6efbf33, 0x824a6fad, 0x39a58ab8, 0x71658638, 0x606576b3,
+    0x96d6afd0, 0xd4aed0bc, 0xc90a3e76, 0x7bec46e1, 0xe4d6ea4b, 0xfef39ad5,
+    0x719879c6, 0x14cb0c6d, 0x40aac480, 0x2a54715f, 0x1e5b0630, 0x089d4f32,
+    0x568d4ad9, 0x7a569fa6, 0x492b378d, 0x552547a9, 0xab30848d, 0x91a05616,
+    0x4d0203e3, 0xc64392b9, 0x0a1dc81b, 0xafa95dfa, 0x57ea9656, 0xa7c75bb9,
+    0x48274eaf, 0x44b35dda, 0xeeaa30cf, 0x7d6864b8, 0x4ba89091, 0x5d00627e,
+    0xd7a3d432, 0x2cea58c9, 0xd27a1688, 0x95485c49, 0xc800b858, 0x12f54648,
+    0x619d63c0, 0xc936908f, 0x7a20a23d, 0x87e53eee, 0x1825ab48, 0x1937aca9,
+    0x7344c5d6, 0xf93b9a13, 0xda256916, 0x019f1cb8, 0x06366563, 0x9d476cd6,
+    0x6ac92cd6, 0x961c7956, 0xf3b12476, 0xff587e92, 0x5178c000, 0xd60160e0,
+    0xe4571076, 0x0f00ff7c, 0xdb7fbefc, 0x3ef767d7, 0xa445609d, 0x2dcd2277,
+    0x3b15ab7d, 0x43cd7a4b, 0xb0c8da5f, 0x5e64785a, 0xa558e15a, 0x6bdc2479,
+    0x1191296e, 0x746d3505, 0x8ee09769, 0x9f0eaba1, 0xc513ab18, 0x4aa43470,
+    0x8c683ccf, 0x459eb81e, 0x96616a9b, 0xfcbefd78, 0x695eda95, 0xc2add462,
+    0xb556436f, 0x55481698, 0xf16ade69, 0x29515832, 0x2cc8910e, 0x6510cc6e,
+    0x64199108, 0xb9ebf62d, 0x2a1ded25, 0x916e739d, 0xea7d66b5, 0xeeb72489,
+    0xcbd99840, 0x8d476d80, 0x7fda62ce, 0x3c7e3e36, 0x66f73ae8, 0x5f45b134,
+    0xe4d7f44b, 0xd72a53e6, 0x9058e248, 0x6e8f50b1, 0x98ec28e1, 0x24970f07,
+    0x2ad8f90c, 0x7b5e9469, 0x220130f3, 0xbc96667e, 0x46b254da, 0x6e92cc16,
+    0x4f583f92, 0xbb718622, 0x514e926b, 0x973cb759, 0x25a55329, 0xcf3a555f,
+    0x2c8d8f63, 0x499efeac, 0xf2b791d7, 0xb94c702c, 0x87389244, 0x80897cbf,
+    0xa17a0670, 0xad7cdadc, 0x56f22a35, 0x1c47ab59, 0xca8021d6, 0xaa4a8c22,
+    0x44e3ef43, 0x1f97f171, 0x5de838cb, 0x1a3c6bab, 0x99d9f8a5, 0x0e16478b,
+    0x220aa53d, 0x5044423c, 0xbf4ff0de, 0xb68a3b23, 0x4e77bd0e, 0x763cd58f,
+    0x95a4da9d, 0xb47b96a6, 0xa43d8c5f, 0x099a578c, 0x2ab1b84a, 0x65b424ed,
+    0x950bee4a, 0xfda7ee3e, 0xce50ea22, 0x820a5aeb, 0x78697f24, 0xfaf8925c,
+    0x686ffbaf, 0x6dd24d96, 0x271702fb, 0xe9afea19, 0xa38d5123, 0x3556eb49,
+    0x609d8544, 0x43956259, 0xe6c4032b, 0x6241da77, 0x89fb20e3, 0x5b22c8f8,
+    0xc435ea93, 0x7a4244da, 0x73dd6396, 0xb15dfaeb, 0x734621c9, 0x87251f0f,
+    0x8cb84b59, 0xdb72697e, 0x21d59db1, 0xdb355ed5, 0x287a41a7, 0xd8ab69e6,
+    0x31e6189a, 0xaadecc47, 0xec9c474e, 0x446eac96, 0xec765d4c, 0x424a51fa,
+    0xb366d781, 0xae697227, 0x94614991, 0x5b0c2bdb, 0x8d222539, 0x1939b193,
+    0x6efb7113, 0xf5c41f75, 0xe3df66dc, 0x3e6d1e97, 0xa26163cd, 0x397ee168,
+    0x638cfd24, 0x6dbc93fc, 0x1c7b0390, 0xd27a3ee3, 0x7614b5e0, 0x301bc51e,
+    0x4b335cc4, 0x8ee34828, 0x90165c34, 0xa842e8c8, 0xd8aaccf2, 0xad63cc1f,
+    0x971e0366, 0xcc524332, 0x4f82a3e5, 0xd7841953, 0xc89f2ac7, 0x8221e765,
+    0x071161f8, 0x1000ff20, 0xcf120b2b, 0x66a9635d, 0xee42b352, 0xa4c2878a,
+    0x7837cca8, 0xcd8d9f00, 0x7a920fb4, 0x2b45aea7, 0x1ae476b4, 0x2a111d7e,
+    0x08b29adb, 0xfe51a690, 0xad50979d, 0xef9c3b86, 0x07e32727, 0x976f91aa,
+    0x6aedd452, 0x922a75da, 0x9108607b, 0xec1a6449, 0x28933c6b, 0x63566c0c,
+    0x83776524, 0x3d70c89d, 0xba6aaba5, 0xb1f4566d, 0xbdd35b5c, 0x15538285,
+    0xcd118664, 0xca4bdb2c, 0x9dcd7213, 0xae954cc6, 0x77e04e9e, 0x5ab8ef31,
+    0x8abfe13e, 0xe1026bf6, 0x6fcb8ee5, 0x5a869576, 0xd0906c55, 0x4711f3c9,
+    0x20e5c764, 0x93310878, 0x3fc71f8f, 0xbffcd71f, 0x311ea6b3, 0xfa2300ff,
+    0x423d88bf, 0x9cd9b81c, 0xbfeefee7, 0x459abe0e, 0x2dc3362b, 0xc4556a28,
+    0x4806a176, 0x9bea1a50, 0x56a691dd, 0x0389b34c, 0xe336506e, 0x1badc5c8,
+    0x6e491ab9, 0xbc31e509, 0x697d39ca, 0xec10e9ce, 0xb4415642, 0x5c307cba,
+    0x91e1c663, 0xeeddaed5, 0x3565ba0b, 0x219da291, 0xb265c669, 0xb974e3a8,
+    0x5276de3b, 0x48fb8adb, 0x0e7f2066, 0xd5d58eb4, 0xcb8adc69, 0x24473ba4,
+    0x5a2b4978, 0x5060952f, 0x1be12409, 0xeeec9d02, 0xee1ef8b8, 0x673696a3,
+    0x1a46ae85, 0x14c570d2, 0xf7ae857f, 0xcc638d38, 0xa152da56, 0x191b1799,
+    0x5000fffc, 0xd54fcbe8, 0x9b8e3a20, 0x5160412d, 0x6c48f160, 0x811189ad,
+    0x67942d83, 0x85f66262, 0x1848c31b, 0xd2a45e7e, 0x124e71e8, 0x8dda9424,
+    0x50abcc6b, 0x4a7bbcaa, 0xb3783e81, 0x52940f02, 0x74941f5b, 0x1b2a559a,
+    0x0ceb1a5e, 0x24269931, 0xe5088a16, 0x885b5277, 0x62e61ebf, 0xac3d3e58,
+    0xeb41cc3e, 0xec0875bb, 0x218cdae8, 0xc97b3d5c, 0xb36dfa01, 0x678c5811,
+    0xb9c74b95, 0xa40be1bc, 0x949804b8, 0x5fed2775, 0x9f9c00ff, 0xad27fafb,
+    0xed59eb1d, 0xb27d5ada, 0x3cc7412b, 0xc351ccc6, 0x33e4892d, 0x0ba4124a,
+    0x7293c921, 0x25a80209, 0x03ed81f6, 0x7aee5c3d, 0xd4d1ea70, 0x87f02ca5,
+    0xb5f00cd9, 0x58cb8272, 0xbf83488e, 0x224e9b1c, 0x37c83195, 0x8d432389,
+    0x96a5e780, 0x6e749b48, 0xdc75f8c8, 0xe8daa9a4, 0xec23e3c8, 0xf85bc5e8,
+    0xebf820a9, 0x667975b3, 0x06b5e8b9, 0xaa2435ad, 0x92aeda7c, 0x64700c49,
+    0x37dbc422, 0x5484cbb9, 0xfbaab691, 0xe446af54, 0xa59ae952, 0x5acd5aca,
+    0x79348fe6, 0x86db51b7, 0xad00de68, 0x27821aba, 0xae50dc45, 0x101937d9,
+    0xd1904282, 0xd3687724, 0x9aefac8d, 0xf52c8075, 0xbad38632, 0x160bf357,
+    0xd3ce4488, 0x5f5d88b3, 0x036ca131, 0xa35fd481, 0x799227cd, 0x6416eea6,
+    0xd02d5a36, 0xd91eb957, 0x1cb3495e, 0x1632c38f, 0x70f06ffa, 0xd6ce1736,
+    0x6c632f1d, 0xe7d126a6, 0xe81a75d3, 0x721d1262, 0x2d68bc1b, 0x886468ec,
+    0x6e94cb9a, 0xa0b0bd51, 0x11e47c2e, 0x8a74d5d4, 0xccaa9e08, 0x71a72486,
+    0x48c0b06c, 0x2df8d51a, 0x4a1ac570, 0xb24a484c, 0x4f164aab, 0x86e86a64,
+    0x27a1d641, 0xbdf26968, 0x8f344d7b, 0x42ea1c37, 0x0c1be233, 0x350fb348,
+    0x5477e369, 0x00465c96, 0x1d2ba4dc, 0x79ada3ca, 0x8ae68ef4, 0xdeb46a9d,
+    0xdb926619, 0x23cca8c3, 0xeacc8547, 0x5ea914ad, 0xe4b50c11, 0x329bd991,
+    0x766f85b5, 0xa851ef37, 0xf934f669, 0x1432afe5, 0x7e19ce68, 0xfda9c8df,
+    0x61956fe4, 0x82e0f1f3, 0xc267543a, 0xd0bafc0f, 0x48b41834, 0xb5baeaeb,
+    0x9759126b, 0x3e759a6c, 0xddf85010, 0x2bc96cea, 0x52849144, 0x31bf4325,
+    0xb8ccbf01, 0xbb7bd355, 0x8b1f6b7d, 0x5ab1b2c7, 0x7859abd0, 0x9ca785e7,
+    0xb848703b, 0xc4c07d76, 0x824c41be, 0x810400ff, 0x313beb61, 0x1a698506,
+    0x8a24807b, 0xe4b66dd8, 0x410cf158, 0x118ba836, 0x3bc0878d, 0xae973fdb,
+    0xad7eb9eb, 0xb7e0d53a, 0x311917b6, 0x5f6379d6, 0x9c0f03cb, 0x2e6e2b32,
+    0x491e088a, 0xd4d6ae23, 0x54ae49ef, 0x752656f5, 0x4d5465d9, 0xfe1ecb33,
+    0x654c1102, 0xc84f70f0, 0x9e8113f7, 0xd4a6b8a0, 0x0574d438, 0x5d833add,
+    0x99c466ab, 0x29123096, 0x2ae62043, 0xdbc4e442, 0x48f0a35d, 0xecce27f2,
+    0x3586d05e, 0xa7c7e3a8, 0xfe76861b, 0x7cefc7ac, 0xf327dbe7, 0x0c753c1e,
+    0x84230a76, 0xdd386f12, 0xfe3e5e0c, 0x406518e2, 0xee930fc6, 0x179ca1e9,
+    0x1e438276, 0x8768fac5, 0xb9cdfd7e, 0xb0727bbf, 0x1b040228, 0x73dcb176,
+    0xccf6ab81, 0xc962b01a, 0x5fa3c936, 0x0b4a3230, 0xd2fbac24, 0x581b4775,
+    0x191974f8, 0x73be8251, 0xb55e76aa, 0xa388ed56, 0xd57872a5, 0x69a592fd,
+    0x0da7c836, 0x9c71fc91, 0xeac17d1c, 0x65d5d50e, 0xad64389e, 0xc3660462,
+    0xa80c244b, 0x49b20583, 0x006ee7f1, 0x8ef196cf, 0xe8d00ab5, 0x2d99c3b4,
+    0x4b0f2234, 0x190916c7, 0xce913933, 0x501f57e4, 0x490127fd, 0x75f42403,
+    0x4977deee, 0xb9a7859e, 0x3159bccf, 0xf1b6a440, 0xdf39acc0, 0xcaed4bf6,
+    0xcc70deed, 0x12fa0f3c, 0x8a386c19, 0x21246914, 0xcc524488, 0x61bb14c1,
+    0xaa701254, 0xd7e18f4f, 0x8dbae869, 0x936a101b, 0x3aad6654, 0x8ea84632,
+    0x76f236d3, 0x44b0c3b6, 0x24b7a203, 0x97bfdd9e, 0x6a4bcfc9, 0xd7ae493f,
+    0xb83e7d8a, 0xb3a6bd86, 0x093edd25, 0x8ae7a5b8, 0x92cacc0c, 0xbe3125be,
+    0xedbc6757, 0xd6d9dc6f, 0xf59c2e91, 0xd1b3b429, 0xc63a2533, 0x6aad6029,
+    0x82d06233, 0x58560333, 0xeb288ee2, 0x3b0b8da4, 0x23e5de1d, 0x867bbc62,
+    0x6b502996, 0xcb3daa2b, 0x62c33bad, 0x7eb16038, 0x9ea3d9c6, 0x043fadcc,
+    0x964564af, 0xd598ca78, 0x5d607500, 0x6ab3c086, 0xa10853fa, 0xac8a2caf,
+    0xf9b41956, 0xd1ceb5e3, 0x9c44b13c, 0x652c5461, 0xbcb2511a, 0xf9709eb0,
+    0xce69d78d, 0x354143af, 0x2797ac27, 0xc7c96d8a, 0xf52cc56c, 0x01c988e7,
+    0xb2ea3671, 0x6c1c4dab, 0xab4c27a2, 0x7d99446d, 0x6fbfd69b, 0x1bc1edf6,
+    0x5c6b77eb, 0xa52226d4, 0x0a00ff65, 0x6489cb42, 0x289e5548, 0x3abb5204,
+    0xd79180b2, 0xdbda55e3, 0x2eead5cf, 0xdc908bde, 0xfc55edd5, 0x291d2926,
+    0x195aa359, 0x4dc417da, 0x5ada6815, 0x053b6a49, 0x311fcbd0, 0x95442994,
+    0xb9df3fec, 0xeedb6eb4, 0x47058ef4, 0x1804f5d3, 0x923d76a3, 0x951592d7,
+    0x2259984d, 0xa59b7d85, 0x3382fc6d, 0x1ea69b0c, 0x27ad97d5, 0x50a763f4,
+    0x241835bc, 0xac30d492, 0x104bd512, 0x509e550b, 0x62629edb, 0x5c1432f1,
+    0xaed8a7c0, 0x157edbe1, 0x9e3b9644, 0xb1e1347b, 0x90be11db, 0xd3429581,
+    0x2299a77d, 0xd91aed5d, 0x9deeb2f6, 0x46a32986, 0x9bfbb932, 0xd451bd9d,
+    0x8de615bc, 0x2d38090a, 0xd4e7a669, 0x8589c406, 0x448a2429, 0xae42c692,
+    0xdb089be2, 0xda494f92, 0x2c1310f5, 0xb126b957, 0x29d08e34, 0x2cdfa348,
+    0x3b30a3d3, 0xc0792c18, 0x23874365, 0xac9ef368, 0x65932676, 0xb028bd01,
+    0x1bd9cacb, 0xda57e491, 0xb1b37730, 0x52544465, 0x05e47e19, 0x63bb6124,
+    0xcd2bd243, 0x52414c6f, 0x4d0283d0, 0x5b8b3c44, 0x6b5f6038, 0x8d04a9ba,
+    0xb3fd7cd8, 0xe438eaf6, 0x9f68cd86, 0xe6d5ed52, 0x98b02296, 0x77c09e5f,
+    0xc812cc83, 0x9c1cb9e1, 0x8d497644, 0xe3c2e3d0, 0xfadd95a3, 0xd7ed81ee,
+    0x20e28c23, 0xf5b70fc5, 0xa9f3c067, 0xf887b41f, 0x47d4e78f, 0x9104992b,
+    0xb10e2367, 0xf071f0ee, 0x9147be15, 0x633fc0e7, 0x4790ade3, 0x60a4b517,
+    0xacfdeda9, 0xacf90399, 0x00ff4872, 0xa39e18d8, 0x7fd6b25a, 0xa9dba94d,
+    0xe82d22ed, 0x72c500d1, 0x15042118, 0xaf6c3856, 0x325256e6, 0xee74570f,
+    0xf8c5b9e3, 0x6af6da7d, 0xd624413b, 0x7ab251e4, 0xac430992, 0x60968c32,
+    0x77be9236, 0x4d47d626, 0x274a12e5, 0xfca68948, 0x62a11b4a, 0xfe691af3,
+    0x4b704996, 0xde226906, 0xe34915ca, 0x035c2912, 0x77dd0db4, 0x4a97b735,
+    0x717c4c49, 0xdcaef2cc, 0x50c6dd87, 0x6e84e52b, 0xf94126a3, 0x3290d80f,
+    0xd64fa73a, 0x335eab59, 0x5ca649b6, 0xdb681f33, 0xf64fccc8, 0x2419002e,
+    0x00ff7cfc, 0x1a5ea1d1, 0xf156ab66, 0xd45b237e, 0x2f6d9248, 0x304d5fb6,
+    0xf9daed84, 0xed33a51c, 0x73fbf823, 0x00ffaed5, 0x5e4b9fd2, 0x480d133b,
+    0x7a7b5fc1, 0xd90c5549, 0xf8e1d48b, 0x9723c0f8, 0xdc8f4705, 0xdd4bc7c1,
+    0x5a2b0d7a, 0x63421b7d, 0x7d969aa2, 0x6a034644, 0x0d59885b, 0x3c272d14,
+    0xbcc3f7e7, 0x8c3b0692, 0x543b188d, 0x56bade49, 0x8653acab, 0x52abf59e,
+    0x6885e20a, 0x559496e3, 0x693d936c, 0x02cc2139, 0x58564bcc, 0x72a458e3,
+    0x1b44fda0, 0x58ee6ec3, 0x2f749bf5, 0xe94ca045, 0xd3dab5a8, 0x8628c3ba,
+    0xac60dac4, 0xacb416a8, 0x9f2514c8, 0x9cba2a32, 0x80fa79f2, 0xd4556d37,
+    0xf59834d5, 0x58755937, 0x94f84f28, 0x355e568c, 0x9cde7892, 0xab5c2476,
+    0x09de214c, 0x10f258ce, 0x17c6f04e, 0xc6abead1, 0x7c6743fe, 0x63240153,
+    0x305295f8, 0x3fc81801, 0x3af2066c, 0x457c7b36, 0x6349c5cb, 0x4866db60,
+    0xbb2bfb20, 0x553e7015, 0xf8384756, 0xcffd9801, 0xaad33746, 0xc51a34cf,
+    0x5de5519b, 0x5a44c7ab, 0xb2328b91, 0x2ec9f785, 0x79bb2c4c, 0x645c601b,
+    0x77e88908, 0xc690a46d, 0xd612bd25, 0x8d270b12, 0x4dfb3610, 0xd2e81f1a,
+    0x27455808, 0xe5819190, 0x60e31c9b, 0x110baca1, 0xb7ea90b4, 0x4a93462b,
+    0xfae1a7e6, 0x7d65be8d, 0x8ae526a6, 0x9381e114, 0x222ba8f2, 0xabe41cc8,
+    0x6ed7a663, 0x5b60783d, 0x9f57234d, 0x7514e595, 0x8e382ca9, 0x38092463,
+    0x0006bc82, 0x461285f1, 0x3e22b9fb, 0xa6539e0f, 0x99dac4f7, 0x8d004794,
+    0x8b15abe0, 0xc8969a11, 0x96934984, 0x5922e29c, 0x0b871576, 0xd6765f30,
+    0xddb90852, 0x77ccd4d1, 0xf8248527, 0xd663f05a, 0xb1d2fec8, 0x242f0143,
+    0x42d1fb8e, 0xb82ec904, 0x35a92323, 0x33045a6d, 0x0cc2952e, 0x5b1669c2,
+    0x12b75ad1, 0xc99086b3, 0x2884d514, 0x8a6432a1, 0xa0c8ddad, 0x146097f0,
+    0xeb6dd6d9, 0x46a7e257, 0xca2a9ca6, 0x5ea626f3, 0x16567d39, 0x59ca1136,
+    0x82851f4e, 0x2e49ae7e, 0x22ce6a4c, 0xb251b7df, 0x9542ad74, 0x78d32338,
+    0x472229a6, 0xae7eac6a, 0x4ea2d652, 0x03d6ae3a, 0xc64ae1f2, 0x73351a78,
+    0x840aae02, 0xed2eed32, 0x706b3beb, 0x1c83a3d7, 0x6856ed2d, 0x0120adc9,
+    0x70cce247, 0xc023df04, 0x5bd551cf, 0xd11cab0a, 0x6abc98b0, 0xae243107,
+    0x4672e3e0, 0xc3da1554, 0xf691873b, 0x420d7a3d, 0xf4cd48bc, 0x81c13416,
+    0x1e69ac7e, 0xeaca3e40, 0x784048cc, 0x7c822ff6, 0x5a479c8f, 0x87a225c4,
+    0x6d225259, 0x929516ac, 0xe1f97c03, 0x12399952, 0x27dfee93, 0xecc6f7b9,
+    0x6a6c7d8e, 0x9bedf59b, 0x39c58714, 0xa11c7013, 0x05b3be4f, 0x6a6722c7,
+    0x773f25a8, 0x6aabab08, 0x80daa72f, 0x2e59a82e, 0xa549624b, 0xdd26ed5a,
+    0x23b0c0f2, 0xc29c22e5, 0x616a0439, 0xb11c90e4, 0xec8e0f60, 0xe2694549,
+    0x1a7f63b1, 0x7690091b, 0xf83ab2c8, 0x9ff2a0fd, 0x48c87a03, 0xf07e36f2,
+    0x9214d0b6, 0x1bcbd112, 0x0523b28d, 0xe0c09d61, 0x5be50da8, 0x7ce4dd07,
+    0x461d1fe4, 0x8d6c238f, 0xc286dc5d, 0xfb98a5c6, 0xe4513849, 0xcb3fc9f8,
+    0x7092483d, 0x0dacd50f, 0x0eccb8c8, 0xad82dd17, 0xee638cbc, 0xe8f87ca4,
+    0x842661c7, 0x04b3123c, 0x66a1c265, 0xda276d04, 0xf2007206, 0xb41e9c31,
+    0x5afce578, 0xda273516, 0x91b9d923, 0x48f2dae3, 0xc7285204, 0x44fe63bb,
+    0xc608f2fd, 0x0e1ca53a, 0xf9cafab1, 0x26629b3c, 0xde0c1943, 0x439b2414,
+    0x0af9382b, 0x9e8c7146, 0xabe61eb5, 0x2a25cda1, 0x288e64d5, 0xf0d39b2a,
+    0xbcac3b3c, 0x3bcb74a2, 0xf13166a9, 0x4f4f06ef, 0xccdcd896, 0xbbbf4dbf,
+    0xc74cd53a, 0xa533c9d3, 0x22b69854, 0x504e630e, 0xf6797662, 0xbbf1aabc,
+    0x1b45a4b4, 0x293f8072, 0x6eaceeea, 0x9e5d97e9, 0x6eb49e8e, 0x6ccfb144,
+    0x06562209, 0x41630e26, 0x181267ed, 0x58fe10b6, 0x3a0e0c86, 0xd95badbf,
+    0x74d66ea8, 0xa312e17a, 0x0c8cc0ab, 0xdc485422, 0x9265e1d8, 0xf11ccec2,
+    0x6e31a465, 0x5c29948d, 0x092b569b, 0xf4692735, 0x17097b15, 0xba909e34,
+    0xce4a9a28, 0xd88cb34d, 0x816f9879, 0x898971db, 0x7a462a65, 0xaaddacab,
+    0x965a5a67, 0x35525087, 0x4a0a2078, 0x04c48851, 0x6282d18a, 0x7b739b93,
+    0x1bcc9ff6, 0xbbe928c3, 0x544f59c3, 0xbf3ddcc9, 0x9381d50f, 0x303c47f5,
+    0x4f92bb9d, 0x9e9c4ca0, 0xdc4ea67e, 0x8ac7159c, 0x4e7bd77d, 0x9b576b49,
+    0x62c9b140, 0x4f47a335, 0x79ec6bac, 0x99696649, 0xc6d93516, 0xc42ccd92,
+    0xdd4efb33, 0x098d08e4, 0xb5b61b90, 0xdbfa6a09, 0x258905b7, 0xa11fec81,
+    0xd46b8d18, 0x3fb292e4, 0x29982a04, 0x79171285, 0x7523af30, 0x732bed76,
+    0x20956a3d, 0x8c28a492, 0xd524a9cc, 0x10db77e4, 0x276ec396, 0x7c4457d3,
+    0xc91b272b, 0x09248203, 0xddb41922, 0x0a92d028, 0xfa5ec1d1, 0x410dda88,
+    0xabd89063, 0x2c784875, 0xd04db245, 0x1437497d, 0x37bac788, 0x27568921,
+    0xa5527fad, 0xb5967b05, 0x7df55887, 0x1a26bc2e, 0x10c3eef5, 0x677663d4,
+    0x62cd5a86, 0x5ccacdb3, 0xb4f6244a, 0xf70949f1, 0xaa95ecb2, 0xdd6f1777,
+    0x508be482, 0x249f36c3, 0x97b8955a, 0x84c4864c, 0x4a6b7487, 0x7557b81a,
+    0x26590792, 0xaa20561f, 0xaf97e577, 0xb19cb2ee, 0x91508ba1, 0xcbd16896,
+    0x63c4f10a, 0xc6106449, 0xc36ab458, 0xa62c1e33, 0x627e92ed, 0x7ead7a3e,
+    0x7ad6556b, 0x099addb3, 0x0530db01, 0xb1f6ed83, 0x2327e3dd, 0xe7fcfbc9,
+    0x6fd6d0ef, 0x53b19ce9, 0xb72874d5, 0xf14492ea, 0xe16eb3a4, 0x6c2c1187,
+    0x2296fdbb, 0x18c91154, 0x3c56eef6, 0x70373dc3, 0x7fce4cea, 0x9ad9d013,
+    0x9d3997f3, 0x214886be, 0xffde4a4b, 0x32c88000, 0xee6d3fbe, 0x24a9ceea,
+    0xd898d7d2, 0xbd9664d0, 0x8824db87, 0xb7ab48c6, 0xc8048489, 0x4ded58e5,
+    0x47daf7cb, 0xe7d5932f, 0xb02844fc, 0x6b30bbfd, 0x6757c958, 0xe4b71415,
+    0x322cc925, 0x7f051933, 0x69e879d7, 0x8dac7a7a, 0xdff9dac5, 0xe783fb60,
+    0x0cdf08d2, 0xb1869c9b, 0x804f18bb, 0x3e3671fb, 0x3f9eed3a, 0x66ee74c7,
+    0xc4958b55, 0x2c6ae7ac, 0x96431966, 0x920b653f, 0x63fe414e, 0x28bd5ca9,
+    0xda143ce9, 0x6d41a611, 0xdac43102, 0xea31425c, 0x9c9766e0, 0x34eb6d14,
+    0x5144bad3, 0x3bb86753, 0x180d6249, 0x8ad06bfa, 0x522a76ad, 0x678d8a6a,
+    0x2f9b4e8d, 0xef0e89cd, 0x27426874, 0x70791187, 0xab9ed3be, 0x2b4ba247,
+    0x22f5b85d, 0x5aef349d, 0xa01bcbc9, 0x35c3d6d2, 0x9951817b, 0xbcc73976,
+    0xe357e49f, 0x8c44632b, 0x40a8cd48, 0xa7a6699b, 0x12526626, 0x9200ff94,
+    0x85e5cfc9, 0xeddbedf1, 0x6cad03fe, 0x9935d6a4, 0x060bb405, 0xf24a5693,
+    0xe2955def, 0x1eeb2cb1, 0x4b0913a3, 0xc6295ec4, 0xacc34566, 0x2ae4dd47,
+    0xaad98bd8, 0xe1e0581e, 0x8e48e9d1, 0x889ec6b2, 0xbc0979dc, 0x3623e0be,
+    0x2cc98c05, 0x8946a26e, 0xeae5fef2, 0xf53a7419, 0xea415d66, 0x5b2bc4c9,
+    0xc6eb81be, 0xd3873604, 0x4bbaf29e, 0x4fbb021b, 0x8ace749f, 0x33c057ca,
+    0xcf326cbf, 0x4540e91c, 0x1baf854b, 0x5824d196, 0x738a1124, 0xc7af21ca,
+    0x21ad4c22, 0x03d8e658, 0x52de1fa2, 0xc46e2fb3, 0x68ed15b7, 0x1ea42b81,
+    0x955758a4, 0xd3e732a2, 0x3a7f4e1b, 0x0ec2b0bf, 0x6c8507d2, 0xda0e1363,
+    0xb1a4498a, 0xc7529c76, 0x517897c6, 0x04d26a44, 0xe8cee6f4, 0x6d98915d,
+    0x2493e4e0, 0xea711712, 0x1628b479, 0xa7c29fc2, 0x2956cd5a, 0x438993cd,
+    0xea45b0cb, 0xf2c6e259, 0x96b318a4, 0x3d1f8f7f, 0x56d3126a, 0x453ad413,
+    0x51ebb479, 0x879307f3, 0xa18d5833, 0x0826098e, 0xec589e78, 0x399a8539,
+    0x76c6c936, 0x4b0606b2, 0x2b59dbf2, 0x3e1d965c, 0x52c3329c, 0xaf5197f8,
+    0xc892c462, 0xd1009251, 0x2659c5d7, 0x4a94173b, 0x1177e324, 0x65851c41,
+    0xb4d44f8f, 0x1fae21fd, 0x88bfca47, 0xea2a5920, 0x19f02915, 0xda3a8e22,
+    0x596da87d, 0x59cbb1a8, 0x47bc8a08, 0xb8f66870, 0x253e9055, 0x90278aee,
+    0x276a99b6, 0x4a50cc8a, 0x7168accb, 0x783baab7, 0x00ff4aab, 0x2fdd6e8a,
+    0x2c9f71b0, 0x72757c3c, 0xb5ab91be, 0xa3a335b9, 0x7d1a4bfd, 0x2dac8d25,
+    0xbc4a5293, 0x4e1eb5ae, 0x24bb0968, 0x0fc96797, 0xc7491cb3, 0x4fdda12a,
+    0xdd34d049, 0xd9885723, 0xf6eaecd3, 0xf5499be3, 0x46d7ab81, 0x948a50b0,
+    0xc5dc38de, 0x69b3df14, 0xf25d6657, 0x4dc737c4, 0xdf29ea5f, 0x30629bdb,
+    0x0709e769, 0x8971c3b2, 0xd24ab2a9, 0x521ac6e6, 0x9742c6b1, 0xb360240b,
+    0xaba68e85, 0x21a8d6af, 0xc169d78a, 0x71c2b28b, 0xd3b4aa33, 0x7856b2aa,
+    0xe51daffd, 0x3e455e72, 0x0a951df9, 0xc3c482aa, 0xc93266ca, 0x52e711db,
+    0x938e199b, 0xad65ea3b, 0x3b485b34, 0xa0fa9305, 0xc4bc4e94, 0xedad8eb4,
+    0xa0a950c3, 0x4bfc767a, 0xc57f4ef0, 0x2fda58e5, 0xbbb7864f, 0xca552931,
+    0xe87eccad, 0x59019367, 0x59b46388, 0x06e7daa5, 0x4815babd, 0x70bc22bb,
+    0xef3969a5, 0xed90740f, 0xc2aab720, 0x1f3216b6, 0x71ac722c, 0xd0f4158b,
+    0x9a1ec38b, 0x58a5d409, 0x465a4bb6, 0x3b24d536, 0x98ebf886, 0xe41e6eae,
+    0xd8589645, 0x54c90763, 0xf4b90af5, 0xd4261af4, 0xa51caee6, 0x27d6bb5d,
+    0xd35d6469, 0xc8b3b782, 0xc65f3f48, 0x93500216, 0x347187d6, 0xd9855efd,
+    0x9c572218, 0x7ad0cc48, 0x02045f95, 0xccc5f7d5, 0xb7e83ea3, 0x93caf5ae,
+    0x41faa3e7, 0xfb16cfd1, 0x5ad19400, 0xf5ed6d8b, 0x38de6b55, 0xdc7a8ce4,
+    0xefe09f2e, 0x3edffba9, 0xfb1d6d3c, 0xdb006ca2, 0xf406bf1b, 0x4700ff47,
+    0xbb217efc, 0xaff5833c, 0x693e66f1, 0x3acee763, 0x0ad1fe6e, 0xf2a8faba,
+    0x33a428da, 0x5007e7db, 0x7ad825c9, 0xcf2f9d93, 0x3e38588a, 0xef64fc71,
+    0x5cd60ded, 0xe87b8f59, 0xdd5d53d1, 0xa04edbbe, 0xbf24dd99, 0x376d30ad,
+    0x3175c469, 0xfb9ff395, 0x45fb3b56, 0xdaaa2d95, 0x5569f38c, 0xa0c9c5ea,
+    0x32760133, 0x1b60affc, 0xe1a7c92d, 0x2d6f0db1, 0xf3414e1e, 0x03e9c7be,
+    0x2069db41, 0xe9f292b2, 0xad85a0f5, 0xabcff976, 0xf5a79146, 0x35012c21,
+    0xa412de05, 0x8f1a2f18, 0x16b759a8, 0xa289f49f, 0x49b0bc94, 0xabd4eb5f,
+    0x4163610d, 0x65344779, 0x36e1e68c, 0x4baca759, 0x4f16ad7e, 0x0f7cf008,
+    0x9a48bf36, 0xf1a8ab34, 0x21365749, 0x47bd95a4, 0xe420c96f, 0xad47fa87,
+    0xa19960fd, 0x2e2a7d3e, 0xe6d95f4c, 0x4507e9d7, 0x2588a871, 0xa7407dac,
+    0x835e3de9, 0x3b63fe24, 0x65cc8bac, 0x48dc7426, 0x059ea0a4, 0xf5f2a7da,
+    0x29f4bf63, 0x3422a006, 0x9aa99dc0, 0x2481c6a2, 0x6cda21be, 0x4cccd37a,
+    0x84f439e7, 0x38e3a51f, 0xff3b56c7, 0xea904200, 0xf58b5e1c, 0x6e35a989,
+    0xcc56067d, 0xf5e7ec70, 0xa59998d8, 0x9495def0, 0x716e3fe2, 0xf4bf97f6,
+    0x3d763727, 0xa7dbb300, 0x04da1c24, 0xe36298ef, 0x213137e7, 0x9f36b2e5,
+    0x3de1e94c, 0xc7dac7b9, 0x6e2c687d, 0x27ab5af1, 0xc073ea2d, 0x8213e8d3,
+    0x1322c2f0, 0xc142c53d, 0xd71865ee, 0xfd584991, 0x251e23a3, 0x4306bdef,
+    0xfad1136f, 0x106b8dba, 0xce76e8f2, 0xe422c66b, 0x96f9f636, 0x2578daf8,
+    0xe4f65519, 0x7d2f918f, 0x9873fb76, 0xd4efa1e7, 0x2e17b1a0, 0xabfe7089,
+    0xd87b8f18, 0x40fd36c2, 0x57296e6d, 0x91d1be28, 0xbbbe97f6, 0x585c4e76,
+    0x56ed8ed3, 0x68f2511b, 0x4ed5bcb7, 0x444ef23d, 0x36a67647, 0x31c314b7,
+    0x1fbb2f8c, 0x82ce7712, 0xd3daf6c5, 0xed78750e, 0x778b26a7, 0xfa6c2afa,
+    0xbb037dd2, 0x4c1c0454, 0x0d03833d, 0x6fbff7d3, 0xd258b6e5, 0x5aba3ac8,
+    0xcfb768f7, 0xeb178aea, 0x00ff6036, 0x4a9c031a, 0x61604cbf, 0xedf27eba,
+    0xd5c2ccd2, 0x4b56bb03, 0x47ad745e, 0xe59fa668, 0x56e3c1b1, 0x06a8fdc9,
+    0xf1ef8133, 0x68798f8e, 0x03bdfc07, 0x7ef517fe, 0xfa43cd74, 0xd86fda27,
+    0x00ff8c7f, 0xc7cf7ed6, 0xb2fbeb86, 0x531fdfed, 0xc7f06f4d, 0xeaa6f3ab,
+    0xd3fe1438, 0xd518e0a8, 0xecbf8c73, 0xf613e4b1, 0x1f74edfe, 0xf6053f66,
+    0xdd6b2deb, 0x5a796aa5, 0x2eebbb2d, 0x1a00ff22, 0xf69f1b1f, 0x373d3f47,
+    0xc9fbf675, 0x5cda9c14, 0x6749757b, 0x523b4d74, 0x73b12a08, 0x8156a41d,
+    0x2499eab6, 0x2752ea48, 0x98db6d57, 0x5add5121, 0xcfc58411, 0x52ed2ea3,
+    0x9db69cd5, 0x3c2b65aa, 0x21762c33, 0xaab159db, 0x88bd7139, 0x7027c9e2,
+    0xdbf77f1e, 0xeffa1ffe, 0x4800c4ff, 0x02020011, 0x04040201, 0x08070303,
+    0x00030608, 0x03020100, 0x21041211, 0x31221300, 0x41322305, 0x33615114,
+    0x15067152, 0x91816242, 0x432410a1, 0xd3c1b172, 0x533016f0, 0xd1926463,
+    0x605420e1, 0xd2938270, 0xdafff1e2, 0x02010800, 0x013f0101, 0x29d800ff,
+    0x48831125, 0x444710f2, 0xf5bf6560, 0xeaf117d9, 0x597c3cfe, 0xeaca00ff,
+    0xfc87e5bf, 0xfe373e6e, 0x16fb5713, 0xd5b8f11f, 0xb468517e, 0x45d5234e,
+    0x87ca85ab, 0xb429d10a, 0x59418024, 0x3b527718, 0xa57f1cf7, 0x00ff13de,
+    0xd200ff15, 0xfe71e2bf, 0xcb4f7897, 0xd200ff55, 0x1f71e2bf, 0x4c8737e5,
+    0xb9d5346a, 0x3d006dd8, 0x177e76fb, 0xd8ccb4c5, 0xb22a9b85, 0x075218ad,
+    0x03fe767f, 0xf1c0ed73, 0x491a1b38, 0xe8b094ba, 0x4fee485f, 0x7df5f05f,
+    0x01e5fc38, 0xc830e1c4, 0xe9ab1616, 0xef39fb1e, 0x387df5f2, 0xae09231e,
+    0x7f56b789, 0xf417fa4a, 0x875d7fbd, 0xfc78f5ab, 0x44470fe7, 0xe9986bdd,
+    0x34de474f, 0x6ed8afe6, 0xc51b4edf, 0x5263caf4, 0xe929e593, 0xc07db11c,
+    0x6cc57316, 0x73db739f, 0xfae28143, 0x19232f63, 0x763ea2b9, 0xab3c9407,
+    0x899bafac, 0xedbb6adf, 0xf49e1fb7, 0xad195776, 0x2152ab58, 0x692336a2,
+    0x3d3f6e0f, 0xffe43e69, 0xff2ff200, 0xc5039f00, 0x090bb4f4, 0x484e2f13,
+    0xca86bd2d, 0xc43e40cc, 0x133e3fd0, 0x5572a2c4, 0xcbc09663, 0xf93120fa,
+    0xc3623286, 0xf0f727f0, 0xed164e3c, 0xfe81bd1c, 0xdf35b786, 0xdac85d9d,
+    0x0b8700ff, 0x8d76fae2, 0x23cee525, 0x1425f092, 0x498f265e, 0x0b2cfc7b,
+    0xf9f1fbd8, 0x25ba2dc2, 0x585295ed, 0x5dcfd943, 0xbb1cd057, 0x747c5ced,
+    0x9f4f765f, 0xf97e7ae8, 0x3d7dd8eb, 0xc6c7ab7f, 0x3709dfc7, 0x95455719,
+    0xc3befbfb, 0x71faa6f1, 0xd2efb1f1, 0x8ffe0bfb, 0xafc3fb75, 0x7ed3d0b7,
+    0x741ddcae, 0x60e7c87e, 0xd6425447, 0x15a5faea, 0x901f35f8, 0x2300ff3b,
+    0x7ff69b7a, 0xab8c0767, 0x571c8fdb, 0x9160526d, 0xe4822831, 0xd6701f8d,
+    0x6c69202b, 0xf8dd0eee, 0xd8640c7f, 0x0f023f80, 0xf5b70f60, 0x8f07f987,
+    0x7538f008, 0xc4d48432, 0x5997324a, 0x6ceb2232, 0x903b0c71, 0xfc00f677,
+    0xc95f1ac7, 0xb98d36dd, 0x72a5ea91, 0x967864c3, 0xf6412d86, 0x4092526f,
+    0x3e3ff73b, 0x4449261a, 0x6366b4fa, 0x8a79802c, 0x0589d323, 0x8ac9ac46,
+    0x4c55f6f2, 0x0d989c83, 0x1ecd11cf, 0x91a5e531, 0x6e04291c, 0x5800ffdb,
+    0x00ff2077, 0x898fdbfc, 0x2d0ceed2, 0xe71ba56a, 0xbedb5995, 0xd91fbd55,
+    0xe6e973c4, 0xd24fd3ba, 0x859272a3, 0xdaf4856c, 0x1b776c75, 0x63f8fbe3,
+    0xe6e85a1d, 0x12568d2d, 0x6e5d988c, 0xd37e5455, 0x28e28943, 0x1e933c63,
+    0x6b470624, 0x64ecfd12, 0x23b0b717, 0x948ac3eb, 0x7cc448b9, 0xc45604ac,
+    0x32a937f3, 0xa5b5abd9, 0xbe86b581, 0x4a72a402, 0x4226b6f1, 0xc4219419,
+    0x490ad155, 0x56edbea3, 0x8ff05ddb, 0x94c9f233, 0xa75bd944, 0x0c64382c,
+    0xb3a6cf76, 0x7bf46f14, 0x69d4a671, 0xaa833a61, 0x1835318b, 0xe8cc979b,
+    0xab7e11aa, 0x6fc46f2f, 0x1566c655, 0xe62dbd8d, 0x15641b30, 0xd6f841f6,
+    0xc360f047, 0xa9cd12bf, 0xd56a5c7e, 0x228a40a7, 0x5985820d, 0xf72abb55,
+    0xd964b50a, 0xf08d93f4, 0xd14ab71f, 0xf0d72da0, 0x7790cae0, 0x4fb586d3,
+    0x3b6d7eb1, 0xede3049a, 0x457aa27f, 0x2456b89d, 0xf457ba92, 0x7b75fb8e,
+    0xea57c49e, 0x961ce1f6, 0x74cdf009, 0x87f83614, 0x41e364ed, 0xfef6ca7d,
+    0xe4289ee6, 0x398448e5, 0x1b5b4f4f, 0x6030cf21, 0x1df4e5ad, 0x064036fd,
+    0x11ec06cf, 0x30866c14, 0x4150cdf7, 0xf5f0dab8, 0x1b078674, 0x0e56d1ef,
+    0xbfa9373c, 0x1f860767, 0x721483c7, 0x0f34136b, 0x90a1bed2, 0x61c7feee,
+    0x6b3c7ed8, 0x407e7a34, 0xd96a042b, 0x1dd45877, 0xf697fcd4, 0x2934cefe,
+    0x4ab5ea84, 0x1ed03fb1, 0xbff3bfa7, 0xaec0ede3, 0xb703fb8d, 0x4702f2b6,
+    0xf97bdbf1, 0xa629a8f1, 0x2b566d96, 0x4cb6026c, 0x9eb460e0, 0x2257e2d9,
+    0x7bb25541, 0x8f48dc9a, 0x948db812, 0x70666aba, 0xe388b990, 0x48c08c34,
+    0x39c64b40, 0xb2c52a33, 0x4463f222, 0x629365f3, 0xc82b4f5f, 0x48bd99ce,
+    0xe7f05865, 0x8818a20e, 0x0e7b36ce, 0xcc9370fb, 0x04d67ccb, 0x4cf2b412,
+    0xfb6ad2ad, 0x6c04f7fb, 0x9e86d347, 0xec8cc575, 0x8fb21e10, 0x68c93733,
+    0x5e554f6e, 0x0283afdd, 0x64dd7ccf, 0x514e34f2, 0x56f22496, 0x2705ee5e,
+    0xb677d9aa, 0xe427b863, 0xdcfc38ba, 0x8002799e, 0xf8a8d2f1, 0x94c32c85,
+    0xcb3cb181, 0x25a41b00, 0xd3ba7ad7, 0x4cc564f8, 0x0d7f43c4, 0x18fe99cb,
+    0x6c3ba6a4, 0x84241015, 0x6f15d0ba, 0x30dc91d7, 0xd4a04d1c, 0x1889ca40,
+    0xc16a7999, 0x35df22de, 0x5c4476a6, 0xf6900bf1, 0x6abbeff7, 0x64773ab5,
+    0xdad988b4, 0x3b90edb1, 0xdfa3e9d8, 0xcbc037f0, 0xe731a41c, 0x7c449f8b,
+    0x5d5247b0, 0xb648f6ae, 0xf1bdd127, 0xc83ae7a2, 0x97f1382a, 0x39269793,
+    0x5e086403, 0xdbde53a5, 0x1ad9ce6d, 0xc2a454e3, 0xa1919d62, 0x85f18696,
+    0x65658006, 0xb202ecb3, 0x76ecba11, 0xf39cc635, 0x4ad128b5, 0xe9e463c1,
+    0xc19484da, 0x9b960737, 0xcdd6103b, 0x3b4972b9, 0x0af3d7f7, 0xd595ca47,
+    0x4be0b698, 0xfda95a0d, 0x62011925, 0xf600f486, 0xd4a7e83b, 0x2ecc9b07,
+    0x331391f1, 0xa6475dc8, 0x203b5650, 0xa81c0d10, 0x34aef69d, 0x09d137e2,
+    0x07521435, 0xa5953796, 0x4c02c832, 0x2a9ba9c8, 0xc3a00bec, 0x9f4594d2,
+    0x2260cd7f, 0x12c912bc, 0xc5444912, 0x9f9dbe84, 0x6c7b6960, 0xc0eff754,
+    0xf5862f36, 0xf72bfdb5, 0xc6ef7870, 0x56ce4ba8, 0x7e900246, 0xbf733795,
+    0x075c35f0, 0xe7542359, 0x60d092b4, 0xbcc87dac, 0xdfd73e77, 0x1190c6e9,
+    0x54a85ca8, 0xfe49fb67, 0x3cd6e1fb, 0x457dc076, 0x9ef8ef7c, 0x33aa290c,
+    0x2f24e992, 0x191726b2, 0x3394888e, 0x50449e7e, 0x00ffa350, 0x6089e796,
+    0xe1c3108f, 0xf2528632, 0x55fab1c8, 0xf3805073, 0x10e4642d, 0x21dbfbac,
+    0x1a65af11, 0x5f9f0a6f, 0x628ebc2b, 0x10cdca84, 0x0ca41c87, 0x513082b7,
+    0xf4b7718c, 0xa453ed83, 0x671d27d1, 0x41044b81, 0xae7ca5d2, 0x4f41dd45,
+    0xccef5894, 0x0fb3231f, 0x7229c4ae, 0x3ddd4642, 0xce5d37c0, 0x7f52fdf7,
+    0xad2c0f67, 0xbec7b292, 0x594cde4a, 0x41dd6c75, 0x70d70432, 0xb737c06e,
+    0x1d63361a, 0xd1960f11, 0x78295ca2, 0x581be760, 0x6c50f7d8, 0x7bb26b9f,
+    0x864387e8, 0x5aaf2697, 0x0be8aa46, 0x05aa523d, 0xd822ad38, 0xefdad363,
+    0x6658e589, 0x893a494d, 0xcaaa6844, 0x6419533a, 0x8a63e655, 0x67b1c9ab,
+    0x7a15c9b7, 0xe3f1ac53, 0xc032c5f2, 0xe54222e6, 0x94480e33, 0x490263f2,
+    0x083985cb, 0x6ee63b96, 0x3d120741, 0x14ddf8b8, 0xf9850a70, 0x08ccaa61,
+    0x7c92e523, 0x204061db, 0xde578606, 0x4d53f090, 0x18d568a9, 0xb0172446,
+    0x80e56154, 0x86141424, 0x1b504baf, 0x201e4f9c, 0xb04cf034, 0x09656786,
+    0x1803c410, 0x48e6325c, 0x4b76e94f, 0x031ed8ef, 0xb4f1f468, 0x09a8b97c,
+    0xf4a76364, 0x344d6ba4, 0xc7826cc7, 0x24656799, 0x9ba050d9, 0x971145e3,
+    0x3292a949, 0x34920603, 0x42599a69, 0x1251bb88, 0xdef3ca28, 0xb7b76cc3,
+    0x6267c10e, 0x681903d2, 0x62ca1415, 0x99a5ea28, 0xa39dbad9, 0xb6d5a293,
+    0xabef4c57, 0xd3b45582, 0xf3b4d3ee, 0xc7441007, 0x8cd28a9a, 0xf98d6355,
+    0xdd310592, 0x62ea9191, 0x70211e28, 0x1db8f174, 0x9a0295ec, 0xeff7dec9,
+    0xed85abfb, 0xe68f88c7, 0x6ce930b2, 0x158c19a2, 0xb38bc885, 0xd53b2ab8,
+    0x2c7cdd9f, 0xda8caa6c, 0x761ae48e, 0x7d514656, 0xed7b618c, 0x2d7bebda,
+    0xdd8ea4c3, 0x0c65302c, 0x36547300, 0xe2cedada, 0x88c3bffe, 0x7a77a4f4,
+    0xf9d9bbde, 0x7f37c8f6, 0xf8fbd59e, 0xd0d57458, 0x6751646e, 0x5fa0b22a,
+    0x67ed0bbd, 0x324f7c61, 0x33c9d144, 0x63341bc9, 0x882c5b3e, 0x90ead998,
+    0xf793b249, 0x1fd7d8ab, 0xb0e45c9c, 0xcb4a7881, 0x89a3e52c, 0x9aca2f8c,
+    0x5856b898, 0xbf99d39d, 0x3c8bfba8, 0x378eac49, 0x3c1d3264, 0x2905d650,
+    0x299456d2, 0x4c519832, 0x96ad72d1, 0xc155c512, 0x17f15d6f, 0x51b1a686,
+    0xb1846572, 0xc520ac32, 0x14c306f1, 0x490cb827, 0xb8c73632, 0x9fc67307,
+    0x25961e4f, 0x8162800a, 0x54005040, 0x0e1a4b51, 0x814301c0, 0x3a0e86e6,
+    0x3fee614f, 0x717bfeef, 0xd0181ee2, 0x48ab26cb, 0x5e20cb02, 0x9b5bc168,
+    0x40ca62cb, 0xee80d420, 0xf7d559d5, 0xe98427ee, 0x7926529e, 0x4828d4b2,
+    0x4eef95d5, 0x456d5982, 0x348c5494, 0x61448c85, 0xcbf15d44, 0x9aacaad4,
+    0x911c2f47, 0xa92a2996, 0x720cd452, 0x9a5c982b, 0x3e9a0d27, 0x60412c96,
+    0x7e248da3, 0x51da2123, 0x23170018, 0x7d549d96, 0xd5817bf9, 0xb8bdbd46,
+    0x14e243d4, 0x4612e6c5, 0x2c729cb8, 0x84dc806d, 0xb6dfc54d, 0xd478fbd5,
+    0xcb12cb54, 0x59f2c90a, 0x00af9a62, 0xedaab436, 0xb6c9c762, 0xa99a34d8,
+    0x3c1d8204, 0x84832e26, 0xbad9f38d, 0x0c40114a, 0x2366b1c7, 0xfce4146e,
+    0x751256a6, 0x0e4e25a8, 0x24b310f0, 0x9c041072, 0x2e582196, 0x6e6f4fea,
+    0xcea39130, 0xcce471cc, 0x8d43a84b, 0xe9b5ae15, 0x6b30c350, 0x877890f6,
+    0xcaf804c3, 0x6a313551, 0x722c5146, 0x8e0a8444, 0x032e2739, 0x69ae7836,
+    0x60dc46b0, 0x000fe276, 0x1a186385, 0x7b596f0d, 0x6bb216b3, 0xeff7f573,
+    0xba929fc4, 0xf2501953, 0x1fcd308f, 0x9f5cfe9a, 0x06122334, 0x126862e7,
+    0x3469e478, 0xc15a3f72, 0x516344a8, 0x7c679269, 0x503b3a8b, 0x55e6ea2d,
+    0x11981c35, 0xc3379178, 0x0c26d7e4, 0x3aabda02, 0x150cc464, 0xe4680194,
+    0x9ea85602, 0xc5937fe5, 0xad19f800, 0xa9870b82, 0x179f87ae, 0xb83f417c,
+    0xd405121e, 0x4a31a269, 0x7205238c, 0xef770039, 0xd828e4ba, 0x63a170dc,
+    0x09b2c6e5, 0x205dc70a, 0xa5b1d9ee, 0x0595efab, 0x49f86dbf, 0xf311a791,
+    0xb8a9c823, 0xb502f3ac, 0xf7d86ea8, 0xdc983f1f, 0xbc7cf0f1, 0x1845a5dd,
+    0xd9dc5638, 0x3e642065, 0x2d436f40, 0x511696f8, 0xb3ce3296, 0x990803b0,
+    0x3798dab0, 0x94250e96, 0x60816d9b, 0x05f071bb, 0x4e5f8e35, 0x32640e66,
+    0x44493075, 0x63283c98, 0xc63130c1, 0x9ec1acb2, 0xcea99945, 0x34fc02ea,
+    0x44a84df9, 0x454b476c, 0x2c87c531, 0xc6447966, 0x0933e8ac, 0x070adb0a,
+    0x06aff2aa, 0x194d5f91, 0x0719f338, 0xb71da762, 0x9291a48f, 0xfebd9a1d,
+    0xc59bf27e, 0x0fefde41, 0x7f00ffbd, 0x3921fc96, 0xd0b7df6d, 0x3f223ffe,
+    0x9413b7cf, 0x57659ee5, 0xd700fff7, 0xc3d438fb, 0x806ad5a4, 0x59b72310,
+    0xdd56c169, 0x46886649, 0xd64916c3, 0x5f5dcdd5, 0xb439e2b1, 0x56590e9b,
+    0xc9d7728c, 0x6d59d08b, 0xb57c93d0, 0xba4fa923, 0x265c838e, 0x69a644bf,
+    0xee85b844, 0xc7542de1, 0x43a14b62, 0xe2d86003, 0x3cd3124f, 0xfc52a26a,
+    0x5829c1e7, 0x2e32352f, 0x7a244532, 0xada8c64e, 0x9dc4ed5d, 0x3aa0f022,
+    0xc23acf99, 0x8c322cf7, 0xff1eec0f, 0xd4223e00, 0xe5c1422a, 0x8fd42a77,
+    0x018ca4b8, 0x64fa8d94, 0x38cd4c32, 0x8bedbaa4, 0x5d181c1e, 0xbfc0d3a7,
+    0xb6f6ed12, 0xe6d52cbd, 0x08345037, 0x9a3a4c06, 0xa90fcfbd, 0x0a52ea96,
+    0x2ce5fa72, 0x09d038bd, 0x351b55bf, 0x8d476dbd, 0xdbb24e04, 0x2664f118,
+    0x42487a3c, 0x6c520196, 0x30caee91, 0x358547ed, 0x5400ff12, 0x51b8fb01,
+    0xaade5959, 0x127fbfbd, 0xa285f1e7, 0x24c7982d, 0x2d0f7165, 0x284dae94,
+    0xc19e2814, 0x9be21eb2, 0x7254d284, 0x72262abf, 0x20a65246, 0x4625568e,
+    0x3d1a67eb, 0x2f6271ba, 0x3a090af9, 0x51b3b148, 0x3f5256fd, 0xce7e5373,
+    0x27aaf035, 0xb2d13c36, 0x41d9a127, 0x6f3393b1, 0xc34e6c40, 0xaff14de6,
+    0x78dac494, 0xeab35204, 0x09a20e0c, 0x67e1391b, 0x239b48a7, 0x13233852,
+    0x00e45eb1, 0x356a1072, 0x41234ccb, 0x505f5242, 0xe35820ad, 0xaa941527,
+    0x032bb282, 0xa953571d, 0xe20d5f3b, 0x69509c93, 0x2c96e3e8, 0xece9f6f1,
+    0x873a1401, 0x35f4ef71, 0x2a19c0f9, 0x86189175, 0x4fe84020, 0xc4c62141,
+    0xb7ad31ee, 0x6e9226be, 0x8fe43a5b, 0xb088f124, 0x58313343, 0x948a315a,
+    0xf40562eb, 0xdf66d1da, 0x9d3a221e, 0x8da9c54a, 0x0a6731ed, 0x18d62a0e,
+    0x32b8aa54, 0xa97b11fb, 0x683caab6, 0xf8097fd6, 0x88cc2d86, 0x0de21b4b,
+    0xb28b92d8, 0xae4c2b2a, 0x619ce39b, 0xc259a264, 0xd6a17153, 0x268dad41,
+    0x74c85746, 0xecf9de3f, 0xb3535677, 0xbf070b2b, 0x19c6d10c, 0x3cf1bfcf,
+    0x78b2756b, 0xd3a6ef8c, 0x03104831, 0x6576a03e, 0xe1e9c062, 0x00b1d822,
+    0x8d8d91dc, 0xfcbc170b, 0xaa422bbd, 0x2e739192, 0x8892dc51, 0x340feaf4,
+    0x14844c80, 0x16666449, 0x71572f54, 0x31592671, 0x112be205, 0xb2ac9589,
+    0x72929098, 0x6d798e5d, 0xc6ab7fd5, 0x292d2586, 0x38ea1693, 0x969020b6,
+    0x831c18d4, 0x544ddd3e, 0x1ab7a176, 0xa5cbf4f8, 0x60340666, 0xa19d98d1,
+    0x8c240955, 0x14125c51, 0x0caa97db, 0xd940030b, 0x41f190e3, 0x8e44fc8b,
+    0x234fd9aa, 0x49726701, 0xa9110040, 0x88ef1527, 0x3c1bb300, 0xbe16a748,
+    0xc334db5f, 0x3295d4a6, 0x4d72a479, 0x5df5b8c6, 0xce9f8493, 0xa4aef445,
+    0xce27e318, 0xe15c212f, 0x26035446, 0x2c673019, 0xb3896a15, 0xb8dab8d5,
+    0x8bcdb191, 0xf6478886, 0xb6dc3c62, 0x8a5bfd5d, 0x7cebabad, 0xc691b568,
+    0x52e84499, 0x182c6747, 0x9a0212d3, 0x1fdb8805, 0x71fb866d, 0xb9698b0f,
+    0x6e83d469, 0x1ec1d6c5, 0xf3e3f1c7, 0x24d61b94, 0x9de060d7, 0x7bfeedf6,
+    0x79661471, 0x5c766328, 0xd5f4f916, 0x714f8f7c, 0x759b1fbf, 0x40241020,
+    0xfbb66eb8, 0xd56eead0, 0xf0ef6ad4, 0x2300fffa, 0x630eb1c8, 0x4fa0409c,
+    0x8f82c96a, 0x59e340e2, 0xa25c8aa8, 0x6db42a12, 0x55913393, 0xb2ac508d,
+    0xcd3decbb, 0x9e781c1b, 0x0ce9829d, 0xc3a12e89, 0x2229d6e9, 0x64d2a498,
+    0x22703c43, 0x1c2195a7, 0x127b5dbc, 0x34ae1e3b, 0x444119df, 0xd958ba6c,
+    0x309fc391, 0x9043ea0b, 0xe5abcc50, 0x7ceb85b3, 0x99b81db6, 0x1586505e,
+    0xd081208e, 0x20934896, 0x5e727ae1, 0x1b2c545e, 0x1b3692be, 0xe5fa74f0,
+    0x5908dc68, 0x48b73901, 0x7b25afda, 0x4d02c46b, 0xe29af477, 0x4c539326,
+    0x2c34c5f1, 0x800c8518, 0x63e2c486, 0x9081e060, 0x3d5647fc, 0xd447e2c8,
+    0xc2d231c6, 0x5e1cc1f0, 0x57b502c6, 0x1761e578, 0x3d929b2f, 0x4b6d28fb,
+    0x9a868d44, 0xd42131e6, 0x4839371f, 0xa8dcae0c, 0x15c6c3d9, 0x10d914b1,
+    0x677504c5, 0x51af268d, 0x429699e1, 0x418a0e20, 0x55924101, 0x4b0a75b5,
+    0x544cfd0d, 0xfc3ef729, 0x5367fc6a, 0x8d84d3ab, 0xbc9b8de3, 0xd8e5d5ab,
+    0xf5b50524, 0xfc81c52e, 0x140db03e, 0x562f5f3a, 0x81158179, 0x00de3155,
+    0xbb7c4cb7, 0x8f5a885c, 0xedfa4132, 0x391908c3, 0x456d84da, 0xc98b2106,
+    0x28e458cf, 0x9b5d255a, 0x7579c90a, 0x7ced95d8, 0xe545ba36, 0x0ba900a8,
+    0x2004a518, 0xf6b5fb58, 0xfb7b8d53, 0x5bb71e71, 0x871a5619, 0x24d66e5c,
+    0x9171638d, 0x5859c965, 0x2c4e3aec, 0x93d2cf2e, 0x60d666c4, 0x729186b3,
+    0x43a96856, 0xfd5adcd8, 0xdb3656e1, 0x70f0f9b8, 0x7548b010, 0x6c995745,
+    0xc40a17f2, 0x23af1cbb, 0xc8e9d98a, 0x0a452d00, 0xfb868de1, 0x7d69e42d,
+    0xf9e61a3b, 0x523ecba7, 0xecdfd5e1, 0xf485f3e4, 0xc15b97ab, 0x355af590,
+    0xbe882902, 0xb2aa2397, 0xe81ddd1b, 0x16cd0cdf, 0x1f2ab49c, 0x6dc6f205,
+    0xebfd5b26, 0x9f7f6f66, 0xbd046a10, 0x1a54805c, 0xd7a59021, 0xfc1a3b70,
+    0x75f0f72b, 0x9de0f412, 0x58961968, 0x62261259, 0xc99a9757, 0xab534a9f,
+    0x6a2367ac, 0x8823b6c1, 0xb5ea3075, 0xb360b291, 0xe425bbb1, 0x0689c131,
+    0x6e81ca3d, 0x5a9f346c, 0x8a347e07, 0xba06e079, 0x9abdeaad, 0xaffec4c6,
+    0x509378fd, 0xba2dcee9, 0x06a0b022, 0xf7c0f25b, 0xb6de93f9, 0xacf105fc,
+    0x78a79d8b, 0x3cc620ab, 0x91a8d585, 0xf463ef0b, 0x4d1ff741, 0xe6c28bf8,
+    0x14429013, 0x625e9519, 0x2e372ce4, 0xc749dfc5, 0x636fdbbe, 0x55333c89,
+    0x94569a3e, 0x28ef24c7, 0x48b03f93, 0x81c672d7, 0xb23c3000, 0x5141800a,
+    0xa9f08447, 0x5816daf4, 0x9ecd6879, 0x917c424f, 0xac027570, 0xc5ae2ea9,
+    0x8f697287, 0xf1744ccb, 0xd76a0b4b, 0x1995e4c9, 0x67b3482e, 0xdcd1926d,
+    0x57ec7a8f, 0xa0b1b6e5, 0xa042f9f3, 0x37c09479, 0x2b110216, 0xf185fb28,
+    0xd7d8fdf6, 0xb456c918, 0x3f5d3eaa, 0xf1f6d7b4, 0x30806919, 0x5d17cdc9,
+    0x16ee980f, 0x03b9dbb6, 0xf17b20f1, 0x636c6690, 0xba1ac9e6, 0xa6f0b998,
+    0xd68043ec, 0x8eb2a2b1, 0x3b2ddd94, 0x4d5cfde4, 0x232d21a4, 0x2d245986,
+    0x5c88c940, 0xad3a6960, 0x0aa495ba, 0x482166a7, 0x8627406f, 0xcc98508d,
+    0x5420737a, 0x093c2b56, 0xc5e935c9, 0xb5f2ef98, 0x7b946aac, 0x4ef24c22,
+    0xb447d240, 0x441daa91, 0x8eb2832f, 0x1fa59e5b, 0x7adf88af, 0x25ae15c8,
+    0x3c9c36d3, 0x00c6879a, 0x193d345a, 0x79888db9, 0xdccaa342, 0x9b0edb97,
+    0x11bf4d15, 0xb96c5669, 0x4835c246, 0x9a71f9c4, 0x5618f3c8, 0xf423273d,
+    0x40b4e1f6, 0x539f26ab, 0x99f9858c, 0x90626c3c, 0xcdc198dd, 0x2bfd159d,
+    0x69b08ae5, 0x7a2c4d78, 0x1d8e3441, 0x4eccf264, 0x60c9b8ac, 0x36167b58,
+    0xa0f49eb1, 0x4dafcad0, 0xd2ce5006, 0x2419e748, 0x8424cb28, 0xcfa5ac46,
+    0x3976be34, 0x5aa78985, 0xf8adb14d, 0x264f2e31, 0x60875c08, 0x3087a64f,
+    0x06210d99, 0xb9dbc615, 0x0be74b38, 0x9160ead8, 0xcbba3502, 0xea036394,
+    0xc3423620, 0xdf51a402, 0xc3f7ae6a, 0x242ba43a, 0x209a7271, 0x3a268b7c,
+    0xd4885dc8, 0x2b416c97, 0xbd7ae45b, 0xb50006f8, 0xc030a2f0, 0x41e25cb0,
+    0x349a64d5, 0xb6076b77, 0x80bad9d7, 0x285df6e4, 0x081da0f6, 0x3a859d1e,
+    0x7dedd8d8, 0x86a6718d, 0xe1db1539, 0x515495c2, 0x5561abd4, 0x72c9d8ec,
+    0x5eaa9e1b, 0x54340ec0, 0xd0a28864, 0xb6fd8e26, 0xd97f4f3f, 0x1abe7dfb,
+    0x48368bd9, 0x3e48ba55, 0x95bb6bc1, 0x3ffa13db, 0xe2f2ad2a, 0xc4920242,
+    0xb7e7b601, 0xdf69c271, 0xa699b9e2, 0x24e4cb01, 0x35fd4616, 0x02f61afc,
+    0x3aafd4f8, 0x49e10a05, 0xb0e9eaa6, 0x8ff8af7d, 0x661471c0, 0xf28a3c1d,
+    0x0896bb2d, 0x3aa1540e, 0x59b5feac, 0xcf0ddb3e, 0x590a991a, 0xf8e4912e,
+    0xfd831ca5, 0x910185cc, 0xf3d5b4fb, 0x9f0f0f3c, 0xdaccd154, 0x2b644a8a,
+    0x00ffca89, 0x00e97d47, 0x886104b2, 0x882ff46e, 0x914122fc, 0xd1ce1579,
+    0x188b1c2b, 0x087456c5, 0x24b1c462, 0x218ed02f, 0x967222d3, 0xa2199b24,
+    0xfee3f2e6, 0x6872c36e, 0xd4a657e2, 0x1c06dc31, 0xe64e872e, 0xa89fc933,
+    0x3ce63431, 0x5abb158d, 0xfec206ac, 0x72dc1e5b, 0x3e08b4d8, 0x56528436,
+    0x9c9e9012, 0x2170567d, 0x016b237d, 0xa071efae, 0xb21c438a, 0xba32a8c1,
+    0x66a66c17, 0xc8317067, 0x7fb7a39b, 0x34f0bd9f, 0x9ad6da10, 0xa9b67172,
+    0x357b5b07, 0x875f3efd, 0x64409bed, 0xdb4806ea, 0xe424cf00, 0x624075cb,
+    0x783706b9, 0xe206e4aa, 0xd47816c8, 0xd342eec0, 0xbe5c0c47, 0xbd140e51,
+    0x7bd24853, 0x2bd82303, 0x7d4b696d, 0x0c5f4580, 0x0aafec42, 0x24751635,
+    0xcbcbb6b2, 0x9c3ab908, 0x29c8b342, 0x60165851, 0x98f1f168, 0x999224e5,
+    0xa3895e20, 0xa084b146, 0x4e101f0c, 0x2c95b258, 0xb737dda4, 0xb13b3d1a,
+    0xda0c2089, 0x24030b69, 0x64bcb3b1, 0x5c4c220a, 0x906cba0f, 0xed222b1b,
+    0x66c29f78, 0x180d14ca, 0x35a63813, 0x4433558b, 0x2b439c6c, 0x875afcd0,
+    0x32451f7e, 0x40918fb0, 0x5c9d1599, 0xf742310c, 0xe2b6b3ea, 0x39aef7b7,
+    0xc08d1a02, 0xa68ec2b8, 0x6337ecb6, 0xe0c97dee, 0x17c41cc3, 0x106a508b,
+    0x4d7d9c54, 0xead695d5, 0xfe7bb049, 0x82a20baf, 0xae524c3f, 0x75dc9969,
+    0xedb74048, 0x00ffdbe9, 0x10d26dd7, 0x80e7a814, 0x7680a4c8, 0x22861b66,
+    0x7f350bbb, 0x1711b7bb, 0xc719da88, 0x4b0cb347, 0x42d5be6d, 0x3ab8fd87,
+    0x7dab49bd, 0x89017455, 0xd7bdf7ee, 0xcd3df764, 0x78f24f5f, 0x3347c789,
+    0xb043b06f, 0xd889b4b3, 0x14f2b351, 0x3ac2e56f, 0xd520adac, 0x03ed2e38,
+    0xd4a35d21, 0xe0469979, 0xa3df6625, 0x5b0cdb1a, 0x9e61d9a7, 0x799e0e4c,
+    0x31ea0065, 0x9b95180d, 0x2212929e, 0x1503f35b, 0xd8be8bbb, 0xfa705be3,
+    0x862a06b9, 0x1a430646, 0x33865b9e, 0xba488290, 0x9d626e80, 0xf517abb0,
+    0x8ac59ae3, 0x99676685, 0x89cd0694, 0x6834a09b, 0x69aed30d, 0x21a7af71,
+    0x9521beb0, 0x26ca7499, 0x9066298b, 0xb8c92a32, 0x57e5595e, 0x22739c66,
+    0x22635b14, 0x3d2e6ef4, 0xd30abe42, 0x4a92342b, 0xeac81a95, 0x6b44bcfc,
+    0x2b9097d8, 0xa9446943, 0x1c512891, 0x8f39d33c, 0xcbc82b97, 0xb2723136,
+    0x0854424b, 0x3019f590, 0x4a955059, 0xbe6d9263, 0xdcd5a8e9, 0x51a5812a,
+    0xc6fc0a21, 0xdd04e02c, 0x6a982f42, 0x62dbd34d, 0xea11c76a, 0x9d91c664,
+    0xeb493e86, 0x9b059163, 0xb5a8397b, 0x6cd486b0, 0xa8066e6b, 0x27678896,
+    0x99503852, 0x72b27d94, 0xd168d92b, 0xf04d6007, 0x21a83235, 0x44a16032,
+    0x3ad94840, 0xb1a47982, 0xcc0af006, 0x654b2f6b, 0x96427c5c, 0x8939f22a,
+    0x815891a2, 0xc8898b94, 0xc9ec1849, 0x674e2a1f, 0x47715bd1, 0xbca2f083,
+    0x1361d5e6, 0xe5155e0c, 0x439d9b12, 0x1f53dea9, 0x04d24326, 0x5ecb554a,
+    0x88bac435, 0xcd036635, 0xb7234a91, 0x0cf40c99, 0xc991c55c, 0xd4836c44,
+    0x882b31d2, 0xd1632129, 0x7fa1727c, 0x2d00ad4e, 0x75b83ccc, 0x6c512e63,
+    0xad9bd6d8, 0x73209517, 0xcc70a4e9, 0xd9ba3431, 0x443e8e61, 0x988f27a6,
+    0xa359c565, 0x19f36765, 0xbd1c1d76, 0x8c54673d, 0x3c7612b2, 0xce338937,
+    0x3448d28e, 0x5824ccf1, 0x5f622cf1, 0xb76a08e9, 0x955a964c, 0x5804288d,
+    0x7a35f0c4, 0x1b52d268, 0x65793254, 0x221ba96e, 0x3f06f332, 0xb57b39a0,
+    0x491fc456, 0xe9f0a8b3, 0xa67a995b, 0x4894c684, 0x5bead03c, 0xb9965532,
+    0x65190001, 0xdb8343d0, 0x2ed3ac81, 0xd293faca, 0x0048f510, 0xc71a608c,
+    0x4c4b04dc, 0x1f502c0f, 0xbc3aeb83, 0x1a1197a7, 0x28ec7aab, 0x00ff6c14,
+    0x4963fdb2, 0x36dc0676, 0x499c7db2, 0xd8062525, 0x809249b6, 0xde14d60e,
+    0x55dd8621, 0xd4af81df, 0x96ee8448, 0x3775a3d1, 0x738d49d8, 0x3a89a94d,
+    0x507f7ad3, 0x735c37a5, 0x795ea561, 0x5c85a2f2, 0xc9e58e5c, 0x01522e88,
+    0x17902346, 0x36c84780, 0x00ff786b, 0xfa428827, 0x18a6169d, 0x95b1bcc5,
+    0x370b5b50, 0x16ae22db, 0xae46f1fe, 0x031e78f4, 0x42d11ee2, 0x7a913007,
+    0x39ca63a5, 0xc2f09374, 0x9ca3a2e7, 0x2b6f3629, 0x78810f7e, 0x87215686,
+    0xe297c610, 0xe5beec53, 0xbbf338fc, 0xfb8fd579, 0x81077eaf, 0xcb2388f8,
+    0xe8922888, 0x1521936a, 0x879f4aaf, 0x77296a00, 0xf2e9d19b, 0x303fbeb6,
+    0x8a8b8df8, 0xb5de720c, 0xd02a9729, 0xf6e9a4e0, 0x3193a49b, 0x4f1e3db4,
+    0x07fc884d, 0xb49015c4, 0x3e1b7a5a, 0xcb53841a, 0x3c2369f2, 0x5f3a498b,
+    0x79ab0d29, 0x68c71855, 0x507c27bf, 0x6b60355f, 0x8d67bc66, 0x8a282b4f,
+    0xbae18744, 0x32b84259, 0x1aaa613e, 0x17f1c045, 0x31bddee4, 0x8f181c0d,
+    0x19803a5e, 0x326ac485, 0xd60636d1, 0xf631db4d, 0xe1705541, 0x42fc277f,
+    0xec84e3fa, 0x0af5f203, 0x114ad084, 0x53045ddc, 0xa3af6c59, 0x5fc4b510,
+    0x8b20be93, 0x7e4d248b, 0x0795baa2, 0x26ee687f, 0x2cc70ec0, 0x251414c1,
+    0xde93bf70, 0x5c8e8022, 0xa0b6c706, 0x1851572f, 0x19950b13, 0xd8d9b01e,
+    0x7c70b8b0, 0x60c8c407, 0xd8b11652, 0xba0c146a, 0x6ca10cab, 0x0e2e7557,
+    0xade8ba65, 0xe203def0, 0x87ca3347, 0x88da1e26, 0x858b2dc0, 0xa738e122,
+    0xe414f352, 0x32a2cc5b, 0x78812f1c, 0x7a3c04b6, 0x61376276, 0xce5f0032,
+    0x962e87c6, 0x3acda43e, 0xc3d45c8b, 0x2ff0c131, 0x34f2a713, 0xde7e92fb,
+    0x6bf3243a, 0x321d6dba, 0xcfe41473, 0x8e19d173, 0x9df8303f, 0x039e0e4a,
+    0x3e5f3193, 0x5ecbdc3a, 0x39a993c2, 0xb966728a, 0x07c7bae9, 0xcc5bbcc0,
+    0xa99f36ad, 0x8f275289, 0xff58edfd, 0x99d46500, 0x6a6eeca6, 0xf8e0a56e,
+    0xff538a17, 0xd88a3600, 0x44c5dbdf, 0xc87efdf5, 0xb6211986, 0x1cde2737,
+    0x52f1627e, 0x166dfe24, 0xe3a99a44, 0xfd7e770a, 0x6444655f, 0xfe25b19b,
+    0x1ee0477c, 0x1d23ad2a, 0x74c4563c, 0x6c78440d, 0xb4b7705f, 0xfa5a976d,
+    0xfea57f9b, 0xc74df164, 0xef2d42c3, 0xadafa269, 0xfb917df5, 0x38f6aebe,
+    0xa2e20d1e, 0xc69b00ff, 0x84a5bd2d, 0xeaf29d5d, 0x9fbe1ade, 0xdc03f755,
+    0xf5882f78, 0x416e8086, 0xa50096e9, 0x6dd75381, 0x0556917c, 0xb85de917,
+    0x31f1055f, 0xf5c88f24, 0x7c0ed772, 0xe3c5b63c, 0x422fe336, 0xae0314d3,
+    0xdb863cd6, 0x00f10a1f, 0xee908659, 0x41b3ecd0, 0x90c383d7, 0xa717e496,
+    0x5d638c50, 0x4f3ba6df, 0xffa9fe97, 0x7ff2a700, 0xfec0e19f, 0x03f500ff,
+    0xfeb74ffd, 0x00c4ff2f, 0x02001048, 0x03030102, 0x04040302, 0x010b0809,
+    0x03020000, 0x05120401, 0x14001311, 0x06232221, 0x32243115, 0x51424133,
+    0x25169161, 0x43363534, 0x10817352, 0xc1949344, 0x40f1d4d3, 0x64605453,
+    0x95727170, 0xffb1a3a1, 0x010800da, 0x3f060001, 0xc800ff02, 0xf9b06d2c,
+    0x28841271, 0x4e096132, 0x2f5846d9, 0x91d5af6f, 0xe76d273e, 0x7fa821af,
+    0xfffdafab, 0xff765f00, 0x7f05fa00, 0xb49974c4, 0xc0a2923a, 0x50331113,
+    0x090b6036, 0x62234344, 0xc200437c, 0x5fcf687f, 0x00ff517f, 0xddf78f53,
+    0xfd47fd7d, 0xf5df3f4e, 0xbaab433c, 0x5ae16d47, 0x7963b274, 0x67033cda,
+    0xf5233eeb, 0x15bb8ecf, 0x10bba696, 0x8a0d71b3, 0x1728381c, 0xb73925cb,
+    0x8c8cb97f, 0x51164944, 0x52fd4e8c, 0xb7bf7de3, 0xefb47dd7, 0xaf557c5c,
+    0x40e64610, 0x6006a4b8, 0x96db10a3, 0x54c7357f, 0xf9c07577, 0xafde5685,
+    0xb19f6895, 0x94ec1d2b, 0x9638a72d, 0x2bc78251, 0x3aa6f913, 0xe96528aa,
+    0x7d1d759b, 0x00ff655f, 0x951c4f31, 0xb8a5c5a9, 0xa562284f, 0x94cf67e7,
+    0xac49540f, 0x6ad4b1bc, 0x665ea11e, 0x46d81fac, 0xe1a37b02, 0x8602366b,
+    0xac8c2a0e, 0x029afbc6, 0x0753f53c, 0x28de69df, 0x07752984, 0x5c08cf39,
+    0x4185939c, 0xa01de40c, 0xe531069b, 0xace71182, 0xcca03a65, 0x491259ae,
+    0x1c4302a5, 0x61fe74bf, 0xddb2cf8c, 0x3ec627e2, 0xcd1d8976, 0x6c619d2f,
+    0x4e944859, 0x32a33f9e, 0x8dc58c3b, 0xd8897788, 0xea4b6486, 0xe2d73133,
+    0xfc00ff6a, 0x74c47f7c, 0xf58b6d0d, 0xdc53be41, 0x1e9bc453, 0xda5a2063,
+    0x89b7c2d6, 0x4e00631e, 0xed1cc4fb, 0xeb5a153b, 0x54d158d5, 0x8229f03f,
+    0x433b258d, 0x29bef354, 0x6bfe4c68, 0x3312f332, 0x50c70cb1, 0x91a8af99,
+    0xd19e29c8, 0x17810d69, 0x5951afd8, 0x0162f51a, 0x04a47d29, 0x9c43ce84,
+    0x30004499, 0xa6724785, 0x507ea0b8, 0xdeb41a93, 0x2211910c, 0x32a891c4,
+    0xfc8f413c, 0xba867ae2, 0xd2943535, 0xdac1a556, 0x3d8d8fad, 0x8570e3b8,
+    0xbf301836, 0xcb196e54, 0x5bdd62e3, 0xde6f4c09, 0xf100f259, 0x6bca018e,
+    0xdb69df1e, 0x9411d097, 0xb3f1ac4c, 0x333df6f5, 0xb40f58b3, 0x77c1aa50,
+    0x1d41346e, 0xb6889023, 0x61465622, 0x2c6ee05e, 0xfbbcd1c1, 0x7f30db5e,
+    0xe00dab0d, 0x01d8da40, 0x61a9b21b, 0xc40aaeef, 0x19c8234e, 0x1edd3803,
+    0x6cd9e3a9, 0x96b5c2c0, 0xc0aa143b, 0x952355e2, 0x6088900d, 0x6d16db01,
+    0x58dcc012, 0x68e73d0b, 0x613c9119, 0xbe809caa, 0xbffcf29f, 0xdb48cfc7,
+    0xffadc0fe, 0xffd8d300, 0xe4df6600, 0x5f3ffdfa, 0x5685044a, 0xe2caf0f3,
+    0x026257d2, 0xc4c02b40, 0x32206e73, 0x68a3e4cd, 0xfa77de19, 0x62dcf196,
+    0x11315332, 0x02f3030c, 0x99f09db3, 0x6f038bf1, 0xd40fefcb, 0x3bb5204a,
+    0x41df387a, 0x6d834235, 0xddb2aed9, 0x0a06a6a4, 0x81f5722e, 0x0f76c47a,
+    0x73adc739, 0x460da9d6, 0x6d53859b, 0xb6b99116, 0x960edd51, 0x816461ed,
+    0x42920cd9, 0xf1348c15, 0x8b633781, 0x0157c727, 0xce1075fa, 0x36a98cb2,
+    0x11ed3a3b, 0x44b5aa1d, 0x218cbbf9, 0x6728fc4c, 0x79232b0b, 0x35edc859,
+    0x4ba54e55, 0x0c1d52b1, 0xec8a48d8, 0x6bce239e, 0x0823ccdc, 0x7552522c,
+    0x51a59797, 0xe134cbb4, 0xab292b8d, 0x2c160ccc, 0xedb0bacf, 0x5e0ddeb6,
+    0x620e4400, 0x939046b6, 0x59f01033, 0xaae937d1, 0xe4bb2f68, 0xc346c952,
+    0xd53ed832, 0x2012978c, 0xc8d0b8e0, 0x26939485, 0xf4dc7706, 0xd5249d90,
+    0xe3828015, 0xf756b35d, 0xe2125736, 0xb07d8e58, 0x38cd19c0, 0xc0e97ecd,
+    0xdd30ed84, 0xa2a3b636, 0xca2d7e15, 0x55a2e0db, 0x025938a8, 0x99b6d7c5,
+    0x2a90f095, 0x992d4166, 0x6298c6ae, 0x75dfa924, 0xaa1847e8, 0x2fe66362,
+    0x2e4f26e3, 0x45707204, 0xe056eb03, 0x1f3e02b3, 0x98421e0c, 0x12c73508,
+    0x395c91a5, 0x392be5a0, 0xf3fc8a89, 0x865aac3c, 0x222c1406, 0x81f08de3,
+    0x027cb7cc, 0xb6f8ca4a, 0x3265b94b, 0xe509980c, 0x50927b95, 0x9930c8b2,
+    0x90bd3f88, 0x14bf71f5, 0xba4f8fac, 0x579bb2b5, 0x6b8b2c56, 0xf45a710d,
+    0x167ec7e0, 0xcced91d7, 0x7b4d0c27, 0x6926de9e, 0x8f2a0815, 0xebf69b55,
+    0x2acb40f2, 0x8a4ab051, 0xf62de870, 0x80c3c628, 0xc0d9774c, 0x059a8dd0,
+    0xb2de6a36, 0xfa874f46, 0x07272abb, 0x1b944c2c, 0x1b0c4226, 0x2ddbf836,
+    0x2160790f, 0x478c5920, 0x913d544b, 0xe00cc099, 0x604a46ec, 0xb493fb77,
+    0x6fe78d47, 0x5ea34aa7, 0x69382b95, 0x43e2e1fd, 0x6d297667, 0xd0ba3399,
+    0x239e9099, 0x41ca4cdf, 0x990032e7, 0x375b0f61, 0x98931946, 0xc6e9f069,
+    0xdf0b9ba3, 0x8a11da63, 0x604a322a, 0x12052aa9, 0xf00eb431, 0xf0133c06,
+    0x10ea29d7, 0xf66bbc00, 0x58a6bb42, 0x5ec98029, 0x3ee568d5, 0x06c158f5,
+    0x62382513, 0x6b611bb3, 0x0c757ae1, 0x36252dab, 0x0e4eab2c, 0xb32803f6,
+    0x9e70a441, 0x65eb83d9, 0x62c8865a, 0x44fa9899, 0x29d63c18, 0x7ec25268,
+    0x3a2b5d6e, 0x52579271, 0x885c6ba5, 0xdad37b75, 0x4e409309, 0xf24496aa,
+    0xf14c0c27, 0xb6883462, 0xc74bc6dc, 0xfeaa9eed, 0xfe3f03da, 0x75f68fee,
+    0x53fd463d, 0xa32d59e2, 0xdfcdbc49, 0xdce5422e, 0xe58ce338, 0x08442e7b,
+    0x092919b7, 0x7e07e29d, 0x6cc641b5, 0x25cd6910, 0x0c937b01, 0x121266e3,
+    0x96277649, 0x9269e238, 0x4b0a869d, 0xa71ebe6e, 0x9ab52b8b, 0x954c54c2,
+    0x9ccf42e2, 0xbc4f5cd8, 0x9986a584, 0xeeb0f499, 0x5c624c40, 0xed75721f,
+    0xae675cd6, 0x92d86ada, 0xfeca2457, 0xfbbab216, 0xe464c5a1, 0xd9644925,
+    0x91b27276, 0x91291e29, 0xc22c555f, 0x57358d99, 0x85b5ae31, 0x51ec3066,
+    0xa9a37e6e, 0x314391a7, 0xd19c4dda, 0x8b5dea31, 0xb94cee1b, 0x85a8d755,
+    0x5a584b9a, 0xd7f8bcc9, 0xb364c34a, 0x0dd77bba, 0x62196e7d, 0x320303dd,
+    0x83bc0225, 0x2fd650ae, 0x1357286a, 0xeaed126c, 0xb3dda952, 0x2699b5ed,
+    0xe398cdc2, 0x6206b9c8, 0x943c8378, 0xcdf31175, 0x3288bb65, 0xa6953a09,
+    0x7830b807, 0x30f8dce5, 0xf21913df, 0xe6251207, 0xb6f9e23a, 0x1e392eb5,
+    0xc0464d1e, 0x92784b2a, 0x085b9986, 0x9183e318, 0xf1c82999, 0x8af4bc1d,
+    0xaaa9f6fa, 0x9293b0d8, 0x4b7d7a8a, 0xe586d2ce, 0x90e2b78c, 0xd210d9d3,
+    0xd3c851c9, 0x8b618c6d, 0x38dd4f9f, 0x3c03ea27, 0x2bca75f2, 0xa73e545a,
+    0x84152872, 0x5b918036, 0x6b64c52c, 0xac175082, 0xea881967, 0x9d7268a5,
+    0x49156245, 0x1322855a, 0x8b253b06, 0x4551ed04, 0xe2766460, 0xe776d9a6,
+    0x2c2c3310, 0xfca5030a, 0x06de29a4, 0xb6d78411, 0x8c3acfaa, 0xc7bc6341,
+    0x4aab781a, 0x660bb026, 0x86636465, 0x6e525264, 0x4aa55eab, 0xb6108bec,
+    0x2f985405, 0x1d88a198, 0x96850e89, 0x3bc7937c, 0xd744a897, 0xdc336f39,
+    0x5fd534b4, 0xc2615a25, 0xc9ecd069, 0x54b112ab, 0xdc5f4598, 0xce849364,
+    0x43783fc9, 0xb0ddd265, 0x23d8999e, 0xa24b9149, 0x4863db93, 0xb6597041,
+    0x4435d116, 0x8548abc2, 0x9560ce8b, 0x86996c12, 0xd207557f, 0xf6b482ed,
+    0x18eeb255, 0x02ac2d24, 0x7ec9a086, 0x0b5f2392, 0xe9c7e7ea, 0x64942413,
+    0x45ebe831, 0xd1694c49, 0xc76dd56e, 0x92d7584a, 0x48f12c43, 0x6bb73439,
+    0xed3221a3, 0x49760b78, 0xb8c61432, 0xafd7f4a4, 0x763dd450, 0x7a0588cc,
+    0x5f2c9ece, 0x46c2991a, 0x8449a875, 0x5b71ac84, 0x548f888d, 0x74c8c963,
+    0x244cabdc, 0x287541b9, 0x4b9e56b0, 0x6c29ac72, 0x4bb2da64, 0xa65f3973,
+    0x9a9dc5e5, 0xa89c53aa, 0xaaa31bf5, 0xb9572fb6, 0x770c056b, 0xce4d0c03,
+    0x44ac3a39, 0xaf8a4dd3, 0x5c8415ab, 0xa9d542c5, 0x560659b2, 0xe02268cd,
+    0xcdf2a366, 0x5154da4e, 0x13d8cc5d, 0x97b86772, 0x23832aa6, 0xaf096e81,
+    0x812077bf, 0x56c12920, 0x57ef51b2, 0xd901974b, 0x886c714d, 0x4564f5cf,
+    0xd4b35f10, 0x911f2524, 0x3c55c744, 0xf76af3c7, 0x8a00fff3, 0xc37fe2b9,
+    0xffa900ff, 0x5a422d00, 0x14c514e2, 0x58e15c2a, 0x29084738, 0x04f72901,
+    0x88b2245c, 0xc6b8dd89, 0x7e51bf33, 0xa931aca6, 0x8ad5921a, 0x2e1f8407,
+    0x2a8f8e8d, 0xc99811d9, 0x46c459e0, 0x5c8fe36b, 0x4b5bf598, 0xb06ac06c,
+    0x63827bc2, 0x59dee176, 0x293a2630, 0x18077f2f, 0xe7166af2, 0xea13a4cf,
+    0xa675e518, 0x0972165b, 0x799ad7a9, 0x57c58a1d, 0xf5e528b8, 0x1031d31a,
+    0x10623973, 0x9e7edda9, 0xdb5dba8d, 0x58643534, 0xaa0415d3, 0xda8a9ac6,
+    0x9ed3920f, 0x2a492bbd, 0x301e6a36, 0x6df3a919, 0x59ee818c, 0x0ad820bf,
+    0x2b1a16ec, 0xad68dd82, 0x80d80af7, 0x054bc82d, 0x9ebb35b0, 0x25cab147,
+    0xba5c5629, 0xb559e9f5, 0xaf8ec479, 0xb6c6cc6a, 0xcb680b9d, 0x769038c8,
+    0xa9b4ed57, 0x61e9092a, 0xb760ce4c, 0x18374144, 0xf19bc542, 0x6f5c6836,
+    0x6013ebcc, 0x91ab98e9, 0x560327c3, 0xe6d8ad52, 0xd3460e41, 0x913d68df,
+    0x6c2e9cb8, 0x9eac2bb2, 0x65b3fc55, 0x53f02a6d, 0x2322f7ea, 0xf4e51fc0,
+    0x68bafc89, 0x84f9d53d, 0xd3220c98, 0x3d619e34, 0xd9b967f1, 0x47900767,
+    0x867c0baa, 0x27c67d0b, 0x1ab7ccab, 0xee5e7157, 0x7ecd9a9e, 0xdecf488b,
+    0xc630aba9, 0xd398b60e, 0x58855ade, 0x526fb336, 0xc82932b9, 0xe985ad49,
+    0x9e66b636, 0x335aad7d, 0xce3b7c5b, 0x348a9349, 0x4058808d, 0xbcee738c,
+    0x4c5c7708, 0x130c58c9, 0xb7e50642, 0x9157ac1b, 0xe16aa56b, 0xc664c990,
+    0x8692c908, 0x77bb82bc, 0x15bf91e7, 0x4e3fc444, 0x370eda25, 0xa9a7925a,
+    0xe14e6d29, 0xd130ab5c, 0x38b311b9, 0xc190af82, 0xb1e14189, 0x4d0dd3e5,
+    0xe65a75b0, 0xeb4c2d31, 0x4531eb15, 0x0b138673, 0x2a9354ad, 0x85579836,
+    0x0a9988e3, 0xba9d1923, 0x5e1681df, 0x52e43dfb, 0x8cd992cb, 0x252df6e9,
+    0x6d2e86eb, 0x0bb056f2, 0xdc35b110, 0x62b76c91, 0xcae493e5, 0xc46dfa45,
+    0x4c43b32e, 0x8e0ec198, 0xf08ba056, 0xc6b96dd6, 0x5aed95d1, 0x8caaaab0,
+    0xe4159077, 0x7d1b56fb, 0xd92e859a, 0x863ac8d2, 0x970a8522, 0x4bab5850,
+    0x83e26999, 0x9e895705, 0x0d232a45, 0xeab6f5be, 0x74f3a255, 0xc783f7f4,
+    0x80afd9a7, 0x91554733, 0x907a6501, 0xb4a27881, 0x51eedfb7, 0x11cf252e,
+    0x1a7a8e0b, 0x4b52aa70, 0xd37d49b9, 0x2e0285ad, 0xb9eaa244, 0x734e7351,
+    0xdb4746d7, 0xbb47de33, 0x1830a7c9, 0x7a7d4c87, 0x523beb75, 0x22806763,
+    0xdedd2c89, 0xb9200528, 0x0bc63536, 0xab75f0e1, 0x5416678e, 0xa10fcea9,
+    0xa8f0faae, 0x914f53af, 0xb04ddd25, 0x8875e27c, 0x5a012a50, 0x7a33f8f8,
+    0xb2c1ccc4, 0x09d966d2, 0x6031eb1e, 0xdca988ce, 0xb972c737, 0x11f3f170,
+    0x823818ea, 0x7e7ce2f1, 0xec966a5d, 0xb2ba49d6, 0x6262c717, 0x3ba8de8a,
+    0xda850929, 0xc79404bc, 0xa79f7cae, 0xc41409f5, 0x62d18274, 0x56343235,
+    0xead235b3, 0xc1caa9d7, 0xd17eb9b7, 0xcfe269a2, 0x58103548, 0x0b5af45a,
+    0x001f7348, 0x19355aa1, 0xe1859c76, 0xaa9735c7, 0x2a7976a5, 0x9aee61a0,
+    0xe1ae2c57, 0x4f0a66cb, 0xfd705c89, 0xfbf240eb, 0xba9de764, 0x2191e140,
+    0x8710d4e6, 0x6d62d3f1, 0xea882ecc, 0x4dbe6e35, 0x1acf40c8, 0x7589209a,
+    0x27e30181, 0xab6c152d, 0x4c56a182, 0xa7e5e7d7, 0x95562c56, 0xbdab3bdc,
+    0x09de6b61, 0x4b9e93c9, 0xd2405d43, 0x71a91061, 0xafc682b2, 0x55af6e61,
+    0x7d47cbe8, 0x931e527d, 0x1acb7dbf, 0xe472adc6, 0x7b974dc9, 0x5d1803aa,
+    0xdc318b39, 0x942ecf1c, 0x66b352e5, 0x258fa186, 0x464956ab, 0x04b9f1d5,
+    0x84d48822, 0x2eca6a76, 0xb04c2987, 0x402003d7, 0x49eac825, 0x7a116935,
+    0xaeed6dc5, 0x363b952d, 0x390e6290, 0xeceacfab, 0xb42b5f28, 0x6319c69c,
+    0x45245dcd, 0x6ba6436e, 0xd4d83556, 0x950becf4, 0x29c03bd6, 0x02578b9a,
+    0x31bcdf40, 0xc1f6b2b0, 0x90465ca0, 0x1e9f2b5c, 0xa74c5038, 0x0afb514f,
+    0x8d39a39c, 0x03b5bce3, 0x9f904f96, 0x0e38ed54, 0xcca448fe, 0x7b4f67d1,
+    0xea516515, 0x3326fd3d, 0xd39735e8, 0xa08c2d91, 0x402262c2, 0x37de28b0,
+    0x5c68afe8, 0x8195d54a, 0x6f573a6a, 0x2632c559, 0xebe97286, 0x24907765,
+    0x2d6e208d, 0x0bc7bae3, 0xb4373a19, 0x4f90ce7d, 0xd8ee68bd, 0xd81591ee,
+    0x375db332, 0xf9ee1403, 0xd806e448, 0xa6794d25, 0x144f16c8, 0x55c0624e,
+    0xa04dd392, 0x86bdbe97, 0x7619dd9d, 0x198b260e, 0xc5124956, 0x0b18309d,
+    0xb04c6697, 0x27bc3a74, 0xf54c0628, 0x9626e66f, 0x7962e9e9, 0xd34c4f15,
+    0x3cc77157, 0x88fd18fc, 0x2f14a0a0, 0x33fd1c23, 0xc8942322, 0x4d5353cf,
+    0x40aad259, 0x74d43256, 0x50cea8e8, 0x65b376d9, 0x886c302a, 0x71ae4c6c,
+    0x6f66c320, 0x5d3abb8f, 0x2522974a, 0x9bd6ece9, 0xa6abd70d, 0xa75525cf,
+    0xc2b53305, 0x2c80c254, 0xeb8f0832, 0x5500070c, 0xea74d3b2, 0x2327a7fd,
+    0xaeb5766b, 0x2414398d, 0xde372bd1, 0xea1cccae, 0x2fc479cc, 0x0c733414,
+    0xeba640fc, 0xb5d49869, 0xe25c5362, 0x89489643, 0x146aa890, 0xe19b346c,
+    0xc88d904c, 0x3381024b, 0xcfb8648c, 0xd760e54e, 0xe742dc4e, 0x6617cbab,
+    0x7fd6492c, 0x3dd58c1b, 0x507c3dbb, 0x38803107, 0xfa248a32, 0x889aa5f6,
+    0x5e9534ea, 0xb82aaa96, 0x65b32e5f, 0x536fd3af, 0x542a492b, 0x9822eb9c,
+    0x58927c0b, 0x8221b793, 0x7477b55c, 0x5c9d58ed, 0xfa426cfb, 0x374a0b16,
+    0x7601645d, 0x5751ccad, 0xde96b98e, 0x7e4b2ee1, 0x96e9db99, 0x852bdb06,
+    0xa80c4b4e, 0x0c37b6f5, 0x61cdc57b, 0x00c0c417, 0x8024a41f, 0xe55e3f22,
+    0xb9d3585b, 0x9efe5e5f, 0xe472b109, 0xf29512cf, 0x66d3edf9, 0x2290f449,
+    0x3103d395, 0x20919235, 0x8117f725, 0xa6ddeedb, 0x1625725b, 0x5393bb92,
+    0xaa300d92, 0xa3ab2ac2, 0x4c770500, 0xf722dc7b, 0x9b85993c, 0x6cd8c015,
+    0xf61778ab, 0x1bf70aab, 0x1f533233, 0xfa5acfab, 0x2daecb0d, 0xb62781ae,
+    0x77544b1a, 0x09677dd5, 0x1f315b5b, 0xfd326ba9, 0xbee0429d, 0xf5f4487b,
+    0xa953af03, 0x6a4925a8, 0x8e6cddad, 0x468368f6, 0xbad4de00, 0x69120318,
+    0x31312b06, 0x5aeaab9e, 0x9da4af66, 0x8aee76eb, 0xa20e4434, 0xa6656fcb,
+    0xca2ba201, 0xbcbf32a8, 0x771ee0c8, 0xe4e984a9, 0x339c0420, 0xeaecd4a8,
+    0xa8d96955, 0xe9558d5a, 0xa56a2ab6, 0x55a5d562, 0x6a926291, 0x8059daa2,
+    0xfbc65bba, 0x51163c6a, 0x06d430b4, 0xd7c00a9d, 0xdfc3c8d1, 0x702c76b9,
+    0xeba346ae, 0xd28a81e4, 0x89ac57c1, 0x58d9e698, 0x9cb6d44a, 0x745e75c4,
+    0x54b15673, 0x52e36811, 0x8dabd1d2, 0xd456136b, 0xfd26a0a8, 0x012e655a,
+    0x5f28bd6a, 0xb3e7ce95, 0x0fad03b9, 0x8d3a0a4b, 0xb2d254eb, 0xf6978571,
+    0xba2bddc1, 0xdc52a831, 0x7ec95b6a, 0x90063c09, 0xbc09a207, 0xd2a28e8c,
+    0xaa0a1daa, 0xb9812cab, 0xa56c8761, 0xa16e6b55, 0xdd183103, 0x10a0447c,
+    0x52098eef, 0x4435214b, 0x1b68df69, 0xe0574a7a, 0xe82146eb, 0x615f8264,
+    0xb4510050, 0x700c1136, 0xc9e7f2c1, 0x9a63abe5, 0xc06f0fd9, 0x65f86ff3,
+    0xfa9888f4, 0x9e514ec8, 0xfd4f3fc3, 0x0cfc9c7a, 0x92f9416e, 0x13b2fbf7,
+    0x9f2d0de2, 0xbed879cb, 0x41b6fa98, 0x78e22c69, 0xf885a9cf, 0x71f0a902,
+    0x2749f46b, 0xbf6549f7, 0x9288dc27, 0x3df4e998, 0xd9add7c8, 0xb16a23b8,
+    0x6958eb12, 0x00e7f12a, 0xe34204a3, 0x870147d8, 0x49f29411, 0xa8dcb96c,
+    0x1e49ba22, 0xbb87155d, 0x799d3215, 0xb702b878, 0x87094a6e, 0xdc78279a,
+    0x1f1191c0, 0xd22ecc7c, 0x8885516a, 0x11a4d8a2, 0x34ccc864, 0x4d4880d7,
+    0x6cfb9474, 0x9cd8cab3, 0xfbc6cb60, 0x7fa9d56f, 0x1b8e5363, 0xfc068b69,
+    0xabc05945, 0x58daad0c, 0x5bbb0a6b, 0xd3aff294, 0x390f085e, 0x6e23c064,
+    0x66b16393, 0xe3a27b1a, 0x8af0176c, 0x3ba020de, 0xd10d76ae, 0xafc94281,
+    0x2e89cd5a, 0xcc1a5f41, 0x7d06d2cb, 0xb58e2649, 0x286d5353, 0x31af30d6,
+    0x3dac0a14, 0xa0c5556c, 0x02259756, 0xf35a210d, 0xb95d1673, 0xd5654e81,
+    0xd45de33e, 0x85319d56, 0xb52cae7a, 0x7241070e, 0x2c526417, 0xe56edc15,
+    0x02c6d6c2, 0x1928ea73, 0x5a5efe2d, 0xc56fa196, 0x4a68755a, 0x1275c68d,
+    0x1a2c88b6, 0x5d212423, 0x44840b62, 0x88394bec, 0xf5905889, 0x96f5f5f0,
+    0x3649b969, 0x6d7cc85b, 0xee165987, 0x5d95432b, 0x0f0c4cec, 0x5fb190bc,
+    0x29badb29, 0xc8ad8e98, 0x395df846, 0x6cfda72f, 0x00fff8c7, 0x88814887,
+    0x772e2680, 0x10f91efa, 0xfa6f8cef, 0xa3fcf3a7, 0xd3545fad, 0x4a56f7eb,
+    0x30dc4ac5, 0x212b22d7, 0xef68af2b, 0xad5765da, 0x50424dd1, 0x41c12293,
+    0xb6c94596, 0x397556d0, 0x1bb0a056, 0x7566a5cc, 0x05516938, 0x622dc949,
+    0x9b1222f0, 0x5938b2d5, 0x8f656962, 0x3a7289ab, 0x033df76f, 0xfb400eef,
+    0xc21baae8, 0xd994338a, 0xf32223b0, 0xfb9af905, 0x1173fe86, 0xadf4ccc7,
+    0x6eab424b, 0x85b85980, 0xdca7b1d5, 0x58a9ad39, 0x26b619bb, 0x4081dab0,
+    0x30ed5429, 0x3d47949c, 0x51445688, 0x44d3902c, 0x9c6d29b4, 0xf515dda0,
+    0x815b2849, 0xca7d9836, 0x6062882c, 0xf74c874a, 0x8a61afa0, 0xeb283289,
+    0xcf697852, 0x8c934445, 0xcdafde6a, 0xb2cca65e, 0xbb30ca45, 0x7521dabd,
+    0xbb6a1157, 0x5a8f8903, 0x2511d9e4, 0xc2bf6623, 0x31ad0ada, 0x343b6f71,
+    0x0895c314, 0x97722157, 0xe207410f, 0xf20e7c26, 0xc1398e45, 0x8e6b1144,
+    0x2859a7bf, 0x327c5832, 0x2af3a869, 0x2fbdc540, 0x64966d29, 0x892a513c,
+    0x71e69c93, 0xa667481c, 0x8d5d9783, 0x2d713a8b, 0x35c81d13, 0xdd96563a,
+    0x6ceb9a33, 0x8fe64021, 0xdcaf9420, 0x6b589350, 0x5de8e193, 0xe17ad5a6,
+    0x87899856, 0x0f5aa958, 0xbd02d353, 0x67d7da7e, 0x077a54a8, 0x9e5d8d92,
+    0x19075070, 0x2e3930ae, 0xa6e7c5ad, 0xa4562bd2, 0x678114bb, 0x8d81b566,
+    0xe492e435, 0xc13665bf, 0x62844089, 0x0693ca14, 0x0355de71, 0xc8a56e26,
+    0x66c126cd, 0x44a33e31, 0x2e0f4049, 0x3f0c6239, 0x76a69c0a, 0x758f08c4,
+    0x98a4e935, 0x76cefaf3, 0x69a78452, 0xc6a02f23, 0x66be00ff, 0x47cc3c06,
+    0xd551a94c, 0x1a055786, 0x76cedb93, 0x0e68c772, 0x6f72a7da, 0x52f576e4,
+    0x33129910, 0xc9859980, 0x0b7fe1b4, 0x44b5c33a, 0x427152bb, 0xcd9edafb,
+    0x6201a546, 0x1516baa9, 0x144cdec0, 0xfb726cac, 0x7c7a1880, 0x20be9a80,
+    0xa6a5b0b6, 0xe1134d13, 0x766d7a24, 0x6b4fed3b, 0x499ecf64, 0x2cbfcaa5,
+    0xc0404889, 0xc56f37e7, 0x3be82647, 0x35dd6d88, 0xe1fc1903, 0x46a40519,
+    0xac8449c6, 0x4c663e59, 0x6d941956, 0xabee5e3d, 0x851540f3, 0x00f574b9,
+    0x56a3c9b6, 0x10c598da, 0x9548ad28, 0xcb915c78, 0x045245a2, 0xc47154d3,
+    0x07f9b30d, 0x6d8adec4, 0x71deb862, 0x9b86b85e, 0xa4d69279, 0x009e5bea,
+    0x1fbb1535, 0xaa2a8869, 0xde3cf8bd, 0x7fe563ca, 0x4300ff12, 0x851bb6e0,
+    0x7f3c3107, 0xdbdc5f6a, 0x6aa72c47, 0x224738d0, 0xa75facf6, 0x503b0064,
+    0x3745f942, 0xe8f30d0c, 0xa909f15c, 0xf2b4b600, 0x110063c9, 0x8d77d687,
+    0x1a0428e5, 0x7bcb9bad, 0x54b4b42d, 0x310ee3e2, 0x8210d3d8, 0x38111613,
+    0x8059229f, 0x923b0640, 0x6c5c8de9, 0xee4b66d3, 0x4046c432, 0xa8ab5b31,
+    0xb623c915, 0x1e64c2e0, 0xbd2c282c, 0x9ea80112, 0x7555a2b5, 0xb5b226c9,
+    0x4982528b, 0xce38584b, 0x6349ccf9, 0x898f659c, 0xac9996e9, 0x6d7b1669,
+    0x6fad69e1, 0x21c1da94, 0xe71195f6, 0xfe72cf7d, 0xd3536ecc, 0xd935dafb,
+    0x7817b771, 0xba5d1018, 0x51450b98, 0x58434980, 0x950cf489, 0xfa19baa4,
+    0x84898f23, 0xa57648e9, 0xa01db109, 0xa03197d2, 0x72672193, 0xc98043ce,
+    0x6296d266, 0x702969d8, 0xa6dcb240, 0xe7fe4d67, 0xa1b59da6, 0xb2e1ae8b,
+    0x2c88c47d, 0xb6b02814, 0x29e3654e, 0xf4c780e4, 0x643fe6e0, 0x3adde1b7,
+    0xabd8b5dd, 0x560e2e35, 0xc07a3400, 0xa2c24e08, 0xbd35561e, 0x7d8aabbd,
+    0x77a7e27a, 0xe36e810c, 0x4bb4405e, 0x1dd84a31, 0xbddad7c7, 0x4d4a4d2b,
+    0x52bfa467, 0xe49a4c4b, 0xf552caf2, 0x3edb5ab4, 0xef84f2a4, 0x855a97cd,
+    0x34ddfca6, 0x6599dd66, 0x902bd462, 0xbdbd9c2e, 0xa67bced2, 0x053aadb0,
+    0x8c8978bb, 0x16b163c7, 0x4ab37523, 0xa240aa45, 0xedbdb6b0, 0xad84e8d2,
+    0x8a55e9f4, 0x6845c0bd, 0x94eb4264, 0xf1cb64ca, 0x36a1c209, 0x88d5cab8,
+    0x7b35d25d, 0xc89bb48a, 0x732be460, 0xd842225b, 0xde2ae487, 0x27198b5a,
+    0xa745e288, 0xdbaabe30, 0xeba9a8d4, 0x832c6c08, 0x057e6c88, 0x313904a1,
+    0xe270d3a8, 0xb7cc69c1, 0x8f2711d7, 0xbf96c4de, 0x526b7985, 0xfc7233a9,
+    0xc95af95d, 0x735795af, 0x5a1900ed, 0x8b850b71, 0x9b6df2b0, 0x750f5630,
+    0x5f2357c2, 0x6bd2d1a4, 0x1fc4dd71, 0x5a6d837e, 0xd838b009, 0x4685d917,
+    0x007b5aa6, 0xc3a6d894, 0x135fd305, 0x4654119e, 0xcd1d8b76, 0xab4db122,
+    0xd14ab320, 0x942ca9c8, 0x45322bb0, 0x256c22a0, 0x43f0f004, 0x9900d784,
+    0xea9184d9, 0xaad13ed5, 0xbdc5186b, 0xe0966682, 0xb9ca72c1, 0x8d18ab66,
+    0xb13e6d76, 0x13ee7196, 0xd5990c83, 0xadafa7d2, 0x331c833a, 0x19eb6636,
+    0xe358b860, 0xa4b420c0, 0x12a060ae, 0x6058e7bc, 0x1fb2a11f, 0xe85a23a2,
+    0xe32edfbc, 0xb37311ee, 0xa66a8c08, 0x05b7b072, 0x76558962, 0x115b867b,
+    0xc038cf1a, 0xbaa9ad63, 0x4eadd66a, 0xa59796ba, 0x2b1a1f59, 0x60066cd4,
+    0xd96e22f9, 0x493d139c, 0x6c67ca02, 0x2ba49565, 0x48707695, 0x9289850d,
+    0x1279420d, 0xd828c5b8, 0x62bbd6dc, 0x67457d41, 0x263931c8, 0x65bd8c9c,
+    0x65f9696b, 0x0cad0375, 0xcff6a6ee, 0xf236715d, 0x7b22f086, 0x08929987,
+    0xe53fad3e, 0xedd918bf, 0x3b41d9eb, 0xfd6a4dd9, 0x10430dbd, 0x18a7977a,
+    0xbe4890e0, 0x9525acdf, 0xfac9a893, 0xc7142fd9, 0xf447f161, 0xb4806843,
+    0x1fbf7350, 0xfcf1a8be, 0x6bfa594a, 0x8afb4044, 0xa9fdaf98, 0x4638650e,
+    0x272aef17, 0x4e80e48c, 0xb6503944, 0x675c1e4f, 0x33e440b8, 0x3263ccb4,
+    0x26b87023, 0xe3f9fdc3, 0x9f574caf, 0xad2170d6, 0x5f1f1159, 0x281d413c,
+    0x4687592d, 0x362dc6e2, 0x3dafb961, 0xbe2126b1, 0x43466092, 0x60e0c4b1,
+    0xb37a3e71, 0x8bbcd1df, 0x6a472d71, 0xeb963dd6, 0x11791cbd, 0x665c3181,
+    0x0f0b9f7b, 0x4dcd83d2, 0x8405604b, 0xadf438dd, 0x57ac4c43, 0xd5c99420,
+    0x6353e28a, 0x2678608d, 0xca5b0aec, 0xd47c12d8, 0xbee69e34, 0xbd11e266,
+    0xe4ba06ee, 0x354c6882, 0xa6b87580, 0x66a54ccb, 0x53143600, 0xcd7bace9,
+    0x01bc8f80, 0xea21982c, 0x7692a796, 0x62d7584b, 0x6114616d, 0x0b2264a9,
+    0x2a65c454, 0xb0336f4c, 0x8e2545ec, 0xf7773a72, 0x5ea1d651, 0x625441d4,
+    0x6712bb83, 0x72514d14, 0x9067cc8a, 0xb3004f4c, 0x670e4a6c, 0x23e75e68,
+    0x502e5612, 0x2df3e08f, 0x4a5663ea, 0x8563e0c8, 0x2c07969f, 0x5e9e2237,
+    0x768a3cd7, 0x337adcf3, 0x90d651eb, 0xb320fc51, 0x415dd1ad, 0x47adecd3,
+    0x3c44c55a, 0x2a2cb535, 0x0d504ac5, 0xe10ad163, 0xf6e329af, 0x2cb0b5ea,
+    0x5527d429, 0xcd3a6fc0, 0x863bd6b0, 0x8c8ad62d, 0x6aea8d26, 0x1957b551,
+    0x15eac45a, 0x2b96b1ad, 0x3cc65b2c, 0x844b316f, 0xaddbd1ba, 0xda93c6f1,
+    0xd7b4b9be, 0x536a84cc, 0xd86ccc71, 0x9bcc4158, 0xc84a712a, 0x2e547786,
+    0xc7923d06, 0xe5869f56, 0xa95dd18b, 0x4b369dd4, 0x35458325, 0xe051bd1e,
+    0x427bc6b2, 0x51620c7f, 0xa01de0f5, 0x0ce38897, 0x51709e6c, 0x33cc1119,
+    0xf38e4c7f, 0xf8bc0733, 0xfe9928fd, 0x614dfdd6, 0x0616a34e, 0xb8386506,
+    0x2c58105a, 0x21764266, 0x3e4049de, 0x1f03ea23, 0x96eb5597, 0x41690895,
+    0xe4669b02, 0x9500ac52, 0x85723398, 0xf122422d, 0xe4383e32, 0xfbc04496,
+    0xce101191, 0xefe6200d, 0xdf812b0b, 0x317bc003, 0xd2da3173, 0x2411c4ca,
+    0xdb9e19d9, 0x0d3e362e, 0x692caccf, 0xabe4437a, 0xd5e88dab, 0x66dcca74,
+    0x0772c339, 0x83cd41ba, 0x24b6cc9d, 0x511f21e1, 0x5658a6df, 0xaa55999a,
+    0xd4a902e2, 0xb9ae31f4, 0x12edb862, 0x1d669b24, 0x0e5c662b, 0x13dc381c,
+    0x50dc9690, 0xe9a58582, 0x3acd7eb3, 0x7dd546f6, 0xd8804a9e, 0x7a20593b,
+    0x2cc865a5, 0x4c7532b3, 0x383100b1, 0xba9a2198, 0x51ae826d, 0x58385706,
+    0x475669aa, 0x64dbf704, 0x3820754d, 0x94612cdb, 0x77ce8a40, 0x33dbf5f4,
+    0x85877557, 0x8da3ae73, 0xdba0b71f, 0x7014a902, 0xe9ca53d8, 0x4b184f32,
+    0x17cbe9ed, 0xe3db8c1c, 0x358bc95c, 0x8ff7713d, 0x6e574053, 0x13caba80,
+    0x0bcb06a4, 0x1f792037, 0xb2b4b926, 0x15b08569, 0xc8dcb88a, 0x2cc41d53,
+    0x7edba8b9, 0x2d472cb5, 0x6a3f1856, 0xefd2e38b, 0x5e8acd58, 0x81e2c89c,
+    0x37886d81, 0xea441d72, 0x2c97644c, 0xdbab4abd, 0x5fc04f7c, 0x0671430c,
+    0x082c1fc4, 0xe0453d84, 0x649145e3, 0x03085eed, 0xdee082d6, 0x034e4a22,
+    0x6cf8d489, 0xaf3cb8c8, 0xa5a45422, 0x0916096c, 0x1831154b, 0x4c941094,
+    0xf5f43b8e, 0x367ad73a, 0x60df94db, 0xc236d808, 0x563021d9, 0xc7403cd8,
+    0x5f8e8d18, 0x09890b24, 0x692311f1, 0x9c2702da, 0xeac75606, 0x54c21635,
+    0x3612216c, 0x1810cb17, 0xc73bd076, 0xe015371a, 0xd9565be0, 0xaf34878f,
+    0x932fc154, 0x6f38a952, 0x2cbee7db, 0x4d5c1e51, 0xc3339390, 0xb95ece97,
+    0x665ac63b, 0xf569dc8f, 0x82b226a9, 0x889175f5, 0xb0dcd1a2, 0xa0620113,
+    0xcdaf28d8, 0xb1a6d43d, 0x08c40a0c, 0x08eacc87, 0x6cd815aa, 0xb7404b4d,
+    0x99b0762e, 0x0a2e0788, 0x120e4ea1, 0xaadc2e93, 0x27821f44, 0x28d3818f,
+    0x0b126c9b, 0x1b649050, 0x36cf9260, 0xbf1248fc, 0xdd88503e, 0x67aeb493,
+    0xd309b5cf, 0xebba00ff, 0x681e1f57, 0x3f42eabf, 0x62cefaa3, 0xbe51fd37,
+    0xee083be5, 0x4fd51153, 0x15d36a84, 0x34ba426b, 0x71cda40a, 0xc0d2264d,
+    0xf3fad55c, 0xc9512999, 0x7348ac0c, 0xcfa45f3e, 0x63ad7557, 0xeb04dd8e,
+    0x44b9b2da, 0x6c017cd0, 0x91f79a54, 0x2606923c, 0x892f5c62, 0x29e4dec1,
+    0xd53143a6, 0x85405fed, 0x216495aa, 0x399a644e, 0x37d93eb5, 0x02c1f065,
+    0x64951c99, 0xb1194714, 0x6336810a, 0xa7316f18, 0xad89d38d, 0x6218ba0d,
+    0x9bfa85b8, 0x6d7dafc8, 0xe7b07e42, 0xcebc6308, 0x45f7f901, 0x168b3b68,
+    0xd53224bb, 0xd7c8527d, 0xcc96b21a, 0xc1d72aaa, 0x01925c82, 0x6076af5e,
+    0x94ec52be, 0xe20a2f64, 0xa82ad59b, 0xf660c3dc, 0x1617ab5a, 0x6a9e4b5c,
+    0x5a32adc0, 0x701d3429, 0x76cb601a, 0x64224a92, 0x96d6837b, 0x719dcd95,
+    0x6199b6ba, 0x1ca6ab8d, 0x956abad7, 0xef0148bc, 0xc11364ca, 0x2abb2516,
+    0x4ab81562, 0x45c7208c, 0xab31fc58, 0xaa9dee5b, 0x55c9d5a8, 0x39297a91,
+    0xe6d305cd, 0xa58250aa, 0x78f58e2b, 0xc48e3f8c, 0x61613033, 0xe287fda3,
+    0xb26b1f4b, 0xccefeb9a, 0x1a49731c, 0x98c6758d, 0xe91a8124, 0xadce50a3,
+    0xd8b2b1ea, 0x6cdcde1e, 0xb1c334d8, 0x72457ca2, 0x52d41335, 0xb9c467cb,
+    0x310fdcd5, 0xa782d351, 0xe3b32bdc, 0xc6877640, 0xbc610051, 0x745a4f81,
+    0x9caf834e, 0x336b37b1, 0x57f70816, 0x6822cb97, 0xcd4218fb, 0xfc54b613,
+    0x597d4c11, 0x6bafea25, 0x0a612d51, 0x3a1f9bac, 0xb216b5d5, 0x6156e1ce,
+    0x3583aa70, 0xd750ed63, 0xdf534055, 0xe382c1ea, 0x9fc69719, 0xcd264b4f,
+    0x5859542a, 0x7e5f6d51, 0x6ac589c3, 0xc18d0aef, 0x27923bdc, 0x20d4e43d,
+    0x281841b5, 0xb7dfa467, 0x9b07f323, 0x84289856, 0x3baf05dc, 0x90dc8a32,
+    0x6bd8b6bf, 0xe542c603, 0x6548d2aa, 0x5764a87c, 0x55535673, 0x71babcdc,
+    0xb477a948, 0xd72cdcd8, 0x5625b869, 0x955c5522, 0x16b7780c, 0x188c75af,
+    0xd3a7f588, 0xe86c00d1, 0xf7d6ddfa, 0x3d69ed56, 0x887734c3, 0xe42eac8a,
+    0xc4d56a54, 0x44656a09, 0x9b1e5a6c, 0x4b01485b, 0xae403452, 0xa96a85c5,
+    0x59a6877e, 0x28ab409d, 0xa6969408, 0x4891f1ac, 0x66cd8e2f, 0xbbda0ca1,
+    0x6547c6b2, 0xbbcace16, 0x2adb950d, 0x6241a905, 0x330fd41e, 0x21636540,
+    0xe38e5618, 0x13f94a17, 0xe94570f8, 0x8bb6a9e9, 0x66412d15, 0x8018e268,
+    0x2006f7e4, 0x62446446, 0xe9efc00b, 0x6cd2138f, 0x347ed2dd, 0xa6a123b2,
+    0x6b02ecc2, 0x253edd61, 0x7df267cc, 0x94a6ad8a, 0x93b2b3b2, 0xaa192880,
+    0x6767a2dd, 0x90f13ffc, 0xc0dab412, 0x32aa40ae, 0xf139a48b, 0x4906d99f,
+    0xd892f56e, 0x8c134fcc, 0x960316a9, 0x99ce52af, 0xd64a7df1, 0x2a205e15,
+    0x5c761d90, 0x5bad9289, 0x20d51e50, 0x2a9f3cd1, 0x4f06a6dc, 0x9d5fa628,
+    0xf19f86c5, 0x09a15595, 0x01d3f621, 0x44645457, 0x8cab2c12, 0x26d2e120,
+    0x38697e2a, 0x442fc5df, 0xd3815789, 0x075f2b7e, 0x143b0f67, 0x53a3c8ea,
+    0x5bb21763, 0xad20d382, 0x925825b1, 0x9514f503, 0x43259f33, 0x11b5befb,
+    0xe16f24ae, 0x8908108e, 0x24306c32, 0x62626220, 0x6d234a4a, 0xc6f563e2,
+    0x33de7cdd, 0xf63aad4e, 0x71f644a0, 0xc37e17cb, 0xe05eef2c, 0x46bc76f0,
+    0xaaa88304, 0x5bf963a9, 0x8a789e63, 0x92eea6b8, 0x8b5eedea, 0x8374f571,
+    0x33ebd338, 0xc0b1b43b, 0xac380540, 0x9bad25ce, 0xec7ca950, 0xc6f311a6,
+    0x35cdf2f3, 0xd409654c, 0x921ae6b6, 0x94559d0c, 0x909abd46, 0xe248584f,
+    0x878d312a, 0x0d59020c, 0x67223d2f, 0xcb33b04f, 0xebb8623a, 0x442f51ad,
+    0xc6058930, 0x0870822b, 0xdc6c5836, 0x39b200a6, 0xf4f0f180, 0x3a219d4a,
+    0x8d7aa0c6, 0x5d161243, 0x67ae5734, 0x38d8dda5, 0xd26e5199, 0x989960ed,
+    0x7c669378, 0x0f3f6788, 0x57db1c91, 0xd439b5cf, 0xf83bc402, 0x10d234cd,
+    0x44fb35bd, 0xe989a294, 0x6bc21a4f, 0xdf6d2d96, 0xd251d46d, 0x59dfa498,
+    0xdae9ed12, 0x827d7263, 0x9793d007, 0x23c41645, 0x1c6219b6, 0x10a48db0,
+    0xf89678b3, 0xaa59c011, 0x776b8d3a, 0x2ac89ebb, 0xd9882552, 0x266fba59,
+    0x34d1d8bb, 0x8bb80e4a, 0xc08c8c1e, 0x0114199e, 0x42efe989, 0xcb1e832f,
+    0x0a5a075c, 0x88d322b7, 0x84581a5c, 0x7871cc0a, 0x5808a6bc, 0xf519a95e,
+    0xd60a9064, 0x3d2389da, 0x9a48923b, 0x361a5b2b, 0x3ed98a22, 0x59fe23a0,
+    0x80f592c4, 0xea136149, 0x79af6ba4, 0xdd776967, 0xe050535e, 0xbf131764,
+    0xe24ab566, 0xa7304716, 0x830b0163, 0xf1381119, 0xa6b7d4d4, 0xafa63d6a,
+    0xa266b854, 0x4bd79865, 0x12b76193, 0x4a87e283, 0x18a422ec, 0x492c538b,
+    0xc39061b0, 0x74167449, 0x35d6efca, 0x43ed502b, 0xd7e9954a, 0x98aad4aa,
+    0x7b365902, 0xa5b4e5c3, 0xa486c443, 0x219335d7, 0xa9dc961c, 0x56a45824,
+    0xccce0e75, 0x4d0e7269, 0x8daef7aa, 0xa73beea8, 0xa71d94ea, 0x17cabd55,
+    0x16ebd68c, 0x6bc11420, 0x2c8d2438, 0x5cdb4b4e, 0x2c7aeea2, 0xdff46072,
+    0x23f69989, 0x4e4cd8fa, 0x2611e98b, 0xfac7ac89, 0x4c4401c6, 0x3f516f9c,
+    0x5855af0e, 0x7ea59e2a, 0x5b82882e, 0xace10da8, 0xd5c2b7b8, 0x173c1d3f,
+    0x02904f57, 0x29f7e09e, 0xe3e024c9, 0x8e6259d0, 0x4f178da6, 0x74714d65,
+    0xa5b23b0b, 0x79b7b266, 0xa07d3f2c, 0xe66bcc50, 0xa064c1cd, 0x9f77660c,
+    0x0ac587b3, 0x51b7e5b0, 0x86ebc90d, 0x4b95f556, 0x638589bc, 0x446be658,
+    0x852ea3b5, 0x40cf56b6, 0xa565d26e, 0xecd948fc, 0xbb00ff12, 0x96640599,
+    0xc46e6933, 0x3286cad6, 0x88314eb0, 0x2313ddab, 0x40142e60, 0xcf1889bf,
+    0x1722a793, 0xd181496a, 0xe1436a8c, 0xed0c31b1, 0xa1863b0b, 0xb89d50ae,
+    0x64ee9784, 0xeb3c5a22, 0x3ef85f63, 0xdd3167a1, 0xc3311d92, 0x1e8984f6,
+    0xe5795ac4, 0x5e4160f7, 0x201c11b9, 0xdd5e9b48, 0xf40c561b, 0x611b0274,
+    0x743413b7, 0xb32ba4cd, 0x8c3de17c, 0x2c64ae49, 0x0fdb2709, 0x436e19b9,
+    0x0a96b537, 0x730e1bfe, 0x025a9b7a, 0x6bc62a97, 0xc1cd6ba8, 0x7270a6bd,
+    0x953a7248, 0xbabf017b, 0xb62ac7b8, 0x6d8a3a57, 0x47dc991e, 0x7840dd1d,
+    0xb63b816a, 0x7b3ac3a3, 0x174cd333, 0x995b185b, 0x4d603652, 0x7421a6ed,
+    0xffcff67f, 0xd3adde00, 0x52a1fdf5, 0x5dd36dbf, 0x07df769e, 0xbfa414c4,
+    0x9189c8b2, 0xb6d3319f, 0xb8ce381b, 0xe6f8c337, 0x1851ccd1, 0x83cf44da,
+    0x98f5bf62, 0x629ef8b3, 0x3b8fb639, 0x7bfe5af1, 0x00ff8ef9, 0x631fb137,
+    0x2b8f69c7, 0xff1be6df, 0x9e6f9c00, 0xe8f639de, 0xf1e68a27, 0xe3a11ead,
+    0x8f7d7459, 0xc38f8119, 0x3e0f35de, 0x399e6f6c, 0xc2ab3747, 0xdd508f27,
+    0x0975cb7a, 0xe299d691, 0xf0c2819c, 0x5163c6f6, 0xfbcd9189, 0x7b721cc1,
+    0x694dbfde, 0x35f652c3, 0x6dcb576b, 0x9300ff68, 0x2d1e3e37, 0x1b6a3894,
+    0x12dd4bc8, 0xdc377b32, 0x120a23f7, 0x6ba4af35, 0xa269b35c, 0x1cd3699d,
+    0xda825c6c, 0x7a49e28c, 0xdc164f83, 0x91893531, 0x5860023a, 0xd426ba30,
+    0xb7d71bea, 0xb5f8c37a, 0x74ca5e31, 0x829ad610, 0xad550809, 0xc7e1e6b8,
+    0x66b9b81c, 0x8ebba54c, 0x28359299, 0xb6a81ded, 0x1fab16c7, 0xb7b3d472,
+    0xb4875b9a, 0xc93bdce9, 0xc9b37cdd, 0x2371963b, 0xf595b1a5, 0xef9d7605,
+    0x25353572, 0x121d062a, 0x4284e635, 0x388689e3, 0x4bf4f995, 0x4752c8d9,
+    0x5e635a9f, 0xab3a4fad, 0x35caddbd, 0x63d38634, 0x540c3bc2, 0xdb90a810,
+    0x92438cbc, 0x9927cf7c, 0x9d582a9d, 0xef75ec53, 0x511dae05, 0x4a762271,
+    0x9c4f6378, 0x13458907, 0xe7f4a1f6, 0xa7fd7d3b, 0x1a912f7d, 0x5c29d9b7,
+    0x551d9e4d, 0x4e2c8b51, 0xd23f1dea, 0x378a553c, 0xe538018b, 0xce58f0e8,
+    0x6b6b48f4, 0x177a4d49, 0xacd59a2b, 0x790ce528, 0x33d1a464, 0xb6a79811,
+    0x642cd1e2, 0x2c98a9bd, 0x343f2d4b, 0xd2567beb, 0x5afc4d5f, 0x96456fad,
+    0x8fae48cc, 0x7d4217d2, 0xf8c4af59, 0x1658e256, 0xb94ef354, 0x69331a1c,
+    0xab548b3f, 0x1dc9b4e9, 0x8ee95395, 0x5cb7f79d, 0xe34ef4ed, 0xe4ea2de9,
+    0xb4387a9d, 0x3ddea233, 0xd9a6a74e, 0xf5d6ec61, 0x89673a46, 0x844ffcf6,
+    0xe9993ee4, 0x1e5f2719, 0x3368063d, 0xbca7538f, 0x843d2c5d, 0x7e69bcfa,
+    0xf6cf1527, 0x677a9453, 0x7cbd6ea5, 0xfc0f7f65, 0xa9d4b6bc, 0x3fcedeef,
+    0xdf560f67, 0xcbcef42b, 0x23ca8bfd, 0x940ae962, 0xd009416b, 0xef928c8a,
+    0xe6151753, 0x585ae7f0, 0x0169ee07, 0x5356f60a, 0xc6eedfe8, 0xf8dcb7e5,
+    0x3a3cfa87, 0x4f8df37f, 0xeb9ddee5, 0xabf9ab47, 0xbe3ea0c7, 0xfcba2d07,
+    0xa37f883f, 0xf8a7d3cb, 0xf7fda6c6, 0x96de4a8e, 0x136d367f, 0x88767d84,
+    0xec996ecb, 0xf013f36b, 0xdef8b4f2, 0xf8ca4df5, 0xf752f663, 0x1f63e9bc,
+    0x3d5efa85, 0xe9e8f445, 0xffdc9a76, 0xb22a1200, 0xe27477ad, 0xc6c57dd7,
+    0x2eda34dd, 0x6c29bad9, 0x18ba58a9, 0xa6ec956a, 0x3ac8182e, 0x477c648f,
+    0x4a974e2a, 0xa25d19a9, 0x7b101745, 0xdec63fcd, 0xe9a79d74, 0xafbefef7,
+    0x30b095d6, 0xedf49328, 0x2f7f7db4, 0x4000ffd9, 0x485f47fa, 0xbb1fe9eb,
+    0xee7ea4af, 0xa3fb91be, 0xee7ea4af, 0xbafb91be, 0xebee47fa, 0xafbb1fe9,
+    0xfbef7ea4, 0x00c4ffd5, 0x00011029, 0x01020003, 0x00030801, 0x00000003,
+    0x00010000, 0x41312111, 0x30201051, 0xb1917161, 0xa181f0e1, 0xf1c140d1,
+    0x0800daff, 0x01000101, 0x00f6213f, 0x411004f5, 0x04411004, 0x7e034110,
+    0x7a1004f1, 0x04411004, 0x02ea4110, 0x9280dd07, 0x08922048, 0x400f8220,
+    0x0f8401bd, 0xefd70fb9, 0x10c01ede, 0x41100441, 0x023da007, 0xc8fd06f4,
+    0x0441500f, 0x08f44210, 0x2884023d, 0xc51a7b31, 0xd5ae3472, 0x50814d1a,
+    0xf96b702a, 0xd69dd57e, 0x8b7f297c, 0xa78bf737, 0x356847ab, 0xe64a3cc5,
+    0x3db17eae, 0x04359bcf, 0x7ac51d81, 0xd2eb863b, 0x40d45fd6, 0x56945321,
+    0xe868550d, 0x73ea3db2, 0xc0bc0c5d, 0x95bcdeb2, 0x89531726, 0x386147d7,
+    0xbe564272, 0x1c1f5ba1, 0x90957129, 0x84a4241b, 0x5f5e4c05, 0xaf4ca0e7,
+    0x20cf802d, 0x81c56043, 0x77e576e0, 0x24644bb9, 0xe34ad482, 0x0c418e1d,
+    0x10bbfdf4, 0x9b97c5c0, 0x141c438d, 0x7b2c5b50, 0x8a8262c0, 0xdfd86a2a,
+    0xa98a3870, 0xa754f0c0, 0x1385176a, 0xa3395dad, 0x2770e701, 0xdd11165d,
+    0xd7003083, 0x5e51d678, 0xa3fc4c80, 0x26621218, 0xce99062a, 0xffda28d1,
+    0x5821c800, 0x86b95430, 0x2b4c2303, 0x84c21d88, 0x59489ce7, 0x965d6875,
+    0xe82885dc, 0x67213939, 0x9da94d99, 0xf886578d, 0xfb97ba49, 0xf9ebb7ce,
+    0x9583ad86, 0xe77a7f23, 0xe89e1deb, 0x533e831b, 0xa9c7199a, 0x0622501f,
+    0x4f5a0769, 0xe09fd50a, 0xc02821b9, 0x18c7d810, 0x873dfbc7, 0xde275903,
+    0x62374007, 0x51c72ca2, 0x3bd92bf5, 0xa0e2c3e4, 0x6b09646b, 0x021a6ad2,
+    0x77e3b198, 0xfacab4d5, 0x244ec6dd, 0x6cdfc398, 0x60c14f89, 0x053232ef,
+    0x9100ffc6, 0xd994241c, 0x012c6512, 0x7bea5d0c, 0xaa902a15, 0x70f0c0ad,
+    0x7739df35, 0x0ab015c1, 0xf5ecde77, 0xc414420d, 0x7100ff9c, 0xa04c7195,
+    0xe720e7f6, 0x1d3d353c, 0x446911f8, 0x02e9a426, 0x160ad8d5, 0x559a1e99,
+    0x41e6f1d8, 0x498c6c0b, 0x5c6b61d1, 0x200ad292, 0x0156c581, 0xfc976065,
+    0x00ff2a22, 0x5b314113, 0x21d37ec3, 0x95c681e8, 0x98d23a5e, 0x15c8a152,
+    0xe06895a7, 0x4425a32d, 0x9ac94b39, 0xf8e0bffe, 0xe79bde40, 0xd73fdf96,
+    0x2c31e2f3, 0xffcb9beb, 0x6bbc9c00, 0x01106036, 0x2d7c74be, 0x4c105f07,
+    0xc018a598, 0x7f1121d5, 0x407850a8, 0xb27ed2ec, 0x92085846, 0x1b047a54,
+    0x3393c50d, 0x863718e6, 0x0e2c0c5b, 0x10d4a0c3, 0x20a0dd08, 0x0dcfafd8,
+    0xd68ada69, 0x30067b3a, 0xe7435209, 0x52b8b8f3, 0xfb91fc01, 0x751a0a01,
+    0x4301664a, 0x17c46a66, 0xdcdef22b, 0x4ccf622d, 0xbb5c4e58, 0xec18b375,
+    0x3f17b582, 0x2cc60674, 0xb813ca49, 0xd00d0930, 0xea0c47ac, 0x6d5578c7,
+    0x142c00d4, 0x015edc15, 0x6df610d2, 0x1f31e5b1, 0x34b32b59, 0x12652ca0,
+    0x3bab1416, 0x47a50beb, 0xd5c49458, 0xae803b7f, 0xb795677d, 0x5a521d13,
+    0x869ad8a1, 0x1763f2a2, 0xb465c2c8, 0xbca69c3c, 0x150b0234, 0x0bb35608,
+    0x315a456d, 0x050d25d0, 0xd874d48d, 0x121eda69, 0xf3f06bef, 0xac8fcbd7,
+    0x7d7bd9ab, 0xcd5f5e77, 0xb377e2c1, 0xd068ae2a, 0x8fd32051, 0x6aef2337,
+    0x44dc2a16, 0x13dbca61, 0x2e9cd061, 0xd78a105f, 0x5b0ada46, 0xd4bddf64,
+    0x5af7e7e0, 0x5dd67324, 0x814c0161, 0xe9a6745a, 0xd8d2b1c5, 0x9560d8bd,
+    0xb08d0279, 0xa3842661, 0x20368a5f, 0xd49ada36, 0xed437a8b, 0x32b9dec8,
+    0x56eac3d9, 0x5c8c2438, 0x2056543e, 0x2111f274, 0x75deded9, 0xcaddc488,
+    0x05c5f6a3, 0xe000ceca, 0x0099ae40, 0x5cf4a428, 0x4794eccf, 0x48bd3ce0,
+    0xaea646c7, 0x34335860, 0xb877ab11, 0x1e298492, 0xf1a62b14, 0x43e61316,
+    0x92f57fc2, 0xc26464ab, 0x11c8b292, 0x2f8a4e56, 0xad11b0e7, 0x42c7a083,
+    0x75a6c0ab, 0xacbbc3c7, 0xe4657bfa, 0xd38564b2, 0x666d902d, 0x982d88f4,
+    0x863496be, 0xe52d8b9b, 0x219bb362, 0x368cd070, 0x17832993, 0x453cb4a2,
+    0x8bc1f4d5, 0x2fdaf6dc, 0x3a52c85e, 0x644de4b4, 0x211b1885, 0x74c69207,
+    0x05d0f519, 0x03305699, 0x310657c5, 0x3d625158, 0xc8190b48, 0xd26105e6,
+    0x8a0284b0, 0x2f89556d, 0x8967da00, 0x803665f9, 0xb465d287, 0x5c63a2d6,
+    0x2b2dc861, 0x46ed4c54, 0x14c1f668, 0x7f40391c, 0x62b858e4, 0x2d71d394,
+    0x392940b3, 0xc406358b, 0x54be6ce9, 0x52d0882d, 0x88f2f020, 0x3348a9d0,
+    0xeceaa16e, 0x5448f69b, 0x40089755, 0xece6f323, 0x6e77ec56, 0xc5050247,
+    0x7708de91, 0x775db7ad, 0x2d784ab9, 0x69cc1def, 0x0534f9c2, 0x7c9a84fa,
+    0x208a3ea8, 0x2eca8f65, 0x5d207aeb, 0x0c5e8fa4, 0x41b15b71, 0x8c5a807b,
+    0x7004f438, 0x3eefe1b9, 0x945c784b, 0x1b7574b4, 0x342263fb, 0x9c0e6a67,
+    0x9d24e82e, 0x06ea61ca, 0x9d5a7ddc, 0xc5d10db9, 0x0e29dd09, 0x0f549674,
+    0xd40229c8, 0x18eccd8d, 0x9c52d038, 0x1c239157, 0x54810cb0, 0xb52a73d1,
+    0xd6e498a8, 0x639b5a4a, 0x24b48266, 0xfb28230d, 0x72f0a0da, 0x93872010,
+    0x5785d6de, 0x515800b2, 0x031484a8, 0x1f23c370, 0xfa218230, 0xd21adc0e,
+    0x2835321c, 0x00521585, 0x30095bfd, 0x1dcc45b5, 0x6c3938c6, 0x1f382430,
+    0xbf137de2, 0x13185b49, 0x23c3d80e, 0x91f08446, 0x2ab4340d, 0xc3827481,
+    0x64bdaf08, 0x79992e12, 0x8ad76a9a, 0x68c523ed, 0x4e953620, 0xf33b227f,
+    0xc48a102b, 0x9cd840f2, 0x4d962098, 0x786d2528, 0x96bc5812, 0x2a5233b9,
+    0x43c936e9, 0x372246b0, 0x421e4832, 0xa9262b1b, 0xe75ada40, 0xacaa72f2,
+    0x293f138c, 0xc2d466f7, 0x4b0a8035, 0xfe80788d, 0x2f0fb5e5, 0x9539034e,
+    0x920ca04d, 0x41636074, 0x24bade25, 0x420c11b3, 0x1a8aa325, 0x06651342,
+    0x452b0ecb, 0x8e354d2c, 0x71ae429a, 0xc6aa8e64, 0x8d95c153, 0x073b3219,
+    0x4f68cf70, 0xdcc24389, 0xece34c60, 0x161ca22b, 0x21caa2ad, 0x296bd429,
+    0x029ab75e, 0xf160c5f4, 0xf8f8b693, 0xe5866ea6, 0x0da5209e, 0x183a8065,
+    0xbbc10a32, 0x556b5614, 0xf7cb8405, 0x97a02d49, 0x4a24110e, 0x2edd922d,
+    0x6434d722, 0xac63b0c1, 0x7e28e98d, 0x776c60a8, 0x2e8f7c62, 0x22d682d5,
+    0xbb4283a5, 0x54619b01, 0x2c1883b1, 0x2844ac54, 0xa522c112, 0xb8f9fcbc,
+    0xc4d94873, 0x1b7d00ff, 0x70b0880c, 0x16f75677, 0xa5997829, 0x8c094e2a,
+    0x75280245, 0x5086600f, 0xc196e68c, 0x81ed39e2, 0x00ffcd82, 0x3dd8f751,
+    0xf0588e81, 0x87615789, 0x912fbb2b, 0x685405d9, 0xbe51884b, 0x30af75d2,
+    0xfbd21c18, 0x3894f5f6, 0x39a23b35, 0x4b9a8706, 0xd548d796, 0xf834c8be,
+    0x54bbebc6, 0x94cdee41, 0xc2c4b603, 0x34678d76, 0x6046192e, 0xe00e051e,
+    0x5671facf, 0x19fe1c37, 0xa442989a, 0x050fc2b4, 0xa02e03d1, 0xb9d43d28,
+    0xb3213b9b, 0x63b2054a, 0x9f5d87c3, 0x8460ed5e, 0xb051c3ed, 0xb0352bc1,
+    0xe4375750, 0x854919d6, 0x03ec3053, 0xa918192a, 0x2102f94e, 0xaf9ddaad,
+    0xf2afb98a, 0x3a015215, 0x45d840d2, 0x9b8a8a42, 0x9c6ce092, 0x1da3b416,
+    0xa103e8b8, 0x8a245ea3, 0xd55e3d31, 0xbbec6c2b, 0x80d29586, 0xb400aac3,
+    0x199d4237, 0x191906fa, 0xdb646bec, 0xb5494087, 0xd52d64e5, 0xbd60510e,
+    0x9bda8339, 0x29cf74a0, 0xfb8b7cf7, 0x34102f80, 0xe90eead4, 0x99c1800f,
+    0x20a842ca, 0xe38fa12a, 0x7e675b40, 0xc8165e3b, 0x4deff448, 0xdfa16b2c,
+    0xa938844b, 0x1a60627f, 0x728a244a, 0xbaa62a40, 0x8d738f17, 0x8d581020,
+    0x09eaca46, 0x6cdbee60, 0x42b18199, 0xf01512d3, 0xe574ed52, 0x7416c284,
+    0x982b8e29, 0x418be0b3, 0x8fa21e36, 0x558d0575, 0xcb453098, 0xfaa6a97d,
+    0x124cda29, 0x95508100, 0x04a75480, 0x68b808b0, 0xec97b5a8, 0x63ad1edf,
+    0xe8c45c64, 0xb5107653, 0x463a205a, 0xf48ec952, 0x69a45a6c, 0x3f9b5524,
+    0x9cb9a4e9, 0x932a6736, 0xb647c2aa, 0xa1be63af, 0x71cca290, 0x08d2a5f6,
+    0x289b1bf7, 0x992aa0a4, 0x6f312241, 0x2651ab89, 0x1b996082, 0xe97836d2,
+    0x0a0f3712, 0x00e7a078, 0x63690124, 0x025c1aa6, 0x72b1b185, 0xf48717ec,
+    0x0cb3595e, 0x2e9078c9, 0x3e3137ec, 0xcce5e9c7, 0x92a6e4fa, 0x8d360956,
+    0xde9939de, 0x0c223152, 0x4f29bb12, 0xf3e6e71d, 0x348a4820, 0x309607d6,
+    0xb34b48a0, 0x6100ffc8, 0x5f628b66, 0x320907e0, 0x3dc7be30, 0x12b0778d,
+    0xa1a61c14, 0xe354f124, 0xfa406561, 0x0352cf53, 0xd4681d5c, 0xdfa04702,
+    0x751e8e7a, 0x8944690b, 0x17ae8144, 0xaa80f86e, 0x42ceb264, 0xc09bfd04,
+    0xd9f8491a, 0xfa1a8b3a, 0xf15501ab, 0xa14aab0a, 0x5b562738, 0x41845105,
+    0xabfe1833, 0x96997140, 0x7b186950, 0xb159a547, 0xcdb5ab83, 0x5905b64b,
+    0x3f16d401, 0x6e3c61c1, 0x7f14e3ca, 0xca028621, 0x6baa8d4a, 0x8b0b011d,
+    0xd10cd3b8, 0x9aaf8572, 0x3c0398fb, 0x3c71d354, 0x4bbed054, 0x0c5bb1a2,
+    0x866c6550, 0x176f1d2b, 0xc4d8fa6b, 0x698f14f2, 0x96d53800, 0x10eb0522,
+    0x8a2058ef, 0x161a4634, 0x02c1eec7, 0xca0493bb, 0x054ac479, 0x3c1404ea,
+    0xb0c7549e, 0xc99c1513, 0x2e07f552, 0xd5a12e0d, 0x95f60212, 0x6d59c91d,
+    0x4703c0b6, 0x7bf5132b, 0x5198832b, 0xaf837bc7, 0x8a403691, 0x60267275,
+    0xb8283c52, 0xef9aca60, 0x76d2ad04, 0xacfb1008, 0xd006a9e6, 0xb63707a1,
+    0x57a5aae1, 0xd3022024, 0x54f0339a, 0xdb91d4ba, 0x483a925c, 0x0aa8b10d,
+    0x953da8a6, 0x8980a40e, 0x57d8211a, 0x4b85a269, 0xd5c63525, 0x6d151889,
+    0x070c1b4e, 0xc065017b, 0x5432100c, 0x1c4853ee, 0x9de2e7c9, 0x3ac20a1c,
+    0x342b2c24, 0x0556d8b6, 0xeb888939, 0x83adcc66, 0x72afc7a4, 0xe1b4b86f,
+    0x26c13db7, 0xb700fc81, 0x38c42e04, 0xdaf20e80, 0x3ef82450, 0x94117e0f,
+    0x90506121, 0x3ac1d1af, 0x38b41793, 0x580de81b, 0x80338c5c, 0x6804fcbd,
+    0x9b4e56a0, 0x4ddf89a0, 0xe8425b46, 0x900aaea0, 0xe38d32f2, 0x1705dc9c,
+    0xb96843c4, 0xd0ac0822, 0x225a6221, 0x2f35b466, 0x7dbb3080, 0x0d5760bc,
+    0x8a991b47, 0xfa52426f, 0x57454125, 0xe9026543, 0x312be80b, 0xd8584a6b,
+    0x372e00b1, 0x90d7d14c, 0xb614b0ac, 0x65d848fe, 0xcd49d286, 0x96d6be8a,
+    0x362149a2, 0xbf1945b3, 0xd4d447bd, 0x0b8ecc93, 0x108a8bb6, 0x292ef3a2,
+    0xeb5a8830, 0x5bab6142, 0x045633c9, 0x10d0abe6, 0xc605724e, 0x7c3d0be0,
+    0x04d13101, 0x66216600, 0xf5aa8e0e, 0x30bddab2, 0xddd49d55, 0xb0ae2868,
+    0x0a1c00d2, 0x5729a55b, 0x387fa260, 0x2a379ca5, 0x04155c21, 0xa8b087da,
+    0xb3d0fadd, 0x3ad700a1, 0x2af58481, 0xb2f78a63, 0xac145828, 0xc237c25d,
+    0x828bb8ad, 0x61c134c2, 0x18526e48, 0xc413c4b3, 0x520f5144, 0x124f099e,
+    0x074f099e, 0x29810fd2, 0xf4219ff0, 0x087df080, 0x4fe8a307, 0x04f809c0,
+    0x0f3f31fc, 0x47f7937f, 0xff3c7eda, 0xcfe12700, 0x9f1c7ef2, 0xc9e12787,
+    0x010f0053, 0x1485401f, 0x7ee84551, 0x28f45ec0, 0xf4a2d057, 0x0080f82f,
+    0x6df4e607, 0x7eca2dfb, 0x0b709fbf, 0x91dde3f5, 0xa71e0442, 0x4b00ff49,
+    0x773f7d9d, 0x207b95a3, 0x39e1d143, 0xe47a3a7a, 0x0c00daff, 0x02000103,
+    0x00000300, 0x00ff1000, 0xf6eddfb6, 0x00f07fd3, 0xcc53fe03, 0xf7b5ccd7,
+    0x5b0700e8, 0xf5a3bed1, 0x00f4dbb5, 0x5a25331e, 0x9ff6c77d, 0xaf770012,
+    0xd9dc6d9e, 0x02feab67, 0x171e5f64, 0xf49a862f, 0xb821b247, 0x2d01f89b,
+    0xe459097b, 0x0b08d513, 0xb3e474ab, 0xd54a9c18, 0x7754757a, 0xed61a7f4,
+    0xf905e3c1, 0x9cd21f75, 0xf24ed688, 0x022067a4, 0x00968b96, 0x68a88e85,
+    0xb867108c, 0xb135df07, 0x48a9799d, 0xf28eb717, 0x1671ad3d, 0x7096ddfa,
+    0x7546928f, 0x90cb73c3, 0x74b9e352, 0xe810777e, 0xfc3ec9a5, 0xfa9cab83,
+    0x2ed34bd4, 0x09cba7c5, 0x167e6f23, 0xfdf4efd7, 0xe75bd92d, 0xbff9dfd6,
+    0x97bf79db, 0x6bf1d6cf, 0xf4b69ed4, 0xdfbfeffb, 0x3cdcef6e, 0x57482731,
+    0x9e320cf5, 0xc4ffdffa, 0x01112700, 0x03030100, 0x01030602, 0x00000000,
+    0x01000000, 0x31210011, 0x61f05141, 0xa1918171, 0x10e1d1b1, 0xff20f1c1,
+    0x010800da, 0x3f010103, 0x5efe9e10, 0x38c5f63c, 0xc57a6cd7, 0x153ac3a7,
+    0xd747b4e7, 0x4c6c48d5, 0x8587e3bd, 0xceeb2547, 0xf6f18add, 0xb5b79ee9,
+    0x5f7bd313, 0x6d267d33, 0x73adb7b6, 0x8abce6d8, 0xf5014ec7, 0x9ddffe59,
+    0xc4f59d7b, 0x96b6dfe3, 0x346a198f, 0x88dcd459, 0x62fc9dbf, 0x779f6ea3,
+    0xa6edb985, 0xd6727a6a, 0x3cb87ad6, 0x3e1f00ff, 0xea5fcc67, 0x0e8df369,
+    0x6e6df397, 0x660b7f31, 0xe3e9777c, 0x67ce93e2, 0x9173a5cb, 0xde7ff7dc,
+    0xf8e87486, 0xeb79adc7, 0x2b4fbead, 0xe676a55f, 0x5884a7ba, 0xbea78caf,
+    0xf8adbd3c, 0x3a00ffe6, 0xf3b9ee5b, 0xf5c356e5, 0xfb0a6fb7, 0xdf7ebfd7,
+    0xef9daec0, 0x6d7f8be3, 0xebc75a5f, 0x7dfd7afb, 0xbde5e331, 0xdf98f37a,
+    0x1b39e76a, 0xe2ace9d3, 0x9cd95e3f, 0x7cfe72cd, 0x7dd7bced, 0xe7b9c5c8,
+    0xde8f517b, 0x70bd6dfd, 0x2bf2bbb6, 0x8767ec9d, 0x1f3a566b, 0x643ae7e9,
+    0xe916cdf7, 0x2d622bcd, 0xf75c11e5, 0xc47fe7f1, 0xf3dc5e72, 0x76e45ccd,
+    0xb1bcadc7, 0x9bfb7551, 0xd6d91e6d, 0x638b77bd, 0xac4e3ad7, 0xe76af1d6,
+    0xaddef9dd, 0xef3b5be2, 0x6ce758e5, 0x6a07fde5, 0x3f48b72d, 0xe1b9d657,
+    0x6bb51ef3, 0xbb5d7f79, 0x9973c5fb, 0x5a8c48af, 0x9f5e92fe, 0xf57e3b1c,
+    0x1deb4ddb, 0x86077abc, 0xbf6b4d67, 0xc7bb1d3b, 0xcecf3b5a, 0xcf3fcdbf,
+    0xd5df7fdf, 0xea73ae88, 0x8fe9fcaf, 0xafdfc017, 0xe65ce939, 0xd4e798df,
+    0xd7ee1669, 0xa3c69f39, 0x89362fa6, 0x06c67af4, 0xc3ef575b, 0x6bb61c77,
+    0x3eaec393, 0x071300ff, 0xd678f96d, 0x0de75a1f, 0xe71ad7f8, 0xf81c3f3d,
+    0xbef19799, 0xbf5e76d1, 0x0fbcb573, 0x750bafbf, 0x31e3c57f, 0x78dbcded,
+    0x79245e29, 0xd7e8bff6, 0x3c0edf5a, 0xa5e9b7fa, 0x6b0c7ebb, 0xfc9d67da,
+    0x739a9eeb, 0xcff8e87a, 0xe625345d, 0xb63fe74a, 0x477b56b4, 0x7c6b5b2d,
+    0xdd5a7afb, 0x7b8ea5f7, 0x4a2fedf4, 0x33e27cc6, 0x2b3ed77d, 0x73ceb5a6,
+    0x0e9f6bb5, 0xfac5297f, 0x5afbfb72, 0x9feffeb5, 0x86786d9b, 0xcf718db9,
+    0x7c1de48a, 0x98e36dab, 0x4e8fbfb6, 0x4a7f7ef1, 0xfdece774, 0x7986b5f6,
+    0xc533fcc7, 0x2180994c, 0x5321c508, 0xe13a9894, 0xf0a9ae81, 0xd39d5e1c,
+    0xe93c2cb1, 0xadd56182, 0xc0b1be45, 0xd020ca46, 0x463421e4, 0xf7c0a94b,
+    0x2f62b62c, 0x8c10467d, 0x62f6a2cd, 0xdfacc759, 0x232cbd49, 0xe83ab229,
+    0x50099c3a, 0x00ee0624, 0xb072346e, 0x0d8266ec, 0x490a107f, 0x045805bd,
+    0x50ed2a31, 0xe5f7311f, 0x69099982, 0x14736a05, 0x23c03c25, 0x06b54201,
+    0x7489800d, 0x1640208a, 0x0801696d, 0x9e90e7a3, 0xf4429986, 0x8c413106,
+    0x9114348a, 0xcb0a3765, 0x080a9393, 0xd2605140, 0xa31177eb, 0x601daddb,
+    0xc712a042, 0x03491a2a, 0x018ccc43, 0x52443d8b, 0x0394044a, 0x7bd00015,
+    0x4c22b999, 0x524fe8ee, 0x6182e09a, 0x4051124a, 0x797359a1, 0xa5b81856,
+    0x3071189d, 0x19e09ac0, 0x00817641, 0x903b10a4, 0x06e97a24, 0x8a1a0824,
+    0x80709bc0, 0xd77632c3, 0x20252135, 0x7db9a88a, 0xa2800458, 0x4c3d1243,
+    0xc6ba4a50, 0x321db4f7, 0x8940f13d, 0x28d3f389, 0x9b2dae9d, 0x474450c4,
+    0xaea38d71, 0x73aadf86, 0x2fca4124, 0x671a5bc9, 0xd50f5396, 0x91cb00ba,
+    0x09731590, 0x5d840eeb, 0x57712180, 0x8c1b41ab, 0x1c1a4ff8, 0x49c5d238,
+    0x80214d97, 0x2c424336, 0x8ddab8cb, 0x3d29d601, 0x29b95410, 0x8584c951,
+    0x46a3af09, 0x53062172, 0x88a4d871, 0xa9969490, 0xdb5c37c9, 0x9046288e,
+    0x0544abd1, 0xae3051b3, 0x8b8b5281, 0xc322a65e, 0x1788552d, 0x63add764,
+    0x136432a6, 0x3187f260, 0x582815a8, 0x424b24e4, 0x1c75d392, 0x6c890721,
+    0x01f7b55a, 0x65193bce, 0x7a3bfda0, 0xb1adf482, 0xe6160a90, 0x89558a31,
+    0x72a10e4d, 0xf042040d, 0xe2873692, 0x25ac0c62, 0x1b7c3bea, 0x58ac370f,
+    0x4547b892, 0x1692f9ac, 0x556a0924, 0x5a528f8c, 0xaa201559, 0xe78f0392,
+    0x8d467002, 0x609645ba, 0x110b8231, 0xb7db7d8f, 0x1eba88a5, 0xdb303b59,
+    0xe1712aed, 0xbb47046c, 0x8da9752e, 0x422c5c82, 0x5c63e91b, 0x722ab5c6,
+    0xae086841, 0x8a408a5e, 0x034f9c14, 0x88d4c890, 0x50414624, 0x8cac4f0f,
+    0x786c08e1, 0x464aaa00, 0xc08d6e45, 0x7426d1d5, 0x09824cc0, 0x4e4b31d1,
+    0x090d6213, 0x3a5c1d91, 0xdf8416a3, 0x31075550, 0x0492286c, 0x06c56820,
+    0xd56425c4, 0x20a0b29f, 0x41c95909, 0xa9bbb838, 0x4a4c0016, 0xda2f0003,
+    0xeb038a6f, 0x0c6b522a, 0xb326754b, 0x26e21848, 0x06007a13, 0x2ae416ec,
+    0xc3cd40c9, 0x62069176, 0x7d226cd5, 0x255133bd, 0x92ebc49c, 0x07b06a2c,
+    0xec32f6f4, 0x67828499, 0xa272777f, 0x06500b65, 0x493454af, 0x80c9a00e,
+    0x8137f0e0, 0xa861662e, 0xc0a22b1b, 0x1b12c0c0, 0x562b9674, 0x16528406,
+    0xb00695e2, 0x102db7bc, 0x4b359760, 0x0de19212, 0x80784a0e, 0x892920b5,
+    0x9aa9cf8c, 0x86e5e5c6, 0x3b17dd22, 0xddd5ae31, 0xe5f7436f, 0x2120f96b,
+    0x982d9945, 0x87b1ba4e, 0x8ed19b38, 0x8266a91d, 0x22811060, 0x45e83447,
+    0x50805e2d, 0xee39c692, 0x1076250b, 0xdab66234, 0xb3642546, 0xdcb46076,
+    0xb4a4d9fa, 0x3b0f772b, 0x454591b7, 0x3955d7c6, 0x7ca526dc, 0xb81cfc62,
+    0x4e82a1f9, 0x2cb0c268, 0x13445471, 0xadd6e031, 0x9117c4a9, 0xc1119418,
+    0x9c530a31, 0x9021ac92, 0xe1ea25c2, 0xd0209e2c, 0x4074f9c8, 0xab0b0814,
+    0x356e4517, 0x820671f4, 0x07ad72c6, 0xd2503f7b, 0x5c0642a3, 0x202e1a80,
+    0x3a485110, 0x00ff1191, 0x4ada6113, 0x19b88fee, 0x1e292a37, 0x604dcb50,
+    0x000cb73b, 0xb8aa0b15, 0xb9865c92, 0xaab8b521, 0xdbf3cb2a, 0xf051ad86,
+    0x7595605d, 0x1c44b5fa, 0xa7d52227, 0x11769d0e, 0x92015d10, 0xc244ac24,
+    0x30100060, 0x0508dfbc, 0x2394b590, 0x316f2653, 0xfaa8d89e, 0x4079e1e4,
+    0x50080823, 0xbcf709a8, 0x225e292b, 0x709cf0e8, 0xdeac4c43, 0x680c20d4,
+    0x1b82c8d9, 0x358b7921, 0xbd9254d8, 0x2cc59617, 0x882a2ac4, 0xdba4513d,
+    0x94e0c9a2, 0x48562f2d, 0x4a4e4880, 0xaf3bf75b, 0xaa7fa8fa, 0x40fc980a,
+    0x88464428, 0x5b11b392, 0xd33000ff, 0xc00848b0, 0x830a0c45, 0xab5025c6,
+    0xe856b77b, 0x40ef0d22, 0x5c09870b, 0x50a5a4d0, 0x6bd3fdab, 0x05e2732c,
+    0xe7882548, 0x04c0d464, 0x920c2d61, 0x58ee77dc, 0x882d88c0, 0x9f316baa,
+    0x1ecfbb70, 0x5a2c142d, 0x0b967092, 0x00902285, 0x88cd2586, 0x47283f93,
+    0x1228435a, 0x406a0813, 0x97a1a344, 0xee92fb10, 0x2245f201, 0x09fe45a1,
+    0x5c2667d8, 0xcb8f0af0, 0x498098a1, 0x842ab48e, 0xbc8896ba, 0x2a69cbe6,
+    0x60535f07, 0xa96f002e, 0x89d00431, 0x69b45e9c, 0xa36ad34a, 0x3b5acf9f,
+    0x29215b64, 0x642dc2f0, 0x5319d44b, 0xe8824700, 0x62508b85, 0xa4ca7bfc,
+    0xc0c00256, 0x4cc300d0, 0x0bded12e, 0x425491c3, 0x4a20329e, 0x00961400,
+    0x6389f3b8, 0xe2d30187, 0x84c69498, 0x3a4152c4, 0x28f56c53, 0x855a7197,
+    0x12cf5cc0, 0x642a98e9, 0x0252aab4, 0x9a56b404, 0xd2aed622, 0x128b5419,
+    0x1968628b, 0x154d2288, 0xe4027716, 0x19bdf6e6, 0xd54908ab, 0x12ece50e,
+    0x28956033, 0x85b4bc8d, 0x04c1f060, 0x8de8a49a, 0xc485c5ad, 0x97405889,
+    0x089890f3, 0x34246252, 0xc3ea2114, 0xb428c519, 0xcc8ae906, 0xd6351783,
+    0x896c8034, 0x5f06ab36, 0x22caf5de, 0xf62d3510, 0xb43e1708, 0x13763836,
+    0x0211a250, 0x45b26055, 0x51fcaa21, 0x51c1a24f, 0x5ba520c2, 0xf8668533,
+    0xe5adcd34, 0x01b0986a, 0xd3be999b, 0x5a7a5607, 0x466f6b0a, 0x729888b7,
+    0x9d2e2e14, 0x4f0608ae, 0x3ceba079, 0x7202b5e7, 0x082c67b5, 0x26262d0e,
+    0x0944338a, 0xf2e8b981, 0x216a0a45, 0x4310b267, 0x749863aa, 0x35844362,
+    0xe9711a87, 0xed008891, 0x404c0285, 0xc7f4d6a4, 0x913a57db, 0xd670622f,
+    0x0ad61b23, 0x48847805, 0x0beca01b, 0x0d11054d, 0x89b83426, 0x85556cc8,
+    0x350a17ba, 0x0815252c, 0x400110c2, 0x10b16696, 0x60992ede, 0xfdc69d40,
+    0x4a58686b, 0x249009c8, 0x2be6ac21, 0x0f8ea1fe, 0x24691592, 0x3820b786,
+    0x3331ad33, 0x3b65d360, 0xa26bd550, 0x025835b0, 0x33b7fa34, 0x25639108,
+    0x7582a410, 0xe4d246f7, 0xe5a29688, 0x5600a251, 0x99616038, 0x67885730,
+    0x552f7847, 0x80bd207b, 0xc3da2293, 0xd21ceaa5, 0xb47db626, 0x2ca11086,
+    0xaa46c4f8, 0xc120e35e, 0x25192e62, 0x8e04c2bc, 0xbce8e8d2, 0x250905c5,
+    0x9cb44f6a, 0xc4dcdcd5, 0x05506ba2, 0x440e54c6, 0x5d898223, 0xa9f39c23,
+    0x3f0e2bc4, 0x2a4c109a, 0xb8aa7bb3, 0x8ca4ca94, 0x68e285d9, 0x86842c28,
+    0xf3049b9b, 0x8bbb7bd3, 0x52890893, 0x6246a4bd, 0xbaa2d380, 0x40b80d2b,
+    0x00c2e319, 0x9c66af5a, 0xe2d816ba, 0x06ac88b0, 0xeac24007, 0x9494851f,
+    0x2cd40943, 0x2c23438c, 0x09e08522, 0x53f1ef11, 0xf0d47498, 0x099039be,
+    0x57d852e4, 0x279e3015, 0xc67275b3, 0x00ff9be2, 0x012a15aa, 0x98718416,
+    0x958c993a, 0xc48c6341, 0x80e34e6f, 0x75e9a6ec, 0x843c5b81, 0x2742463a,
+    0xd0946423, 0x758570d4, 0x508800d3, 0x5a5afc16, 0x9250c874, 0x28528a32,
+    0x82da81aa, 0x80988016, 0x3e160a27, 0x9a80ed4e, 0xe6c574d9, 0xa84044ed,
+    0x88f93023, 0x09a402c5, 0x70b300ff, 0x144c85af, 0x93643850, 0x4b2cf218,
+    0xa38e7515, 0xd0306808, 0x64074d9c, 0x8e8be381, 0x8c4b00e1, 0xe7a39200,
+    0x15dfdcce, 0x13725119, 0xc770e452, 0x9a108164, 0x7840032a, 0x454c188c,
+    0x8c01778b, 0xf7019244, 0x74b831ac, 0x09a952f1, 0x95552c66, 0xa85401b0,
+    0xb5c80012, 0x28d77265, 0xc19687d2, 0x95201847, 0x8419d86f, 0x0334a885,
+    0x2c201456, 0x91c6f708, 0x0f812ad8, 0xda18fa7a, 0xc482e123, 0xa415d2eb,
+    0x90091840, 0x0eeb38a0, 0x1a24e6b9, 0x78b5ea8e, 0x0abcd4ef, 0x40b4b6e3,
+    0x24f7d95e, 0x50052da7, 0xfab21926, 0x1699c25c, 0xf7812c6d, 0x531c0ebe,
+    0x91365a11, 0xa38f791e, 0xf227351c, 0x517ff600, 0x6e206340, 0x2d12528c,
+    0x8d65159e, 0x28668083, 0x04872031, 0x415103e7, 0xd3e02318, 0xeaac5003,
+    0xa8d43e89, 0xcc1b76f2, 0x87da01d8, 0x0104b41a, 0x45967e01, 0x0aaccee0,
+    0x9aeef019, 0x24508282, 0x9a212871, 0x8808a510, 0x9130f872, 0x96307e6a,
+    0xd90c8933, 0x77a40070, 0xf3f9ecc6, 0xdda8e85d, 0xc092f884, 0x08150a60,
+    0xc0d44b25, 0x6d03ac47, 0xd5321635, 0x996cb180, 0x26608481, 0x511df526,
+    0x1960ea4a, 0x2c609a10, 0x9f2e673e, 0x28240234, 0x88899610, 0xdcae1a89,
+    0xa0118398, 0xb4167464, 0xb94d3442, 0x3edc3b4f, 0x795d894d, 0x849b260f,
+    0xc633764e, 0x4baac7c0, 0xd2abcc01, 0xdc282bb2, 0xde73291e, 0x5f0bbb70,
+    0x8857a403, 0x0393158b, 0x3f755010, 0x143d8046, 0x684579d5, 0x07d98660,
+    0x606251e0, 0xeffa2861, 0x52c9d388, 0x880e1696, 0x402cb2cc, 0x2b0ba6b0,
+    0xa85ec501, 0x96cc4971, 0x80f6cd22, 0x54a80032, 0xc06f75a8, 0x60b33042,
+    0x12820925, 0x22076693, 0x98444840, 0x6f8e9c2a, 0x26aa28be, 0xb1264143,
+    0x4276ccd4, 0xd69de70f, 0x9d589905, 0xb2488446, 0xc057a204, 0x4e07e050,
+    0xa84b9200, 0x21224864, 0x41001b33, 0x6351d262, 0x07bbdbf7, 0x9b5acd3a,
+    0x45c784b1, 0x580a88a0, 0x41e0c441, 0xc064c878, 0xa40b2145, 0x066d8bc5,
+    0xa0024049, 0x85d0634c, 0x66b8973d, 0x809550d4, 0x48980813, 0xb92e8181,
+    0x1c59d948, 0x344344d8, 0x8e89984e, 0xfed61ac7, 0x0c14f2c8, 0x76a74bfc,
+    0x8a1209e2, 0x0c49c32e, 0x08d8a2a0, 0x63fb3c05, 0xa85cd356, 0x4f1d5ac4,
+    0xc0369e41, 0x14d00881, 0xdc92f691, 0x11262ae5, 0x4dc09600, 0xeb97a757,
+    0x60548b62, 0x95e8c381, 0x81d444c5, 0xde0abff2, 0x2c6eb769, 0x4d62ace7,
+    0x2662ac48, 0x8ae22244, 0xba9d4047, 0x51b49960, 0xdba72e56, 0x8fd43633,
+    0xe152aa62, 0x1508c544, 0x96875c6b, 0x0524dce3, 0xa3737091, 0x3cf5ae03,
+    0x518a4e1c, 0x2594282a, 0xe84ba326, 0x75614c88, 0x62e478c7, 0x72120080,
+    0x2a507451, 0x24249e68, 0x50c151cf, 0xc880b5db, 0x5f577c31, 0xcf7988e1,
+    0x38398721, 0xa5a86128, 0x5849fa50, 0x0e437204, 0x0e455100, 0x0465b206,
+    0x113910c6, 0xcc025800, 0xcd321f9d, 0xd52a3285, 0x08c91be9, 0x09234828,
+    0x28425017, 0xc0970982, 0xc8106900, 0xcf0f4381, 0xa816002c, 0x351fcd3c,
+    0x4ece6128, 0x08584e20, 0xc2b87828, 0x4cdc2d49, 0xa410bc81, 0x0c24d53c,
+    0x3188604b, 0x3b425309, 0x1bb5c098, 0x1470094d, 0xa31871a7, 0x188222b2,
+    0x6c8006cb, 0x67a0d226, 0x800abbcc, 0x502b70d0, 0xa532bc2d, 0x3f201a12,
+    0xb2289603, 0x0511a414, 0xd4e7c92f, 0x08cac98a, 0x401a2221, 0xc22c1346,
+    0x120c2832, 0x664658c1, 0xd826481a, 0x84b2b22a, 0xc94d8f4f, 0x182dde89,
+    0x6b2fc114, 0x3be20418, 0x3a31224b, 0x44a42185, 0xb8449012, 0x410c0921,
+    0x034a121d, 0x3093a016, 0x490aa812, 0x2426b84c, 0xe4522780, 0xb59290a4,
+    0xe527d908, 0x85a66a12, 0x39017d19, 0xa0424824, 0x8f252640, 0x57fdd533,
+    0x1edfbcce, 0xcee38a96, 0x1623da76, 0x4ca3a539, 0x5d6b5b66, 0xfbd4e9ba,
+    0xda2b9df3, 0xb6cf8cfb, 0xacd5227d, 0xcf4f79f8, 0xeff19ce3, 0x8369f8eb,
+    0xaec8ef3c, 0xa2fcf191, 0x671a1b3a, 0x2a73f24e, 0xfd914f1e, 0xd6b371ad,
+    0x53913e6f, 0x3d8d79a9, 0x5c33be7c, 0xf7379dd3, 0xfd4d5bae, 0x49f9947f,
+    0x6dd6f61d, 0x78bc3a7f, 0x3eecbe63, 0xfa4dcfdb, 0x7c97e2f3, 0xf2d2254f,
+    0xf7b62b3c, 0x15ed21e7, 0xd75c3ed3, 0x19c93b6a, 0x6f0c0f9f, 0x3f8faf99,
+    0x6adbb68e, 0xef98ebe5, 0xc48b5df1, 0xfef69ef4, 0x68cf7a56, 0xaf393efe,
+    0xc7ebd13e, 0xd3136bb6, 0x57acbe9a, 0xbfc7fede, 0x7b7ed7ca, 0x63715a9a,
+    0xc7e7ac39, 0x9f6b9d9c, 0x38cdfa59, 0x7e31777a, 0xb6fab966, 0x357bcf34,
+    0x4f63fefc, 0x96ef2b2d, 0xbbd3f8fe, 0xa4b6f5b5, 0xb6993a46, 0x31d6df95,
+    0xce5331f5, 0xd6dace75, 0x6bf97ba7, 0x9e8471cd, 0x9b6fcd76, 0x36e37cef,
+    0x0eaf99e1, 0x9fd6577d, 0x731ea935, 0x83af9c9f, 0xd56d8d6b, 0xc6d17e7f,
+    0x71e8f5b1, 0xfb977daf, 0x36e97ab5, 0xdc799cd8, 0xdda63634, 0x5f7b72bd,
+    0x7c9b6ef1, 0xe1fbfc15, 0x59ae97ae, 0xf9463bc7, 0x3ffe79ae, 0xaa1fdb9c,
+    0x7bd43be7, 0x6ea7a75b, 0xcfabc596, 0xe781a6f7, 0xe1f58df1, 0x697bde8e,
+    0x4f73d759, 0x54fbfebe, 0xfb6afc9b, 0xf34b6b5e, 0x585ef7df, 0x7d00ff3a,
+    0xbdb73326, 0x6feee4bd, 0xf3b9e27d, 0xb05f635b, 0xe24b4fb7, 0x5b633dbc,
+    0xfcf8e6fc, 0xdcfdcee3, 0x4fafe37b, 0xc3d37dc7, 0xbf33324f, 0x78448c62,
+    0x48a7b97e, 0xd9728eaf, 0x33625ef2, 0xf53523af, 0xe9ed5ceb, 0x315ebbef,
+    0xee5fc798, 0xe5b5bef6, 0xd66cf38b, 0x9b67e4f8, 0x2397af57, 0xd2cfeb5d,
+    0xb9f4f4f6, 0xedb3d15e, 0x50e9991e, 0x3b888918, 0xadfb396d, 0xb1973ffc,
+    0xe76ba6f7, 0xfdf749cb, 0xfa1b1e4e, 0x693a5eeb, 0xb5f1998f, 0xf0f9c35f,
+    0xa3eb2cce, 0xe72da787, 0xf8eb1a9c, 0x3d5f98ed, 0x13b4375b, 0x6814eda4,
+    0x9f269e06, 0xa669e937, 0xe38c96c6, 0x8ffbef3b, 0x76379fc7, 0xbd5e91d7,
+    0x00ffaea3, 0x36fc753b, 0xf19f831e, 0x237d74a8, 0x961cf3e7, 0xa22ff88b,
+    0x3cc56394, 0xdcd1a694, 0xd3a662f5, 0x3ebb0d88, 0x39478586, 0xbfdc088f,
+    0xc73ab8e0, 0xe854e3bf, 0x6ac5af3e, 0x1f7f3ff6, 0x9697e788, 0x2d36fc34,
+    0xe3877ab8, 0xb2d7d511, 0x3eb8a8fe, 0x5fe37c3e, 0x2700c4ff, 0x01000111,
+    0x04030303, 0x00010103, 0x00000000, 0x00110100, 0x51413121, 0x917161f0,
+    0xc1b1a181, 0x10f1e1d1, 0x00daff20, 0x01020108, 0x7a103f01, 0xf9736b5b,
+    0xc8c9cc3d, 0xde66acf3, 0x8d9ebf4a, 0xad2dfebb, 0xf768b475, 0xa3c79f8f,
+    0xde7e7bda, 0xeb761d35, 0xbe5a6ee3, 0x78bb6d7c, 0xe78c499f, 0x2db7ee72,
+    0x961f13a4, 0x6f973fa3, 0xbe6bceef, 0x357eb84d, 0x00ff85b6, 0x5ef09833,
+    0x2b19c9f8, 0x63ddb659, 0x31d07b9a, 0x99fbdc7f, 0xbe6f85c6, 0x98b72ff1,
+    0xf1dd75a2, 0xd8a633a5, 0x7b9ff7cc, 0xbc1ab9e3, 0x65e9088d, 0x66bdf4cc,
+    0xd7edef2f, 0xd87ee459, 0x43fdf99c, 0x4e7f571a, 0xffb679dd, 0xebe9f700,
+    0x5dcf7c8d, 0x3e577c6d, 0x35ed6039, 0xcead9de7, 0x70e100ff, 0x7a3bb7fa,
+    0x8dbfed35, 0x8e366afb, 0xd3939195, 0xeb99beeb, 0xfb4be75c, 0x3de79c7f,
+    0xb3fb4beb, 0x7f275d8d, 0xc75f8f9a, 0x8d79cc7c, 0xcf8a9f2b, 0xe79cf35f,
+    0xe67f73d5, 0x7baed813, 0x5fa5f373, 0xcdcfa7e7, 0x699cd2b4, 0x7c36a7ad,
+    0x3957fcf6, 0xf8faaf1f, 0x5ce93be7, 0x92b6cfed, 0x98f5db67, 0xd25cb9bf,
+    0xd2a7f4fc, 0x53fbfb7a, 0x7badc7cf, 0xba9fcfdb, 0xfedd4ec7, 0x7dafb5f5,
+    0xf8f6ea6b, 0xbefa6dd6, 0xcddbcb39, 0xefaf667d, 0xf3da91b6, 0xb7c205f7,
+    0x0b9973c7, 0xe74ad377, 0x15bf6f8f, 0x7e8d9ff7, 0x5943c4e6, 0xa6df6be4,
+    0xb966e970, 0xaef4f8f9, 0x5f7a9873, 0xd38877bc, 0xfa9a7ed7, 0x7abe5ffe,
+    0xfedca5d7, 0xfd8783f3, 0x67728b74, 0xb5a6cba7, 0xfdaed365, 0xb5e66b3b,
+    0xd7ad2366, 0x7801e72d, 0x6b5c6d3a, 0x793b9375, 0xb4d2f3b4, 0xd9beef2f,
+    0xf3ca85ea, 0x3fe7337d, 0x8e22e78a, 0x7ce2d7e3, 0x9b29cef4, 0xf9d423e2,
+    0x5ee9749d, 0x677ce9d7, 0xc6cd8a93, 0x538f78da, 0x38ed2f5d, 0x77cc2f7e,
+    0x3dd76a9b, 0xbcf9dbb5, 0xfa3dbe56, 0x5a8f36fa, 0xf5b9bdb5, 0xf0bade5f,
+    0xe77caef5, 0x5fb59ca6, 0x18736ed3, 0xe4b9e7bc, 0x719e73ae, 0x7d7f3c5c,
+    0xded9e23f, 0xe8daf23a, 0x799d9a74, 0xd6f88acf, 0xb6f5f2db, 0x4fa7ef22,
+    0xc7f6dab7, 0xdb5bdd96, 0xf76adfdf, 0xe79ffbd1, 0x177fac89, 0x16f5f2f6,
+    0xa66fdf74, 0xbf35b9d1, 0x75b5793d, 0xcc623beb, 0xedf51adb, 0xe75ea447,
+    0x8fe9ef3b, 0xf99b8ef3, 0x7e739ebe, 0x666a9a5b, 0x13dff5bb, 0x3bd71be3,
+    0x4e7badf3, 0x00ffae33, 0x79779bd1, 0x5c91d33c, 0x5ffd393c, 0xfed051c3,
+    0xfea17344, 0x11e9786c, 0xfed4cbeb, 0xf97cd233, 0xcf79eab5, 0x1ee2fae7,
+    0xa2c8303a, 0x80ec2a02, 0x88e3ad84, 0x3ec4c9cd, 0x94e66796, 0x4af24616,
+    0xaf7db237, 0xec564aeb, 0x686e1ad1, 0x5daf0d42, 0x6f33c223, 0xa3bd66c6,
+    0x579b1d3a, 0x2e1180cf, 0x404a2a25, 0x4813efa5, 0x0180308b, 0x22c2622c,
+    0x53731032, 0x81100d48, 0x225a829b, 0x46d0f432, 0x3fc33606, 0x476cbe40,
+    0x8528e403, 0x76a802b2, 0x9db18c40, 0x99932850, 0x6d8b8166, 0xa05393a1,
+    0x5235c014, 0x47242088, 0xe0a5dc90, 0x462ec1a6, 0x168241a2, 0xcb8085eb,
+    0x01ee020b, 0xcba50729, 0x96c02645, 0x73dd6a6f, 0xa899d8be, 0x09d88464,
+    0x1c868850, 0xbd302026, 0x4a2552e3, 0xc365881b, 0x220d0266, 0x08810a49,
+    0x70105433, 0x6a682e5d, 0x8ccc6ca2, 0x04e09224, 0xaf381214, 0xb070b825,
+    0x70084c72, 0x000d4dad, 0x96244cca, 0x703359e0, 0x2dc45074, 0x80214501,
+    0x78691882, 0x3471d368, 0x2d31f706, 0x039c5468, 0x000a8192, 0xb121dc95,
+    0x883b790b, 0x274c3220, 0xb1f43447, 0xa51463e5, 0x9beb34d6, 0xabfdebec,
+    0x5b937393, 0xebf60979, 0xf8892bad, 0x2410c15a, 0x29229990, 0x16198c50,
+    0xc5244b42, 0x90c5bdc4, 0x03a09c04, 0xe2b31715, 0xa4ca2819, 0x0872619a,
+    0x221a2a10, 0x26b00054, 0xed6092e5, 0x864761c5, 0x004336c4, 0xa2001be6,
+    0x48535405, 0x61645181, 0x6450022c, 0xc0012b44, 0xe162c686, 0x21160034,
+    0xb2605720, 0xaf14c8a9, 0xb78bbd54, 0xa2216068, 0x360a1951, 0x020d4366,
+    0x696a703d, 0x5a80a860, 0x6f149100, 0x480c6505, 0xc032cc28, 0x180e1488,
+    0x9cd81684, 0x53144a56, 0xd9e08910, 0x218e3893, 0xd22a5021, 0x68282725,
+    0x41844837, 0x42690014, 0xee08ce9c, 0x0ca78058, 0x90224aa6, 0xcb04250c,
+    0x61e32d00, 0x15790a86, 0xa9437e85, 0xc28c126c, 0x0872a819, 0x59e1a0a4,
+    0x7021a81b, 0x98c6160d, 0x48491633, 0xc8bd2084, 0xb19b431a, 0x6a935248,
+    0x5a469a9b, 0xb29cf136, 0x32c02244, 0x2208550d, 0x232dbb57, 0x4b18b7ad,
+    0x6b1adbbb, 0xc999a5a2, 0xfa4ebc60, 0xb52f9846, 0xa066db48, 0x066f8dd9,
+    0xb38aef7a, 0xa800709e, 0x8a0221b0, 0x97e89680, 0x3018dd08, 0x5bb0655e,
+    0x45082eb2, 0x6d282b5c, 0x28bb9990, 0x23095021, 0x2ce62a1b, 0x8408e02f,
+    0x8c842472, 0x7801324a, 0x93010213, 0x04516008, 0x957e031d, 0x74117209,
+    0x093dc890, 0x155c1a05, 0x69090146, 0x1905c52a, 0x28c21832, 0x8d6a5542,
+    0x76120444, 0x9b1a0cc8, 0xfa0be551, 0xa5481d92, 0x8062d888, 0x12046580,
+    0x188e9532, 0x0cf2d195, 0x22070a20, 0x9830e271, 0x080184b7, 0x54141400,
+    0x00b5d699, 0x501800a0, 0x0294ac90, 0x909b2a14, 0x10410e82, 0x3641f989,
+    0x40219452, 0xe34da39e, 0x0a993d24, 0x00ffc2cd, 0x091a9663, 0x9cd01071,
+    0x64443c50, 0x96928656, 0x0c1bd097, 0x6b660891, 0x1b6a89ac, 0x2c85db61,
+    0x5d648891, 0xc04e6d1a, 0x0560ad22, 0x40356219, 0x205b381f, 0x56ce7a5f,
+    0x2020a240, 0x9e4e4898, 0xec2c8894, 0x64bb6467, 0x13a93923, 0xd7d2cbea,
+    0xd6b648d7, 0x0362d1cd, 0x96195716, 0xb35fa33d, 0x4c09c85a, 0x8d5808a2,
+    0xc592e64a, 0xbc0049f6, 0x268bcd05, 0x78950240, 0x894b5900, 0x4aee0530,
+    0x20c524e7, 0x22a0ca4a, 0x1d2cd92e, 0x86d39c95, 0x92c08511, 0xb20411d9,
+    0x958abad0, 0x05238ab5, 0x9e692b54, 0x011222e0, 0x0016d877, 0xa4b98d2e,
+    0xcc0475f3, 0x108c6504, 0x22eb7a29, 0x126242a4, 0x5a528a4e, 0x492f8fae,
+    0x2900ca30, 0xd40812a2, 0x8c8073e1, 0x917d9762, 0xa3844509, 0xce2c4056,
+    0x9053058a, 0x06a12f42, 0x8131441e, 0xb7115cb2, 0x9552a5f1, 0x88a140c0,
+    0x1821828a, 0x1030432e, 0x52bf9f02, 0xb25f0bed, 0x912cb120, 0x9374cd0c,
+    0xb84220d0, 0x11800a68, 0x143d2f29, 0x03dc910d, 0x5c9d812f, 0x11ad245d,
+    0x40a72de3, 0x4a00913a, 0x1d621210, 0xc20f900c, 0x4ae58993, 0x1813e22b,
+    0x960cee12, 0x91445048, 0x69c926a5, 0x59554484, 0x8e26f79c, 0x10418b40,
+    0x20b44092, 0xa914202c, 0x86c94c15, 0xbc0259d6, 0xf16d3c02, 0x5b125a40,
+    0x09a04490, 0x12938901, 0x21a40b28, 0x0b256844, 0x3c8a03b4, 0x151304c1,
+    0x2222870c, 0x0a00ff8a, 0xd08220d2, 0x95555b59, 0x7035d0b7, 0x8270212d,
+    0x442e2111, 0x2c455019, 0x13486035, 0x64290d13, 0x99155d0b, 0xbc18e060,
+    0x11020054, 0x8a511b29, 0x5ff30911, 0x4c8b6111, 0xa3a28ca4, 0x0312258b,
+    0x0b2091e5, 0xa7bf548a, 0x1106bad9, 0x09211b5c, 0x50207c49, 0x2e1c21b8,
+    0x3b460dc1, 0x6062bc20, 0x08924010, 0x403ee2f4, 0x01050604, 0x88445a52,
+    0x9d44e3e5, 0x480be6f2, 0xd6989422, 0xb2600969, 0x2d0e7635, 0xc78ce9b9,
+    0x12c043ac, 0x094a9e30, 0xc4427940, 0xa4615269, 0x2c95b8b0, 0xaa4cb6e4,
+    0xb45505a8, 0x6598a9f2, 0x0b2c8165, 0xb3574954, 0xa4a8c432, 0x112c5784,
+    0x354dafb8, 0x3661045d, 0x85a409dd, 0xb099a82a, 0x4d798394, 0xd8c5d70b,
+    0x17c1e442, 0x8c946849, 0x97e160e9, 0x29431b10, 0x2543457b, 0x90d69912,
+    0x05910a4a, 0x35c1695e, 0x3988888d, 0x01a0b670, 0xaad82c15, 0x8c2af047,
+    0x299808b2, 0x925ca635, 0x0049e66e, 0xae250190, 0x40a13df7, 0x5d5c3f95,
+    0x426c0016, 0x04a59618, 0xb07d850a, 0x4f480240, 0x34448651, 0x30e06125,
+    0x0048b70b, 0x5e8b814d, 0x53beed28, 0x2909b7e8, 0x99c9c5b0, 0x82221689,
+    0x89a80301, 0x85990b88, 0xc7302696, 0x88104b30, 0x65f606ee, 0xa902a913,
+    0x259e9b81, 0x733d1943, 0xe0280683, 0x318b0096, 0x57312e0d, 0x38664738,
+    0x9c421082, 0x12112537, 0x91250550, 0xcb5c2446, 0x6808e8a3, 0x4082544a,
+    0x289c224c, 0xd36799b0, 0x20b141a2, 0x129b2d82, 0x841b1378, 0x33a82d43,
+    0x1f0c8d00, 0x432eb04c, 0x610dd142, 0x0c165b58, 0x5eb232bd, 0x457a955e,
+    0x0d042530, 0x696c1990, 0x0a51107c, 0x00c885c4, 0x0a43d4bc, 0xb6cc4f85,
+    0x82669a20, 0xcd02b008, 0x9d7cc66c, 0x7bfd623a, 0xeba6b1d1, 0x8924f58c,
+    0x742aedd2, 0x4c381236, 0x54814883, 0x1c938a08, 0x9c9a090f, 0x5c291b8c,
+    0x6a78c964, 0x000851c7, 0xa5f15767, 0x1070614c, 0x0d0494b1, 0x9bd1c529,
+    0x02150230, 0x2a43104a, 0xe28c4ed0, 0x1288626a, 0x582f5401, 0x0262cc90,
+    0xe2c4102d, 0x2731a82c, 0x6222ab78, 0xb0ef57a6, 0x40120b90, 0x44e86032,
+    0x50cd1462, 0x750c6003, 0xbf941bdb, 0xd1607441, 0xf3097237, 0x98d31c49,
+    0x11c15a90, 0x0188564e, 0x86ef8aa3, 0x43081272, 0x29b99f83, 0x123160a5,
+    0x8902010b, 0x903ab51b, 0x512cb219, 0x9929c627, 0x7240328d, 0x0a2d654d,
+    0x01668089, 0x687449df, 0x4012d57d, 0x2cdf6250, 0x34544082, 0x0789f22f,
+    0x4a216d11, 0xf96921f5, 0x06ca6602, 0x48cb2044, 0xa4901191, 0xa2da2208,
+    0xba589220, 0xdf345c3c, 0x375e1470, 0x35df9159, 0x516a8a28, 0x622c01b1,
+    0x2dda0466, 0x2c0a4b52, 0x82002c25, 0x9f8804b9, 0x652b9cf0, 0xcca42335,
+    0x12ad1228, 0x2a386092, 0x8a006652, 0xfb8062c1, 0x93381772, 0x91700c30,
+    0x68d24a37, 0x8048d03b, 0x04b32cab, 0x231403e4, 0x97c8c002, 0x14b0242e,
+    0x52b252d8, 0x11859c04, 0x740f9771, 0x8cec0c8b, 0x022f7294, 0x8a1116ce,
+    0x041500c8, 0xb5d482d9, 0x62a628ae, 0x10eded3a, 0x5eb32521, 0x17114318,
+    0x0881b548, 0x25409959, 0x4f44a124, 0x5dda9348, 0xd264c0a1, 0x0818e346,
+    0xaaa0f106, 0x9a962c24, 0x34610659, 0x064ab9a8, 0x60d4d210, 0x82755226,
+    0xb9a91664, 0xcc885b70, 0x01dd0341, 0x61910204, 0x19ac908e, 0x9c0046ac,
+    0xd5938083, 0x924d4512, 0x2803742a, 0x32036041, 0xa2b5a1c8, 0x65f41800,
+    0x524bbe31, 0xb04830dc, 0xdc6a0445, 0x19bc2660, 0xa52dc216, 0x6c32254c,
+    0x2ac51816, 0x64534239, 0x2d87218c, 0xa45b66cc, 0x509d6d12, 0x6d4bc022,
+    0x42c1c582, 0x4a20ead0, 0xb2890080, 0x422a41d4, 0x7a7ed7d3, 0x61139554,
+    0x6cc36155, 0xd9140c96, 0x31056176, 0x440e579a, 0x0b262326, 0x1d8ec156,
+    0x4a0b3418, 0xb53c8e39, 0x328128ca, 0x4250a1e0, 0x45629ae8, 0x86a0254a,
+    0xb450d3d1, 0x8548f99a, 0x24041004, 0x896a0812, 0x02b01200, 0x913358d7,
+    0xc004e786, 0x48125051, 0xc0009ac5, 0x0a68266e, 0x8c44b546, 0x85a8a084,
+    0x547774e0, 0x0b00fd91, 0x252c7019, 0x4939042c, 0xa44b0142, 0x2ee48942,
+    0x89245205, 0x4166126a, 0x8444f795, 0x51202883, 0x85795436, 0x2c450621,
+    0x2c2a25e5, 0x03911648, 0x0e7ae3fa, 0xb8809951, 0x4e711996, 0x178dc464,
+    0xa9ce1741, 0x818c54e8, 0x4c21c956, 0x2cc6daa2, 0x62545110, 0x029065d0,
+    0x20191a64, 0xf0704d01, 0xc00a6712, 0x51454267, 0x8e867100, 0x48629911,
+    0x33410156, 0xa4325193, 0xcb6a0c66, 0x36999505, 0x26910a41, 0x981a2281,
+    0x0aa395cc, 0x2971b1c9, 0x54650362, 0x92453262, 0x634259e6, 0xcf557013,
+    0xdf473b5d, 0x1565b04a, 0xc14aa400, 0x6039812a, 0xed8c8ad6, 0xb8613064,
+    0x600109ef, 0x10002f01, 0xaccd6c01, 0x81b696c9, 0x8b35140b, 0x018b0034,
+    0x7630a1a4, 0x06b9ba61, 0x19028d79, 0x0c403e43, 0x08014d24, 0x31b560d1,
+    0xb723c624, 0x80421a88, 0x5a89a009, 0x02718234, 0x21632393, 0x34a75f07,
+    0x6e966168, 0x56838a68, 0x5c02644d, 0x9023012a, 0x4ae51285, 0x3d9d2fce,
+    0x1a68824a, 0x02b04c21, 0x605874c9, 0x34c960cb, 0x0a90f33e, 0x14c42088,
+    0x1f628fac, 0x7c315023, 0x42218b8d, 0x11ab0d1b, 0x66830096, 0x314269cd,
+    0x46489210, 0x4ec08511, 0x4adf8351, 0xc00093c2, 0xa1900202, 0x88749189,
+    0x6e26c967, 0x26811c5c, 0x8a62e18d, 0x35250913, 0x2c04d19d, 0x656521a4,
+    0x4941abd4, 0x7a818545, 0xac4b285a, 0xc470b8ac, 0x92149bd8, 0x689ab61c,
+    0x643a0609, 0x09d56404, 0x38886686, 0x1404f4fa, 0xbe27c8da, 0x22038f24,
+    0x2770312a, 0x94128a22, 0x9e67a717, 0xcc9c523c, 0x29a2f286, 0x09820b06,
+    0xc4c0334c, 0x88a6b5d3, 0x49498811, 0x890cd0c1, 0x456162e3, 0x415c275c,
+    0x45248a69, 0x2080c244, 0x07322296, 0x29994b40, 0x4e523f9a, 0x08f0a21a,
+    0x28d1ae24, 0x63f32a98, 0x0ce90290, 0x301683b3, 0x0cb8b48d, 0x5cc4444a,
+    0xe4ad29d1, 0x5209c517, 0xa4cbe256, 0x25199612, 0xa8e44159, 0xaa40c5aa,
+    0x24b10e2e, 0x409d315f, 0xdc30b2d5, 0x7aa949c6, 0xb5195ef7, 0x738e1138,
+    0x09c212a5, 0x464349fe, 0xcf132665, 0x80bd0e9a, 0x3258c45d, 0x60cab225,
+    0x8a26dd14, 0x416eaea4, 0x2ab4a740, 0xcf8da90b, 0x30b1085b, 0x500940f7,
+    0x826b24f3, 0x06b445ed, 0x73292145, 0x8a9500ff, 0x437432e0, 0x00008022,
+    0x123c40b8, 0xe59a18c6, 0xd424aea0, 0x21915288, 0x00520162, 0x429895a8,
+    0x14c01522, 0xabc00225, 0x0030d8d0, 0xc18c202f, 0xb9900a12, 0x0a547691,
+    0x2af694b4, 0xfd6b97bd, 0xaca3f67c, 0x7503c56b, 0x08074020, 0x1840a088,
+    0x1232a941, 0xca441920, 0xe54a4196, 0x6e340c39, 0xafd6b03a, 0xdfcc454b,
+    0x00292344, 0xb9610622, 0x23222783, 0xca0d91c2, 0x9d782aa4, 0xd5950617,
+    0x6d746e0a, 0xe26e844f, 0x8a8c4740, 0x0368924a, 0x9022023d, 0xd11888cd,
+    0x51a93c83, 0xa422a2da, 0x06506e91, 0x8c90eb2a, 0xcb82c861, 0x8cf98942,
+    0x4a04a472, 0x0342b084, 0x42cb9290, 0x9822954c, 0xb317c044, 0x09a3f42d,
+    0x01dd4db0, 0x9b0ede4b, 0xea761c8a, 0xd1880622, 0x0d180980, 0xf8022b6d,
+    0x295002bc, 0x32c88b42, 0x03204293, 0x8c8a0138, 0x5b493668, 0x4940a815,
+    0xc24d3011, 0x85650640, 0xd9505486, 0x9b81e0e1, 0x201b86d9, 0x22108723,
+    0x28164424, 0x08506ed1, 0x4c0112d0, 0x2271e5b6, 0x18a1b82f, 0x2384a0bb,
+    0x27802407, 0xc4a0850b, 0x90c55151, 0x2e88040b, 0x37ca5c24, 0xa4e0b278,
+    0x4ac0002f, 0x49862335, 0x45068d64, 0xf99d8600, 0xf52cd2cb, 0x758ba723,
+    0xf3486fd7, 0xabf7face, 0x3bdfd3f3, 0xf7bdd2ef, 0x0ee7b99d, 0x74acc9f5,
+    0x5de9fcd5, 0x6e8db53f, 0x1879657a, 0xbe560b9d, 0x69b1df27, 0x8fd5b6eb,
+    0x3700ffe6, 0xe7fcebdb, 0xb4e26bc6, 0xcdf9dbdf, 0xf775db6a, 0xd3ce329d,
+    0xd3187eef, 0xbdb68a6f, 0xfeebe9bc, 0x397de61d, 0xf47aae98, 0xd6ebcd2f,
+    0x96fed6fe, 0xd7f1ba9f, 0x7ac66ceb, 0xf68e586b, 0xe78cbbeb, 0xedbeadbf,
+    0x3f3da78d, 0x8fa76b3d, 0x7be66ad7, 0xef573f63, 0xb7596e35, 0xf1f5bebe,
+    0xbcf3f8bc, 0xf1d8b6d7, 0xce15f7f7, 0xf2fcdf73, 0x60fb8ce9, 0x6b343f9d,
+    0x78bf3ee3, 0x95aef4d9, 0x79d5e6cf, 0x963969c8, 0xd2439f59, 0xb3b5d75b,
+    0xa6afe9fa, 0xa913ea74, 0xe9b1d9c5, 0x7ef3fc6a, 0xe79a8ff6, 0xcfb5da39,
+    0x7a0fef4f, 0x4f458ee7, 0xe97c4ef7, 0xe7ce735e, 0x7d3f6b9f, 0x4e9f9ff3,
+    0xaf3da0d5, 0xc5eb7daf, 0x3e3e8dbd, 0x31fd8af4, 0x4bd3dcce, 0xa337ce6b,
+    0x00ffe65d, 0xb6a45d1f, 0x46ce832b, 0xaf63a6b7, 0x9fa64fa8, 0x6ee7bfca,
+    0xf99d5d6d, 0xd23cc568, 0xb78dbf37, 0xcbf8ef9a, 0x174ccf6b, 0xdfaf626d,
+    0xabbdf499, 0xae9f8f3f, 0x131a9f35, 0x43db8b27, 0xa853ee12, 0x6b4ef330,
+    0x8f2d58b5, 0xb7dfd7cd, 0xe7afb76a, 0xdc6f9d2e, 0xed7caf36, 0x3bb636be,
+    0xcb3e5e94, 0x69553fcf, 0xfee9988e, 0xb48ddf5f, 0x13fa8de8, 0xeb5ffa5a,
+    0x266d2f4d, 0xf38edcb4, 0xb7d7fdea, 0x6b36fe3e, 0xf3f8b21b, 0x6b758b81,
+    0xf23ca6ef, 0xdeefa974, 0x29d37132, 0xb69ce66a, 0x2dbf3539, 0xb5fe5d7f,
+    0x197ce7ad, 0xf38d692f, 0x745bb3a5, 0x00ff3bfc, 0x5ccfea7d, 0x6ffc999f,
+    0xcceff55e, 0xdf7f2bd6, 0x6be65b4e, 0x74ba5d57, 0xfb6d79f8, 0xa88879f2,
+    0xcf3fe7ee, 0xaf68edd5, 0xe437b736, 0x7bdba7de, 0x6fd5e717, 0xebe76d1f,
+    0x7d05ef69, 0x8e37b6f5, 0x692b3e9b, 0xf2da726f, 0xeb3b313d, 0x9cb6d9e7,
+    0xfcb591eb, 0x695e2bf6, 0xde963fae, 0xf3ceebb9, 0x331d673b, 0x4adbc198,
+    0x5b63e971, 0xe9da9e6b, 0x8eebe59a, 0x72b5efbc, 0xcb6dfce4, 0x12cf5db3,
+    0xf7a1d3e7, 0xe788f6a4, 0x37e7fceb, 0xafaeb7e6, 0x3b26f45b, 0x86765f5b,
+    0xe454de50, 0xf8c3dfea, 0xb5af432b, 0x9eaedad8, 0xdb368f8b, 0xc22e6cfc,
+    0xee297fd1, 0x834deb9c, 0xfd58d7b9, 0x7100fff7, 0x5ff6541d, 0xf30e52aa,
+    0xf2e04ff3, 0xd8fadfc7, 0x7f3c855d, 0x34a60786, 0xeb2d7ebc, 0xa322e75c,
+    0xcbd79cdb, 0x3eb19633, 0x4263d8d4, 0x5dd894de, 0xbf3a9d86, 0xfffef54b,
+    0x00c4ff00, 0x00011027, 0x02020202, 0x01050102, 0x00000101, 0x11010000,
+    0x41310021, 0x81716151, 0xb110a191, 0xe1f0d1c1, 0xdaff20f1, 0x01010800,
+    0x103f0100, 0x35e69b9e, 0x5bf91c2d, 0xeacdf8db, 0x1e7d56e3, 0xddb11d55,
+    0x896c1ed9, 0xf1088267, 0x0435bef9, 0xea3f66ea, 0x8ea16f0c, 0xab3e18f5,
+    0x51eecfe2, 0x0a53ded6, 0x3ea70dd9, 0xd8b6c7aa, 0x9fdec39b, 0xebe1114b,
+    0xa111c3d4, 0x8e899fde, 0xc431dbe9, 0xfe92d137, 0xb72ecffd, 0x4d677d3f,
+    0x4b14dfdf, 0x2d41d7d2, 0xed4d9048, 0xaf3a0f3f, 0x2ce74573, 0x96a546f9,
+    0xdb54c46b, 0x4da5e51d, 0xfbee3f95, 0xa07091e7, 0xcc6f89bf, 0x79cffcf0,
+    0x37fe6b55, 0xdbfaf9e0, 0xf0f8c076, 0x9fefede8, 0x37a9eeac, 0xaf84b7bf,
+    0xa67a6e49, 0xb13de77f, 0x45c6c1ad, 0xefd0df11, 0xdfbd3f57, 0xcd0d3f38,
+    0x8ec7e377, 0xed00ff7a, 0xc65f0cbc, 0xf39b74b9, 0x9e2dfc38, 0xfe4af8f6,
+    0xdb45d639, 0xd4b76a05, 0xe29839ea, 0x31f29e23, 0xfdfee62b, 0xb837e777,
+    0xfdfe78fe, 0x0a7973aa, 0xdb37b993, 0xe2fb56c0, 0x8e7b6838, 0x3ef5a256,
+    0xcc1dbd23, 0x3c9190e2, 0x3049ad4c, 0xf6a3baaf, 0x48cd6f0f, 0x335f7f45,
+    0xeb7b9e33, 0x73534a98, 0x9257c9f1, 0xa282f8d4, 0x9c9d7d7e, 0xfcf8d712,
+    0x00ff7d4c, 0x5a6c7013, 0x7130f11d, 0x7016f0fd, 0xcf33c3fd, 0xac795efa,
+    0xd4d12c22, 0xf43ff5ed, 0x5d1e9d4e, 0x5cf547cc, 0x8fcae811, 0xeab6a6be,
+    0x048f8bb9, 0x7a5d1ce0, 0x47fdf336, 0x4411cdbb, 0xebbb8a1a, 0xb5f68c5c,
+    0x7b2d7539, 0x51d1f7ab, 0xd49200ff, 0xb300ff7e, 0xffb5ee7f, 0xba67ca00,
+    0x57bb1ef3, 0x19f4ae91, 0x777f2aa8, 0x50dfd8ce, 0xcc2b6b6a, 0x84c9dec3,
+    0x83a8bffe, 0x59add79c, 0x9cba5f5e, 0xe8f8f50d, 0xb99ba9ba, 0x8317c9b0,
+    0x9a5a8b88, 0xac9fa737, 0x776c9707, 0x537f637b, 0xcfd34c5e, 0x00ffcd87,
+    0x39c531cd, 0xbbb6f1d3, 0x01cf76dc, 0x77d415f6, 0xf98dec64, 0xcaa9d69d,
+    0xdd1b37e0, 0xbcaa346a, 0xeaac4c1e, 0x3a0f8f97, 0x55979914, 0xf8b27f06,
+    0xf77c7e74, 0x33cf6f79, 0x827ad47c, 0xab79b5aa, 0xaec954c4, 0x8e6876c9,
+    0xad328858, 0x6cfc37d7, 0xe81c115f, 0x9ad7879e, 0x75dceb61, 0x855bac35,
+    0x8a79eeb2, 0xa9987beb, 0xec5e05d6, 0x2189b13f, 0x188f8b98, 0x6b1e7df1,
+    0xf51e0f9f, 0xeb711973, 0x3535ae4e, 0xe3732c4f, 0xe7c6df24, 0xfeed9ae7,
+    0x907bfe1f, 0xd3f86830, 0x6cf331d1, 0xaab14cc6, 0xfdaa7745, 0x6a4e2bfb,
+    0x7e5ceb77, 0x88ae790e, 0xfc9d69f7, 0x1cfccc44, 0x831a36ee, 0xa9db5dc4,
+    0x8c4f6bee, 0x7c47f5da, 0xef905c4f, 0xafe7297f, 0xd799198e, 0xe0311c64,
+    0x5ebf67b9, 0x1866ba6b, 0xeb8f61df, 0xe333c3d7, 0x8f69d661, 0xd32e1de0,
+    0x4c1eda9f, 0xddfecfd7, 0xc6da7d1d, 0xfc95c8f1, 0xf514cfae, 0x6d8ce915,
+    0x35f3f293, 0x3c47bfbb, 0x12e292e7, 0xef586669, 0x349fdbf3, 0x787d20e9,
+    0xe3d4f0f7, 0x2d33f776, 0x1f3f2abb, 0xe651b936, 0x236ac4bc, 0x39c9f78d,
+    0xe7336341, 0x271fc35c, 0xd945d537, 0xfe77b336, 0x5f41cef7, 0x545ddc9a,
+    0xbc5b709c, 0xf74cf4f6, 0xe898c710, 0xbd49acef, 0x1bcfd0d0, 0xe03ccaeb,
+    0xf1fbf70f, 0xc300ff17, 0x08822535, 0x7564a3e3, 0x196fd706, 0xecdbbbf7,
+    0xf53c9fe4, 0xa790bb86, 0xab4ecc74, 0x84b5b2f1, 0xfcfdb959, 0x881b934c,
+    0x7918d9e1, 0x491e5ff9, 0x896fadd3, 0xde6e2947, 0xef791aa6, 0xa13a9eb8,
+    0x8f6cd24e, 0xb7151d8e, 0x2636c99f, 0x8eaf7e7f, 0x24be4592, 0x5ae33998,
+    0x2596c9e6, 0xe7bd13f5, 0xdc7bc4ec, 0xe50fcf74, 0x3ee6d5ac, 0x542d5f5f,
+    0x30c48831, 0xe9591a33, 0xd16d4d22, 0x114793f5, 0x6c10d756, 0xc937a587,
+    0x64c79013, 0xbbc7db53, 0x726a10f1, 0xf7e64a44, 0xdfed29e8, 0xebe6594f,
+    0x7bcf4d5c, 0x983179fe, 0xcc57fcda, 0x50ee6af8, 0x3488c6ce, 0x4ae6c675,
+    0x5fb48d8b, 0xbe358e86, 0x5144d0ba, 0x7b9fe7da, 0x77c55cd9, 0x0d56b6ce,
+    0xfdac3d4b, 0xea16962f, 0xfd9c6be3, 0x5d7d1fd1, 0x99dd1a75, 0xf15a1e40,
+    0xc9cbcca7, 0x1f3f83d3, 0x4ecabeef, 0xcdbafab5, 0x302d3e27, 0xccb500c6,
+    0x6602b0eb, 0xdbe055e2, 0x0ec5500a, 0x37813222, 0x046018c0, 0x1ba1130c,
+    0x0192508c, 0xa13c45c9, 0xfb0e8702, 0x56572cae, 0x985debe4, 0xc18221a9,
+    0x281b4acd, 0x7ab7a246, 0x4d7a687d, 0x0040278a, 0x86b75088, 0xb6a29a00,
+    0xd02360d5, 0x91d05eb0, 0x4eae9015, 0x3ae97420, 0xe1509e78, 0x86135515,
+    0xd98fdc01, 0x06d40f69, 0xa5ac8fba, 0x3bf72083, 0x87de5d44, 0x4f043c2b,
+    0x0f335206, 0x088c4312, 0xbce91b6e, 0x843160fc, 0x11911b26, 0x89ca2fe8,
+    0x8457f716, 0x6685a5aa, 0x573d7040, 0x2ce13c05, 0x0d4d0238, 0x71a730b2,
+    0x578c08d9, 0xf19cf221, 0xda9f91c4, 0x96385b81, 0x966ff1b3, 0xd338d62c,
+    0x179bd09a, 0x16278595, 0xa73204ec, 0xf506e187, 0x84184c39, 0x8085b33f,
+    0xb9120464, 0x2e78d5a0, 0xc578357f, 0x69203fe5, 0x209040a2, 0x70f00550,
+    0xa8644add, 0xd11a5205, 0x255a8c48, 0x602b6c44, 0x491252cb, 0x5618658a,
+    0xd9f580ec, 0x41835b31, 0x68108648, 0xd7ca1745, 0x2a6c1c54, 0x97d685b2,
+    0xc44415ca, 0x94abc267, 0x4056308b, 0x8112cf0a, 0x8dc182b8, 0x76db7531,
+    0x788ff941, 0x48c0a722, 0xdbd97bc3, 0x9896f330, 0x80014419, 0x8344d921,
+    0xa67ea665, 0x3dab642f, 0x53d6ea24, 0xc1f2e72f, 0xaabce06d, 0x44596246,
+    0xacecc64e, 0xd8ca70df, 0x8399c184, 0x8b74c1d6, 0x89d9c4e5, 0x611fc0a6,
+    0x13a7c74c, 0x5e63d680, 0x7f460380, 0x48934847, 0xc076f013, 0xa61ef91e,
+    0xa3c80694, 0x41c6b00a, 0x191c145a, 0x018538da, 0x50ea2d32, 0xb76a2c24,
+    0xca652ff8, 0x640a9e49, 0x54253404, 0x43af5a2f, 0x85b1e096, 0xbde5fb11,
+    0x1300ff1e, 0x03e7d91a, 0x7c33dc25, 0xeb711885, 0x25892020, 0x28ac1220,
+    0x632962a2, 0x9a429899, 0x29940515, 0x4c4c0bb6, 0xa410115a, 0x99284550,
+    0x99c36228, 0x0b09930a, 0x48809620, 0x072ae084, 0x55fc80c9, 0x2094b571,
+    0xc700ff4c, 0xe4721497, 0x59c48a4b, 0x8749f703, 0xca03c390, 0xc8b8b6fd,
+    0x8856ddca, 0x7a8b3dc8, 0x2175d2b3, 0x64c8c999, 0xec8cfbf7, 0xd2b11341,
+    0x80179294, 0xbafe9f19, 0x60e99c16, 0x2266db64, 0xc1d20068, 0x6ae76024,
+    0x364b4a49, 0x3dc749d8, 0xab16f154, 0x9d36c292, 0x89a34523, 0x37651c7a,
+    0x38ec0b52, 0x690678c7, 0x9352b8a7, 0x725495e1, 0x5d3357ab, 0xe7fbd283,
+    0xadb3ac01, 0xa1bb5464, 0x15e811a0, 0x9b20aad6, 0x86283ccf, 0xc78e1026,
+    0x57e931ba, 0x394ddbe7, 0x2285cc84, 0x27e22ef9, 0xe59c9fc9, 0x9553c470,
+    0x72106749, 0xb0b79c5b, 0x603aa8e5, 0x0e7bacea, 0xd559c6f0, 0x31a02513,
+    0xb90ac110, 0x22b738e0, 0x4bcef205, 0x24293b02, 0x513866d9, 0x2d124396,
+    0x0c3589a2, 0x61278b2a, 0x031e073d, 0x41b27af8, 0x928b15b3, 0xdfd97a68,
+    0x562e64a5, 0xfce89b90, 0x6e0db154, 0x0d2831e0, 0xe630311e, 0x012859f9,
+    0xcd07294b, 0x3348a403, 0x090e2899, 0x8f01ba80, 0xe1115091, 0x703a7d98,
+    0x378ac82a, 0x9e9f3fd3, 0x6c60f210, 0x011286fe, 0x68768218, 0x06ceeae8,
+    0x99b57041, 0x0da1368c, 0x10a201c8, 0x28c00678, 0x7d754d58, 0x8ee2aef2,
+    0x645ce0f4, 0x4b7ce221, 0x4726b101, 0x0edc02d9, 0xe4500596, 0x07015310,
+    0xd8064ad9, 0xc5b77d42, 0x2d9773f8, 0x4b463719, 0xa65fe3a8, 0x8442e84f,
+    0x2059feaa, 0xc64c30e7, 0x92824e05, 0xff52fd8d, 0xf3ad7000, 0x27971c6c,
+    0x8400ffae, 0x2b8af931, 0xe743cb7d, 0x84a540e2, 0x84138d70, 0x54559d22,
+    0x0027ce13, 0xd91531dc, 0x60901daf, 0xa708d6e4, 0xb39b0d3d, 0xf278e873,
+    0x209b9570, 0x879d3074, 0x74b9c291, 0x17dc5652, 0xc34ef7de, 0x458f621c,
+    0xc6d4f667, 0x76a9c7b1, 0xa37d3373, 0x86e1e888, 0xd23a277c, 0xf2165a2e,
+    0x94cf8aca, 0x34cedcd3, 0x880e72ee, 0xa50159eb, 0xde22ae14, 0x35e55e44,
+    0x1232af0d, 0x7b6b30cf, 0xfccbc093, 0x7185811f, 0xdfd812fe, 0x96016504,
+    0x16ea0769, 0x9127efd9, 0x20fa04f1, 0xc34d9283, 0x708ec710, 0xcb8e27be,
+    0xd263e576, 0xf4979a03, 0xf2f1aca7, 0x25830c89, 0x62596f0d, 0x404e4327,
+    0xf40533a7, 0x17f6f240, 0xb266448f, 0x8c25bc5e, 0x579613ab, 0x075f4321,
+    0x538d8459, 0xeac83439, 0x8f85397d, 0x9ec1817e, 0xce347376, 0x365f8e52,
+    0x0251ea51, 0xe01238c6, 0x1b2b870c, 0xbf4e2da7, 0xeea04518, 0xbed01ff7,
+    0x29d33328, 0x4ff8040b, 0xabed72da, 0xb2b729fd, 0xa6c9b1b9, 0xc8e07031,
+    0x29f32ba5, 0xfc4b9981, 0x429b6dd0, 0x056983c1, 0x6118230d, 0x6279c70c,
+    0x6a17b088, 0x70b00c64, 0x59109635, 0x9ec237d0, 0x4c4f4733, 0xe4023791,
+    0x7105635f, 0x369c57c5, 0x06ce5ba8, 0xe20d8ad4, 0xc9a01844, 0xff1cc8cb,
+    0x9b8b1f00, 0xa1bc8084, 0xc6459aa6, 0x157f9274, 0xd13554fd, 0x385c8961,
+    0x2e10caed, 0x385b774f, 0x6d3e5897, 0xbb711c8e, 0xe89a04fd, 0x0c56bcd2,
+    0xd40f074b, 0xe2087c08, 0xa2e6c3c8, 0xb808b210, 0x5c6b5080, 0x59581bd7,
+    0xd942d16a, 0x5681bb19, 0x51605061, 0x52691ae2, 0xc8804258, 0xa9a22475,
+    0x82e7be16, 0x3a1a69e5, 0x9952b7bb, 0xf3bd51b5, 0xa4decb46, 0x0de6e447,
+    0xcf1d8d89, 0xc9f795fa, 0xa8f9c987, 0x61f071a1, 0xf369c3e1, 0x24a4e1da,
+    0x9d513114, 0x485dde7e, 0x7a5929a2, 0x2459c5e6, 0x97f9783d, 0xb0d0a96a,
+    0x7ddce656, 0x765a1589, 0x64debe34, 0x43c832dd, 0xdfe40355, 0x03e34ad2,
+    0x9810d80d, 0x06a81365, 0x802f435a, 0xc6082cc9, 0x5a3e71ec, 0xfacb4932,
+    0x0b56f54e, 0x299608c5, 0x502f525b, 0xb0eec0d4, 0xcb7a56cc, 0x27328b00,
+    0x5960b0df, 0x29e3f0d4, 0x3c302229, 0x6168fc1e, 0x28fd9256, 0x09b4314f,
+    0x9bb99eb9, 0x69eaa780, 0xd94ea20b, 0x8a32b905, 0x019f856c, 0x575e857e,
+    0x69c3d3c1, 0xafab968b, 0x49f8851c, 0x7c10372b, 0x21af5f74, 0x6d1c2228,
+    0x46801b19, 0xaace58c1, 0xf89d0e58, 0x37800112, 0x57cc47ec, 0xb88300b4,
+    0x83387014, 0x32bbe05b, 0xd11a91de, 0xf190b28c, 0x405c3205, 0xcb4ac289,
+    0xd30fe407, 0x3bd9284e, 0x132bf61e, 0x6b2c09a5, 0x3100ff45, 0x64fd7920,
+    0xeca3d04f, 0x192d21ed, 0x3127183c, 0xfa73d8aa, 0x757374b8, 0x1c044357,
+    0x449afec1, 0xca5cc3ee, 0x0fcc1c53, 0x2d8e1e16, 0x894dc3cf, 0x82b36ca7,
+    0xe8ced10e, 0xdc7a965c, 0x0656650c, 0xbc0f814b, 0xa4732773, 0xa84589f2,
+    0x02caf858, 0xcc508c5d, 0xcb4a393e, 0x6e3ee454, 0xb4fce76d, 0x5c686330,
+    0xa085253b, 0x4a8dd9a6, 0x995d7864, 0x94e3b26d, 0xec396635, 0x00561239,
+    0x6bc8b868, 0x10892a0b, 0x9aa8cfa9, 0x5f149cf9, 0x0cc326dd, 0x6b6a6198,
+    0x88387d91, 0x062d3290, 0xef10d245, 0x2d35fd89, 0x58a0968a, 0x72721538,
+    0x790d6111, 0x84f41877, 0x6882961b, 0x8ef5d0de, 0x953b010f, 0x102288c8,
+    0x38ccc6f7, 0xc26bf0ea, 0x89433171, 0x6944e453, 0x46da1f99, 0x65b61942,
+    0x0becd5e6, 0x58c5849d, 0xed55dd14, 0x456de404, 0xb585bee0, 0x704426c7,
+    0xce15ef92, 0x231e0b44, 0xd0518ce4, 0x4103320b, 0x32290c46, 0x8cea15cf,
+    0xb36b68f0, 0x71bc9658, 0x3f7676b5, 0x57f93783, 0xffb21211, 0x2d61ec00,
+    0x72ac7b5b, 0x951a3d20, 0x4438a587, 0x01dc192c, 0x0eaa47e8, 0xe0cce8c0,
+    0xc8af52a2, 0x43c414d5, 0x893b851f, 0x1823d9c0, 0x59b2b897, 0x80e11f14,
+    0x2fa072aa, 0x42e2a940, 0xb62ec7ce, 0x177375ba, 0x911a1320, 0x119658c7,
+    0xa2986138, 0x4c6dce4d, 0xa0d85828, 0x2ec64b0b, 0x26bd21de, 0x00e0271a,
+    0x0b4e46c5, 0xc30c3b4b, 0x6a34ea31, 0x4b8eebe2, 0x21b8ad15, 0x147bc4a3,
+    0x4704fdd3, 0x05ce86be, 0x047c5a26, 0xa36aa875, 0xff2cde88, 0x54310200,
+    0xc6f1c52d, 0x13c3f21a, 0x74eb02ab, 0x8bade3a3, 0xb601cd05, 0xcb8bc843,
+    0x3afc1b60, 0xefc16225, 0x45f6234e, 0xcd32c05b, 0x83c733a3, 0x79509a8d,
+    0x8e8a3599, 0x318b65ee, 0x43cf8670, 0x734e1980, 0x9ab5a0a7, 0x33c56744,
+    0x5804101c, 0x6967b867, 0x0cd9c932, 0x47361794, 0x0200f3a6, 0x00a6d4b2,
+    0x1782aca4, 0x91470af4, 0x5b8c91a9, 0x6903cabe, 0x9e3a3e4e, 0x71483c8a,
+    0x0ce6a137, 0xac9165cb, 0xfb660681, 0x4ea93f92, 0x56ed60bf, 0x00675105,
+    0x282a626c, 0x603a7c33, 0x4baa13d8, 0x0342f77a, 0x692528b7, 0x2e82e398,
+    0x490e80a2, 0xcc55bed7, 0x73da0cb0, 0xab485e71, 0x3e87b00d, 0x70d5abc1,
+    0x45386664, 0x51831dad, 0xd27ac77a, 0x8cef9ec5, 0x89e55032, 0x2aecd151,
+    0x518ff660, 0xdd5ad03d, 0xf3cfafac, 0x66803cb8, 0x2c62a089, 0x3eacf96b,
+    0x0e62f01a, 0xf6797769, 0x8d5b1075, 0x709eeb8a, 0xb467ae9d, 0x5cb1a25e,
+    0x95362ce2, 0x881819fa, 0x53beb679, 0x8f7d322a, 0x982d6385, 0xf02d106b,
+    0x8598c999, 0xfc5705c7, 0xa65b0226, 0xfd3004f0, 0xc809440c, 0xcdd192fa,
+    0x3b3e9178, 0x437f6b68, 0xacaf3203, 0xc3477f7d, 0x8fd17834, 0x22218024,
+    0xaf7526bc, 0x6e961851, 0x314f13da, 0xa4198b92, 0x25219378, 0xa66ff191,
+    0x28531998, 0xba84c15f, 0x7ee68891, 0x573b4120, 0x231d75d2, 0x58333797,
+    0x68242510, 0x2f63729a, 0x1f8c7acc, 0x39dfcf15, 0x83486055, 0xf844a7df,
+    0xb023e561, 0x0a636e51, 0x2cb876cd, 0x9d73ef0a, 0x7dc9ee84, 0x8ae636be,
+    0x223c32cb, 0x411b5c27, 0x4c9c637b, 0xa5e29de1, 0x4fba8aa4, 0xaa034c55,
+    0x9213463f, 0x940be43f, 0x259871cf, 0xcec86614, 0x66fa8f12, 0x6a6142c1,
+    0x74925f77, 0xb3330aca, 0x703530be, 0xb803b883, 0xa6d7d900, 0x0eea7431,
+    0x33626a34, 0x18945884, 0xc66441cc, 0xa0d95725, 0x45249908, 0xa1cd7826,
+    0x1c3b76b5, 0x92ccdba2, 0x8847c206, 0x097f2469, 0x55fb82e5, 0x672a3181,
+    0x84458edb, 0x66d892f1, 0x86a9a226, 0xa9c34e50, 0x5c050b14, 0x05292791,
+    0x842872a5, 0x2187306b, 0x2d235812, 0xaf210083, 0x337a44fe, 0xf62860b1,
+    0x1687ae36, 0x156fab38, 0xff480806, 0x1f142500, 0xb8880a51, 0xad40c15c,
+    0xb0664a97, 0x9f2b40e5, 0x85c042b0, 0xb0b00893, 0xaca3a13c, 0x0103f805,
+    0x3a6a61c5, 0xf26e8312, 0x400e3df0, 0x4f70a0c1, 0x4b808c59, 0x229788f8,
+    0xa3518a55, 0x2842dd64, 0x248035bd, 0x39e61a20, 0x0cb213c3, 0x6b511621,
+    0x9e3acdaa, 0xdad6e811, 0x323a1e75, 0x05fb5066, 0x94653ef7, 0xdadc66be,
+    0xe6419584, 0xd3cc1782, 0x5129c7ce, 0x7a680c35, 0x74c5d5e5, 0x0ddcc01a,
+    0x89ec17d5, 0x13fbb5a8, 0x905a1128, 0xf8f3c79d, 0x2fb9c84b, 0xa9b717a2,
+    0xa77a6a98, 0xd60c861a, 0x6ec28fbd, 0x49d2601d, 0x3614852e, 0xfe85f8a4,
+    0xe610d0b0, 0x00455c91, 0x1857e7fa, 0x4ff0e854, 0x451613bd, 0xae706dee,
+    0x461b5b21, 0xe6b8e706, 0x55c2390a, 0x1e7ec588, 0x8cfa3caa, 0xf45bc76b,
+    0xf8cc7575, 0x5629c829, 0xd4916462, 0xcaeb3ff6, 0xe9ce1185, 0xb7afe567,
+    0x5ae6ce26, 0x77d1f6ca, 0x86d5a82b, 0x543bdf4c, 0xb9ac9e5b, 0x9c58aae4,
+    0x5f3edd3d, 0x1789c36a, 0xa094f34d, 0x2e022ee2, 0xef4c3638, 0x4ed1ad9d,
+    0xb47dfad9, 0x463d4d73, 0x7c9f0ef2, 0xfc167597, 0x43fcdf18, 0xed524fcd,
+    0xb58b73e3, 0x4a037e6b, 0x9befe673, 0x6e9eba30, 0xf344df39, 0x10cedfb8,
+    0x76043800, 0x48e25721, 0xdfdcc299, 0x6b36e6d9, 0xe51da6e6, 0xb8f56ed5,
+    0x77c4dbbf, 0x00ff24a3, 0xbc5dbeb2, 0x66e44f7c, 0x1ddfe5f8, 0xe3714df2,
+    0x19868f1a, 0xeadd57d7, 0x2a397579, 0xdfbff16b, 0xacbf4364, 0xaef13b28,
+    0xac9ee2a2, 0xadc625a8, 0xcdc6ded3, 0x8f14eeca, 0xe3ab8d33, 0xfc3c9d7b,
+    0xce97e9b0, 0x00ff7b01, 0xeab7f8a6, 0xb8d6c6b8, 0x787ef36b, 0x1f6b9c36,
+    0x2ab65fa2, 0x46e22f8f, 0xaf27eaf1, 0x9a58ea8d, 0x23ea6085, 0xc13db739,
+    0xc7ad37ae, 0x8d957337, 0xc32f5f34, 0xaca26e3c, 0x726f67c7, 0xc3c34472,
+    0xe3308f70, 0xdfc13cd7, 0x2f29bc04, 0xd13b5d5d, 0xd6fc30fb, 0x64d0ecd4,
+    0x43d579ae, 0x5d3e1fdf, 0xb267e6e4, 0x1ef3274e, 0x1367ce62, 0xb51dd3c5,
+    0xf76c9b6c, 0xdc518fc3, 0x7fead43b, 0xdd71f983, 0x487b44b7, 0x10f38b9f,
+    0x8ea315bc, 0xf86d1337, 0x339ea6ae, 0x334771ac, 0xf4f15df2, 0x968d215e,
+    0x7300ff04, 0xe7de9abf, 0xfd8f6e0f, 0xd4eba6fe, 0x4cad5f18, 0xd5443bea,
+    0x56443efc, 0xeac49ebb, 0x9fe0ee66, 0x8e256f50, 0xa6799d7a, 0x77e38a4a,
+    0xf72dec38, 0x99b8ab43, 0x5d3626ee, 0x5be75e55, 0xf1e6f1a8, 0x3fe67784,
+    0x3d999bbd, 0x9faf93c1, 0xe25ebeae, 0xd4e3f058, 0x37785ef5, 0xdef57c07,
+    0x7a97e13f, 0x87274cdc, 0x259ba297, 0x52e205ec, 0x6b76e26f, 0x6dc7c98b,
+    0x7a1fb1cd, 0x9b8b7b83, 0x77947462, 0x1572f33b, 0x9be7fce2, 0x1e702f1f,
+    0x39d11175, 0x6f995ec6, 0xa7bf3b71, 0xd4b41053, 0x7d37668e, 0x9ee0a933,
+    0x8e36d6d4, 0xdd4354b5, 0xc8acd66f, 0x4fa8c3d2, 0xe6f3a9bf, 0x01319ec0,
+    0xfcd41b07, 0xce3aedcf, 0xc54a7f32, 0x7435b249, 0x3527a71b, 0xa899835a,
+    0x9cef37fc, 0xf78cddd6, 0xaa2e4fae, 0x492827bb, 0x241573fd, 0xa3fb926b,
+    0x08ae571c, 0xf9847ae1, 0x5fa1ce97, 0xf8dd403c, 0x9b3b8638, 0x783be8d4,
+    0x11fc25f2, 0xcdc97a34, 0x7ebcfb37, 0x688f8768, 0x7a5b2c59, 0x53bd73dc,
+    0x4fce72c5, 0x52fbe998, 0x7c9ea924, 0x3e126a9a, 0x3617df23, 0xc7ab3637,
+    0xfc56d319, 0x7c00ffc4, 0x1a9f51f5, 0xead500ff, 0x6d3fa49e, 0x2013c755,
+    0x4fdaaf47, 0xf96fbabc, 0xf0819bb5, 0xa516c6fe, 0xb77b459d, 0x6af8cc55,
+    0x2b82d537, 0x679e9b5e, 0x3aa6f7d5, 0x678abe50, 0x1f8eba65, 0x35fa9c3b,
+    0xfb8b5a55, 0x3ac657f1, 0xb2c19d9b, 0xebf87dbd, 0xc7d45724, 0xa5cb0b31,
+    0x183c68e1, 0xebf1778b, 0xf599fa7c, 0xf3af1939, 0x8ddea3b6, 0xd4d470ee,
+    0xe078bbf8, 0xc52d3d77, 0x3a924646, 0x49f55097, 0x6a00ff11, 0x1fdf8733,
+    0x22c5d74f, 0xdfae1ff1, 0x8e91f911, 0xce339e1a, 0xdc7ab8c5, 0xefb6bb4d,
+    0x3dec859e, 0x73bc1cf3, 0xcd798da8, 0x3a91ddbc, 0xa3fa1b3f, 0x3bc98fa9,
+    0x4df78fa1, 0x31d7846f, 0x013e78fb, 0xe1f292fd, 0xecddee1a, 0x17b51efc,
+    0x1cd34b40, 0xcfe0855d, 0x1fb40f3a, 0x00db5fb9, 0x6fc4effc, 0xce7a5fe5,
+    0xf1135204, 0xe7fbbe7f, 0x68521e2b, 0x09eb3aee, 0x8c7dc823, 0xcee5d7fc,
+    0x49e26a3e, 0xf9198f8f, 0x00fffd89, 0xf0cb6b04, 0xd8f83e26, 0x69c5cafa,
+    0xcefac46f, 0xf1efa73e, 0xe5fcea52, 0x00ff21fa, 0x87f5f875, 0xebfa655e,
+    0x3e2b4693, 0xfce3743f, 0xdf2838f3, 0x7a2cbd1c, 0x37acaf60, 0xf2fec117,
+    0xdc717b45, 0x3fbede41, 0xfa3da89c, 0x7800ffed, 0x051314e3, 0xfc9bef3f,
+    0x8164641d, 0x6f691e0b, 0x819113dd, 0x5c3f7fe4, 0xb09b4ab8, 0x553cdf7f,
+    0x726d8415, 0xea31f50b, 0x41a72e57, 0x7100ff16, 0xe183737b, 0xddbfbef5,
+    0xfc108eb7, 0x3800ffb7, 0xd9ff3fe7, 0x50545448, 0x302e312f, 0x30303220,
+    0x0d4b4f20, 0x7265530a, 0x3a726576, 0x49776c20, 0x2e312f50, 0x20312e34,
+    0x74746828, 0x2f2f3a70, 0x61766173, 0x68616e6e, 0x6e6f6e2e, 0x2e756e67,
+    0x2f67726f, 0x6a6f7270, 0x73746365, 0x69776c2f, 0x0a0d2970, 0x746e6f43,
+    0x2d746e65, 0x676e654c, 0x203a6874, 0x38313731, 0x6f430a0d, 0x6e65746e,
+    0x79542d74, 0x203a6570, 0x67616d69, 0x2d782f65, 0x6e6f6369, 0x54450a0d,
+    0x203a6761, 0x61336322, 0x65613735, 0x64633537, 0x38316463, 0x0a0d2237,
+    0x68636143, 0x6f432d65, 0x6f72746e, 0x6d203a6c, 0x612d7861, 0x383d6567,
+    0x30303436, 0x0a0d0a0d, 0x00010000, 0x10100002, 0x00010010, 0x01280004,
+    0x00260000, 0x10100000, 0x00010000, 0x05680008, 0x014e0000, 0x00280000,
+    0x00100000, 0x00200000, 0x00010000, 0x00000004, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x80000080,
+    0x80000000, 0x00800080, 0x00800000, 0x80800080, 0xc0c00000, 0x808000c0,
+    0x00000080, 0xff0000ff, 0xff000000, 0x00ff00ff, 0x00ff0000, 0xffff00ff,
+    0xffff0000, 0x000000ff, 0x97070000, 0x00000000, 0x97790000, 0x00000000,
+    0x97990700, 0x00000000, 0x99997900, 0x07000070, 0x79979977, 0x09000097,
+    0xf77f9999, 0x79007099, 0x97f99999, 0x99079799, 0x9ff99999, 0x99799999,
+    0x9ff99999, 0x99999999, 0x9ff99799, 0x00009779, 0x9ff79799, 0x00009079,
+    0xf77f9999, 0x00007099, 0x999f9999, 0x00000000, 0x99909999, 0x00000000,
+    0x00709999, 0x00000000, 0x00009999, 0x8fff0000, 0x0ffffdfc, 0x0ffefdfc,
+    0x07fcfdfc, 0x03e0fdfc, 0x01e0fdfc, 0x00c0fdfc, 0x0080fdfc, 0x0000fdfc,
+    0x0000fdfc, 0x01f0fdfc, 0x01f0fdfc, 0x0ff0fdfc, 0x4ff0fdfc, 0x7ff0fdfc,
+    0xfff0fdfc, 0x0028fdfc, 0x00100000, 0x00200000, 0x00010000, 0x00000008,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x80000080, 0x80000000, 0x00800080, 0x00800000, 0x80800080,
+    0xc0c00000, 0xdcc000c0, 0xcaf000c0, 0xf0d400a6, 0xe2b100ff, 0xd48e00ff,
+    0xc66b00ff, 0xb84800ff, 0xaa2500ff, 0xaa0000ff, 0x920000ff, 0x7a0000dc,
+    0x620000b9, 0x4a000096, 0x32000073, 0xe3d40050, 0xc7b100ff, 0xab8e00ff,
+    0x8f6b00ff, 0x734800ff, 0x572500ff, 0x550000ff, 0x490000ff, 0x3d0000dc,
+    0x310000b9, 0x25000096, 0x19000073, 0xd4d40050, 0xb1b100ff, 0x8e8e00ff,
+    0x6b6b00ff, 0x484800ff, 0x252500ff, 0x000000ff, 0x000000ff, 0x000000dc,
+    0x000000b9, 0x00000096, 0x00000073, 0xd4e30050, 0xb1c700ff, 0x8eab00ff,
+    0x6b8f00ff, 0x487300ff, 0x255700ff, 0x005500ff, 0x004900ff, 0x003d00dc,
+    0x003100b9, 0x00250096, 0x00190073, 0xd4f00050, 0xb1e200ff, 0x8ed400ff,
+    0x6bc600ff, 0x48b800ff, 0x25aa00ff, 0x00aa00ff, 0x009200ff, 0x007a00dc,
+    0x006200b9, 0x004a0096, 0x00320073, 0xd4ff0050, 0xb1ff00ff, 0x8eff00ff,
+    0x6bff00ff, 0x48ff00ff, 0x25ff00ff, 0x00ff00ff, 0x00dc00ff, 0x00b900dc,
+    0x009600b9, 0x00730096, 0x00500073, 0xd4ff0050, 0xb1ff00f0, 0x8eff00e2,
+    0x6bff00d4, 0x48ff00c6, 0x25ff00b8, 0x00ff00aa, 0x00dc00aa, 0x00b90092,
+    0x0096007a, 0x00730062, 0x0050004a, 0xd4ff0032, 0xb1ff00e3, 0x8eff00c7,
+    0x6bff00ab, 0x48ff008f, 0x25ff0073, 0x00ff0057, 0x00dc0055, 0x00b90049,
+    0x0096003d, 0x00730031, 0x00500025, 0xd4ff0019, 0xb1ff00d4, 0x8eff00b1,
+    0x6bff008e, 0x48ff006b, 0x25ff0048, 0x00ff0025, 0x00dc0000, 0x00b90000,
+    0x00960000, 0x00730000, 0x00500000, 0xe3ff0000, 0xc7ff00d4, 0xabff00b1,
+    0x8fff008e, 0x73ff006b, 0x57ff0048, 0x55ff0025, 0x49dc0000, 0x3db90000,
+    0x31960000, 0x25730000, 0x19500000, 0xf0ff0000, 0xe2ff00d4, 0xd4ff00b1,
+    0xc6ff008e, 0xb8ff006b, 0xaaff0048, 0xaaff0025, 0x92dc0000, 0x7ab90000,
+    0x62960000, 0x4a730000, 0x32500000, 0xffff0000, 0xffff00d4, 0xffff00b1,
+    0xffff008e, 0xffff006b, 0xffff0048, 0xffff0025, 0xdcdc0000, 0xb9b90000,
+    0x96960000, 0x73730000, 0x50500000, 0xfff00000, 0xffe200d4, 0xffd400b1,
+    0xffc6008e, 0xffb8006b, 0xffaa0048, 0xffaa0025, 0xdc920000, 0xb97a0000,
+    0x96620000, 0x734a0000, 0x50320000, 0xffe30000, 0xffc700d4, 0xffab00b1,
+    0xff8f008e, 0xff73006b, 0xff570048, 0xff550025, 0xdc490000, 0xb93d0000,
+    0x96310000, 0x73250000, 0x50190000, 0xffd40000, 0xffb100d4, 0xff8e00b1,
+    0xff6b008e, 0xff48006b, 0xff250048, 0xff000025, 0xdc000000, 0xb9000000,
+    0x96000000, 0x73000000, 0x50000000, 0xffd40000, 0xffb100e3, 0xff8e00c7,
+    0xff6b00ab, 0xff48008f, 0xff250073, 0xff000057, 0xdc000055, 0xb9000049,
+    0x9600003d, 0x73000031, 0x50000025, 0xffd40019, 0xffb100f0, 0xff8e00e2,
+    0xff6b00d4, 0xff4800c6, 0xff2500b8, 0xff0000aa, 0xdc0000aa, 0xb9000092,
+    0x9600007a, 0x73000062, 0x5000004a, 0xffd40032, 0xffb100ff, 0xff8e00ff,
+    0xff6b00ff, 0xff4800ff, 0xff2500ff, 0xff0000ff, 0xdc0000ff, 0xb90000dc,
+    0x960000b9, 0x73000096, 0x50000073, 0xf2f20050, 0xe6e600f2, 0xdada00e6,
+    0xcece00da, 0xc2c200ce, 0xb6b600c2, 0xaaaa00b6, 0x9e9e00aa, 0x9292009e,
+    0x86860092, 0x7a7a0086, 0x6e6e007a, 0x6262006e, 0x56560062, 0x4a4a0056,
+    0x3e3e004a, 0x3232003e, 0x26260032, 0x1a1a0026, 0x0e0e001a, 0xfbf0000e,
+    0xa0a400ff, 0x808000a0, 0x00000080, 0xff0000ff, 0xff000000, 0x00ff00ff,
+    0x00ff0000, 0xffff00ff, 0xffff0000, 0x000000ff, 0x00000000, 0x25000000,
+    0x00002528, 0x00000000, 0x00000000, 0x28250000, 0x00002528, 0x00000000,
+    0x00000000, 0x28282500, 0x00002528, 0x00000000, 0x00000000, 0x28282800,
+    0x00252828, 0x00000000, 0x25252500, 0xf6282825, 0x252823f6, 0x00000000,
+    0x28282800, 0x23232828, 0x2823f623, 0x00000025, 0x28282825, 0x28232828,
+    0x2828f628, 0x25002528, 0x28282828, 0x28232828, 0x2828f628, 0x28252828,
+    0x28282828, 0x28f6f628, 0x28f6f628, 0x28282828, 0x28282828, 0x28f6f628,
+    0x28f62328, 0x00002528, 0x28280000, 0x23232828, 0x28282328, 0x00000028,
+    0x28280000, 0x23282828, 0x28282323, 0x00000028, 0x28280000, 0x23282828,
+    0x00002828, 0x00000000, 0x28280000, 0x00252828, 0x00002828, 0x00000000,
+    0x28280000, 0x00002828, 0x00000000, 0x00000000, 0x28280000, 0x00002828,
+    0x00000000, 0x8fff0000, 0x0fff0000, 0x0ffe0000, 0x07fe0000, 0x03e00000,
+    0x01e00000, 0x00c00000, 0x00800000, 0x00000000, 0x00000000, 0x01f00000,
+    0x01f00000, 0x0ff00000, 0x4ff00000, 0xfff00000, 0xfff00000, 0x00000000,
+    0x50545448, 0x302e312f, 0x30303220, 0x0d4b4f20, 0x7265530a, 0x3a726576,
+    0x49776c20, 0x2e312f50, 0x20312e34, 0x74746828, 0x2f2f3a70, 0x61766173,
+    0x68616e6e, 0x6e6f6e2e, 0x2e756e67, 0x2f67726f, 0x6a6f7270, 0x73746365,
+    0x69776c2f, 0x0a0d2970, 0x746e6f43, 0x2d746e65, 0x676e654c, 0x203a6874,
+    0x30323434, 0x6f430a0d, 0x6e65746e, 0x79542d74, 0x203a6570, 0x74786574,
+    0x6d74682f, 0x450a0d6c, 0x3a676154, 0x30392220, 0x35323932, 0x39643364,
+    0x38386434, 0x0d223339, 0x6361430a, 0x432d6568, 0x72746e6f, 0x203a6c6f,
+    0x2d78616d, 0x3d656761, 0x0d303036, 0x3c0a0d0a, 0x434f4421, 0x45505954,
+    0x4d544820, 0x3c0a3e4c, 0x202d2d21, 0x79706f43, 0x68676972, 0x63282074,
+    0x30322029, 0x322d3331, 0x20303230, 0x61786554, 0x6e492073, 0x75727473,
+    0x746e656d, 0x6e492073, 0x70726f63, 0x7461726f, 0x202e6465, 0x6c6c4120,
+    0x67697220, 0x20737468, 0x65736572, 0x64657672, 0x2d2d202e, 0x683c0a3e,
+    0x3e6c6d74, 0x3c20200a, 0x64616568, 0x20200a3e, 0x743c2020, 0x656c7469,
+    0x2d4b453e, 0x43344d54, 0x34393231, 0x45204c58, 0x756c6176, 0x6f697461,
+    0x694b206e, 0x742f3c74, 0x656c7469, 0x20200a3e, 0x733c2020, 0x656c7974,
+    0x70797420, 0x74223d65, 0x2f747865, 0x22737363, 0x2a2f0a3e, 0x706f4320,
+    0x67697279, 0x28207468, 0x32202963, 0x2d333130, 0x30323032, 0x78655420,
+    0x49207361, 0x7274736e, 0x6e656d75, 0x49207374, 0x726f636e, 0x61726f70,
+    0x2e646574, 0x6c412020, 0x6972206c, 0x73746867, 0x73657220, 0x65767265,
+    0x2a202e64, 0x2f0a0a2f, 0x7453202a, 0x6e696c79, 0x6f662067, 0x68742072,
+    0x6e652065, 0x65726974, 0x636f6420, 0x6e656d75, 0x2a202e74, 0x6f620a2f,
+    0x7b0a7964, 0x2020200a, 0x63616220, 0x6f72676b, 0x2d646e75, 0x6f6c6f63,
+    0x77203a72, 0x65746968, 0x20200a3b, 0x6f632020, 0x3a726f6c, 0x616c6220,
+    0x0a3b6b63, 0x20202020, 0x746e6f66, 0x6d61662d, 0x3a796c69, 0x69724120,
+    0x482c6c65, 0x65766c65, 0x61636974, 0x6e61732c, 0x65732d73, 0x3b666972,
+    0x0a0a7d0a, 0x53202a2f, 0x696c7974, 0x6620676e, 0x7420726f, 0x68206568,
+    0x69646165, 0x6420676e, 0x202e7669, 0x230a2f2a, 0x64616568, 0x0a676e69,
+    0x20200a7b, 0x6c632020, 0x3a726165, 0x746f6220, 0x200a3b68, 0x6d202020,
+    0x69677261, 0x6f622d6e, 0x6d6f7474, 0x3031203a, 0x0a3b7870, 0x230a0a7d,
+    0x64616568, 0x5f676e69, 0x7b0a3168, 0x2020200a, 0x6e6f6620, 0x69732d74,
+    0x203a657a, 0x3b6d6532, 0x2020200a, 0x6e6f6620, 0x65772d74, 0x74686769,
+    0x6f62203a, 0x0a3b646c, 0x20202020, 0x74786574, 0x696c612d, 0x203a6e67,
+    0x746e6563, 0x0a3b7265, 0x230a0a7d, 0x64616568, 0x5f676e69, 0x7b0a3268,
+    0x2020200a, 0x6e6f6620, 0x69732d74, 0x203a657a, 0x35322e31, 0x0a3b6d65,
+    0x20202020, 0x746e6f66, 0x6965772d, 0x3a746867, 0x6c6f6220, 0x200a3b64,
+    0x74202020, 0x2d747865, 0x67696c61, 0x63203a6e, 0x65746e65, 0x7d0a3b72,
+    0x68230a0a, 0x69646165, 0x6820676e, 0x0a7b0a72, 0x20202020, 0x64726f62,
+    0x622d7265, 0x6f74746f, 0x31203a6d, 0x73207870, 0x64696c6f, 0x66662320,
+    0x30303030, 0x20200a3b, 0x6f622020, 0x72656472, 0x706f742d, 0x7031203a,
+    0x6f732078, 0x2064696c, 0x30666623, 0x3b303030, 0x0a0a7d0a, 0x61656823,
+    0x676e6964, 0x69206120, 0x7b0a676d, 0x2020200a, 0x726f6220, 0x3a726564,
+    0x0a3b3020, 0x2f0a0a7d, 0x7453202a, 0x6e696c79, 0x6f662067, 0x68742072,
+    0x656d2065, 0x6420756e, 0x202e7669, 0x230a2f2a, 0x756e656d, 0x200a7b0a,
+    0x66202020, 0x74616f6c, 0x656c203a, 0x0a3b7466, 0x20202020, 0x6772616d,
+    0x622d6e69, 0x6f74746f, 0x31203a6d, 0x3b787030, 0x2020200a, 0x64697720,
+    0x203a6874, 0x70353232, 0x7d0a3b78, 0x6d230a0a, 0x20756e65, 0x7b0a6c75,
+    0x2020200a, 0x73696c20, 0x74732d74, 0x2d656c79, 0x65707974, 0x6f6e203a,
+    0x0a3b656e, 0x20202020, 0x6772616d, 0x203a6e69, 0x200a3b30, 0x70202020,
+    0x69646461, 0x203a676e, 0x7d0a3b30, 0x6d230a0a, 0x20756e65, 0x696c3a61,
+    0x202c6b6e, 0x6e656d23, 0x3a612075, 0x69736976, 0x0a646574, 0x20200a7b,
+    0x61622020, 0x72676b63, 0x646e756f, 0x6c6f632d, 0x203a726f, 0x30666623,
+    0x3b303030, 0x2020200a, 0x6c6f6320, 0x203a726f, 0x66666623, 0x3b666666,
+    0x2020200a, 0x73696420, 0x79616c70, 0x6c62203a, 0x3b6b636f, 0x2020200a,
+    0x6e6f6620, 0x65772d74, 0x74686769, 0x6f62203a, 0x0a3b646c, 0x20202020,
+    0x6772616d, 0x622d6e69, 0x6f74746f, 0x32203a6d, 0x0a3b7870, 0x20202020,
+    0x6772616d, 0x742d6e69, 0x203a706f, 0x3b787032, 0x2020200a, 0x64617020,
+    0x676e6964, 0x7034203a, 0x200a3b78, 0x74202020, 0x2d747865, 0x67696c61,
+    0x63203a6e, 0x65746e65, 0x200a3b72, 0x74202020, 0x2d747865, 0x6f636564,
+    0x69746172, 0x203a6e6f, 0x656e6f6e, 0x20200a3b, 0x69772020, 0x3a687464,
+    0x30303220, 0x0a3b7870, 0x230a0a7d, 0x756e656d, 0x683a6120, 0x7265766f,
+    0x6d23202c, 0x20756e65, 0x63613a61, 0x65766974, 0x200a7b0a, 0x62202020,
+    0x676b6361, 0x6e756f72, 0x6f632d64, 0x3a726f6c, 0x66622320, 0x30303030,
+    0x0a7d0a3b, 0x202a2f0a, 0x6c797453, 0x20676e69, 0x20726f66, 0x20656874,
+    0x746e6f63, 0x20746e65, 0x2e766964, 0x0a2f2a20, 0x6e6f6323, 0x746e6574,
+    0x200a7b0a, 0x6d202020, 0x69677261, 0x6f622d6e, 0x6d6f7474, 0x3031203a,
+    0x0a3b7870, 0x20202020, 0x6772616d, 0x6c2d6e69, 0x3a746665, 0x35323220,
+    0x0a3b7870, 0x230a0a7d, 0x746e6f63, 0x5f746e65, 0x64616568, 0x0a676e69,
+    0x20200a7b, 0x6f662020, 0x732d746e, 0x3a657a69, 0x352e3120, 0x0a3b6d65,
+    0x20202020, 0x746e6f66, 0x6965772d, 0x3a746867, 0x6c6f6220, 0x200a3b64,
+    0x74202020, 0x2d747865, 0x67696c61, 0x63203a6e, 0x65746e65, 0x7d0a3b72,
+    0x2a2f0a0a, 0x79745320, 0x676e696c, 0x726f6620, 0x65687420, 0x6f6f6620,
+    0x676e6974, 0x76696420, 0x2f2a202e, 0x6f66230a, 0x6e69746f, 0x0a7b0a67,
+    0x20202020, 0x61656c63, 0x62203a72, 0x3b68746f, 0x2020200a, 0x6e6f6620,
+    0x69732d74, 0x203a657a, 0x6535372e, 0x200a3b6d, 0x66202020, 0x2d746e6f,
+    0x6c797473, 0x69203a65, 0x696c6174, 0x200a3b63, 0x74202020, 0x2d747865,
+    0x67696c61, 0x72203a6e, 0x74686769, 0x0a7d0a3b, 0x6f66230a, 0x6e69746f,
+    0x72682067, 0x200a7b0a, 0x62202020, 0x6564726f, 0x6f622d72, 0x6d6f7474,
+    0x7031203a, 0x6f732078, 0x2064696c, 0x30666623, 0x3b303030, 0x2020200a,
+    0x726f6220, 0x2d726564, 0x3a706f74, 0x78703120, 0x6c6f7320, 0x23206469,
+    0x30306666, 0x0a3b3030, 0x2f3c0a7d, 0x6c797473, 0x200a3e65, 0x3c202020,
+    0x6b6e696c, 0x6c657220, 0x6873223d, 0x6374726f, 0x69207475, 0x226e6f63,
+    0x70797420, 0x69223d65, 0x6567616d, 0x692d782f, 0x226e6f63, 0x65726820,
+    0x66223d66, 0x63697661, 0x692e6e6f, 0x2f226f63, 0x20200a3e, 0x733c2020,
+    0x70697263, 0x616c2074, 0x6175676e, 0x223d6567, 0x6176614a, 0x69726353,
+    0x2e317470, 0x0a3e2232, 0x2d2d213c, 0x706f4320, 0x67697279, 0x28207468,
+    0x32202963, 0x2d333130, 0x30323032, 0x78655420, 0x49207361, 0x7274736e,
+    0x6e656d75, 0x49207374, 0x726f636e, 0x61726f70, 0x2e646574, 0x6c412020,
+    0x6972206c, 0x73746867, 0x73657220, 0x65767265, 0x2d202e64, 0x0a0a3e2d,
+    0x646e6977, 0x6f2e776f, 0x616f6c6e, 0x203d2064, 0x636e7566, 0x6e6f6974,
+    0x7b0a2928, 0x2020200a, 0x636f6420, 0x6e656d75, 0x65672e74, 0x656c4574,
+    0x746e656d, 0x64497942, 0x62612728, 0x2774756f, 0x6e6f2e29, 0x63696c63,
+    0x203d206b, 0x64616f6c, 0x756f6241, 0x200a3b74, 0x64202020, 0x6d75636f,
+    0x2e746e65, 0x45746567, 0x656d656c, 0x7942746e, 0x27286449, 0x7265766f,
+    0x77656976, 0x6f2e2927, 0x696c636e, 0x3d206b63, 0x616f6c20, 0x65764f64,
+    0x65697672, 0x200a3b77, 0x64202020, 0x6d75636f, 0x2e746e65, 0x45746567,
+    0x656d656c, 0x7942746e, 0x27286449, 0x636f6c62, 0x2e29276b, 0x6c636e6f,
+    0x206b6369, 0x6f6c203d, 0x6c426461, 0x3b6b636f, 0x20200a0a, 0x6f6c2020,
+    0x61506461, 0x22286567, 0x756f6261, 0x74682e74, 0x3b29226d, 0x0a0a7d0a,
+    0x636e7566, 0x6e6f6974, 0x616f6c20, 0x6f624164, 0x29287475, 0x200a7b0a,
+    0x6c202020, 0x5064616f, 0x28656761, 0x6f626122, 0x682e7475, 0x29226d74,
+    0x20200a3b, 0x65722020, 0x6e727574, 0x6c616620, 0x0a3b6573, 0x660a0a7d,
+    0x74636e75, 0x206e6f69, 0x64616f6c, 0x7265764f, 0x77656976, 0x7b0a2928,
+    0x2020200a, 0x616f6c20, 0x67615064, 0x6f222865, 0x76726576, 0x2e776569,
+    0x226d7468, 0x200a3b29, 0x72202020, 0x72757465, 0x6166206e, 0x3b65736c,
+    0x0a0a7d0a, 0x636e7566, 0x6e6f6974, 0x616f6c20, 0x6f6c4264, 0x29286b63,
+    0x200a7b0a, 0x6c202020, 0x5064616f, 0x28656761, 0x6f6c6222, 0x682e6b63,
+    0x29226d74, 0x20200a3b, 0x65722020, 0x6e727574, 0x6c616620, 0x0a3b6573,
+    0x660a0a7d, 0x74636e75, 0x206e6f69, 0x64616f6c, 0x65676150, 0x67617028,
+    0x7b0a2965, 0x2020200a, 0x28666920, 0x646e6977, 0x582e776f, 0x74484c4d,
+    0x65527074, 0x73657571, 0x200a2974, 0x7b202020, 0x2020200a, 0x20202020,
+    0x6c6d7820, 0x70747468, 0x6e203d20, 0x58207765, 0x74484c4d, 0x65527074,
+    0x73657571, 0x3b292874, 0x2020200a, 0x200a7d20, 0x65202020, 0x0a65736c,
+    0x20202020, 0x20200a7b, 0x20202020, 0x6d782020, 0x7474686c, 0x203d2070,
+    0x2077656e, 0x69746341, 0x4f586576, 0x63656a62, 0x4d222874, 0x6f726369,
+    0x74666f73, 0x4c4d582e, 0x50545448, 0x0a3b2922, 0x20202020, 0x200a0a7d,
+    0x78202020, 0x74686c6d, 0x6f2e7074, 0x286e6570, 0x54454722, 0x70202c22,
+    0x2c656761, 0x75727420, 0x0a3b2965, 0x20202020, 0x686c6d78, 0x2e707474,
+    0x52746573, 0x65757165, 0x65487473, 0x72656461, 0x6f432228, 0x6e65746e,
+    0x79742d74, 0x2c226570, 0x2020200a, 0x20202020, 0x20202020, 0x20202020,
+    0x20202020, 0x20202020, 0x20202020, 0x61222020, 0x696c7070, 0x69746163,
+    0x782f6e6f, 0x7777772d, 0x726f662d, 0x72752d6d, 0x636e656c, 0x6465646f,
+    0x0a3b2922, 0x20202020, 0x686c6d78, 0x2e707474, 0x646e6573, 0x0a3b2928,
+    0x2020200a, 0x6c6d7820, 0x70747468, 0x726e6f2e, 0x79646165, 0x74617473,
+    0x61686365, 0x2065676e, 0x7566203d, 0x6974636e, 0x28206e6f, 0x20200a29,
+    0x0a7b2020, 0x20202020, 0x20202020, 0x28286669, 0x686c6d78, 0x2e707474,
+    0x64616572, 0x61745379, 0x3d206574, 0x2934203d, 0x20262620, 0x6c6d7828,
+    0x70747468, 0x6174732e, 0x20737574, 0x32203d3d, 0x29293030, 0x2020200a,
+    0x20202020, 0x200a7b20, 0x20202020, 0x20202020, 0x64202020, 0x6d75636f,
+    0x2e746e65, 0x45746567, 0x656d656c, 0x7942746e, 0x22286449, 0x746e6f63,
+    0x22746e65, 0x6e692e29, 0x4872656e, 0x204c4d54, 0x6d78203d, 0x7474686c,
+    0x65722e70, 0x6e6f7073, 0x65546573, 0x0a3b7478, 0x20202020, 0x20202020,
+    0x20200a7d, 0x0a7d2020, 0x2f3c0a7d, 0x69726373, 0x0a3e7470, 0x2f3c2020,
+    0x64616568, 0x20200a3e, 0x646f623c, 0x200a3e79, 0x3c202020, 0x20766964,
+    0x223d6469, 0x64616568, 0x22676e69, 0x20200a3e, 0x20202020, 0x6261743c,
+    0x7720656c, 0x68746469, 0x3031223d, 0x3e222530, 0x2020200a, 0x20202020,
+    0x72743c20, 0x20200a3e, 0x20202020, 0x20202020, 0x3e64743c, 0x2020200a,
+    0x20202020, 0x20202020, 0x20613c20, 0x223d6469, 0x64616568, 0x5f676e69,
+    0x20226974, 0x67726174, 0x223d7465, 0x6820225f, 0x3d666572, 0x74746822,
+    0x2f2f3a70, 0x2e777777, 0x632e6974, 0x3e226d6f, 0x2020200a, 0x20202020,
+    0x20202020, 0x3c202020, 0x20676d69, 0x3d637273, 0x2e697422, 0x2267706a,
+    0x746c6120, 0x6554223d, 0x20736178, 0x74736e49, 0x656d7572, 0x2273746e,
+    0x20200a3e, 0x20202020, 0x20202020, 0x2f3c2020, 0x200a3e61, 0x20202020,
+    0x20202020, 0x742f3c20, 0x200a3e64, 0x20202020, 0x20202020, 0x64743c20,
+    0x64697720, 0x223d6874, 0x25303031, 0x200a3e22, 0x20202020, 0x20202020,
+    0x3c202020, 0x20766964, 0x223d6469, 0x64616568, 0x5f676e69, 0x3e223168,
+    0x2020200a, 0x20202020, 0x20202020, 0x54202020, 0x2043344d, 0x69726553,
+    0x54207365, 0x3143344d, 0x58343932, 0x7645204c, 0x61756c61, 0x6e6f6974,
+    0x74694b20, 0x2020200a, 0x20202020, 0x20202020, 0x642f3c20, 0x0a3e7669,
+    0x20202020, 0x20202020, 0x20202020, 0x7669643c, 0x3d646920, 0x61656822,
+    0x676e6964, 0x2232685f, 0x20200a3e, 0x20202020, 0x20202020, 0x20202020,
+    0x542d4b45, 0x3143344d, 0x58343932, 0x20200a4c, 0x20202020, 0x20202020,
+    0x2f3c2020, 0x3e766964, 0x2020200a, 0x20202020, 0x3c202020, 0x3e64742f,
+    0x2020200a, 0x20202020, 0x3c202020, 0x0a3e6474, 0x20202020, 0x20202020,
+    0x20202020, 0x6920613c, 0x68223d64, 0x69646165, 0x745f676e, 0x22617669,
+    0x72617420, 0x3d746567, 0x20225f22, 0x66657268, 0x7468223d, 0x2f3a7074,
+    0x7777772f, 0x2e69742e, 0x2f6d6f63, 0x63346d74, 0x200a3e22, 0x20202020,
+    0x20202020, 0x20202020, 0x6d693c20, 0x72732067, 0x74223d63, 0x2e63346d,
+    0x2267706a, 0x746c6120, 0x4d54223d, 0x3e224334, 0x2020200a, 0x20202020,
+    0x20202020, 0x612f3c20, 0x20200a3e, 0x20202020, 0x20202020, 0x64742f3c,
+    0x20200a3e, 0x20202020, 0x2f3c2020, 0x0a3e7274, 0x20202020, 0x2f3c2020,
+    0x6c626174, 0x200a3e65, 0x20202020, 0x72683c20, 0x72683c3e, 0x20200a3e,
+    0x2f3c2020, 0x3e766964, 0x2020200a, 0x69643c20, 0x64692076, 0x656d223d,
+    0x3e22756e, 0x2020200a, 0x3c202020, 0x0a3e6c75, 0x20202020, 0x20202020,
+    0x3e696c3c, 0x6820613c, 0x3d666572, 0x6f626122, 0x682e7475, 0x20226d74,
+    0x223d6469, 0x756f6261, 0x413e2274, 0x74756f62, 0x3c495420, 0x3c3e612f,
+    0x3e696c2f, 0x2020200a, 0x20202020, 0x696c3c20, 0x20613c3e, 0x66657268,
+    0x766f223d, 0x69767265, 0x682e7765, 0x20226d74, 0x223d6469, 0x7265766f,
+    0x77656976, 0x4d543e22, 0x53204334, 0x65697265, 0x764f2073, 0x69767265,
+    0x2f3c7765, 0x2f3c3e61, 0x0a3e696c, 0x20202020, 0x20202020, 0x3e696c3c,
+    0x6820613c, 0x3d666572, 0x6f6c6222, 0x682e6b63, 0x20226d74, 0x223d6469,
+    0x636f6c62, 0x543e226b, 0x3143344d, 0x4e343932, 0x54445043, 0x6f6c4220,
+    0x44206b63, 0x72676169, 0x2f3c6d61, 0x2f3c3e61, 0x0a3e696c, 0x20202020,
+    0x20202020, 0x3e696c3c, 0x7420613c, 0x65677261, 0x5f223d74, 0x72682022,
+    0x223d6665, 0x70747468, 0x772f2f3a, 0x742e7777, 0x6f632e69, 0x6f742f6d,
+    0x652f6c6f, 0x6d742d6b, 0x32316334, 0x6c783439, 0x4b453e22, 0x344d542d,
+    0x39323143, 0x204c5834, 0x646f7250, 0x20746375, 0x65676150, 0x3e612f3c,
+    0x696c2f3c, 0x20200a3e, 0x20202020, 0x6c3c2020, 0x613c3e69, 0x72617420,
+    0x3d746567, 0x20225f22, 0x66657268, 0x7468223d, 0x2f3a7074, 0x7777772f,
+    0x2e69742e, 0x2f6d6f63, 0x63346d74, 0x4d543e22, 0x53204334, 0x65697265,
+    0x4d542073, 0x32314334, 0x46207839, 0x6c696d61, 0x72502079, 0x6375646f,
+    0x61502074, 0x2f3c6567, 0x2f3c3e61, 0x0a3e696c, 0x20202020, 0x2f3c2020,
+    0x0a3e6c75, 0x20202020, 0x693c2020, 0x7320676d, 0x223d6372, 0x742d6b65,
+    0x3163346d, 0x78343932, 0x706a2e6c, 0x61202267, 0x223d746c, 0x542d4b45,
+    0x3143344d, 0x58343932, 0x0a3e224c, 0x20202020, 0x69642f3c, 0x200a3e76,
+    0x3c202020, 0x20766964, 0x223d6469, 0x746e6f63, 0x22746e65, 0x20200a3e,
+    0x2f3c2020, 0x3e766964, 0x2020200a, 0x69643c20, 0x64692076, 0x6f66223d,
+    0x6e69746f, 0x0a3e2267, 0x20202020, 0x683c2020, 0x683c3e72, 0x200a3e72,
+    0x20202020, 0x706f4320, 0x67697279, 0x26207468, 0x79706f63, 0x3032203b,
+    0x322d3331, 0x20303230, 0x61786554, 0x6e492073, 0x75727473, 0x746e656d,
+    0x6e492073, 0x70726f63, 0x7461726f, 0x202e6465, 0x6c6c4120, 0x67697220,
+    0x20737468, 0x65736572, 0x64657672, 0x20200a2e, 0x2f3c2020, 0x3e766964,
+    0x3c20200a, 0x646f622f, 0x3c0a3e79, 0x6d74682f, 0x000a3e6c, 0x50545448,
+    0x302e312f, 0x30303220, 0x0d4b4f20, 0x7265530a, 0x3a726576, 0x49776c20,
+    0x2e312f50, 0x20312e34, 0x74746828, 0x2f2f3a70, 0x61766173, 0x68616e6e,
+    0x6e6f6e2e, 0x2e756e67, 0x2f67726f, 0x6a6f7270, 0x73746365, 0x69776c2f,
+    0x0a0d2970, 0x746e6f43, 0x2d746e65, 0x676e654c, 0x203a6874, 0x30333131,
+    0x6f430a0d, 0x6e65746e, 0x79542d74, 0x203a6570, 0x6c707061, 0x74616369,
+    0x2f6e6f69, 0x616a2d78, 0x63736176, 0x74706972, 0x54450a0d, 0x203a6761,
+    0x61633922, 0x62313436, 0x66323561, 0x38393432, 0x0a0d2236, 0x68636143,
+    0x6f432d65, 0x6f72746e, 0x6d203a6c, 0x612d7861, 0x363d6567, 0x0a0d3030,
+    0x213c0a0d, 0x43202d2d, 0x7279706f, 0x74686769, 0x29632820, 0x31303220,
+    0x30322d33, 0x54203032, 0x73617865, 0x736e4920, 0x6d757274, 0x73746e65,
+    0x636e4920, 0x6f70726f, 0x65746172, 0x20202e64, 0x206c6c41, 0x68676972,
+    0x72207374, 0x72657365, 0x2e646576, 0x3e2d2d20, 0x69770a0a, 0x776f646e,
+    0x6c6e6f2e, 0x2064616f, 0x7566203d, 0x6974636e, 0x29286e6f, 0x200a7b0a,
+    0x64202020, 0x6d75636f, 0x2e746e65, 0x45746567, 0x656d656c, 0x7942746e,
+    0x27286449, 0x756f6261, 0x2e292774, 0x6c636e6f, 0x206b6369, 0x6f6c203d,
+    0x62416461, 0x3b74756f, 0x2020200a, 0x636f6420, 0x6e656d75, 0x65672e74,
+    0x656c4574, 0x746e656d, 0x64497942, 0x766f2728, 0x69767265, 0x29277765,
+    0x636e6f2e, 0x6b63696c, 0x6c203d20, 0x4f64616f, 0x76726576, 0x3b776569,
+    0x2020200a, 0x636f6420, 0x6e656d75, 0x65672e74, 0x656c4574, 0x746e656d,
+    0x64497942, 0x6c622728, 0x276b636f, 0x6e6f2e29, 0x63696c63, 0x203d206b,
+    0x64616f6c, 0x636f6c42, 0x0a0a3b6b, 0x20202020, 0x64616f6c, 0x65676150,
+    0x62612228, 0x2e74756f, 0x226d7468, 0x7d0a3b29, 0x75660a0a, 0x6974636e,
+    0x6c206e6f, 0x4164616f, 0x74756f62, 0x7b0a2928, 0x2020200a, 0x616f6c20,
+    0x67615064, 0x61222865, 0x74756f62, 0x6d74682e, 0x0a3b2922, 0x20202020,
+    0x75746572, 0x66206e72, 0x65736c61, 0x0a7d0a3b, 0x6e75660a, 0x6f697463,
+    0x6f6c206e, 0x764f6461, 0x69767265, 0x29287765, 0x200a7b0a, 0x6c202020,
+    0x5064616f, 0x28656761, 0x65766f22, 0x65697672, 0x74682e77, 0x3b29226d,
+    0x2020200a, 0x74657220, 0x206e7275, 0x736c6166, 0x7d0a3b65, 0x75660a0a,
+    0x6974636e, 0x6c206e6f, 0x4264616f, 0x6b636f6c, 0x7b0a2928, 0x2020200a,
+    0x616f6c20, 0x67615064, 0x62222865, 0x6b636f6c, 0x6d74682e, 0x0a3b2922,
+    0x20202020, 0x75746572, 0x66206e72, 0x65736c61, 0x0a7d0a3b, 0x6e75660a,
+    0x6f697463, 0x6f6c206e, 0x61506461, 0x70286567, 0x29656761, 0x200a7b0a,
+    0x69202020, 0x69772866, 0x776f646e, 0x4c4d582e, 0x70747448, 0x75716552,
+    0x29747365, 0x2020200a, 0x200a7b20, 0x20202020, 0x78202020, 0x74686c6d,
+    0x3d207074, 0x77656e20, 0x4c4d5820, 0x70747448, 0x75716552, 0x28747365,
+    0x200a3b29, 0x7d202020, 0x2020200a, 0x736c6520, 0x20200a65, 0x0a7b2020,
+    0x20202020, 0x20202020, 0x686c6d78, 0x20707474, 0x656e203d, 0x63412077,
+    0x65766974, 0x6a624f58, 0x28746365, 0x63694d22, 0x6f736f72, 0x582e7466,
+    0x54484c4d, 0x29225054, 0x20200a3b, 0x0a7d2020, 0x2020200a, 0x6c6d7820,
+    0x70747468, 0x65706f2e, 0x4722286e, 0x2c225445, 0x67617020, 0x74202c65,
+    0x29657572, 0x20200a3b, 0x6d782020, 0x7474686c, 0x65732e70, 0x71655274,
+    0x74736575, 0x64616548, 0x22287265, 0x746e6f43, 0x2d746e65, 0x65707974,
+    0x200a2c22, 0x20202020, 0x20202020, 0x20202020, 0x20202020, 0x20202020,
+    0x20202020, 0x20202020, 0x70706122, 0x6163696c, 0x6e6f6974, 0x772d782f,
+    0x662d7777, 0x2d6d726f, 0x656c7275, 0x646f636e, 0x29226465, 0x20200a3b,
+    0x6d782020, 0x7474686c, 0x65732e70, 0x2928646e, 0x200a0a3b, 0x78202020,
+    0x74686c6d, 0x6f2e7074, 0x6165726e, 0x74737964, 0x63657461, 0x676e6168,
+    0x203d2065, 0x636e7566, 0x6e6f6974, 0x0a292820, 0x20202020, 0x20200a7b,
+    0x20202020, 0x66692020, 0x6d782828, 0x7474686c, 0x65722e70, 0x53796461,
+    0x65746174, 0x203d3d20, 0x26202934, 0x78282026, 0x74686c6d, 0x732e7074,
+    0x75746174, 0x3d3d2073, 0x30303220, 0x200a2929, 0x20202020, 0x7b202020,
+    0x2020200a, 0x20202020, 0x20202020, 0x636f6420, 0x6e656d75, 0x65672e74,
+    0x656c4574, 0x746e656d, 0x64497942, 0x6f632228, 0x6e65746e, 0x2e292274,
+    0x656e6e69, 0x4d544872, 0x203d204c, 0x686c6d78, 0x2e707474, 0x70736572,
+    0x65736e6f, 0x74786554, 0x20200a3b, 0x20202020, 0x0a7d2020, 0x20202020,
+    0x0a7d0a7d, 0x50545448, 0x302e312f, 0x30303220, 0x0d4b4f20, 0x7265530a,
+    0x3a726576, 0x49776c20, 0x2e312f50, 0x20312e34, 0x74746828, 0x2f2f3a70,
+    0x61766173, 0x68616e6e, 0x6e6f6e2e, 0x2e756e67, 0x2f67726f, 0x6a6f7270,
+    0x73746365, 0x69776c2f, 0x0a0d2970, 0x746e6f43, 0x2d746e65, 0x676e654c,
+    0x203a6874, 0x34353932, 0x6f430a0d, 0x6e65746e, 0x79542d74, 0x203a6570,
+    0x74786574, 0x6d74682f, 0x450a0d6c, 0x3a676154, 0x39342220, 0x63393938,
+    0x36313133, 0x61373837, 0x0d226266, 0x6361430a, 0x432d6568, 0x72746e6f,
+    0x203a6c6f, 0x2d78616d, 0x3d656761, 0x0d303036, 0x3c0a0d0a, 0x434f4421,
+    0x45505954, 0x4d544820, 0x3c0a3e4c, 0x202d2d21, 0x79706f43, 0x68676972,
+    0x63282074, 0x30322029, 0x322d3331, 0x20303230, 0x61786554, 0x6e492073,
+    0x75727473, 0x746e656d, 0x6e492073, 0x70726f63, 0x7461726f, 0x202e6465,
+    0x6c6c4120, 0x67697220, 0x20737468, 0x65736572, 0x64657672, 0x2d2d202e,
+    0x683c0a3e, 0x3e6c6d74, 0x65683c0a, 0x0a3e6461, 0x7469743c, 0x453e656c,
+    0x4d542d4b, 0x32314334, 0x4c583439, 0x61764520, 0x7461756c, 0x206e6f69,
+    0x3c74694b, 0x7469742f, 0x0a3e656c, 0x7974733c, 0x7420656c, 0x3d657079,
+    0x78657422, 0x73632f74, 0x0a3e2273, 0x43202a2f, 0x7279706f, 0x74686769,
+    0x29632820, 0x31303220, 0x30322d33, 0x54203032, 0x73617865, 0x736e4920,
+    0x6d757274, 0x73746e65, 0x636e4920, 0x6f70726f, 0x65746172, 0x20202e64,
+    0x206c6c41, 0x68676972, 0x72207374, 0x72657365, 0x2e646576, 0x0a2f2a20,
+    0x202a2f0a, 0x6c797453, 0x20676e69, 0x20726f66, 0x20656874, 0x69746e65,
+    0x64206572, 0x6d75636f, 0x2e746e65, 0x0a2f2a20, 0x79646f62, 0x200a7b0a,
+    0x62202020, 0x676b6361, 0x6e756f72, 0x6f632d64, 0x3a726f6c, 0x69687720,
+    0x0a3b6574, 0x20202020, 0x6f6c6f63, 0x62203a72, 0x6b63616c, 0x20200a3b,
+    0x6f662020, 0x662d746e, 0x6c696d61, 0x41203a79, 0x6c656972, 0x6c65482c,
+    0x69746576, 0x732c6163, 0x2d736e61, 0x69726573, 0x7d0a3b66, 0x2a2f0a0a,
+    0x79745320, 0x676e696c, 0x726f6620, 0x65687420, 0x61656820, 0x676e6964,
+    0x76696420, 0x2f2a202e, 0x6568230a, 0x6e696461, 0x0a7b0a67, 0x20202020,
+    0x61656c63, 0x62203a72, 0x3b68746f, 0x2020200a, 0x72616d20, 0x2d6e6967,
+    0x74746f62, 0x203a6d6f, 0x78703031, 0x0a7d0a3b, 0x6568230a, 0x6e696461,
+    0x31685f67, 0x200a7b0a, 0x66202020, 0x2d746e6f, 0x657a6973, 0x6532203a,
+    0x200a3b6d, 0x66202020, 0x2d746e6f, 0x67696577, 0x203a7468, 0x646c6f62,
+    0x20200a3b, 0x65742020, 0x612d7478, 0x6e67696c, 0x6563203a, 0x7265746e,
+    0x0a7d0a3b, 0x6568230a, 0x6e696461, 0x32685f67, 0x200a7b0a, 0x66202020,
+    0x2d746e6f, 0x657a6973, 0x2e31203a, 0x6d653532, 0x20200a3b, 0x6f662020,
+    0x772d746e, 0x68676965, 0x62203a74, 0x3b646c6f, 0x2020200a, 0x78657420,
+    0x6c612d74, 0x3a6e6769, 0x6e656320, 0x3b726574, 0x0a0a7d0a, 0x61656823,
+    0x676e6964, 0x0a726820, 0x20200a7b, 0x6f622020, 0x72656472, 0x746f622d,
+    0x3a6d6f74, 0x78703120, 0x6c6f7320, 0x23206469, 0x30306666, 0x0a3b3030,
+    0x20202020, 0x64726f62, 0x742d7265, 0x203a706f, 0x20787031, 0x696c6f73,
+    0x66232064, 0x30303066, 0x7d0a3b30, 0x68230a0a, 0x69646165, 0x6120676e,
+    0x676d6920, 0x200a7b0a, 0x62202020, 0x6564726f, 0x30203a72, 0x0a7d0a3b,
+    0x202a2f0a, 0x6c797453, 0x20676e69, 0x20726f66, 0x20656874, 0x756e656d,
+    0x76696420, 0x2f2a202e, 0x656d230a, 0x7b0a756e, 0x2020200a, 0x6f6c6620,
+    0x203a7461, 0x7466656c, 0x20200a3b, 0x616d2020, 0x6e696772, 0x746f622d,
+    0x3a6d6f74, 0x70303120, 0x200a3b78, 0x77202020, 0x68746469, 0x3232203a,
+    0x3b787035, 0x0a0a7d0a, 0x6e656d23, 0x6c752075, 0x200a7b0a, 0x6c202020,
+    0x2d747369, 0x6c797473, 0x79742d65, 0x203a6570, 0x656e6f6e, 0x20200a3b,
+    0x616d2020, 0x6e696772, 0x3b30203a, 0x2020200a, 0x64617020, 0x676e6964,
+    0x3b30203a, 0x0a0a7d0a, 0x6e656d23, 0x3a612075, 0x6b6e696c, 0x6d23202c,
+    0x20756e65, 0x69763a61, 0x65746973, 0x0a7b0a64, 0x20202020, 0x6b636162,
+    0x756f7267, 0x632d646e, 0x726f6c6f, 0x6623203a, 0x30303066, 0x200a3b30,
+    0x63202020, 0x726f6c6f, 0x6623203a, 0x66666666, 0x200a3b66, 0x64202020,
+    0x6c707369, 0x203a7961, 0x636f6c62, 0x200a3b6b, 0x66202020, 0x2d746e6f,
+    0x67696577, 0x203a7468, 0x646c6f62, 0x20200a3b, 0x616d2020, 0x6e696772,
+    0x746f622d, 0x3a6d6f74, 0x78703220, 0x20200a3b, 0x616d2020, 0x6e696772,
+    0x706f742d, 0x7032203a, 0x200a3b78, 0x70202020, 0x69646461, 0x203a676e,
+    0x3b787034, 0x2020200a, 0x78657420, 0x6c612d74, 0x3a6e6769, 0x6e656320,
+    0x3b726574, 0x2020200a, 0x78657420, 0x65642d74, 0x61726f63, 0x6e6f6974,
+    0x6f6e203a, 0x0a3b656e, 0x20202020, 0x74646977, 0x32203a68, 0x78703030,
+    0x0a7d0a3b, 0x656d230a, 0x6120756e, 0x766f683a, 0x202c7265, 0x6e656d23,
+    0x3a612075, 0x69746361, 0x7b0a6576, 0x2020200a, 0x63616220, 0x6f72676b,
+    0x2d646e75, 0x6f6c6f63, 0x23203a72, 0x30306662, 0x0a3b3030, 0x2f0a0a7d,
+    0x7453202a, 0x6e696c79, 0x6f662067, 0x68742072, 0x6f632065, 0x6e65746e,
+    0x69642074, 0x2a202e76, 0x63230a2f, 0x65746e6f, 0x7b0a746e, 0x2020200a,
+    0x72616d20, 0x2d6e6967, 0x74746f62, 0x203a6d6f, 0x78703031, 0x20200a3b,
+    0x616d2020, 0x6e696772, 0x66656c2d, 0x32203a74, 0x78703532, 0x0a7d0a3b,
+    0x6f63230a, 0x6e65746e, 0x65685f74, 0x6e696461, 0x0a7b0a67, 0x20202020,
+    0x746e6f66, 0x7a69732d, 0x31203a65, 0x6d65352e, 0x20200a3b, 0x6f662020,
+    0x772d746e, 0x68676965, 0x62203a74, 0x3b646c6f, 0x2020200a, 0x78657420,
+    0x6c612d74, 0x3a6e6769, 0x6e656320, 0x3b726574, 0x0a0a7d0a, 0x53202a2f,
+    0x696c7974, 0x6620676e, 0x7420726f, 0x66206568, 0x69746f6f, 0x6420676e,
+    0x202e7669, 0x230a2f2a, 0x746f6f66, 0x0a676e69, 0x20200a7b, 0x6c632020,
+    0x3a726165, 0x746f6220, 0x200a3b68, 0x66202020, 0x2d746e6f, 0x657a6973,
+    0x372e203a, 0x3b6d6535, 0x2020200a, 0x6e6f6620, 0x74732d74, 0x3a656c79,
+    0x61746920, 0x3b63696c, 0x2020200a, 0x78657420, 0x6c612d74, 0x3a6e6769,
+    0x67697220, 0x0a3b7468, 0x230a0a7d, 0x746f6f66, 0x20676e69, 0x7b0a7268,
+    0x2020200a, 0x726f6220, 0x2d726564, 0x74746f62, 0x203a6d6f, 0x20787031,
+    0x696c6f73, 0x66232064, 0x30303066, 0x200a3b30, 0x62202020, 0x6564726f,
+    0x6f742d72, 0x31203a70, 0x73207870, 0x64696c6f, 0x66662320, 0x30303030,
+    0x0a7d0a3b, 0x74732f3c, 0x3e656c79, 0x696c3c0a, 0x72206b6e, 0x223d6c65,
+    0x726f6873, 0x74756374, 0x6f636920, 0x7420226e, 0x3d657079, 0x616d6922,
+    0x782f6567, 0x6f63692d, 0x6820226e, 0x3d666572, 0x76616622, 0x6e6f6369,
+    0x6f63692e, 0x0a3e2f22, 0x65682f3c, 0x0a3e6461, 0x646f623c, 0x3c0a3e79,
+    0x64692070, 0x6f63223d, 0x6e65746e, 0x65685f74, 0x6e696461, 0x543e2267,
+    0x2043344d, 0x69726553, 0x50207365, 0x75646f72, 0x4c207463, 0x3c656e69,
+    0x0a3e702f, 0x3e72683c, 0x72623c0a, 0x73410a3e, 0x65687420, 0x72696620,
+    0x41207473, 0x72264d52, 0x203b6765, 0x74726f43, 0x74267865, 0x65646172,
+    0x344d2d3b, 0x63696d20, 0x6f636f72, 0x6f72746e, 0x72656c6c, 0x4d282073,
+    0x29735543, 0x206f7420, 0x690a6562, 0x656c706d, 0x746e656d, 0x6f206465,
+    0x4954206e, 0x70207327, 0x72706f72, 0x61746569, 0x36207972, 0x6d6e2d35,
+    0x6f727020, 0x73736563, 0x63657420, 0x6c6f6e68, 0x2c79676f, 0x65687420,
+    0x344d5420, 0x65532043, 0x73656972, 0x6f72700a, 0x65646976, 0x75632073,
+    0x6d6f7473, 0x20737265, 0x6f206e61, 0x726f7070, 0x696e7574, 0x74207974,
+    0x6e69206f, 0x61657263, 0x74206573, 0x72696568, 0x6e6f6320, 0x7463656e,
+    0x74697669, 0x6e692079, 0x72676574, 0x6f697461, 0x69770a6e, 0x756f6874,
+    0x61732074, 0x66697263, 0x6e696369, 0x72702067, 0x2c656369, 0x72657020,
+    0x6d726f66, 0x65636e61, 0x726f202c, 0x776f7020, 0x63207265, 0x75736e6f,
+    0x6974706d, 0x202e6e6f, 0x72657645, 0x4d542079, 0x53204334, 0x65697265,
+    0x434d0a73, 0x6e692055, 0x72676574, 0x73657461, 0x66206120, 0x74616f6c,
+    0x2d676e69, 0x6e696f70, 0x6f632074, 0x61206572, 0x6820646e, 0x2d686769,
+    0x66726570, 0x616d726f, 0x2065636e, 0x6c616e61, 0x7720676f, 0x656c6968,
+    0x69747320, 0x700a6c6c, 0x69766f72, 0x676e6964, 0x776f6c20, 0x776f702d,
+    0x6d207265, 0x7365646f, 0x206f7420, 0x6566666f, 0x20612072, 0x61657267,
+    0x65732074, 0x666f2074, 0x6e756620, 0x6f697463, 0x206c616e, 0x6974706f,
+    0x2e736e6f, 0x646f5420, 0x73277961, 0x676e650a, 0x65656e69, 0x75207372,
+    0x7265646e, 0x6e617473, 0x68742064, 0x64207461, 0x67697365, 0x7220736e,
+    0x69757165, 0x6d206572, 0x2065726f, 0x6e616874, 0x72616820, 0x72617764,
+    0x6c612065, 0x2e656e6f, 0x74664f20, 0x202c6e65, 0x0a656874, 0x61657267,
+    0x74736574, 0x61686320, 0x6e656c6c, 0x69206567, 0x6f732073, 0x61777466,
+    0x61206572, 0x3c0a646e, 0x61742061, 0x74656772, 0x225f223d, 0x65726820,
+    0x68223d66, 0x3a707474, 0x77772f2f, 0x69742e77, 0x6d6f632e, 0x7669742f,
+    0x72617761, 0x543e2265, 0x57617669, 0x20657261, 0x20726f66, 0x65532043,
+    0x73656972, 0x3e612f3c, 0x20736920, 0x72660a61, 0x6c206565, 0x61726269,
+    0x6f207972, 0x20432066, 0x656c6966, 0x68742073, 0x69207461, 0x756c636e,
+    0x62206564, 0x2068746f, 0x69726570, 0x72656870, 0x6c2d6c61, 0x6c657665,
+    0x646e6120, 0x7070610a, 0x6163696c, 0x6e6f6974, 0x76656c2d, 0x63206c65,
+    0x2065646f, 0x73206e69, 0x6372756f, 0x6e612065, 0x6e692064, 0x4d4f5220,
+    0x726f6620, 0x65766520, 0x54207972, 0x2043344d, 0x69726553, 0x4d207365,
+    0x202e5543, 0x73696854, 0x66666f0a, 0x6e697265, 0x65642067, 0x6576696c,
+    0x55207372, 0x202c4253, 0x2c4e4143, 0x61726720, 0x63696870, 0x61202c73,
+    0x7320646e, 0x6f736e65, 0x70612072, 0x63696c70, 0x6f697461, 0x696c206e,
+    0x72617262, 0x20736569, 0x630a6f73, 0x6f747375, 0x7372656d, 0x6e616320,
+    0x636f6620, 0x74207375, 0x72696568, 0x66666520, 0x7374726f, 0x206e6f20,
+    0x6c697562, 0x676e6964, 0x70706120, 0x6163696c, 0x6e6f6974, 0x6e692073,
+    0x61657473, 0x666f2064, 0x6f72700a, 0x6d617267, 0x676e696d, 0x65687420,
+    0x63207269, 0x656e6e6f, 0x76697463, 0x20797469, 0x69726570, 0x72656870,
+    0x2e736c61, 0x65685420, 0x344d5420, 0x65532043, 0x73656972, 0x6f727020,
+    0x65646976, 0x6e612073, 0x6378650a, 0x656c6c65, 0x6220746e, 0x6c657361,
+    0x20656e69, 0x20726f66, 0x656d6f68, 0x7562202c, 0x69646c69, 0x202c676e,
+    0x20646e61, 0x75646e69, 0x69727473, 0x61206c61, 0x696c7070, 0x69746163,
+    0x2e736e6f, 0x622f3c0a, 0x3e79646f, 0x682f3c0a, 0x3e6c6d74, 0x0000000a,
+    0x50545448, 0x302e312f, 0x30303220, 0x0d4b4f20, 0x7265530a, 0x3a726576,
+    0x49776c20, 0x2e312f50, 0x20312e34, 0x74746828, 0x2f2f3a70, 0x61766173,
+    0x68616e6e, 0x6e6f6e2e, 0x2e756e67, 0x2f67726f, 0x6a6f7270, 0x73746365,
+    0x69776c2f, 0x0a0d2970, 0x746e6f43, 0x2d746e65, 0x676e654c, 0x203a6874,
+    0x38323531, 0x6f430a0d, 0x6e65746e, 0x79542d74, 0x203a6570, 0x74786574,
+    0x7373632f, 0x54450a0d, 0x203a6761, 0x32376222, 0x61383038, 0x33356637,
+    0x61643936, 0x0a0d2235, 0x68636143, 0x6f432d65, 0x6f72746e, 0x6d203a6c,
+    0x612d7861, 0x363d6567, 0x0a0d3030, 0x2a2f0a0d, 0x706f4320, 0x67697279,
+    0x28207468, 0x32202963, 0x2d333130, 0x30323032, 0x78655420, 0x49207361,
+    0x7274736e, 0x6e656d75, 0x49207374, 0x726f636e, 0x61726f70, 0x2e646574,
+    0x6c412020, 0x6972206c, 0x73746867, 0x73657220, 0x65767265, 0x2a202e64,
+    0x2f0a0a2f, 0x7453202a, 0x6e696c79, 0x6f662067, 0x68742072, 0x6e652065,
+    0x65726974, 0x636f6420, 0x6e656d75, 0x2a202e74, 0x6f620a2f, 0x7b0a7964,
+    0x2020200a, 0x63616220, 0x6f72676b, 0x2d646e75, 0x6f6c6f63, 0x77203a72,
+    0x65746968, 0x20200a3b, 0x6f632020, 0x3a726f6c, 0x616c6220, 0x0a3b6b63,
+    0x20202020, 0x746e6f66, 0x6d61662d, 0x3a796c69, 0x69724120, 0x482c6c65,
+    0x65766c65, 0x61636974, 0x6e61732c, 0x65732d73, 0x3b666972, 0x0a0a7d0a,
+    0x53202a2f, 0x696c7974, 0x6620676e, 0x7420726f, 0x68206568, 0x69646165,
+    0x6420676e, 0x202e7669, 0x230a2f2a, 0x64616568, 0x0a676e69, 0x20200a7b,
+    0x6c632020, 0x3a726165, 0x746f6220, 0x200a3b68, 0x6d202020, 0x69677261,
+    0x6f622d6e, 0x6d6f7474, 0x3031203a, 0x0a3b7870, 0x230a0a7d, 0x64616568,
+    0x5f676e69, 0x7b0a3168, 0x2020200a, 0x6e6f6620, 0x69732d74, 0x203a657a,
+    0x3b6d6532, 0x2020200a, 0x6e6f6620, 0x65772d74, 0x74686769, 0x6f62203a,
+    0x0a3b646c, 0x20202020, 0x74786574, 0x696c612d, 0x203a6e67, 0x746e6563,
+    0x0a3b7265, 0x230a0a7d, 0x64616568, 0x5f676e69, 0x7b0a3268, 0x2020200a,
+    0x6e6f6620, 0x69732d74, 0x203a657a, 0x35322e31, 0x0a3b6d65, 0x20202020,
+    0x746e6f66, 0x6965772d, 0x3a746867, 0x6c6f6220, 0x200a3b64, 0x74202020,
+    0x2d747865, 0x67696c61, 0x63203a6e, 0x65746e65, 0x7d0a3b72, 0x68230a0a,
+    0x69646165, 0x6820676e, 0x0a7b0a72, 0x20202020, 0x64726f62, 0x622d7265,
+    0x6f74746f, 0x31203a6d, 0x73207870, 0x64696c6f, 0x66662320, 0x30303030,
+    0x20200a3b, 0x6f622020, 0x72656472, 0x706f742d, 0x7031203a, 0x6f732078,
+    0x2064696c, 0x30666623, 0x3b303030, 0x0a0a7d0a, 0x61656823, 0x676e6964,
+    0x69206120, 0x7b0a676d, 0x2020200a, 0x726f6220, 0x3a726564, 0x0a3b3020,
+    0x2f0a0a7d, 0x7453202a, 0x6e696c79, 0x6f662067, 0x68742072, 0x656d2065,
+    0x6420756e, 0x202e7669, 0x230a2f2a, 0x756e656d, 0x200a7b0a, 0x66202020,
+    0x74616f6c, 0x656c203a, 0x0a3b7466, 0x20202020, 0x6772616d, 0x622d6e69,
+    0x6f74746f, 0x31203a6d, 0x3b787030, 0x2020200a, 0x64697720, 0x203a6874,
+    0x70353232, 0x7d0a3b78, 0x6d230a0a, 0x20756e65, 0x7b0a6c75, 0x2020200a,
+    0x73696c20, 0x74732d74, 0x2d656c79, 0x65707974, 0x6f6e203a, 0x0a3b656e,
+    0x20202020, 0x6772616d, 0x203a6e69, 0x200a3b30, 0x70202020, 0x69646461,
+    0x203a676e, 0x7d0a3b30, 0x6d230a0a, 0x20756e65, 0x696c3a61, 0x202c6b6e,
+    0x6e656d23, 0x3a612075, 0x69736976, 0x0a646574, 0x20200a7b, 0x61622020,
+    0x72676b63, 0x646e756f, 0x6c6f632d, 0x203a726f, 0x30666623, 0x3b303030,
+    0x2020200a, 0x6c6f6320, 0x203a726f, 0x66666623, 0x3b666666, 0x2020200a,
+    0x73696420, 0x79616c70, 0x6c62203a, 0x3b6b636f, 0x2020200a, 0x6e6f6620,
+    0x65772d74, 0x74686769, 0x6f62203a, 0x0a3b646c, 0x20202020, 0x6772616d,
+    0x622d6e69, 0x6f74746f, 0x32203a6d, 0x0a3b7870, 0x20202020, 0x6772616d,
+    0x742d6e69, 0x203a706f, 0x3b787032, 0x2020200a, 0x64617020, 0x676e6964,
+    0x7034203a, 0x200a3b78, 0x74202020, 0x2d747865, 0x67696c61, 0x63203a6e,
+    0x65746e65, 0x200a3b72, 0x74202020, 0x2d747865, 0x6f636564, 0x69746172,
+    0x203a6e6f, 0x656e6f6e, 0x20200a3b, 0x69772020, 0x3a687464, 0x30303220,
+    0x0a3b7870, 0x230a0a7d, 0x756e656d, 0x683a6120, 0x7265766f, 0x6d23202c,
+    0x20756e65, 0x63613a61, 0x65766974, 0x200a7b0a, 0x62202020, 0x676b6361,
+    0x6e756f72, 0x6f632d64, 0x3a726f6c, 0x66622320, 0x30303030, 0x0a7d0a3b,
+    0x202a2f0a, 0x6c797453, 0x20676e69, 0x20726f66, 0x20656874, 0x746e6f63,
+    0x20746e65, 0x2e766964, 0x0a2f2a20, 0x6e6f6323, 0x746e6574, 0x200a7b0a,
+    0x6d202020, 0x69677261, 0x6f622d6e, 0x6d6f7474, 0x3031203a, 0x0a3b7870,
+    0x20202020, 0x6772616d, 0x6c2d6e69, 0x3a746665, 0x35323220, 0x0a3b7870,
+    0x230a0a7d, 0x746e6f63, 0x5f746e65, 0x64616568, 0x0a676e69, 0x20200a7b,
+    0x6f662020, 0x732d746e, 0x3a657a69, 0x352e3120, 0x0a3b6d65, 0x20202020,
+    0x746e6f66, 0x6965772d, 0x3a746867, 0x6c6f6220, 0x200a3b64, 0x74202020,
+    0x2d747865, 0x67696c61, 0x63203a6e, 0x65746e65, 0x7d0a3b72, 0x2a2f0a0a,
+    0x79745320, 0x676e696c, 0x726f6620, 0x65687420, 0x6f6f6620, 0x676e6974,
+    0x76696420, 0x2f2a202e, 0x6f66230a, 0x6e69746f, 0x0a7b0a67, 0x20202020,
+    0x61656c63, 0x62203a72, 0x3b68746f, 0x2020200a, 0x6e6f6620, 0x69732d74,
+    0x203a657a, 0x6535372e, 0x200a3b6d, 0x66202020, 0x2d746e6f, 0x6c797473,
+    0x69203a65, 0x696c6174, 0x200a3b63, 0x74202020, 0x2d747865, 0x67696c61,
+    0x72203a6e, 0x74686769, 0x0a7d0a3b, 0x6f66230a, 0x6e69746f, 0x72682067,
+    0x200a7b0a, 0x62202020, 0x6564726f, 0x6f622d72, 0x6d6f7474, 0x7031203a,
+    0x6f732078, 0x2064696c, 0x30666623, 0x3b303030, 0x2020200a, 0x726f6220,
+    0x2d726564, 0x3a706f74, 0x78703120, 0x6c6f7320, 0x23206469, 0x30306666,
+    0x0a3b3030, 0x00000a7d, 0x50545448, 0x302e312f, 0x30303220, 0x0d4b4f20,
+    0x7265530a, 0x3a726576, 0x49776c20, 0x2e312f50, 0x20312e34, 0x74746828,
+    0x2f2f3a70, 0x61766173, 0x68616e6e, 0x6e6f6e2e, 0x2e756e67, 0x2f67726f,
+    0x6a6f7270, 0x73746365, 0x69776c2f, 0x0a0d2970, 0x746e6f43, 0x2d746e65,
+    0x676e654c, 0x203a6874, 0x36353137, 0x6f430a0d, 0x6e65746e, 0x79542d74,
+    0x203a6570, 0x67616d69, 0x706a2f65, 0x0a0d6765, 0x67615445, 0x3022203a,
+    0x61616136, 0x31326138, 0x39373136, 0x22366132, 0x61430a0d, 0x2d656863,
+    0x746e6f43, 0x3a6c6f72, 0x78616d20, 0x6567612d, 0x3436383d, 0x0a0d3030,
+    0xd8ff0a0d, 0x1000e0ff, 0x4649464a, 0x01010100, 0x48004800, 0xdbff0000,
+    0x03004300, 0x02030202, 0x03030302, 0x03030403, 0x05080504, 0x05040405,
+    0x0607070a, 0x0c0a0c08, 0x0b0a0b0c, 0x120e0d0b, 0x110e0d10, 0x100b0b0e,
+    0x13111016, 0x15151514, 0x18170f0c, 0x12181416, 0xff141514, 0x014300db,
+    0x05040403, 0x05090504, 0x0d140905, 0x14140d0b, 0x14141414, 0x14141414,
+    0x14141414, 0x14141414, 0x14141414, 0x14141414, 0x14141414, 0x14141414,
+    0x14141414, 0x14141414, 0x14141414, 0x14141414, 0x1100c2ff, 0x014b0008,
+    0x11010316, 0x01110200, 0xff011103, 0x001c00c4, 0x02020001, 0x00000103,
+    0x00000000, 0x00000000, 0x05070600, 0x04020108, 0x00c4ff03, 0x0001011c,
+    0x01010501, 0x00000000, 0x00000000, 0x05000000, 0x04030201, 0xff080706,
+    0x030c00da, 0x10020001, 0x00001003, 0x6290da01, 0xea80daec, 0xf0bcb274,
+    0x5cf14c92, 0x0000d8ab, 0x00000000, 0x00000000, 0xe8d60b01, 0xf69d6335,
+    0xcd67c29b, 0x476b2d7d, 0xd7f5917f, 0x7eebda0f, 0xf6b15327, 0x00000000,
+    0x00000000, 0xbd90020e, 0xe759fd79, 0xb967b23d, 0xe932e4cd, 0xc9c8b0e1,
+    0x646c4533, 0x355494cf, 0x9196bcae, 0x4c863335, 0xd82319f2, 0x63118f60,
+    0x00000000, 0xcd160600, 0xd22332ca, 0xc16e9631, 0x86adba74, 0xff3af29a,
+    0xf9a95300, 0x5e6b2cd3, 0x3f7a6d5f, 0xdd56f40d, 0xb0272647, 0x36508db3,
+    0xd948ada4, 0xc5e6248f, 0x00000000, 0xb4550700, 0x53a35f74, 0xc58d5e11,
+    0xf1ee6269, 0xefead6bc, 0x75ebb043, 0xf9a52f37, 0x0d76dff7, 0x65745636,
+    0x3116698f, 0xcbaf6406, 0xb80dad80, 0x0000e03e, 0xe1010000, 0x1d3f2db3,
+    0xc3eefadd, 0xed9d64f0, 0x57443473, 0x7eb25da6, 0xe7da3777, 0xf197bec6,
+    0x3b3839c8, 0x3977001c, 0x00000000, 0x9dc20100, 0x73a67629, 0xc580e1de,
+    0x1f7db82d, 0x6ab26481, 0x33470df2, 0x06579025, 0x69959054, 0x9931156c,
+    0x51181b3b, 0x48b45424, 0x122e0de9, 0x18f32e86, 0xe0f8a456, 0x017089b4,
+    0x5a09de48, 0xd8bc3772, 0xfa318f29, 0x1c35d0d6, 0xc9f8cab3, 0x472e331f,
+    0xd034998d, 0x665319ce, 0x128104ca, 0x26572ca3, 0x8dc290c4, 0xd3d70037,
+    0x932c0a60, 0x0000c097, 0x9248c101, 0x532bc912, 0x71c84d08, 0xd4f11566,
+    0x6ea298fa, 0x18864e7c, 0xde33128d, 0x58b98f4a, 0x135d0196, 0x000058f2,
+    0x00000000, 0x00000000, 0xff010000, 0x102b00c4, 0x02040100, 0x06060101,
+    0x00000003, 0x00000000, 0x04030205, 0x00070106, 0x12111013, 0x14403736,
+    0x31301715, 0x50201634, 0x0800daff, 0x01000101, 0x26ec0205, 0xfe70b141,
+    0x53e08da1, 0xbfa7cef1, 0x1ff7f798, 0xaf5cf32e, 0x24d46a09, 0xfc513289,
+    0x894b9811, 0x50a77856, 0x7c43fc9c, 0x7d56a84b, 0xbccbc7cd, 0x24918aad,
+    0x7bc9399b, 0x7212859d, 0xe49c814e, 0x68eb24e7, 0xb12e4825, 0xc0281b0f,
+    0xf8593410, 0x0f7c21da, 0x22b0465e, 0x668568bf, 0x19c27568, 0x90ec4742,
+    0x1903316b, 0xdb79788a, 0xc2f3ca98, 0xcb0be2af, 0x909ee5fb, 0x24a8efc0,
+    0x38e346b8, 0x3b003e9c, 0x7e690013, 0xcfdba706, 0x85c06932, 0x2e8b1c54,
+    0xbee39a75, 0x2faf6eb6, 0x3ab4bd0c, 0x297400bb, 0x7e3a55a1, 0x045539b1,
+    0xa12511c8, 0xd472ef26, 0x69025764, 0x6f52c9f7, 0x7a1db610, 0x5dd837cd,
+    0xdfb08deb, 0x3d2ac460, 0x63570c4e, 0xa78c33d5, 0x7cfa833c, 0xed7c8c70,
+    0xb721cdad, 0x81d88684, 0x88fa03e2, 0x552322c3, 0x50a59d22, 0x161ad9ef,
+    0x788c519b, 0xa388c849, 0xa8d8dbde, 0xecda3a83, 0x51f6cc1b, 0xccef67d3,
+    0xa1b1898a, 0x75a2dceb, 0x0319abb2, 0xf03156ea, 0x2bce2a85, 0x550e1809,
+    0x80da6896, 0x31c6fce1, 0xabf0678c, 0x7c5a24c1, 0x683ace18, 0xf01c4de7,
+    0x8ea6bb27, 0x3c4f2961, 0x093ccf09, 0x8f124aee, 0x6961a466, 0x82500ab0,
+    0xe0aa236d, 0x878e4de8, 0x9badefda, 0xa7816126, 0x6ee696e9, 0xa7d88522,
+    0x82d7aa09, 0xc00db04f, 0x07982cab, 0xe026707e, 0xe4c202d0, 0x7073bed0,
+    0xd5cc67e3, 0xcee5e52e, 0x6311666f, 0xf4b43eac, 0x5ff71ac2, 0x61b349db,
+    0x0e2507d9, 0x96dfac1d, 0x061f0d78, 0x8206922d, 0xcbc42828, 0x96d5ba49,
+    0x68056dc8, 0x3717c4f0, 0x4f4c5e0c, 0x629c16bb, 0x7e25048a, 0x76156879,
+    0xfa2fb0c8, 0xb8c1061a, 0x6591a0d9, 0x279cf1f6, 0x0e5bdfb5, 0xab7595fa,
+    0xa193aac9, 0x4a7d063f, 0x2fe99a66, 0xfc241c58, 0xd3aa9fcb, 0x0d59533f,
+    0x95143d27, 0x73ee6ec7, 0x31c73d3d, 0x6f4a4c58, 0xeb5076a5, 0xae7b24c5,
+    0xcf6960da, 0x1f80eb2b, 0xbd0a963c, 0xd49acc8a, 0xb19c0906, 0x5540238e,
+    0xbf35cb5b, 0x8e4d2c58, 0x9c5e0a95, 0x49f52a72, 0xfd62c5f9, 0xae33fe9c,
+    0x35d2511f, 0xb8cf5319, 0x68425dda, 0x9a079b30, 0x59310601, 0x45ab43aa,
+    0x2cdeaf2b, 0x3259647a, 0x7968d406, 0x6bb5c9a8, 0xa539f6c8, 0x859e4d68,
+    0x2829019a, 0xf14f5a95, 0x868fd5e1, 0xd3abaaae, 0x2f29d7ab, 0xd58f20d6,
+    0x2a5c8aae, 0x0111ed33, 0xa90c9052, 0x03ac91c0, 0xe1504087, 0xd0eb3530,
+    0x3581d80f, 0x01ba1663, 0x59b7262c, 0xfe835787, 0x00c4ff1f, 0x01001133,
+    0x04020303, 0x000d0303, 0x00000000, 0x02010000, 0x05000403, 0x06311211,
+    0x13414021, 0x52506114, 0x22161071, 0x35333225, 0x91605142, 0xdaffe1b1,
+    0x03010800, 0x013f0101, 0x5cc622f9, 0xee2d43c7, 0xc0b5e66b, 0xcf3f8d8c,
+    0x630b57f9, 0x0f25d5d6, 0x5be99f63, 0x8705f6f6, 0xf2eb16f1, 0x4e6516d7,
+    0xab76acb6, 0x2371c834, 0xa3323ca8, 0x756a4ee9, 0x468eb4c2, 0x6a9e148a,
+    0xfd84751d, 0xab76dd60, 0x8c1be6c4, 0xacc60aea, 0x914f4b6d, 0xbffb60b3,
+    0x1cd559dd, 0xab4d43c6, 0x4e5c6f24, 0x2f17a694, 0x8686ac7b, 0x78087d9d,
+    0x2d1c1ae0, 0x9c858c08, 0x8f1e4e54, 0xdabce411, 0xb027458e, 0xffbd95ab,
+    0xe6163c00, 0x067155cb, 0x226ec7b5, 0x2a8ed23e, 0xdc766bc3, 0x9a1b9995,
+    0xd84c43ba, 0x9f946eab, 0x5f1d650d, 0xb7c3d53e, 0x555ea965, 0x4aaff0f3,
+    0x68393507, 0x16caea72, 0x52132479, 0xd545669e, 0x29faea94, 0x29a8a419,
+    0x48738a20, 0x00ff3407, 0xd6e32bdf, 0xb8a3ea32, 0xa7b85197, 0x8da9a0f8,
+    0x3d0b270d, 0x797ccbea, 0x55524352, 0x6afd6a90, 0xebb2ec98, 0x8522c869,
+    0x2d2369a6, 0x6672979a, 0x3c59c2cc, 0x55aa8dd5, 0x46b264fa, 0xafd323ad,
+    0x76044907, 0x3ed14cab, 0x1bf32028, 0xdb16aed3, 0x1732a92b, 0xbe3ae529,
+    0xdcb7c1fe, 0xe2b9b71d, 0xa2894737, 0xa495de3a, 0x2349b0d2, 0xff7fdc6f,
+    0x112700c4, 0x01020200, 0x01070402, 0x00000001, 0x00000000, 0x03000201,
+    0x10120411, 0x13403121, 0x41322214, 0x60426150, 0x0800daff, 0x01010201,
+    0xcce0013f, 0x37cf6410, 0xa576255e, 0x6fe8d7bc, 0x74d270f6, 0x7166949a,
+    0x1885c1b4, 0x5fdf8380, 0x6745e1ec, 0xdf4ba63b, 0x2cdc2ff9, 0xefee3c9a,
+    0x1019951c, 0xd446dcea, 0x120caeb3, 0x38c3579b, 0xe6ac4e9a, 0x715b2e6a,
+    0x78ec4389, 0xcd7b460e, 0x83d03f55, 0x62687a82, 0x5aa9623e, 0xd359971b,
+    0x72621d94, 0xdc38de51, 0xd5930631, 0x751a35f9, 0x7b9a940b, 0x0dd32650,
+    0x5aace3f5, 0x4dcce69a, 0x7ec72f3a, 0xa8197946, 0x507ec3af, 0xec222628,
+    0xda863e50, 0xc9138385, 0x1cc4b0b2, 0x00ffd1bf, 0x4900c4ff, 0x03010010,
+    0x04040302, 0x0b0a0609, 0x00000001, 0x03020100, 0x05110004, 0x31132112,
+    0x22145141, 0x10067132, 0x61422315, 0x24b19181, 0x73724033, 0x504320c1,
+    0xb2928374, 0x16f0d1c3, 0x62523430, 0xe1d2c2a1, 0xfff2f1e2, 0x010800da,
+    0x3f060001, 0x4b2ef102, 0xde0845a1, 0x66bebe11, 0xf8a7ea4f, 0x5c3aa6d3,
+    0xd07ecf4e, 0x5f06f901, 0xa6f8f870, 0x4fd681dc, 0xc83149df, 0xf936250d,
+    0x156d53db, 0x6a209181, 0xdd03456b, 0x415ab1e2, 0xc4f99af5, 0x69c1eafb,
+    0x957ed427, 0x7c7cb82f, 0xb9d81c51, 0xaedcf3d1, 0xfb2a5ddd, 0xb1bfb7d3,
+    0xbe4ff93f, 0x97344eeb, 0x0b957216, 0xe2af955e, 0xec4c8a8f, 0x3e64d749,
+    0x1502eef2, 0x051c2995, 0xde050527, 0x3ebb5784, 0xa8ef8bbd, 0xc8e45253,
+    0x95ee4a8b, 0xe66be36a, 0xdfacec93, 0xd1e7292b, 0x7ee24cd5, 0xfc9d507d,
+    0x53be1b6a, 0xa7f2587b, 0x53b5835d, 0xad159b6d, 0xc8e94519, 0xc824352c,
+    0xed72e568, 0xa479df68, 0x84b29cc8, 0x51465929, 0x32374d72, 0x5ed88a22,
+    0x4b1a8beb, 0xe4525c12, 0x29c350ab, 0x236abace, 0xa7dc3a6e, 0xcdcb920d,
+    0xfad79d94, 0x4845ee03, 0x4a17e95b, 0xcdd73754, 0xfc53fdc7, 0xa1eec869,
+    0xe5f7da90, 0xc4c7bf49, 0xcd2a9aa6, 0xb8cb8c15, 0xec9f33a9, 0x9fa86847,
+    0xfa51dbe7, 0xb0cd5639, 0xd3da427b, 0x06cc0072, 0x21c51c8a, 0xfc857263,
+    0xdd4ffb48, 0x7fce3f54, 0x3c2a6ad2, 0x652f8993, 0x8d302319, 0x7c5e3dd4,
+    0xb415ddaa, 0xabbd3931, 0x75b3a7ac, 0x879f7a01, 0x330e7547, 0xad6c1e21,
+    0x95fd225a, 0xa46d8a77, 0x9eeb6e2f, 0xbe17e971, 0x3f8d47d5, 0x6160cd01,
+    0xf655cab1, 0xbacf1fab, 0x490a2cb1, 0xada8adb3, 0x8ac63c09, 0x326eaafb,
+    0x92c87460, 0x03f08e06, 0x950e3c4e, 0xb88c4d10, 0x2970db72, 0x9fe897a7,
+    0xd3833eac, 0xbe2ea7e3, 0x7f772375, 0x2975108f, 0x1ab86f25, 0x39881516,
+    0x96775eb2, 0xb5757694, 0x5f1f8b58, 0x3ea88f89, 0x0ecf241e, 0x6d398c7c,
+    0x8bbdbabd, 0x64146a7c, 0x5dfb3b2b, 0x72ea44a6, 0xe350ebd8, 0x6de7243e,
+    0xd869a184, 0x4ca4c213, 0xd034554c, 0x458e42ea, 0xdbb8ed96, 0xa753a980,
+    0xe5536d49, 0x67b9921e, 0x9ee06af1, 0x1e2215ee, 0x339a1722, 0x2725c664,
+    0x380afeaf, 0x22a6f393, 0xb754875c, 0x8bf21dd3, 0x1235ee1b, 0x945e2744,
+    0x676fd984, 0xda2fd639, 0x4ca9eeb9, 0xa0d761ce, 0xe6cc8285, 0xab72ba1b,
+    0x63501550, 0xb95430e0, 0x90ecee19, 0xae0740ce, 0x28df8b90, 0xe380feb5,
+    0xe0b60b0e, 0x87346bca, 0xb9469183, 0xa452f546, 0xb6646743, 0xc55352b5,
+    0x1cd29834, 0x1d95b8d8, 0xe54743e3, 0xe7e97b8d, 0xac68d453, 0x40a13a95,
+    0x7fee76ec, 0xc36add7d, 0xc0505a41, 0xa40f9f3c, 0x66da6595, 0xf45e3739,
+    0xaee60433, 0x6457f7c8, 0xca2dac55, 0x00b422bb, 0xb2556457, 0xaaae728b,
+    0x86be7b42, 0x2d1dd441, 0x9b47324e, 0x31cf663d, 0x8df44048, 0x0bedb8a9,
+    0x11f00325, 0xa8ba9ff6, 0xcba6c2e9, 0xa54b661b, 0xaf4e2f84, 0xd5424b21,
+    0xd9849cb1, 0x1fab36e4, 0x31c79aac, 0x363d2537, 0x668c3243, 0x2925eb83,
+    0x6d6f6bd4, 0x4a7f8831, 0x53a774e5, 0x1444239f, 0x4dcbf2a0, 0x53cfeee1,
+    0x534a092f, 0xd47b8398, 0x3b2caed5, 0xaceaadcd, 0x8447073f, 0xacdc9613,
+    0xd44a7197, 0xd4a95566, 0xc4cb8bbb, 0x81c23c20, 0x18575e59, 0x8d1fd458,
+    0x41f8da4c, 0x2dc33e3a, 0xbdf72ab2, 0x6225c246, 0xbe22c50a, 0xebe02e50,
+    0x0a1fd50c, 0x10312746, 0x6c51299e, 0xc25e793c, 0xc671409e, 0xb52d9aba,
+    0x53db4359, 0xcb88bde7, 0xa438bb54, 0x4e37b5bb, 0xe1a6d64d, 0x795df262,
+    0x640a1a13, 0x9dd8abbc, 0x6afa6e53, 0x37b51e26, 0x2924493a, 0x4828c506,
+    0x914f8dba, 0xeb961037, 0x76a045a5, 0x0d2ca8a7, 0x04b1aec7, 0xe604e13b,
+    0x32801813, 0xfcdff72a, 0x9771b229, 0x41ab48b1, 0x55c8cc43, 0x8f25df94,
+    0x8963aa75, 0x1b762293, 0x48c94616, 0x8f85797d, 0xf1a7f90f, 0xad5b325c,
+    0x163a2714, 0x7990f2ca, 0x62f2c21a, 0xe8c7e1f2, 0xc2c775a9, 0x17e72df3,
+    0x4a85bbad, 0x04e1d5c0, 0x7bceb4e4, 0x36d6153a, 0xcb6e49ac, 0xa375255e,
+    0x7a7bc9a2, 0xeb1ebc6f, 0xf8ed7954, 0x9c52295b, 0xca565f40, 0x5a96276d,
+    0xda8ae20c, 0x4e6a694b, 0x0edaf7da, 0x9b1dfc0a, 0x951dcaa2, 0x6981e28d,
+    0xb80156c6, 0x3743ed55, 0x02feda6a, 0x55f7d33e, 0x9f837d80, 0xf0080f7d,
+    0xacb0a15b, 0x479f34cf, 0x01b1a6fe, 0x34a6848a, 0x824aaac9, 0xad5537bb,
+    0x61db0aaf, 0xd791a358, 0xdc3f87e8, 0x71c2122b, 0x43854c17, 0x628ee2dc,
+    0xe317b135, 0x7fe80f58, 0x00ffd36c, 0x122bfc50, 0xe42776f2, 0xbcb99ce2,
+    0xf46d56d8, 0x56f238fb, 0x431636ee, 0xa7bbb84f, 0xb0c27737, 0x42402be5,
+    0x9e867d2c, 0x1f04d824, 0xd0d34e85, 0xe035f091, 0xe11a37ee, 0x2a218df8,
+    0x9fe8e550, 0x119e637d, 0x885446c8, 0x9e742c66, 0xf7b95e1d, 0x3fb7cfd4,
+    0xf9162bb2, 0x355bb87c, 0x65aeec0f, 0x53dfa9cd, 0x7611771f, 0x00844f53,
+    0x81ba6ba9, 0xdafed217, 0x9634c2f0, 0xfab8acc3, 0x8d7b9242, 0x4bd2c34f,
+    0x8b2056b8, 0xff77ab24, 0x9fb04200, 0x91fd5acd, 0x3ee99f58, 0x4e2c4cea,
+    0xf65a1edd, 0xb775fa42, 0xa26e788d, 0xb88a13f6, 0x9a039ccb, 0x8815d61f,
+    0x7de19e44, 0x9790d670, 0xef4d6e54, 0x7ff6f8a5, 0xc6c918ab, 0xac00e555,
+    0x977184d9, 0x985eb775, 0xb22b46c5, 0xd2ca3876, 0x0ea40003, 0xeb5bd737,
+    0x52c0424a, 0xe3412c54, 0xda148e58, 0xddb288d4, 0x9b4fa7da, 0xd88af7dd,
+    0x6c9ef0c2, 0x2a837b78, 0xd607724e, 0xd9a82dbd, 0xee86e396, 0x59aae63c,
+    0xc5cb62a4, 0x41b4248a, 0xc8022b67, 0xade3b8b1, 0x86e48629, 0x76392964,
+    0x9cf73bfb, 0xc616a7b7, 0x779aa722, 0x435b1ae7, 0x9bde5a5e, 0xe195d49c,
+    0x3c6fd3f3, 0xddf6de84, 0x318e3aa7, 0x11778b19, 0x9439b163, 0xd2ead506,
+    0x283c13b6, 0xd1192299, 0x92b0254d, 0xbcde2b47, 0x82ee0591, 0x56994dc6,
+    0x1f2fe74c, 0x604ee769, 0xc874a5f2, 0x2ba405e5, 0x36a59467, 0x4e3a00ff,
+    0x464f160b, 0x4ecd266f, 0xf448eeec, 0x2c2af5bd, 0x7be8524c, 0x1c60b451,
+    0x97bfe78a, 0xf150750a, 0xefd451f9, 0x2f80666f, 0x8d994a4c, 0x1736c4ca,
+    0x3a3c6d53, 0x4a0d5ca1, 0x2733719a, 0xa0cf9ca5, 0xf55100b2, 0x0e3ba56b,
+    0xbe36735a, 0x8a79523c, 0xe62e0d8d, 0xa0a50c53, 0x6b214fe1, 0x9c308eda,
+    0xcd62aa58, 0x9571bcdc, 0x7d2dde57, 0x515e7029, 0xaba41442, 0x1b8b7732,
+    0x0a8f61d1, 0x700bb726, 0xa0cc4969, 0x74bd6639, 0x9cd86068, 0x4bfb5acb,
+    0x9fc8bf3e, 0x2a00c4ff, 0x02000110, 0x03030102, 0x01030403, 0x00000000,
+    0x11000100, 0x51413121, 0x71108161, 0xb1a191f0, 0xd1c14030, 0xe1f15020,
+    0x0800daff, 0x01000101, 0xa0f4213f, 0xab1d20db, 0x7d9af494, 0xf5e21c74,
+    0xde20d24b, 0xfcdfbf22, 0x05e24407, 0xf12ed028, 0x6aa73b05, 0xc22e71de,
+    0x94125ce4, 0x7e4500ff, 0x1390949d, 0x72763efe, 0xe5e2fe40, 0x9ce880cf,
+    0x7f57254b, 0x2a887787, 0x380e32d7, 0xc8c7c1a2, 0x41104f07, 0x23f7ca49,
+    0xdfe8cc98, 0x06f0065e, 0xe914e061, 0x6e10f975, 0xba87a856, 0x0489e117,
+    0xbdaa6149, 0x04b6d4e3, 0x59edc080, 0x483210cc, 0xccfc051d, 0x1817717d,
+    0xb7b112f1, 0xc4ebc5f0, 0xa18a38b0, 0x1fe2441a, 0xd6d1b199, 0x4988798d,
+    0x71f08bf8, 0x7219f6d7, 0x8f3705ce, 0x24f6956b, 0x3691c134, 0xf55464f4,
+    0x62fed525, 0xdcf9ae4c, 0xb92ce340, 0xc33cf90f, 0x43fc771b, 0xdf3701b5,
+    0x4377e0d3, 0x45de71f4, 0x3f67f012, 0xb21062aa, 0x781c6a09, 0xa833dcf7,
+    0x38850572, 0xda717dc9, 0x324c7e12, 0x1d67f29b, 0xcdd448a3, 0x43b80f62,
+    0x928ec585, 0xc4faeeb3, 0x0b879913, 0x3cc36a84, 0xd5229f4a, 0x54076ec2,
+    0x5d3face3, 0xff38892c, 0x3dfb5000, 0xb0069d73, 0x6296f165, 0x135850e4,
+    0x8250ac8f, 0xc479b4d9, 0x7489bef8, 0x5061b85c, 0xd2f4fd5d, 0x5ba3e5e5,
+    0x628bd342, 0xa15c5640, 0x824fbc13, 0x7594d2d0, 0x6b16f1b8, 0x768b27b4,
+    0x88fd8e0d, 0x8354eedf, 0xbbea6e5a, 0x68d2427b, 0xba15d40b, 0x4433eb79,
+    0xcc016458, 0xa058e3aa, 0x209c550e, 0x6c6a3ad6, 0xdb5a4e27, 0x477a5b9e,
+    0x51efd16a, 0x972df5fa, 0xd584d923, 0x0fe9b434, 0x60c72548, 0x709337d7,
+    0x97cf3080, 0xbe43099b, 0x0aa78d16, 0xa35b4648, 0x1f6006ab, 0x2828a801,
+    0xdf4b1cc0, 0xb45cac0b, 0x8dbb1e9d, 0x1cc45557, 0xe9b5943a, 0xa67d5c6d,
+    0x7f628d4f, 0x8e9997c1, 0xaf6a5d84, 0x1df33329, 0x4fd08718, 0x974b4c45,
+    0x2efd72e9, 0xe67fb95c, 0x4a700c97, 0x09f6915c, 0xd4fa9763, 0x964fa85d,
+    0xee1939a6, 0xf8f5caf2, 0x2995d11d, 0xecdb6cca, 0x442b9316, 0x83ed4a87,
+    0xa70771f6, 0xe60e4a3b, 0x49b865d3, 0x988edbb9, 0xe05bfd89, 0x077b591c,
+    0xe6deb554, 0x13d7a8b8, 0x2e640955, 0x491e9a8e, 0x8d71cfaa, 0x33a5b4df,
+    0xbea142d7, 0x3398e1a3, 0x9ca4a555, 0x5ada9618, 0x8184c1dd, 0x06120235,
+    0x653d8f9d, 0x16089d17, 0xf51e832e, 0x87261f37, 0x6422384e, 0x831d1549,
+    0xba73666e, 0x19d7eeaa, 0x5d166280, 0xd90dfd5e, 0x2af12f75, 0xd6f0046d,
+    0x7b7521bb, 0xf76b500b, 0x5f277bd4, 0x7f607210, 0x00ff663e, 0x63051a1c,
+    0x10edca5c, 0x7d0b9756, 0xfec886c3, 0x6b410d98, 0x6aac1ab7, 0x0b1c6633,
+    0xe3353cec, 0x3b9b6efc, 0x43bbfe7f, 0x5334757a, 0x602ba6d2, 0xcfea57c3,
+    0xc210dd81, 0xc535b41b, 0x0ef5b59c, 0x802ef225, 0x9ee61e12, 0x72c101b5,
+    0xbf349d1c, 0x6a0be968, 0x62d6d207, 0x4f4cee65, 0xb3f7b497, 0x7fbde941,
+    0xea9fc2ec, 0xb66e0aae, 0x9cb010fb, 0xde4736a7, 0xf12a8400, 0xc7b23201,
+    0x6f5b2c78, 0xf383df4b, 0x41a5038a, 0xf75bf760, 0x4ad1e9e9, 0xf2ba775b,
+    0xad702db5, 0xd2143a18, 0xbdfe2188, 0x7a2400ff, 0x1329df68, 0xed7347db,
+    0xd1de7c25, 0x8c660041, 0xebc1e15e, 0x45083547, 0x3f0c9e2c, 0x61955689,
+    0xb783ae32, 0x810ad27f, 0x676986a7, 0x9d8eb61b, 0xc33aae62, 0x6dc7a229,
+    0xa468779f, 0xd8817d58, 0x32804eca, 0x1f72867a, 0x75f1ae45, 0x85e84307,
+    0x1c92891f, 0x6887f46f, 0x55293e67, 0x775ee834, 0x1856ed05, 0xce3375f0,
+    0x1e0f982f, 0x1abb5881, 0x730ce72a, 0x87b1312f, 0x2c219651, 0xdb0dbb2a,
+    0xa0a47faf, 0xae47ef4a, 0x91ef46fc, 0x530e312c, 0x911ddd67, 0x1cd00ec0,
+    0x388e1cb6, 0x838ad780, 0x6dc30bfc, 0x3d28a2e6, 0xcf2b61aa, 0x8b64ca0f,
+    0x9e73aa8b, 0x0063b1ec, 0x3507a5c5, 0x13c7fc77, 0x4669ba6d, 0x29ed718b,
+    0x873db0ea, 0x085b8078, 0xdac99862, 0xfec4fcea, 0x91f2183c, 0x71fb94f4,
+    0x4a1f0e5d, 0xfb4a1df3, 0x26e25f1c, 0x525fd16e, 0x9ff48fbf, 0x0c00daff,
+    0x02000103, 0x00000300, 0x92911000, 0x244992ac, 0x92244992, 0x49922449,
+    0x2449fbb8, 0x92244992, 0x49922449, 0x5816ba26, 0x00040180, 0x49922449,
+    0xc4d69024, 0x022440e4, 0x49922400, 0x1e439224, 0x006031f1, 0x49920009,
+    0x20499224, 0x92553329, 0x40020441, 0x00000000, 0x5a240002, 0x00802009,
+    0x04099220, 0x33240192, 0x40120419, 0x20081220, 0x92200100, 0x48802449,
+    0x20499020, 0x82000010, 0x49922449, 0x24499224, 0x92244992, 0xc4ff3f49,
+    0x01112700, 0x03010200, 0x03040303, 0x00000000, 0x01000000, 0x31211100,
+    0x61405141, 0xb1918171, 0xf1a16010, 0xfff0d1c1, 0x010800da, 0x3f010103,
+    0x7f53fa10, 0xf09ea371, 0xb4e5a9b8, 0x95372934, 0x2f0400ff, 0xab33d532,
+    0xdfbde0d7, 0xb0621586, 0x4902de67, 0xac88b705, 0x330e73ac, 0x2845350a,
+    0x3c4032ef, 0x4bb49a75, 0xef7a600d, 0xe63432c3, 0x31c231bf, 0x54e2ad1b,
+    0xcd343488, 0x1c32d0fe, 0x945385f0, 0x5ed6537b, 0xfef152f1, 0x63f9ab65,
+    0x66d98cfa, 0x82785ab5, 0xac94ddae, 0x5fcd196a, 0x87cf201e, 0xe84205f6,
+    0x2638d3b8, 0xc73c75fe, 0xbabd664b, 0x8ea1c1b6, 0xe2ab09ae, 0x94901d50,
+    0x390f8aaa, 0xad2215a8, 0xae65d47b, 0x561962cd, 0xcb065118, 0xabbec17c,
+    0x96a2c75c, 0xe180cfc9, 0x117c24de, 0xcea60f6b, 0xa4c18a92, 0xef75b96a,
+    0x1bf04012, 0x9b448d79, 0xe2d7f961, 0x3acdb65a, 0xd808e9c6, 0x385ba253,
+    0x5f316ea8, 0x235a1f80, 0x537f6aa5, 0xaf0f7b3d, 0xc58a6493, 0x91d6c651,
+    0xfbab49ee, 0x00c4ff8f, 0x0101111f, 0x01030001, 0x00030200, 0x00000000,
+    0x00010000, 0x40312111, 0x51501041, 0xdaff8160, 0x02010800, 0x103f0101,
+    0xb9a039fc, 0xb75d4f46, 0xbebfe73f, 0x760619c3, 0x9b88e008, 0xe6ec833a,
+    0xeab4f3c8, 0xb2115d6e, 0x9e64b331, 0xb2bdc6be, 0x87a29388, 0x24be001b,
+    0x0e47221f, 0x46fe5db6, 0x8c99b15e, 0x21e3d238, 0xfb605bc7, 0x5f2c6f59,
+    0x041d63c8, 0x61de7a30, 0x62a619df, 0xc07a4b4c, 0xd437737f, 0x8363ba30,
+    0x76a7690f, 0x0187a107, 0xc63e7cc4, 0x417fcb2f, 0xc14742a4, 0x00ff6204,
+    0x00c4ff63, 0x01011027, 0x02020200, 0x02020202, 0x00000103, 0x11010000,
+    0x41312100, 0x81716151, 0x3010a191, 0x5020c140, 0xdafff0b1, 0x01010800,
+    0x103f0100, 0xa46703fe, 0xca01049a, 0xc6a09972, 0x14e55392, 0xcce597a3,
+    0xac2e94c8, 0x8f6702de, 0xfe4fdef3, 0x00972f98, 0x79d70c7c, 0x7753fa3c,
+    0x154661bd, 0xbb56c086, 0x84dfcef9, 0x0b7f7d2a, 0xf86939c2, 0xe500ff5c,
+    0x09de00ff, 0xf4a3e168, 0x5748e43f, 0x4fae3859, 0x8c5921b0, 0xca0414a9,
+    0xdec71cde, 0x8446be56, 0x8635f4b3, 0x43d7a628, 0xcf7ed069, 0x884a6039,
+    0x657d7c9c, 0x0d9cd744, 0x38608d83, 0x6e3b5153, 0x61bcb1a6, 0x9c633609,
+    0x6e8e65d5, 0x1098e73a, 0x8cea05e4, 0x14da2f87, 0xcb242d3f, 0x2150ea0e,
+    0x69442035, 0xf3b1e1bd, 0x54bdcb34, 0xbc69ea22, 0x24359b5c, 0x2a89bb4a,
+    0x97c258bd, 0x0e28ebe7, 0xfb7a25e0, 0x2aa34731, 0x38a10d12, 0xffc2787e,
+    0xd821d700, 0x8b3206b5, 0xd5094d8d, 0xbd08d212, 0xef5f1a9c, 0xc08207a2,
+    0x36784598, 0x76a4626e, 0x32234623, 0x20009029, 0x3ae4a848, 0xba9ce373,
+    0x51be5f79, 0xc8fad8ed, 0x3e2afcc5, 0x909fda81, 0xd5d8ef66, 0xfbf5e140,
+    0x5e523f62, 0x23df1378, 0x3007e7e3, 0x97006cd8, 0xfdacf3de, 0x18a64516,
+    0x7e40bb56, 0xebdd2260, 0xdc2b6625, 0x2a9e2cca, 0xb1b3c1d6, 0xc5989170,
+    0x1290860e, 0x03c12401, 0x5e7a54e3, 0x1c784bd3, 0x607ce0aa, 0x311c75ab,
+    0x4cf98527, 0x0d968de9, 0x0f1eeabc, 0x13a00c0c, 0x000712bc, 0x1aa7e105,
+    0xf2c29a82, 0x63844ac2, 0xeaf7078e, 0x12caf9bc, 0x019606a4, 0x36cdb43d,
+    0x2b755ce0, 0x318c330f, 0xc2e78a7e, 0x61fc8657, 0x71902789, 0xc77065b1,
+    0xd80305ed, 0x0b50609d, 0x4b7c2a8c, 0x603a0493, 0x0daf5c15, 0x48aa5741,
+    0x0c6fe042, 0xb6045155, 0xe7052006, 0x0c3fb424, 0x9d4781fa, 0x1b505826,
+    0x9e8a62a5, 0xc362eea3, 0x08d5402e, 0x1c7cfb82, 0x81968c84, 0xf42170d8,
+    0xbb44f062, 0xb54deaf0, 0xe18861ad, 0x168af52e, 0x1fae3b0a, 0x04a4bc0c,
+    0x755eaae4, 0xf3363d54, 0x88682489, 0x965bd01a, 0x05eeb266, 0x19df9ffb,
+    0x8746f8d5, 0x1b384e4f, 0xc1e97586, 0x52b34639, 0x005e51e8, 0xedd015bc,
+    0x386627cb, 0xa50af41b, 0xf7477a80, 0xa5481289, 0x97378953, 0x7825b785,
+    0x46a3097c, 0x15c839af, 0x8f932ff9, 0x20e486f1, 0x61000750, 0x251b6587,
+    0xe0b1ceea, 0x21a7117c, 0x216a6fa0, 0x118580c9, 0xb90b7b59, 0xc28f0e57,
+    0x428861c6, 0x77260f9d, 0xf215b6c9, 0xd7ebf362, 0x84aa0209, 0xb15ee70b,
+    0xae023167, 0x9ccf7bbb, 0x14eb6bb4, 0x7f18026c, 0xf9c94119, 0x7964f2c8,
+    0x04719e32, 0xe43dbea9, 0x79caa50c, 0x3d64f2c8, 0x8f4c1e99, 0x5cca5226,
+    0xe729ef11, 0x13fe7b04, 0xb01e7314, 0x42b4ac33, 0x668af523, 0x8f5a6961,
+    0xf7c0276f, 0x9f1d20a5, 0x0df73f20, 0xc7ddbed8, 0x97736b95, 0xb2e8e7f0,
+    0xec678052, 0xd84606be, 0x731d73c3, 0x29a081f3, 0xdaee74a0, 0x193a1d45,
+    0x9222aaed, 0xe44203f3, 0x236a9343, 0x074a6b59, 0x465c26a3, 0x62a3a8e8,
+    0xb280bd40, 0x4c9a19f8, 0x212e0a35, 0xd904aec1, 0x41036ac3, 0x68166513,
+    0xb5547314, 0x9007df0f, 0xd8b8a740, 0x45878a6d, 0x39efdad0, 0x0b5895bd,
+    0x320687a1, 0x0002de6f, 0x7bdfd0d8, 0xb6dfe2bc, 0x4b307232, 0x8be0a533,
+    0x695072b2, 0x1d3c17c2, 0x1ce1d065, 0x742ce887, 0xf67909b9, 0xcf230f12,
+    0x416ce15a, 0x9f7a7145, 0x70dde040, 0x35929851, 0x1a70fe06, 0x34d7c668,
+    0x89f59530, 0xc0f8c8a1, 0x4e54b4f9, 0x605f28b7, 0xfdbb659d, 0x24625123,
+    0xe23888a7, 0xa40ca658, 0xebfae4f2, 0x4cbf5913, 0xe604b8a2, 0x002ab4d5,
+    0xe3268e7d, 0x71b4d855, 0xd0829a93, 0x483a08b9, 0xe03fbe26, 0x8c65e1f0,
+    0x575ee1b3, 0xa06d4e6b, 0xbf15a055, 0x05de6f07, 0x8de60258, 0x00ff56cf,
+    0xcdb00a28, 0x0132bda3, 0x2d6e1f51, 0xc8be02ac, 0x6894e2e9, 0x7fa2b1f1,
+    0xe07c4e30, 0x654639a9, 0x289f4b5c, 0x6c7f3e14, 0x5717df42, 0x7c8aba05,
+    0x8884603e, 0x02f0589d, 0x10c153e2, 0xb2527999, 0x1360188f, 0xd1088109,
+    0x1289442b, 0x302b5465, 0x3ebd4f51, 0xf0363771, 0x89f5aa02, 0x723843ef,
+    0x40794f1e, 0x7e529db8, 0xe37a7c69, 0xafa9c93f, 0xe60069dc, 0xaea6308c,
+    0xfaccd978, 0xf9703a25, 0xb6949773, 0x00436292, 0x5ed69b6a, 0xb0037aa8,
+    0xb1891df0, 0x4185cb04, 0x319a01db, 0xc4ec205d, 0x85b2e8ef, 0x2d17930d,
+    0x9f8de2b1, 0x1445893e, 0xd6e58a26, 0x3fbf95ea, 0x45c36886, 0x8a28f217,
+    0xf54797b0, 0x0a11a713, 0x1cef4c0f, 0xc08480f0, 0x8b6ce735, 0x6368bcbb,
+    0x60a3200c, 0x7608444b, 0x15857b47, 0x4813e900, 0xc92962f2, 0x94b76436,
+    0x2b6d340b, 0x53254280, 0x18720373, 0x8e27174f, 0x80da818a, 0xb5f36005,
+    0x73af8e77, 0x0a3badde, 0x190006fd, 0x000650b9, 0x3a848246, 0x0255f06c,
+    0x97b43448, 0x38879a48, 0xcecf469d, 0x7421e951, 0x46c17944, 0x840883e7,
+    0xa336b069, 0x46f91453, 0x35719330, 0x2d4caab7, 0x90f3014c, 0xd3bbaa60,
+    0x86b1a77a, 0xb2a58270, 0xd6a98c20, 0x298da200, 0x68769a1c, 0x1515c679,
+    0xd004b403, 0x45ad54a8, 0x455ba15e, 0xf2613a1d, 0x32c160e1, 0x0db42b5c,
+    0x00376936, 0xe17672c6, 0x1d89203c, 0xcc56dd5c, 0xdf746e4e, 0xd0e474ec,
+    0xd6835565, 0xc9f283bf, 0x102fcb79, 0x6f040101, 0x9448e32a, 0x0a1df315,
+    0xf1b4ea2a, 0x6664ab82, 0x504aa248, 0x27596b6a, 0x20c97c13, 0x0300341a,
+    0x3ffa5fdd, 0x0000d9ff, 0x50545448, 0x302e312f, 0x30303220, 0x0d4b4f20,
+    0x7265530a, 0x3a726576, 0x49776c20, 0x2e312f50, 0x20312e34, 0x74746828,
+    0x2f2f3a70, 0x61766173, 0x68616e6e, 0x6e6f6e2e, 0x2e756e67, 0x2f67726f,
+    0x6a6f7270, 0x73746365, 0x69776c2f, 0x0a0d2970, 0x746e6f43, 0x2d746e65,
+    0x676e654c, 0x203a6874, 0x39363333, 0x6f430a0d, 0x6e65746e, 0x79542d74,
+    0x203a6570, 0x67616d69, 0x706a2f65, 0x0a0d6765, 0x67615445, 0x3922203a,
+    0x37666436, 0x63383834, 0x61386337, 0x22353236, 0x61430a0d, 0x2d656863,
+    0x746e6f43, 0x3a6c6f72, 0x78616d20, 0x6567612d, 0x3436383d, 0x0a0d3030,
+    0xd8ff0a0d, 0x1000e0ff, 0x4649464a, 0x01010100, 0x48004800, 0xdbff0000,
+    0x03004300, 0x02030202, 0x03030302, 0x03030403, 0x05080504, 0x05040405,
+    0x0607070a, 0x0c0a0c08, 0x0b0a0b0c, 0x120e0d0b, 0x110e0d10, 0x100b0b0e,
+    0x13111016, 0x15151514, 0x18170f0c, 0x12181416, 0xff141514, 0x014300db,
+    0x05040403, 0x05090504, 0x0d140905, 0x14140d0b, 0x14141414, 0x14141414,
+    0x14141414, 0x14141414, 0x14141414, 0x14141414, 0x14141414, 0x14141414,
+    0x14141414, 0x14141414, 0x14141414, 0x14141414, 0x1100c2ff, 0x004b0008,
+    0x1101034b, 0x01110200, 0xff011103, 0x001c00c4, 0x03020200, 0x00000101,
+    0x00000000, 0x00000000, 0x08040600, 0x03070501, 0x00c4ff02, 0x01010119,
+    0x01010101, 0x00000000, 0x00000000, 0x01000000, 0x05030402, 0x0c00daff,
+    0x02000103, 0x00100310, 0xb1500100, 0x80810c28, 0xfa3c7d18, 0x2f6f00ff,
+    0xb4fdf959, 0x2ea33767, 0x7350010f, 0x7c7d8f27, 0x1d1e5dab, 0x54f7e74f,
+    0x48706f5c, 0x07174930, 0xe77d9e9e, 0x9d8597b7, 0xa5ae878f, 0xb8ca4ee7,
+    0x0e433641, 0xe1d1c3b2, 0xeb0ed4a2, 0xf350d1cb, 0x55025455, 0xc7df379d,
+    0x6181ccda, 0x3caafd79, 0x1e19aaaa, 0x56b67c3d, 0xf2940500, 0x3151a9f5,
+    0xb3be8d54, 0x0040d6b9, 0x5537162d, 0x3067b225, 0x689eda49, 0xc83e418e,
+    0xaacea885, 0x1d4fea9a, 0xbc46a167, 0x4d1025fb, 0xd9bc5a5d, 0x00808caa,
+    0xb1d80318, 0x00c4ff6b, 0x00001025, 0x01000306, 0x00030005, 0x00000000,
+    0x02000000, 0x06050403, 0x36161301, 0x15111007, 0x31141221, 0x0800daff,
+    0x01000101, 0x5fb80205, 0xee607325, 0x34718726, 0xdca1893b, 0x68e20e4d,
+    0x12421377, 0xf32c39c5, 0x2988ebfb, 0xb28bbca3, 0xa7b5a5e4, 0x93a40203,
+    0x30b44e8f, 0xd747ab96, 0x59bcc64a, 0xcd1a670b, 0x3d3dce9a, 0x533fb266,
+    0xc1265e11, 0x2dcccf56, 0xb7b90c85, 0x654d3e66, 0xbdccc49e, 0x1879dd68,
+    0xb2eb2cb7, 0xfb9dd1ee, 0xfa045138, 0xd9558440, 0x4f051bd6, 0x2c7d0af6,
+    0xabbbb838, 0x1d2041e7, 0xd5560a13, 0x555a33ce, 0x91a33432, 0x65c79f54,
+    0x820d3689, 0xb55ffba1, 0xbbc73779, 0xb272d966, 0xff092a25, 0x6cb03100,
+    0xb51ddf14, 0xfab73779, 0xa986a118, 0xc1061b6c, 0x6abc52b0, 0x6acde4d5,
+    0x99405e2f, 0xa351a4b2, 0x836d2243, 0x0d36d860, 0x58fb8f82, 0xdba91cb2,
+    0xd461a663, 0xe405f587, 0x2e12c76b, 0xd365f6f1, 0x8bbaf9f0, 0xb78b493f,
+    0xd5732405, 0x374bb24c, 0x6dc513c5, 0x112dc9a5, 0x9ee18e72, 0xad8c5f61,
+    0x98b27277, 0x178e98b4, 0xd475e5b4, 0x37e5aab9, 0x62ddb516, 0x29326746,
+    0x4a6e48d0, 0x7e8c59d9, 0x1c868dfb, 0x61e3386c, 0x380e1b87, 0xc3c661d8,
+    0x231c368e, 0xd5da864c, 0x7f9b4dba, 0x2100c4ff, 0x04010011, 0x00050301,
+    0x00000000, 0x00000000, 0x02000100, 0x10312011, 0x30132112, 0xff514032,
+    0x010800da, 0x3f010103, 0xb4ddbb01, 0x4cd3a32e, 0x093eec89, 0x2ee29950,
+    0x13d27cf7, 0x42a16271, 0xf154dc84, 0x6a9e8a51, 0xff3d6c28, 0x00c4ff00,
+    0x01001122, 0x05050004, 0x00000000, 0x00000000, 0x00010000, 0x03201102,
+    0x32311210, 0x40302113, 0x00daff41, 0x01020108, 0xbe013f01, 0xd295751b,
+    0x1e837062, 0x4a01390c, 0x3776237f, 0xb953cae9, 0x9b03351b, 0x5313a8b7,
+    0x9d6a47bd, 0xff7d2ce8, 0x00c4ff00, 0x0200103f, 0x03010301, 0x02090a06,
+    0x00000007, 0x02010000, 0x11040003, 0x31211312, 0x41342205, 0x2014d151,
+    0x81716132, 0xb3939291, 0x42231510, 0x74726252, 0x06b2a2a1, 0x94837324,
+    0xdafff1b1, 0x01010800, 0x023f0600, 0x870b8abc, 0x1a098ab7, 0x8ed85825,
+    0xd3551d07, 0xdfadf8e7, 0x8a7f3e5d, 0xe7d3f5dd, 0x5ddfadf8, 0xdd8a7f3e,
+    0xf8e7d3f5, 0x3e5ddfad, 0xf4dd8a7f, 0x04eec313, 0xda46be4b, 0x746d0fb7,
+    0x0ff98f8b, 0x374951df, 0x96ba4c3a, 0x9f11c3ed, 0xba48b9e2, 0x26794197,
+    0x1a1907a5, 0x60936bbb, 0x21987b6b, 0x4bdfc89e, 0xd26a8427, 0xf2e918ba,
+    0x186adc7c, 0xafd63735, 0x11fea077, 0xc76fda0f, 0xde22ba13, 0xb9bcbbba,
+    0xd99ebbb5, 0x0e0c094c, 0xa6e726fb, 0x68c7314b, 0xc94bd323, 0x1577c3f1,
+    0x4eb275b6, 0xc6639998, 0x1cb7bba3, 0xedca553d, 0x7034323c, 0xc7db12ac,
+    0x73dbca3d, 0x66e6ce64, 0x553d1ceb, 0x34d930ca, 0xbd3bfee6, 0xf2210b94,
+    0xf6ea1197, 0x823d276b, 0x31d8de9a, 0x67a04d47, 0xd1cf6639, 0xfc92fa1f,
+    0x8551aec6, 0xd74b1a70, 0xde1b9e51, 0x9aeec193, 0x451b115d, 0xe9ccae32,
+    0x9e41a9e7, 0x00ff06ac, 0x2dafd4dd, 0xcc3057f4, 0x78997c23, 0xd317a991,
+    0xb15d0d80, 0x7b6791e5, 0x13cdd818, 0x0ac0ecf5, 0x7195fd3c, 0x2d312f7a,
+    0xf36d53cc, 0x9c5e8fbd, 0x611f6cfe, 0x6e6eaaaf, 0x8fb2450b, 0x2c8fd529,
+    0x4263510f, 0x33977bea, 0xfbb9d631, 0xf4b9d0bc, 0x5b9702e9, 0x47a1d26a,
+    0xf587e8a3, 0xaf1af3cb, 0x7b4827e2, 0x397b52d7, 0x9587b5f5, 0x561f59da,
+    0xa19d97e6, 0x1c18e874, 0xdbe18658, 0x63955345, 0xdacf185d, 0x6cefaa32,
+    0xf678b367, 0x25c95291, 0x739e8dd2, 0x943b07b4, 0xde7c7a1c, 0xf2914863,
+    0xbad6c190, 0x0ccc7906, 0xb9db0bb9, 0xd276ac3f, 0x72f4355c, 0x05878b98,
+    0x388d0eb2, 0x177d9bc7, 0x4aa024db, 0x8ff6e662, 0x27d70fa6, 0x6fe56acc,
+    0xc7fd49dd, 0xb3be08c4, 0x30884ad9, 0xfdb6c4a3, 0xaec67c52, 0x9fd4fd55,
+    0xce4f7cdc, 0xbeb6f878, 0x57633e99, 0x4fea7e2b, 0xb4f535ee, 0xed830f6d,
+    0xe10b3a84, 0x981d48f2, 0xd0dafec6, 0x181eb551, 0xae157d1c, 0xe87e2a54,
+    0x7a5ae361, 0x5c8df964, 0x9918cfa4, 0x8cc9f116, 0x5c0d0392, 0xdf765437,
+    0xa77bfbe1, 0x9e6e1968, 0xc94902ce, 0x20ae8e07, 0xb9e29f36, 0x69c6da32,
+    0x23ca9a66, 0xf431d204, 0x7cd67361, 0xe4d914ae, 0xba651ed9, 0xb6464696,
+    0xaf0dda57, 0x00ff9d93, 0x487dafa7, 0xa42e9113, 0x1dd12ed5, 0xbb1178ad,
+    0x63c48165, 0xaac7f33b, 0xeeecc19b, 0x8cc95f15, 0x0e3cbfc5, 0x56b7f9e1,
+    0x9567ada8, 0x4532527b, 0x873b4b15, 0x4c2cc461, 0x8a654871, 0xae8c8348,
+    0xf35023b5, 0x9ffb9755, 0x4195ab31, 0x21133e18, 0xac6e69fe, 0xbb4e30a6,
+    0xaecf0a83, 0x63d5ec9f, 0xf0a7cd62, 0x41722193, 0x81cfe3f5, 0xb4a5da9a,
+    0x302f8349, 0x213e6f0e, 0xabc3dd19, 0x34ec9334, 0x57c1b8ca, 0xff87e5dd,
+    0xa9ecb100, 0xb6517816, 0x7de0749c, 0x0481dbe0, 0xa4c91f71, 0x8db02212,
+    0xc3ed5565, 0xcd679ca6, 0xc8ea56d5, 0xaf314403, 0x38e036ef, 0x9ad7b1f9,
+    0xeb77dcb0, 0x27d4d63f, 0x525ed19e, 0xcf48b637, 0xf710bab2, 0x10babedb,
+    0xbabedbf7, 0xbedbf710, 0xdbf710ba, 0xf710babe, 0x10babedb, 0xbabedbf7,
+    0xbedbf710, 0xe390fc97, 0xa3bedbf8, 0x1a09248a, 0x554715ae, 0x00c4ff7f,
+    0x00011024, 0x02020202, 0x03020003, 0x00000000, 0x11010000, 0x41310021,
+    0x10716151, 0x91308120, 0xfff0c1a1, 0x010800da, 0x3f010001, 0x57872321,
+    0x56229386, 0xeeebfb26, 0x4c2693c9, 0xa5bd6b99, 0xfdcf0e3d, 0x9d648aaf,
+    0x3becaa34, 0x65713e49, 0x219b2f91, 0x90c33d06, 0x2858e2a3, 0xe95fd211,
+    0xe333cd18, 0x24493496, 0x04408b40, 0xe99918e0, 0x10a8e72c, 0x38cd38d1,
+    0x1311c356, 0x7869dad1, 0x2e8062b4, 0x920f8208, 0xe4632ab2, 0xa489060a,
+    0x96422ee5, 0x2152411b, 0xbb71bc06, 0x261c323e, 0x147006e5, 0x977e7209,
+    0x499b5437, 0x2a5855cf, 0x08854393, 0x1e1eda92, 0x805f965c, 0x68c68e6a,
+    0x380f23c5, 0x143586d1, 0x1ea9e52e, 0x403eb96c, 0x4f49d96d, 0x2fd09cd5,
+    0x6cc5652a, 0x46bc470f, 0xd1c1a77d, 0x3c3252f1, 0x274adc22, 0xfc2e5525,
+    0x4cac7187, 0x9a7e18b0, 0xe1131940, 0xd5b6f42d, 0xdc94c176, 0x3a5da327,
+    0x52427a32, 0xac6c0220, 0x2162a814, 0xdf01f984, 0x4b32f0bb, 0x4c36b20d,
+    0xe375ca4e, 0x6ccff6bc, 0x24137e72, 0xc83ac83a, 0x27dac23a, 0xd08377f0,
+    0x96237d30, 0x504027fa, 0x5e06af04, 0xfafadfbb, 0xccf89583, 0x8100ff92,
+    0x196e1554, 0xe210460b, 0x8ffd9ea4, 0xf0da1826, 0x14b0bf8f, 0x0aec00bc,
+    0x2736e584, 0xf6045e52, 0xe613eac7, 0x7222d390, 0x02298253, 0x4bb3a1c6,
+    0x35d55bdf, 0x896c0492, 0x95a19464, 0xd9ac911e, 0x11fb8654, 0x5826272d,
+    0x81512309, 0xbcc18fab, 0xb9bad2aa, 0x2a87c386, 0x1b942eb3, 0xccfea403,
+    0x7bb10894, 0x29d6b325, 0x5516384f, 0xfe69e911, 0xc13c331c, 0x9346ecb4,
+    0x951492c3, 0xe1b85494, 0xf2551641, 0x102c6e2a, 0x0212c018, 0x0a0fe908,
+    0x2b682522, 0x80f8a216, 0x575c1168, 0x1a87224a, 0x158211ee, 0xadcb0248,
+    0x89cb38a5, 0x45aeb7d6, 0x8c1a939e, 0x42f88ebe, 0x4c53c010, 0x43c42d91,
+    0x72b8d45b, 0xfbb40da7, 0x8de09f48, 0xd968369a, 0x215722b3, 0x3a31984a,
+    0x7fd60126, 0x0c00daff, 0x02000103, 0x00000300, 0x01121000, 0x00c00327,
+    0x90208197, 0x2d82e883, 0xa948b220, 0xdb0ec82c, 0x00ff2003, 0xe47020fe,
+    0x9f3c9293, 0xb4d9169c, 0x00c4ff8f, 0x0300111e, 0x03020200, 0x00000001,
+    0x00000000, 0x01000000, 0x20311011, 0x51413021, 0x00daff61, 0x01030108,
+    0x94103f01, 0x43082184, 0xc47ef6b2, 0x5003af3f, 0xe3c620fc, 0xe1bd6968,
+    0x10f593af, 0x2d8e26e7, 0xc8ba7d14, 0xb5b81a42, 0xa2218410, 0x8889dee0,
+    0xb9651a42, 0x0b324298, 0x82f27d59, 0x420821d6, 0xffc78410, 0x111f00c4,
+    0x02000300, 0x01010302, 0x00000000, 0x00000000, 0x20110100, 0x41211031,
+    0x71306151, 0x0800daff, 0x01010201, 0xbfb0103f, 0x29855f0a, 0x93c7974e,
+    0xfcf453e6, 0x87ef4512, 0xd29aed7f, 0xd7d2c486, 0xdd44c807, 0x6e534a65,
+    0xa2444134, 0xc56e4a29, 0x4d29a560, 0x94922798, 0x29b729a5, 0x514a695e,
+    0x6fd695ef, 0xffe5529a, 0x102400c4, 0x02000101, 0x02000302, 0x00000501,
+    0x00000000, 0x21001101, 0x51416131, 0x10a12071, 0xc1b19181, 0x00daffd1,
+    0x00010108, 0x5a103f01, 0x4242a5b8, 0x81a210d8, 0x22283f80, 0x3513c964,
+    0xdf1c264f, 0xfa43d693, 0x216b16b1, 0x632e08a7, 0x58372d96, 0x29000308,
+    0xe6954080, 0x29bc8f00, 0xc9d84243, 0xbd618688, 0x9464d745, 0xe772da18,
+    0x08503aca, 0x9329149b, 0x6a5dd816, 0x9785a861, 0x8793f90b, 0x03a93426,
+    0x05058d77, 0x52a129c1, 0x70831122, 0x6e818a27, 0x6888909b, 0x1fd4b842,
+    0x1b16b7d0, 0xafba136c, 0x8dcfd879, 0x37f9d93a, 0x065fa980, 0x6d492c25,
+    0x5d2ca113, 0xaf144552, 0x35d10243, 0xdb1ac5a6, 0xc81d9372, 0x733b1a2e,
+    0xbc0aa642, 0xb9a8e74f, 0x48d38246, 0xb6cbaaf3, 0x1a6e1094, 0x4e42ac75,
+    0xa2d980f2, 0xe1f2eaab, 0x365e34b1, 0x599f411f, 0xe99cc9dc, 0xdb4ca1e2,
+    0xdebc1b5a, 0xf48bf4e9, 0x4182d940, 0xa17e0ba6, 0x91868816, 0x1597e610,
+    0x29128ead, 0xa1dafd48, 0x11e4ea0d, 0x8b852a15, 0xaa2371a3, 0x85318dd1,
+    0xc8012979, 0xe11802b2, 0x5672b470, 0x3f186d80, 0xcf25ed8a, 0xfda12b6c,
+    0x714d8bb3, 0x4e400aac, 0xa17212b0, 0xcf7fe541, 0xa0ecc270, 0xb5af7d85,
+    0x09dcbe6a, 0x3eeb33c4, 0xf09bb7f3, 0x40673bfd, 0x938cbe2a, 0xf4782386,
+    0xcfcd3f3a, 0x7e7ddeaf, 0x9ff7ebf3, 0x86edbc5f, 0x8f571dfe, 0x1b02332d,
+    0x26abe008, 0x482e952d, 0x526a0abb, 0x4b666c82, 0x4d95a3ab, 0x393ec45e,
+    0xf5599ff5, 0x9df5599f, 0x5aa8f8a4, 0x22a886ba, 0x46344029, 0x78bfce39,
+    0xcb882407, 0x98181387, 0x1a1990ab, 0x31a9538f, 0x799f01bf, 0x264c5202,
+    0xe22460c6, 0x8284714d, 0x01259e52, 0x26485cdd, 0x45010849, 0xa08a7473,
+    0x085a029f, 0xe258fa80, 0x0809758e, 0xf8bd4d11, 0x3e76266f, 0xed03812f,
+    0x62c37646, 0x690cf482, 0x934e109f, 0x0982f405, 0x09bdca41, 0xc0329441,
+    0x6b28a8a7, 0xcdfa47a3, 0x792fc007, 0x5c9aae3b, 0x1a2fccb3, 0xc0421cb6,
+    0xcf146a7c, 0xe6d25e82, 0x50219850, 0x68cc973f, 0x984a9354, 0xb1409ba0,
+    0x5a29b9de, 0x3b804a0b, 0x9e193df6, 0xb842ae5d, 0x1550d261, 0x88f80115,
+    0xd8f5709f, 0x492b7a8f, 0x6c67e5df, 0xda4cb3dd, 0x98edd0e6, 0x9491df58,
+    0xa54f05eb, 0x063cd01c, 0x00d9ff7f,
+};
@@ -26,6 +26,7 @@
 #include <stdint.h>
 #include "inc/hw_ints.h"
 #include "inc/hw_memmap.h"
+#include "inc/hw_types.h"
 #include "driverlib/flash.h"
 #include "driverlib/interrupt.h"
 #include "driverlib/gpio.h"
@@ -38,6 +39,13 @@
 #include "utils/uartstdio.h"
 #include "httpserver_raw/httpd.h"
 #include "drivers/pinout.h"
+#include "enet_fs.h"
+#include "enet_rx.h"
+#include "enet_tx.h"
+#include "events.h"
+#include "net_stats.h"
+#include "profile.h"
+#include "timer_wheel.h"
 #include "ethernetip/ei_app_minimal.h"
 
 //*****************************************************************************
@@ -55,7 +63,7 @@
 //! 8-N-1, is used to display messages from this application. Use the
 //! following command to re-build the any file system files that change.
 //!
-//!     ../../../../tools/bin/makefsfile -i fs -o enet_fsdata.h -r -h -q
+//!     make fsdata
 //!
 //! For additional details on lwIP, refer to the lwIP web page at:
 //! http://savannah.nongnu.org/projects/lwip/
@@ -67,9 +75,47 @@
 // Defines for setting up the system clock.
 //
 //*****************************************************************************
-#define SYSTICKHZ               100
+#define SYSTICKHZ               1000
 #define SYSTICKMS               (1000 / SYSTICKHZ)
 
+//*****************************************************************************
+//
+// The periods, in milliseconds, of the timing wheel timers that run the lwIP
+// timers, blink the LED and run the EtherNet/IP application.
+//
+//*****************************************************************************
+#define LWIP_TIMER_MS           10
+#define LED_TIMER_MS            10
+#define EI_APP_TIMER_MS         10
+
+//*****************************************************************************
+//
+// Set to 1 to print the profiling probes and the use of the lwIP memory pools
+// on the UART at the periods below.  The main loop is held up for as long as
+// each print takes, so they are otherwise only fetched as /profile.json and
+// /pools.json.
+//
+//*****************************************************************************
+#ifndef STATS_UART_DUMP
+#define STATS_UART_DUMP         0
+#endif
+
+//*****************************************************************************
+//
+// The period, in milliseconds, at which the profiling probes are printed on
+// the UART.  They can also be fetched at any time as /profile.json.
+//
+//*****************************************************************************
+#define PROFILE_DUMP_MS         10000
+
+//*****************************************************************************
+//
+// The period, in milliseconds, at which the use of the lwIP memory pools is
+// printed on the UART.  It can also be fetched at any time as /pools.json.
+//
+//*****************************************************************************
+#define NET_STATS_DUMP_MS       10000
+
 //*****************************************************************************
 //
 // Interrupt priority definitions.  The top 3 bits of these values are
@@ -81,25 +127,33 @@
 
 //*****************************************************************************
 //
-// The current IP address.
+// The timing wheel timers that run the lwIP timers, blink the LED and run
+// the EtherNet/IP application.
 //
 //*****************************************************************************
-uint32_t g_ui32IPAddress;
+static tTimer g_sLwIPTimer;
+static tTimer g_sLEDTimer;
+static tTimer g_sEIAppTimer;
+#if PROFILE_ENABLE && STATS_UART_DUMP
+static tTimer g_sProfileTimer;
+#endif
+#if MEMP_STATS && STATS_UART_DUMP
+static tTimer g_sNetStatsTimer;
+#endif
 
 //*****************************************************************************
 //
-// The system clock frequency.
+// The current IP address.
 //
 //*****************************************************************************
-uint32_t g_ui32SysClock;
+uint32_t g_ui32IPAddress;
 
 //*****************************************************************************
 //
-// Volatile global flag to manage LED blinking, since it is used in interrupt
-// and main application.  The LED blinks at the rate of SYSTICKHZ.
+// The system clock frequency.
 //
 //*****************************************************************************
-volatile bool g_bLED;
+uint32_t g_ui32SysClock;
 
 //*****************************************************************************
 //
@@ -209,15 +263,130 @@ void
 SysTickIntHandler(void)
 {
     //
-    // Call the lwIP timer handler.
+    // Run the SD card driver's timers.  These stay in the interrupt because
+    // the driver waits on them while the main loop is reading the card.
     //
-    lwIPTimer(SYSTICKMS);
+    fs_tick(SYSTICKMS);
 
     //
-    // Tell the application to change the state of the LED (in other words
-    // blink).
+    // Count the tick for the timing wheel and tell the main loop that it has
+    // passed.
     //
-    g_bLED = true;
+    TimerWheelTick();
+    EventTick();
+}
+
+//*****************************************************************************
+//
+// Call the lwIP timer handler.  This runs from the timing wheel.
+//
+//*****************************************************************************
+static void
+LwIPTimerCallback(void *pvArg)
+{
+    lwIPTimer(LWIP_TIMER_MS);
+}
+
+//*****************************************************************************
+//
+// Toggle the LED.  This runs from the timing wheel.
+//
+//*****************************************************************************
+static void
+LEDTimerCallback(void *pvArg)
+{
+    MAP_GPIOPinWrite(GPIO_PORTN_BASE, GPIO_PIN_1,
+                     (MAP_GPIOPinRead(GPIO_PORTN_BASE, GPIO_PIN_1) ^
+                      GPIO_PIN_1));
+}
+
+//*****************************************************************************
+//
+// Run the EtherNet/IP application.  This runs from the timing wheel.
+//
+//*****************************************************************************
+static void
+EIAppTimerCallback(void *pvArg)
+{
+    PROFILE_BEGIN(PROFILE_EI_APP);
+    EI_APP_Process();
+    PROFILE_END(PROFILE_EI_APP);
+}
+
+#if PROFILE_ENABLE && STATS_UART_DUMP
+//*****************************************************************************
+//
+// Print the profiling probes on the UART.  This runs from the timing wheel.
+//
+//*****************************************************************************
+static void
+ProfileTimerCallback(void *pvArg)
+{
+    ProfileDump();
+}
+#endif
+
+#if MEMP_STATS && STATS_UART_DUMP
+//*****************************************************************************
+//
+// Print the use of the lwIP memory pools on the UART.  This runs from the
+// timing wheel.
+//
+//*****************************************************************************
+static void
+NetStatsTimerCallback(void *pvArg)
+{
+    NetStatsPoolDump();
+}
+#endif
+
+//*****************************************************************************
+//
+// Handle received frames.  If more are waiting than one call may hand to
+// lwIP, post the event again so that the rest are handled after any other
+// events that are waiting.
+//
+//*****************************************************************************
+static void
+NetRxEventHandler(void)
+{
+    if(EnetRxProcess())
+    {
+        EventPost(EVENT_NET_RX);
+    }
+}
+
+//*****************************************************************************
+//
+// Handle a SysTick tick.  This runs the timing wheel timers that are due.
+//
+//*****************************************************************************
+static void
+TimerEventHandler(void)
+{
+    PROFILE_BEGIN(PROFILE_TIMER_WHEEL);
+    TimerWheelProcess();
+    PROFILE_END(PROFILE_TIMER_WHEEL);
+}
+
+//*****************************************************************************
+//
+// Read ahead from the SD card for the web server.
+//
+//*****************************************************************************
+static void
+FSEventHandler(void)
+{
+    bool bMore;
+
+    PROFILE_BEGIN(PROFILE_FS_PROCESS);
+    bMore = fs_process();
+    PROFILE_END(PROFILE_FS_PROCESS);
+
+    if(bMore)
+    {
+        EventPost(EVENT_FS);
+    }
 }
 
 //*****************************************************************************
@@ -276,8 +445,15 @@ main(void)
     MAP_GPIOPinWrite(GPIO_PORTN_BASE, GPIO_PIN_1, ~GPIO_PIN_1);
 
     //
-    // Configure SysTick for a periodic interrupt.
+    // Start the cycle counter used by the profiling probes.
+    //
+    ProfileInit();
+
+    //
+    // Configure SysTick for a periodic interrupt, which also times the
+    // main loop's sleep for the CPU usage measurement.
     //
+    EventInit(g_ui32SysClock / SYSTICKHZ);
     MAP_SysTickPeriodSet(g_ui32SysClock / SYSTICKHZ);
     MAP_SysTickEnable();
     MAP_SysTickIntEnable();
@@ -323,6 +499,17 @@ main(void)
     //
     lwIPInit(g_ui32SysClock, pui8MACArray, 0, 0, 0, IPADDR_USE_DHCP);
 
+    //
+    // Move the processing of received frames out of the Ethernet interrupt
+    // and into the main loop.
+    //
+    EnetRxInit();
+
+    //
+    // Queue frames for transmit by priority, with EtherNet/IP I/O first.
+    //
+    EnetTxInit();
+
     //
     // Setup the device locator service.
     //
@@ -331,16 +518,22 @@ main(void)
     LocatorAppTitleSet("EK-TM4C1294XL enet_io");
 
     //
-    // Initialize a sample httpd server.
+    // Mount the SD card file system and initialize a sample httpd server.
     //
+    fs_init();
+    FSGeneratedFileAdd("/profile.json", ProfileJSONGenerate);
+    FSGeneratedFileAdd("/pools.json", NetStatsPoolJSONGenerate);
+    FSGeneratedFileAdd("/stats.json", NetStatsJSONGenerate);
+    FSGeneratedFileAdd("/tx.json", EnetTxJSONGenerate);
     httpd_init();
 
     //
     // Set the interrupt priorities.  We set the SysTick interrupt to a higher
     // priority than the Ethernet interrupt to ensure that the file system
     // tick is processed if SysTick occurs while the Ethernet handler is being
-    // processed.  This is very likely since all the TCP/IP and HTTP work is
-    // done in the context of the Ethernet interrupt.
+    // processed.  This matters when ENET_RX_DEFERRED is 0 and all the TCP/IP
+    // and HTTP work is done in the context of the Ethernet interrupt;
+    // otherwise that work is done by EnetRxProcess() in the main loop.
     //
     MAP_IntPrioritySet(INT_EMAC0, ETHERNET_INT_PRIORITY);
     MAP_IntPrioritySet(FAULT_SYSTICK, SYSTICK_INT_PRIORITY);
@@ -351,31 +544,28 @@ main(void)
     }
 
     //
-    // Loop forever, processing the LED blinking.  All the work is done in
-    // interrupt handlers.
-    //
-    while(1)
-    {
-        //
-        // Wait till the SysTick Interrupt indicates to change the state of the
-        // LED.
-        //
-        while(g_bLED == false)
-        {
-        }
-
-        EI_APP_Process();
-        
-        //
-        // Clear the flag.
-        //
-        g_bLED = false;
-
-        //
-        // Toggle the LED.
-        //
-        MAP_GPIOPinWrite(GPIO_PORTN_BASE, GPIO_PIN_1,
-                         (MAP_GPIOPinRead(GPIO_PORTN_BASE, GPIO_PIN_1) ^
-                          GPIO_PIN_1));
-    }
+    // Run the main loop, which sleeps until an interrupt posts an event and
+    // then runs its handler.  Received frames are handled first, then the
+    // tick, then SD card reads for the web server.  The board I/O and NVM
+    // drivers can set handlers for EVENT_IO_CHANGE and EVENT_NVM_COMPLETE
+    // and post them from their own interrupts.
+    //
+    TimerWheelAdd(&g_sLwIPTimer, LWIP_TIMER_MS, LWIP_TIMER_MS,
+                  LwIPTimerCallback, 0);
+    TimerWheelAdd(&g_sLEDTimer, LED_TIMER_MS, LED_TIMER_MS, LEDTimerCallback,
+                  0);
+    TimerWheelAdd(&g_sEIAppTimer, EI_APP_TIMER_MS, EI_APP_TIMER_MS,
+                  EIAppTimerCallback, 0);
+#if PROFILE_ENABLE && STATS_UART_DUMP
+    TimerWheelAdd(&g_sProfileTimer, PROFILE_DUMP_MS, PROFILE_DUMP_MS,
+                  ProfileTimerCallback, 0);
+#endif
+#if MEMP_STATS && STATS_UART_DUMP
+    TimerWheelAdd(&g_sNetStatsTimer, NET_STATS_DUMP_MS, NET_STATS_DUMP_MS,
+                  NetStatsTimerCallback, 0);
+#endif
+    EventHandlerSet(EVENT_NET_RX, NetRxEventHandler);
+    EventHandlerSet(EVENT_TIMER, TimerEventHandler);
+    EventHandlerSet(EVENT_FS, FSEventHandler);
+    EventLoopRun();
 }
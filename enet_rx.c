@@ -0,0 +1,696 @@
+//*****************************************************************************
+//
+// enet_rx.c - Deferred, budgeted Ethernet receive processing.
+//
+// lwiplib normally runs all of lwIP, including every received frame, in the
+// Ethernet interrupt, so a burst of traffic holds off everything else for as
+// long as it lasts.  This module takes over the Ethernet interrupt vector.
+// The interrupt only masks itself and flags the main loop; received frames
+// stay in the DMA descriptors until EnetRxProcess() runs the lwiplib handler
+// from the main loop.  The frames it receives are queued by class, and then
+// handed to lwIP no more than ENET_RX_BUDGET at a time, highest class first.
+// EtherNet/IP class 1 I/O datagrams skip the queues and lwIP altogether and
+// go straight to the function given to EnetRxIOHandlerSet().
+//
+// Copyright (c) 2025 Texas Instruments Incorporated.
+//
+//*****************************************************************************
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "inc/hw_emac.h"
+#include "inc/hw_ints.h"
+#include "inc/hw_memmap.h"
+#include "inc/hw_types.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/rom_map.h"
+#include "utils/lwiplib.h"
+#include "lwip/memp.h"
+#include "lwip/stats.h"
+#include "enet_rx.h"
+#include "enet_tx.h"
+#include "events.h"
+#include "profile.h"
+
+//*****************************************************************************
+//
+// The Cortex-M4 debug registers used to count processor cycles.
+//
+//*****************************************************************************
+#define ENET_RX_DEMCR           0xE000EDFC
+#define ENET_RX_DEMCR_TRCENA    0x01000000
+#define ENET_RX_DWT_CTRL        0xE0001000
+#define ENET_RX_DWT_CTRL_CYCENA 0x00000001
+#define ENET_RX_DWT_CYCCNT      0xE0001004
+
+//*****************************************************************************
+//
+// The fields of a received frame that it is classified by.
+//
+//*****************************************************************************
+#define ENET_RX_ETH_HDR_LEN     14
+#define ENET_RX_UDP_HDR_LEN     8
+#define ENET_RX_ETHTYPE_IP      0x0800
+#define ENET_RX_ETHTYPE_ARP     0x0806
+#define ENET_RX_IP_PROTO_TCP    6
+#define ENET_RX_IP_PROTO_UDP    17
+#define ENET_RX_PORT_EIP_IO     2222
+#define ENET_RX_PORT_EIP_ENCAP  44818
+#define ENET_RX_PORT_HTTP       80
+#define ENET_RX_TCP_FLAGS_SYN   0x02
+#define ENET_RX_TCP_FLAGS_ACK   0x10
+
+//*****************************************************************************
+//
+// Every frame waiting in the queues holds a pbuf from the pool, as does every
+// receive descriptor, so the pool must have enough for all of them.
+//
+//*****************************************************************************
+#if ENET_RX_DEFERRED &&                                                       \
+    (PBUF_POOL_SIZE < (NUM_RX_DESCRIPTORS +                                   \
+                       (ENET_RX_NUM_CLASSES * ENET_RX_QUEUE_LEN)))
+#error "PBUF_POOL_SIZE is too small for the receive ring and queues"
+#endif
+
+#if ENET_RX_DEFERRED
+//*****************************************************************************
+//
+// A queue of received frames, held as a ring of pbuf pointers.
+//
+//*****************************************************************************
+typedef struct
+{
+    struct pbuf *ppsFrames[ENET_RX_QUEUE_LEN];
+    uint32_t ui32Head;
+    uint32_t ui32Count;
+}
+tEnetRxQueue;
+
+//*****************************************************************************
+//
+// The queue for each class of frame.
+//
+//*****************************************************************************
+static tEnetRxQueue g_psEnetRxQueues[ENET_RX_NUM_CLASSES];
+
+//*****************************************************************************
+//
+// The input function lwiplib gave the interface, which the queued frames are
+// handed on to.
+//
+//*****************************************************************************
+static netif_input_fn g_pfnEnetRxInput;
+
+//*****************************************************************************
+//
+// Set by the Ethernet interrupt to have EnetRxProcess() run the lwiplib
+// handler.
+//
+//*****************************************************************************
+static volatile bool g_bEnetRxPending;
+
+//*****************************************************************************
+//
+// The function that class 1 I/O datagrams are handed to, if one has been
+// given.
+//
+//*****************************************************************************
+static tEnetRxIOHandler g_pfnEnetRxIOHandler;
+
+//*****************************************************************************
+//
+// The profiler count at the Ethernet interrupt that the frames being handled
+// by the lwiplib handler were received in.  The interrupt stays masked until
+// they have all been handled, so it is not overwritten meanwhile.
+//
+//*****************************************************************************
+static uint32_t g_ui32EnetRxIntCount;
+
+//*****************************************************************************
+//
+// The frame that EnetRxProcess() is handing to lwIP, kept since lwIP moves
+// the payload pointer of the pbuf as it strips the headers.  NULL at any
+// other time.
+//
+//*****************************************************************************
+static const uint8_t *g_pui8EnetRxInputFrame;
+static uint32_t g_ui32EnetRxInputLen;
+#endif
+
+#if ENET_RX_DEFERRED && RX_SMALL_PBUF_NUM
+//*****************************************************************************
+//
+// A pbuf from the small pool.  The frame is held in the buffer that follows
+// the pbuf itself.
+//
+//*****************************************************************************
+typedef struct
+{
+    struct pbuf_custom sPbuf;
+    uint8_t pui8Data[LWIP_MEM_ALIGN_SIZE(RX_SMALL_PBUF_SIZE)];
+}
+tEnetRxSmallPbuf;
+#endif
+
+//*****************************************************************************
+//
+// The receive path counters.
+//
+//*****************************************************************************
+static tEnetRxStats g_sEnetRxStats;
+
+//*****************************************************************************
+//
+// Count an interrupt duration, in cycles, in the histogram.
+//
+//*****************************************************************************
+static void
+EnetRxISRCyclesCount(uint32_t ui32Cycles)
+{
+    uint32_t ui32Bucket;
+
+    ui32Bucket = 0;
+    while(ui32Cycles >>= 1)
+    {
+        ui32Bucket++;
+    }
+
+    g_sEnetRxStats.pui32ISRCycles[ui32Bucket]++;
+}
+
+#if ENET_RX_DEFERRED && RX_SMALL_PBUF_NUM
+//*****************************************************************************
+//
+// Return a small pbuf to its pool.  lwIP calls this when the pbuf is freed.
+//
+//*****************************************************************************
+static void
+EnetRxSmallFree(struct pbuf *psPbuf)
+{
+    memp_free(MEMP_RX_SMALL, psPbuf);
+}
+
+//*****************************************************************************
+//
+// Move a short frame out of the full-size pbuf the driver received it into
+// and into a pbuf from the small pool, which frees the full-size pbuf for
+// the driver to refill the receive ring with.  Returns the frame in
+// whichever pbuf now holds it.
+//
+//*****************************************************************************
+static struct pbuf *
+EnetRxSmallCopy(struct pbuf *psFrame)
+{
+    tEnetRxSmallPbuf *psSmall;
+    struct pbuf *psPbuf;
+
+    if(psFrame->tot_len > RX_SMALL_PBUF_SIZE)
+    {
+        g_sEnetRxStats.psPools[ENET_RX_POOL_LARGE].ui32Frames++;
+        return(psFrame);
+    }
+
+    psSmall = memp_malloc(MEMP_RX_SMALL);
+    if(psSmall == NULL)
+    {
+        g_sEnetRxStats.psPools[ENET_RX_POOL_LARGE].ui32Frames++;
+        return(psFrame);
+    }
+
+    psSmall->sPbuf.custom_free_function = EnetRxSmallFree;
+    psPbuf = pbuf_alloced_custom(PBUF_RAW, psFrame->tot_len, PBUF_RAM,
+                                 &psSmall->sPbuf, psSmall->pui8Data,
+                                 sizeof(psSmall->pui8Data));
+    pbuf_copy_partial(psFrame, psPbuf->payload, psFrame->tot_len, 0);
+    pbuf_free(psFrame);
+
+    g_sEnetRxStats.psPools[ENET_RX_POOL_SMALL].ui32Frames++;
+
+    return(psPbuf);
+}
+#endif
+
+#if ENET_RX_DEFERRED
+//*****************************************************************************
+//
+// Hand a received frame to the class 1 I/O handler if it is an unfragmented
+// IPv4 UDP datagram for port 2222 addressed to this interface or to a
+// multicast group.  Returns true if the handler took the frame.  Checksums
+// are not checked here since the MAC drops frames that fail them.
+//
+//*****************************************************************************
+static bool
+EnetRxIODeliver(struct pbuf *psFrame)
+{
+    uint8_t *pui8IP, *pui8UDP;
+    uint32_t ui32IPLen, ui32UDPLen, ui32DstAddr;
+    bool bTaken;
+
+    pui8IP = (uint8_t *)psFrame->payload + ETH_PAD_SIZE + ENET_RX_ETH_HDR_LEN;
+    if((psFrame->len < (ETH_PAD_SIZE + ENET_RX_ETH_HDR_LEN + 20 +
+                        ENET_RX_UDP_HDR_LEN)) ||
+       (pui8IP[-2] != (ENET_RX_ETHTYPE_IP >> 8)) ||
+       (pui8IP[-1] != (ENET_RX_ETHTYPE_IP & 0xff)) ||
+       ((pui8IP[0] >> 4) != 4) ||
+       (pui8IP[9] != ENET_RX_IP_PROTO_UDP) ||
+       (((pui8IP[6] & 0x3f) | pui8IP[7]) != 0))
+    {
+        return(false);
+    }
+
+    ui32IPLen = (pui8IP[0] & 0x0f) * 4;
+    pui8UDP = pui8IP + ui32IPLen;
+    if((psFrame->len < (ETH_PAD_SIZE + ENET_RX_ETH_HDR_LEN + ui32IPLen +
+                        ENET_RX_UDP_HDR_LEN)) ||
+       (pui8UDP[2] != (ENET_RX_PORT_EIP_IO >> 8)) ||
+       (pui8UDP[3] != (ENET_RX_PORT_EIP_IO & 0xff)))
+    {
+        return(false);
+    }
+
+    //
+    // Leave datagrams for other hosts, and those whose length does not fit
+    // the frame, to lwIP.
+    //
+    ui32DstAddr = pui8IP[16] | (pui8IP[17] << 8) | (pui8IP[18] << 16) |
+                  ((uint32_t)pui8IP[19] << 24);
+    ui32UDPLen = (pui8UDP[4] << 8) | pui8UDP[5];
+    if(((ui32DstAddr != netif_default->ip_addr.addr) &&
+        ((pui8IP[16] & 0xf0) != 0xe0)) ||
+       (ui32UDPLen < ENET_RX_UDP_HDR_LEN) ||
+       (psFrame->len < (ETH_PAD_SIZE + ENET_RX_ETH_HDR_LEN + ui32IPLen +
+                        ui32UDPLen)))
+    {
+        return(false);
+    }
+
+    //
+    // Time from the interrupt to the handler, which is how long the datagram
+    // waited in the descriptors for the main loop.
+    //
+#if PROFILE_ENABLE
+    ProfileRecord(PROFILE_EIP_IO_LATENCY,
+                  ProfileCountGet() - g_ui32EnetRxIntCount);
+#endif
+
+    PROFILE_BEGIN(PROFILE_EIP_IO);
+    bTaken = g_pfnEnetRxIOHandler(pui8UDP + ENET_RX_UDP_HDR_LEN,
+                                  ui32UDPLen - ENET_RX_UDP_HDR_LEN,
+                                  (pui8IP[12] | (pui8IP[13] << 8) |
+                                   (pui8IP[14] << 16) |
+                                   ((uint32_t)pui8IP[15] << 24)),
+                                  (pui8UDP[0] << 8) | pui8UDP[1]);
+    PROFILE_END(PROFILE_EIP_IO);
+
+    return(bTaken);
+}
+
+//*****************************************************************************
+//
+// Find the class of a received frame from its Ethernet, IP and UDP or TCP
+// headers.
+//
+//*****************************************************************************
+static uint32_t
+EnetRxClassify(struct pbuf *psFrame)
+{
+    uint8_t *pui8Frame;
+    uint32_t ui32Type, ui32IPLen, ui32Port;
+
+    pui8Frame = (uint8_t *)psFrame->payload + ETH_PAD_SIZE;
+    if(psFrame->len < (ETH_PAD_SIZE + ENET_RX_ETH_HDR_LEN + 20))
+    {
+        return(ENET_RX_CLASS_LOW);
+    }
+
+    ui32Type = (pui8Frame[12] << 8) | pui8Frame[13];
+    if(ui32Type == ENET_RX_ETHTYPE_ARP)
+    {
+        return(ENET_RX_CLASS_HIGH);
+    }
+    if(ui32Type != ENET_RX_ETHTYPE_IP)
+    {
+        return(ENET_RX_CLASS_LOW);
+    }
+
+    //
+    // Only the first fragment of a datagram carries the port numbers.
+    //
+    pui8Frame += ENET_RX_ETH_HDR_LEN;
+    ui32IPLen = (pui8Frame[0] & 0x0f) * 4;
+    if(((pui8Frame[9] != ENET_RX_IP_PROTO_UDP) &&
+        (pui8Frame[9] != ENET_RX_IP_PROTO_TCP)) ||
+       (((pui8Frame[6] & 0x1f) | pui8Frame[7]) != 0) ||
+       (psFrame->len < (ETH_PAD_SIZE + ENET_RX_ETH_HDR_LEN + ui32IPLen + 4)))
+    {
+        return(ENET_RX_CLASS_LOW);
+    }
+
+    ui32Port = (pui8Frame[ui32IPLen + 2] << 8) | pui8Frame[ui32IPLen + 3];
+
+    //
+    // Count the connections opened to the web server by the segment that
+    // opens each, which has SYN set and ACK clear.
+    //
+    if((ui32Port == ENET_RX_PORT_HTTP) &&
+       (pui8Frame[9] == ENET_RX_IP_PROTO_TCP) &&
+       (psFrame->len >= (ETH_PAD_SIZE + ENET_RX_ETH_HDR_LEN + ui32IPLen +
+                         14)) &&
+       ((pui8Frame[ui32IPLen + 13] &
+         (ENET_RX_TCP_FLAGS_SYN | ENET_RX_TCP_FLAGS_ACK)) ==
+        ENET_RX_TCP_FLAGS_SYN))
+    {
+        g_sEnetRxStats.ui32HTTPConnections++;
+    }
+
+    if((ui32Port == ENET_RX_PORT_EIP_IO) ||
+       (ui32Port == ENET_RX_PORT_EIP_ENCAP))
+    {
+        return(ENET_RX_CLASS_HIGH);
+    }
+
+    return(ENET_RX_CLASS_LOW);
+}
+
+//*****************************************************************************
+//
+// The input function given to the interface in place of lwiplib's.  This is
+// called by the lwiplib handler for each received frame, and queues the
+// frame by class, unless it is a class 1 I/O datagram that the I/O handler
+// takes.  If the queue is full the frame is dropped.
+//
+//*****************************************************************************
+static err_t
+EnetRxInput(struct pbuf *psFrame, struct netif *psNetif)
+{
+    tEnetRxQueue *psQueue;
+    uint32_t ui32Class;
+
+    if(g_pfnEnetRxIOHandler && EnetRxIODeliver(psFrame))
+    {
+        g_sEnetRxStats.ui32IOFrames++;
+        pbuf_free(psFrame);
+        return(ERR_OK);
+    }
+
+#if RX_SMALL_PBUF_NUM
+    psFrame = EnetRxSmallCopy(psFrame);
+#endif
+
+    ui32Class = EnetRxClassify(psFrame);
+    psQueue = &g_psEnetRxQueues[ui32Class];
+
+    if(psQueue->ui32Count == ENET_RX_QUEUE_LEN)
+    {
+        g_sEnetRxStats.pui32Dropped[ui32Class]++;
+        pbuf_free(psFrame);
+        return(ERR_OK);
+    }
+
+    psQueue->ppsFrames[(psQueue->ui32Head + psQueue->ui32Count) %
+                       ENET_RX_QUEUE_LEN] = psFrame;
+    psQueue->ui32Count++;
+    g_sEnetRxStats.pui32Frames[ui32Class]++;
+
+    return(ERR_OK);
+}
+#endif
+
+//*****************************************************************************
+//
+// Add the frames the MAC has dropped since the last call to the counters.
+// The MAC counters clear when they are read, and each saturates with its
+// overflow bit set.
+//
+//*****************************************************************************
+static void
+EnetRxMissedCount(void)
+{
+    uint32_t ui32Missed;
+
+    ui32Missed = HWREG(EMAC0_BASE + EMAC_O_MFBOC);
+
+    g_sEnetRxStats.ui32RingOverruns += ((ui32Missed & EMAC_MFBOC_MISCNTOVF) ?
+                                        (EMAC_MFBOC_MISFRMCNT_M + 1) :
+                                        (ui32Missed &
+                                         EMAC_MFBOC_MISFRMCNT_M));
+    g_sEnetRxStats.ui32FIFOOverflows +=
+        ((ui32Missed & EMAC_MFBOC_OVFCNTOVF) ?
+         ((EMAC_MFBOC_OVFFRMCNT_M >> EMAC_MFBOC_OVFFRMCNT_S) + 1) :
+         ((ui32Missed & EMAC_MFBOC_OVFFRMCNT_M) >> EMAC_MFBOC_OVFFRMCNT_S));
+}
+
+//*****************************************************************************
+//
+// Set up deferred receive processing.  This must be called after lwIPInit().
+//
+//*****************************************************************************
+void
+EnetRxInit(void)
+{
+    //
+    // Start the cycle counter used to time the interrupt.
+    //
+    HWREG(ENET_RX_DEMCR) |= ENET_RX_DEMCR_TRCENA;
+    HWREG(ENET_RX_DWT_CTRL) |= ENET_RX_DWT_CTRL_CYCENA;
+
+#if ENET_RX_DEFERRED
+    //
+    // Have received frames queued here rather than handed straight to lwIP.
+    //
+    g_pfnEnetRxInput = netif_default->input;
+    netif_default->input = EnetRxInput;
+#endif
+}
+
+//*****************************************************************************
+//
+// The Ethernet interrupt handler.  This takes the place of
+// lwIPEthernetIntHandler() in the vector table.
+//
+//*****************************************************************************
+void
+EnetRxIntHandler(void)
+{
+    uint32_t ui32Start;
+
+    PROFILE_BEGIN(PROFILE_ENET_ISR);
+    ui32Start = HWREG(ENET_RX_DWT_CYCCNT);
+    g_sEnetRxStats.ui32Interrupts++;
+
+#if ENET_RX_DEFERRED
+    //
+    // Leave the interrupt source asserted and mask it, so the frames wait in
+    // the DMA descriptors until EnetRxProcess() runs the lwiplib handler and
+    // unmasks it again.
+    //
+    MAP_IntDisable(INT_EMAC0);
+    g_ui32EnetRxIntCount = ProfileCountGet();
+    g_bEnetRxPending = true;
+#else
+    PROFILE_BEGIN(PROFILE_LWIP_HANDLER);
+    lwIPEthernetIntHandler();
+    PROFILE_END(PROFILE_LWIP_HANDLER);
+    EnetTxProcess();
+#endif
+
+    EventPost(EVENT_NET_RX);
+
+    EnetRxISRCyclesCount(HWREG(ENET_RX_DWT_CYCCNT) - ui32Start);
+    PROFILE_END(PROFILE_ENET_ISR);
+}
+
+//*****************************************************************************
+//
+// Run the deferred Ethernet work and hand up to ENET_RX_BUDGET received
+// frames to lwIP.  This must be called from the main loop, and is where all
+// of lwIP runs when ENET_RX_DEFERRED is set.  Returns true if frames are
+// still waiting, in which case it should be called again soon.
+//
+//*****************************************************************************
+bool
+EnetRxProcess(void)
+{
+#if ENET_RX_DEFERRED
+    tEnetRxQueue *psQueue;
+    struct pbuf *psFrame;
+    uint32_t ui32Class, ui32Budget, ui32Depth;
+#endif
+
+    EnetRxMissedCount();
+
+#if ENET_RX_DEFERRED
+    //
+    // Run the lwiplib handler if the interrupt fired.  This services the
+    // lwIP timers and the transmit side of the driver, and collects received
+    // frames into the queues.  Then fill the transmit descriptors it freed
+    // from the transmit queues.
+    //
+    if(g_bEnetRxPending)
+    {
+        g_bEnetRxPending = false;
+        PROFILE_BEGIN(PROFILE_LWIP_HANDLER);
+        lwIPEthernetIntHandler();
+        PROFILE_END(PROFILE_LWIP_HANDLER);
+        EnetTxProcess();
+        MAP_IntEnable(INT_EMAC0);
+    }
+
+    ui32Depth = 0;
+    for(ui32Class = 0; ui32Class < ENET_RX_NUM_CLASSES; ui32Class++)
+    {
+        ui32Depth += g_psEnetRxQueues[ui32Class].ui32Count;
+    }
+    if(ui32Depth == 0)
+    {
+        return(false);
+    }
+    g_sEnetRxStats.pui32QueueDepth[ui32Depth]++;
+
+    //
+    // Hand frames to lwIP, taking each from the highest class that has one.
+    //
+    for(ui32Budget = ENET_RX_BUDGET; ui32Budget && ui32Depth; ui32Budget--)
+    {
+        for(ui32Class = 0; ui32Class < ENET_RX_NUM_CLASSES; ui32Class++)
+        {
+            psQueue = &g_psEnetRxQueues[ui32Class];
+            if(psQueue->ui32Count != 0)
+            {
+                break;
+            }
+        }
+
+        psFrame = psQueue->ppsFrames[psQueue->ui32Head];
+        psQueue->ui32Head = (psQueue->ui32Head + 1) % ENET_RX_QUEUE_LEN;
+        psQueue->ui32Count--;
+        ui32Depth--;
+
+        PROFILE_BEGIN(PROFILE_LWIP_INPUT);
+        g_pui8EnetRxInputFrame = psFrame->payload;
+        g_ui32EnetRxInputLen = psFrame->len;
+        if(g_pfnEnetRxInput(psFrame, netif_default) != ERR_OK)
+        {
+            pbuf_free(psFrame);
+        }
+        g_pui8EnetRxInputFrame = NULL;
+        PROFILE_END(PROFILE_LWIP_INPUT);
+    }
+
+    return(ui32Depth != 0);
+#else
+    return(false);
+#endif
+}
+
+//*****************************************************************************
+//
+// Set the function that class 1 I/O datagrams are handed to, or clear it
+// with NULL to have them go to lwIP like any other frame.  The function is
+// called from EnetRxProcess().  Datagrams are only taken out of the receive
+// path when ENET_RX_DEFERRED is set.
+//
+//*****************************************************************************
+void
+EnetRxIOHandlerSet(tEnetRxIOHandler pfnHandler)
+{
+#if ENET_RX_DEFERRED
+    g_pfnEnetRxIOHandler = pfnHandler;
+#endif
+}
+
+//*****************************************************************************
+//
+// Find the data of the TCP segment that lwIP is handling, for code called
+// from lwIP as the segment is received, such as the httpd file system, to
+// see more of a request than lwIP hands on.  Returns false if lwIP is not
+// handling a received frame, or the frame is not an unfragmented IPv4 TCP
+// segment held in a single pbuf.  Segments are only seen here when
+// ENET_RX_DEFERRED is set.
+//
+//*****************************************************************************
+bool
+EnetRxTCPDataGet(const uint8_t **ppui8Data, uint32_t *pui32Len)
+{
+#if ENET_RX_DEFERRED
+    const uint8_t *pui8IP, *pui8TCP;
+    uint32_t ui32IPLen, ui32TotalLen, ui32TCPLen;
+
+    if(g_pui8EnetRxInputFrame == NULL)
+    {
+        return(false);
+    }
+
+    pui8IP = g_pui8EnetRxInputFrame + ETH_PAD_SIZE + ENET_RX_ETH_HDR_LEN;
+    if((g_ui32EnetRxInputLen < (ETH_PAD_SIZE + ENET_RX_ETH_HDR_LEN + 20)) ||
+       (pui8IP[-2] != (ENET_RX_ETHTYPE_IP >> 8)) ||
+       (pui8IP[-1] != (ENET_RX_ETHTYPE_IP & 0xff)) ||
+       ((pui8IP[0] >> 4) != 4) ||
+       (pui8IP[9] != ENET_RX_IP_PROTO_TCP) ||
+       (((pui8IP[6] & 0x3f) | pui8IP[7]) != 0))
+    {
+        return(false);
+    }
+
+    //
+    // The IP total length excludes any padding the frame was given to reach
+    // the minimum Ethernet frame size.
+    //
+    ui32IPLen = (pui8IP[0] & 0x0f) * 4;
+    ui32TotalLen = (pui8IP[2] << 8) | pui8IP[3];
+    if((ui32TotalLen < (ui32IPLen + 20)) ||
+       (g_ui32EnetRxInputLen < (ETH_PAD_SIZE + ENET_RX_ETH_HDR_LEN +
+                                ui32TotalLen)))
+    {
+        return(false);
+    }
+
+    pui8TCP = pui8IP + ui32IPLen;
+    ui32TCPLen = (pui8TCP[12] >> 4) * 4;
+    if((ui32TCPLen < 20) || ((ui32IPLen + ui32TCPLen) > ui32TotalLen))
+    {
+        return(false);
+    }
+
+    *ppui8Data = pui8TCP + ui32TCPLen;
+    *pui32Len = ui32TotalLen - ui32IPLen - ui32TCPLen;
+    return(true);
+#else
+    return(false);
+#endif
+}
+
+//*****************************************************************************
+//
+// Return a copy of the receive path counters.
+//
+//*****************************************************************************
+void
+EnetRxStatsGet(tEnetRxStats *psStats)
+{
+    *psStats = g_sEnetRxStats;
+
+    //
+    // The driver refills descriptors from the pbuf pool, which nothing else
+    // in this application allocates from, so the pool's allocation failures
+    // are the refill failures.
+    //
+#if MEMP_STATS
+    psStats->ui32RefillFailures = lwip_stats.memp[MEMP_PBUF_POOL].err;
+
+    psStats->psPools[ENET_RX_POOL_LARGE].ui32InUse =
+        lwip_stats.memp[MEMP_PBUF_POOL].used;
+    psStats->psPools[ENET_RX_POOL_LARGE].ui32HighWater =
+        lwip_stats.memp[MEMP_PBUF_POOL].max;
+    psStats->psPools[ENET_RX_POOL_LARGE].ui32Failures =
+        lwip_stats.memp[MEMP_PBUF_POOL].err;
+#if RX_SMALL_PBUF_NUM
+    psStats->psPools[ENET_RX_POOL_SMALL].ui32InUse =
+        lwip_stats.memp[MEMP_RX_SMALL].used;
+    psStats->psPools[ENET_RX_POOL_SMALL].ui32HighWater =
+        lwip_stats.memp[MEMP_RX_SMALL].max;
+    psStats->psPools[ENET_RX_POOL_SMALL].ui32Failures =
+        lwip_stats.memp[MEMP_RX_SMALL].err;
+#endif
+#endif
+}
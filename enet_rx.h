@@ -0,0 +1,170 @@
+//*****************************************************************************
+//
+// enet_rx.h - Deferred, budgeted Ethernet receive processing.
+//
+// Copyright (c) 2025 Texas Instruments Incorporated.
+//
+//*****************************************************************************
+
+#ifndef __ENET_RX_H__
+#define __ENET_RX_H__
+
+//*****************************************************************************
+//
+// If building with a C++ compiler, make all of the definitions in this header
+// have a C binding.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+// Set to 1 to run lwIP from the main loop.  The Ethernet interrupt then only
+// masks itself and flags the main loop, and received frames are queued by
+// class and handed to lwIP a budgeted number at a time by EnetRxProcess().
+// Set to 0 to run lwIP in the Ethernet interrupt as before, which is useful
+// for comparing the two with the histograms below.
+//
+//*****************************************************************************
+#ifndef ENET_RX_DEFERRED
+#define ENET_RX_DEFERRED        1
+#endif
+
+//*****************************************************************************
+//
+// The most frames handed to lwIP by each call to EnetRxProcess(), and the
+// most frames that can wait in the queue of each class.
+//
+//*****************************************************************************
+#ifndef ENET_RX_BUDGET
+#define ENET_RX_BUDGET          8
+#endif
+
+#ifndef ENET_RX_QUEUE_LEN
+#define ENET_RX_QUEUE_LEN       16
+#endif
+
+//*****************************************************************************
+//
+// The classes that received frames are queued by.  High priority frames are
+// ARP and EtherNet/IP traffic (UDP port 2222 I/O and port 44818
+// encapsulation), and are always handed to lwIP before any others.
+//
+//*****************************************************************************
+#define ENET_RX_CLASS_HIGH      0
+#define ENET_RX_CLASS_LOW       1
+#define ENET_RX_NUM_CLASSES     2
+
+//*****************************************************************************
+//
+// The function called with the data of each EtherNet/IP class 1 I/O
+// datagram, which is a UDP datagram for port 2222 addressed to this
+// interface or to a multicast group.  These are taken out of the receive
+// path before they are queued and never reach lwIP, unless the function
+// returns false, in which case the frame is queued for lwIP as usual.  The
+// source address is in network byte order, as in an lwIP ip_addr_t, and the
+// data is only valid until the function returns.
+//
+//*****************************************************************************
+typedef bool (*tEnetRxIOHandler)(const uint8_t *pui8Data, uint32_t ui32Len,
+                                 uint32_t ui32SrcAddr, uint32_t ui32SrcPort);
+
+//*****************************************************************************
+//
+// The pools that received frames are held in.  Frames of up to
+// RX_SMALL_PBUF_SIZE bytes are moved into a pbuf from the small pool, and
+// all others stay in the full-size pbuf from PBUF_POOL that the driver
+// received them into.
+//
+//*****************************************************************************
+#define ENET_RX_POOL_SMALL      0
+#define ENET_RX_POOL_LARGE      1
+#define ENET_RX_NUM_POOLS       2
+
+//*****************************************************************************
+//
+// Counters kept for each pool of received frames.  ui32Frames is the number
+// of frames that have been held in the pool.  The others come from the lwIP
+// memp statistics and are zero if MEMP_STATS is off: ui32InUse is the number
+// of pbufs currently allocated, ui32HighWater the most that have been
+// allocated at once, and ui32Failures the number of allocations that failed.
+// A small frame that cannot get a small pbuf stays in its full-size pbuf.
+//
+//*****************************************************************************
+typedef struct
+{
+    uint32_t ui32Frames;
+    uint32_t ui32InUse;
+    uint32_t ui32HighWater;
+    uint32_t ui32Failures;
+}
+tEnetRxPoolStats;
+
+//*****************************************************************************
+//
+// The number of buckets in the interrupt duration histogram.  Bucket N counts
+// interrupts that took from 2^N up to 2^(N+1) - 1 processor cycles, and
+// bucket 0 also counts those that took no cycles at all.
+//
+//*****************************************************************************
+#define ENET_RX_ISR_BUCKETS     32
+
+//*****************************************************************************
+//
+// Counters kept by the receive path.  pui32QueueDepth is a histogram of the
+// number of frames waiting in all queues each time EnetRxProcess() finds
+// work to do.  ui32IOFrames counts the class 1 I/O datagrams handed to the
+// function given to EnetRxIOHandlerSet() rather than to lwIP.
+// ui32HTTPConnections counts the TCP connections that clients opened to the
+// web server on port 80, including any refused for want of a PCB; a SYN that
+// the client sent again counts again.  Frames are only classified, and
+// these connections counted, when ENET_RX_DEFERRED is set.
+//
+// ui32RingOverruns counts frames the MAC dropped because every receive
+// descriptor was full, and ui32FIFOOverflows those dropped because its
+// receive FIFO overflowed.  ui32RefillFailures counts the times a pbuf could
+// not be taken from the pool to refill a descriptor; the frame in that
+// descriptor is then dropped so that it can be reused.
+//
+//*****************************************************************************
+typedef struct
+{
+    uint32_t ui32Interrupts;
+    uint32_t ui32RingOverruns;
+    uint32_t ui32FIFOOverflows;
+    uint32_t ui32RefillFailures;
+    uint32_t ui32IOFrames;
+    uint32_t ui32HTTPConnections;
+    uint32_t pui32Frames[ENET_RX_NUM_CLASSES];
+    uint32_t pui32Dropped[ENET_RX_NUM_CLASSES];
+    uint32_t pui32ISRCycles[ENET_RX_ISR_BUCKETS];
+    uint32_t pui32QueueDepth[(ENET_RX_NUM_CLASSES * ENET_RX_QUEUE_LEN) + 1];
+    tEnetRxPoolStats psPools[ENET_RX_NUM_POOLS];
+}
+tEnetRxStats;
+
+//*****************************************************************************
+//
+// Prototypes.
+//
+//*****************************************************************************
+extern void EnetRxInit(void);
+extern void EnetRxIntHandler(void);
+extern bool EnetRxProcess(void);
+extern void EnetRxIOHandlerSet(tEnetRxIOHandler pfnHandler);
+extern bool EnetRxTCPDataGet(const uint8_t **ppui8Data, uint32_t *pui32Len);
+extern void EnetRxStatsGet(tEnetRxStats *psStats);
+
+//*****************************************************************************
+//
+// Mark the end of the C bindings section for C++ compilers.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __ENET_RX_H__
@@ -0,0 +1,412 @@
+//*****************************************************************************
+//
+// enet_tx.c - Prioritized Ethernet transmit with DSCP marking.
+//
+// lwiplib hands each frame lwIP sends straight to the driver, which puts it
+// at the back of the transmit descriptor ring, so an I/O frame sent just
+// after a web page has to wait for the whole page to go out first.  This
+// module takes over the interface's output function.  Each frame is sorted
+// into a class by its Ethernet, IP and UDP or TCP headers, and EtherNet/IP
+// frames are marked with the DSCP value set for them in the CIP QoS object.
+// Frames go straight to the driver while it has room; once it does not,
+// they wait in a queue for their class, and the queues are emptied into the
+// driver highest class first as transmit descriptors are freed.
+//
+// Copyright (c) 2025 Texas Instruments Incorporated.
+//
+//*****************************************************************************
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "inc/hw_types.h"
+#include "utils/lwiplib.h"
+#include "utils/ustdlib.h"
+#include "enet_tx.h"
+#include "ethernetip/ei_tm4c_config.h"
+
+//*****************************************************************************
+//
+// The Cortex-M4 cycle counter, which frames are timestamped with.  It is
+// started by EnetRxInit().
+//
+//*****************************************************************************
+#define ENET_TX_DWT_CYCCNT      0xE0001004
+
+//*****************************************************************************
+//
+// The fields of a frame that it is classified by.
+//
+//*****************************************************************************
+#define ENET_TX_ETH_HDR_LEN     14
+#define ENET_TX_ETHTYPE_IP      0x0800
+#define ENET_TX_ETHTYPE_ARP     0x0806
+#define ENET_TX_IP_PROTO_TCP    6
+#define ENET_TX_IP_PROTO_UDP    17
+#define ENET_TX_PORT_EIP_IO     2222
+#define ENET_TX_PORT_EIP_ENCAP  44818
+
+//*****************************************************************************
+//
+// A frame waiting to be handed to the driver, and the cycle count when lwIP
+// sent it.
+//
+//*****************************************************************************
+typedef struct
+{
+    struct pbuf *psFrame;
+    uint32_t ui32Sent;
+}
+tEnetTxEntry;
+
+//*****************************************************************************
+//
+// A queue of frames, held as a ring.
+//
+//*****************************************************************************
+typedef struct
+{
+    tEnetTxEntry psEntries[ENET_TX_QUEUE_LEN];
+    uint32_t ui32Head;
+    uint32_t ui32Count;
+}
+tEnetTxQueue;
+
+//*****************************************************************************
+//
+// The queue for each class of frame, and the number of frames in all of
+// them.
+//
+//*****************************************************************************
+static tEnetTxQueue g_psEnetTxQueues[ENET_TX_NUM_CLASSES];
+static uint32_t g_ui32EnetTxDepth;
+
+//*****************************************************************************
+//
+// The output function lwiplib gave the interface, which frames are handed on
+// to, and the interface.
+//
+//*****************************************************************************
+static netif_linkoutput_fn g_pfnEnetTxOutput;
+static struct netif *g_psEnetTxNetif;
+
+//*****************************************************************************
+//
+// The DSCP value for each traffic type, which start at the defaults of the
+// CIP QoS object given in the EtherNet/IP configuration.
+//
+//*****************************************************************************
+static uint8_t g_pui8EnetTxDSCP[ENET_TX_NUM_DSCP] =
+{
+    EI_CONFIG_QOS_DSCP_URGENT,
+    EI_CONFIG_QOS_DSCP_SCHEDULED,
+    EI_CONFIG_QOS_DSCP_HIGH,
+    EI_CONFIG_QOS_DSCP_LOW,
+    EI_CONFIG_QOS_DSCP_EXPLICIT
+};
+
+//*****************************************************************************
+//
+// The names of the classes, as used in the JSON output.
+//
+//*****************************************************************************
+static const char * const g_ppcEnetTxClassNames[ENET_TX_NUM_CLASSES] =
+{
+    "io",
+    "explicit",
+    "bulk"
+};
+
+//*****************************************************************************
+//
+// The transmit path counters.
+//
+//*****************************************************************************
+static tEnetTxStats g_sEnetTxStats;
+
+//*****************************************************************************
+//
+// Count a frame handed to the driver, and the time it waited, in cycles.
+//
+//*****************************************************************************
+static void
+EnetTxSentCount(uint32_t ui32Class, uint32_t ui32Cycles)
+{
+    tEnetTxClassStats *psStats;
+    uint32_t ui32Bucket, ui32Bits;
+
+    psStats = &g_sEnetTxStats.psClasses[ui32Class];
+
+    psStats->ui32Frames++;
+    if(ui32Cycles > psStats->ui32LatencyMax)
+    {
+        psStats->ui32LatencyMax = ui32Cycles;
+    }
+
+    ui32Bucket = 0;
+    for(ui32Bits = ui32Cycles; ui32Bits >>= 1; )
+    {
+        ui32Bucket++;
+    }
+    psStats->pui32Latency[ui32Bucket]++;
+}
+
+//*****************************************************************************
+//
+// Find the class of a frame from its Ethernet, IP and UDP or TCP headers,
+// and mark EtherNet/IP frames with their DSCP value.  The IP header checksum
+// is filled in by the MAC, so it does not need to be updated here.
+//
+//*****************************************************************************
+static uint32_t
+EnetTxClassify(struct pbuf *psFrame)
+{
+    uint8_t *pui8Frame;
+    uint32_t ui32Type, ui32IPLen, ui32SrcPort, ui32DstPort, ui32DSCP;
+    uint32_t ui32Class;
+
+    pui8Frame = (uint8_t *)psFrame->payload + ETH_PAD_SIZE;
+    if(psFrame->len < (ETH_PAD_SIZE + ENET_TX_ETH_HDR_LEN + 20))
+    {
+        return(ENET_TX_CLASS_BULK);
+    }
+
+    ui32Type = (pui8Frame[12] << 8) | pui8Frame[13];
+    if(ui32Type == ENET_TX_ETHTYPE_ARP)
+    {
+        return(ENET_TX_CLASS_IO);
+    }
+    if(ui32Type != ENET_TX_ETHTYPE_IP)
+    {
+        return(ENET_TX_CLASS_BULK);
+    }
+
+    //
+    // Only the first fragment of a datagram carries the port numbers.
+    //
+    pui8Frame += ENET_TX_ETH_HDR_LEN;
+    ui32IPLen = (pui8Frame[0] & 0x0f) * 4;
+    if(((pui8Frame[9] != ENET_TX_IP_PROTO_UDP) &&
+        (pui8Frame[9] != ENET_TX_IP_PROTO_TCP)) ||
+       (((pui8Frame[6] & 0x1f) | pui8Frame[7]) != 0) ||
+       (psFrame->len < (ETH_PAD_SIZE + ENET_TX_ETH_HDR_LEN + ui32IPLen + 4)))
+    {
+        return(ENET_TX_CLASS_BULK);
+    }
+
+    ui32SrcPort = (pui8Frame[ui32IPLen] << 8) | pui8Frame[ui32IPLen + 1];
+    ui32DstPort = (pui8Frame[ui32IPLen + 2] << 8) | pui8Frame[ui32IPLen + 3];
+    if((pui8Frame[9] == ENET_TX_IP_PROTO_UDP) &&
+       ((ui32SrcPort == ENET_TX_PORT_EIP_IO) ||
+        (ui32DstPort == ENET_TX_PORT_EIP_IO)))
+    {
+        ui32DSCP = ENET_TX_IO_PRIORITY;
+        ui32Class = ((ui32DSCP == ENET_TX_DSCP_LOW) ? ENET_TX_CLASS_EXPLICIT :
+                     ENET_TX_CLASS_IO);
+    }
+    else if((ui32SrcPort == ENET_TX_PORT_EIP_ENCAP) ||
+            (ui32DstPort == ENET_TX_PORT_EIP_ENCAP))
+    {
+        ui32DSCP = ENET_TX_DSCP_EXPLICIT;
+        ui32Class = ENET_TX_CLASS_EXPLICIT;
+    }
+    else
+    {
+        return(ENET_TX_CLASS_BULK);
+    }
+
+    //
+    // Replace the DSCP field, the top six bits of the type of service byte,
+    // and keep the two ECN bits.
+    //
+    pui8Frame[1] = (g_pui8EnetTxDSCP[ui32DSCP] << 2) | (pui8Frame[1] & 0x03);
+
+    return(ui32Class);
+}
+
+//*****************************************************************************
+//
+// The output function given to the interface in place of lwiplib's.  This is
+// called by lwIP for each frame it sends.  If no frames are waiting and the
+// driver has room, the frame goes straight to the driver; otherwise it is
+// queued by class.  If the queue is full the frame is dropped.
+//
+//*****************************************************************************
+static err_t
+EnetTxOutput(struct netif *psNetif, struct pbuf *psFrame)
+{
+    tEnetTxQueue *psQueue;
+    tEnetTxEntry *psEntry;
+    uint32_t ui32Class;
+
+    ui32Class = EnetTxClassify(psFrame);
+
+    if((g_ui32EnetTxDepth == 0) &&
+       (g_pfnEnetTxOutput(psNetif, psFrame) == ERR_OK))
+    {
+        EnetTxSentCount(ui32Class, 0);
+        return(ERR_OK);
+    }
+
+    psQueue = &g_psEnetTxQueues[ui32Class];
+    if(psQueue->ui32Count == ENET_TX_QUEUE_LEN)
+    {
+        g_sEnetTxStats.psClasses[ui32Class].ui32Dropped++;
+        return(ERR_MEM);
+    }
+
+    //
+    // Hold the frame until it is handed to the driver, since lwIP frees its
+    // own reference when this returns.
+    //
+    pbuf_ref(psFrame);
+    psEntry = &psQueue->psEntries[(psQueue->ui32Head + psQueue->ui32Count) %
+                                  ENET_TX_QUEUE_LEN];
+    psEntry->psFrame = psFrame;
+    psEntry->ui32Sent = HWREG(ENET_TX_DWT_CYCCNT);
+    psQueue->ui32Count++;
+    g_ui32EnetTxDepth++;
+    g_sEnetTxStats.psClasses[ui32Class].ui32Queued++;
+
+    EnetTxProcess();
+
+    return(ERR_OK);
+}
+
+//*****************************************************************************
+//
+// Set up prioritized transmit.  This must be called after lwIPInit().
+//
+//*****************************************************************************
+void
+EnetTxInit(void)
+{
+    g_psEnetTxNetif = netif_default;
+    g_pfnEnetTxOutput = netif_default->linkoutput;
+    netif_default->linkoutput = EnetTxOutput;
+}
+
+//*****************************************************************************
+//
+// Hand waiting frames to the driver, highest class first, until all have
+// been sent or the driver runs out of transmit descriptors.  This must be
+// called wherever the lwiplib handler runs, after it has freed the
+// descriptors of frames that have been sent.
+//
+//*****************************************************************************
+void
+EnetTxProcess(void)
+{
+    tEnetTxQueue *psQueue;
+    tEnetTxEntry *psEntry;
+    uint32_t ui32Class;
+
+    while(g_ui32EnetTxDepth)
+    {
+        for(ui32Class = 0; ui32Class < ENET_TX_NUM_CLASSES; ui32Class++)
+        {
+            psQueue = &g_psEnetTxQueues[ui32Class];
+            if(psQueue->ui32Count != 0)
+            {
+                break;
+            }
+        }
+
+        psEntry = &psQueue->psEntries[psQueue->ui32Head];
+        if(g_pfnEnetTxOutput(g_psEnetTxNetif, psEntry->psFrame) != ERR_OK)
+        {
+            break;
+        }
+
+        EnetTxSentCount(ui32Class,
+                        HWREG(ENET_TX_DWT_CYCCNT) - psEntry->ui32Sent);
+        pbuf_free(psEntry->psFrame);
+
+        psQueue->ui32Head = (psQueue->ui32Head + 1) % ENET_TX_QUEUE_LEN;
+        psQueue->ui32Count--;
+        g_ui32EnetTxDepth--;
+    }
+}
+
+//*****************************************************************************
+//
+// Set the DSCP value that a traffic type is marked with, such as from the
+// attributes of the CIP QoS object.  ui32Type is one of the ENET_TX_DSCP_
+// values, and ui8DSCP must be from 0 to 63.
+//
+//*****************************************************************************
+void
+EnetTxDSCPSet(uint32_t ui32Type, uint8_t ui8DSCP)
+{
+    if((ui32Type < ENET_TX_NUM_DSCP) && (ui8DSCP < 64))
+    {
+        g_pui8EnetTxDSCP[ui32Type] = ui8DSCP;
+    }
+}
+
+//*****************************************************************************
+//
+// Return a copy of the transmit path counters.
+//
+//*****************************************************************************
+void
+EnetTxStatsGet(tEnetTxStats *psStats)
+{
+    *psStats = g_sEnetTxStats;
+}
+
+//*****************************************************************************
+//
+// Generate one record of the transmit path counters as JSON, for
+// FSGeneratedFileAdd().  Record 0 opens the document, each class has a
+// record of its own, and the record after the last class closes the
+// document.  Returns the length of the record, or zero after the last.
+//
+//*****************************************************************************
+uint32_t
+EnetTxJSONGenerate(char *pcBuf, uint32_t ui32Size, uint32_t ui32Record)
+{
+    tEnetTxClassStats *psStats;
+    uint32_t ui32Len, ui32Bucket;
+
+    if(ui32Record == 0)
+    {
+        return(usnprintf(pcBuf, ui32Size,
+                         "{\"unit\":\"cycles\",\"classes\":["));
+    }
+    if(ui32Record == (ENET_TX_NUM_CLASSES + 1))
+    {
+        return(usnprintf(pcBuf, ui32Size, "]}\n"));
+    }
+    if(ui32Record > (ENET_TX_NUM_CLASSES + 1))
+    {
+        return(0);
+    }
+
+    psStats = &g_sEnetTxStats.psClasses[ui32Record - 1];
+
+    ui32Len = usnprintf(pcBuf, ui32Size,
+                        "%s{\"name\":\"%s\",\"frames\":%u,\"dropped\":%u,"
+                        "\"queued\":%u,\"latency_max\":%u,\"latency\":[",
+                        (ui32Record == 1) ? "" : ",",
+                        g_ppcEnetTxClassNames[ui32Record - 1],
+                        psStats->ui32Frames, psStats->ui32Dropped,
+                        psStats->ui32Queued, psStats->ui32LatencyMax);
+
+    for(ui32Bucket = 0;
+        (ui32Bucket < ENET_TX_LATENCY_BUCKETS) && (ui32Len < ui32Size);
+        ui32Bucket++)
+    {
+        ui32Len += usnprintf(pcBuf + ui32Len, ui32Size - ui32Len, "%s%u",
+                             ui32Bucket ? "," : "",
+                             psStats->pui32Latency[ui32Bucket]);
+    }
+    if(ui32Len < ui32Size)
+    {
+        ui32Len += usnprintf(pcBuf + ui32Len, ui32Size - ui32Len, "]}");
+    }
+
+    //
+    // Report a record that was cut short as longer than the space given.
+    //
+    return((ui32Len < ui32Size) ? ui32Len : ui32Size);
+}
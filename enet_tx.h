@@ -0,0 +1,134 @@
+//*****************************************************************************
+//
+// enet_tx.h - Prioritized Ethernet transmit with DSCP marking.
+//
+// Copyright (c) 2025 Texas Instruments Incorporated.
+//
+//*****************************************************************************
+
+#ifndef __ENET_TX_H__
+#define __ENET_TX_H__
+
+//*****************************************************************************
+//
+// If building with a C++ compiler, make all of the definitions in this header
+// have a C binding.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+// The most frames that can wait in the queue of each class for room in the
+// transmit descriptors.
+//
+//*****************************************************************************
+#ifndef ENET_TX_QUEUE_LEN
+#define ENET_TX_QUEUE_LEN       16
+#endif
+
+//*****************************************************************************
+//
+// The classes that frames are queued for transmit by, highest first.  I/O
+// frames are EtherNet/IP class 1 UDP datagrams on port 2222 sent at urgent,
+// scheduled or high priority, and ARP.  Explicit frames are EtherNet/IP
+// encapsulation traffic on port 44818, and class 1 datagrams sent at low
+// priority.  Bulk frames are everything else, including the web server.
+//
+//*****************************************************************************
+#define ENET_TX_CLASS_IO        0
+#define ENET_TX_CLASS_EXPLICIT  1
+#define ENET_TX_CLASS_BULK      2
+#define ENET_TX_NUM_CLASSES     3
+
+//*****************************************************************************
+//
+// The traffic types of the CIP QoS object that a DSCP value can be set for
+// with EnetTxDSCPSet().  The first four are the priorities of class 1 I/O
+// connections.
+//
+//*****************************************************************************
+#define ENET_TX_DSCP_URGENT     0
+#define ENET_TX_DSCP_SCHEDULED  1
+#define ENET_TX_DSCP_HIGH       2
+#define ENET_TX_DSCP_LOW        3
+#define ENET_TX_DSCP_EXPLICIT   4
+#define ENET_TX_NUM_DSCP        5
+
+//*****************************************************************************
+//
+// The priority that class 1 I/O frames are sent at, which picks both their
+// DSCP value and their class.  This is one of ENET_TX_DSCP_URGENT,
+// ENET_TX_DSCP_SCHEDULED, ENET_TX_DSCP_HIGH or ENET_TX_DSCP_LOW; at low
+// priority they are sent in the explicit class.
+//
+//*****************************************************************************
+#ifndef ENET_TX_IO_PRIORITY
+#define ENET_TX_IO_PRIORITY     ENET_TX_DSCP_SCHEDULED
+#endif
+
+//*****************************************************************************
+//
+// The number of buckets in the queueing latency histograms.  Bucket N counts
+// frames that waited from 2^N up to 2^(N+1) - 1 processor cycles between
+// being sent by lwIP and being handed to the driver, and bucket 0 also
+// counts those that did not wait at all.
+//
+//*****************************************************************************
+#define ENET_TX_LATENCY_BUCKETS 32
+
+//*****************************************************************************
+//
+// Counters kept for each transmit class.  ui32Frames counts the frames
+// handed to the driver and ui32Dropped those dropped because the queue was
+// full.  ui32Queued counts frames that had to wait for a transmit
+// descriptor, and ui32LatencyMax is the longest that any frame waited, in
+// processor cycles.
+//
+//*****************************************************************************
+typedef struct
+{
+    uint32_t ui32Frames;
+    uint32_t ui32Dropped;
+    uint32_t ui32Queued;
+    uint32_t ui32LatencyMax;
+    uint32_t pui32Latency[ENET_TX_LATENCY_BUCKETS];
+}
+tEnetTxClassStats;
+
+//*****************************************************************************
+//
+// Counters kept by the transmit path.
+//
+//*****************************************************************************
+typedef struct
+{
+    tEnetTxClassStats psClasses[ENET_TX_NUM_CLASSES];
+}
+tEnetTxStats;
+
+//*****************************************************************************
+//
+// Prototypes.
+//
+//*****************************************************************************
+extern void EnetTxInit(void);
+extern void EnetTxProcess(void);
+extern void EnetTxDSCPSet(uint32_t ui32Type, uint8_t ui8DSCP);
+extern void EnetTxStatsGet(tEnetTxStats *psStats);
+extern uint32_t EnetTxJSONGenerate(char *pcBuf, uint32_t ui32Size,
+                                   uint32_t ui32Record);
+
+//*****************************************************************************
+//
+// Mark the end of the C bindings section for C++ compilers.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __ENET_TX_H__
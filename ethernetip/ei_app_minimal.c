@@ -19,10 +19,15 @@
 #include <stdio.h>
 
 #include "utils/uartstdio.h"
+#include "enet_rx.h"
+#include "enet_tx.h"
+#include "events.h"
+#include "timer_wheel.h"
 
 #include "ei_tm4c_config.h"
 #include "ei_tm4c_netif.h"
 #include "ei_tm4c_board.h"
+#include "ei_tm4c_stats.h"
 #include "ei_app_minimal.h"
 
 //*****************************************************************************
@@ -47,9 +52,54 @@ static EI_AppDeviceConfig_t g_AppDeviceConfig = {
     .pcDeviceName = EI_DEVICE_NAME,
 };
 
+// Default QoS object DSCP values
+static const EI_AppQosConfig_t g_AppQosDefaults = {
+    .ui8DSCPUrgent = EI_CONFIG_QOS_DSCP_URGENT,
+    .ui8DSCPScheduled = EI_CONFIG_QOS_DSCP_SCHEDULED,
+    .ui8DSCPHigh = EI_CONFIG_QOS_DSCP_HIGH,
+    .ui8DSCPLow = EI_CONFIG_QOS_DSCP_LOW,
+    .ui8DSCPExplicit = EI_CONFIG_QOS_DSCP_EXPLICIT,
+};
+
+#if EI_CONFIG_USE_EI_API
+// CIP node that the application objects are registered on
+static EI_API_CIP_NODE_T *g_pAppCipNode = NULL;
+#endif
+
 // Application status string
 static char g_pcAppStatusString[128];
 
+// Timer that refreshes the status string
+static tTimer g_sAppStatusTimer;
+
+// Status string refresh period in milliseconds
+#define EI_APP_STATUS_PERIOD_MS  1000
+
+// Common packet format items of a class 1 I/O datagram
+#define EI_APP_CPF_SEQ_ADDRESS   0x8002
+#define EI_APP_CPF_CONN_DATA     0x00B1
+#define EI_APP_CPF_SEQ_ADDR_LEN  8
+
+// Bytes of the connected data item ahead of the output data: the CIP
+// sequence count and the 32 bit run/idle header
+#define EI_APP_IO_HEADER_LEN     6
+
+// Class 1 I/O datagrams taken, those that repeated the last sequence count
+// and those that were not valid
+static uint32_t g_ui32AppIOFrames;
+static uint32_t g_ui32AppIODuplicates;
+static uint32_t g_ui32AppIOErrors;
+
+#if !EI_CONFIG_USE_EI_API
+// Output image written by the last class 1 I/O datagram taken, with its
+// CIP sequence count and run/idle state
+static uint8_t g_pui8AppOutput[EI_CONFIG_IO_OUTPUT_SIZE];
+static uint16_t g_ui16AppOutputLen;
+static uint16_t g_ui16AppOutputSeq;
+static bool g_bAppOutputRun;
+static bool g_bAppOutputValid;
+#endif
+
 //*****************************************************************************
 //
 // Helper Functions
@@ -64,6 +114,7 @@ static void AppUpdateStatusString(void)
     const char *pcNetifStatus = "DOWN";
     bool bIsUp = false;
     bool bHasIP = false;
+    uint32_t ui32CPUUsage;
     
     if (EI_TM4C_NetifIsUp(&bIsUp) == EI_NETIF_STATUS_OK) {
         if (bIsUp) {
@@ -76,11 +127,101 @@ static void AppUpdateStatusString(void)
         }
     }
     
+    /* CPU usage over the last second, in hundredths of a percent */
+    ui32CPUUsage = EventCPUUsageGet();
+
     usprintf(g_pcAppStatusString, 
-             "[EI] %s - Net: %s - SN: 0x%08X",
+             "[EI] %s - Net: %s - SN: 0x%08X - CPU: %d.%02d%% - "
+             "IO: %u/%u/%u",
              g_AppDeviceConfig.pcDeviceName,
              pcNetifStatus,
-             g_AppDeviceConfig.ui32SerialNumber);
+             g_AppDeviceConfig.ui32SerialNumber,
+             ui32CPUUsage / 100, ui32CPUUsage % 100,
+             g_ui32AppIOFrames, g_ui32AppIODuplicates, g_ui32AppIOErrors);
+}
+
+/**
+ *  \brief Read a little endian 16 bit field of a datagram
+ */
+static uint16_t AppGet16(const uint8_t *pui8Data)
+{
+    return (uint16_t)(pui8Data[0] | (pui8Data[1] << 8));
+}
+
+#if !EI_CONFIG_USE_EI_API
+/**
+ *  \brief Class 1 I/O datagram handler
+ *
+ *  Called by the receive path for each UDP datagram for port 2222, without
+ *  it being queued or going through lwIP. The datagram must hold a
+ *  sequenced address item and a connected data item, which carries the
+ *  CIP sequence count, the run/idle header and the output data. The data
+ *  is written to the output image, unless it repeats the sequence count of
+ *  the last datagram taken. Datagrams that are not valid are dropped here
+ *  too, since nothing else listens on the port.
+ */
+static bool AppIOHandler(const uint8_t *pui8Data, uint32_t ui32Len,
+                         uint32_t ui32SrcAddr, uint32_t ui32SrcPort)
+{
+    uint16_t ui16ItemLen, ui16Seq;
+
+    (void)ui32SrcAddr;
+    (void)ui32SrcPort;
+
+    if ((ui32Len < (2 + 4 + EI_APP_CPF_SEQ_ADDR_LEN + 4)) ||
+        (AppGet16(pui8Data) != 2) ||
+        (AppGet16(pui8Data + 2) != EI_APP_CPF_SEQ_ADDRESS) ||
+        (AppGet16(pui8Data + 4) != EI_APP_CPF_SEQ_ADDR_LEN) ||
+        (AppGet16(pui8Data + 14) != EI_APP_CPF_CONN_DATA)) {
+        g_ui32AppIOErrors++;
+        return true;
+    }
+
+    ui16ItemLen = AppGet16(pui8Data + 16);
+    if ((ui16ItemLen > (ui32Len - 18)) ||
+        (ui16ItemLen < EI_APP_IO_HEADER_LEN) ||
+        ((ui16ItemLen - EI_APP_IO_HEADER_LEN) > EI_CONFIG_IO_OUTPUT_SIZE)) {
+        g_ui32AppIOErrors++;
+        return true;
+    }
+
+    pui8Data += 18;
+    ui16Seq = AppGet16(pui8Data);
+    if (g_bAppOutputValid && (ui16Seq == g_ui16AppOutputSeq)) {
+        g_ui32AppIODuplicates++;
+        return true;
+    }
+
+    g_ui16AppOutputSeq = ui16Seq;
+    g_bAppOutputRun = ((pui8Data[2] & 0x01) != 0);
+    g_ui16AppOutputLen = ui16ItemLen - EI_APP_IO_HEADER_LEN;
+    memcpy(g_pui8AppOutput, pui8Data + EI_APP_IO_HEADER_LEN,
+           g_ui16AppOutputLen);
+    g_bAppOutputValid = true;
+    g_ui32AppIOFrames++;
+
+    return true;
+}
+#endif
+
+/**
+ *  \brief Status refresh timer callback
+ */
+static void AppStatusTimer(void *pvArg)
+{
+    bool bHasIP = false;
+
+    (void)pvArg;
+
+    AppUpdateStatusString();
+
+    // Check network status
+    if (EI_TM4C_NetifHasIP(&bHasIP) == EI_NETIF_STATUS_OK) {
+        if (bHasIP) {
+            // Network is ready - could transition LED to solid ON
+            // For now, keep blinking to show activity
+        }
+    }
 }
 
 //*****************************************************************************
@@ -157,9 +298,35 @@ EI_AppStatus_t EI_APP_Init(const EI_AppDeviceConfig_t *pDevConfig)
         }
     }
     
+    // Mark EtherNet/IP frames with the QoS object defaults
+    EI_APP_SetQosDSCP(&g_AppQosDefaults);
+    
+#if !EI_CONFIG_USE_EI_API
+    // Take class 1 I/O datagrams straight from the receive path. The EI_API
+    // stack reads them from its own socket, so they are left to lwIP then.
+    EnetRxIOHandlerSet(AppIOHandler);
+#endif
+    
+#if EI_CONFIG_USE_EI_API
+    // Create the CIP node and register the TM4C specific objects on it
+    EI_API_CIP_NODE_InitParams_t initParams;
+    initParams.maxInstanceNum = EI_CONFIG_MAX_INSTANCES;
+    g_pAppCipNode = EI_API_CIP_NODE_new(&initParams);
+    if (g_pAppCipNode == NULL) {
+        EI_LOG_ERROR("CIP node creation failed");
+        return EI_APP_STATUS_ERR_INVALID_PARAM;
+    }
+    
+    EI_TM4C_StatsRegister(g_pAppCipNode);
+#endif
+    
     // Set LED to indicate initialization
     EI_TM4C_LEDSetStatus(EI_LED_BLINK);
     
+    // Refresh the status string once a second
+    TimerWheelAdd(&g_sAppStatusTimer, EI_APP_STATUS_PERIOD_MS,
+                  EI_APP_STATUS_PERIOD_MS, AppStatusTimer, NULL);
+    
     // Mark as initialized
     g_bAppInitialized = true;
     
@@ -177,26 +344,7 @@ void EI_APP_Process(void)
         return;  // Not initialized yet
     }
     
-    // Update board (e.g., LED blinking)
-    EI_TM4C_BoardProcess();
-    
-    // Update status string periodically
-    static uint32_t ui32UpdateCounter = 0;
-    ui32UpdateCounter++;
-    
-    if (ui32UpdateCounter >= 100) {  // Update every 100 calls (~1 second at 100 Hz)
-        ui32UpdateCounter = 0;
-        AppUpdateStatusString();
-        
-        // Check network status
-        bool bHasIP = false;
-        if (EI_TM4C_NetifHasIP(&bHasIP) == EI_NETIF_STATUS_OK) {
-            if (bHasIP) {
-                // Network is ready - could transition LED to solid ON
-                // For now, keep blinking to show activity
-            }
-        }
-    }
+    // LED blinking and the status refresh run from their own timers
     
     // TODO: Add EI_API stack processing here when library is integrated
     // For now, this is just a placeholder
@@ -213,8 +361,15 @@ EI_AppStatus_t EI_APP_Shutdown(void)
     
     EI_LOG("Shutting down EtherNet/IP application");
     
-    // Turn off LED
+    // Turn off LED and stop the status refresh
     EI_TM4C_LEDSetStatus(EI_LED_OFF);
+    TimerWheelRemove(&g_sAppStatusTimer);
+    
+#if !EI_CONFIG_USE_EI_API
+    // Hand I/O datagrams back to lwIP
+    EnetRxIOHandlerSet(NULL);
+    g_bAppOutputValid = false;
+#endif
     
     // TODO: Clean up EI_API resources when integrated
     
@@ -265,6 +420,31 @@ EI_AppStatus_t EI_APP_SetDeviceName(const char *pcName)
     return EI_APP_STATUS_OK;
 }
 
+/**
+ *  \brief Set QoS DSCP values
+ */
+EI_AppStatus_t EI_APP_SetQosDSCP(const EI_AppQosConfig_t *pQos)
+{
+    if (pQos == NULL) {
+        return EI_APP_STATUS_ERR_INVALID_PARAM;
+    }
+    
+    if ((pQos->ui8DSCPUrgent > 63) || (pQos->ui8DSCPScheduled > 63) ||
+        (pQos->ui8DSCPHigh > 63) || (pQos->ui8DSCPLow > 63) ||
+        (pQos->ui8DSCPExplicit > 63)) {
+        EI_LOG_ERROR("DSCP value out of range (max 63)");
+        return EI_APP_STATUS_ERR_INVALID_PARAM;
+    }
+    
+    EnetTxDSCPSet(ENET_TX_DSCP_URGENT, pQos->ui8DSCPUrgent);
+    EnetTxDSCPSet(ENET_TX_DSCP_SCHEDULED, pQos->ui8DSCPScheduled);
+    EnetTxDSCPSet(ENET_TX_DSCP_HIGH, pQos->ui8DSCPHigh);
+    EnetTxDSCPSet(ENET_TX_DSCP_LOW, pQos->ui8DSCPLow);
+    EnetTxDSCPSet(ENET_TX_DSCP_EXPLICIT, pQos->ui8DSCPExplicit);
+    
+    return EI_APP_STATUS_OK;
+}
+
 /**
  *  \brief Get device name
  */
@@ -280,3 +460,29 @@ uint32_t EI_APP_GetSerialNumber(void)
 {
     return g_AppDeviceConfig.ui32SerialNumber;
 }
+
+/**
+ *  \brief Get the output image
+ */
+EI_AppStatus_t EI_APP_GetOutputData(uint8_t *pui8Buf, uint16_t *pui16Len,
+                                    bool *pbRun)
+{
+#if !EI_CONFIG_USE_EI_API
+    if ((pui8Buf == NULL) || (pui16Len == NULL) || (pbRun == NULL) ||
+        !g_bAppOutputValid) {
+        return EI_APP_STATUS_ERR_INVALID_PARAM;
+    }
+
+    memcpy(pui8Buf, g_pui8AppOutput, g_ui16AppOutputLen);
+    *pui16Len = g_ui16AppOutputLen;
+    *pbRun = g_bAppOutputRun;
+
+    return EI_APP_STATUS_OK;
+#else
+    (void)pui8Buf;
+    (void)pui16Len;
+    (void)pbRun;
+
+    return EI_APP_STATUS_ERR_INVALID_PARAM;
+#endif
+}
@@ -54,6 +54,23 @@ typedef struct {
     const char *pcDeviceName;                // Device name string (<=32 chars)
 } EI_AppDeviceConfig_t;
 
+//*****************************************************************************
+//
+// QoS Parameters
+//
+// The DSCP values of the CIP QoS object (0x48), attributes 2 to 6, that
+// EtherNet/IP frames are marked with. Each must be from 0 to 63.
+//
+//*****************************************************************************
+
+typedef struct {
+    uint8_t ui8DSCPUrgent;                   // Class 1 I/O, urgent priority
+    uint8_t ui8DSCPScheduled;                // Class 1 I/O, scheduled priority
+    uint8_t ui8DSCPHigh;                     // Class 1 I/O, high priority
+    uint8_t ui8DSCPLow;                      // Class 1 I/O, low priority
+    uint8_t ui8DSCPExplicit;                 // Explicit messages
+} EI_AppQosConfig_t;
+
 //*****************************************************************************
 //
 // Application Initialization and Control API
@@ -69,6 +86,12 @@ typedef struct {
  *  2. lwIPInit() has completed
  *  3. Network interface is up
  *
+ *  Unless the EI_API stack is linked in, it also registers the handler
+ *  that class 1 I/O datagrams are taken from the receive path with, see
+ *  EnetRxIOHandlerSet(), and that writes their data to the output image
+ *  read with EI_APP_GetOutputData(). The eip_io_lat profiler probe times
+ *  each from the Ethernet interrupt to the handler.
+ *
  *  \param  pDevConfig - Pointer to device configuration structure,
  *                       or NULL to use defaults from ei_tm4c_config.h
  *
@@ -81,9 +104,10 @@ EI_AppStatus_t EI_APP_Init(const EI_AppDeviceConfig_t *pDevConfig);
 /**
  *  \brief Run EtherNet/IP application processing
  *
- *  This function should be called periodically from the main loop
- *  (e.g., after every LED blink cycle) to process EtherNet/IP stack
- *  operations.
+ *  This function should be called periodically from the main loop to
+ *  process EtherNet/IP stack operations; enet_lwip.c runs it from a timing
+ *  wheel timer every 10 ms. It does not depend on the period; the LED
+ *  blinking and the status refresh run from timers of their own.
  *
  *  \param  None
  *
@@ -145,6 +169,22 @@ bool EI_APP_IsInitialized(void);
  */
 EI_AppStatus_t EI_APP_SetDeviceName(const char *pcName);
 
+/**
+ *  \brief Set QoS DSCP values
+ *
+ *  Hands the DSCP values of the QoS object to the transmit scheduler, which
+ *  marks EtherNet/IP frames with them. EI_APP_Init() applies the defaults
+ *  from ei_tm4c_config.h; call this again whenever the QoS object
+ *  attributes are set.
+ *
+ *  \param  pQos - Pointer to QoS parameters
+ *
+ *  \return EI_AppStatus_t
+ *    \retval EI_APP_STATUS_OK - DSCP values applied
+ *    \retval EI_APP_STATUS_ERR_INVALID_PARAM - NULL or value above 63
+ */
+EI_AppStatus_t EI_APP_SetQosDSCP(const EI_AppQosConfig_t *pQos);
+
 /**
  *  \brief Get device name
  *
@@ -165,6 +205,24 @@ const char* EI_APP_GetDeviceName(void);
  */
 uint32_t EI_APP_GetSerialNumber(void);
 
+/**
+ *  \brief Get the output image
+ *
+ *  Copies the output data of the last class 1 I/O datagram taken from the
+ *  receive path. Only available when the EI_API stack is not linked in,
+ *  since the stack otherwise reads the I/O datagrams itself.
+ *
+ *  \param  pui8Buf - Buffer of EI_CONFIG_IO_OUTPUT_SIZE bytes for the data
+ *  \param  pui16Len - Set to the number of bytes copied
+ *  \param  pbRun - Set to true if the originator is in run mode
+ *
+ *  \return EI_AppStatus_t
+ *    \retval EI_APP_STATUS_OK - Data copied
+ *    \retval EI_APP_STATUS_ERR_INVALID_PARAM - NULL pointer, or no data yet
+ */
+EI_AppStatus_t EI_APP_GetOutputData(uint8_t *pui8Buf, uint16_t *pui16Len,
+                                    bool *pbRun);
+
 #ifdef __cplusplus
 }
 #endif
@@ -18,6 +18,7 @@
 #include "driverlib/gpio.h"
 #include "driverlib/sysctl.h"
 #include "utils/uartstdio.h"
+#include "timer_wheel.h"
 
 #include "ei_tm4c_config.h"
 #include "ei_tm4c_board.h"
@@ -37,11 +38,11 @@ static EI_LEDStatus_t g_eLEDStatus = EI_LED_OFF;
 // LED blink rate in Hz (used for BLINK mode)
 static uint32_t g_ui32BlinkRateHz = 2;
 
-// LED blink counter (for timing blink pattern)
-static uint32_t g_ui32BlinkCounter = 0;
+// LED blink half period in milliseconds (time per blink transition)
+static uint32_t g_ui32BlinkHalfPeriodMS = 250;
 
-// LED blink threshold (cycles per blink transition)
-static uint32_t g_ui32BlinkThreshold = 50;
+// Timer that drives the blink pattern
+static tTimer g_sBlinkTimer;
 
 //*****************************************************************************
 //
@@ -58,32 +59,36 @@ extern uint32_t g_ui32SysClock;
 //*****************************************************************************
 
 /**
- *  \brief Update LED blink pattern
+ *  \brief LED blink timer callback
  *
- *  This function should be called periodically (e.g., from SysTick handler)
- *  to update the LED blink pattern.
+ *  Runs every blink half period from the timing wheel while the LED is
+ *  in blink mode, and toggles the LED.
  */
-static void BoardLEDUpdateBlink(void)
+static void BoardLEDBlinkTimer(void *pvArg)
 {
-    if (g_eLEDStatus != EI_LED_BLINK) {
-        return;  // Not in blink mode
-    }
+    (void)pvArg;
     
-    g_ui32BlinkCounter++;
+    // Toggle the LED
+    uint32_t ui32CurrentState = MAP_GPIOPinRead(EI_CONFIG_LED_PORT, EI_CONFIG_LED_PIN);
     
-    if (g_ui32BlinkCounter >= g_ui32BlinkThreshold) {
-        g_ui32BlinkCounter = 0;
-        
-        // Toggle the LED
-        uint32_t ui32CurrentState = MAP_GPIOPinRead(EI_CONFIG_LED_PORT, EI_CONFIG_LED_PIN);
-        
-        if (ui32CurrentState) {
-            // LED is on, turn it off
-            MAP_GPIOPinWrite(EI_CONFIG_LED_PORT, EI_CONFIG_LED_PIN, 0);
-        } else {
-            // LED is off, turn it on
-            MAP_GPIOPinWrite(EI_CONFIG_LED_PORT, EI_CONFIG_LED_PIN, EI_CONFIG_LED_PIN);
-        }
+    if (ui32CurrentState) {
+        // LED is on, turn it off
+        MAP_GPIOPinWrite(EI_CONFIG_LED_PORT, EI_CONFIG_LED_PIN, 0);
+    } else {
+        // LED is off, turn it on
+        MAP_GPIOPinWrite(EI_CONFIG_LED_PORT, EI_CONFIG_LED_PIN, EI_CONFIG_LED_PIN);
+    }
+}
+
+/**
+ *  \brief Set the LED blink half period from the blink rate
+ */
+static void BoardLEDSetHalfPeriod(void)
+{
+    // 50% duty cycle: each transition takes half of the blink period
+    g_ui32BlinkHalfPeriodMS = (1000 / g_ui32BlinkRateHz) / 2;
+    if (g_ui32BlinkHalfPeriodMS == 0) {
+        g_ui32BlinkHalfPeriodMS = 1;
     }
 }
 
@@ -114,16 +119,8 @@ EI_BoardStatus_t EI_TM4C_BoardInit(void)
     MAP_GPIOPinWrite(EI_CONFIG_LED_PORT, EI_CONFIG_LED_PIN, 0);
     g_eLEDStatus = EI_LED_OFF;
     
-    // Calculate blink threshold based on system clock
-    // For a 2 Hz blink rate with 100 Hz SysTick:
-    // Threshold = (SYSTICKHZ / 2) / 2 for 50% duty cycle
-    // = (100 / 2) / 2 = 25, but we use 50 for slower visual effect
-    if (g_ui32SysClock > 0) {
-        g_ui32BlinkThreshold = (100 / g_ui32BlinkRateHz) / 2;
-        if (g_ui32BlinkThreshold == 0) {
-            g_ui32BlinkThreshold = 1;
-        }
-    }
+    // Calculate blink half period from the blink rate
+    BoardLEDSetHalfPeriod();
     
     g_bBoardInitialized = true;
     
@@ -162,7 +159,7 @@ EI_BoardStatus_t EI_TM4C_LEDSetStatus(EI_LEDStatus_t eLEDStatus)
     }
     
     g_eLEDStatus = eLEDStatus;
-    g_ui32BlinkCounter = 0;  // Reset blink counter
+    TimerWheelRemove(&g_sBlinkTimer);  // Stop any blink pattern
     
     switch (eLEDStatus) {
         case EI_LED_OFF:
@@ -177,7 +174,8 @@ EI_BoardStatus_t EI_TM4C_LEDSetStatus(EI_LEDStatus_t eLEDStatus)
             
         case EI_LED_BLINK:
             EI_LOG("LED set to BLINK at %u Hz", g_ui32BlinkRateHz);
-            // Will be managed by timer/SysTick handler
+            TimerWheelAdd(&g_sBlinkTimer, g_ui32BlinkHalfPeriodMS,
+                          g_ui32BlinkHalfPeriodMS, BoardLEDBlinkTimer, NULL);
             break;
             
         default:
@@ -230,14 +228,13 @@ EI_BoardStatus_t EI_TM4C_LEDSetBlinkRate(uint32_t ui32BlinkRateHz)
     
     g_ui32BlinkRateHz = ui32BlinkRateHz;
     
-    // Recalculate blink threshold
-    // Assuming 100 Hz SysTick (from enet_lwip.c SYSTICKHZ = 100)
-    g_ui32BlinkThreshold = (100 / ui32BlinkRateHz) / 2;
-    if (g_ui32BlinkThreshold == 0) {
-        g_ui32BlinkThreshold = 1;
-    }
+    // Recalculate blink half period and restart a running blink pattern
+    BoardLEDSetHalfPeriod();
     
-    g_ui32BlinkCounter = 0;
+    if (g_eLEDStatus == EI_LED_BLINK) {
+        TimerWheelAdd(&g_sBlinkTimer, g_ui32BlinkHalfPeriodMS,
+                      g_ui32BlinkHalfPeriodMS, BoardLEDBlinkTimer, NULL);
+    }
     
     EI_LOG("LED blink rate set to %u Hz", ui32BlinkRateHz);
     
@@ -267,31 +264,3 @@ const char* EI_TM4C_GetBoardRevision(void)
 {
     return "1.0";
 }
-
-//*****************************************************************************
-//
-// Timer Callback (to be called from SysTick handler in enet_lwip.c)
-//
-// This function updates the LED blink pattern and should be called
-// periodically (typically from SysTick at 100 Hz).
-//
-//*****************************************************************************
-
-/**
- *  \brief Process board periodic updates
- *
- *  This function should be called from the SysTick interrupt handler
- *  or main loop to update LED blinking and other time-based operations.
- *
- *  \param  None
- *
- *  \return None
- */
-void EI_TM4C_BoardProcess(void)
-{
-    if (!g_bBoardInitialized) {
-        return;
-    }
-    
-    BoardLEDUpdateBlink();
-}
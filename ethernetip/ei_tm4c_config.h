@@ -89,6 +89,15 @@ extern "C" {
 #define EI_CONFIG_PACKET_BUFFER_SIZE    (1024 * 2)    // 2KB per packet buffer
 #define EI_CONFIG_NUM_PACKET_BUFFERS    4             // 4 buffers = 8KB
 
+// Set to 1 when the EI_API library is linked in. The application then
+// creates the CIP node and registers the TM4C specific CIP objects on it.
+#define EI_CONFIG_USE_EI_API            0
+
+// Vendor specific class that serves the lwIP statistics, and how long a
+// snapshot of them is reused for reads of successive attributes
+#define EI_CONFIG_STATS_CLASS_ID        0x0071
+#define EI_CONFIG_STATS_SNAPSHOT_MS     100
+
 //*****************************************************************************
 //
 // Task Configuration
@@ -119,6 +128,19 @@ extern "C" {
 // EtherNet/IP uses TCP port 44818 for connected mode (optional)
 #define EI_CONFIG_EIP_TCP_PORT          44818
 
+// Largest output image, in bytes, that class 1 I/O datagrams taken from the
+// receive path can carry when the EI_API stack is not linked in
+#define EI_CONFIG_IO_OUTPUT_SIZE        32
+
+// DSCP values that EtherNet/IP frames are marked with, per traffic type of
+// the CIP QoS object (0x48).  These are the ODVA defaults, applied to the
+// transmit scheduler by EI_APP_Init() and changed with EI_APP_SetQosDSCP().
+#define EI_CONFIG_QOS_DSCP_URGENT       55
+#define EI_CONFIG_QOS_DSCP_SCHEDULED    47
+#define EI_CONFIG_QOS_DSCP_HIGH         43
+#define EI_CONFIG_QOS_DSCP_LOW          31
+#define EI_CONFIG_QOS_DSCP_EXPLICIT     27
+
 // lwIP network interface handle
 // This will be initialized by ei_tm4c_netif.c
 // The netif is created by lwIPInit() in enet_lwip.c
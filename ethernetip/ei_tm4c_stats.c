@@ -0,0 +1,207 @@
+//*****************************************************************************
+//
+// ei_tm4c_stats.c - EtherNet/IP Network Statistics Object for TM4C
+//
+// This file implements the vendor specific CIP class that serves the lwIP
+// statistics. The counters come from NetStatsSnapshot(), the same function
+// that /stats.json is generated from.
+//
+// Copyright (c) 2025 Texas Instruments Incorporated.
+//
+//*****************************************************************************
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "utils/uartstdio.h"
+#include "net_stats.h"
+#include "timer_wheel.h"
+
+#include "ei_tm4c_config.h"
+#include "ei_tm4c_stats.h"
+
+//*****************************************************************************
+//
+// Module-level variables
+//
+//*****************************************************************************
+
+// Snapshot of the lwIP statistics that attributes are read from
+static tNetStats g_sStatsSnapshot;
+
+// Whether the snapshot has been taken yet
+static bool g_bStatsValid = false;
+
+// Instance and attribute read last, and when the snapshot was taken
+static uint16_t g_ui16StatsInstance;
+static uint16_t g_ui16StatsAttr;
+static uint32_t g_ui32StatsTime;
+
+// Number of snapshots taken
+static uint32_t g_ui32StatsSnapshots;
+
+//*****************************************************************************
+//
+// Public API Implementation
+//
+//*****************************************************************************
+
+/**
+ *  \brief Get number of attributes of an instance
+ */
+uint16_t EI_TM4C_StatsAttrCount(uint16_t ui16Instance)
+{
+    if ((ui16Instance == 0) || (ui16Instance > EI_STATS_NUM_INSTANCES)) {
+        return 0;
+    }
+
+    if (ui16Instance == EI_STATS_POOL_INSTANCE) {
+        return 1;
+    }
+
+    return NUM_NET_STATS_COUNTERS;
+}
+
+/**
+ *  \brief Read an attribute of the statistics class
+ */
+EI_StatsStatus_t EI_TM4C_StatsAttrGet(uint16_t ui16Instance,
+                                      uint16_t ui16Attr,
+                                      uint32_t *pui32Value)
+{
+    uint32_t ui32Now;
+
+    if (pui32Value == NULL) {
+        return EI_STATS_STATUS_ERR_INVALID_PARAM;
+    }
+
+    if (EI_TM4C_StatsAttrCount(ui16Instance) == 0) {
+        return EI_STATS_STATUS_ERR_NO_INSTANCE;
+    }
+
+    if ((ui16Attr == 0) || (ui16Attr > EI_TM4C_StatsAttrCount(ui16Instance))) {
+        return EI_STATS_STATUS_ERR_NO_ATTRIBUTE;
+    }
+
+    // Take a new snapshot unless this read continues the last one
+    ui32Now = TimerWheelNow();
+    if (!g_bStatsValid || (ui16Instance != g_ui16StatsInstance) ||
+        (ui16Attr <= g_ui16StatsAttr) ||
+        ((ui32Now - g_ui32StatsTime) > EI_CONFIG_STATS_SNAPSHOT_MS)) {
+        NetStatsSnapshot(&g_sStatsSnapshot);
+        g_ui32StatsTime = ui32Now;
+        g_ui32StatsSnapshots++;
+        g_bStatsValid = true;
+    }
+
+    g_ui16StatsInstance = ui16Instance;
+    g_ui16StatsAttr = ui16Attr;
+
+    if (ui16Instance == EI_STATS_POOL_INSTANCE) {
+        *pui32Value = g_sStatsSnapshot.ui32PoolFailures;
+    } else {
+        *pui32Value =
+            g_sStatsSnapshot.ppui32Counters[ui16Instance - 1][ui16Attr - 1];
+    }
+
+    return EI_STATS_STATUS_OK;
+}
+
+/**
+ *  \brief Get number of snapshots taken
+ */
+uint32_t EI_TM4C_StatsSnapshotCount(void)
+{
+    return g_ui32StatsSnapshots;
+}
+
+#if EI_CONFIG_USE_EI_API
+//*****************************************************************************
+//
+// CIP Class Registration
+//
+//*****************************************************************************
+
+/**
+ *  \brief Get_Attribute_Single callback of the statistics class
+ */
+static uint32_t StatsGetAttrCb(EI_API_CIP_NODE_T *pCipNode,
+                               uint16_t classId,
+                               uint16_t instanceId,
+                               uint16_t attrId,
+                               uint16_t *pLen,
+                               void *pvValue)
+{
+    uint32_t ui32Value;
+
+    (void)pCipNode;
+    (void)classId;
+
+    if (EI_TM4C_StatsAttrGet(instanceId, attrId, &ui32Value) !=
+        EI_STATS_STATUS_OK) {
+        return EI_API_eERR_CB_INVALID_VALUE;
+    }
+
+    memcpy(pvValue, &ui32Value, sizeof(ui32Value));
+    *pLen = sizeof(ui32Value);
+
+    return EI_API_eERR_CB_NO_ERROR;
+}
+
+/**
+ *  \brief Register the statistics class
+ */
+EI_StatsStatus_t EI_TM4C_StatsRegister(EI_API_CIP_NODE_T *pCipNode)
+{
+    EI_API_CIP_SService_t service;
+    EI_API_CIP_SAttr_t attr;
+    uint32_t ui32Value = 0;
+    uint32_t ui32Err;
+    uint16_t ui16Instance;
+    uint16_t ui16Attr;
+
+    if (pCipNode == NULL) {
+        return EI_STATS_STATUS_ERR_INVALID_PARAM;
+    }
+
+    EI_API_CIP_createClass(pCipNode, EI_CONFIG_STATS_CLASS_ID);
+
+    memset(&service, 0, sizeof(service));
+    service.code = EI_API_CIP_eSC_GETATTRSINGLE;
+    EI_API_CIP_addClassService(pCipNode, EI_CONFIG_STATS_CLASS_ID, &service);
+
+    for (ui16Instance = 1; ui16Instance <= EI_STATS_NUM_INSTANCES;
+         ui16Instance++) {
+        EI_API_CIP_createInstance(pCipNode, EI_CONFIG_STATS_CLASS_ID,
+                                  ui16Instance);
+        EI_API_CIP_addInstanceService(pCipNode, EI_CONFIG_STATS_CLASS_ID,
+                                      ui16Instance, &service);
+
+        for (ui16Attr = 1; ui16Attr <= EI_TM4C_StatsAttrCount(ui16Instance);
+             ui16Attr++) {
+            memset(&attr, 0, sizeof(attr));
+            attr.id = ui16Attr;
+            attr.edt = EI_API_CIP_eEDT_UDINT;
+            attr.accessRule = EI_API_CIP_eAR_GET;
+            attr.get_callback = StatsGetAttrCb;
+            attr.pvValue = &ui32Value;
+
+            ui32Err = EI_API_CIP_addInstanceAttr(pCipNode,
+                                                 EI_CONFIG_STATS_CLASS_ID,
+                                                 ui16Instance, &attr);
+            if (ui32Err != EI_API_CIP_eERR_OK) {
+                EI_LOG_ERROR("Stats instance %u attribute %u: 0x%08x",
+                             ui16Instance, ui16Attr, ui32Err);
+            }
+
+            EI_API_CIP_setInstanceAttrFunc(pCipNode, EI_CONFIG_STATS_CLASS_ID,
+                                           ui16Instance, &attr);
+        }
+    }
+
+    EI_LOG("Statistics class 0x%02X registered", EI_CONFIG_STATS_CLASS_ID);
+
+    return EI_STATS_STATUS_OK;
+}
+#endif
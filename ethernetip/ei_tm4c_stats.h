@@ -0,0 +1,125 @@
+//*****************************************************************************
+//
+// ei_tm4c_stats.h - EtherNet/IP Network Statistics Object for TM4C
+//
+// This header defines the vendor specific CIP class that serves the lwIP
+// statistics of the TM4C network stack. Instances 1 to 6 are the link, ARP,
+// IP, ICMP, UDP and TCP layers, with one UDINT attribute per counter in the
+// order of net_stats.h. Attribute 1 of instance 7 is the number of failed
+// memory pool allocations.
+//
+// Copyright (c) 2025 Texas Instruments Incorporated.
+//
+//*****************************************************************************
+
+#ifndef EI_TM4C_STATS_H
+#define EI_TM4C_STATS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "ei_tm4c_config.h"
+
+#if EI_CONFIG_USE_EI_API
+#include "EI_API.h"
+#endif
+
+//*****************************************************************************
+//
+// Statistics Object Status Codes
+//
+//*****************************************************************************
+
+typedef enum {
+    EI_STATS_STATUS_OK = 0,                  // Success
+    EI_STATS_STATUS_ERR_INVALID_PARAM = 1,   // NULL pointer passed
+    EI_STATS_STATUS_ERR_NO_INSTANCE = 2,     // No such instance
+    EI_STATS_STATUS_ERR_NO_ATTRIBUTE = 3,    // No such attribute
+} EI_StatsStatus_t;
+
+//*****************************************************************************
+//
+// Statistics Object Layout
+//
+//*****************************************************************************
+
+// Instance holding the number of failed memory pool allocations
+#define EI_STATS_POOL_INSTANCE          7
+
+// Number of instances of the class
+#define EI_STATS_NUM_INSTANCES          EI_STATS_POOL_INSTANCE
+
+//*****************************************************************************
+//
+// Statistics Object API
+//
+//*****************************************************************************
+
+/**
+ *  \brief Read an attribute of the statistics class
+ *
+ *  Returns one counter of the lwIP statistics. The counters are read from a
+ *  snapshot, which is taken again when a different instance is read, when
+ *  an attribute is read that is not after the one read last, or when the
+ *  snapshot is older than EI_CONFIG_STATS_SNAPSHOT_MS. Reading the
+ *  attributes of an instance in order therefore takes one snapshot, and
+ *  returns counters that are consistent with each other.
+ *
+ *  \param  ui16Instance  Instance ID, from 1 to EI_STATS_NUM_INSTANCES
+ *  \param  ui16Attr      Attribute ID, from 1
+ *  \param  pui32Value    Pointer to store the counter
+ *
+ *  \return EI_StatsStatus_t
+ *    \retval EI_STATS_STATUS_OK                - Success
+ *    \retval EI_STATS_STATUS_ERR_INVALID_PARAM - NULL pointer passed
+ *    \retval EI_STATS_STATUS_ERR_NO_INSTANCE   - No such instance
+ *    \retval EI_STATS_STATUS_ERR_NO_ATTRIBUTE  - No such attribute
+ */
+EI_StatsStatus_t EI_TM4C_StatsAttrGet(uint16_t ui16Instance,
+                                      uint16_t ui16Attr,
+                                      uint32_t *pui32Value);
+
+/**
+ *  \brief Get number of attributes of an instance
+ *
+ *  \param  ui16Instance  Instance ID
+ *
+ *  \return uint16_t - Number of attributes, or 0 for no such instance
+ */
+uint16_t EI_TM4C_StatsAttrCount(uint16_t ui16Instance);
+
+/**
+ *  \brief Get number of snapshots taken
+ *
+ *  \param  None
+ *
+ *  \return uint32_t - Number of snapshots taken of the lwIP statistics
+ */
+uint32_t EI_TM4C_StatsSnapshotCount(void);
+
+#if EI_CONFIG_USE_EI_API
+/**
+ *  \brief Register the statistics class
+ *
+ *  Creates class EI_CONFIG_STATS_CLASS_ID on the CIP node, with the
+ *  Get_Attribute_Single service and read only attributes served by
+ *  EI_TM4C_StatsAttrGet().
+ *
+ *  \param  pCipNode  CIP node created by the application
+ *
+ *  \return EI_StatsStatus_t
+ *    \retval EI_STATS_STATUS_OK                - Class registered
+ *    \retval EI_STATS_STATUS_ERR_INVALID_PARAM - NULL pointer passed
+ */
+EI_StatsStatus_t EI_TM4C_StatsRegister(EI_API_CIP_NODE_T *pCipNode);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // EI_TM4C_STATS_H
@@ -0,0 +1,180 @@
+//*****************************************************************************
+//
+// events.c - Event-driven main loop.
+//
+// Interrupt handlers and other code post events, and the main loop runs the
+// handler for each event as soon as it can, sleeping in WFI whenever there
+// is nothing to do.  The time spent asleep gives a measure of how busy the
+// processor is.
+//
+// Copyright (c) 2025 Texas Instruments Incorporated.
+//
+//*****************************************************************************
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "inc/hw_types.h"
+#include "driverlib/cpu.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/rom_map.h"
+#include "driverlib/systick.h"
+#include "events.h"
+
+//*****************************************************************************
+//
+// The pending events, one bit each.  The bits are set and cleared through
+// the bit-band alias, so that posting an event from an interrupt handler
+// cannot be lost to a read-modify-write in the main loop.
+//
+//*****************************************************************************
+static volatile uint32_t g_ui32Events;
+
+//*****************************************************************************
+//
+// The handler for each event.
+//
+//*****************************************************************************
+static tEventHandler g_ppfnEventHandlers[NUM_EVENTS];
+
+//*****************************************************************************
+//
+// The SysTick period in processor cycles, the number of ticks and the
+// processor cycles spent asleep so far in the current CPU usage window, and
+// the CPU usage measured over the last complete window.
+//
+//*****************************************************************************
+static uint32_t g_ui32EventTickPeriod;
+static uint32_t g_ui32EventUsageTicks;
+static uint32_t g_ui32EventIdleCycles;
+static uint32_t g_ui32EventCPUUsage;
+
+//*****************************************************************************
+//
+// Initialize the event loop.  The SysTick timer must already be running with
+// the given period, in processor cycles, and EventTick() must be called from
+// its interrupt handler.
+//
+//*****************************************************************************
+void
+EventInit(uint32_t ui32TickPeriod)
+{
+    g_ui32EventTickPeriod = ui32TickPeriod;
+}
+
+//*****************************************************************************
+//
+// Set the handler for an event.
+//
+//*****************************************************************************
+void
+EventHandlerSet(uint32_t ui32Event, tEventHandler pfnHandler)
+{
+    g_ppfnEventHandlers[ui32Event] = pfnHandler;
+}
+
+//*****************************************************************************
+//
+// Post an event.  This may be called from interrupt handlers.
+//
+//*****************************************************************************
+void
+EventPost(uint32_t ui32Event)
+{
+    HWREGBITW(&g_ui32Events, ui32Event) = 1;
+}
+
+//*****************************************************************************
+//
+// Handle a SysTick interrupt.  This posts the timer event and closes the CPU
+// usage window every EVENT_USAGE_TICKS ticks.
+//
+//*****************************************************************************
+void
+EventTick(void)
+{
+    uint64_t ui64Cycles;
+
+    EventPost(EVENT_TIMER);
+
+    if(++g_ui32EventUsageTicks == EVENT_USAGE_TICKS)
+    {
+        ui64Cycles = (uint64_t)EVENT_USAGE_TICKS * g_ui32EventTickPeriod;
+        if(g_ui32EventIdleCycles > ui64Cycles)
+        {
+            g_ui32EventIdleCycles = ui64Cycles;
+        }
+        g_ui32EventCPUUsage = (((ui64Cycles - g_ui32EventIdleCycles) *
+                                10000) / ui64Cycles);
+        g_ui32EventUsageTicks = 0;
+        g_ui32EventIdleCycles = 0;
+    }
+}
+
+//*****************************************************************************
+//
+// Return the share of time the processor was awake over the last
+// EVENT_USAGE_TICKS ticks, in hundredths of a percent.
+//
+//*****************************************************************************
+uint32_t
+EventCPUUsageGet(void)
+{
+    return(g_ui32EventCPUUsage);
+}
+
+//*****************************************************************************
+//
+// Run the event loop.  This does not return.
+//
+//*****************************************************************************
+void
+EventLoopRun(void)
+{
+    uint32_t ui32Event, ui32Before, ui32After;
+
+    while(1)
+    {
+        //
+        // Run the handler of every pending event, in order.  Each event is
+        // cleared before its handler runs, so that it can be posted again
+        // while the handler is running.
+        //
+        for(ui32Event = 0; ui32Event < NUM_EVENTS; ui32Event++)
+        {
+            if(HWREGBITW(&g_ui32Events, ui32Event))
+            {
+                HWREGBITW(&g_ui32Events, ui32Event) = 0;
+                if(g_ppfnEventHandlers[ui32Event])
+                {
+                    g_ppfnEventHandlers[ui32Event]();
+                }
+            }
+        }
+
+        //
+        // Sleep until an interrupt if nothing was posted in the meantime.
+        // Interrupts are masked from the check until after waking, so that
+        // an event posted just before the WFI still wakes it; the interrupt
+        // that woke it runs once they are unmasked.
+        //
+        MAP_IntMasterDisable();
+        if(g_ui32Events == 0)
+        {
+            //
+            // Count the time asleep from the SysTick counter, which counts
+            // down and reloads once per tick.  The SysTick interrupt wakes
+            // the processor, so the counter cannot reload twice during one
+            // sleep.
+            //
+            ui32Before = MAP_SysTickValueGet();
+            CPUwfi();
+            ui32After = MAP_SysTickValueGet();
+            if(ui32After > ui32Before)
+            {
+                ui32Before += g_ui32EventTickPeriod;
+            }
+            g_ui32EventIdleCycles += ui32Before - ui32After;
+        }
+        MAP_IntMasterEnable();
+    }
+}
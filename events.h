@@ -0,0 +1,74 @@
+//*****************************************************************************
+//
+// events.h - Event-driven main loop.
+//
+// Copyright (c) 2025 Texas Instruments Incorporated.
+//
+//*****************************************************************************
+
+#ifndef __EVENTS_H__
+#define __EVENTS_H__
+
+//*****************************************************************************
+//
+// If building with a C++ compiler, make all of the definitions in this header
+// have a C binding.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+// The events that can be posted.  Each is a bit number in the pending event
+// word, and when several are pending their handlers run in this order.
+//
+//*****************************************************************************
+#define EVENT_NET_RX            0
+#define EVENT_TIMER             1
+#define EVENT_IO_CHANGE         2
+#define EVENT_NVM_COMPLETE      3
+#define EVENT_FS                4
+#define NUM_EVENTS              5
+
+//*****************************************************************************
+//
+// The number of timer ticks over which the CPU usage is measured, which is
+// one second at the 1 ms tick.
+//
+//*****************************************************************************
+#ifndef EVENT_USAGE_TICKS
+#define EVENT_USAGE_TICKS       1000
+#endif
+
+//*****************************************************************************
+//
+// The prototype for an event handler.
+//
+//*****************************************************************************
+typedef void (*tEventHandler)(void);
+
+//*****************************************************************************
+//
+// Prototypes.
+//
+//*****************************************************************************
+extern void EventInit(uint32_t ui32TickPeriod);
+extern void EventHandlerSet(uint32_t ui32Event, tEventHandler pfnHandler);
+extern void EventPost(uint32_t ui32Event);
+extern void EventTick(void);
+extern void EventLoopRun(void);
+extern uint32_t EventCPUUsageGet(void);
+
+//*****************************************************************************
+//
+// Mark the end of the C bindings section for C++ compilers.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __EVENTS_H__
@@ -43,6 +43,14 @@
 //#define LWIP_HTTPD_SSI                  1
 //#define LWIP_HTTPD_CGI                  1
 #define LWIP_HTTPD_DYNAMIC_HEADERS      1
+
+//
+// Files on the SD card are read from the main loop rather than in the
+// Ethernet interrupt, so fs_read() may have nothing to return yet.  With
+// asynchronous reads, httpd waits for enet_fs.c to call it back when the
+// data arrives instead of retrying on its next poll.
+//
+#define LWIP_HTTPD_FS_ASYNC_READ        1
 //#define HTTPD_DEBUG                     LWIP_DBG_ON
 #if !defined(EMAC_PHY_IS_EXT_MII) && !defined(EMAC_PHY_IS_EXT_RMII)
 #define EMAC_PHY_CONFIG (EMAC_PHY_TYPE_INTERNAL | EMAC_PHY_INT_MDIX_EN |      \
@@ -57,8 +65,24 @@
 #define EMAC_PHY_CONFIG  EMAC_PHY_TYPE_EXTERNAL_RMII
 #define PHY_PHYS_ADDR      1
 #endif
-#define NUM_TX_DESCRIPTORS 24
-#define NUM_RX_DESCRIPTORS 8
+
+//
+// Frames that do not fit in the transmit descriptors wait in the enet_tx.c
+// queues, where I/O frames are sent ahead of the rest.  Frames already in
+// the descriptors go out in order, so a short ring bounds the time an I/O
+// frame can wait behind a web page to a few full-size frames.  A frame
+// takes a descriptor for each pbuf in its chain.
+//
+#define NUM_TX_DESCRIPTORS 8
+
+//
+// The driver points each receive descriptor at a pbuf from the pool, which
+// the DMA writes the frame into directly, and replaces it with a fresh pbuf
+// from the pool when the frame is handed to lwIP.  Frames held in the
+// enet_rx.c queues keep their pbufs, so PBUF_POOL_SIZE must cover those as
+// well as the ring, or the ring cannot be refilled.
+//
+#define NUM_RX_DESCRIPTORS 16
 
 //*****************************************************************************
 //
@@ -77,11 +101,17 @@
 //*****************************************************************************
 //#define MEM_LIBC_MALLOC                 0
 #define MEM_ALIGNMENT                     4
-#define MEM_SIZE                          (64 * 1024)
+//#define MEM_SIZE                        1600
 //#define MEMP_OVERFLOW_CHECK             0
 //#define MEMP_SANITY_CHECK               0
-//#define MEM_USE_POOLS                   0
-//#define MEMP_USE_CUSTOM_POOLS           0
+#define MEM_USE_POOLS                   1           // default is 0
+                              // mem_malloc() takes the smallest block that
+                              // fits from the LWIP_MALLOC_MEMPOOL pools in
+                              // lwippools.h, in place of a first-fit heap
+                              // of MEM_SIZE bytes.
+#define MEM_USE_POOLS_TRY_BIGGER_POOL   1           // default is 0
+#define MEMP_USE_CUSTOM_POOLS           1           // default is 0
+                              // The custom pools are in lwippools.h.
 
 //*****************************************************************************
 //
@@ -251,9 +281,27 @@
 //
 //*****************************************************************************
 #define PBUF_LINK_HLEN                  16          // default is 14
-#define PBUF_POOL_BUFSIZE               512
+#define PBUF_POOL_BUFSIZE               1536
                               // PBUF_POOL_BUFSIZE default is
                               // LWIP_MEM_ALIGN_SIZE(TCP_MSS+40+PBUF_LINK_HLEN)
+                              // Pool pbufs are sized for a whole frame
+                              // (1518 bytes, or 1522 with a VLAN tag), so
+                              // every received frame lands in a single
+                              // pbuf instead of a chain of them.
+#define LWIP_SUPPORT_CUSTOM_PBUF        1           // default is 0
+
+//
+// Received frames of up to RX_SMALL_PBUF_SIZE bytes are copied out of the
+// full-size pool pbuf the driver received them into and into a pbuf from
+// the RX_SMALL pool in lwippools.h, which holds RX_SMALL_PBUF_NUM of them.
+// The full-size pbuf goes straight back to the pool to refill the receive
+// ring, rather than being held by a short frame while it waits to be
+// processed.  Set RX_SMALL_PBUF_NUM to 0 to keep every frame in its
+// full-size pbuf.
+//
+#define RX_SMALL_PBUF_SIZE              256
+#define RX_SMALL_PBUF_NUM               32
+
 #define ETH_PAD_SIZE                    0           // default is 0
 
 //*****************************************************************************
@@ -324,19 +372,24 @@
 // ---------- Statistics options ----------
 //
 //*****************************************************************************
-//#define LWIP_STATS                      1
-//#define LWIP_STATS_DISPLAY              0
-//#define LINK_STATS                      1
-//#define ETHARP_STATS                    (LWIP_ARP)
-//#define IP_STATS                        1
+//
+// The statistics are plain counters that are read by net_stats.c, which
+// serves them as /stats.json.  The code that prints them is left out, as
+// are the counters for the parts of lwIP that are not used here.
+//
+#define LWIP_STATS                      1
+#define LWIP_STATS_DISPLAY              0
+#define LINK_STATS                      1
+#define ETHARP_STATS                    1
+#define IP_STATS                        1
 //#define IPFRAG_STATS                    (IP_REASSEMBLY || IP_FRAG)
-//#define ICMP_STATS                      1
+#define ICMP_STATS                      1
 //#define IGMP_STATS                      (LWIP_IGMP)
-//#define UDP_STATS                       (LWIP_UDP)
-//#define TCP_STATS                       (LWIP_TCP)
-//#define MEM_STATS                       1
-//#define MEMP_STATS                      1
-//#define SYS_STATS                       1
+#define UDP_STATS                       1
+#define TCP_STATS                       1
+#define MEM_STATS                       0           // default is 1
+#define MEMP_STATS                      1
+#define SYS_STATS                       0           // default is 1
 
 //*****************************************************************************
 //
@@ -0,0 +1,39 @@
+//*****************************************************************************
+//
+// lwippools.h - Custom lwIP memory pools.
+//
+// This file is included by lwIP, more than once, when MEMP_USE_CUSTOM_POOLS
+// is set in lwipopts.h.  Each LWIP_MEMPOOL() entry adds a pool MEMP_<name>
+// that is allocated from with memp_malloc() and counted in the lwIP memp
+// statistics like the built-in pools.
+//
+// Copyright (c) 2025 Texas Instruments Incorporated.
+//
+//*****************************************************************************
+
+//
+// The pools that mem_malloc() takes blocks from, smallest first.  The 256
+// byte blocks hold the web server's connection state and short PBUF_RAM
+// pbufs such as ICMP replies, the 640 byte blocks DHCP messages, and the
+// 1600 byte blocks full-size TCP segments, which are a pbuf with TCP_MSS
+// bytes of data after room for the TCP, IP and Ethernet headers.  A block
+// that cannot be had from its own pool is taken from a larger one.
+//
+#if MEM_USE_POOLS
+LWIP_MALLOC_MEMPOOL_START
+LWIP_MALLOC_MEMPOOL(16, 256)
+LWIP_MALLOC_MEMPOOL(8, 640)
+LWIP_MALLOC_MEMPOOL(16, 1600)
+LWIP_MALLOC_MEMPOOL_END
+#endif
+
+//
+// The small received frame pool.  Each entry is a custom pbuf followed by
+// the frame it holds; see enet_rx.c.
+//
+#if RX_SMALL_PBUF_NUM
+LWIP_MEMPOOL(RX_SMALL, RX_SMALL_PBUF_NUM,
+             (LWIP_MEM_ALIGN_SIZE(sizeof(struct pbuf_custom)) +
+              LWIP_MEM_ALIGN_SIZE(RX_SMALL_PBUF_SIZE)),
+             "RX_SMALL")
+#endif
@@ -0,0 +1,475 @@
+//*****************************************************************************
+//
+// net_stats.c - Reporting of the lwIP statistics.
+//
+// The protocol counters are copied out of lwIP by NetStatsSnapshot(), which
+// the JSON generator and the EtherNet/IP vendor class both read them
+// through.  The JSON document also carries the counters of the SD card
+// sector cache, of the web server's file handle pools and of the Ethernet
+// receive path.  The use of each lwIP memory pool, including the pools that
+// mem_malloc() takes its blocks from, can be printed on the UART with
+// NetStatsPoolDump().  Both can be served as JSON by handing
+// NetStatsJSONGenerate() or NetStatsPoolJSONGenerate() to
+// FSGeneratedFileAdd().
+//
+// Copyright (c) 2025 Texas Instruments Incorporated.
+//
+//*****************************************************************************
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "inc/hw_ints.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/rom_map.h"
+#include "utils/lwiplib.h"
+#include "utils/uartstdio.h"
+#include "utils/ustdlib.h"
+#include "lwip/memp.h"
+#include "lwip/stats.h"
+#include "enet_fs.h"
+#include "enet_rx.h"
+#include "net_stats.h"
+#include "sd_cache.h"
+
+//*****************************************************************************
+//
+// The records of the JSON document that follow those of the protocols.
+//
+//*****************************************************************************
+#define NET_STATS_REC_SD_CACHE  (NUM_NET_STATS_PROTOS + 1)
+#define NET_STATS_REC_FS        (NUM_NET_STATS_PROTOS + 2)
+#define NET_STATS_REC_RX        (NUM_NET_STATS_PROTOS + 3)
+#define NET_STATS_REC_RX_HIST   (NUM_NET_STATS_PROTOS + 4)
+#define NET_STATS_REC_HTTP      (NUM_NET_STATS_PROTOS + 5)
+#define NET_STATS_REC_END       (NUM_NET_STATS_PROTOS + 6)
+
+//*****************************************************************************
+//
+// The names of the protocols and of their counters, as used in the JSON
+// output.
+//
+//*****************************************************************************
+static const char * const g_ppcNetStatsProtoNames[NUM_NET_STATS_PROTOS] =
+{
+    "link",
+    "etharp",
+    "ip",
+    "icmp",
+    "udp",
+    "tcp"
+};
+
+static const char * const g_ppcNetStatsCounterNames[NUM_NET_STATS_COUNTERS] =
+{
+    "xmit",
+    "recv",
+    "fw",
+    "drop",
+    "chkerr",
+    "lenerr",
+    "memerr",
+    "rterr",
+    "proterr",
+    "opterr",
+    "err",
+    "cachehit"
+};
+
+//*****************************************************************************
+//
+// The snapshot that a JSON document is generated from.  It is taken when the
+// first record is generated, so that the whole document shows the counters
+// at one moment.
+//
+//*****************************************************************************
+static tNetStats g_sNetStatsJSON;
+
+//*****************************************************************************
+//
+// The receive path counters that a JSON document is generated from.  They
+// are copied for the first of their records, so that the histograms in the
+// second match the counters in the first.
+//
+//*****************************************************************************
+static tEnetRxStats g_sNetStatsRxJSON;
+
+//*****************************************************************************
+//
+// The name of each pool, in the order of the memp_t values.  lwIP only
+// keeps the names in a debug build, so they are taken from the pool list
+// here in the same way that lwIP builds its own tables.
+//
+//*****************************************************************************
+static const char * const g_ppcNetStatsPoolNames[MEMP_MAX] =
+{
+#define LWIP_MEMPOOL(name, num, size, desc) desc,
+#include "lwip/memp_std.h"
+};
+
+#if LWIP_STATS
+//*****************************************************************************
+//
+// Copy the counters of one protocol out of lwIP.
+//
+//*****************************************************************************
+static void
+NetStatsProtoCopy(uint32_t *pui32Counters, const struct stats_proto *psProto)
+{
+    pui32Counters[NET_STATS_XMIT] = psProto->xmit;
+    pui32Counters[NET_STATS_RECV] = psProto->recv;
+    pui32Counters[NET_STATS_FW] = psProto->fw;
+    pui32Counters[NET_STATS_DROP] = psProto->drop;
+    pui32Counters[NET_STATS_CHKERR] = psProto->chkerr;
+    pui32Counters[NET_STATS_LENERR] = psProto->lenerr;
+    pui32Counters[NET_STATS_MEMERR] = psProto->memerr;
+    pui32Counters[NET_STATS_RTERR] = psProto->rterr;
+    pui32Counters[NET_STATS_PROTERR] = psProto->proterr;
+    pui32Counters[NET_STATS_OPTERR] = psProto->opterr;
+    pui32Counters[NET_STATS_ERR] = psProto->err;
+    pui32Counters[NET_STATS_CACHEHIT] = psProto->cachehit;
+}
+#endif
+
+//*****************************************************************************
+//
+// Take a snapshot of the lwIP counters.  When ENET_RX_DEFERRED is set, lwIP
+// only runs from the main loop, which is where this must be called from, so
+// nothing can change the counters while they are copied.  Otherwise lwIP
+// runs in the Ethernet interrupt, and only that interrupt is held off for
+// the few dozen loads and stores of the copy.
+//
+//*****************************************************************************
+void
+NetStatsSnapshot(tNetStats *psStats)
+{
+    uint32_t ui32Proto, ui32Counter;
+#if MEMP_STATS
+    uint32_t ui32Pool;
+#endif
+
+    for(ui32Proto = 0; ui32Proto < NUM_NET_STATS_PROTOS; ui32Proto++)
+    {
+        for(ui32Counter = 0; ui32Counter < NUM_NET_STATS_COUNTERS;
+            ui32Counter++)
+        {
+            psStats->ppui32Counters[ui32Proto][ui32Counter] = 0;
+        }
+    }
+    psStats->ui32PoolFailures = 0;
+
+#if !ENET_RX_DEFERRED
+    MAP_IntDisable(INT_EMAC0);
+#endif
+
+#if LINK_STATS
+    NetStatsProtoCopy(psStats->ppui32Counters[NET_STATS_LINK],
+                      &lwip_stats.link);
+#endif
+#if ETHARP_STATS
+    NetStatsProtoCopy(psStats->ppui32Counters[NET_STATS_ETHARP],
+                      &lwip_stats.etharp);
+#endif
+#if IP_STATS
+    NetStatsProtoCopy(psStats->ppui32Counters[NET_STATS_IP], &lwip_stats.ip);
+#endif
+#if ICMP_STATS
+    NetStatsProtoCopy(psStats->ppui32Counters[NET_STATS_ICMP],
+                      &lwip_stats.icmp);
+#endif
+#if UDP_STATS
+    NetStatsProtoCopy(psStats->ppui32Counters[NET_STATS_UDP],
+                      &lwip_stats.udp);
+#endif
+#if TCP_STATS
+    NetStatsProtoCopy(psStats->ppui32Counters[NET_STATS_TCP],
+                      &lwip_stats.tcp);
+#endif
+#if MEMP_STATS
+    for(ui32Pool = 0; ui32Pool < MEMP_MAX; ui32Pool++)
+    {
+        psStats->ui32PoolFailures += lwip_stats.memp[ui32Pool].err;
+    }
+#endif
+
+#if !ENET_RX_DEFERRED
+    MAP_IntEnable(INT_EMAC0);
+#endif
+}
+
+//*****************************************************************************
+//
+// Generate the record of a JSON document that follows the protocols.
+//
+//*****************************************************************************
+static uint32_t
+NetStatsJSONExtra(char *pcBuf, uint32_t ui32Size, uint32_t ui32Record)
+{
+    tSDCacheStats sCache;
+    tFSPoolStats sFile, sSDFile;
+    tEnetRxStats *psRx;
+    uint32_t ui32Len, ui32Idx;
+
+    psRx = &g_sNetStatsRxJSON;
+
+    switch(ui32Record)
+    {
+        case NET_STATS_REC_SD_CACHE:
+        {
+            SDCacheStatsGet(&sCache);
+            return(usnprintf(pcBuf, ui32Size,
+                             ",\"sd_cache\":{\"hits\":%u,\"misses\":%u,"
+                             "\"read_aheads\":%u}",
+                             sCache.ui32Hits, sCache.ui32Misses,
+                             sCache.ui32ReadAheads));
+        }
+
+        case NET_STATS_REC_FS:
+        {
+            FSPoolStatsGet(&sFile, &sSDFile);
+            return(usnprintf(pcBuf, ui32Size,
+                             ",\"fs\":{\"files\":{\"opens\":%u,\"used\":%u,"
+                             "\"max\":%u,\"fail\":%u},\"sd_files\":{"
+                             "\"opens\":%u,\"used\":%u,\"max\":%u,"
+                             "\"fail\":%u}}",
+                             sFile.ui32Opens, sFile.ui32InUse,
+                             sFile.ui32HighWater, sFile.ui32Failures,
+                             sSDFile.ui32Opens, sSDFile.ui32InUse,
+                             sSDFile.ui32HighWater, sSDFile.ui32Failures));
+        }
+
+        case NET_STATS_REC_RX:
+        {
+            EnetRxStatsGet(psRx);
+            return(usnprintf(pcBuf, ui32Size,
+                             ",\"rx\":{\"interrupts\":%u,\"ring_overruns\":%u,"
+                             "\"fifo_overflows\":%u,\"refill_failures\":%u,"
+                             "\"io_frames\":%u,\"frames\":[%u,%u],"
+                             "\"dropped\":[%u,%u],\"small\":{\"frames\":%u,"
+                             "\"used\":%u,\"max\":%u,\"fail\":%u},"
+                             "\"large\":{\"frames\":%u,\"used\":%u,"
+                             "\"max\":%u,\"fail\":%u}",
+                             psRx->ui32Interrupts, psRx->ui32RingOverruns,
+                             psRx->ui32FIFOOverflows,
+                             psRx->ui32RefillFailures, psRx->ui32IOFrames,
+                             psRx->pui32Frames[ENET_RX_CLASS_HIGH],
+                             psRx->pui32Frames[ENET_RX_CLASS_LOW],
+                             psRx->pui32Dropped[ENET_RX_CLASS_HIGH],
+                             psRx->pui32Dropped[ENET_RX_CLASS_LOW],
+                             psRx->psPools[ENET_RX_POOL_SMALL].ui32Frames,
+                             psRx->psPools[ENET_RX_POOL_SMALL].ui32InUse,
+                             psRx->psPools[ENET_RX_POOL_SMALL].ui32HighWater,
+                             psRx->psPools[ENET_RX_POOL_SMALL].ui32Failures,
+                             psRx->psPools[ENET_RX_POOL_LARGE].ui32Frames,
+                             psRx->psPools[ENET_RX_POOL_LARGE].ui32InUse,
+                             psRx->psPools[ENET_RX_POOL_LARGE].ui32HighWater,
+                             psRx->psPools[ENET_RX_POOL_LARGE].ui32Failures));
+        }
+
+        case NET_STATS_REC_RX_HIST:
+        {
+            //
+            // The interrupt duration in cycles, by power of two, and the
+            // number of frames waiting each time the queues were served.
+            //
+            ui32Len = usnprintf(pcBuf, ui32Size, ",\"isr_cycles\":[");
+            for(ui32Idx = 0;
+                (ui32Idx < ENET_RX_ISR_BUCKETS) && (ui32Len < ui32Size);
+                ui32Idx++)
+            {
+                ui32Len += usnprintf(pcBuf + ui32Len, ui32Size - ui32Len,
+                                     "%s%u", ui32Idx ? "," : "",
+                                     psRx->pui32ISRCycles[ui32Idx]);
+            }
+            if(ui32Len < ui32Size)
+            {
+                ui32Len += usnprintf(pcBuf + ui32Len, ui32Size - ui32Len,
+                                     "],\"queue_depth\":[");
+            }
+            for(ui32Idx = 0;
+                (ui32Idx < ((ENET_RX_NUM_CLASSES * ENET_RX_QUEUE_LEN) + 1)) &&
+                (ui32Len < ui32Size);
+                ui32Idx++)
+            {
+                ui32Len += usnprintf(pcBuf + ui32Len, ui32Size - ui32Len,
+                                     "%s%u", ui32Idx ? "," : "",
+                                     psRx->pui32QueueDepth[ui32Idx]);
+            }
+            if(ui32Len < ui32Size)
+            {
+                ui32Len += usnprintf(pcBuf + ui32Len, ui32Size - ui32Len,
+                                     "]}");
+            }
+            return(ui32Len);
+        }
+
+        case NET_STATS_REC_HTTP:
+        {
+            //
+            // The connections opened to the web server, from the receive
+            // path snapshot taken for the rx record, against the requests
+            // served, which open one file each.
+            //
+            FSPoolStatsGet(&sFile, &sSDFile);
+            return(usnprintf(pcBuf, ui32Size,
+                             ",\"http\":{\"connections\":%u,"
+                             "\"requests\":%u}",
+                             psRx->ui32HTTPConnections, sFile.ui32Opens));
+        }
+
+        default:
+        {
+            return(usnprintf(pcBuf, ui32Size, "}\n"));
+        }
+    }
+}
+
+//*****************************************************************************
+//
+// Generate one record of the lwIP counters as JSON, for FSGeneratedFileAdd().
+// Record 0 takes a snapshot and opens the document, each protocol has a
+// record of its own, and is followed by a record for the SD card cache, one
+// for the file handle pools, two for the receive path and one for the web
+// server.  The record after those closes the document.  Returns the length
+// of the record, or zero after the last.
+//
+//*****************************************************************************
+uint32_t
+NetStatsJSONGenerate(char *pcBuf, uint32_t ui32Size, uint32_t ui32Record)
+{
+    uint32_t ui32Len, ui32Counter;
+
+    if(ui32Record == 0)
+    {
+        NetStatsSnapshot(&g_sNetStatsJSON);
+        return(usnprintf(pcBuf, ui32Size, "{\"pool_failures\":%u",
+                         g_sNetStatsJSON.ui32PoolFailures));
+    }
+    if(ui32Record > NET_STATS_REC_END)
+    {
+        return(0);
+    }
+    if(ui32Record > NUM_NET_STATS_PROTOS)
+    {
+        ui32Len = NetStatsJSONExtra(pcBuf, ui32Size, ui32Record);
+        return((ui32Len < ui32Size) ? ui32Len : ui32Size);
+    }
+
+    ui32Len = usnprintf(pcBuf, ui32Size, ",\"%s\":{",
+                        g_ppcNetStatsProtoNames[ui32Record - 1]);
+
+    for(ui32Counter = 0;
+        (ui32Counter < NUM_NET_STATS_COUNTERS) && (ui32Len < ui32Size);
+        ui32Counter++)
+    {
+        ui32Len += usnprintf(pcBuf + ui32Len, ui32Size - ui32Len,
+                             "%s\"%s\":%u", ui32Counter ? "," : "",
+                             g_ppcNetStatsCounterNames[ui32Counter],
+                             (g_sNetStatsJSON.ppui32Counters[ui32Record - 1]
+                                                            [ui32Counter]));
+    }
+    if(ui32Len < ui32Size)
+    {
+        ui32Len += usnprintf(pcBuf + ui32Len, ui32Size - ui32Len, "}");
+    }
+
+    //
+    // Report a record that was cut short as longer than the space given.
+    //
+    return((ui32Len < ui32Size) ? ui32Len : ui32Size);
+}
+
+//*****************************************************************************
+//
+// Return the number of lwIP memory pools.
+//
+//*****************************************************************************
+uint32_t
+NetStatsPoolCount(void)
+{
+    return(MEMP_MAX);
+}
+
+//*****************************************************************************
+//
+// Return the counts kept for a memory pool.
+//
+//*****************************************************************************
+void
+NetStatsPoolGet(uint32_t ui32Pool, tNetStatsPool *psPool)
+{
+    psPool->pcName = g_ppcNetStatsPoolNames[ui32Pool];
+#if MEMP_STATS
+    psPool->ui32Num = lwip_stats.memp[ui32Pool].avail;
+    psPool->ui32Used = lwip_stats.memp[ui32Pool].used;
+    psPool->ui32Max = lwip_stats.memp[ui32Pool].max;
+    psPool->ui32Failures = lwip_stats.memp[ui32Pool].err;
+#else
+    psPool->ui32Num = 0;
+    psPool->ui32Used = 0;
+    psPool->ui32Max = 0;
+    psPool->ui32Failures = 0;
+#endif
+}
+
+//*****************************************************************************
+//
+// Print the use of every memory pool.
+//
+//*****************************************************************************
+void
+NetStatsPoolDump(void)
+{
+    tNetStatsPool sPool;
+    uint32_t ui32Pool;
+
+    UARTprintf("pool               num  used   max  fail\n");
+
+    for(ui32Pool = 0; ui32Pool < MEMP_MAX; ui32Pool++)
+    {
+        NetStatsPoolGet(ui32Pool, &sPool);
+        UARTprintf("%16s %5u %5u %5u %5u\n", sPool.pcName, sPool.ui32Num,
+                   sPool.ui32Used, sPool.ui32Max, sPool.ui32Failures);
+    }
+}
+
+//*****************************************************************************
+//
+// Generate one record of the use of every memory pool as JSON, for
+// FSGeneratedFileAdd().  Record 0 opens the document, each pool has a record
+// of its own, and the record after the last pool closes the document.
+// Returns the length of the record, or zero after the last.
+//
+//*****************************************************************************
+uint32_t
+NetStatsPoolJSONGenerate(char *pcBuf, uint32_t ui32Size, uint32_t ui32Record)
+{
+    tNetStatsPool sPool;
+    uint32_t ui32Len;
+
+    if(ui32Record == 0)
+    {
+        return(usnprintf(pcBuf, ui32Size, "{\"pools\":["));
+    }
+    if(ui32Record == (MEMP_MAX + 1))
+    {
+        return(usnprintf(pcBuf, ui32Size, "]}\n"));
+    }
+    if(ui32Record > (MEMP_MAX + 1))
+    {
+        return(0);
+    }
+
+    NetStatsPoolGet(ui32Record - 1, &sPool);
+
+    ui32Len = usnprintf(pcBuf, ui32Size,
+                        "%s{\"name\":\"%s\",\"num\":%u,\"used\":%u,"
+                        "\"max\":%u,\"fail\":%u}",
+                        (ui32Record == 1) ? "" : ",", sPool.pcName,
+                        sPool.ui32Num, sPool.ui32Used, sPool.ui32Max,
+                        sPool.ui32Failures);
+
+    //
+    // Report a record that was cut short as longer than the space given.
+    //
+    return((ui32Len < ui32Size) ? ui32Len : ui32Size);
+}
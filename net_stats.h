@@ -0,0 +1,113 @@
+//*****************************************************************************
+//
+// net_stats.h - Reporting of the lwIP statistics.
+//
+// Copyright (c) 2025 Texas Instruments Incorporated.
+//
+//*****************************************************************************
+
+#ifndef __NET_STATS_H__
+#define __NET_STATS_H__
+
+//*****************************************************************************
+//
+// If building with a C++ compiler, make all of the definitions in this header
+// have a C binding.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+// The protocols that lwIP keeps counters for, in the order they appear in a
+// snapshot.
+//
+//*****************************************************************************
+#define NET_STATS_LINK          0
+#define NET_STATS_ETHARP        1
+#define NET_STATS_IP            2
+#define NET_STATS_ICMP          3
+#define NET_STATS_UDP           4
+#define NET_STATS_TCP           5
+#define NUM_NET_STATS_PROTOS    6
+
+//*****************************************************************************
+//
+// The counters kept for each protocol, which are those of the lwIP
+// stats_proto structure: packets sent, received and forwarded, packets
+// dropped, and the errors that caused them to be.  A protocol whose
+// statistics are turned off in lwipopts.h reads as all zero.
+//
+//*****************************************************************************
+#define NET_STATS_XMIT          0
+#define NET_STATS_RECV          1
+#define NET_STATS_FW            2
+#define NET_STATS_DROP          3
+#define NET_STATS_CHKERR        4
+#define NET_STATS_LENERR        5
+#define NET_STATS_MEMERR        6
+#define NET_STATS_RTERR         7
+#define NET_STATS_PROTERR       8
+#define NET_STATS_OPTERR        9
+#define NET_STATS_ERR           10
+#define NET_STATS_CACHEHIT      11
+#define NUM_NET_STATS_COUNTERS  12
+
+//*****************************************************************************
+//
+// A snapshot of the lwIP protocol counters, and the total number of failed
+// allocations from all of the memory pools.
+//
+//*****************************************************************************
+typedef struct
+{
+    uint32_t ppui32Counters[NUM_NET_STATS_PROTOS][NUM_NET_STATS_COUNTERS];
+    uint32_t ui32PoolFailures;
+}
+tNetStats;
+
+//*****************************************************************************
+//
+// The counts kept for each lwIP memory pool.  ui32Num is the number of
+// blocks in the pool, ui32Used the number in use now, ui32Max the most that
+// have been in use at once, and ui32Failures the number of times a block was
+// asked for when none were free.  The counts are zero if MEMP_STATS is off.
+//
+//*****************************************************************************
+typedef struct
+{
+    const char *pcName;
+    uint32_t ui32Num;
+    uint32_t ui32Used;
+    uint32_t ui32Max;
+    uint32_t ui32Failures;
+}
+tNetStatsPool;
+
+//*****************************************************************************
+//
+// Prototypes.
+//
+//*****************************************************************************
+extern void NetStatsSnapshot(tNetStats *psStats);
+extern uint32_t NetStatsJSONGenerate(char *pcBuf, uint32_t ui32Size,
+                                     uint32_t ui32Record);
+extern uint32_t NetStatsPoolCount(void);
+extern void NetStatsPoolGet(uint32_t ui32Pool, tNetStatsPool *psPool);
+extern void NetStatsPoolDump(void);
+extern uint32_t NetStatsPoolJSONGenerate(char *pcBuf, uint32_t ui32Size,
+                                         uint32_t ui32Record);
+
+//*****************************************************************************
+//
+// Mark the end of the C bindings section for C++ compilers.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __NET_STATS_H__
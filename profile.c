@@ -0,0 +1,271 @@
+//*****************************************************************************
+//
+// profile.c - Cycle counting probes for the hot paths of the application.
+//
+// Each probe times a section of code with the free running cycle counter and
+// keeps the number of runs, the shortest, longest and total time, and a
+// log2 histogram of the run times.  The counts can be printed on the UART
+// with ProfileDump(), or served as JSON by handing ProfileJSONGenerate() to
+// FSGeneratedFileAdd().
+//
+// Copyright (c) 2025 Texas Instruments Incorporated.
+//
+//*****************************************************************************
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#ifdef PROFILE_HOST
+#include <stdio.h>
+#include <time.h>
+#else
+#include "inc/hw_types.h"
+#include "utils/uartstdio.h"
+#include "utils/ustdlib.h"
+#endif
+#include "profile.h"
+
+//*****************************************************************************
+//
+// The Cortex-M4 debug registers used to start the cycle counter.
+//
+//*****************************************************************************
+#define PROFILE_DEMCR           0xE000EDFC
+#define PROFILE_DEMCR_TRCENA    0x01000000
+#define PROFILE_DWT_CTRL        0xE0001000
+#define PROFILE_DWT_CTRL_CYCENA 0x00000001
+
+//*****************************************************************************
+//
+// The functions used for output, which differ between the target and a host
+// build.
+//
+//*****************************************************************************
+#ifdef PROFILE_HOST
+#define ProfilePrintf           printf
+#define ProfileSNPrintf         snprintf
+#define PROFILE_UNIT            "ns"
+#else
+#define ProfilePrintf           UARTprintf
+#define ProfileSNPrintf         usnprintf
+#define PROFILE_UNIT            "cycles"
+#endif
+
+//*****************************************************************************
+//
+// The name of each probe, as printed and as used in the JSON output.
+//
+//*****************************************************************************
+static const char * const g_ppcProfileNames[NUM_PROFILE_PROBES] =
+{
+    "enet_isr",
+    "lwip_handler",
+    "lwip_input",
+    "fs_process",
+    "timer_wheel",
+    "ei_app",
+    "eip_io",
+    "eip_io_lat"
+};
+
+//*****************************************************************************
+//
+// The counter value at which each probe was last entered, and the counts
+// kept for each probe.
+//
+//*****************************************************************************
+uint32_t g_pui32ProfileStart[NUM_PROFILE_PROBES];
+static tProfileProbe g_psProfileProbes[NUM_PROFILE_PROBES];
+
+#ifdef PROFILE_HOST
+//*****************************************************************************
+//
+// Read the monotonic clock of the host, in nanoseconds.  Only the low 32
+// bits are kept, which is enough to time runs of up to four seconds.
+//
+//*****************************************************************************
+uint32_t
+ProfileCountGet(void)
+{
+    struct timespec sTime;
+
+    clock_gettime(CLOCK_MONOTONIC, &sTime);
+
+    return((uint32_t)((sTime.tv_sec * 1000000000ULL) + sTime.tv_nsec));
+}
+#endif
+
+//*****************************************************************************
+//
+// Start the cycle counter and clear the counts of every probe.
+//
+//*****************************************************************************
+void
+ProfileInit(void)
+{
+    uint32_t ui32Probe;
+
+#ifndef PROFILE_HOST
+    HWREG(PROFILE_DEMCR) |= PROFILE_DEMCR_TRCENA;
+    HWREG(PROFILE_DWT_CTRL) |= PROFILE_DWT_CTRL_CYCENA;
+#endif
+
+    for(ui32Probe = 0; ui32Probe < NUM_PROFILE_PROBES; ui32Probe++)
+    {
+        memset(&g_psProfileProbes[ui32Probe], 0, sizeof(tProfileProbe));
+        g_psProfileProbes[ui32Probe].ui32Min = 0xffffffff;
+    }
+}
+
+//*****************************************************************************
+//
+// Count one run of a probe.  This is called by PROFILE_END().
+//
+//*****************************************************************************
+void
+ProfileRecord(uint32_t ui32Probe, uint32_t ui32Count)
+{
+    tProfileProbe *psProbe;
+    uint32_t ui32Bucket, ui32Bits;
+
+    psProbe = &g_psProfileProbes[ui32Probe];
+
+    psProbe->ui32Runs++;
+    psProbe->ui64Total += ui32Count;
+    if(ui32Count < psProbe->ui32Min)
+    {
+        psProbe->ui32Min = ui32Count;
+    }
+    if(ui32Count > psProbe->ui32Max)
+    {
+        psProbe->ui32Max = ui32Count;
+    }
+
+    ui32Bucket = 0;
+    for(ui32Bits = ui32Count; ui32Bits >>= 1; )
+    {
+        ui32Bucket++;
+    }
+    psProbe->pui32Histogram[ui32Bucket]++;
+}
+
+//*****************************************************************************
+//
+// Return a copy of the counts kept for a probe.
+//
+//*****************************************************************************
+void
+ProfileProbeGet(uint32_t ui32Probe, tProfileProbe *psProbe)
+{
+    *psProbe = g_psProfileProbes[ui32Probe];
+    if(psProbe->ui32Runs == 0)
+    {
+        psProbe->ui32Min = 0;
+    }
+}
+
+//*****************************************************************************
+//
+// Print the counts of every probe that has run.  The histogram is printed
+// as the number of runs in each bucket from the first to the last bucket
+// that has any.
+//
+//*****************************************************************************
+void
+ProfileDump(void)
+{
+    tProfileProbe sProbe;
+    uint32_t ui32Probe, ui32First, ui32Last, ui32Bucket;
+
+    ProfilePrintf("probe          runs       min      mean       max (%s)\n",
+                  PROFILE_UNIT);
+
+    for(ui32Probe = 0; ui32Probe < NUM_PROFILE_PROBES; ui32Probe++)
+    {
+        ProfileProbeGet(ui32Probe, &sProbe);
+        if(sProbe.ui32Runs == 0)
+        {
+            continue;
+        }
+
+        ProfilePrintf("%12s %6u %9u %9u %9u\n", g_ppcProfileNames[ui32Probe],
+                      sProbe.ui32Runs, sProbe.ui32Min,
+                      (uint32_t)(sProbe.ui64Total / sProbe.ui32Runs),
+                      sProbe.ui32Max);
+
+        for(ui32First = 0; sProbe.pui32Histogram[ui32First] == 0;
+            ui32First++)
+        {
+        }
+        for(ui32Last = PROFILE_BUCKETS - 1;
+            sProbe.pui32Histogram[ui32Last] == 0; ui32Last--)
+        {
+        }
+
+        ProfilePrintf("  2^%u:", ui32First);
+        for(ui32Bucket = ui32First; ui32Bucket <= ui32Last; ui32Bucket++)
+        {
+            ProfilePrintf(" %u", sProbe.pui32Histogram[ui32Bucket]);
+        }
+        ProfilePrintf("\n");
+    }
+}
+
+//*****************************************************************************
+//
+// Generate one record of the counts of every probe as JSON, for
+// FSGeneratedFileAdd().  Record 0 opens the document, each probe has a
+// record of its own, and the record after the last probe closes the
+// document.  Returns the length of the record, or zero after the last.
+//
+//*****************************************************************************
+uint32_t
+ProfileJSONGenerate(char *pcBuf, uint32_t ui32Size, uint32_t ui32Record)
+{
+    tProfileProbe sProbe;
+    uint32_t ui32Len, ui32Bucket;
+
+    if(ui32Record == 0)
+    {
+        return(ProfileSNPrintf(pcBuf, ui32Size,
+                               "{\"unit\":\"%s\",\"probes\":[",
+                               PROFILE_UNIT));
+    }
+    if(ui32Record == (NUM_PROFILE_PROBES + 1))
+    {
+        return(ProfileSNPrintf(pcBuf, ui32Size, "]}\n"));
+    }
+    if(ui32Record > (NUM_PROFILE_PROBES + 1))
+    {
+        return(0);
+    }
+
+    ProfileProbeGet(ui32Record - 1, &sProbe);
+
+    ui32Len = ProfileSNPrintf(pcBuf, ui32Size,
+                              "%s{\"name\":\"%s\",\"runs\":%u,\"min\":%u,"
+                              "\"mean\":%u,\"max\":%u,\"histogram\":[",
+                              (ui32Record == 1) ? "" : ",",
+                              g_ppcProfileNames[ui32Record - 1],
+                              sProbe.ui32Runs, sProbe.ui32Min,
+                              (sProbe.ui32Runs ?
+                               (uint32_t)(sProbe.ui64Total / sProbe.ui32Runs) :
+                               0), sProbe.ui32Max);
+
+    for(ui32Bucket = 0; (ui32Bucket < PROFILE_BUCKETS) && (ui32Len < ui32Size);
+        ui32Bucket++)
+    {
+        ui32Len += ProfileSNPrintf(pcBuf + ui32Len, ui32Size - ui32Len,
+                                   "%s%u", ui32Bucket ? "," : "",
+                                   sProbe.pui32Histogram[ui32Bucket]);
+    }
+    if(ui32Len < ui32Size)
+    {
+        ui32Len += ProfileSNPrintf(pcBuf + ui32Len, ui32Size - ui32Len, "]}");
+    }
+
+    //
+    // Report a record that was cut short as longer than the space given.
+    //
+    return((ui32Len < ui32Size) ? ui32Len : ui32Size);
+}
@@ -0,0 +1,142 @@
+//*****************************************************************************
+//
+// profile.h - Cycle counting probes for the hot paths of the application.
+//
+// Copyright (c) 2025 Texas Instruments Incorporated.
+//
+//*****************************************************************************
+
+#ifndef __PROFILE_H__
+#define __PROFILE_H__
+
+//*****************************************************************************
+//
+// If building with a C++ compiler, make all of the definitions in this header
+// have a C binding.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+// Set to 1 to compile the probes in.  Otherwise PROFILE_BEGIN() and
+// PROFILE_END() generate no code at all, and every probe reads zero.
+//
+//*****************************************************************************
+#ifndef PROFILE_ENABLE
+#define PROFILE_ENABLE          0
+#endif
+
+//*****************************************************************************
+//
+// The probes.  Each times one section of code, given by a PROFILE_BEGIN() and
+// PROFILE_END() pair with the same probe.  A probe must not be nested within
+// itself, or entered from an interrupt while it is running.
+//
+//*****************************************************************************
+#define PROFILE_ENET_ISR        0
+#define PROFILE_LWIP_HANDLER    1
+#define PROFILE_LWIP_INPUT      2
+#define PROFILE_FS_PROCESS      3
+#define PROFILE_TIMER_WHEEL     4
+#define PROFILE_EI_APP          5
+#define PROFILE_EIP_IO          6
+#define PROFILE_EIP_IO_LATENCY  7
+#define NUM_PROFILE_PROBES      8
+
+//*****************************************************************************
+//
+// The number of buckets in the histogram kept for each probe.  Bucket N
+// counts runs that took from 2^N up to 2^(N+1) - 1 counts, and bucket 0 also
+// counts those that took none.
+//
+//*****************************************************************************
+#define PROFILE_BUCKETS         32
+
+//*****************************************************************************
+//
+// The counts kept for each probe.  The unit is processor cycles on the
+// target and nanoseconds in a host build.
+//
+//*****************************************************************************
+typedef struct
+{
+    uint32_t ui32Runs;
+    uint32_t ui32Min;
+    uint32_t ui32Max;
+    uint64_t ui64Total;
+    uint32_t pui32Histogram[PROFILE_BUCKETS];
+}
+tProfileProbe;
+
+//*****************************************************************************
+//
+// Read the free running counter that probes are timed with.  On the target
+// this is the Cortex-M4 DWT cycle counter, which ProfileInit() starts.  A
+// build for the host defines PROFILE_HOST and counts nanoseconds instead.
+//
+//*****************************************************************************
+#ifdef PROFILE_HOST
+extern uint32_t ProfileCountGet(void);
+#else
+#define PROFILE_DWT_CYCCNT      0xE0001004
+#define ProfileCountGet()       HWREG(PROFILE_DWT_CYCCNT)
+#endif
+
+//*****************************************************************************
+//
+// Mark the start and end of the code timed by a probe.
+//
+//*****************************************************************************
+#if PROFILE_ENABLE
+#define PROFILE_BEGIN(ui32Probe)                                              \
+        do                                                                    \
+        {                                                                     \
+            g_pui32ProfileStart[ui32Probe] = ProfileCountGet();               \
+        }                                                                     \
+        while(0)
+
+#define PROFILE_END(ui32Probe)                                                \
+        do                                                                    \
+        {                                                                     \
+            ProfileRecord(ui32Probe, (ProfileCountGet() -                     \
+                                      g_pui32ProfileStart[ui32Probe]));       \
+        }                                                                     \
+        while(0)
+#else
+#define PROFILE_BEGIN(ui32Probe)
+#define PROFILE_END(ui32Probe)
+#endif
+
+//*****************************************************************************
+//
+// The counter value at which each probe was last entered.
+//
+//*****************************************************************************
+extern uint32_t g_pui32ProfileStart[NUM_PROFILE_PROBES];
+
+//*****************************************************************************
+//
+// Prototypes.
+//
+//*****************************************************************************
+extern void ProfileInit(void);
+extern void ProfileRecord(uint32_t ui32Probe, uint32_t ui32Count);
+extern void ProfileProbeGet(uint32_t ui32Probe, tProfileProbe *psProbe);
+extern void ProfileDump(void);
+extern uint32_t ProfileJSONGenerate(char *pcBuf, uint32_t ui32Size,
+                                    uint32_t ui32Record);
+
+//*****************************************************************************
+//
+// Mark the end of the C bindings section for C++ compilers.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __PROFILE_H__
@@ -0,0 +1,358 @@
+//*****************************************************************************
+//
+// sd_cache.c - Shared sector cache for the SD card.
+//
+// This module sits between FatFs and the SD card driver.  Every sector FatFs
+// reads, for any open file, goes through a single LRU cache of card sectors,
+// so that files requested by several web clients are only read from the card
+// once while they stay in the cache.
+//
+// Copyright (c) 2025 Texas Instruments Incorporated.
+//
+//*****************************************************************************
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+//*****************************************************************************
+//
+// Include the SD card driver for this board with its disk access functions
+// renamed, so that the versions defined in this file are the ones FatFs
+// calls.  The driver's remaining functions (disk_status(), disk_ioctl(),
+// disk_timerproc() and get_fattime()) are used as they are.
+//
+//*****************************************************************************
+#define disk_initialize         MMCDiskInitialize
+#define disk_read               MMCDiskRead
+#define disk_write              MMCDiskWrite
+#include "fatfs/port/mmc-ek-tm4c1294xl.c"
+#undef disk_initialize
+#undef disk_read
+#undef disk_write
+
+#include "sd_cache.h"
+
+//*****************************************************************************
+//
+// The size of a card sector and of a cache line, in bytes, and the number of
+// lines the RAM budget allows.
+//
+//*****************************************************************************
+#define SD_CACHE_SECTOR_SIZE    512
+#define SD_CACHE_LINE_SIZE      (SD_CACHE_LINE_SECTORS * SD_CACHE_SECTOR_SIZE)
+#define SD_CACHE_LINES          (SD_CACHE_SIZE / SD_CACHE_LINE_SIZE)
+
+//
+// Read-ahead loads a second line while the first is still being used, so
+// there must be room for both.
+//
+#if SD_CACHE_LINES < 2
+#error "SD_CACHE_SIZE must hold at least two lines"
+#endif
+
+//*****************************************************************************
+//
+// The line number held by a line that contains no valid data.
+//
+//*****************************************************************************
+#define SD_CACHE_LINE_INVALID   0xffffffff
+
+//*****************************************************************************
+//
+// The state of each line: the line number it holds (its first sector divided
+// by SD_CACHE_LINE_SECTORS) and the value of g_ui32SDCacheClock when it was
+// last used, which picks the line to evict.  These are set up by
+// SDCacheInvalidate(), which runs from disk_initialize() before FatFs reads
+// anything from the card.
+//
+//*****************************************************************************
+typedef struct
+{
+    uint32_t ui32Line;
+    uint32_t ui32LastUse;
+}
+tSDCacheTag;
+
+static tSDCacheTag g_psSDCacheTags[SD_CACHE_LINES];
+
+//*****************************************************************************
+//
+// The cached sector data.  This is word aligned so that the driver can move
+// it a word at a time.
+//
+//*****************************************************************************
+static uint32_t g_pui32SDCacheData[SD_CACHE_LINES][SD_CACHE_LINE_SIZE / 4];
+
+//*****************************************************************************
+//
+// A counter that advances on every access and dates each line's last use.
+//
+//*****************************************************************************
+static uint32_t g_ui32SDCacheClock;
+
+//*****************************************************************************
+//
+// The line most recently accessed.  A miss on the line after it is taken as
+// a sequential read, and triggers read-ahead of the following line.
+//
+//*****************************************************************************
+static uint32_t g_ui32SDCacheLastLine = SD_CACHE_LINE_INVALID;
+
+//*****************************************************************************
+//
+// The line to be read ahead by SDCacheReadAhead(), and the drive it is on.
+//
+//*****************************************************************************
+static uint32_t g_ui32SDCacheAheadLine = SD_CACHE_LINE_INVALID;
+static BYTE g_ui8SDCacheAheadDrive;
+
+//*****************************************************************************
+//
+// The cache counters.
+//
+//*****************************************************************************
+static tSDCacheStats g_sSDCacheStats;
+
+//*****************************************************************************
+//
+// Find the cache line holding a given line number.  Returns the index of the
+// line, or -1 if it is not in the cache.
+//
+//*****************************************************************************
+static int32_t
+SDCacheFind(uint32_t ui32Line)
+{
+    int32_t i32Idx;
+
+    for(i32Idx = 0; i32Idx < SD_CACHE_LINES; i32Idx++)
+    {
+        if(g_psSDCacheTags[i32Idx].ui32Line == ui32Line)
+        {
+            return(i32Idx);
+        }
+    }
+
+    return(-1);
+}
+
+//*****************************************************************************
+//
+// Load a line from the card into the least recently used cache line.
+// Returns the index of the line, or -1 if the card could not be read.
+//
+//*****************************************************************************
+static int32_t
+SDCacheFill(BYTE ui8Drive, uint32_t ui32Line)
+{
+    int32_t i32Idx, i32Victim;
+
+    //
+    // Pick the line that has gone unused the longest.  Invalid lines hold
+    // nothing, so they go first.
+    //
+    i32Victim = 0;
+    for(i32Idx = 0; i32Idx < SD_CACHE_LINES; i32Idx++)
+    {
+        if(g_psSDCacheTags[i32Idx].ui32Line == SD_CACHE_LINE_INVALID)
+        {
+            i32Victim = i32Idx;
+            break;
+        }
+        if((g_ui32SDCacheClock - g_psSDCacheTags[i32Idx].ui32LastUse) >
+           (g_ui32SDCacheClock - g_psSDCacheTags[i32Victim].ui32LastUse))
+        {
+            i32Victim = i32Idx;
+        }
+    }
+
+    //
+    // Read the whole line in a single multi-sector transfer.  The line is
+    // invalid until the read succeeds.
+    //
+    g_psSDCacheTags[i32Victim].ui32Line = SD_CACHE_LINE_INVALID;
+    if(MMCDiskRead(ui8Drive, (BYTE *)g_pui32SDCacheData[i32Victim],
+                   ui32Line * SD_CACHE_LINE_SECTORS,
+                   SD_CACHE_LINE_SECTORS) != RES_OK)
+    {
+        return(-1);
+    }
+
+    g_psSDCacheTags[i32Victim].ui32Line = ui32Line;
+    g_psSDCacheTags[i32Victim].ui32LastUse = g_ui32SDCacheClock;
+
+    return(i32Victim);
+}
+
+//*****************************************************************************
+//
+// Discard everything held in the cache.
+//
+//*****************************************************************************
+void
+SDCacheInvalidate(void)
+{
+    int32_t i32Idx;
+
+    for(i32Idx = 0; i32Idx < SD_CACHE_LINES; i32Idx++)
+    {
+        g_psSDCacheTags[i32Idx].ui32Line = SD_CACHE_LINE_INVALID;
+    }
+
+    g_ui32SDCacheLastLine = SD_CACHE_LINE_INVALID;
+    g_ui32SDCacheAheadLine = SD_CACHE_LINE_INVALID;
+}
+
+//*****************************************************************************
+//
+// Load the line that a sequential reader will want next, if disk_read() has
+// found one since the last call.  This is called from fs_process() once it
+// has passed the data already read on to httpd, so that the card is read
+// while the data is being sent rather than before.
+//
+//*****************************************************************************
+void
+SDCacheReadAhead(void)
+{
+    uint32_t ui32Line;
+
+    ui32Line = g_ui32SDCacheAheadLine;
+    if(ui32Line == SD_CACHE_LINE_INVALID)
+    {
+        return;
+    }
+    g_ui32SDCacheAheadLine = SD_CACHE_LINE_INVALID;
+
+    if((SDCacheFind(ui32Line) < 0) &&
+       (SDCacheFill(g_ui8SDCacheAheadDrive, ui32Line) >= 0))
+    {
+        g_sSDCacheStats.ui32ReadAheads++;
+    }
+}
+
+//*****************************************************************************
+//
+// Return a copy of the cache counters.
+//
+//*****************************************************************************
+void
+SDCacheStatsGet(tSDCacheStats *psStats)
+{
+    *psStats = g_sSDCacheStats;
+}
+
+//*****************************************************************************
+//
+// Initialize the card, dropping anything cached from a card that may since
+// have been replaced.
+//
+//*****************************************************************************
+DSTATUS
+disk_initialize(BYTE ui8Drive)
+{
+    SDCacheInvalidate();
+
+    return(MMCDiskInitialize(ui8Drive));
+}
+
+//*****************************************************************************
+//
+// Read sectors for FatFs, from the cache where possible.
+//
+//*****************************************************************************
+DRESULT
+disk_read(BYTE ui8Drive, BYTE *pui8Buffer, DWORD ui32Sector, BYTE ui8Count)
+{
+    uint32_t ui32Line;
+    int32_t i32Idx;
+    DRESULT eResult;
+
+    while(ui8Count--)
+    {
+        ui32Line = ui32Sector / SD_CACHE_LINE_SECTORS;
+        g_ui32SDCacheClock++;
+
+        i32Idx = SDCacheFind(ui32Line);
+        if(i32Idx >= 0)
+        {
+            g_sSDCacheStats.ui32Hits++;
+        }
+        else
+        {
+            g_sSDCacheStats.ui32Misses++;
+
+            i32Idx = SDCacheFill(ui8Drive, ui32Line);
+            if(i32Idx < 0)
+            {
+                //
+                // The line could not be read as a whole, which happens for
+                // the partial line at the end of the card.  Read just this
+                // sector, bypassing the cache.
+                //
+                eResult = MMCDiskRead(ui8Drive, pui8Buffer, ui32Sector, 1);
+                if(eResult != RES_OK)
+                {
+                    return(eResult);
+                }
+
+                pui8Buffer += SD_CACHE_SECTOR_SIZE;
+                ui32Sector++;
+                continue;
+            }
+
+            //
+            // If this follows on from the last line used, the reader is
+            // working through the card sequentially, so have
+            // SDCacheReadAhead() load the next line and have it waiting
+            // when the reader gets there.
+            //
+            if((g_ui32SDCacheLastLine != SD_CACHE_LINE_INVALID) &&
+               (ui32Line == (g_ui32SDCacheLastLine + 1)))
+            {
+                g_ui32SDCacheAheadLine = ui32Line + 1;
+                g_ui8SDCacheAheadDrive = ui8Drive;
+            }
+        }
+
+        g_psSDCacheTags[i32Idx].ui32LastUse = g_ui32SDCacheClock;
+        g_ui32SDCacheLastLine = ui32Line;
+
+        memcpy(pui8Buffer,
+               (uint8_t *)g_pui32SDCacheData[i32Idx] +
+               ((ui32Sector % SD_CACHE_LINE_SECTORS) * SD_CACHE_SECTOR_SIZE),
+               SD_CACHE_SECTOR_SIZE);
+
+        pui8Buffer += SD_CACHE_SECTOR_SIZE;
+        ui32Sector++;
+    }
+
+    return(RES_OK);
+}
+
+//*****************************************************************************
+//
+// Write sectors for FatFs, dropping any cached copies of them first.
+//
+//*****************************************************************************
+#if _FS_READONLY == 0
+DRESULT
+disk_write(BYTE ui8Drive, const BYTE *pui8Buffer, DWORD ui32Sector,
+           BYTE ui8Count)
+{
+    uint32_t ui32Line;
+    int32_t i32Idx;
+
+    for(ui32Line = ui32Sector / SD_CACHE_LINE_SECTORS;
+        ui32Line <= ((ui32Sector + ui8Count - 1) / SD_CACHE_LINE_SECTORS);
+        ui32Line++)
+    {
+        i32Idx = SDCacheFind(ui32Line);
+        if(i32Idx >= 0)
+        {
+            g_psSDCacheTags[i32Idx].ui32Line = SD_CACHE_LINE_INVALID;
+        }
+    }
+
+    return(MMCDiskWrite(ui8Drive, pui8Buffer, ui32Sector, ui8Count));
+}
+#endif
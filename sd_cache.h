@@ -0,0 +1,71 @@
+//*****************************************************************************
+//
+// sd_cache.h - Shared sector cache for the SD card.
+//
+// Copyright (c) 2025 Texas Instruments Incorporated.
+//
+//*****************************************************************************
+
+#ifndef __SD_CACHE_H__
+#define __SD_CACHE_H__
+
+//*****************************************************************************
+//
+// If building with a C++ compiler, make all of the definitions in this header
+// have a C binding.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+// The amount of RAM, in bytes, given to the cache.  This is divided into
+// lines of SD_CACHE_LINE_SECTORS sectors, which are the unit the cache reads
+// from the card and evicts.
+//
+//*****************************************************************************
+#ifndef SD_CACHE_SIZE
+#define SD_CACHE_SIZE           (16 * 1024)
+#endif
+
+#ifndef SD_CACHE_LINE_SECTORS
+#define SD_CACHE_LINE_SECTORS   4
+#endif
+
+//*****************************************************************************
+//
+// Counters kept by the cache.  Hits and misses count individual sectors
+// requested by FatFs.  Read-aheads count lines loaded by SDCacheReadAhead()
+// ahead of a sequential reader, before they were asked for.
+//
+//*****************************************************************************
+typedef struct
+{
+    uint32_t ui32Hits;
+    uint32_t ui32Misses;
+    uint32_t ui32ReadAheads;
+}
+tSDCacheStats;
+
+//*****************************************************************************
+//
+// Prototypes.
+//
+//*****************************************************************************
+extern void SDCacheInvalidate(void);
+extern void SDCacheStatsGet(tSDCacheStats *psStats);
+extern void SDCacheReadAhead(void);
+
+//*****************************************************************************
+//
+// Mark the end of the C bindings section for C++ compilers.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __SD_CACHE_H__
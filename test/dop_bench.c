@@ -0,0 +1,204 @@
+//*****************************************************************************
+//
+// dop_bench.c - Host benchmark of finding the discrete output point objects.
+//
+// discrete_io_device_dop.c is built with the AM64x stand-ins for
+// CFG_PROFILE_DIO_DEVICE_DOP_NUM_OF_INST instances.  The harness adds every
+// instance, checks that each is found and that no other is, and then times
+// reading an attribute of each through DIO_DEVICE_DOP_getObjValue(), which
+// finds the object in the table indexed by instance ID.  For comparison, it
+// also times finding each object by walking a linked list of the objects,
+// which is how the class found them before the table.  The times are in
+// nanoseconds of the host.
+//
+// Copyright (c) 2025 Texas Instruments Incorporated.
+//
+//*****************************************************************************
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "host.h"
+#include "profile.h"
+#include "osal.h"
+#include "EI_API.h"
+#include "cfg_example.h"
+#include "device_profiles/discrete_io_device/discrete_io_device.h"
+#include "device_profiles/discrete_io_device/discrete_io_device_dop.h"
+
+//*****************************************************************************
+//
+// The number of times each object is found, for each way of finding it.
+//
+//*****************************************************************************
+#define BENCH_ROUNDS            2000
+
+//*****************************************************************************
+//
+// One object of the linked list that the linear search walks.  The value
+// stands in for the attributes of the object.
+//
+//*****************************************************************************
+typedef struct tBenchObject
+{
+    uint16_t ui16Instance;
+    bool bInUse;
+    uint8_t ui8Value;
+    struct tBenchObject *psNext;
+}
+tBenchObject;
+
+//*****************************************************************************
+//
+// The first object of the list.
+//
+//*****************************************************************************
+static tBenchObject *g_psBenchList;
+
+//*****************************************************************************
+//
+// The callbacks of the objects.
+//
+//*****************************************************************************
+static void
+BenchSetOutput(uint16_t ui16Instance, ei_api_cip_edt_bool ui8Value)
+{
+}
+
+static void
+BenchGetEvent(DIO_DEVICE_ConnectionState_t *psConnection,
+              EI_API_ADP_SModNetStatus_t *psStatus)
+{
+    psStatus->mod = EI_API_ADP_eSTATUS_LED_GREEN_ON;
+    psStatus->net = EI_API_ADP_eSTATUS_LED_GREEN_ON;
+}
+
+//*****************************************************************************
+//
+// Add an object to the end of the list, as the class used to.
+//
+//*****************************************************************************
+static void
+BenchListAdd(uint16_t ui16Instance)
+{
+    tBenchObject *psObject, **ppsLink;
+
+    psObject = calloc(1, sizeof(tBenchObject));
+    psObject->ui16Instance = ui16Instance;
+    psObject->bInUse = true;
+
+    for(ppsLink = &g_psBenchList; *ppsLink != NULL;
+        ppsLink = &(*ppsLink)->psNext)
+    {
+    }
+    *ppsLink = psObject;
+}
+
+//*****************************************************************************
+//
+// Find an object by walking the list.
+//
+//*****************************************************************************
+static tBenchObject *
+BenchListFind(uint16_t ui16Instance)
+{
+    tBenchObject *psObject;
+
+    for(psObject = g_psBenchList; psObject != NULL;
+        psObject = psObject->psNext)
+    {
+        if(psObject->bInUse && (psObject->ui16Instance == ui16Instance))
+        {
+            return(psObject);
+        }
+    }
+
+    return(NULL);
+}
+
+//*****************************************************************************
+//
+// Run the harness.
+//
+//*****************************************************************************
+int
+main(void)
+{
+    DIO_DEVICE_DOP_ObjectCfg_t sCfg;
+    EI_API_CIP_NODE_InitParams_t sParams;
+    ei_api_cip_edt_usint ui8Value;
+    tBenchObject *psObject;
+    uint32_t ui32Instance, ui32Round, ui32Start;
+    uint64_t ui64Table, ui64List;
+    bool bFound;
+
+    DIO_DEVICE_DOP_init(EI_API_CIP_NODE_new(&sParams));
+    memset(&sCfg, 0, sizeof(sCfg));
+    sCfg.fuSetOutput = BenchSetOutput;
+    sCfg.fuGetEvent = BenchGetEvent;
+
+    //
+    // Add every instance, and check that each is found and no other is.
+    //
+    bFound = true;
+    for(ui32Instance = 1;
+        ui32Instance <= CFG_PROFILE_DIO_DEVICE_DOP_NUM_OF_INST; ui32Instance++)
+    {
+        bFound = (DIO_DEVICE_DOP_addObject(ui32Instance, &sCfg) && bFound);
+        BenchListAdd(ui32Instance);
+    }
+    HostCheck(bFound, "every object added");
+
+    bFound = true;
+    for(ui32Instance = 1;
+        ui32Instance <= CFG_PROFILE_DIO_DEVICE_DOP_NUM_OF_INST; ui32Instance++)
+    {
+        bFound = ((DIO_DEVICE_DOP_getObjValue(ui32Instance, 3, &ui8Value) ==
+                   EI_API_eERR_CB_NO_ERROR) && bFound);
+    }
+    HostCheck(bFound, "every object found");
+    HostCheck(DIO_DEVICE_DOP_getObjValue(
+                  CFG_PROFILE_DIO_DEVICE_DOP_NUM_OF_INST + 1, 3, &ui8Value) !=
+              EI_API_eERR_CB_NO_ERROR, "a missing object is not found");
+
+    //
+    // Time reading every object through the table, and finding every
+    // object by walking the list.
+    //
+    ui64Table = 0;
+    ui64List = 0;
+    for(ui32Round = 0; ui32Round < BENCH_ROUNDS; ui32Round++)
+    {
+        ui32Start = ProfileCountGet();
+        for(ui32Instance = 1;
+            ui32Instance <= CFG_PROFILE_DIO_DEVICE_DOP_NUM_OF_INST;
+            ui32Instance++)
+        {
+            DIO_DEVICE_DOP_getObjValue(ui32Instance, 3, &ui8Value);
+        }
+        ui64Table += ProfileCountGet() - ui32Start;
+
+        ui32Start = ProfileCountGet();
+        for(ui32Instance = 1;
+            ui32Instance <= CFG_PROFILE_DIO_DEVICE_DOP_NUM_OF_INST;
+            ui32Instance++)
+        {
+            psObject = BenchListFind(ui32Instance);
+            bFound = (psObject != NULL) && bFound;
+            ui8Value = psObject ? psObject->ui8Value : 0;
+        }
+        ui64List += ProfileCountGet() - ui32Start;
+    }
+    HostCheck(bFound, "every object found in the list");
+
+    printf("%u objects, ns per find: table (getObjValue) %u, list %u\n",
+           CFG_PROFILE_DIO_DEVICE_DOP_NUM_OF_INST,
+           (uint32_t)(ui64Table / ((uint64_t)BENCH_ROUNDS *
+                                   CFG_PROFILE_DIO_DEVICE_DOP_NUM_OF_INST)),
+           (uint32_t)(ui64List / ((uint64_t)BENCH_ROUNDS *
+                                  CFG_PROFILE_DIO_DEVICE_DOP_NUM_OF_INST)));
+
+    return(HostResult());
+}
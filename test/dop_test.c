@@ -0,0 +1,204 @@
+//*****************************************************************************
+//
+// dop_test.c - Host harness for the discrete output point objects.
+//
+// discrete_io_device_dop.c is run with the AM64x stand-ins.  The harness
+// passes output assemblies through DIO_DEVICE_DOP_receiveDataImage() and
+// connection and idle events through their own calls, the way the CIP
+// callbacks do, then runs the objects and checks their states and outputs.
+// An assembly received before a connection or idle event must not be
+// applied after it, and the objects must be run while another task holds
+// the object table.
+//
+// Copyright (c) 2025 Texas Instruments Incorporated.
+//
+//*****************************************************************************
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "host.h"
+#include "osal.h"
+#include "EI_API.h"
+#include "cfg_example.h"
+#include "device_profiles/discrete_io_device/discrete_io_device.h"
+#include "device_profiles/discrete_io_device/discrete_io_device_dop.h"
+
+//*****************************************************************************
+//
+// The outputs written by the objects, one bit per instance.
+//
+//*****************************************************************************
+static uint32_t g_ui32Outputs;
+
+//*****************************************************************************
+//
+// The callbacks of the objects.
+//
+//*****************************************************************************
+static void
+TestSetOutput(uint16_t ui16Instance, ei_api_cip_edt_bool ui8Value)
+{
+    if(ui8Value)
+    {
+        g_ui32Outputs |= 1UL << (ui16Instance - 1);
+    }
+    else
+    {
+        g_ui32Outputs &= ~(1UL << (ui16Instance - 1));
+    }
+}
+
+static void
+TestGetEvent(DIO_DEVICE_ConnectionState_t *psConnection,
+             EI_API_ADP_SModNetStatus_t *psStatus)
+{
+    psStatus->mod = EI_API_ADP_eSTATUS_LED_GREEN_ON;
+    psStatus->net = EI_API_ADP_eSTATUS_LED_GREEN_ON;
+}
+
+//*****************************************************************************
+//
+// Return the state of an object.
+//
+//*****************************************************************************
+static uint32_t
+TestState(uint16_t ui16Instance)
+{
+    ei_api_cip_edt_usint ui8State;
+
+    ui8State = 0;
+    DIO_DEVICE_DOP_getObjValue(ui16Instance, 12, &ui8State);
+    return(ui8State);
+}
+
+//*****************************************************************************
+//
+// Run every object once.
+//
+//*****************************************************************************
+static void
+TestRun(void)
+{
+    uint32_t ui32Loop;
+
+    for(ui32Loop = 0; ui32Loop < CFG_PROFILE_DIO_DEVICE_DOP_NUM_OF_INST;
+        ui32Loop++)
+    {
+        DIO_DEVICE_DOP_run();
+    }
+}
+
+//*****************************************************************************
+//
+// Run the harness.
+//
+//*****************************************************************************
+int
+main(void)
+{
+    DIO_DEVICE_DOP_ObjectCfg_t sCfg;
+    EI_API_CIP_NODE_InitParams_t sParams;
+
+    DIO_DEVICE_DOP_init(EI_API_CIP_NODE_new(&sParams));
+    memset(&sCfg, 0, sizeof(sCfg));
+    sCfg.fuSetOutput = TestSetOutput;
+    sCfg.fuGetEvent = TestGetEvent;
+    HostCheck(DIO_DEVICE_DOP_addObject(1, &sCfg), "object 1 added");
+    HostCheck(DIO_DEVICE_DOP_addObject(2, &sCfg), "object 2 added");
+
+    //
+    // An assembly moves the objects to run and sets their outputs.
+    //
+    DIO_DEVICE_DOP_receiveConnectionEvent(1,
+                                          DIO_DEVICE_DOP_CONNECTION_ESTABLISHED);
+    DIO_DEVICE_DOP_receiveConnectionEvent(2,
+                                          DIO_DEVICE_DOP_CONNECTION_ESTABLISHED);
+    TestRun();
+    HostCheck(TestState(1) == DIO_DEVICE_DOP_SM_READY, "ready on connection");
+    DIO_DEVICE_DOP_receiveDataImage(0x3, 0x3);
+    TestRun();
+    HostCheck(TestState(1) == DIO_DEVICE_DOP_SM_RUN, "run on data");
+    HostCheck(TestState(2) == DIO_DEVICE_DOP_SM_RUN, "both run on data");
+    HostCheck(g_ui32Outputs == 0x3, "outputs set from data");
+
+    //
+    // An assembly still waiting when the connection is closed is dropped.
+    //
+    DIO_DEVICE_DOP_receiveDataImage(0x1, 0x3);
+    DIO_DEVICE_DOP_receiveConnectionEvent(1,
+                                          DIO_DEVICE_DOP_CONNECTION_DELETED);
+    DIO_DEVICE_DOP_receiveConnectionEvent(2,
+                                          DIO_DEVICE_DOP_CONNECTION_DELETED);
+    TestRun();
+    HostCheck(TestState(1) == DIO_DEVICE_DOP_SM_AVAILABLE,
+              "closed object stays available");
+    HostCheck(TestState(2) == DIO_DEVICE_DOP_SM_AVAILABLE,
+              "stale data dropped on close");
+
+    //
+    // An assembly received after the event is still applied.
+    //
+    DIO_DEVICE_DOP_receiveConnectionEvent(1,
+                                          DIO_DEVICE_DOP_CONNECTION_ESTABLISHED);
+    DIO_DEVICE_DOP_receiveConnectionEvent(2,
+                                          DIO_DEVICE_DOP_CONNECTION_ESTABLISHED);
+    DIO_DEVICE_DOP_receiveDataImage(0x2, 0x3);
+    TestRun();
+    HostCheck(TestState(1) == DIO_DEVICE_DOP_SM_RUN, "new data applied");
+    HostCheck(g_ui32Outputs == 0x2, "outputs set from new data");
+
+    //
+    // An assembly still waiting when idle is received is dropped too.
+    //
+    DIO_DEVICE_DOP_receiveDataImage(0x1, 0x3);
+    DIO_DEVICE_DOP_receiveIdleEvent(1);
+    DIO_DEVICE_DOP_receiveIdleEvent(2);
+    TestRun();
+    HostCheck(TestState(1) == DIO_DEVICE_DOP_SM_IDLE,
+              "idle object stays idle");
+    HostCheck(TestState(2) == DIO_DEVICE_DOP_SM_IDLE,
+              "stale data dropped on idle");
+
+    //
+    // The objects are run while the object table is held elsewhere.
+    //
+    DIO_DEVICE_DOP_receiveConnectionEvent(1,
+                                          DIO_DEVICE_DOP_CONNECTION_ESTABLISHED);
+    DIO_DEVICE_DOP_receiveConnectionEvent(2,
+                                          DIO_DEVICE_DOP_CONNECTION_ESTABLISHED);
+    DIO_DEVICE_DOP_receiveDataImage(0x3, 0x3);
+    g_bOsalMutexBusy = true;
+    g_ui32OsalLockFailures = 0;
+    TestRun();
+    g_bOsalMutexBusy = false;
+    HostCheck(g_ui32OsalLockFailures == 0, "run does not lock");
+    HostCheck(g_ui32Outputs == 0x3, "outputs set while locked");
+    HostCheck(DIO_DEVICE_DOP_getLockedCycles() == 0, "no cycle counted");
+
+    //
+    // After an idle and a run command an unchanged assembly moves the object
+    // back to run.
+    //
+    DIO_DEVICE_DOP_setCommand(1, 0);
+    TestRun();
+    HostCheck(TestState(1) == DIO_DEVICE_DOP_SM_IDLE, "idle on command");
+    DIO_DEVICE_DOP_setCommand(1, 1);
+    TestRun();
+    HostCheck(TestState(1) == DIO_DEVICE_DOP_SM_READY, "ready on command");
+    DIO_DEVICE_DOP_receiveDataImage(0x3, 0x3);
+    TestRun();
+    HostCheck(TestState(1) == DIO_DEVICE_DOP_SM_RUN,
+              "run on unchanged data");
+
+    //
+    // A deleted object is no longer run.
+    //
+    HostCheck(DIO_DEVICE_DOP_deleteObject(2), "object 2 deleted");
+    DIO_DEVICE_DOP_receiveDataImage(0x0, 0x3);
+    TestRun();
+    HostCheck(g_ui32Outputs == 0x2, "deleted object not run");
+
+    return(HostResult());
+}
@@ -0,0 +1,164 @@
+//*****************************************************************************
+//
+// ei_stats_test.c - Host harness for the network statistics CIP object.
+//
+// ei_tm4c_stats.c is run with a stand-in for NetStatsSnapshot() that counts
+// the snapshots taken and fills each with values that identify it.  The
+// harness checks that the attributes of an instance read in order come from
+// one snapshot, and when a new snapshot is taken.
+//
+// Copyright (c) 2025 Texas Instruments Incorporated.
+//
+//*****************************************************************************
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include "host.h"
+#include "net_stats.h"
+#include "ethernetip/ei_tm4c_stats.h"
+
+//*****************************************************************************
+//
+// The number of snapshots taken, and the time in milliseconds.
+//
+//*****************************************************************************
+static uint32_t g_ui32Snapshots;
+static uint32_t g_ui32Now;
+
+//*****************************************************************************
+//
+// Stand-ins for the snapshot and the timing wheel clock.  Every counter of
+// snapshot N reads as N * 10000 + protocol * 100 + counter.
+//
+//*****************************************************************************
+void
+NetStatsSnapshot(tNetStats *psStats)
+{
+    uint32_t ui32Proto, ui32Counter;
+
+    g_ui32Snapshots++;
+    for(ui32Proto = 0; ui32Proto < NUM_NET_STATS_PROTOS; ui32Proto++)
+    {
+        for(ui32Counter = 0; ui32Counter < NUM_NET_STATS_COUNTERS;
+            ui32Counter++)
+        {
+            psStats->ppui32Counters[ui32Proto][ui32Counter] =
+                (g_ui32Snapshots * 10000) + (ui32Proto * 100) + ui32Counter;
+        }
+    }
+    psStats->ui32PoolFailures = g_ui32Snapshots * 10000;
+}
+
+uint32_t
+TimerWheelNow(void)
+{
+    return(g_ui32Now);
+}
+
+//*****************************************************************************
+//
+// Read every attribute of an instance in order, and return true if they all
+// came from the same snapshot and hold the right counters.
+//
+//*****************************************************************************
+static bool
+TestReadInstance(uint16_t ui16Instance)
+{
+    uint32_t ui32Value, ui32Snapshot;
+    uint16_t ui16Attr;
+    bool bPass;
+
+    bPass = true;
+    ui32Snapshot = 0;
+    for(ui16Attr = 1; ui16Attr <= EI_TM4C_StatsAttrCount(ui16Instance);
+        ui16Attr++)
+    {
+        bPass = bPass && (EI_TM4C_StatsAttrGet(ui16Instance, ui16Attr,
+                                               &ui32Value) ==
+                          EI_STATS_STATUS_OK);
+        if(ui16Attr == 1)
+        {
+            ui32Snapshot = ui32Value / 10000;
+        }
+        if(ui16Instance == EI_STATS_POOL_INSTANCE)
+        {
+            bPass = bPass && (ui32Value == (ui32Snapshot * 10000));
+        }
+        else
+        {
+            bPass = bPass && (ui32Value == ((ui32Snapshot * 10000) +
+                                            ((ui16Instance - 1) * 100) +
+                                            (ui16Attr - 1)));
+        }
+    }
+
+    return(bPass);
+}
+
+//*****************************************************************************
+//
+// Run the harness.
+//
+//*****************************************************************************
+int
+main(void)
+{
+    uint32_t ui32Value, ui32Before, ui32Reads;
+    uint16_t ui16Instance;
+
+    //
+    // Reading every instance in order takes one snapshot per instance.
+    //
+    ui32Reads = 0;
+    for(ui16Instance = 1; ui16Instance <= EI_STATS_NUM_INSTANCES;
+        ui16Instance++)
+    {
+        HostCheck(TestReadInstance(ui16Instance),
+                  "instance read from one snapshot");
+        ui32Reads += EI_TM4C_StatsAttrCount(ui16Instance);
+    }
+    HostCheck(g_ui32Snapshots == EI_STATS_NUM_INSTANCES,
+              "one snapshot per instance");
+    HostCheck(EI_TM4C_StatsSnapshotCount() == g_ui32Snapshots,
+              "snapshots counted");
+    printf("%u attribute reads took %u snapshots\n", ui32Reads,
+           g_ui32Snapshots);
+
+    //
+    // Reading an attribute again, or an earlier one, takes a new snapshot.
+    //
+    ui32Before = g_ui32Snapshots;
+    EI_TM4C_StatsAttrGet(2, 5, &ui32Value);
+    EI_TM4C_StatsAttrGet(2, 5, &ui32Value);
+    HostCheck(g_ui32Snapshots == (ui32Before + 2), "repeated read is fresh");
+    EI_TM4C_StatsAttrGet(2, 3, &ui32Value);
+    HostCheck(g_ui32Snapshots == (ui32Before + 3), "earlier attribute fresh");
+
+    //
+    // A snapshot is not reused once it is too old.
+    //
+    EI_TM4C_StatsAttrGet(2, 4, &ui32Value);
+    HostCheck(g_ui32Snapshots == (ui32Before + 3), "next attribute reused");
+    g_ui32Now += EI_CONFIG_STATS_SNAPSHOT_MS + 1;
+    EI_TM4C_StatsAttrGet(2, 6, &ui32Value);
+    HostCheck(g_ui32Snapshots == (ui32Before + 4), "old snapshot replaced");
+
+    //
+    // Instances and attributes that do not exist are refused.
+    //
+    HostCheck(EI_TM4C_StatsAttrGet(0, 1, &ui32Value) ==
+              EI_STATS_STATUS_ERR_NO_INSTANCE, "instance 0 refused");
+    HostCheck(EI_TM4C_StatsAttrGet(EI_STATS_NUM_INSTANCES + 1, 1,
+                                   &ui32Value) ==
+              EI_STATS_STATUS_ERR_NO_INSTANCE, "instance too high refused");
+    HostCheck(EI_TM4C_StatsAttrGet(1, NUM_NET_STATS_COUNTERS + 1,
+                                   &ui32Value) ==
+              EI_STATS_STATUS_ERR_NO_ATTRIBUTE, "attribute too high refused");
+    HostCheck(EI_TM4C_StatsAttrGet(EI_STATS_POOL_INSTANCE, 2, &ui32Value) ==
+              EI_STATS_STATUS_ERR_NO_ATTRIBUTE, "pool attribute 2 refused");
+    HostCheck(EI_TM4C_StatsAttrGet(1, 1, NULL) ==
+              EI_STATS_STATUS_ERR_INVALID_PARAM, "NULL refused");
+
+    return(HostResult());
+}
@@ -0,0 +1,467 @@
+//*****************************************************************************
+//
+// enet_tx_test.c - Host harness for the prioritized transmit path.
+//
+// enet_tx.c is run against a fake driver with a fixed number of transmit
+// descriptors, which frees one descriptor each time a frame has had time to
+// go out on a 100 Mbit/s link.  The harness checks the order that queued
+// frames are handed to the driver, the DSCP marking, the handling of a full
+// queue and the pbuf references, and then compares how long an I/O frame
+// sent in the middle of a burst of web traffic takes to reach the wire with
+// and without the scheduler.
+//
+// Copyright (c) 2025 Texas Instruments Incorporated.
+//
+//*****************************************************************************
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "utils/lwiplib.h"
+#include "host.h"
+#include "enet_tx.h"
+
+//*****************************************************************************
+//
+// The number of transmit descriptors given to the driver with the scheduler,
+// as set by NUM_TX_DESCRIPTORS in lwipopts.h, and the number it had before.
+//
+//*****************************************************************************
+#define TEST_DESCRIPTORS        8
+#define TEST_FIFO_DESCRIPTORS   24
+
+//*****************************************************************************
+//
+// The processor clock, and the cycles taken to send one byte on the link
+// (including the preamble and gap averaged in), in tenths of a cycle.
+//
+//*****************************************************************************
+#define TEST_CLOCK_MHZ          120
+#define TEST_TENTHS_PER_BYTE    96
+
+//*****************************************************************************
+//
+// The number of frames the harness can have in use at once, and the
+// largest.
+//
+//*****************************************************************************
+#define TEST_NUM_FRAMES         64
+#define TEST_FRAME_SIZE         1514
+
+//*****************************************************************************
+//
+// A frame, with the pbuf that refers to it first so that the pbuf pointers
+// handed to enet_tx.c can be turned back into frames.
+//
+//*****************************************************************************
+typedef struct
+{
+    struct pbuf sPbuf;
+    int32_t i32Refs;
+    uint32_t ui32Sent;
+    uint8_t pui8Data[TEST_FRAME_SIZE];
+}
+tTestFrame;
+
+static tTestFrame g_psFrames[TEST_NUM_FRAMES];
+static uint32_t g_ui32NextFrame;
+
+//*****************************************************************************
+//
+// The fake driver: the frames in its descriptors, oldest first, the number
+// of descriptors, and the order frames were handed to it.
+//
+//*****************************************************************************
+static tTestFrame *g_ppsRing[TEST_FIFO_DESCRIPTORS];
+static uint32_t g_ui32RingCount;
+static uint32_t g_ui32RingSize;
+static tTestFrame *g_ppsOrder[TEST_NUM_FRAMES];
+static uint32_t g_ui32OrderCount;
+
+//*****************************************************************************
+//
+// The interface that enet_tx.c takes over.
+//
+//*****************************************************************************
+static struct netif g_sNetif;
+struct netif *netif_default;
+
+//*****************************************************************************
+//
+// Track the references to each frame.
+//
+//*****************************************************************************
+void
+pbuf_ref(struct pbuf *psFrame)
+{
+    ((tTestFrame *)psFrame)->i32Refs++;
+}
+
+u8_t
+pbuf_free(struct pbuf *psFrame)
+{
+    ((tTestFrame *)psFrame)->i32Refs--;
+    return(1);
+}
+
+//*****************************************************************************
+//
+// The output function of the fake driver.  This takes a descriptor if one
+// is free and fails otherwise, as the lwiplib driver does.
+//
+//*****************************************************************************
+static err_t
+TestDriverOutput(struct netif *psNetif, struct pbuf *psFrame)
+{
+    tTestFrame *psTestFrame;
+
+    if(g_ui32RingCount == g_ui32RingSize)
+    {
+        return(ERR_MEM);
+    }
+
+    psTestFrame = (tTestFrame *)psFrame;
+    psTestFrame->i32Refs++;
+    g_ppsRing[g_ui32RingCount++] = psTestFrame;
+    g_ppsOrder[g_ui32OrderCount++] = psTestFrame;
+
+    return(ERR_OK);
+}
+
+//*****************************************************************************
+//
+// Let the oldest frame in the descriptors go out on the wire, and free its
+// descriptor.  Returns the frame.  If bScheduler is set, the queued frames
+// are then handed to the driver, as the lwiplib handler is followed by
+// EnetTxProcess() on the target.
+//
+//*****************************************************************************
+static tTestFrame *
+TestDriverComplete(bool bScheduler)
+{
+    tTestFrame *psFrame;
+
+    psFrame = g_ppsRing[0];
+    g_ui32HostCycles += (psFrame->sPbuf.len * TEST_TENTHS_PER_BYTE) / 10;
+    memmove(g_ppsRing, g_ppsRing + 1,
+            --g_ui32RingCount * sizeof(g_ppsRing[0]));
+    psFrame->i32Refs--;
+
+    if(bScheduler)
+    {
+        EnetTxProcess();
+    }
+
+    return(psFrame);
+}
+
+//*****************************************************************************
+//
+// Reset the fake driver and the frames.
+//
+//*****************************************************************************
+static void
+TestReset(uint32_t ui32RingSize)
+{
+    g_ui32RingCount = 0;
+    g_ui32RingSize = ui32RingSize;
+    g_ui32OrderCount = 0;
+    g_ui32NextFrame = 0;
+    memset(g_psFrames, 0, sizeof(g_psFrames));
+}
+
+//*****************************************************************************
+//
+// Build a frame of ui32Len bytes.  ui32Type is the Ethernet type, and for IP
+// frames ui32Proto and ui32Port give the protocol and the destination port.
+// The type of service byte starts as ui8TOS.
+//
+//*****************************************************************************
+static tTestFrame *
+TestFrame(uint32_t ui32Len, uint32_t ui32Type, uint32_t ui32Proto,
+          uint32_t ui32Port, uint8_t ui8TOS)
+{
+    tTestFrame *psFrame;
+    uint8_t *pui8Data;
+
+    psFrame = &g_psFrames[g_ui32NextFrame++];
+    pui8Data = psFrame->pui8Data;
+    memset(pui8Data, 0, ui32Len);
+    pui8Data[12] = ui32Type >> 8;
+    pui8Data[13] = ui32Type & 0xff;
+    pui8Data[14] = 0x45;
+    pui8Data[15] = ui8TOS;
+    pui8Data[23] = ui32Proto;
+    pui8Data[34] = 0xc0;
+    pui8Data[35] = 0x00;
+    pui8Data[36] = ui32Port >> 8;
+    pui8Data[37] = ui32Port & 0xff;
+    psFrame->sPbuf.payload = pui8Data;
+    psFrame->sPbuf.len = ui32Len;
+    psFrame->sPbuf.tot_len = ui32Len;
+    psFrame->i32Refs = 1;
+    psFrame->ui32Sent = g_ui32HostCycles;
+
+    return(psFrame);
+}
+
+//*****************************************************************************
+//
+// Send a frame as lwIP does, and drop lwIP's reference to it afterwards.
+//
+//*****************************************************************************
+static err_t
+TestSend(tTestFrame *psFrame)
+{
+    err_t iErr;
+
+    iErr = netif_default->linkoutput(netif_default, &psFrame->sPbuf);
+    psFrame->i32Refs--;
+
+    return(iErr);
+}
+
+//*****************************************************************************
+//
+// Return the DSCP field of a frame.
+//
+//*****************************************************************************
+static uint32_t
+TestDSCP(tTestFrame *psFrame)
+{
+    return(psFrame->pui8Data[15] >> 2);
+}
+
+//*****************************************************************************
+//
+// The I/O frame of a burst, and the cycle count when it left the wire.
+//
+//*****************************************************************************
+static tTestFrame *g_psBurstIO;
+static uint32_t g_ui32BurstDone;
+
+//*****************************************************************************
+//
+// Let the oldest frame of a burst go out, noting when the I/O frame does.
+//
+//*****************************************************************************
+static void
+TestBurstComplete(bool bScheduler)
+{
+    if(TestDriverComplete(bScheduler) == g_psBurstIO)
+    {
+        g_ui32BurstDone = g_ui32HostCycles;
+    }
+}
+
+//*****************************************************************************
+//
+// Send a frame of a burst.  A frame that is refused, because the driver or
+// its queue is full, is sent again once a frame has gone out, as TCP would
+// retransmit it.  This is generous to the single FIFO, which would lose an
+// I/O frame that found the descriptors full.
+//
+//*****************************************************************************
+static void
+TestBurstSend(bool bScheduler, tTestFrame *psFrame)
+{
+    while(TestSend(psFrame) != ERR_OK)
+    {
+        psFrame->i32Refs++;
+        TestBurstComplete(bScheduler);
+    }
+}
+
+//*****************************************************************************
+//
+// Send a burst of ui32Bulk full-size web frames with an I/O frame after the
+// first ui32IOAfter of them, let every frame go out, and return the cycles
+// from the I/O frame being sent to it leaving the wire.
+//
+//*****************************************************************************
+static uint32_t
+TestBurst(bool bScheduler, uint32_t ui32Bulk, uint32_t ui32IOAfter)
+{
+    uint32_t ui32Idx;
+
+    g_psBurstIO = NULL;
+    g_ui32BurstDone = 0;
+    for(ui32Idx = 0; ui32Idx <= ui32Bulk; ui32Idx++)
+    {
+        if(ui32Idx == ui32IOAfter)
+        {
+            g_psBurstIO = TestFrame(100, 0x0800, 17, 2222, 0);
+            TestBurstSend(bScheduler, g_psBurstIO);
+        }
+        if(ui32Idx < ui32Bulk)
+        {
+            TestBurstSend(bScheduler,
+                          TestFrame(TEST_FRAME_SIZE, 0x0800, 6, 80, 0));
+        }
+    }
+
+    while(g_ui32RingCount)
+    {
+        TestBurstComplete(bScheduler);
+    }
+
+    return(g_ui32BurstDone - g_psBurstIO->ui32Sent);
+}
+
+//*****************************************************************************
+//
+// Run the harness.
+//
+//*****************************************************************************
+int
+main(void)
+{
+    tTestFrame *ppsFrames[8];
+    tEnetTxStats sStats;
+    uint32_t ui32Idx, ui32FIFO, ui32Prio, ui32Size, ui32Record, ui32Len;
+    bool bBalanced;
+    char pcBuf[512];
+
+    //
+    // Measure the old single FIFO first, with the driver straight on the
+    // interface.
+    //
+    g_sNetif.linkoutput = TestDriverOutput;
+    netif_default = &g_sNetif;
+    TestReset(TEST_FIFO_DESCRIPTORS);
+    ui32FIFO = TestBurst(false, 48, 30);
+
+    //
+    // Put the scheduler in front of the driver.
+    //
+    EnetTxInit();
+
+    //
+    // Fill the descriptors with web frames and queue one frame of each kind
+    // behind them.  They must come out I/O and ARP first, then explicit
+    // messages, then the web frames in the order they were sent.
+    //
+    TestReset(TEST_DESCRIPTORS);
+    for(ui32Idx = 0; ui32Idx < TEST_DESCRIPTORS; ui32Idx++)
+    {
+        TestSend(TestFrame(TEST_FRAME_SIZE, 0x0800, 6, 80, 0));
+    }
+    ppsFrames[0] = TestFrame(TEST_FRAME_SIZE, 0x0800, 6, 80, 0);
+    ppsFrames[1] = TestFrame(120, 0x0800, 6, 44818, 0x01);
+    ppsFrames[2] = TestFrame(100, 0x0800, 17, 2222, 0x02);
+    ppsFrames[3] = TestFrame(60, 0x0806, 0, 0, 0);
+    for(ui32Idx = 0; ui32Idx < 4; ui32Idx++)
+    {
+        HostCheck(TestSend(ppsFrames[ui32Idx]) == ERR_OK, "queued frame");
+    }
+    HostCheck(g_ui32OrderCount == TEST_DESCRIPTORS,
+              "frames wait while the descriptors are full");
+    while(g_ui32RingCount)
+    {
+        TestDriverComplete(true);
+    }
+    HostCheck(g_ui32OrderCount == (TEST_DESCRIPTORS + 4), "all frames sent");
+    HostCheck(g_ppsOrder[TEST_DESCRIPTORS] == ppsFrames[2],
+              "I/O frame sent first");
+    HostCheck(g_ppsOrder[TEST_DESCRIPTORS + 1] == ppsFrames[3],
+              "ARP frame sent with the I/O frames");
+    HostCheck(g_ppsOrder[TEST_DESCRIPTORS + 2] == ppsFrames[1],
+              "explicit frame sent before web frames");
+    HostCheck(g_ppsOrder[TEST_DESCRIPTORS + 3] == ppsFrames[0],
+              "web frame sent last");
+
+    //
+    // The EtherNet/IP frames carry the default DSCP values of the QoS
+    // object with their ECN bits kept, and the web frame is left alone.
+    //
+    HostCheck(TestDSCP(ppsFrames[2]) == 47, "I/O frame marked scheduled");
+    HostCheck((ppsFrames[2]->pui8Data[15] & 3) == 2, "I/O frame ECN kept");
+    HostCheck(TestDSCP(ppsFrames[1]) == 27, "explicit frame marked");
+    HostCheck((ppsFrames[1]->pui8Data[15] & 3) == 1, "explicit frame ECN");
+    HostCheck(ppsFrames[0]->pui8Data[15] == 0, "web frame not marked");
+
+    //
+    // New DSCP values apply to the frames sent after them, and values out of
+    // range are ignored.
+    //
+    EnetTxDSCPSet(ENET_TX_DSCP_SCHEDULED, 40);
+    EnetTxDSCPSet(ENET_TX_DSCP_EXPLICIT, 64);
+    TestReset(TEST_DESCRIPTORS);
+    ppsFrames[0] = TestFrame(100, 0x0800, 17, 2222, 0);
+    ppsFrames[1] = TestFrame(120, 0x0800, 6, 44818, 0);
+    TestSend(ppsFrames[0]);
+    TestSend(ppsFrames[1]);
+    HostCheck(TestDSCP(ppsFrames[0]) == 40, "new DSCP value used");
+    HostCheck(TestDSCP(ppsFrames[1]) == 27, "out of range DSCP ignored");
+    EnetTxDSCPSet(ENET_TX_DSCP_SCHEDULED, 47);
+    while(g_ui32RingCount)
+    {
+        TestDriverComplete(true);
+    }
+
+    //
+    // Once a queue is full, further frames of its class are dropped, and
+    // no references are left behind.
+    //
+    TestReset(TEST_DESCRIPTORS);
+    for(ui32Idx = 0; ui32Idx < TEST_DESCRIPTORS; ui32Idx++)
+    {
+        TestSend(TestFrame(64, 0x0800, 6, 80, 0));
+    }
+    for(ui32Idx = 0; ui32Idx < ENET_TX_QUEUE_LEN; ui32Idx++)
+    {
+        TestSend(TestFrame(64, 0x0800, 6, 80, 0));
+    }
+    EnetTxStatsGet(&sStats);
+    HostCheck(TestSend(TestFrame(64, 0x0800, 6, 80, 0)) == ERR_MEM,
+              "frame dropped when the queue is full");
+    ui32Idx = sStats.psClasses[ENET_TX_CLASS_BULK].ui32Dropped;
+    EnetTxStatsGet(&sStats);
+    HostCheck(sStats.psClasses[ENET_TX_CLASS_BULK].ui32Dropped == (ui32Idx + 1),
+              "dropped frame counted");
+    while(g_ui32RingCount)
+    {
+        TestDriverComplete(true);
+    }
+    bBalanced = true;
+    for(ui32Idx = 0; ui32Idx < g_ui32NextFrame; ui32Idx++)
+    {
+        bBalanced = bBalanced && (g_psFrames[ui32Idx].i32Refs == 0);
+    }
+    HostCheck(bBalanced, "every reference released");
+
+    //
+    // Repeat the burst with the scheduler.  The I/O frame only has to wait
+    // for the frames already in the descriptors rather than all of those
+    // sent before it.
+    //
+    TestReset(TEST_DESCRIPTORS);
+    ui32Prio = TestBurst(true, 48, 30);
+    HostCheck(ui32Prio < ui32FIFO, "I/O frame overtakes web traffic");
+    HostCheck(ui32Prio <= ((TEST_DESCRIPTORS * TEST_FRAME_SIZE + 100) *
+                           TEST_TENTHS_PER_BYTE) / 10,
+              "I/O frame waits for the descriptors at most");
+
+    printf("I/O frame sent after 30 of 48 full-size web frames:\n");
+    printf("  single FIFO, %u descriptors: %u cycles (%u us)\n",
+           TEST_FIFO_DESCRIPTORS, ui32FIFO, ui32FIFO / TEST_CLOCK_MHZ);
+    printf("  scheduler, %u descriptors:   %u cycles (%u us)\n",
+           TEST_DESCRIPTORS, ui32Prio, ui32Prio / TEST_CLOCK_MHZ);
+
+    //
+    // Print the counters as they are served from /tx.json.
+    //
+    for(ui32Record = 0; ; ui32Record++)
+    {
+        ui32Size = EnetTxJSONGenerate(pcBuf, sizeof(pcBuf), ui32Record);
+        if(ui32Size == 0)
+        {
+            break;
+        }
+        ui32Len = (ui32Size < sizeof(pcBuf)) ? ui32Size : sizeof(pcBuf) - 1;
+        fwrite(pcBuf, 1, ui32Len, stdout);
+    }
+
+    return(HostResult());
+}
@@ -0,0 +1,281 @@
+//*****************************************************************************
+//
+// fs_bench.c - Host benchmark of the file system index.
+//
+// enet_fs.c is run with an image of FS_FILES files generated by
+// tools/makefsdata.py.  The harness checks that fs_open() finds every file
+// in the image and no other, and then times opening each file through the
+// index.  For comparison, it also times finding each file by walking a list
+// of the names with a string compare, which is how the stock lwIP fs.c
+// finds a file.  The times are in nanoseconds of the host.  It also checks
+// that a request whose If-None-Match lists the ETag of a file is answered
+// with a 304 response, and any other with the file.
+//
+// Copyright (c) 2025 Texas Instruments Incorporated.
+//
+//*****************************************************************************
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "host.h"
+#include "profile.h"
+#include "httpserver_raw/fs.h"
+#include "fatfs/src/ff.h"
+#include "enet_fs.h"
+
+//*****************************************************************************
+//
+// The number of times each file is looked up, for each way of finding it.
+//
+//*****************************************************************************
+#define BENCH_ROUNDS            200
+
+//*****************************************************************************
+//
+// The image, read through the layout documented in tools/makefsdata.py: a
+// directory of four words, one displacement word per bucket and then one
+// index entry of five words per slot.
+//
+//*****************************************************************************
+extern const uint8_t g_sFSImage[];
+
+#define BENCH_IMAGE_WORD(ui32Offset)                                          \
+        (*(const uint32_t *)(g_sFSImage + (ui32Offset)))
+#define BENCH_INDEX_SIZE        BENCH_IMAGE_WORD(8)
+#define BENCH_NUM_BUCKETS       BENCH_IMAGE_WORD(12)
+#define BENCH_ENTRY_NAME(ui32Slot)                                            \
+        BENCH_IMAGE_WORD(16 + (BENCH_NUM_BUCKETS * 4) + ((ui32Slot) * 20))
+
+//*****************************************************************************
+//
+// The names of the files in the image, in the order of the index, as the
+// list that the linear search walks.
+//
+//*****************************************************************************
+static const char *g_ppcNames[FS_FILES];
+
+//*****************************************************************************
+//
+// The FatFs, SD card cache and event functions used by enet_fs.c.  Only the
+// image is read, so there is no card.
+//
+//*****************************************************************************
+FRESULT
+f_mount(BYTE ui8Drive, FATFS *psFatFs)
+{
+    return(FR_OK);
+}
+
+FRESULT
+f_open(FIL *psFile, const char *pcPath, BYTE ui8Mode)
+{
+    return(FR_NO_FILE);
+}
+
+FRESULT
+f_read(FIL *psFile, void *pvBuf, UINT ui32Count, UINT *pui32Read)
+{
+    *pui32Read = 0;
+    return(FR_OK);
+}
+
+FRESULT
+f_lseek(FIL *psFile, DWORD ui32Offset)
+{
+    return(FR_OK);
+}
+
+void
+disk_timerproc(void)
+{
+}
+
+void
+EventPost(uint32_t ui32Event)
+{
+}
+
+void
+SDCacheReadAhead(void)
+{
+}
+
+//*****************************************************************************
+//
+// The TCP segment that enet_fs.c sees as the one lwIP is handling, which is
+// the request that the file is opened for, or none if NULL.
+//
+//*****************************************************************************
+static const char *g_pcRequest;
+
+bool
+EnetRxTCPDataGet(const uint8_t **ppui8Data, uint32_t *pui32Len)
+{
+    if(g_pcRequest == NULL)
+    {
+        return(false);
+    }
+
+    *ppui8Data = (const uint8_t *)g_pcRequest;
+    *pui32Len = strlen(g_pcRequest);
+    return(true);
+}
+
+//*****************************************************************************
+//
+// Open a file for the given request and return the status line of the
+// response, up to the status code.
+//
+//*****************************************************************************
+static const char *
+BenchStatus(const char *pcName, const char *pcRequest)
+{
+    static char pcStatus[13];
+    struct fs_file *psFile;
+
+    g_pcRequest = pcRequest;
+    psFile = fs_open(pcName);
+    g_pcRequest = NULL;
+    if(psFile == NULL)
+    {
+        return("");
+    }
+
+    if(psFile->data != NULL)
+    {
+        memcpy(pcStatus, psFile->data, 12);
+    }
+    else if(fs_read(psFile, pcStatus, 12) != 12)
+    {
+        pcStatus[0] = '\0';
+    }
+    pcStatus[12] = '\0';
+    fs_close(psFile);
+
+    return(pcStatus);
+}
+
+//*****************************************************************************
+//
+// Find a file by walking the list of names.
+//
+//*****************************************************************************
+static const char *
+BenchLinearFind(const char *pcName, uint32_t ui32Files)
+{
+    uint32_t ui32File;
+
+    for(ui32File = 0; ui32File < ui32Files; ui32File++)
+    {
+        if(strcmp(pcName, g_ppcNames[ui32File]) == 0)
+        {
+            return(g_ppcNames[ui32File]);
+        }
+    }
+
+    return(NULL);
+}
+
+//*****************************************************************************
+//
+// Run the harness.
+//
+//*****************************************************************************
+int
+main(void)
+{
+    struct fs_file *psFile;
+    uint32_t ui32Slot, ui32Files, ui32Round, ui32Start;
+    uint64_t ui64Index, ui64Linear;
+    char pcRequest[256];
+    const char *pcTag;
+    bool bFound;
+
+    fs_init();
+
+    //
+    // Collect the names, and check that each opens as the file it names.
+    //
+    ui32Files = 0;
+    for(ui32Slot = 0; ui32Slot < BENCH_INDEX_SIZE; ui32Slot++)
+    {
+        if((BENCH_ENTRY_NAME(ui32Slot) != 0) && (ui32Files < FS_FILES))
+        {
+            g_ppcNames[ui32Files++] =
+                (const char *)(g_sFSImage + BENCH_ENTRY_NAME(ui32Slot));
+        }
+    }
+    HostCheck(ui32Files == FS_FILES, "every file is in the index");
+
+    bFound = true;
+    for(ui32Slot = 0; ui32Slot < ui32Files; ui32Slot++)
+    {
+        psFile = fs_open(g_ppcNames[ui32Slot]);
+        bFound = bFound && (psFile != NULL);
+        if(psFile)
+        {
+            fs_close(psFile);
+        }
+    }
+    HostCheck(bFound, "every file opens");
+    HostCheck(fs_open("/missing.htm") == NULL, "a missing file does not open");
+
+    //
+    // Ask for the first file with its own ETag, with another, and with "*"
+    // following the end of the header.
+    //
+    psFile = fs_open(g_ppcNames[0]);
+    pcTag = strstr(psFile->data, "ETag: ");
+    HostCheck((pcTag != NULL) && (pcTag < strstr(psFile->data, "\r\n\r\n")),
+              "a file carries an ETag");
+    snprintf(pcRequest, sizeof(pcRequest),
+             "GET %s HTTP/1.1\r\nHost: x\r\nif-none-match: \"0\", %.*s\r\n"
+             "\r\n", g_ppcNames[0], (int)strcspn(pcTag + 6, "\r"), pcTag + 6);
+    fs_close(psFile);
+    HostCheck(strcmp(BenchStatus(g_ppcNames[0], pcRequest),
+                     "HTTP/1.0 304") == 0,
+              "a request with the ETag is answered with 304");
+    HostCheck(strcmp(BenchStatus(g_ppcNames[0],
+                                 "GET / HTTP/1.1\r\nIf-None-Match: \"0\"\r\n"
+                                 "\r\n"), "HTTP/1.0 200") == 0,
+              "a request with another ETag is answered with the file");
+    HostCheck(strcmp(BenchStatus(g_ppcNames[0], "GET / HTTP/1.1\r\n\r\n"
+                                 "If-None-Match: *\r\n"),
+                     "HTTP/1.0 200") == 0,
+              "If-None-Match is only taken from the header");
+
+    //
+    // Time opening every file through the index, and finding every file by
+    // walking the names.
+    //
+    ui64Index = 0;
+    ui64Linear = 0;
+    for(ui32Round = 0; ui32Round < BENCH_ROUNDS; ui32Round++)
+    {
+        ui32Start = ProfileCountGet();
+        for(ui32Slot = 0; ui32Slot < ui32Files; ui32Slot++)
+        {
+            psFile = fs_open(g_ppcNames[ui32Slot]);
+            fs_close(psFile);
+        }
+        ui64Index += ProfileCountGet() - ui32Start;
+
+        ui32Start = ProfileCountGet();
+        for(ui32Slot = 0; ui32Slot < ui32Files; ui32Slot++)
+        {
+            bFound = ((BenchLinearFind(g_ppcNames[ui32Slot], ui32Files) !=
+                       NULL) && bFound);
+        }
+        ui64Linear += ProfileCountGet() - ui32Start;
+    }
+    HostCheck(bFound, "every file is found by name");
+
+    printf("%u files in %u slots, ns per lookup: index (fs_open) %u, "
+           "linear %u\n", ui32Files, BENCH_INDEX_SIZE,
+           (uint32_t)(ui64Index / ((uint64_t)BENCH_ROUNDS * ui32Files)),
+           (uint32_t)(ui64Linear / ((uint64_t)BENCH_ROUNDS * ui32Files)));
+
+    return(HostResult());
+}
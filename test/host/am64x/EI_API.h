@@ -0,0 +1,187 @@
+//*****************************************************************************
+//
+// EI_API.h - Host stand-in for the EtherNet/IP stack API of the AM64x SDK.
+//
+// Only the types, values and functions that the device profiles use are
+// declared, so that they can be built on the host.  The functions are
+// provided by am64x.c and do nothing but succeed.
+//
+// Copyright (c) 2025 Texas Instruments Incorporated.
+//
+//*****************************************************************************
+
+#ifndef EI_API_H
+#define EI_API_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef uint8_t ei_api_cip_edt_bool;
+typedef uint8_t ei_api_cip_edt_usint;
+typedef uint16_t ei_api_cip_edt_uint;
+typedef uint32_t ei_api_cip_edt_udint;
+
+typedef struct EI_API_ADP EI_API_ADP_T;
+typedef struct EI_API_CIP_NODE EI_API_CIP_NODE_T;
+
+typedef struct { uint32_t reserved; } EI_API_ADP_UIntfConf_t;
+typedef struct { uint32_t reserved; } EI_API_ADP_SMcastConfig_t;
+typedef struct { uint32_t reserved; } EI_API_ADP_SLldp_Parameter_t;
+typedef struct { uint32_t reserved; } EI_API_ADP_SEipStatus_t;
+typedef union { uint32_t reserved; } EI_API_ADP_UCmgrInfo_u;
+
+typedef struct
+{
+    bool Q_Tag_Enable;
+    uint8_t DSCP_PTP_Event;
+    uint8_t DSCP_PTP_General;
+    uint8_t DSCP_Urgent;
+    uint8_t DSCP_Scheduled;
+    uint8_t DSCP_High;
+    uint8_t DSCP_Low;
+    uint8_t DSCP_Explicit;
+} EI_API_ADP_SQos_t;
+
+typedef enum
+{
+    EI_API_ADP_eSTATUS_LED_GREEN_ON,
+    EI_API_ADP_eSTATUS_LED_RED_BLINK,
+    EI_API_ADP_eSTATUS_LED_RED_ON,
+} EI_API_ADP_EStatusLed_t;
+
+typedef struct
+{
+    EI_API_ADP_EStatusLed_t mod;
+    EI_API_ADP_EStatusLed_t net;
+} EI_API_ADP_SModNetStatus_t;
+
+typedef enum
+{
+    EI_API_CIP_eSC_GETATTRSINGLE = 0x0e,
+    EI_API_CIP_eSC_SETATTRSINGLE = 0x10,
+} EI_API_CIP_ESc_t;
+
+typedef enum
+{
+    EI_API_CIP_eEDT_BOOL,
+    EI_API_CIP_eEDT_USINT,
+    EI_API_CIP_eEDT_UINT,
+    EI_API_CIP_eEDT_UDINT,
+} EI_API_CIP_EEdt_t;
+
+typedef enum
+{
+    EI_API_CIP_eAR_GET,
+    EI_API_CIP_eAR_GET_AND_SET,
+} EI_API_CIP_EAr_t;
+
+typedef enum
+{
+    EI_API_CIP_eERR_OK,
+    EI_API_CIP_eERR_GENERAL,
+    EI_API_CIP_eERR_MEMALLOC,
+    EI_API_CIP_eERR_NODE_INVALID,
+    EI_API_CIP_eERR_CLASS_BLACKLIST,
+    EI_API_CIP_eERR_CLASS_DOES_NOT_EXIST,
+    EI_API_CIP_eERR_INSTANCE_DOES_NOT_EXIST,
+    EI_API_CIP_eERR_INSTANCE_UNKNOWN_STATE,
+    EI_API_CIP_eERR_ATTRIBUTE_ALREADY_EXIST,
+    EI_API_CIP_eERR_ATTRIBUTE_CDT_SIZE,
+    EI_API_CIP_eERR_ATTRIBUTE_DOES_NOT_EXIST,
+    EI_API_CIP_eERR_ATTRIBUTE_EDT_SIZE,
+    EI_API_CIP_eERR_ATTRIBUTE_INVALID,
+    EI_API_CIP_eERR_ATTRIBUTE_INVALID_TYPE,
+    EI_API_CIP_eERR_ATTRIBUTE_INVALID_VALUE,
+    EI_API_CIP_eERR_ATTRIBUTE_NOT_IMPLEMENTED,
+    EI_API_CIP_eERR_ATTRIBUTE_UNKNOWN_STATE,
+} EI_API_CIP_EError_t;
+
+typedef enum
+{
+    EI_API_eERR_CB_NO_ERROR,
+    EI_API_eERR_CB_INVALID_VALUE,
+    EI_API_eERR_CB_NOT_ENOUGH_DATA,
+    EI_API_eERR_CB_TOO_MUCH_DATA,
+    EI_API_eERR_CB_VAL_TOO_HIGH,
+    EI_API_eERR_CB_VAL_TOO_LOW,
+    EI_API_eERR_CB_CONFLICT_STATE,
+} EI_API_CIP_CB_ERR_CODE_t;
+
+typedef uint32_t (*EI_API_CIP_CBGetAttr)(EI_API_CIP_NODE_T *pCipNode,
+                                         uint16_t classId,
+                                         uint16_t instanceId,
+                                         uint16_t attrId, uint16_t *pLen,
+                                         void *pvValue);
+typedef uint32_t (*EI_API_CIP_CBSetAttr)(EI_API_CIP_NODE_T *pCipNode,
+                                         uint16_t classId,
+                                         uint16_t instanceId,
+                                         uint16_t attrId, uint16_t len,
+                                         void *pvValue);
+
+typedef struct
+{
+    EI_API_CIP_ESc_t code;
+    uint16_t getAttrAllResponseCnt;
+    void *callback;
+} EI_API_CIP_SService_t;
+
+typedef struct
+{
+    uint16_t id;
+    EI_API_CIP_EEdt_t edt;
+    uint16_t edtSize;
+    EI_API_CIP_EAr_t accessRule;
+    EI_API_CIP_CBGetAttr get_callback;
+    EI_API_CIP_CBSetAttr set_callback;
+    void *pvValue;
+} EI_API_CIP_SAttr_t;
+
+typedef struct
+{
+    uint16_t maxInstanceNum;
+} EI_API_CIP_NODE_InitParams_t;
+
+extern EI_API_CIP_NODE_T *EI_API_CIP_NODE_new(
+                                      EI_API_CIP_NODE_InitParams_t *pParams);
+extern uint32_t EI_API_CIP_createClass(EI_API_CIP_NODE_T *pCipNode,
+                                       uint16_t classId);
+extern uint32_t EI_API_CIP_createInstance(EI_API_CIP_NODE_T *pCipNode,
+                                          uint16_t classId,
+                                          uint16_t instanceId);
+extern uint32_t EI_API_CIP_addClassService(EI_API_CIP_NODE_T *pCipNode,
+                                           uint16_t classId,
+                                           EI_API_CIP_SService_t *pService);
+extern uint32_t EI_API_CIP_addInstanceService(EI_API_CIP_NODE_T *pCipNode,
+                                              uint16_t classId,
+                                              uint16_t instanceId,
+                                              EI_API_CIP_SService_t *pService);
+extern uint32_t EI_API_CIP_addClassAttr(EI_API_CIP_NODE_T *pCipNode,
+                                        uint16_t classId,
+                                        EI_API_CIP_SAttr_t *pAttr);
+extern uint32_t EI_API_CIP_setClassAttr(EI_API_CIP_NODE_T *pCipNode,
+                                        uint16_t classId,
+                                        EI_API_CIP_SAttr_t *pAttr);
+extern uint32_t EI_API_CIP_addInstanceAttr(EI_API_CIP_NODE_T *pCipNode,
+                                           uint16_t classId,
+                                           uint16_t instanceId,
+                                           EI_API_CIP_SAttr_t *pAttr);
+extern uint32_t EI_API_CIP_setInstanceAttr(EI_API_CIP_NODE_T *pCipNode,
+                                           uint16_t classId,
+                                           uint16_t instanceId,
+                                           EI_API_CIP_SAttr_t *pAttr);
+extern uint32_t EI_API_CIP_setInstanceAttrFunc(EI_API_CIP_NODE_T *pCipNode,
+                                               uint16_t classId,
+                                               uint16_t instanceId,
+                                               EI_API_CIP_SAttr_t *pAttr);
+extern uint32_t EI_API_CIP_getAttr_bool(EI_API_CIP_NODE_T *pCipNode,
+                                        uint16_t classId,
+                                        uint16_t instanceId,
+                                        uint16_t attrId,
+                                        ei_api_cip_edt_bool *pValue);
+extern uint32_t EI_API_CIP_setAttr_bool(EI_API_CIP_NODE_T *pCipNode,
+                                        uint16_t classId,
+                                        uint16_t instanceId,
+                                        uint16_t attrId,
+                                        ei_api_cip_edt_bool value);
+
+#endif // EI_API_H
@@ -0,0 +1,8 @@
+//*****************************************************************************
+//
+// EI_API_def.h - Empty host stand-in for an AM64x SDK header that the device
+// profiles include but need nothing from on the host.
+//
+// Copyright (c) 2025 Texas Instruments Incorporated.
+//
+//*****************************************************************************
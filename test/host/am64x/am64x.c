@@ -0,0 +1,183 @@
+//*****************************************************************************
+//
+// am64x.c - Host stand-ins for the OSAL and EtherNet/IP stack functions that
+//           the device profiles call.
+//
+// The CIP functions accept every class, instance and attribute.  The mutex
+// functions succeed unless g_bOsalMutexBusy is set, when a lock times out
+// the way it does on the target while another task holds the mutex.
+//
+// Copyright (c) 2025 Texas Instruments Incorporated.
+//
+//*****************************************************************************
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include "osal.h"
+#include "EI_API.h"
+
+//*****************************************************************************
+//
+// Whether locking a mutex fails, and the millisecond tick.
+//
+//*****************************************************************************
+bool g_bOsalMutexBusy;
+uint32_t g_ui32OsalMsTick;
+
+//*****************************************************************************
+//
+// The number of failed locks, counted so that a harness can check that a run
+// path never waits for a mutex.
+//
+//*****************************************************************************
+uint32_t g_ui32OsalLockFailures;
+
+//*****************************************************************************
+//
+// The OSAL stand-ins.
+//
+//*****************************************************************************
+void *
+OSAL_createNamedMutex(const char *pcName)
+{
+    static uint32_t ui32Mutex;
+
+    (void)pcName;
+    return(&ui32Mutex);
+}
+
+int32_t
+OSAL_lockNamedMutex(void *pvMutex, uint32_t ui32Timeout)
+{
+    (void)pvMutex;
+    (void)ui32Timeout;
+
+    if(g_bOsalMutexBusy)
+    {
+        g_ui32OsalLockFailures++;
+        return(OSAL_ERR_Timeout);
+    }
+    return(OSAL_ERR_NoError);
+}
+
+void
+OSAL_unLockNamedMutex(void *pvMutex)
+{
+    (void)pvMutex;
+}
+
+uint32_t
+OSAL_getMsTick(void)
+{
+    return(g_ui32OsalMsTick);
+}
+
+void
+OSAL_SCHED_sleep(uint32_t ui32Ms)
+{
+    g_ui32OsalMsTick += ui32Ms;
+}
+
+void
+OSAL_error(const char *pcFunc, uint32_t ui32Line, uint32_t ui32Error,
+           bool bFatal, uint32_t ui32Args, ...)
+{
+    (void)ui32Args;
+    printf("OSAL_error %u from %s:%u%s\n", ui32Error, pcFunc, ui32Line,
+           bFatal ? " (fatal)" : "");
+}
+
+//*****************************************************************************
+//
+// The EtherNet/IP stack stand-ins.
+//
+//*****************************************************************************
+EI_API_CIP_NODE_T *
+EI_API_CIP_NODE_new(EI_API_CIP_NODE_InitParams_t *pParams)
+{
+    static uint32_t ui32Node;
+
+    (void)pParams;
+    return((EI_API_CIP_NODE_T *)&ui32Node);
+}
+
+uint32_t
+EI_API_CIP_createClass(EI_API_CIP_NODE_T *pCipNode, uint16_t classId)
+{
+    return(EI_API_CIP_eERR_OK);
+}
+
+uint32_t
+EI_API_CIP_createInstance(EI_API_CIP_NODE_T *pCipNode, uint16_t classId,
+                          uint16_t instanceId)
+{
+    return(EI_API_CIP_eERR_OK);
+}
+
+uint32_t
+EI_API_CIP_addClassService(EI_API_CIP_NODE_T *pCipNode, uint16_t classId,
+                           EI_API_CIP_SService_t *pService)
+{
+    return(EI_API_CIP_eERR_OK);
+}
+
+uint32_t
+EI_API_CIP_addInstanceService(EI_API_CIP_NODE_T *pCipNode, uint16_t classId,
+                              uint16_t instanceId,
+                              EI_API_CIP_SService_t *pService)
+{
+    return(EI_API_CIP_eERR_OK);
+}
+
+uint32_t
+EI_API_CIP_addClassAttr(EI_API_CIP_NODE_T *pCipNode, uint16_t classId,
+                        EI_API_CIP_SAttr_t *pAttr)
+{
+    return(EI_API_CIP_eERR_OK);
+}
+
+uint32_t
+EI_API_CIP_setClassAttr(EI_API_CIP_NODE_T *pCipNode, uint16_t classId,
+                        EI_API_CIP_SAttr_t *pAttr)
+{
+    return(EI_API_CIP_eERR_OK);
+}
+
+uint32_t
+EI_API_CIP_addInstanceAttr(EI_API_CIP_NODE_T *pCipNode, uint16_t classId,
+                           uint16_t instanceId, EI_API_CIP_SAttr_t *pAttr)
+{
+    return(EI_API_CIP_eERR_OK);
+}
+
+uint32_t
+EI_API_CIP_setInstanceAttr(EI_API_CIP_NODE_T *pCipNode, uint16_t classId,
+                           uint16_t instanceId, EI_API_CIP_SAttr_t *pAttr)
+{
+    return(EI_API_CIP_eERR_OK);
+}
+
+uint32_t
+EI_API_CIP_setInstanceAttrFunc(EI_API_CIP_NODE_T *pCipNode, uint16_t classId,
+                               uint16_t instanceId, EI_API_CIP_SAttr_t *pAttr)
+{
+    return(EI_API_CIP_eERR_OK);
+}
+
+uint32_t
+EI_API_CIP_getAttr_bool(EI_API_CIP_NODE_T *pCipNode, uint16_t classId,
+                        uint16_t instanceId, uint16_t attrId,
+                        ei_api_cip_edt_bool *pValue)
+{
+    *pValue = 0;
+    return(EI_API_CIP_eERR_OK);
+}
+
+uint32_t
+EI_API_CIP_setAttr_bool(EI_API_CIP_NODE_T *pCipNode, uint16_t classId,
+                        uint16_t instanceId, uint16_t attrId,
+                        ei_api_cip_edt_bool value)
+{
+    return(EI_API_CIP_eERR_OK);
+}
@@ -0,0 +1,46 @@
+//*****************************************************************************
+//
+// cfg_example.h - Host stand-in for the example configuration of the AM64x
+//                 EtherNet/IP application.
+//
+// The number of discrete input and output point instances can be set on the
+// compiler command line, so that a harness can be built for several device
+// sizes.
+//
+// Copyright (c) 2025 Texas Instruments Incorporated.
+//
+//*****************************************************************************
+
+#ifndef CFG_EXAMPLE_H
+#define CFG_EXAMPLE_H
+
+#define CFG_PROFILE_DIO_DEVICE_VENDOR_ID                0x0186
+#define CFG_PROFILE_DIO_DEVICE_DEVICE_TYPE              0x0007
+#define CFG_PROFILE_DIO_DEVICE_PRODUCT_CODE             0x0001
+#define CFG_PROFILE_DIO_DEVICE_REVISION_MAJOR           1
+#define CFG_PROFILE_DIO_DEVICE_REVISION_MINOR           1
+#define CFG_PROFILE_DIO_DEVICE_SERIAL_NUMBER            0x00000001
+#define CFG_PROFILE_DIO_DEVICE_PRODUCT_NAME             "Host DIO"
+#define CFG_PROFILE_DIO_DEVICE_TIMESYNC_PRODUCT_DESCRIPTION_OF_CONFIGURATION \
+                                                        "Host"
+#define CFG_PROFILE_DIO_DEVICE_TIMESYNC_REVISION_DATA_OF_CONFIGURATION \
+                                                        "1"
+
+#define CFG_PROFILE_DIO_DEVICE_ASSEMBLY_PRODUCING       0x64
+#define CFG_PROFILE_DIO_DEVICE_ASSEMBLY_CONSUMING       0x65
+#define CFG_PROFILE_DIO_DEVICE_ASSEMBLY_CONFIGURATION   0x66
+
+#define CFG_PROFILE_DIO_DEVICE_DIP_CLASS_ID             0x08
+#define CFG_PROFILE_DIO_DEVICE_DOP_CLASS_ID             0x09
+#define CFG_PROFILE_DIO_DEVICE_DOG_CLASS_ID             0x1e
+#define CFG_PROFILE_DIO_DEVICE_DOP_REVISION_NUMBER      1
+#define CFG_PROFILE_DIO_DEVICE_DOG_REVISION_NUMBER      1
+
+#ifndef CFG_PROFILE_DIO_DEVICE_DIP_NUM_OF_INST
+#define CFG_PROFILE_DIO_DEVICE_DIP_NUM_OF_INST          8
+#endif
+#ifndef CFG_PROFILE_DIO_DEVICE_DOP_NUM_OF_INST
+#define CFG_PROFILE_DIO_DEVICE_DOP_NUM_OF_INST          8
+#endif
+
+#endif // CFG_EXAMPLE_H
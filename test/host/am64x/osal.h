@@ -0,0 +1,48 @@
+//*****************************************************************************
+//
+// osal.h - Host stand-in for the OS abstraction layer of the AM64x SDK.
+//
+// Mutexes are never contended on the host, so locking always succeeds
+// unless a harness sets g_bOsalMutexBusy to stand for another task holding
+// the lock.  The functions are provided by am64x.c.
+//
+// Copyright (c) 2025 Texas Instruments Incorporated.
+//
+//*****************************************************************************
+
+#ifndef OSAL_H
+#define OSAL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define OSAL_ERR_NoError        0
+#define OSAL_ERR_Timeout        1
+#define OSAL_STACK_INIT_ERROR   1
+
+#define OSAL_printf             printf
+#define OSAL_MEMORY_memset      memset
+#define OSAL_MEMORY_memcpy      memcpy
+#define OSAL_MEMORY_memcmp      memcmp
+#define OSAL_MEMORY_calloc      calloc
+#define OSAL_MEMORY_free        free
+
+#define OSALUNREF_PARM(x)       ((void)(x))
+
+extern bool g_bOsalMutexBusy;
+extern uint32_t g_ui32OsalMsTick;
+extern uint32_t g_ui32OsalLockFailures;
+
+extern void *OSAL_createNamedMutex(const char *pcName);
+extern int32_t OSAL_lockNamedMutex(void *pvMutex, uint32_t ui32Timeout);
+extern void OSAL_unLockNamedMutex(void *pvMutex);
+extern uint32_t OSAL_getMsTick(void);
+extern void OSAL_SCHED_sleep(uint32_t ui32Ms);
+extern void OSAL_error(const char *pcFunc, uint32_t ui32Line,
+                       uint32_t ui32Error, bool bFatal, uint32_t ui32Args,
+                       ...);
+
+#endif // OSAL_H
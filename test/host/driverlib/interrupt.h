@@ -0,0 +1,12 @@
+//*****************************************************************************
+//
+// interrupt.h - Host stand-in for the TivaWare interrupt controller API.
+//
+// Copyright (c) 2025 Texas Instruments Incorporated.
+//
+//*****************************************************************************
+
+#ifndef __INTERRUPT_H__
+#define __INTERRUPT_H__
+
+#endif // __INTERRUPT_H__
@@ -0,0 +1,18 @@
+//*****************************************************************************
+//
+// rom_map.h - Host stand-in for the TivaWare ROM mapping macros.
+//
+// Copyright (c) 2025 Texas Instruments Incorporated.
+//
+//*****************************************************************************
+
+#ifndef __ROM_MAP_H__
+#define __ROM_MAP_H__
+
+//
+// There is no interrupt to mask on the host.
+//
+#define MAP_IntDisable(ui32Interrupt)
+#define MAP_IntEnable(ui32Interrupt)
+
+#endif // __ROM_MAP_H__
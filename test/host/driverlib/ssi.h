@@ -0,0 +1,12 @@
+//*****************************************************************************
+//
+// ssi.h - Host stand-in for the TivaWare SSI API.
+//
+// Copyright (c) 2025 Texas Instruments Incorporated.
+//
+//*****************************************************************************
+
+#ifndef __SSI_H__
+#define __SSI_H__
+
+#endif // __SSI_H__
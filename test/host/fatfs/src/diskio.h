@@ -0,0 +1,14 @@
+//*****************************************************************************
+//
+// diskio.h - Host stand-in for the FatFs disk interface.
+//
+// Copyright (c) 2025 Texas Instruments Incorporated.
+//
+//*****************************************************************************
+
+#ifndef __DISKIO_H__
+#define __DISKIO_H__
+
+extern void disk_timerproc(void);
+
+#endif // __DISKIO_H__
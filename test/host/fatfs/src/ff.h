@@ -0,0 +1,50 @@
+//*****************************************************************************
+//
+// ff.h - Host stand-in for the FatFs API.
+//
+// Copyright (c) 2025 Texas Instruments Incorporated.
+//
+//*****************************************************************************
+
+#ifndef __FF_H__
+#define __FF_H__
+
+//
+// The FatFs functions are provided by each harness that needs them.
+//
+#include <stdint.h>
+
+typedef uint8_t BYTE;
+typedef uint32_t UINT;
+typedef uint32_t DWORD;
+
+typedef enum
+{
+    FR_OK = 0,
+    FR_NO_FILE = 4
+}
+FRESULT;
+
+#define FA_READ                 0x01
+
+typedef struct
+{
+    int iUnused;
+}
+FATFS;
+
+typedef struct
+{
+    DWORD fsize;
+}
+FIL;
+
+#define f_size(psFile)          ((psFile)->fsize)
+
+extern FRESULT f_mount(BYTE ui8Drive, FATFS *psFatFs);
+extern FRESULT f_open(FIL *psFile, const char *pcPath, BYTE ui8Mode);
+extern FRESULT f_read(FIL *psFile, void *pvBuf, UINT ui32Count,
+                      UINT *pui32Read);
+extern FRESULT f_lseek(FIL *psFile, DWORD ui32Offset);
+
+#endif // __FF_H__
@@ -0,0 +1,114 @@
+//*****************************************************************************
+//
+// host.c - Support for building the application modules on the host.
+//
+// Copyright (c) 2025 Texas Instruments Incorporated.
+//
+//*****************************************************************************
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "host.h"
+
+//*****************************************************************************
+//
+// The most distinct register addresses that can be used.
+//
+//*****************************************************************************
+#define HOST_NUM_REGISTERS      32
+
+//*****************************************************************************
+//
+// The value read from the DWT cycle counter.
+//
+//*****************************************************************************
+uint32_t g_ui32HostCycles;
+
+//*****************************************************************************
+//
+// The addresses of the registers used so far and their values.
+//
+//*****************************************************************************
+static uint32_t g_pui32HostAddrs[HOST_NUM_REGISTERS];
+static volatile uint32_t g_pui32HostValues[HOST_NUM_REGISTERS];
+static uint32_t g_ui32HostNumRegisters;
+
+//*****************************************************************************
+//
+// The number of checks made and of those that failed.
+//
+//*****************************************************************************
+static uint32_t g_ui32HostChecks;
+static uint32_t g_ui32HostFailures;
+
+//*****************************************************************************
+//
+// Return the storage for a register.  The DWT cycle counter reads as
+// g_ui32HostCycles; every other register reads back what was last written
+// to it, and zero before that.
+//
+//*****************************************************************************
+volatile uint32_t *
+HostRegister(uint32_t ui32Addr)
+{
+    uint32_t ui32Idx;
+
+    if(ui32Addr == HOST_DWT_CYCCNT)
+    {
+        return(&g_ui32HostCycles);
+    }
+
+    for(ui32Idx = 0; ui32Idx < g_ui32HostNumRegisters; ui32Idx++)
+    {
+        if(g_pui32HostAddrs[ui32Idx] == ui32Addr)
+        {
+            return(&g_pui32HostValues[ui32Idx]);
+        }
+    }
+
+    if(g_ui32HostNumRegisters == HOST_NUM_REGISTERS)
+    {
+        fprintf(stderr, "too many registers used\n");
+        exit(1);
+    }
+
+    g_pui32HostAddrs[ui32Idx] = ui32Addr;
+    g_ui32HostNumRegisters++;
+    return(&g_pui32HostValues[ui32Idx]);
+}
+
+//*****************************************************************************
+//
+// Count a check made by a harness, and report it if it failed.  Returns
+// bPass.
+//
+//*****************************************************************************
+bool
+HostCheck(bool bPass, const char *pcWhat)
+{
+    g_ui32HostChecks++;
+    if(!bPass)
+    {
+        g_ui32HostFailures++;
+        printf("FAIL: %s\n", pcWhat);
+    }
+
+    return(bPass);
+}
+
+//*****************************************************************************
+//
+// Report the number of checks that failed, and return the exit status for
+// the harness.
+//
+//*****************************************************************************
+int
+HostResult(void)
+{
+    printf("%u of %u checks passed\n", g_ui32HostChecks - g_ui32HostFailures,
+           g_ui32HostChecks);
+
+    return(g_ui32HostFailures ? 1 : 0);
+}
@@ -0,0 +1,35 @@
+//*****************************************************************************
+//
+// host.h - Support for building the application modules on the host.
+//
+// Copyright (c) 2025 Texas Instruments Incorporated.
+//
+//*****************************************************************************
+
+#ifndef __HOST_H__
+#define __HOST_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+//*****************************************************************************
+//
+// The address of the Cortex-M4 DWT cycle counter.  Reads of it through
+// HWREG() return g_ui32HostCycles, which a harness advances to stand for the
+// time that passes on the target.
+//
+//*****************************************************************************
+#define HOST_DWT_CYCCNT         0xE0001004
+
+extern uint32_t g_ui32HostCycles;
+
+//*****************************************************************************
+//
+// Prototypes.
+//
+//*****************************************************************************
+extern volatile uint32_t *HostRegister(uint32_t ui32Addr);
+extern bool HostCheck(bool bPass, const char *pcWhat);
+extern int HostResult(void);
+
+#endif // __HOST_H__
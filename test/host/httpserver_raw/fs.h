@@ -0,0 +1,32 @@
+//*****************************************************************************
+//
+// fs.h - Host stand-in for the lwIP httpd file system API.
+//
+// Copyright (c) 2025 Texas Instruments Incorporated.
+//
+//*****************************************************************************
+
+#ifndef __FS_H__
+#define __FS_H__
+
+#include <stdint.h>
+
+#define LWIP_HTTPD_FS_ASYNC_READ 0
+
+struct fs_file
+{
+    const char *data;
+    int len;
+    int index;
+    void *pextension;
+    uint8_t http_header_included;
+};
+
+typedef void (*fs_wait_cb)(void *pvArg);
+
+extern struct fs_file *fs_open(const char *pcName);
+extern void fs_close(struct fs_file *psFile);
+extern int fs_read(struct fs_file *psFile, char *pcBuffer, int iCount);
+extern int fs_bytes_left(struct fs_file *psFile);
+
+#endif // __FS_H__
@@ -0,0 +1,12 @@
+//*****************************************************************************
+//
+// httpd.h - Host stand-in for the lwIP httpd header.
+//
+// Copyright (c) 2025 Texas Instruments Incorporated.
+//
+//*****************************************************************************
+
+#ifndef __HTTPD_H__
+#define __HTTPD_H__
+
+#endif // __HTTPD_H__
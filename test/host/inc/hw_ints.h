@@ -0,0 +1,14 @@
+//*****************************************************************************
+//
+// hw_ints.h - Host stand-in for the TivaWare interrupt numbers.
+//
+// Copyright (c) 2025 Texas Instruments Incorporated.
+//
+//*****************************************************************************
+
+#ifndef __HW_INTS_H__
+#define __HW_INTS_H__
+
+#define INT_EMAC0               56
+
+#endif // __HW_INTS_H__
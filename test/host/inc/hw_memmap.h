@@ -0,0 +1,12 @@
+//*****************************************************************************
+//
+// hw_memmap.h - Host stand-in for the TivaWare memory map.
+//
+// Copyright (c) 2025 Texas Instruments Incorporated.
+//
+//*****************************************************************************
+
+#ifndef __HW_MEMMAP_H__
+#define __HW_MEMMAP_H__
+
+#endif // __HW_MEMMAP_H__
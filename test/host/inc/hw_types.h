@@ -0,0 +1,19 @@
+//*****************************************************************************
+//
+// hw_types.h - Host stand-in for the TivaWare register access macros.
+//
+// Registers are read and written through HostRegister() in host.c, which
+// keeps a value for each address that is used.
+//
+// Copyright (c) 2025 Texas Instruments Incorporated.
+//
+//*****************************************************************************
+
+#ifndef __HW_TYPES_H__
+#define __HW_TYPES_H__
+
+#include "host.h"
+
+#define HWREG(x)                (*HostRegister((uint32_t)(x)))
+
+#endif // __HW_TYPES_H__
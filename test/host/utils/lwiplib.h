@@ -0,0 +1,51 @@
+//*****************************************************************************
+//
+// lwiplib.h - Host stand-in for the lwIP types used by the modules tested.
+//
+// Only the parts of struct pbuf and struct netif that the modules use are
+// declared.  pbuf_ref() and pbuf_free() are provided by each harness, so
+// that it can track the references to its frames.
+//
+// Copyright (c) 2025 Texas Instruments Incorporated.
+//
+//*****************************************************************************
+
+#ifndef __LWIPLIB_H__
+#define __LWIPLIB_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef uint8_t u8_t;
+typedef uint16_t u16_t;
+typedef uint32_t u32_t;
+typedef int8_t err_t;
+
+#define ERR_OK                  0
+#define ERR_MEM                 -1
+
+#define ETH_PAD_SIZE            0
+
+struct pbuf
+{
+    struct pbuf *next;
+    void *payload;
+    u16_t tot_len;
+    u16_t len;
+};
+
+struct netif;
+typedef err_t (*netif_linkoutput_fn)(struct netif *psNetif,
+                                     struct pbuf *psFrame);
+
+struct netif
+{
+    netif_linkoutput_fn linkoutput;
+};
+
+extern struct netif *netif_default;
+
+extern void pbuf_ref(struct pbuf *psFrame);
+extern u8_t pbuf_free(struct pbuf *psFrame);
+
+#endif // __LWIPLIB_H__
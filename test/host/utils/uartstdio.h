@@ -0,0 +1,16 @@
+//*****************************************************************************
+//
+// uartstdio.h - Host stand-in for the TivaWare UART console.
+//
+// Copyright (c) 2025 Texas Instruments Incorporated.
+//
+//*****************************************************************************
+
+#ifndef __UARTSTDIO_H__
+#define __UARTSTDIO_H__
+
+#include <stdio.h>
+
+#define UARTprintf              printf
+
+#endif // __UARTSTDIO_H__
@@ -0,0 +1,29 @@
+//*****************************************************************************
+//
+// ustdlib.h - Host stand-in for the TivaWare string utilities.
+//
+// Copyright (c) 2025 Texas Instruments Incorporated.
+//
+//*****************************************************************************
+
+#ifndef __USTDLIB_H__
+#define __USTDLIB_H__
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+#define usnprintf               snprintf
+#define usprintf                sprintf
+#define ustrncmp                strncmp
+#define ustrcmp                 strcmp
+#define ustrlen                 strlen
+#define ustrncpy                strncpy
+#define ustrstr                 strstr
+#define ustrcasecmp             strcasecmp
+#define ustrncasecmp            strncasecmp
+#define ustrtoul(pcStr, ppcEnd, iBase)                                        \
+        strtoul((pcStr), (char **)(ppcEnd), (iBase))
+
+#endif // __USTDLIB_H__
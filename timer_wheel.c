@@ -0,0 +1,269 @@
+//*****************************************************************************
+//
+// timer_wheel.c - Hierarchical timing wheel for software timers.
+//
+// Each timer is kept in the slot of the wheel level that matches how far
+// away it is due, so adding, removing and expiring a timer take the same
+// time however many timers are running.  The first level is indexed by the
+// low bits of the tick a timer is due on.  When the first level wraps around,
+// the next slot of the level above is emptied and its timers are spread over
+// the levels below, each a closer step to the first level.  A timer moves
+// down at most once per level.
+//
+// The SysTick interrupt counts ticks with TimerWheelTick(), and the main
+// loop catches the wheel up with TimerWheelProcess(), which is where timer
+// callbacks run.  The other functions must also only be called from the main
+// loop.
+//
+// Copyright (c) 2025 Texas Instruments Incorporated.
+//
+//*****************************************************************************
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "timer_wheel.h"
+
+//*****************************************************************************
+//
+// The slots of each level of the wheel, each the head of a list of timers.
+//
+//*****************************************************************************
+static tTimer *g_ppsTimerWheel[TIMER_WHEEL_LEVELS][TIMER_WHEEL_SLOTS];
+
+//*****************************************************************************
+//
+// The number of ticks counted by the SysTick interrupt, and the number that
+// the wheel has been advanced through.  The wheel time is behind the tick
+// count only until the main loop next runs TimerWheelProcess().
+//
+//*****************************************************************************
+static volatile uint32_t g_ui32TimerWheelTicks;
+static uint32_t g_ui32TimerWheelTime;
+
+//*****************************************************************************
+//
+// Put a timer in the slot for the tick it is due on.
+//
+//*****************************************************************************
+static void
+TimerWheelInsert(tTimer *psTimer)
+{
+    uint32_t ui32Delta, ui32Level, ui32Shift;
+    tTimer **ppsSlot;
+
+    //
+    // Find the lowest level whose span reaches the timer.
+    //
+    ui32Delta = psTimer->ui32Expires - g_ui32TimerWheelTime;
+    for(ui32Level = 0, ui32Shift = 0; ui32Level < (TIMER_WHEEL_LEVELS - 1);
+        ui32Level++, ui32Shift += TIMER_WHEEL_BITS)
+    {
+        if(ui32Delta < (1 << (ui32Shift + TIMER_WHEEL_BITS)))
+        {
+            break;
+        }
+    }
+
+    ppsSlot = &g_ppsTimerWheel[ui32Level][(psTimer->ui32Expires >> ui32Shift) &
+                                          (TIMER_WHEEL_SLOTS - 1)];
+
+    psTimer->psNext = *ppsSlot;
+    if(psTimer->psNext)
+    {
+        psTimer->psNext->ppsPrev = &psTimer->psNext;
+    }
+    psTimer->ppsPrev = ppsSlot;
+    *ppsSlot = psTimer;
+}
+
+//*****************************************************************************
+//
+// Take a timer out of the list it is in.
+//
+//*****************************************************************************
+static void
+TimerWheelUnlink(tTimer *psTimer)
+{
+    *psTimer->ppsPrev = psTimer->psNext;
+    if(psTimer->psNext)
+    {
+        psTimer->psNext->ppsPrev = psTimer->ppsPrev;
+    }
+    psTimer->ppsPrev = NULL;
+}
+
+//*****************************************************************************
+//
+// Detach the list of timers in a slot.  The first timer is pointed back at
+// the given head, so that timers can still be removed from the list while
+// it is being worked through.
+//
+//*****************************************************************************
+static void
+TimerWheelDetach(tTimer **ppsSlot, tTimer **ppsHead)
+{
+    *ppsHead = *ppsSlot;
+    *ppsSlot = NULL;
+    if(*ppsHead)
+    {
+        (*ppsHead)->ppsPrev = ppsHead;
+    }
+}
+
+//*****************************************************************************
+//
+// Advance the wheel by one tick, moving timers down from the levels above if
+// the first level has wrapped around and then running the timers that are
+// due.
+//
+//*****************************************************************************
+static void
+TimerWheelStep(void)
+{
+    tTimer *psList, *psTimer;
+    uint32_t ui32Level, ui32Shift, ui32Slot;
+
+    g_ui32TimerWheelTime++;
+
+    for(ui32Level = 1, ui32Shift = TIMER_WHEEL_BITS;
+        ui32Level < TIMER_WHEEL_LEVELS;
+        ui32Level++, ui32Shift += TIMER_WHEEL_BITS)
+    {
+        //
+        // Stop unless the level below has just wrapped around.
+        //
+        if(g_ui32TimerWheelTime & ((1 << ui32Shift) - 1))
+        {
+            break;
+        }
+
+        ui32Slot = (g_ui32TimerWheelTime >> ui32Shift) &
+                   (TIMER_WHEEL_SLOTS - 1);
+        TimerWheelDetach(&g_ppsTimerWheel[ui32Level][ui32Slot], &psList);
+        while(psList)
+        {
+            psTimer = psList;
+            TimerWheelUnlink(psTimer);
+            TimerWheelInsert(psTimer);
+        }
+    }
+
+    //
+    // Run the timers that are due.  A periodic timer is added back before
+    // its callback runs, so that the callback can remove it.
+    //
+    ui32Slot = g_ui32TimerWheelTime & (TIMER_WHEEL_SLOTS - 1);
+    TimerWheelDetach(&g_ppsTimerWheel[0][ui32Slot], &psList);
+    while(psList)
+    {
+        psTimer = psList;
+        TimerWheelUnlink(psTimer);
+        if(psTimer->ui32Period)
+        {
+            psTimer->ui32Expires += psTimer->ui32Period;
+            TimerWheelInsert(psTimer);
+        }
+        psTimer->pfnCallback(psTimer->pvArg);
+    }
+}
+
+//*****************************************************************************
+//
+// Start a timer, which calls pfnCallback with pvArg after ui32Delay ticks
+// and then, if ui32Period is not zero, every ui32Period ticks until it is
+// removed.  A timer that is already running is restarted.
+//
+//*****************************************************************************
+void
+TimerWheelAdd(tTimer *psTimer, uint32_t ui32Delay, uint32_t ui32Period,
+              tTimerCallback pfnCallback, void *pvArg)
+{
+    if(psTimer->ppsPrev)
+    {
+        TimerWheelUnlink(psTimer);
+    }
+
+    if(ui32Delay == 0)
+    {
+        ui32Delay = 1;
+    }
+    if(ui32Delay > TIMER_WHEEL_MAX_DELAY)
+    {
+        ui32Delay = TIMER_WHEEL_MAX_DELAY;
+    }
+    if(ui32Period > TIMER_WHEEL_MAX_DELAY)
+    {
+        ui32Period = TIMER_WHEEL_MAX_DELAY;
+    }
+
+    psTimer->ui32Expires = g_ui32TimerWheelTime + ui32Delay;
+    psTimer->ui32Period = ui32Period;
+    psTimer->pfnCallback = pfnCallback;
+    psTimer->pvArg = pvArg;
+
+    TimerWheelInsert(psTimer);
+}
+
+//*****************************************************************************
+//
+// Stop a timer.  Nothing is done if it is not running.
+//
+//*****************************************************************************
+void
+TimerWheelRemove(tTimer *psTimer)
+{
+    if(psTimer->ppsPrev)
+    {
+        TimerWheelUnlink(psTimer);
+    }
+}
+
+//*****************************************************************************
+//
+// Return true if a timer is running.
+//
+//*****************************************************************************
+bool
+TimerWheelIsActive(tTimer *psTimer)
+{
+    return(psTimer->ppsPrev != NULL);
+}
+
+//*****************************************************************************
+//
+// Return the wheel time, in ticks.
+//
+//*****************************************************************************
+uint32_t
+TimerWheelNow(void)
+{
+    return(g_ui32TimerWheelTime);
+}
+
+//*****************************************************************************
+//
+// Count a tick.  This must be called from the SysTick interrupt handler.
+//
+//*****************************************************************************
+void
+TimerWheelTick(void)
+{
+    g_ui32TimerWheelTicks++;
+}
+
+//*****************************************************************************
+//
+// Advance the wheel through the ticks counted since it was last called,
+// running the callbacks of the timers that became due.  This must be called
+// from the main loop.
+//
+//*****************************************************************************
+void
+TimerWheelProcess(void)
+{
+    while(g_ui32TimerWheelTime != g_ui32TimerWheelTicks)
+    {
+        TimerWheelStep();
+    }
+}
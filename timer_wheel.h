@@ -0,0 +1,87 @@
+//*****************************************************************************
+//
+// timer_wheel.h - Hierarchical timing wheel for software timers.
+//
+// Copyright (c) 2025 Texas Instruments Incorporated.
+//
+//*****************************************************************************
+
+#ifndef __TIMER_WHEEL_H__
+#define __TIMER_WHEEL_H__
+
+//*****************************************************************************
+//
+// If building with a C++ compiler, make all of the definitions in this header
+// have a C binding.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+//*****************************************************************************
+//
+// The wheel has TIMER_WHEEL_LEVELS levels of 2^TIMER_WHEEL_BITS slots each.
+// The first level holds timers due in the next 2^TIMER_WHEEL_BITS ticks, and
+// each level above covers 2^TIMER_WHEEL_BITS times the span of the one below.
+// Timers are limited to TIMER_WHEEL_MAX_DELAY ticks, about 4.6 hours at a
+// 1 ms tick; longer delays are shortened to it.
+//
+//*****************************************************************************
+#define TIMER_WHEEL_BITS        6
+#define TIMER_WHEEL_SLOTS       (1 << TIMER_WHEEL_BITS)
+#define TIMER_WHEEL_LEVELS      4
+#define TIMER_WHEEL_MAX_DELAY   ((1 << (TIMER_WHEEL_BITS *                   \
+                                        TIMER_WHEEL_LEVELS)) - 1)
+
+//*****************************************************************************
+//
+// The prototype for a timer callback.
+//
+//*****************************************************************************
+typedef void (*tTimerCallback)(void *pvArg);
+
+//*****************************************************************************
+//
+// A software timer.  The storage belongs to the caller and must stay valid
+// while the timer is running; none of the fields should be accessed
+// directly.  A timer that is not running has ppsPrev set to NULL, which is
+// how a zero-initialized timer starts out.
+//
+//*****************************************************************************
+typedef struct tTimer
+{
+    struct tTimer *psNext;
+    struct tTimer **ppsPrev;
+    uint32_t ui32Expires;
+    uint32_t ui32Period;
+    tTimerCallback pfnCallback;
+    void *pvArg;
+}
+tTimer;
+
+//*****************************************************************************
+//
+// Prototypes.
+//
+//*****************************************************************************
+extern void TimerWheelAdd(tTimer *psTimer, uint32_t ui32Delay,
+                          uint32_t ui32Period, tTimerCallback pfnCallback,
+                          void *pvArg);
+extern void TimerWheelRemove(tTimer *psTimer);
+extern bool TimerWheelIsActive(tTimer *psTimer);
+extern uint32_t TimerWheelNow(void);
+extern void TimerWheelTick(void);
+extern void TimerWheelProcess(void);
+
+//*****************************************************************************
+//
+// Mark the end of the C bindings section for C++ compilers.
+//
+//*****************************************************************************
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __TIMER_WHEEL_H__
@@ -0,0 +1,563 @@
+#!/usr/bin/env python3
+#*****************************************************************************
+#
+# makefsdata.py - Generate the file system image for enet_fs.c.
+#
+# This utility packs the contents of a directory tree into a binary image
+# that is linked in as it is, as the read-only file system of enet_fs.c.
+# Every file is stored as a complete HTTP response, with a generated header
+# carrying the exact Content-Length, a strong ETag computed from the file
+# contents and, if one is configured for the file, a Cache-Control
+# directive.  enet_fs.c answers a request whose If-None-Match lists the ETag
+# with a 304 response carrying no body.
+#
+# With -z, the image also carries a gzip-compressed copy of each
+# compressible file with its own header that includes "Content-Encoding:
+# gzip".  The bytes saved by each copy are reported when the image is
+# generated.  The copies are only served when enet_fs.c is built with
+# ENET_FS_GZIP set to 1.
+#
+# Optionally, stylesheets and scripts up to a given size are inlined into the
+# HTML pages that reference them, so that a browser can load a page over
+# fewer connections.  The httpd in this release of lwIP closes the
+# connection after every response, so each asset that is not inlined costs a
+# TCP connection of its own.  Images are not inlined: they are given long
+# cache lifetimes, which an image inlined into a page would lose, and as a
+# data: URI would take a third more room in the image than the file that
+# stays in it.
+#
+# The image starts with a directory holding a collision-free hash table over
+# the full path of every file.  fs_open() uses this table to find a file with
+# a single hash computation and one string compare.  The path hash picks a
+# bucket, and the displacement stored for that bucket is mixed into the hash
+# to pick the slot; the displacements are chosen so that no two paths share
+# a slot.  All values in the image are little-endian 32-bit words:
+#
+#     magic ("EFS2"), number of files, index size, number of buckets
+#     displacements: one per bucket
+#     index: one entry per slot of (name offset, data offset, data length,
+#            gzip offset, gzip length), all zero for an empty slot
+#     names: NUL-terminated paths
+#     data: the responses, each starting on a word boundary
+#
+# Offsets are from the start of the image.  The layout must be kept in step
+# with tFSImage in enet_fs.c.
+#
+# The image is written as it is to a .bin file, which enet_fsdata_gcc.S and
+# enet_fsdata_rvmdk.S link in with an incbin directive.  If the output file
+# name ends in .c, the image is written instead as a C source file that
+# defines g_sFSImage as an array of words, for the IAR and CCS projects.
+#
+# Usage:
+#
+#     python3 tools/makefsdata.py -i fs -o enet_fsdata.bin
+#             [-c PATTERN=DIRECTIVE ...] [-l LIMIT] [-z] [-q]
+#
+# Each -c option gives the Cache-Control directive for the files whose path
+# matches a shell-style pattern, for example -c "*.jpg=max-age=86400".  The
+# first matching pattern wins; files that match none get no Cache-Control.
+#
+# The -l option inlines every stylesheet and script of up to LIMIT bytes.
+# Inlined assets stay in the image as files of their own.
+#
+# The hash functions must be kept in step with FSIndexHash() and
+# FSIndexSlot() in enet_fs.c.
+#
+#*****************************************************************************
+
+import argparse
+import fnmatch
+import gzip
+import hashlib
+import os
+import posixpath
+import re
+import struct
+import sys
+
+#
+# 32-bit FNV-1a parameters.
+#
+FNV_PRIME = 16777619
+FNV_MASK = 0xffffffff
+FNV_BASIS = 0x811c9dc5
+
+#
+# The maximum number of displacements to try for a bucket before growing the
+# table.
+#
+MAX_DISPLACE_TRIES = 100000
+
+#
+# The identifier at the start of the image.
+#
+IMAGE_MAGIC = b'EFS2'
+
+#
+# The alignment of each response in the image, in bytes.
+#
+IMAGE_ALIGN = 4
+
+#
+# The number of hex digits of the SHA-256 content hash used in an ETag.
+#
+ETAG_DIGITS = 16
+
+#
+# The content type sent for each file extension.  This follows the table
+# httpd uses when it generates headers itself.
+#
+CONTENT_TYPES = {
+    '.htm':  'text/html',
+    '.html': 'text/html',
+    '.shtm': 'text/html',
+    '.shtml': 'text/html',
+    '.ssi':  'text/html',
+    '.css':  'text/css',
+    '.js':   'application/x-javascript',
+    '.txt':  'text/plain',
+    '.xml':  'text/xml',
+    '.ico':  'image/x-icon',
+    '.gif':  'image/gif',
+    '.png':  'image/png',
+    '.jpg':  'image/jpeg',
+    '.bmp':  'image/bmp',
+}
+
+#
+# The file extensions that httpd scans for SSI tags.  The length of these
+# files changes as they are sent, so they get no Content-Length.
+#
+SSI_EXTENSIONS = ('.shtm', '.shtml', '.ssi')
+
+#
+# The file extensions that are worth storing a gzip-compressed copy of.
+# Image formats other than .ico are already compressed.  SSI files are left
+# alone since httpd must be able to scan them for tags.
+#
+GZIP_EXTENSIONS = ('.htm', '.html', '.css', '.js', '.txt', '.xml', '.ico')
+
+#
+# The file extensions of the pages that assets are inlined into.
+#
+HTML_EXTENSIONS = ('.htm', '.html')
+
+#
+# The tags that reference assets that can be inlined.  Stylesheet links and
+# scripts are replaced by the text of the asset.
+#
+STYLESHEET_RE = re.compile(
+    r'<link\s[^>]*rel="stylesheet"[^>]*href="([^"]+)"[^>]*>', re.I)
+SCRIPT_RE = re.compile(r'<script\s+src="([^"]+)"([^>]*)>\s*</script>', re.I)
+
+#
+# The server identification sent in generated headers, matching httpd.
+#
+SERVER_ID = 'lwIP/1.4.1 (http://savannah.nongnu.org/projects/lwip)'
+
+#*****************************************************************************
+#
+# Compute the FNV-1a hash of a file path.
+#
+#*****************************************************************************
+def fs_hash(name):
+    h = FNV_BASIS
+    for c in name.encode('ascii'):
+        h ^= c
+        h = (h * FNV_PRIME) & FNV_MASK
+
+    #
+    # Fold the upper half down since the low bits of an FNV product only
+    # depend on the low bits of the input.
+    #
+    return h ^ (h >> 16)
+
+#*****************************************************************************
+#
+# Mix a bucket displacement into a path hash, giving the slot before it is
+# masked down to the table size.  This is the 32-bit finalizer of
+# MurmurHash3, so that every bit of the displacement moves the slot.
+#
+#*****************************************************************************
+def fs_slot(h, displace):
+    h ^= displace
+    h ^= h >> 16
+    h = (h * 0x85ebca6b) & FNV_MASK
+    h ^= h >> 13
+    h = (h * 0xc2b2ae35) & FNV_MASK
+    h ^= h >> 16
+    return h
+
+#*****************************************************************************
+#
+# Read the (path, symbol, contents) entries for every file below a directory.
+# Hidden files and directories are skipped.
+#
+#*****************************************************************************
+def read_tree(root):
+    files = []
+    symbols = set()
+
+    for dirpath, dirnames, filenames in os.walk(root):
+        dirnames[:] = sorted(d for d in dirnames if not d.startswith('.'))
+        for filename in sorted(filenames):
+            if filename.startswith('.'):
+                continue
+
+            path = os.path.join(dirpath, filename)
+            name = '/' + os.path.relpath(path, root).replace(os.sep, '/')
+
+            sym = re.sub(r'[^A-Za-z0-9]', '_', name[1:])
+            if sym in symbols:
+                sys.exit('%s: symbol %s is already in use' % (path, sym))
+            symbols.add(sym)
+
+            with open(path, 'rb') as f:
+                files.append((name, sym, f.read()))
+
+    if not files:
+        sys.exit('%s: no files found' % root)
+
+    return files
+
+#*****************************************************************************
+#
+# Inline the assets of up to a given size that an HTML page references.
+# Returns the new page contents and the number of assets inlined.
+#
+#*****************************************************************************
+def inline_assets(name, data, contents, limit):
+    if os.path.splitext(name)[1].lower() not in HTML_EXTENSIONS:
+        return data, 0
+
+    count = [0]
+
+    #
+    # Find the text of a referenced file if it is in the image, is small
+    # enough and can be placed in the page as it is.
+    #
+    def lookup(url, closing):
+        if ':' in url or url.startswith('//'):
+            return None
+        if url.startswith('/'):
+            path = posixpath.normpath(url)
+        else:
+            path = posixpath.normpath(
+                posixpath.join(posixpath.dirname(name), url))
+        asset = contents.get(path)
+        if asset is None or len(asset) > limit:
+            return None
+        try:
+            text = asset.decode('utf-8')
+        except UnicodeDecodeError:
+            return None
+        if closing in text.lower():
+            return None
+        return text
+
+    def stylesheet(match):
+        text = lookup(match.group(1), '</style')
+        if text is None:
+            return match.group(0)
+        count[0] += 1
+        return '<style type="text/css">\n' + text + '</style>'
+
+    def script(match):
+        text = lookup(match.group(1), '</script')
+        if text is None:
+            return match.group(0)
+        count[0] += 1
+        return '<script' + match.group(2) + '>\n' + text + '</script>'
+
+    try:
+        page = data.decode('utf-8')
+    except UnicodeDecodeError:
+        return data, 0
+
+    page = STYLESHEET_RE.sub(stylesheet, page)
+    page = SCRIPT_RE.sub(script, page)
+
+    return page.encode('utf-8'), count[0]
+
+#*****************************************************************************
+#
+# Find a table size and a displacement for each bucket for which every path
+# lands in its own slot.  The buckets are placed largest first, while most
+# slots are still free, so the work grows linearly with the number of files.
+#
+#*****************************************************************************
+def build_index(files):
+    buckets = 1
+    while 2 * buckets < len(files):
+        buckets <<= 1
+
+    size = 1
+    while size < len(files) + len(files) // 4:
+        size <<= 1
+
+    hashes = [fs_hash(entry[0]) for entry in files]
+    groups = [[] for idx in range(buckets)]
+    for entry, h in zip(files, hashes):
+        groups[h & (buckets - 1)].append((h, entry))
+    order = sorted((idx for idx in range(buckets) if groups[idx]),
+                   key=lambda idx: len(groups[idx]), reverse=True)
+
+    while True:
+        slots = [None] * size
+        displace = [0] * buckets
+        for bucket in order:
+            for d in range(MAX_DISPLACE_TRIES):
+                taken = [fs_slot(h, d) & (size - 1)
+                         for h, entry in groups[bucket]]
+                if (len(set(taken)) == len(taken) and
+                    all(slots[slot] is None for slot in taken)):
+                    break
+            else:
+                break
+            for slot, (h, entry) in zip(taken, groups[bucket]):
+                slots[slot] = entry
+            displace[bucket] = d
+        else:
+            return size, displace, slots
+        size <<= 1
+
+#*****************************************************************************
+#
+# Look up the Cache-Control directive configured for a file, if any.
+#
+#*****************************************************************************
+def cache_control(name, rules):
+    for pattern, directive in rules:
+        if fnmatch.fnmatchcase(name, pattern):
+            return directive
+    return None
+
+#*****************************************************************************
+#
+# Build the HTTP response header sent ahead of a file.  The ETag is a strong
+# validator over the exact bytes of the body, so the plain and gzip copies
+# of a file get different tags.
+#
+#*****************************************************************************
+def http_header(name, body, encoding, rules):
+    ext = os.path.splitext(name)[1].lower()
+
+    if '404' in name:
+        status = 'HTTP/1.0 404 File not found'
+    else:
+        status = 'HTTP/1.0 200 OK'
+
+    hdr = status + '\r\n'
+    hdr += 'Server: ' + SERVER_ID + '\r\n'
+    if ext not in SSI_EXTENSIONS:
+        hdr += 'Content-Length: %d\r\n' % len(body)
+    hdr += 'Content-Type: ' + CONTENT_TYPES.get(ext, 'text/plain') + '\r\n'
+    if encoding:
+        hdr += 'Content-Encoding: ' + encoding + '\r\n'
+    hdr += 'ETag: "%s"\r\n' % hashlib.sha256(body).hexdigest()[:ETAG_DIGITS]
+    directive = cache_control(name, rules)
+    if directive:
+        hdr += 'Cache-Control: ' + directive + '\r\n'
+    hdr += '\r\n'
+
+    return hdr.encode('ascii')
+
+#*****************************************************************************
+#
+# Compress a file for its gzip variant.  Returns None if the file is not
+# worth compressing.
+#
+#*****************************************************************************
+def gzip_variant(name, data):
+    if os.path.splitext(name)[1].lower() not in GZIP_EXTENSIONS:
+        return None
+
+    #
+    # Leave out the timestamp so that the output only changes when the file
+    # contents do.
+    #
+    packed = gzip.compress(data, compresslevel=9, mtime=0)
+    if len(packed) >= len(data):
+        return None
+
+    return packed
+
+#*****************************************************************************
+#
+# Pad the image out to the next aligned offset.
+#
+#*****************************************************************************
+def align(image):
+    image.extend(b'\0' * (-len(image) % IMAGE_ALIGN))
+
+#*****************************************************************************
+#
+# Write the image as a C source file.  An array of words is aligned as
+# enet_fs.c needs without any compiler-specific directive.
+#
+#*****************************************************************************
+def write_c_image(path, image):
+    words = struct.unpack('<%dI' % (len(image) // 4), image)
+
+    banner = '//' + '*' * 77 + '\n'
+
+    with open(path, 'w') as f:
+        f.write(banner)
+        f.write('//\n'
+                '// %s - File system image for use with IAR and CCS.\n'
+                '//\n'
+                '// This file is generated by tools/makefsdata.py from the '
+                'contents of the\n'
+                '// fs directory, and must not be edited.  enet_fs.c reads '
+                'it through\n'
+                '// g_sFSImage.\n'
+                '//\n' % os.path.basename(path))
+        f.write(banner)
+        f.write('\n'
+                '#include <stdint.h>\n'
+                '\n'
+                'const uint32_t g_sFSImage[%d] =\n'
+                '{\n' % len(words))
+        for idx in range(0, len(words), 6):
+            f.write('    ' + ' '.join('0x%08x,' % word
+                                      for word in words[idx:idx + 6]) +
+                    '\n')
+        f.write('};\n')
+
+#*****************************************************************************
+#
+# Write the image.
+#
+#*****************************************************************************
+def write_image(path, files, size, displace, slots, variants, rules):
+    entry_size = 5 * 4
+    index = 16 + len(displace) * 4
+    image = bytearray(index + size * entry_size)
+
+    #
+    # Lay out the names, then the responses, recording where each one goes.
+    #
+    names = {}
+    for name, sym, data in files:
+        names[sym] = len(image)
+        image.extend(name.encode('ascii') + b'\0')
+
+    responses = {}
+    for name, sym, data in files:
+        align(image)
+        response = http_header(name, data, None, rules) + data
+        plain = (len(image), len(response))
+        image.extend(response)
+
+        packed = (0, 0)
+        if sym in variants:
+            align(image)
+            response = (http_header(name, variants[sym], 'gzip', rules) +
+                        variants[sym])
+            packed = (len(image), len(response))
+            image.extend(response)
+
+        responses[sym] = plain + packed
+
+    #
+    # Fill in the directory.
+    #
+    struct.pack_into('<4sIII', image, 0, IMAGE_MAGIC, len(files), size,
+                     len(displace))
+    struct.pack_into('<%dI' % len(displace), image, 16, *displace)
+    for idx, slot in enumerate(slots):
+        if slot is not None:
+            sym = slot[1]
+            struct.pack_into('<5I', image, index + idx * entry_size,
+                             names[sym], *responses[sym])
+
+    align(image)
+    if path.endswith('.c'):
+        write_c_image(path, image)
+    else:
+        with open(path, 'wb') as f:
+            f.write(image)
+
+    return len(image)
+
+#*****************************************************************************
+#
+# Parse a PATTERN=DIRECTIVE Cache-Control rule.
+#
+#*****************************************************************************
+def cache_rule(arg):
+    pattern, sep, directive = arg.partition('=')
+    if not sep or not pattern or not directive:
+        raise argparse.ArgumentTypeError('expected PATTERN=DIRECTIVE')
+    return (pattern, directive)
+
+#*****************************************************************************
+#
+# Main entry point.
+#
+#*****************************************************************************
+def main():
+    parser = argparse.ArgumentParser(
+        description='Generate the file system image for enet_fs.c.')
+    parser.add_argument('-i', dest='input', required=True,
+                        help='directory holding the files to serve')
+    parser.add_argument('-o', dest='output', required=True,
+                        help='image file to generate, as C source if it '
+                             'ends in .c')
+    parser.add_argument('-c', dest='rules', action='append', default=[],
+                        type=cache_rule, metavar='PATTERN=DIRECTIVE',
+                        help='Cache-Control directive for matching files')
+    parser.add_argument('-l', dest='limit', type=int, default=0,
+                        help='inline styles and scripts of up to LIMIT bytes '
+                             'into pages')
+    parser.add_argument('-z', dest='gzip', action='store_true',
+                        help='add gzip-compressed variants of the files')
+    parser.add_argument('-q', dest='quiet', action='store_true',
+                        help='do not report the image layout')
+    args = parser.parse_args()
+
+    files = read_tree(args.input)
+
+    inlined = 0
+    if args.limit > 0:
+        contents = dict((name, data) for name, sym, data in files)
+        for idx, (name, sym, data) in enumerate(files):
+            data, count = inline_assets(name, data, contents, args.limit)
+            files[idx] = (name, sym, data)
+            inlined += count
+    size, displace, slots = build_index(files)
+
+    variants = {}
+    if args.gzip:
+        for name, sym, data in files:
+            variant = gzip_variant(name, data)
+            if variant is not None:
+                variants[sym] = variant
+
+    length = write_image(args.output, files, size, displace, slots, variants,
+                         args.rules)
+
+    if not args.quiet:
+        print('%d files indexed in %d slots and %d buckets, %d byte image' %
+              (len(files), size, len(displace), length))
+        if args.limit > 0:
+            print('%d asset references of up to %d bytes inlined' %
+                  (inlined, args.limit))
+        saved = 0
+        added = 0
+        for name, sym, data in files:
+            if sym in variants:
+                packed = variants[sym]
+                print('  %-24s %7d -> %7d bytes gzip, %6d saved (%d%%)' %
+                      (name, len(data), len(packed), len(data) - len(packed),
+                       (100 * (len(data) - len(packed))) // len(data)))
+                saved += len(data) - len(packed)
+                added += len(http_header(name, packed, 'gzip', args.rules))
+                added += len(packed)
+        if args.gzip:
+            print('%d bytes saved per transfer by %d gzip variants, which '
+                  'add %d bytes to the image' %
+                  (saved, len(variants), added))
+
+if __name__ == '__main__':
+    main()